@@ -17,11 +17,12 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component provides a class, 'baljsn::Decoder', for
 // decoding value-semantic objects in the JSON format.  In particular, the
 // 'class' contains a parameterized 'decode' function that decodes an object
-// from a specified stream.  There are two overloaded versions of this
+// from a specified stream.  There are three overloaded versions of this
 // function:
 //
 //: o one that reads from a 'bsl::streambuf'
 //: o one that reads from a 'bsl::istream'
+//: o one that reads, in-situ, from a contiguous buffer
 //
 // This component can be used with types that support the 'bdeat' framework
 // (see the 'bdeat' package for details), which is a compile-time interface for
@@ -32,6 +33,17 @@ BSLS_IDENT("$Id: $")
 // object as defined in the 'bdlat_sequencefunctions', 'bdlat_choicefunctions',
 // and 'bdlat_arrayfunctions' components.
 //
+///In-Situ Decoding
+///----------------
+// When the JSON data is available in a contiguous buffer (e.g., a
+// memory-mapped file, or a blob whose data has been made contiguous), the
+// 'decode' overload taking the address and length of that buffer should be
+// used.  That overload does not copy the data into an internal buffer: each
+// token is a reference into the supplied buffer, and string values are copied
+// directly into the decoded object, unescaping them only if they contain
+// escape sequences.  This greatly reduces the number of allocations, and the
+// amount of copying, needed to decode large documents.
+//
 // Although the JSON format is easy to read and write and is very useful for
 // debugging, it is relatively expensive to encode and decode and relatively
 // bulky to transmit.  It is more efficient to use a binary encoding (such as
@@ -142,6 +154,10 @@ BSLS_IDENT("$Id: $")
 #include <bdlat_attributeinfo.h>
 #endif
 
+#ifndef INCLUDED_BDLAT_ATTRIBUTENAMEINDEX
+#include <bdlat_attributenameindex.h>
+#endif
+
 #ifndef INCLUDED_BDLAT_CHOICEFUNCTIONS
 #include <bdlat_choicefunctions.h>
 #endif
@@ -190,6 +206,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_types.h>
 #endif
 
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
 #ifndef INCLUDED_BSL_IOSTREAM
 #include <bsl_iostream.h>
 #endif
@@ -232,6 +252,10 @@ class Decoder {
     int                 d_maxDepth;             // max decoding depth
     bool                d_skipUnknownElements;  // skip unknown elements flag
 
+    bdlat_AttributeNameIndexCache
+                        d_attributeNameIndexes; // attribute name index of
+                                                // each sequence type decoded
+
     // FRIENDS
     friend struct Decoder_DecodeImpProxy;
     friend struct Decoder_ElementVisitor;
@@ -267,6 +291,14 @@ class Decoder {
         // formatting mode as specified in 'bdlat_FormattingMode'.  Note that
         // 'ANY_CATEGORY' shall be a tag-type defined in 'bdlat_TypeCategory'.
 
+    template <class TYPE>
+    int decodeDocument(TYPE *value, const DecoderOptions& options);
+        // Decode into the specified 'value', of a (template parameter) 'TYPE',
+        // the JSON document read by the tokenizer owned by this object, using
+        // the specified 'options'.  Return 0 on success, and a non-zero value
+        // otherwise.  The behavior is undefined unless the tokenizer has been
+        // reset to the start of the document.
+
     int skipUnknownElement(const bslstl::StringRef& elementName);
         // Skip the unknown element specified by 'elementName' by discarding
         // all the data associated with it and advancing the parser to the next
@@ -312,6 +344,20 @@ class Decoder {
         // attempt to update the input position of 'stream' to the last
         // unprocessed byte.
 
+    template <class TYPE>
+    int decode(const char            *data,
+               bsl::size_t            length,
+               TYPE                  *value,
+               const DecoderOptions&  options);
+        // Decode into the specified 'value', of a (template parameter) 'TYPE',
+        // the specified 'length' characters of JSON data at the specified
+        // 'data' address, using the specified 'options'.  'TYPE' shall be a
+        // 'bdeat'-compatible sequence, choice, or array type, or a
+        // 'bdeat'-compatible dynamic type referring to one of those types.
+        // Return 0 on success, and a non-zero value otherwise.  Note that the
+        // data is read in-situ, without being copied (see {In-Situ
+        // Decoding}).
+
     template <class TYPE>
     int decode(bsl::streambuf *streamBuf, TYPE *value);
         // Decode an object of (template parameter) 'TYPE' from the specified
@@ -477,6 +523,15 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
             return -1;                                                // RETURN
         }
 
+        // Resolve element names using the attribute name index of 'TYPE',
+        // expecting elements in the order in which 'TYPE' declares them, and
+        // fall back on the name-based lookup of 'TYPE' for names unknown to
+        // the index (see 'bdlat_attributenameindex').
+
+        const bdlat_AttributeNameIndex *index =
+                                     d_attributeNameIndexes.lookupIndex(value);
+        int                             position = 0;
+
         while (Tokenizer::e_ELEMENT_NAME ==
                                                      d_tokenizer.tokenType()) {
             bslstl::StringRef elementName;
@@ -486,10 +541,20 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
                 return -1;                                            // RETURN
             }
 
-            if (bdlat_SequenceFunctions::hasAttribute(
-                                     *value,
-                                     elementName.data(),
-                                     static_cast<int>(elementName.length()))) {
+            const int nameLength = static_cast<int>(elementName.length());
+
+            int        attributeId;
+            const bool isIndexed = index
+                                && 0 == index->findAttributeId(
+                                                          &attributeId,
+                                                          &position,
+                                                          elementName.data(),
+                                                          nameLength);
+
+            if (isIndexed || bdlat_SequenceFunctions::hasAttribute(
+                                                          *value,
+                                                          elementName.data(),
+                                                          nameLength)) {
                 d_elementName = elementName;
 
                 rc = d_tokenizer.advanceToNextToken();
@@ -501,11 +566,16 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
 
                 Decoder_ElementVisitor visitor = { this, mode };
 
-                if (0 != bdlat_SequenceFunctions::manipulateAttribute(
-                                   value,
-                                   visitor,
-                                   d_elementName.data(),
-                                   static_cast<int>(d_elementName.length()))) {
+                rc = isIndexed
+                   ? bdlat_SequenceFunctions::manipulateAttribute(value,
+                                                                  visitor,
+                                                                  attributeId)
+                   : bdlat_SequenceFunctions::manipulateAttribute(
+                                  value,
+                                  visitor,
+                                  d_elementName.data(),
+                                  static_cast<int>(d_elementName.length()));
+                if (0 != rc) {
                     d_logStream << "Could not decode sequence, error decoding "
                                 << "element or bad element name '"
                                 << d_elementName << "' \n";
@@ -895,27 +965,10 @@ int Decoder::decodeImp(TYPE *, ANY_CATEGORY)
     return -1;
 }
 
-// CREATORS
-inline
-Decoder::Decoder(bslma::Allocator *basicAllocator)
-: d_logStream(basicAllocator)
-, d_tokenizer(basicAllocator)
-, d_elementName(basicAllocator)
-, d_currentDepth(0)
-, d_maxDepth(0)
-, d_skipUnknownElements(false)
-{
-}
-
-// MANIPULATORS
+// PRIVATE MANIPULATORS
 template <class TYPE>
-int Decoder::decode(bsl::streambuf        *streamBuf,
-                    TYPE                  *value,
-                    const DecoderOptions&  options)
+int Decoder::decodeDocument(TYPE *value, const DecoderOptions& options)
 {
-    BSLS_ASSERT(streamBuf);
-    BSLS_ASSERT(value);
-
     bdlat_TypeCategory::Value category =
                                 bdlat_TypeCategoryFunctions::select(*value);
 
@@ -927,7 +980,6 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
         return -1;                                                    // RETURN
     }
 
-    d_tokenizer.reset(streamBuf);
     d_tokenizer.setAllowStandAloneValues(false);
 
     typedef typename bdlat_TypeCategory::Select<TYPE>::Type TypeCategory;
@@ -947,13 +999,54 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
     d_maxDepth            = options.maxDepth();
     d_skipUnknownElements = options.skipUnknownElements();
 
-    rc = decodeImp(value, 0, TypeCategory());
+    return decodeImp(value, 0, TypeCategory());
+}
+
+// CREATORS
+inline
+Decoder::Decoder(bslma::Allocator *basicAllocator)
+: d_logStream(basicAllocator)
+, d_tokenizer(basicAllocator)
+, d_elementName(basicAllocator)
+, d_currentDepth(0)
+, d_maxDepth(0)
+, d_skipUnknownElements(false)
+, d_attributeNameIndexes(basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+int Decoder::decode(bsl::streambuf        *streamBuf,
+                    TYPE                  *value,
+                    const DecoderOptions&  options)
+{
+    BSLS_ASSERT(streamBuf);
+    BSLS_ASSERT(value);
+
+    d_tokenizer.reset(streamBuf);
+
+    const int rc = decodeDocument(value, options);
 
     d_tokenizer.resetStreamBufGetPointer();
 
     return rc;
 }
 
+template <class TYPE>
+int Decoder::decode(const char            *data,
+                    bsl::size_t            length,
+                    TYPE                  *value,
+                    const DecoderOptions&  options)
+{
+    BSLS_ASSERT(data || 0 == length);
+    BSLS_ASSERT(value);
+
+    d_tokenizer.reset(data, length);
+
+    return decodeDocument(value, options);
+}
+
 template <class TYPE>
 int Decoder::decode(bsl::istream&          stream,
                     TYPE                  *value,
@@ -33,6 +33,7 @@
 #include <balxml_minireader.h>
 #include <balxml_errorinfo.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
@@ -66,14 +67,16 @@ using bsl::endl;
 // MANIPULATORS
 // [ 4] int decode(bsl::streambuf *streamBuf, TYPE *v, options);
 // [ 4] int decode(bsl::istream& stream, TYPE *v, options);
+// [ 7] int decode(const char *data, size_t length, TYPE *v, options);
 //
 // ACCESSORS
 // [ 4] bsl::string loggedMessages() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
 // [ 5] MULTI-THREADING TEST CASE
 // [ 6] DRQS 43702912
+// [ 8] CONCERN: element names are resolved in any order
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -36929,7 +36932,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -37036,6 +37039,204 @@ int main(int argc, char *argv[])
     ASSERT(21              == employee.age());
 //..
       } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING ELEMENT ORDER
+        //
+        // Concerns:
+        //: 1 Elements of a sequence are decoded correctly whatever their
+        //:   order, including repeated and unknown elements (i.e., the
+        //:   resolution of element names does not depend on elements being
+        //:   in declaration order).
+        //:
+        //: 2 A single decoder decodes several sequence types correctly.
+        //
+        // Plan:
+        //: 1 Decode, with one decoder, every permutation of the elements of a
+        //:   'test::Employee', with and without an unknown element, and
+        //:   verify the result.  (C-1..2)
+        //:
+        //: 2 Decode an object having a repeated element, and verify that the
+        //:   last value is retained.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: element names are resolved in any order
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING ELEMENT ORDER" << endl
+                          << "=====================" << endl;
+
+        const char *const ELEMENTS[] = {
+            "\"name\":\"Bob\"",
+            "\"homeAddress\":{\"state\":\"New York\",\"city\":\"New York "
+                                  "City\",\"street\":\"Lexington Ave\"}",
+            "\"age\":21",
+        };
+
+        baljsn::DecoderOptions options;
+        options.setSkipUnknownElements(true);
+
+        baljsn::Decoder decoder;
+
+        int order[] = { 0, 1, 2 };
+        do {
+            for (int withUnknown = 0; withUnknown < 2; ++withUnknown) {
+                bsl::string input("{");
+                for (int i = 0; i < 3; ++i) {
+                    if (i) {
+                        input += ',';
+                    }
+                    if (withUnknown && 1 == i) {
+                        input += "\"unknown\":[1,2],";
+                    }
+                    input += ELEMENTS[order[i]];
+                }
+                input += '}';
+
+                if (veryVerbose) { P(input) }
+
+                test::Employee value;
+
+                bsl::istringstream is(input);
+                ASSERTV(input, decoder.loggedMessages(),
+                        0 == decoder.decode(is, &value, options));
+
+                const test::Address& ADDRESS = value.homeAddress();
+
+                ASSERTV(input, "Bob"           == value.name());
+                ASSERTV(input, "Lexington Ave" == ADDRESS.street());
+                ASSERTV(input, "New York City" == ADDRESS.city());
+                ASSERTV(input, "New York"      == ADDRESS.state());
+                ASSERTV(input, 21              == value.age());
+            }
+        } while (bsl::next_permutation(order, order + 3));
+
+        {
+            const char INPUT[] = "{\"age\":21,\"name\":\"Bob\",\"age\":22}";
+
+            test::Employee value;
+
+            bsl::istringstream is(INPUT);
+            ASSERT(0 == decoder.decode(is, &value, options));
+            ASSERT("Bob" == value.name());
+            ASSERTV(value.age(), 22 == value.age());
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING IN-SITU DECODING
+        //
+        // Concerns:
+        //: 1 Decoding from a contiguous buffer produces the same object, and
+        //:   the same status, as decoding the same data from a stream.
+        //:
+        //: 2 String values are correctly unescaped, and string values longer
+        //:   than the internal buffer of the tokenizer are supported.
+        //:
+        //: 3 Only the specified number of characters are read from the
+        //:   buffer.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, specify a set of valid and
+        //:   invalid JSON documents.  For each document, decode it from a
+        //:   'bsl::istringstream' and from the underlying buffer, and verify
+        //:   that the status and the decoded objects are the same.  (C-1..2)
+        //:
+        //: 2 Decode a prefix of a valid document, and verify that decoding
+        //:   fails.  (C-3)
+        //
+        // Testing:
+        //   int decode(const char *data, size_t length, TYPE *v, options);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING IN-SITU DECODING" << endl
+                          << "========================" << endl;
+
+        bsl::string largeDocument("{\"name\":\"");
+        largeDocument.append(3 * 1024 * 8, 'B');
+        largeDocument.append("\",\"homeAddress\":{\"street\":\"Lexington Ave\""
+                             ",\"city\":\"New York City\",\"state\":\"New"
+                             " York\"},\"age\":21}");
+
+        static const struct {
+            int         d_line;
+            const char *d_input_p;
+            bool        d_isValid;
+        } DATA[] = {
+  //LINE  INPUT                                                        VALID
+  //----  -----                                                        -----
+  { L_,   "{}",                                                        true  },
+  { L_,   "{\"name\":\"Bob\",\"age\":21}",                             true  },
+  { L_,   "{\"name\":\"B\\u006fb\\t\\\"\\\\\",\"age\":21}",            true  },
+  { L_,   " { \"name\" : \"Bob\" , \"homeAddress\" : { \"street\" : "
+          "\"Lexington Ave\", \"city\" : \"New York City\", \"state\" : "
+          "\"New York\" } , \"age\" : 21 } ",                          true  },
+  { L_,   largeDocument.c_str(),                                       true  },
+  { L_,   "",                                                          false },
+  { L_,   "{\"name\":\"Bob\\x\"}",                                     false },
+  { L_,   "{\"age\":\"Bob\"}",                                         false },
+  { L_,   "{\"name\":\"Bob\",",                                        false },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        baljsn::DecoderOptions options;
+        options.setSkipUnknownElements(false);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE     = DATA[ti].d_line;
+            const char        *INPUT    = DATA[ti].d_input_p;
+            const bool         IS_VALID = DATA[ti].d_isValid;
+            const bsl::size_t  LENGTH   = bsl::strlen(INPUT);
+
+            if (veryVerbose) { P(LINE) }
+
+            test::Employee expected;
+            test::Employee value;
+
+            bsl::istringstream is(INPUT);
+
+            baljsn::Decoder expDecoder;
+            const int EXP_RC = expDecoder.decode(is, &expected, options);
+
+            baljsn::Decoder decoder;
+            const int RC = decoder.decode(INPUT, LENGTH, &value, options);
+
+            ASSERTV(LINE, EXP_RC, IS_VALID, IS_VALID == (0 == EXP_RC));
+            ASSERTV(LINE, RC,     IS_VALID, IS_VALID == (0 == RC));
+
+            if (IS_VALID) {
+                ASSERTV(LINE, expected.name() == value.name());
+                ASSERTV(LINE, expected.homeAddress().street() ==
+                                                value.homeAddress().street());
+                ASSERTV(LINE, expected.homeAddress().city() ==
+                                                  value.homeAddress().city());
+                ASSERTV(LINE, expected.homeAddress().state() ==
+                                                 value.homeAddress().state());
+                ASSERTV(LINE, expected.age() == value.age());
+            }
+        }
+
+        if (verbose) cout << "\nTesting decoding a prefix." << endl;
+        {
+            const char INPUT[] = "{\"name\":\"Bob\",\"age\":21}";
+
+            baljsn::Decoder decoder;
+            test::Employee  value;
+
+            ASSERT(0 == decoder.decode(INPUT,
+                                       sizeof INPUT - 1,
+                                       &value,
+                                       options));
+            ASSERT("Bob" == value.name());
+            ASSERT(21    == value.age());
+
+            for (bsl::size_t i = 0; i < sizeof INPUT - 1; ++i) {
+                ASSERTV(i, 0 != decoder.decode(INPUT, i, &value, options));
+            }
+        }
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // TESTING DECODING OF 'hexBinary' CUSTOMIZED TYPE
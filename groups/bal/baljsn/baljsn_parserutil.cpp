@@ -66,9 +66,16 @@ int ParserUtil::getString(bsl::string *value, bslstl::StringRef data)
 
     value->clear();
 
+    // Characters other than escape sequences are appended to 'value' in runs,
+    // so that a string having no escape sequences is copied at once.
+
     ++iter;
+    const char *run = iter;  // start of the pending run of characters
+
     while (iter < end) {
         if ('\\' == *iter) {
+            value->append(run, iter);
+
             ++iter;
             if (iter >= end) {
                 return -1;                                            // RETURN
@@ -151,13 +158,12 @@ int ParserUtil::getString(bsl::string *value, bslstl::StringRef data)
                 return -1;                                            // RETURN
               } break;
             }
+            run = iter + 1;
         }
         else if ('"' == *iter) {
+            value->append(run, iter);
             return 0;                                                 // RETURN
         }
-        else {
-            *value += *iter;
-        }
         ++iter;
     }
 
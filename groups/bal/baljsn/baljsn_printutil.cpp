@@ -4,47 +4,179 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(baljsn_printutil_cpp,"$Id$ $CSID$")
 
+#include <bdlb_bitutil.h>
 #include <bdlde_base64encoder.h>
-#include <bdlde_utf8util.h>
-#include <bsl_sstream.h>
+
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_streambuf.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(__SSE2__)
+#define U_USE_SSE2 1
+#include <emmintrin.h>
+#endif
 
 namespace BloombergLP {
 namespace {
 
-char getEscapeChar(char value)
-    // Return the JSON escape character for the specified 'value' if 'value'
-    // needs to be escaped, and '\0' otherwise.
+inline
+bool isSafe(unsigned char value)
+    // Return 'true' if the specified 'value' is an ASCII character that is
+    // output verbatim in a JSON string, and 'false' otherwise (i.e., if
+    // 'value' needs to be escaped or is part of a multi-byte UTF-8 sequence).
 {
+    return 0x20 <= value && value < 0x80
+        && '"' != value && '\\' != value && '/' != value;
+}
+
+const unsigned char *skipSafe(const unsigned char *begin,
+                              const unsigned char *end)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that is not safe (see 'isSafe'), or 'end' if there is no
+    // such character.
+{
+#ifdef U_USE_SSE2
+    // Note that the comparison for control characters is signed, so that
+    // bytes having their high bit set (i.e., part of multi-byte UTF-8
+    // sequences) are also reported as not safe.
+
+    const __m128i firstSafe  = _mm_set1_epi8(0x20);
+    const __m128i quote      = _mm_set1_epi8('"');
+    const __m128i backslash  = _mm_set1_epi8('\\');
+    const __m128i slash      = _mm_set1_epi8('/');
+
+    while (end - begin >= 16) {
+        const __m128i chunk = _mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(begin));
+        const __m128i unsafe = _mm_or_si128(
+                    _mm_or_si128(_mm_cmpgt_epi8(firstSafe, chunk),
+                                 _mm_cmpeq_epi8(chunk, quote)),
+                    _mm_or_si128(_mm_cmpeq_epi8(chunk, backslash),
+                                 _mm_cmpeq_epi8(chunk, slash)));
+        const bsl::uint32_t mask = static_cast<bsl::uint32_t>(
+                                                   _mm_movemask_epi8(unsafe));
+        if (0 != mask) {
+            begin += bdlb::BitUtil::numTrailingUnsetBits(mask);
+            return begin;                                             // RETURN
+        }
+        begin += 16;
+    }
+#endif
+
+    while (begin != end && isSafe(*begin)) {
+        ++begin;
+    }
+    return begin;
+}
+
+int validSequenceLength(const unsigned char *begin, const unsigned char *end)
+    // Return the length of the multi-byte UTF-8 sequence starting at the
+    // specified 'begin' if the range '[begin, end)' starts with a valid
+    // (i.e., shortest-form, non-surrogate, and at most 0x10ffff) multi-byte
+    // UTF-8 sequence, and 0 otherwise.  The behavior is undefined unless
+    // 'begin < end' and '0x80 <= *begin'.
+{
+    const unsigned int lead   = *begin;
+    unsigned int       minCont = 0x80;  // range of the first continuation
+    unsigned int       maxCont = 0xbf;  // byte
+    int                length;
+
+    if (lead < 0xc2) {
+        // continuation byte, or lead byte of an overlong 2-byte sequence
+
+        return 0;                                                     // RETURN
+    }
+    else if (lead < 0xe0) {
+        length = 2;
+    }
+    else if (lead < 0xf0) {
+        length = 3;
+        if (0xe0 == lead) {
+            minCont = 0xa0;  // overlong
+        }
+        else if (0xed == lead) {
+            maxCont = 0x9f;  // surrogate
+        }
+    }
+    else if (lead < 0xf5) {
+        length = 4;
+        if (0xf0 == lead) {
+            minCont = 0x90;  // overlong
+        }
+        else if (0xf4 == lead) {
+            maxCont = 0x8f;  // greater than 0x10ffff
+        }
+    }
+    else {
+        return 0;                                                     // RETURN
+    }
+
+    if (end - begin < length
+     || begin[1] < minCont
+     || begin[1] > maxCont) {
+        return 0;                                                     // RETURN
+    }
+    for (int i = 2; i < length; ++i) {
+        if (0x80 != (begin[i] & 0xc0)) {
+            return 0;                                                 // RETURN
+        }
+    }
+    return length;
+}
+
+int escape(char *buffer, unsigned char value)
+    // Load into the specified 'buffer' the JSON escape sequence for the
+    // specified 'value', and return the length of that sequence.  The
+    // behavior is undefined unless 'value' needs to be escaped, and 'buffer'
+    // has room for at least 6 characters.
+{
+    static const char HEX[] = "0123456789abcdef";
+
+    buffer[0] = '\\';
     switch (value) {
       case '"':                                                 // FALL THROUGH
       case '\\':                                                // FALL THROUGH
       case '/': {
-        return value;                                                 // RETURN
-      }
+        buffer[1] = static_cast<char>(value);
+      } break;
       case '\b': {
-        return 'b';                                                   // RETURN
-      }
+        buffer[1] = 'b';
+      } break;
       case '\f': {
-        return 'f';                                                   // RETURN
-      }
+        buffer[1] = 'f';
+      } break;
       case '\n': {
-        return 'n';                                                   // RETURN
-      }
+        buffer[1] = 'n';
+      } break;
       case '\r': {
-        return 'r';                                                   // RETURN
-      }
+        buffer[1] = 'r';
+      } break;
       case '\t': {
-        return 't';                                                   // RETURN
-      }
+        buffer[1] = 't';
+      } break;
       default: {
-        if (0 <= value && value < 32) {
-            // control characters
+        // control characters
 
-            return 'u';                                               // RETURN
-        }
+        buffer[1] = 'u';
+        buffer[2] = '0';
+        buffer[3] = '0';
+        buffer[4] = HEX[value >> 4];
+        buffer[5] = HEX[value & 0xf];
+        return 6;                                                     // RETURN
       }
     }
-    return 0;
+    return 2;
+}
+
+inline
+bool write(bsl::streambuf *streamBuf, const char *data, bsl::streamsize length)
+    // Write the specified 'length' characters at the specified 'data' to the
+    // specified 'streamBuf'.  Return 'true' on success, and 'false'
+    // otherwise.
+{
+    return 0 == length || length == streamBuf->sputn(data, length);
 }
 
 }  // close unnamed namespace
@@ -58,40 +190,59 @@ namespace baljsn {
 int PrintUtil::printString(bsl::ostream&            stream,
                            const bslstl::StringRef& value)
 {
+    // Runs of characters that are output verbatim (i.e., that need not be
+    // escaped, including valid multi-byte UTF-8 sequences) are written to the
+    // stream buffer with a single call; only escaped characters are written
+    // individually.  The UTF-8 encoding of 'value' is validated in the same
+    // pass.
 
-    if (!bdlde::Utf8Util::isValid(value.data(),
-                                  static_cast<int>(value.length()))) {
+    bsl::streambuf *streamBuf = stream.rdbuf();
+    if (!stream.good() || 0 == streamBuf) {
+        stream.setstate(bsl::ios_base::failbit);
         return -1;                                                    // RETURN
     }
 
-    stream << '"';
+    const unsigned char *next = reinterpret_cast<const unsigned char *>(
+                                                                value.data());
+    const unsigned char *end  = next + value.length();
+    const unsigned char *run  = next;  // start of the pending verbatim run
 
-    for (bslstl::StringRef::const_iterator it = value.begin();
-         it != value.end();
-         ++it) {
-        bsl::string str;
+    bool ok = write(streamBuf, "\"", 1);
 
-        char ch = getEscapeChar(*it);
-        if (0 != ch) {
-            str += '\\';
-            str += ch;
-            if ('u' == ch) {
-                bsl::ostringstream oss;
+    while (ok) {
+        next = skipSafe(next, end);
+        if (next == end) {
+            break;
+        }
 
-                oss << "00"
-                    << bsl::hex << bsl::setfill('0') << bsl::setw(2)
-                    << (static_cast<unsigned int>(*it) & 0xff);
-                str += oss.str();
-            }
+        if (*next < 0x80) {
+            char buffer[6];
+            const int length = escape(buffer, *next);
+
+            ok = write(streamBuf,
+                       reinterpret_cast<const char *>(run),
+                       next - run)
+              && write(streamBuf, buffer, length);
+            run = ++next;
         }
         else {
-            str += *it;
+            const int length = validSequenceLength(next, end);
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == length)) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+                return -1;                                            // RETURN
+            }
+            next += length;
         }
-
-        stream << str;
     }
 
-    stream << '"';
+    ok = ok
+      && write(streamBuf, reinterpret_cast<const char *>(run), end - run)
+      && write(streamBuf, "\"", 1);
+
+    if (!ok) {
+        stream.setstate(bsl::ios_base::badbit);
+        return -1;                                                    // RETURN
+    }
     return 0;
 }
 }  // close package namespace
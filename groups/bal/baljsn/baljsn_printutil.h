@@ -157,7 +157,10 @@ struct PrintUtil {
     static int printString(bsl::ostream&            stream,
                            const bslstl::StringRef& value);
         // Encode the specified string 'value' into JSON format and output the
-        // result to the specified 'stream'.
+        // result to the specified 'stream'.  Return 0 on success, and a
+        // non-zero value if 'value' is not valid UTF-8 or if the output
+        // fails.  Note that 'value' is validated as it is output, so a prefix
+        // of the encoded 'value' may have been written to 'stream' on failure.
 
   public:
     // CLASS METHODS
@@ -651,6 +651,10 @@ int main(int argc, char *argv[])
         //: 3 Control characters are encoded as hex.
         //:
         //: 4 Invalid UTF-8 strings are rejected.
+        //:
+        //: 5 Characters to escape, multi-byte UTF-8 sequences, and invalid
+        //:   UTF-8 sequences are handled at any position in a string,
+        //:   including in long strings and in strings having embedded nulls.
         //
         // Plan:
         //: 1 Using the table-driven technique:
@@ -661,6 +665,10 @@ int main(int argc, char *argv[])
         //:   2 Encode the value and verify the results.
         //:
         //: 2 Repeat for strings and Customized type.
+        //:
+        //: 3 For each of a set of character sequences, and each of a range of
+        //:   positions, encode a string having that sequence at that position
+        //:   and verify the result.  (C-5)
         //
         // Testing:
         //  static int printValue(bsl::ostream& s, const char             *v);
@@ -768,6 +776,66 @@ int main(int argc, char *argv[])
                 }
             }
         }
+
+        if (verbose) cout << "Encode sequences at every position" << endl;
+        {
+            const struct {
+                int         d_line;
+                const char *d_value;   // sequence
+                int         d_length;  // length of sequence
+                const char *d_result;  // encoded sequence, or 0 if invalid
+            } DATA[] = {
+                //LINE  VALUE                LEN  RESULT
+                //----  -----                ---  ------
+                { L_,   "\"",                1,   "\\\"" },
+                { L_,   "\\",               1,   "\\\\" },
+                { L_,   "/",                 1,   "\\/" },
+                { L_,   "\n",                1,   "\\n" },
+                { L_,   "\x1f",              1,   "\\u001f" },
+                { L_,   "\0",                1,   "\\u0000" },
+                { L_,   "\x7f",              1,   "\x7f" },
+                { L_,   "\xc3\xa9",          2,   "\xc3\xa9" },
+                { L_,   "\xe2\x82\xac",      3,   "\xe2\x82\xac" },
+                { L_,   "\xf0\x9f\x98\x80",  4,   "\xf0\x9f\x98\x80" },
+                { L_,   "\x80",              1,   0 },
+                { L_,   "\xc3",              1,   0 },
+                { L_,   "\xe2\x82",          2,   0 },
+                { L_,   "\xc0\xaf",          2,   0 },
+                { L_,   "\xed\xa0\x80",      3,   0 },
+                { L_,   "\xf5\x80\x80\x80",  4,   0 },
+                { L_,   "\xff",              1,   0 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE   = DATA[ti].d_line;
+                const bsl::string VALUE(DATA[ti].d_value, DATA[ti].d_length);
+                const char *const RESULT = DATA[ti].d_result;
+
+                for (int pos = 0; pos < 40; ++pos) {
+                    bsl::string input(pos, 'a');
+                    input += VALUE;
+                    input.append(pos % 7, 'z');
+
+                    bsl::ostringstream oss;
+                    const int rc = Obj::printValue(oss, input);
+
+                    if (!RESULT) {
+                        ASSERTV(LINE, pos, 0 != rc);
+                        continue;                                   // CONTINUE
+                    }
+
+                    bsl::string exp("\"");
+                    exp.append(pos, 'a');
+                    exp += RESULT;
+                    exp.append(pos % 7, 'z');
+                    exp += '"';
+
+                    ASSERTV(LINE, pos, rc, 0 == rc);
+                    ASSERTV(LINE, pos, oss.str(), exp, oss.str() == exp);
+                }
+            }
+        }
       } break;
       case 2: {
         // --------------------------------------------------------------------
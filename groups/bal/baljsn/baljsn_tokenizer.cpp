@@ -56,9 +56,26 @@ BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 namespace BloombergLP {
 namespace {
 
-    static const char *WHITESPACE = " \n\t\v\f\r";
     static const char *TOKENS     = "{}[]:,";
 
+inline
+bool isWhitespace(char value)
+    // Return 'true' if the specified 'value' is one of the whitespace
+    // characters " \n\t\v\f\r", and 'false' otherwise.
+{
+    switch (value) {
+      case ' ':                                                 // FALL THROUGH
+      case '\n':                                                // FALL THROUGH
+      case '\t':                                                // FALL THROUGH
+      case '\v':                                                // FALL THROUGH
+      case '\f':                                                // FALL THROUGH
+      case '\r': {
+        return true;                                                  // RETURN
+      }
+    }
+    return false;
+}
+
 }  // close unnamed namespace
 
 namespace baljsn {
@@ -70,27 +87,44 @@ namespace baljsn {
 // PRIVATE MANIPULATORS
 int Tokenizer::reloadStringBuffer()
 {
+    if (!d_streambuf_p) {
+        // In-situ data is never reloaded.
+
+        return 0;                                                     // RETURN
+    }
+
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
     const int numRead =
                      static_cast<int>(d_streambuf_p->sgetn(&d_stringBuffer[0],
                                                            k_MAX_STRING_SIZE));
     d_cursor = 0;
     d_stringBuffer.resize(numRead);
+    syncDataWithStringBuffer();
     return numRead;
 }
 
 int Tokenizer::expandBufferForLargeValue()
 {
+    if (!d_streambuf_p) {
+        return -1;                                                    // RETURN
+    }
+
     d_stringBuffer.resize(d_stringBuffer.length() + k_MAX_STRING_SIZE);
 
     const int numRead =
             static_cast<int>(d_streambuf_p->sgetn(&d_stringBuffer[d_valueIter],
                                                   k_MAX_STRING_SIZE));
+    d_stringBuffer.resize(d_valueIter + numRead);
+    syncDataWithStringBuffer();
     return numRead ? 0 : -1;
 }
 
 int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 {
+    if (!d_streambuf_p) {
+        return 0;                                                     // RETURN
+    }
+
     d_stringBuffer.erase(d_stringBuffer.begin(),
                          d_stringBuffer.begin() + d_valueBegin);
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
@@ -101,10 +135,9 @@ int Tokenizer::moveValueCharsToStartAndReloadBuffer()
        static_cast<int>(d_streambuf_p->sgetn(&d_stringBuffer[d_valueIter],
                                              k_MAX_STRING_SIZE - d_valueIter));
 
-    if (numRead > 0) {
-        d_stringBuffer.resize(d_valueIter + numRead);
-        d_valueBegin = 0;
-    }
+    d_stringBuffer.resize(d_valueIter + numRead);
+    d_valueBegin = 0;
+    syncDataWithStringBuffer();
 
     return numRead;
 }
@@ -112,10 +145,10 @@ int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 int Tokenizer::skipWhitespace()
 {
     while (true) {
-        bsl::size_t pos = d_stringBuffer.find_first_not_of(WHITESPACE,
-                                                           d_cursor);
-        if (bsl::string::npos != pos) {
-            d_cursor = pos;
+        while (d_cursor < d_dataLength && isWhitespace(d_data_p[d_cursor])) {
+            ++d_cursor;
+        }
+        if (d_cursor < d_dataLength) {
             break;
         }
 
@@ -133,21 +166,21 @@ int Tokenizer::extractStringValue()
     char previousChar = 0;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && '"' != d_stringBuffer[d_valueIter]) {
+        while (d_valueIter < d_dataLength
+            && '"' != d_data_p[d_valueIter]) {
 
-            if ('\\' == d_stringBuffer[d_valueIter]
+            if ('\\' == d_data_p[d_valueIter]
              && '\\' == previousChar) {
                 previousChar = 0;
             }
             else {
-                previousChar = d_stringBuffer[d_valueIter];
+                previousChar = d_data_p[d_valueIter];
             }
 
             ++d_valueIter;
         }
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        if (d_valueIter >= d_dataLength) {
 
             // There isn't enough room in the internal buffer to hold the
             // value.  If this is the first time through the loop, we move the
@@ -188,13 +221,13 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
     bool firstTime = true;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && !bdlb::CharType::isSpace(d_stringBuffer[d_valueIter])
-            && !bsl::strchr(TOKENS, d_stringBuffer[d_valueIter])) {
+        while (d_valueIter < d_dataLength
+            && !bdlb::CharType::isSpace(d_data_p[d_valueIter])
+            && !bsl::strchr(TOKENS, d_data_p[d_valueIter])) {
             ++d_valueIter;
         }
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        if (d_valueIter >= d_dataLength) {
 
             // There isn't enough room in the internal buffer to hold the
             // value.  If this is the first time through the loop, we move the
@@ -233,7 +266,7 @@ int Tokenizer::advanceToNextToken()
         return -1;                                                    // RETURN
     }
 
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (d_cursor >= d_dataLength) {
         const int numRead = reloadStringBuffer();
         if (0 == numRead) {
             d_tokenType = e_ERROR;
@@ -252,7 +285,7 @@ int Tokenizer::advanceToNextToken()
             return -1;                                                // RETURN
         }
 
-        switch (d_stringBuffer[d_cursor]) {
+        switch (d_data_p[d_cursor]) {
           case '{': {
             if ((e_ELEMENT_NAME == d_tokenType && ':' == previousChar)
              || e_START_ARRAY   == d_tokenType
@@ -450,6 +483,10 @@ int Tokenizer::advanceToNextToken()
 
 int Tokenizer::resetStreamBufGetPointer()
 {
+    if (!d_streambuf_p) {
+        return -1;                                                    // RETURN
+    }
+
     if (d_cursor >= d_stringBuffer.size()) {
         return 0;                                                     // RETURN
     }
@@ -469,8 +506,7 @@ int Tokenizer::value(bslstl::StringRef *data) const
     if ((e_ELEMENT_NAME == d_tokenType
                                         || e_ELEMENT_VALUE == d_tokenType)
      && d_valueBegin != d_valueEnd) {
-        data->assign(&d_stringBuffer[d_valueBegin],
-                     &d_stringBuffer[d_valueEnd]);
+        data->assign(d_data_p + d_valueBegin, d_data_p + d_valueEnd);
         return 0;                                                     // RETURN
     }
     return -1;
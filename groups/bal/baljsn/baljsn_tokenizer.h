@@ -21,6 +21,15 @@ BSLS_IDENT("$Id: $")
 // 'bsl::streambuf' containing JSON data with a tokenizer object and then call
 // the 'advanceToNextToken' function to extract individual data values.
 //
+///In-Situ Tokenization
+///--------------------
+// A tokenizer can also be 'reset' to read JSON data held in a contiguous
+// buffer supplied by the client (e.g., a memory-mapped file, or a blob whose
+// data has been made contiguous).  In that case the tokenizer does not copy
+// the data into an internal buffer: the string references returned by 'value'
+// refer directly into the client's buffer, which must therefore remain valid
+// and unmodified for as long as the tokenizer is used on it.
+//
 // This 'class' was created to be used by other components in the 'baljsn'
 // package and in most cases clients should use the 'baljsn_decoder' component
 // instead of using this 'class'.
@@ -137,10 +146,18 @@ BSLS_IDENT("$Id: $")
 #include <bsls_alignedbuffer.h>
 #endif
 
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
 #ifndef INCLUDED_BSLS_TYPES
 #include <bsls_types.h>
 #endif
 
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
 #ifndef INCLUDED_BSL_STRING
 #include <bsl_string.h>
 #endif
@@ -204,7 +221,21 @@ class Tokenizer {
 
     bsl::streambuf                      *d_streambuf_p;          // streambuf
                                                                  // (held, not
-                                                                 // owned)
+                                                                 // owned), or
+                                                                 // 0 for
+                                                                 // in-situ
+                                                                 // data
+
+    const char                          *d_data_p;               // data being
+                                                                 // tokenized:
+                                                                 // the string
+                                                                 // buffer or
+                                                                 // in-situ
+                                                                 // data (held,
+                                                                 // not owned)
+
+    bsl::size_t                          d_dataLength;           // length of
+                                                                 // data
 
     bsl::size_t                          d_cursor;               // current
                                                                  // cursor
@@ -268,6 +299,11 @@ class Tokenizer {
         // encountered and position the cursor onto the first such character.
         // Return 0 on success and a non-zero value otherwise.
 
+    void syncDataWithStringBuffer();
+        // Set the data being tokenized to the contents of the string buffer,
+        // 'd_stringBuffer'.  Note that this function must be called each time
+        // the string buffer is modified when reading from a 'streambuf'.
+
     // Not implemented:
     Tokenizer(const Tokenizer&);
 
@@ -288,6 +324,17 @@ class Tokenizer {
         // 'advanceToNextToken' is called.  Note that this function does not
         // change the value of the 'allowStandAloneValues' option.
 
+    void reset(const char *data, bsl::size_t length);
+        // Reset this tokenizer to read, in-situ, the specified 'length'
+        // characters of JSON data at the specified 'data' address.  The
+        // behavior is undefined unless the data remains valid and unmodified
+        // until this tokenizer is reset or destroyed.  Note that the reader
+        // will not be on a valid node until 'advanceToNextToken' is called.
+        // Note that the data is not copied, and the string references
+        // returned by 'value' refer into 'data' (see {In-Situ Tokenization}).
+        // Note that this function does not change the value of the
+        // 'allowStandAloneValues' option.
+
     int advanceToNextToken();
         // Move to the next token in the data steam.  Return 0 on success and a
         // non-zero value otherwise.  Note that each call to
@@ -300,7 +347,8 @@ class Tokenizer {
         // 'streambuf' supports seeking, and return an error otherwise leaving
         // this object unchanged.  After a successful function return users can
         // read data from the 'streambuf' where this object stopped.  Return 0
-        // on success, and a non-zero value otherwise.
+        // on success, and a non-zero value otherwise.  Note that a non-zero
+        // value is returned if this tokenizer is reading in-situ data.
 
     void setAllowStandAloneValues(bool value);
         // Set the 'allowStandAloneValues' option to the specified 'value'.  If
@@ -323,19 +371,35 @@ class Tokenizer {
         // Load into the specified 'data' the value of the specified token if
         // the current token's type is 'BAEJSN_ELEMENT_NAME' or
         // 'BAEJSN_ELEMENT_VALUE' or leave 'data' unmodified otherwise.  Return
-        // 0 on success and a non-zero value otherwise.
+        // 0 on success and a non-zero value otherwise.  Note that if this
+        // tokenizer is reading in-situ data, 'data' refers into that data.
+
+    bsl::size_t numBytesConsumed() const;
+        // Return the number of bytes of in-situ data processed by this
+        // tokenizer since it was last reset.  The behavior is undefined
+        // unless this tokenizer is reading in-situ data.
 };
 
 // ============================================================================
 //                            INLINE DEFINITIONS
 // ============================================================================
 
+// PRIVATE MANIPULATORS
+inline
+void Tokenizer::syncDataWithStringBuffer()
+{
+    d_data_p     = d_stringBuffer.data();
+    d_dataLength = d_stringBuffer.length();
+}
+
 // CREATORS
 inline
 Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
 : d_allocator(d_buffer.buffer(), k_BUFSIZE, basicAllocator)
 , d_stringBuffer(&d_allocator)
 , d_streambuf_p(0)
+, d_data_p(0)
+, d_dataLength(0)
 , d_cursor(0)
 , d_valueBegin(0)
 , d_valueEnd(0)
@@ -356,8 +420,27 @@ Tokenizer::~Tokenizer()
 inline
 void Tokenizer::reset(bsl::streambuf *streambuf)
 {
+    BSLS_ASSERT(streambuf);
+
     d_streambuf_p = streambuf;
     d_stringBuffer.clear();
+    syncDataWithStringBuffer();
+    d_cursor      = 0;
+    d_valueBegin  = 0;
+    d_valueEnd    = 0;
+    d_valueIter   = 0;
+    d_tokenType   = e_BEGIN;
+}
+
+inline
+void Tokenizer::reset(const char *data, bsl::size_t length)
+{
+    BSLS_ASSERT(data || 0 == length);
+
+    d_streambuf_p = 0;
+    d_stringBuffer.clear();
+    d_data_p      = data;
+    d_dataLength  = length;
     d_cursor      = 0;
     d_valueBegin  = 0;
     d_valueEnd    = 0;
@@ -383,6 +466,14 @@ bool Tokenizer::allowStandAloneValues() const
 {
     return d_allowStandAloneValues;
 }
+
+inline
+bsl::size_t Tokenizer::numBytesConsumed() const
+{
+    BSLS_ASSERT(0 == d_streambuf_p);
+
+    return d_cursor;
+}
 }  // close package namespace
 
 }  // close enterprise namespace
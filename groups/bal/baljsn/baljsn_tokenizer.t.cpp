@@ -47,6 +47,7 @@ using bsl::endl;
 //
 // MANIPULATORS
 // [ 9] void reset(bsl::streambuf &streamBuf);
+// [14] void reset(const char *data, bsl::size_t length);
 // [12] void resetStreamBufGetPointer();
 // [13] void setAllowStandAloneValues(bool value);
 // [ 3] int advanceToNextToken();
@@ -55,9 +56,10 @@ using bsl::endl;
 // [ 3] TokenType tokenType() const;
 // [13] bool allowStandAloneValues() const;
 // [ 3] int value(bslstl::StringRef *data) const;
+// [14] bsl::size_t numBytesConsumed() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [14] USAGE EXAMPLE
+// [15] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -192,7 +194,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -314,6 +316,148 @@ int main(int argc, char *argv[])
     ASSERT(10022           == address.d_zipcode);
 //..
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING IN-SITU TOKENIZATION
+        //
+        // Concerns:
+        //: 1 Tokenizing data supplied by 'reset(data, length)' produces the
+        //:   same sequence of tokens and values as tokenizing the same data
+        //:   read from a 'streambuf'.
+        //:
+        //: 2 Values returned by 'value' refer directly into the supplied data.
+        //:
+        //: 3 Values longer than the internal buffer of the tokenizer are
+        //:   supported.
+        //:
+        //: 4 'numBytesConsumed' returns the offset, in the supplied data, of
+        //:   the first character not yet processed.
+        //:
+        //: 5 'resetStreamBufGetPointer' fails for in-situ data.
+        //:
+        //: 6 No memory is allocated when tokenizing in-situ.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, tokenize a set of JSON
+        //:   documents from a 'streambuf' and in-situ, and verify that the
+        //:   token types and values are identical.  (C-1)
+        //:
+        //: 2 For each value produced in-situ, verify that its address lies
+        //:   within the supplied data.  (C-2)
+        //:
+        //: 3 Repeat P-1 and P-2 with a document containing a string value
+        //:   longer than 'k_BUFSIZE'.  (C-3)
+        //:
+        //: 4 Verify the value returned by 'numBytesConsumed' after reaching
+        //:   the end of the data, and that 'resetStreamBufGetPointer' returns
+        //:   a non-zero value.  (C-4..5)
+        //:
+        //: 5 Use a test allocator to verify that no memory is allocated by
+        //:   in-situ tokenization.  (C-6)
+        //
+        // Testing:
+        //   void reset(const char *data, bsl::size_t length);
+        //   bsl::size_t numBytesConsumed() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING IN-SITU TOKENIZATION" << endl
+                          << "============================" << endl;
+
+        bsl::string largeDocument("{\"name\":\"");
+        largeDocument.append(3 * 1024 * 8, 'x');
+        largeDocument.append("\",\"value\":[1,2.5,true,null]}");
+
+        static const struct {
+            int         d_line;
+            const char *d_input_p;
+        } DATA[] = {
+            //LINE  INPUT
+            //----  -----
+            { L_,   "{}"                                                   },
+            { L_,   "[]"                                                   },
+            { L_,   " \t\n\r{ \"a\" : 1 }\n"                               },
+            { L_,   "{\"a\":\"b\",\"c\":[{\"d\":null},{\"e\":[1,2]}]}"    },
+            { L_,   "[\"\\\"escaped\\\"\", true, false, -1.5e10]"          },
+            { L_,   "{\"a\":{\"b\":{\"c\":[[],[{}]]}}}"                    },
+            { L_,   largeDocument.c_str()                                  },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE   = DATA[ti].d_line;
+            const char        *INPUT  = DATA[ti].d_input_p;
+            const bsl::size_t  LENGTH = bsl::strlen(INPUT);
+
+            if (veryVerbose) { P(LINE) }
+
+            bdlsb::FixedMemInStreamBuf isb(INPUT, LENGTH);
+
+            Obj expected;
+            expected.reset(&isb);
+
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            const Int64 NUM_BYTES = oa.numBytesInUse();
+
+            mX.reset(INPUT, LENGTH);
+
+            int numTokens = 0;
+            for (;;) {
+                const int EXP_RC = expected.advanceToNextToken();
+                const int RC     = mX.advanceToNextToken();
+
+                ASSERTV(LINE, numTokens, EXP_RC, RC, EXP_RC == RC);
+                if (EXP_RC || RC) {
+                    break;
+                }
+                ++numTokens;
+
+                ASSERTV(LINE, numTokens,
+                        expected.tokenType() == X.tokenType());
+
+                if (Obj::e_ELEMENT_NAME  == X.tokenType()
+                 || Obj::e_ELEMENT_VALUE == X.tokenType()) {
+                    bslstl::StringRef expValue;
+                    bslstl::StringRef value;
+
+                    ASSERTV(LINE, 0 == expected.value(&expValue));
+                    ASSERTV(LINE, 0 == X.value(&value));
+                    ASSERTV(LINE, numTokens, expValue, value,
+                            expValue == value);
+
+                    ASSERTV(LINE, numTokens, INPUT <= value.data());
+                    ASSERTV(LINE, numTokens,
+                            value.data() + value.length() <= INPUT + LENGTH);
+                }
+            }
+            ASSERTV(LINE, 0 < numTokens);
+            ASSERTV(LINE, X.numBytesConsumed(), LENGTH,
+                    LENGTH == X.numBytesConsumed());
+            ASSERTV(LINE, 0 != mX.resetStreamBufGetPointer());
+
+            ASSERTV(LINE, NUM_BYTES == oa.numBytesInUse());
+            ASSERTV(LINE, 0 == oa.numAllocations());
+        }
+
+        if (verbose) cout << "\nTesting 'numBytesConsumed'." << endl;
+        {
+            const char INPUT[] = "{\"a\":1}  [2]";
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(INPUT, sizeof INPUT - 1);
+
+            ASSERTV(X.numBytesConsumed(), 0 == X.numBytesConsumed());
+
+            for (int i = 0; i < 4; ++i) {
+                ASSERTV(i, 0 == mX.advanceToNextToken());
+            }
+            ASSERT(Obj::e_END_OBJECT == X.tokenType());
+            ASSERTV(X.numBytesConsumed(), 7 == X.numBytesConsumed());
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING 'setAllowStandAloneValues' and 'allowStandAloneValues'
@@ -28,6 +28,8 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 #include <bdlt_currenttime.h>
 #include <bslma_default.h>
 #include <bsls_assert.h>
+#include <bsls_systemtime.h>
+#include <bsls_types.h>
 
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
@@ -42,6 +44,14 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 // record (when the thread is restarted) the queue is cleared.  Alternative
 // designs are possible, but are not perceived to be worth the added
 // complexity.
+//
+// IMPLEMENTATION NOTE: The publication thread removes records from the queue
+// into 'd_batch' before publishing any of them (see {Batched Publication} in
+// the component documentation).  The 'e_END' record pushed by 'stopThread'
+// always terminates a batch, so records queued before it are published
+// before the thread exits (unless the thread is being shut down).  'd_batch'
+// is cleared after each batch so that no reference to a record is held while
+// the thread waits on an empty queue.
 
 namespace BloombergLP {
 namespace ball {
@@ -53,10 +63,16 @@ namespace ball {
 namespace {
 
 enum {
-    DEFAULT_FIXED_QUEUE_SIZE = 8192,
-    FORCE_WARN_THRESHOLD     = 5000
+    DEFAULT_FIXED_QUEUE_SIZE       = 8192,
+    FORCE_WARN_THRESHOLD           = 5000,
+    MAX_BATCH_LENGTH               = 1024,
+    DEFAULT_BATCH_SIZE_THRESHOLD   = 64 * 1024
 };
 
+static const bsls::Types::Int64 DEFAULT_BATCH_TIME_THRESHOLD_NS =
+                                                              10 * 1000 * 1000;
+                                       // default batch time threshold (10ms)
+
 static const char LOG_CATEGORY[] = "BALL.ASYNCFILEOBSERVER";
 
 static void populateWarnRecord(ball::Record *record,
@@ -95,27 +111,51 @@ void AsyncFileObserver::publishThreadEntryPoint()
                                           bslmt::ThreadUtil::selfIdAsUint64());
 
     while (!done) {
+        // Wait for a record, then remove further records without blocking
+        // until the queue is empty, the batch is full, the batch time
+        // threshold has elapsed, or the end-of-publication record is seen.
+
         AsyncRecord asyncRecord = d_recordQueue.popFront();
 
-        // Publish the next log record on the queue only if the observer is
-        // not shutting down.
+        const bsls::TimeInterval deadline =
+                     bsls::SystemTime::nowMonotonicClock().addNanoseconds(
+                                                         d_batchTimeThreshold);
+
+        while (Transmission::e_END
+                                != asyncRecord.d_context.transmissionCause()) {
+            d_batch.push_back(asyncRecord.d_record);
+
+            if (MAX_BATCH_LENGTH <= static_cast<int>(d_batch.size())
+             || deadline <= bsls::SystemTime::nowMonotonicClock()
+             || 0 != d_recordQueue.tryPopFront(&asyncRecord)) {
+                break;
+            }
+        }
 
         if (Transmission::e_END
-                == asyncRecord.d_context.transmissionCause()
-            || d_shuttingDownFlag) {
+                            == asyncRecord.d_context.transmissionCause()) {
             done = true;
         }
-        else {
-            d_fileObserver.publish(*asyncRecord.d_record,
-                                   asyncRecord.d_context);
+
+        // Publish the batch only if the observer is not shutting down.
+
+        if (d_shuttingDownFlag) {
+            done = true;
         }
+        else if (!d_batch.empty()) {
+            d_fileObserver.publishBatch(d_batch.data(),
+                                        static_cast<int>(d_batch.size()),
+                                        d_batchSizeThreshold);
+        }
+        d_batch.clear();
 
         // Publish the count of dropped records.  To avoid repeatedly
         // publishing this information when the record queue is full, we
-        // publish the number of dropped records only when the queue becomes
-        // half empty or when a sufficient number of records have been
-        // dropped.  Finally, we publish the dropped record count if the
-        // observer is shutting down, so the information is not lost.
+        // publish the number of dropped records (at most once per batch) only
+        // when the queue becomes half empty or when a sufficient number of
+        // records have been dropped.  Finally, we publish the dropped record
+        // count if the observer is shutting down, so the information is not
+        // lost.
 
         if (0 < d_dropCount.loadRelaxed()) {
             if (d_recordQueue.length() <= d_recordQueue.size() / 2
@@ -182,9 +222,13 @@ int AsyncFileObserver::shutdownThread()
 
 void AsyncFileObserver::construct()
 {
-    d_threadHandle     = bslmt::ThreadUtil::invalidHandle();
-    d_shuttingDownFlag = 0;
-    d_dropCount        = 0;
+    d_threadHandle       = bslmt::ThreadUtil::invalidHandle();
+    d_shuttingDownFlag   = 0;
+    d_dropCount          = 0;
+    d_batchSizeThreshold = DEFAULT_BATCH_SIZE_THRESHOLD;
+    d_batchTimeThreshold = DEFAULT_BATCH_TIME_THRESHOLD_NS;
+
+    d_batch.reserve(MAX_BATCH_LENGTH);
 
     d_publishThreadEntryPoint = bsl::function<void()>(
             bsl::allocator_arg_t(),
@@ -207,6 +251,7 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
+, d_batch(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -220,6 +265,7 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
+, d_batch(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -235,6 +281,7 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
+, d_batch(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -251,6 +298,7 @@ AsyncFileObserver::AsyncFileObserver(
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(dropRecordsOnFullQueueThreshold)
 , d_droppedRecordWarning(basicAllocator)
+, d_batch(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
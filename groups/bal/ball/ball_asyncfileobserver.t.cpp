@@ -29,8 +29,10 @@
 #include <bdlt_localtimeoffset.h>
 
 #include <bsls_assert.h>
+#include <bsls_asserttest.h>
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
+#include <bsls_timeinterval.h>
 
 #include <bsl_climits.h>
 #include <bsl_cmath.h>
@@ -96,6 +98,8 @@ using bsl::flush;
 // [ 3] void rotateOnSize(int size)
 // [ 3] void rotateOnTimeInterval(const bdlt::DatetimeInterval timeInterval)
 // [ 1] void setStdoutThreshold(ball::Severity::Level stdoutThreshold)
+// [10] void setBatchSizeThreshold(int numBytes)
+// [10] void setBatchTimeThreshold(const bsls::TimeInterval& interval)
 // [ 1] void setLogFormat(const char*, const char*)
 // [ 1] void startPublicationThread();
 // [ 1] void stopPublicationThread();
@@ -108,10 +112,13 @@ using bsl::flush;
 // [ 3] bdlt::DatetimeInterval rotationLifetime() const
 // [ 3] int rotationSize() const
 // [ 1] ball::Severity::Level stdoutThreshold() const
+// [10] int batchSizeThreshold() const
+// [10] bsls::TimeInterval batchTimeThreshold() const
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] CONCERN: CONCURRENT PUBLICATION
-// [10] USAGE EXAMPLE
+// [10] CONCERN: BATCHED PUBLICATION
+// [11] USAGE EXAMPLE
 //
 //=============================================================================
 //                        STANDARD BDE ASSERT TEST MACROS
@@ -185,6 +192,13 @@ static void aSsErT2(int c, const char *s, int i)
 
 #define ASSERTV(...) LOOPN_ASSERT(NUM_ARGS(__VA_ARGS__), __VA_ARGS__)
 
+//=============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+//-----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
 //=============================================================================
 //                       SEMI-STANDARD TEST OUTPUT MACROS
 //-----------------------------------------------------------------------------
@@ -604,7 +618,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator allocator; bslma::TestAllocator *Z = &allocator;
 
     switch (test) { case 0:
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -663,6 +677,173 @@ int main(int argc, char *argv[])
         asyncFileObserver.stopPublicationThread();
         removeFilesByPrefix(fileName.c_str());
       } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING BATCHED PUBLICATION
+        //
+        // Concerns:
+        //:  1 The batch thresholds have the documented default values.
+        //:
+        //:  2 The batch thresholds can be set and are reported by the
+        //:    corresponding accessors.
+        //:
+        //:  3 Records are written to the log file exactly once, in the order
+        //:    in which they were published, whatever the batch thresholds,
+        //:    including when the number of queued records exceeds the maximum
+        //:    batch length.
+        //:
+        //:  4 QoI: Asserted precondition violations are detected when
+        //:    enabled.
+        //
+        // Plan:
+        //:  1 Default construct an observer and verify the values returned by
+        //:    'batchSizeThreshold' and 'batchTimeThreshold'.  (C-1)
+        //:
+        //:  2 Set each threshold to a variety of values and verify the value
+        //:    returned by the corresponding accessor.  (C-2)
+        //:
+        //:  3 For a table of threshold values, queue a number of records
+        //:    larger than the maximum batch length before starting the
+        //:    publication thread, start and then stop the publication thread,
+        //:    and verify that the log file contains every record message, in
+        //:    order.  (C-3)
+        //:
+        //:  4 Verify that, in appropriate build modes, defensive checks are
+        //:    triggered for invalid threshold values (using the
+        //:    'BSLS_ASSERTTEST_*' macros).  (C-4)
+        //
+        // Testing:
+        //   void setBatchSizeThreshold(int numBytes);
+        //   void setBatchTimeThreshold(const bsls::TimeInterval& interval);
+        //   int batchSizeThreshold() const;
+        //   bsls::TimeInterval batchTimeThreshold() const;
+        //   CONCERN: BATCHED PUBLICATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING BATCHED PUBLICATION"
+                          << "\n===========================" << endl;
+
+        if (veryVerbose) cout << "\tTesting default values." << endl;
+        {
+            Obj mX(ball::Severity::e_OFF, Z);  const Obj& X = mX;
+
+            ASSERT(64 * 1024 == X.batchSizeThreshold());
+            ASSERT(bsls::TimeInterval(0, 10 * 1000 * 1000) ==
+                                                     X.batchTimeThreshold());
+        }
+
+        if (veryVerbose) cout << "\tTesting manipulators." << endl;
+        {
+            Obj mX(ball::Severity::e_OFF, Z);  const Obj& X = mX;
+
+            const int SIZES[] = { 1, 2, 1024, 64 * 1024, INT_MAX };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                mX.setBatchSizeThreshold(SIZES[i]);
+                ASSERTV(i, SIZES[i] == X.batchSizeThreshold());
+            }
+
+            const bsls::TimeInterval TIMES[] = {
+                bsls::TimeInterval(0, 0),
+                bsls::TimeInterval(0, 1),
+                bsls::TimeInterval(0, 10 * 1000 * 1000),
+                bsls::TimeInterval(5, 0),
+            };
+            const int NUM_TIMES = sizeof TIMES / sizeof *TIMES;
+
+            for (int i = 0; i < NUM_TIMES; ++i) {
+                mX.setBatchTimeThreshold(TIMES[i]);
+                ASSERTV(i, TIMES[i] == X.batchTimeThreshold());
+            }
+        }
+
+        if (veryVerbose) cout << "\tTesting record order." << endl;
+        {
+            static const struct {
+                int d_line;        // source line number
+                int d_sizeBytes;   // batch size threshold
+                int d_timeNanos;   // batch time threshold (nanoseconds)
+            } DATA[] = {
+                //LINE  SIZE        TIME
+                //----  ----------  --------------
+                { L_,   64 * 1024,  10 * 1000 * 1000 },
+                { L_,   1,          10 * 1000 * 1000 },
+                { L_,   100,        10 * 1000 * 1000 },
+                { L_,   64 * 1024,  0                },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            // The number of records exceeds the maximum batch length (1024)
+            // so that the queue is drained in several batches.
+
+            enum { NUM_RECORDS = 2500 };
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE = DATA[ti].d_line;
+
+                bsl::string fileName = tempFileName(veryVerbose);
+
+                Obj mX(ball::Severity::e_OFF, Z);
+
+                mX.setBatchSizeThreshold(DATA[ti].d_sizeBytes);
+                mX.setBatchTimeThreshold(
+                             bsls::TimeInterval(0, DATA[ti].d_timeNanos));
+                mX.setLogFormat("%m\n", "%m\n");
+                ASSERTV(LINE, 0 == mX.enableFileLogging(fileName.c_str()));
+
+                for (int i = 0; i < NUM_RECORDS; ++i) {
+                    bsl::ostringstream oss;
+                    oss << "record " << i;
+
+                    bsl::shared_ptr<ball::Record> record;
+                    record.createInplace(Z, Z);
+                    record->fixedFields().setSeverity(
+                                                    ball::Severity::e_ERROR);
+                    record->fixedFields().setMessage(oss.str().c_str());
+
+                    mX.publish(record, ball::Context());
+                }
+
+                mX.startPublicationThread();
+                mX.stopPublicationThread();
+                mX.disableFileLogging();
+
+                bsl::ifstream fs(fileName.c_str());
+                ASSERTV(LINE, fs.is_open());
+
+                bsl::string line;
+                int         numLines = 0;
+                while (bsl::getline(fs, line)) {
+                    bsl::ostringstream oss;
+                    oss << "record " << numLines;
+                    ASSERTV(LINE, numLines, line, oss.str() == line);
+                    ++numLines;
+                }
+                fs.close();
+
+                ASSERTV(LINE, numLines, NUM_RECORDS == numLines);
+
+                removeFilesByPrefix(fileName.c_str());
+            }
+        }
+
+        if (veryVerbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                           bsls::AssertTest::failTestDriver);
+
+            Obj mX(ball::Severity::e_OFF, Z);
+
+            ASSERT_SAFE_PASS(mX.setBatchSizeThreshold(1));
+            ASSERT_SAFE_FAIL(mX.setBatchSizeThreshold(0));
+            ASSERT_SAFE_FAIL(mX.setBatchSizeThreshold(-1));
+
+            ASSERT_SAFE_PASS(mX.setBatchTimeThreshold(bsls::TimeInterval()));
+            ASSERT_SAFE_FAIL(mX.setBatchTimeThreshold(
+                                                  bsls::TimeInterval(0, -1)));
+        }
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // TESTING: 'recordQueueLength'
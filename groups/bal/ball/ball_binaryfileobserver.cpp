@@ -0,0 +1,74 @@
+// ball_binaryfileobserver.cpp                                        -*-C++-*-
+#include <ball_binaryfileobserver.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_binaryfileobserver_cpp,"$Id$ $CSID$")
+
+#include <ball_record.h>
+#include <ball_recordbinaryutil.h>
+
+#include <bdlf_memfn.h>
+
+#include <bsl_ios.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+enum {
+    k_BDEX_VERSION_SELECTOR = 20170321  // selects the binary record format
+                                        // version written by this observer
+};
+
+}  // close unnamed namespace
+
+                          // ------------------------
+                          // class BinaryFileObserver
+                          // ------------------------
+
+// PRIVATE MANIPULATORS
+void BinaryFileObserver::writeRecord(bsl::ostream& stream,
+                                     const Record& record)
+{
+    if (0 != RecordBinaryUtil::writeRecord(stream.rdbuf(),
+                                           record,
+                                           &d_encodeBuffer)) {
+        stream.setstate(bsl::ios_base::badbit);
+        return;                                                       // RETURN
+    }
+    stream.flush();
+}
+
+// CREATORS
+BinaryFileObserver::BinaryFileObserver(bslma::Allocator *basicAllocator)
+: d_encodeBuffer(k_BDEX_VERSION_SELECTOR, basicAllocator)
+, d_fileObserver2(basicAllocator)
+{
+    d_fileObserver2.setLogFileFunctor(
+             bdlf::MemFnUtil::memFn(&BinaryFileObserver::writeRecord, this));
+}
+
+BinaryFileObserver::~BinaryFileObserver()
+{
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,464 @@
+// ball_binaryfileobserver.h                                          -*-C++-*-
+#ifndef INCLUDED_BALL_BINARYFILEOBSERVER
+#define INCLUDED_BALL_BINARYFILEOBSERVER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe observer that writes binary log records.
+//
+//@CLASSES:
+//  ball::BinaryFileObserver: observer that writes binary records to a file
+//
+//@SEE_ALSO: ball_recordbinaryutil, ball_fileobserver2, ball_observer
+//
+//@DESCRIPTION: This component provides a concrete implementation of the
+// 'ball::Observer' protocol, 'ball::BinaryFileObserver', for publishing log
+// records to a user-specified file in the compact binary form defined by
+// 'ball_recordbinaryutil'.  The following inheritance hierarchy diagram shows
+// the classes involved and their methods:
+//..
+//              ,------------------------.
+//             ( ball::BinaryFileObserver )
+//              `------------------------'
+//                         |              ctor
+//                         |              disableFileLogging
+//                         |              disableTimeIntervalRotation
+//                         |              disableSizeRotation
+//                         |              enableFileLogging
+//                         |              forceRotation
+//                         |              publishBatch
+//                         |              rotateOnSize
+//                         |              rotateOnTimeInterval
+//                         |              setOnFileRotationCallback
+//                         |              isFileLoggingEnabled
+//                         |              rotationLifetime
+//                         |              rotationSize
+//                         V
+//                  ,-------------.
+//                 ( ball::Observer )
+//                  `-------------'
+//                                        dtor
+//                                        publish
+//                                        releaseRecords
+//..
+// A 'ball::BinaryFileObserver' writes each record it receives through its
+// 'publish' method as a length-prefixed frame (see 'ball::RecordBinaryUtil')
+// containing all of the fixed fields and user fields of the record.  No text
+// formatting is performed when a record is published, which makes this
+// observer considerably cheaper than a text-based file observer for
+// high-volume logging.  The resulting files can be rendered as text offline,
+// using any 'ball::RecordStringFormatter' format specification, by reading
+// the records back with 'ball::RecordBinaryUtil::readRecord'.
+//
+// Timestamps are always written in UTC; the local time offset, if wanted, is
+// applied when the file is rendered as text.
+//
+// A 'ball::BinaryFileObserver' is built on 'ball::FileObserver2', from which
+// it takes its file management: log filename patterns, log file rotation
+// (based on file size, on a periodic time interval, or forced), and the
+// rotation callback behave exactly as documented in 'ball_fileobserver2'.
+// Note that a rotated file always ends on a frame boundary.
+//
+///Thread Safety
+///-------------
+// All methods of 'ball::BinaryFileObserver' are thread-safe, and can be called
+// concurrently by multiple threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing Binary Log Records
+/// - - - - - - - - - - - - - - - - - - - -
+// In this example we configure a binary file observer to write rotating log
+// files, and install it in the logger manager singleton.
+//
+// First, we create the observer and enable file logging.  The log file is
+// rotated whenever it grows beyond 64 megabytes, and every day at midnight:
+//..
+//  ball::BinaryFileObserver binaryFileObserver;
+//
+//  binaryFileObserver.enableFileLogging("/var/log/myapp/myapp.bin.%T");
+//  binaryFileObserver.rotateOnSize(64 * 1024);
+//  binaryFileObserver.rotateOnTimeInterval(bdlt::DatetimeInterval(1),
+//                                          bdlt::Datetime(1, 1, 1));
+//..
+// Then, we install the observer in the logger manager:
+//..
+//  ball::LoggerManagerConfiguration configuration;
+//  ball::LoggerManagerScopedGuard   guard(&binaryFileObserver,
+//                                         configuration);
+//..
+// Now, records logged through the 'ball' macros are written to the log file
+// in binary form:
+//..
+//  BALL_LOG_SET_CATEGORY("EQUITY.NASD");
+//  BALL_LOG_ERROR << "order rejected" << BALL_LOG_END;
+//..
+// Finally, a file written by this observer can be rendered as text:
+//..
+//  bsl::ifstream file("/var/log/myapp/myapp.bin.20170321_093000",
+//                     bsl::ios_base::in | bsl::ios_base::binary);
+//
+//  ball::RecordStringFormatter formatter("%d %s %c %m\n");
+//  ball::Record                record;
+//  bsl::vector<char>           buffer;
+//
+//  while (0 == ball::RecordBinaryUtil::readRecord(&record,
+//                                                 file.rdbuf(),
+//                                                 &buffer)) {
+//      formatter(bsl::cout, record);
+//  }
+//..
+
+#ifndef INCLUDED_BALSCM_VERSION
+#include <balscm_version.h>
+#endif
+
+#ifndef INCLUDED_BALL_FILEOBSERVER2
+#include <ball_fileobserver2.h>
+#endif
+
+#ifndef INCLUDED_BALL_OBSERVER
+#include <ball_observer.h>
+#endif
+
+#ifndef INCLUDED_BDLT_DATETIME
+#include <bdlt_datetime.h>
+#endif
+
+#ifndef INCLUDED_BDLT_DATETIMEINTERVAL
+#include <bdlt_datetimeinterval.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLX_BYTEOUTSTREAM
+#include <bslx_byteoutstream.h>
+#endif
+
+#ifndef INCLUDED_BSL_IOSFWD
+#include <bsl_iosfwd.h>
+#endif
+
+#ifndef INCLUDED_BSL_MEMORY
+#include <bsl_memory.h>
+#endif
+
+#ifndef INCLUDED_BSL_STRING
+#include <bsl_string.h>
+#endif
+
+namespace BloombergLP {
+namespace ball {
+
+class Context;
+class Record;
+
+                          // ========================
+                          // class BinaryFileObserver
+                          // ========================
+
+class BinaryFileObserver : public Observer {
+    // This class implements the 'Observer' protocol.  The 'publish' method of
+    // this class writes the log records that it receives to a user-specified
+    // file in binary form.  This class is thread-safe; different threads can
+    // operate on this object concurrently.  This class is exception-neutral
+    // with no guarantee of rollback.  In no event is memory leaked.
+
+    // DATA
+    bslx::ByteOutStream d_encodeBuffer;   // scratch space used to encode
+                                          // records; accessed only by the
+                                          // record functor, which
+                                          // 'd_fileObserver2' invokes with its
+                                          // lock held
+
+    FileObserver2       d_fileObserver2;  // file management and rotation
+
+  private:
+    // NOT IMPLEMENTED
+    BinaryFileObserver(const BinaryFileObserver&);
+    BinaryFileObserver& operator=(const BinaryFileObserver&);
+
+    // PRIVATE MANIPULATORS
+    void writeRecord(bsl::ostream& stream, const Record& record);
+        // Write the specified 'record' to the specified 'stream' as a binary
+        // frame, and flush 'stream'.  Set 'bsl::ios_base::badbit' on 'stream'
+        // if the frame could not be written in its entirety.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(BinaryFileObserver,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit BinaryFileObserver(bslma::Allocator *basicAllocator = 0);
+        // Create a binary file observer.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  Note that file
+        // logging is initially disabled.
+
+    ~BinaryFileObserver();
+        // Close the log file of this binary file observer if file logging is
+        // enabled, and destroy this binary file observer.
+
+    // MANIPULATORS
+    void disableFileLogging();
+        // Disable file logging for this binary file observer.  This method has
+        // no effect if file logging is not enabled.
+
+    void disableTimeIntervalRotation();
+        // Disable log file rotation based on periodic time interval for this
+        // binary file observer.  This method has no effect if
+        // rotation-on-time-interval is not enabled.
+
+    void disableSizeRotation();
+        // Disable log file rotation based on log file size for this binary
+        // file observer.  This method has no effect if rotation-on-size is not
+        // enabled.
+
+    int enableFileLogging(const char *logFilenamePattern);
+        // Enable logging of all records published to this binary file
+        // observer to a file indicated by the specified 'logFilenamePattern'.
+        // Return 0 on success, a positive value if file logging is already
+        // enabled, and a negative value otherwise.  See
+        // 'FileObserver2::enableFileLogging' for the '%'-escape sequences
+        // recognized in the basename of 'logFilenamePattern'.  Note that
+        // time-related escape sequences are substituted with UTC values.
+
+    void forceRotation();
+        // Forcefully perform a log file rotation by this binary file observer.
+        // Close the current log file, rename the log file if necessary, and
+        // open a new log file.  This method has no effect if file logging is
+        // not enabled.
+
+    void publish(const Record& record, const Context& context);
+        // Process the specified log 'record' having the specified publishing
+        // 'context' by writing 'record' to the log file in binary form if file
+        // logging is enabled for this binary file observer.
+
+    void publish(const bsl::shared_ptr<const Record>& record,
+                 const Context&                       context);
+        // Process the record referred to by the specified shared pointer
+        // 'record' having the specified publishing 'context' by writing the
+        // record to the log file in binary form if file logging is enabled for
+        // this binary file observer.
+
+    void publishBatch(const bsl::shared_ptr<const Record> *records,
+                      int                                  numRecords,
+                      int                                  maxBufferSize);
+        // Process the specified 'numRecords' records referred to by the
+        // specified 'records' array, in order, by writing them to the log file
+        // in binary form if file logging is enabled for this binary file
+        // observer.  Encoded records are accumulated in a buffer that is
+        // written using a single system call whenever it holds at least the
+        // specified 'maxBufferSize' bytes, and after the last record (see
+        // 'FileObserver2::publishBatch').  The behavior is undefined unless
+        // '0 <= numRecords', 'records' refers to an array of at least
+        // 'numRecords' non-null shared pointers, and '0 < maxBufferSize'.
+
+    void releaseRecords();
+        // Discard any shared reference to a 'Record' object that was supplied
+        // to the 'publish' method, and is held by this observer.  Note that
+        // this observer does not retain references to published records, so
+        // this method has no effect.
+
+    void rotateOnSize(int size);
+        // Set this binary file observer to perform log file rotation when the
+        // size of the file exceeds the specified 'size' (in kilo-bytes).  This
+        // rule replaces any rotation-on-size rule currently in effect.  The
+        // behavior is undefined unless 'size > 0'.
+
+    void rotateOnTimeInterval(const bdlt::DatetimeInterval& interval);
+    void rotateOnTimeInterval(
+                             const bdlt::DatetimeInterval& interval,
+                             const bdlt::Datetime&         referenceStartTime);
+        // Set this binary file observer to perform a periodic log-file
+        // rotation at multiples of the specified 'interval'.  Optionally,
+        // specify 'referenceStartTime' indicating the *local* datetime to use
+        // as the starting point for computing the periodic rotation schedule.
+        // If 'referenceStartTime' is unspecified, the current time is used.
+        // The behavior is undefined unless '0 < interval.totalMilliseconds()'.
+        // This rule replaces any rotation-on-time-interval rule currently in
+        // effect.
+
+    void setOnFileRotationCallback(
+              const FileObserver2::OnFileRotationCallback& onRotationCallback);
+        // Set the specified 'onRotationCallback' to be invoked after each time
+        // this binary file observer attempts to perform a log file rotation.
+        // The behavior is undefined if the supplied function calls either
+        // 'setOnFileRotationCallback', 'forceRotation', or 'publish' on this
+        // binary file observer (i.e., the supplied callback should *not*
+        // attempt to write to the 'ball' log).
+
+    // ACCESSORS
+    bool isFileLoggingEnabled() const;
+    bool isFileLoggingEnabled(bsl::string *result) const;
+        // Return 'true' if file logging is enabled for this binary file
+        // observer, and 'false' otherwise.  Load the optionally specified
+        // 'result' with the name of the current log file if file logging is
+        // enabled, and leave 'result' unaffected otherwise.
+
+    bdlt::DatetimeInterval rotationLifetime() const;
+        // Return the lifetime of the log file that will trigger a file
+        // rotation by this binary file observer if rotation-on-time-interval
+        // is in effect, and a 0 time interval otherwise.
+
+    int rotationSize() const;
+        // Return the size (in kilo-bytes) of the log file that will trigger a
+        // file rotation by this binary file observer if rotation-on-size is in
+        // effect, and 0 otherwise.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // class BinaryFileObserver
+                          // ------------------------
+
+// MANIPULATORS
+inline
+void BinaryFileObserver::disableFileLogging()
+{
+    d_fileObserver2.disableFileLogging();
+}
+
+inline
+void BinaryFileObserver::disableTimeIntervalRotation()
+{
+    d_fileObserver2.disableTimeIntervalRotation();
+}
+
+inline
+void BinaryFileObserver::disableSizeRotation()
+{
+    d_fileObserver2.disableSizeRotation();
+}
+
+inline
+int BinaryFileObserver::enableFileLogging(const char *logFilenamePattern)
+{
+    return d_fileObserver2.enableFileLogging(logFilenamePattern);
+}
+
+inline
+void BinaryFileObserver::forceRotation()
+{
+    d_fileObserver2.forceRotation();
+}
+
+inline
+void BinaryFileObserver::publish(const Record& record, const Context& context)
+{
+    d_fileObserver2.publish(record, context);
+}
+
+inline
+void BinaryFileObserver::publish(const bsl::shared_ptr<const Record>& record,
+                                 const Context&                       context)
+{
+    d_fileObserver2.publish(*record, context);
+}
+
+inline
+void BinaryFileObserver::publishBatch(
+                            const bsl::shared_ptr<const Record> *records,
+                            int                                  numRecords,
+                            int                                  maxBufferSize)
+{
+    d_fileObserver2.publishBatch(records, numRecords, maxBufferSize);
+}
+
+inline
+void BinaryFileObserver::releaseRecords()
+{
+}
+
+inline
+void BinaryFileObserver::rotateOnSize(int size)
+{
+    d_fileObserver2.rotateOnSize(size);
+}
+
+inline
+void BinaryFileObserver::rotateOnTimeInterval(
+                                        const bdlt::DatetimeInterval& interval)
+{
+    d_fileObserver2.rotateOnTimeInterval(interval);
+}
+
+inline
+void BinaryFileObserver::rotateOnTimeInterval(
+                              const bdlt::DatetimeInterval& interval,
+                              const bdlt::Datetime&         referenceStartTime)
+{
+    d_fileObserver2.rotateOnTimeInterval(interval, referenceStartTime);
+}
+
+inline
+void BinaryFileObserver::setOnFileRotationCallback(
+               const FileObserver2::OnFileRotationCallback& onRotationCallback)
+{
+    d_fileObserver2.setOnFileRotationCallback(onRotationCallback);
+}
+
+// ACCESSORS
+inline
+bool BinaryFileObserver::isFileLoggingEnabled() const
+{
+    return d_fileObserver2.isFileLoggingEnabled();
+}
+
+inline
+bool BinaryFileObserver::isFileLoggingEnabled(bsl::string *result) const
+{
+    return d_fileObserver2.isFileLoggingEnabled(result);
+}
+
+inline
+bdlt::DatetimeInterval BinaryFileObserver::rotationLifetime() const
+{
+    return d_fileObserver2.rotationLifetime();
+}
+
+inline
+int BinaryFileObserver::rotationSize() const
+{
+    return d_fileObserver2.rotationSize();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
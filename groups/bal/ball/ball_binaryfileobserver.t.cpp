@@ -0,0 +1,659 @@
+// ball_binaryfileobserver.t.cpp                                      -*-C++-*-
+#include <ball_binaryfileobserver.h>
+
+#include <ball_context.h>
+#include <ball_log.h>                         // for testing only
+#include <ball_loggermanager.h>               // for testing only
+#include <ball_loggermanagerconfiguration.h>  // for testing only
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_recordbinaryutil.h>
+#include <ball_recordstringformatter.h>
+#include <ball_severity.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimeinterval.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_assert.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_fstream.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                   TEST PLAN
+// ----------------------------------------------------------------------------
+//                                   Overview
+//                                   --------
+// The component under test is an observer that writes records to a file in
+// the binary form defined by 'ball_recordbinaryutil', delegating file
+// management to 'ball::FileObserver2'.  We verify that published records can
+// be read back from the log file with 'ball::RecordBinaryUtil::readRecord',
+// that nothing is written while file logging is disabled, that log file
+// rotation splits the sequence of records on a frame boundary, and that
+// 'publishBatch' writes the same bytes as publishing records one at a time.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] BinaryFileObserver(bslma::Allocator *basicAllocator = 0);
+// [ 1] ~BinaryFileObserver();
+//
+// MANIPULATORS
+// [ 1] void disableFileLogging();
+// [ 1] int enableFileLogging(const char *logFilenamePattern);
+// [ 1] void publish(const Record& record, const Context& context);
+// [ 1] void publish(const shared_ptr<const Record>&, const Context&);
+// [ 3] void publishBatch(const shared_ptr<const Record> *, int, int);
+// [ 1] void releaseRecords();
+// [ 2] void disableTimeIntervalRotation();
+// [ 2] void disableSizeRotation();
+// [ 2] void forceRotation();
+// [ 2] void rotateOnSize(int size);
+// [ 2] void rotateOnTimeInterval(const DatetimeInterval& interval);
+// [ 2] void rotateOnTimeInterval(const DatetimeInterval&, const Datetime&);
+// [ 2] void setOnFileRotationCallback(const OnFileRotationCallback&);
+//
+// ACCESSORS
+// [ 1] bool isFileLoggingEnabled() const;
+// [ 1] bool isFileLoggingEnabled(bsl::string *result) const;
+// [ 2] DatetimeInterval rotationLifetime() const;
+// [ 2] int rotationSize() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef ball::BinaryFileObserver Obj;
+
+// ============================================================================
+//                                 TYPE TRAITS
+// ----------------------------------------------------------------------------
+
+BSLMF_ASSERT(true == bslma::UsesBslmaAllocator<Obj>::value);
+
+//=============================================================================
+//                      HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+bsl::shared_ptr<ball::Record> makeRecord(int               index,
+                                         bslma::Allocator *allocator)
+    // Return a shared pointer to a new record, allocated from the specified
+    // 'allocator', whose attributes are derived from the specified 'index'.
+{
+    bsl::shared_ptr<ball::Record> record;
+    record.createInplace(allocator, allocator);
+
+    ball::RecordAttributes& fixedFields = record->fixedFields();
+    fixedFields.setTimestamp(
+                        bdlt::Datetime(2017, 3, 21, 9, 30, 0, index % 1000));
+    fixedFields.setProcessID(4321);
+    fixedFields.setThreadID(index);
+    fixedFields.setSeverity(ball::Severity::e_INFO);
+    fixedFields.setFileName("ball_binaryfileobserver.t.cpp");
+    fixedFields.setLineNumber(index);
+    fixedFields.setCategory("BINARY.TEST");
+
+    bsl::ostringstream message;
+    message << "binary record " << bsl::setw(12) << index;
+    fixedFields.setMessage(message.str().c_str());
+
+    record->userFields().appendInt64(index);
+    record->userFields().appendString("user field");
+
+    return record;
+}
+
+int readRecords(bsl::vector<ball::Record> *result, const bsl::string& path)
+    // Append to the specified 'result' the records read from the file having
+    // the specified 'path'.  Return 0 if the whole file was read, and a
+    // non-zero value otherwise.
+{
+    bsl::ifstream file(path.c_str(), bsl::ios_base::in |
+                                     bsl::ios_base::binary);
+    if (!file.is_open()) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::vector<char> buffer;
+    ball::Record      record;
+    int               rc;
+
+    while (0 == (rc = ball::RecordBinaryUtil::readRecord(&record,
+                                                         file.rdbuf(),
+                                                         &buffer))) {
+        result->push_back(record);
+    }
+    return 1 == rc ? 0 : rc;
+}
+
+bsl::string readFile(const bsl::string& path)
+    // Return the contents of the file having the specified 'path'.
+{
+    bsl::ifstream      file(path.c_str(), bsl::ios_base::in |
+                                          bsl::ios_base::binary);
+    bsl::ostringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+void onRotation(bsl::vector<bsl::string> *rotatedFileNames,
+                int                       status,
+                const bsl::string&        rotatedFileName)
+    // Append the specified 'rotatedFileName' to the specified
+    // 'rotatedFileNames' if the specified 'status' is 0, and an empty string
+    // otherwise.
+{
+    rotatedFileNames->push_back(0 == status ? rotatedFileName : "");
+}
+
+class TempDirectoryGuard {
+    // This class creates a temporary directory on construction, and removes
+    // it, and its contents, on destruction.
+
+    // DATA
+    bsl::string d_path;  // path of the temporary directory
+
+  private:
+    // NOT IMPLEMENTED
+    TempDirectoryGuard(const TempDirectoryGuard&);
+    TempDirectoryGuard& operator=(const TempDirectoryGuard&);
+
+  public:
+    // CREATORS
+    TempDirectoryGuard()
+    {
+        int rc = bdls::FilesystemUtil::createTemporaryDirectory(
+                                                    &d_path,
+                                                    "ball_binaryfileobserver");
+        ASSERTV(rc, 0 == rc);
+    }
+
+    ~TempDirectoryGuard()
+    {
+        bdls::FilesystemUtil::remove(d_path, true);
+    }
+
+    // ACCESSORS
+    const bsl::string& path() const
+    {
+        return d_path;
+    }
+};
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, replace 'assert' with 'ASSERT', and
+        //:   replace the log file name with a file in a temporary directory.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        TempDirectoryGuard tempDirectory;
+        const bsl::string  logFileName = tempDirectory.path() + "/myapp.bin";
+
+        {
+            ball::BinaryFileObserver binaryFileObserver;
+
+            ASSERT(0 == binaryFileObserver.enableFileLogging(
+                                                        logFileName.c_str()));
+            binaryFileObserver.rotateOnSize(64 * 1024);
+            binaryFileObserver.rotateOnTimeInterval(bdlt::DatetimeInterval(1),
+                                                    bdlt::Datetime(1, 1, 1));
+
+            ball::LoggerManagerConfiguration configuration;
+            ball::LoggerManagerScopedGuard   guard(&binaryFileObserver,
+                                                   configuration);
+
+            BALL_LOG_SET_CATEGORY("EQUITY.NASD");
+            BALL_LOG_ERROR << "order rejected" << BALL_LOG_END;
+        }
+
+        bsl::ifstream file(logFileName.c_str(),
+                           bsl::ios_base::in | bsl::ios_base::binary);
+        ASSERT(file.is_open());
+
+        ball::RecordStringFormatter formatter("%s %c %m\n");
+        ball::Record                record;
+        bsl::vector<char>           buffer;
+        bsl::ostringstream          text;
+
+        while (0 == ball::RecordBinaryUtil::readRecord(&record,
+                                                       file.rdbuf(),
+                                                       &buffer)) {
+            formatter(text, record);
+        }
+        ASSERTV(text.str(),
+                "ERROR EQUITY.NASD order rejected\n" == text.str());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'publishBatch'
+        //
+        // Concerns:
+        //: 1 'publishBatch' writes exactly the bytes written by publishing
+        //:   the same records one at a time, whatever the buffer size.
+        //:
+        //: 2 'publishBatch' has no effect when file logging is disabled.
+        //
+        // Plan:
+        //: 1 Publish a sequence of records individually to one file, and in
+        //:   a batch, using a variety of buffer sizes, to another file, and
+        //:   compare the contents of the files.  (C-1)
+        //:
+        //: 2 Call 'publishBatch' on an observer with file logging disabled,
+        //:   then enable file logging and verify the log file is empty.
+        //:   (C-2)
+        //
+        // Testing:
+        //   void publishBatch(const shared_ptr<const Record> *, int, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'publishBatch'" << endl
+                          << "======================" << endl;
+
+        enum { NUM_RECORDS = 40 };
+
+        bsl::vector<bsl::shared_ptr<const ball::Record> > records(&ta);
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            records.push_back(makeRecord(i, &ta));
+        }
+
+        TempDirectoryGuard tempDirectory;
+
+        const bsl::string expectedName = tempDirectory.path() + "/expected";
+        {
+            Obj mX(&ta);
+            ASSERT(0 == mX.enableFileLogging(expectedName.c_str()));
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                mX.publish(records[i], ball::Context());
+            }
+        }
+        const bsl::string EXPECTED = readFile(expectedName);
+        ASSERT(!EXPECTED.empty());
+
+        const int BUFFER_SIZES[] = { 1, 50, 100, 1000, 64 * 1024 };
+        const int NUM_BUFFER_SIZES = sizeof BUFFER_SIZES
+                                   / sizeof *BUFFER_SIZES;
+
+        for (int i = 0; i < NUM_BUFFER_SIZES; ++i) {
+            const int SIZE = BUFFER_SIZES[i];
+
+            bsl::ostringstream name;
+            name << tempDirectory.path() << "/batch" << SIZE;
+
+            {
+                Obj mX(&ta);
+                ASSERTV(SIZE, 0 == mX.enableFileLogging(name.str().c_str()));
+                mX.publishBatch(records.data(), NUM_RECORDS, SIZE);
+            }
+            ASSERTV(SIZE, EXPECTED == readFile(name.str()));
+        }
+
+        {
+            const bsl::string name = tempDirectory.path() + "/disabled";
+
+            Obj mX(&ta);
+            mX.publishBatch(records.data(), NUM_RECORDS, 100);
+            ASSERT(0 == mX.enableFileLogging(name.c_str()));
+            mX.disableFileLogging();
+
+            ASSERT(readFile(name).empty());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING LOG FILE ROTATION
+        //
+        // Concerns:
+        //: 1 The rotation rules are set and reported as for
+        //:   'ball::FileObserver2'.
+        //:
+        //: 2 Rotation on size closes the log file on a frame boundary, so
+        //:   that the rotated file and the new log file can each be read
+        //:   entirely, and together contain every published record in order.
+        //:
+        //: 3 The rotation callback is invoked with the name of the rotated
+        //:   file.
+        //:
+        //: 4 'forceRotation' rotates the log file.
+        //
+        // Plan:
+        //: 1 Set and disable each rotation rule, and verify the values
+        //:   reported by the accessors.  (C-1)
+        //:
+        //: 2 Configure rotation when the file exceeds 1K, publish records
+        //:   until one rotation occurs, and read back both files.  (C-2..3)
+        //:
+        //: 3 Force a rotation and verify that the callback is invoked.  (C-4)
+        //
+        // Testing:
+        //   void disableTimeIntervalRotation();
+        //   void disableSizeRotation();
+        //   void forceRotation();
+        //   void rotateOnSize(int size);
+        //   void rotateOnTimeInterval(const DatetimeInterval& interval);
+        //   rotateOnTimeInterval(const DatetimeInterval&, const Datetime&);
+        //   void setOnFileRotationCallback(const OnFileRotationCallback&);
+        //   DatetimeInterval rotationLifetime() const;
+        //   int rotationSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING LOG FILE ROTATION" << endl
+                          << "=========================" << endl;
+
+        if (veryVerbose) cout << "\tRotation rules." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(0 == X.rotationSize());
+            ASSERT(bdlt::DatetimeInterval() == X.rotationLifetime());
+
+            mX.rotateOnSize(10);
+            ASSERT(10 == X.rotationSize());
+
+            mX.rotateOnTimeInterval(bdlt::DatetimeInterval(0, 1));
+            ASSERT(bdlt::DatetimeInterval(0, 1) == X.rotationLifetime());
+
+            mX.rotateOnTimeInterval(bdlt::DatetimeInterval(1),
+                                    bdlt::Datetime(1, 1, 1));
+            ASSERT(bdlt::DatetimeInterval(1) == X.rotationLifetime());
+
+            mX.disableSizeRotation();
+            ASSERT(0 == X.rotationSize());
+
+            mX.disableTimeIntervalRotation();
+            ASSERT(bdlt::DatetimeInterval() == X.rotationLifetime());
+        }
+
+        if (veryVerbose) cout << "\tRotation on size." << endl;
+        {
+            TempDirectoryGuard tempDirectory;
+            const bsl::string  logFileName = tempDirectory.path() + "/log";
+
+            bsl::vector<bsl::string> rotatedFileNames;
+
+            Obj mX(&ta);
+            mX.setOnFileRotationCallback(
+                              bdlf::BindUtil::bind(&onRotation,
+                                                   &rotatedFileNames,
+                                                   bdlf::PlaceHolders::_1,
+                                                   bdlf::PlaceHolders::_2));
+            mX.rotateOnSize(1);
+            ASSERT(0 == mX.enableFileLogging(logFileName.c_str()));
+
+            // Publish records until the log file holds more than 1K, and then
+            // one more record to trigger the rotation.
+
+            int numRecords = 0;
+            while (bdls::FilesystemUtil::getFileSize(logFileName) <= 1024) {
+                mX.publish(makeRecord(numRecords, &ta), ball::Context());
+                ++numRecords;
+            }
+            ASSERT(rotatedFileNames.empty());
+
+            mX.publish(makeRecord(numRecords, &ta), ball::Context());
+            ++numRecords;
+
+            ASSERTV(rotatedFileNames.size(), 1 == rotatedFileNames.size());
+            mX.disableFileLogging();
+
+            if (1 == rotatedFileNames.size()) {
+                ASSERT(!rotatedFileNames[0].empty());
+                ASSERT(rotatedFileNames[0] != logFileName);
+
+                bsl::vector<ball::Record> records;
+                ASSERT(0 == readRecords(&records, rotatedFileNames[0]));
+                ASSERTV(records.size(), numRecords,
+                        numRecords - 1 == static_cast<int>(records.size()));
+
+                ASSERT(0 == readRecords(&records, logFileName));
+                ASSERTV(records.size(), numRecords,
+                        numRecords == static_cast<int>(records.size()));
+
+                for (int i = 0; i < static_cast<int>(records.size()); ++i) {
+                    const bsl::shared_ptr<ball::Record> EXPECTED =
+                                                           makeRecord(i, &ta);
+                    ASSERTV(i, EXPECTED->fixedFields().messageRef() ==
+                                        records[i].fixedFields().messageRef());
+                    ASSERTV(i, EXPECTED->userFields() ==
+                                                     records[i].userFields());
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "\tForced rotation." << endl;
+        {
+            TempDirectoryGuard tempDirectory;
+            const bsl::string  logFileName = tempDirectory.path() + "/log";
+
+            bsl::vector<bsl::string> rotatedFileNames;
+
+            Obj mX(&ta);
+            mX.setOnFileRotationCallback(
+                              bdlf::BindUtil::bind(&onRotation,
+                                                   &rotatedFileNames,
+                                                   bdlf::PlaceHolders::_1,
+                                                   bdlf::PlaceHolders::_2));
+
+            mX.forceRotation();
+            ASSERT(rotatedFileNames.empty());
+
+            ASSERT(0 == mX.enableFileLogging(logFileName.c_str()));
+            mX.publish(makeRecord(0, &ta), ball::Context());
+
+            mX.forceRotation();
+            ASSERTV(rotatedFileNames.size(), 1 == rotatedFileNames.size());
+
+            mX.publish(makeRecord(1, &ta), ball::Context());
+            mX.disableFileLogging();
+
+            if (1 == rotatedFileNames.size()) {
+                bsl::vector<ball::Record> records;
+                ASSERT(0 == readRecords(&records, rotatedFileNames[0]));
+                ASSERT(1 == records.size());
+                ASSERT(0 == readRecords(&records, logFileName));
+                ASSERT(2 == records.size());
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Publish records with file logging disabled and enabled, and read
+        //:   back the log file.
+        //
+        // Testing:
+        //   BinaryFileObserver(bslma::Allocator *basicAllocator = 0);
+        //   ~BinaryFileObserver();
+        //   void disableFileLogging();
+        //   int enableFileLogging(const char *logFilenamePattern);
+        //   void publish(const Record& record, const Context& context);
+        //   void publish(const shared_ptr<const Record>&, const Context&);
+        //   void releaseRecords();
+        //   bool isFileLoggingEnabled() const;
+        //   bool isFileLoggingEnabled(bsl::string *result) const;
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        TempDirectoryGuard tempDirectory;
+        const bsl::string  logFileName = tempDirectory.path() + "/log";
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(false == X.isFileLoggingEnabled());
+
+            mX.publish(makeRecord(0, &ta), ball::Context());
+
+            ASSERT(0 == mX.enableFileLogging(logFileName.c_str()));
+            ASSERT(true == X.isFileLoggingEnabled());
+            ASSERT(0 <  mX.enableFileLogging(logFileName.c_str()));
+
+            bsl::string fileName;
+            ASSERT(true == X.isFileLoggingEnabled(&fileName));
+            ASSERTV(fileName, logFileName == fileName);
+
+            mX.publish(makeRecord(1, &ta), ball::Context());
+            mX.publish(*makeRecord(2, &ta), ball::Context());
+            mX.releaseRecords();
+
+            mX.disableFileLogging();
+            ASSERT(false == X.isFileLoggingEnabled());
+
+            mX.publish(makeRecord(3, &ta), ball::Context());
+        }
+
+        bsl::vector<ball::Record> records;
+        ASSERT(0 == readRecords(&records, logFileName));
+        ASSERTV(records.size(), 2 == records.size());
+
+        for (int i = 0; i < static_cast<int>(records.size()); ++i) {
+            ASSERTV(i, *makeRecord(i + 1, &ta) == records[i]);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
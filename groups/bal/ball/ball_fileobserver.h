@@ -40,6 +40,7 @@ BSLS_IDENT("$Id: $")
 //                         |              enableStdoutLoggingPrefix
 //                         |              enablePublishInLocalTime
 //                         |              forceRotation
+//                         |              publishBatch
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
 //                         |              setOnFileRotationCallback
@@ -511,6 +512,22 @@ class FileObserver : public Observer {
         // 'stdout' if the severity of 'record' is at least as severe as the
         // severity level specified at construction.
 
+    void publishBatch(const bsl::shared_ptr<const Record> *records,
+                      int                                  numRecords,
+                      int                                  maxBufferSize);
+        // Process the specified 'numRecords' records referred to by the
+        // specified 'records' array, in order, by writing them to a file if
+        // file logging is enabled for this file observer, and writing each
+        // record whose severity is at least as severe as the 'stdout'
+        // threshold to 'stdout'.  Records written to the log file are
+        // formatted into a buffer that is written using a single system call
+        // whenever it holds at least the specified 'maxBufferSize' bytes, and
+        // after the last record (see 'FileObserver2::publishBatch'); records
+        // written to 'stdout' are written with a single call to 'fwrite'.
+        // The behavior is undefined unless '0 <= numRecords', 'records'
+        // refers to an array of at least 'numRecords' non-null shared
+        // pointers, and '0 < maxBufferSize'.
+
     void releaseRecords();
         // Discard any shared reference to a 'Record' object that was supplied
         // to the 'publish' method, and is held by this observer.  Note that
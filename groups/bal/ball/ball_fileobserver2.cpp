@@ -55,6 +55,8 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
 #include <bsl_sstream.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_errno.h>
 #include <bsl_c_time.h>
@@ -436,10 +438,65 @@ void FileObserver2::logRecordDefault(bsl::ostream& stream,
     stream.flush();
 }
 
+int FileObserver2::flushBatch()
+{
+    const bsl::size_t length = d_batchStreamBuf.length();
+
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    int rc = 0;
+
+    if (d_logStreamBuf.isOpened()) {
+        // 'publish' does not flush 'd_logOutStream' (a user-supplied log
+        // record functor need not), so write out anything still buffered
+        // there before the batch is written directly to the file descriptor;
+        // otherwise those records would follow the batch in the log file.
+
+        d_logOutStream.flush();
+
+        const bdls::FilesystemUtil::FileDescriptor fd =
+                                               d_logStreamBuf.fileDescriptor();
+
+        const char *data      = d_batchStreamBuf.data();
+        int         remaining = static_cast<int>(length);
+
+        while (0 < remaining) {
+            const int written = bdls::FilesystemUtil::write(fd,
+                                                            data,
+                                                            remaining);
+            if (0 >= written) {
+                break;
+            }
+            data      += written;
+            remaining -= written;
+        }
+
+        if (0 < remaining || !d_batchOutStream || !d_logOutStream) {
+            fprintf(stderr, "%s Error on file stream for %s: %s\n",
+                    errorMsgPrefix,
+                    d_logFileName.c_str(), bsl::strerror(getErrorCode()));
+
+            d_logStreamBuf.clear();
+            rc = -1;
+        }
+    }
+
+    d_batchStreamBuf.pubseekpos(0);
+    d_batchOutStream.clear();
+
+    return rc;
+}
+
 int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
 {
     BSLS_ASSERT(rotatedLogFileName);
 
+    // Records formatted by 'publishBatch' belong to the current log file.
+
+    flushBatch();
+
     if (!d_logStreamBuf.isOpened()) {
         return 1;                                                     // RETURN
     }
@@ -515,9 +572,15 @@ int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
 
     if (d_rotationSize) {
         // 'tellp' returns -1 on failure.  Rotate the log file if either
-        // 'tellp' fails, or the rotation size is exceeded.
+        // 'tellp' fails, or the rotation size is exceeded.  Note that records
+        // held in the batch buffer count towards the size of the log file.
+
+        bsls::Types::Int64 fileSize = d_logOutStream.tellp();
+        if (0 <= fileSize) {
+            fileSize += d_batchStreamBuf.length();
+        }
 
-        if (static_cast<bsls::Types::Uint64>(d_logOutStream.tellp()) >
+        if (static_cast<bsls::Types::Uint64>(fileSize) >
             static_cast<bsls::Types::Uint64>(d_rotationSize) * 1024) {
 
             return rotateFile(rotatedLogFileName);                    // RETURN
@@ -535,6 +598,8 @@ int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
 FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
 : d_logStreamBuf(bdls::FilesystemUtil::k_INVALID_FD, false)
 , d_logOutStream(&d_logStreamBuf)
+, d_batchStreamBuf(basicAllocator)
+, d_batchOutStream(&d_batchStreamBuf)
 , d_logFilePattern(basicAllocator)
 , d_logFileName(basicAllocator)
 , d_logFileFunctor(
@@ -693,6 +758,57 @@ void FileObserver2::publish(const Record&  record,
     }
 }
 
+void FileObserver2::publishBatch(
+                            const bsl::shared_ptr<const Record> *records,
+                            int                                  numRecords,
+                            int                                  maxBufferSize)
+{
+    BSLS_ASSERT(records || 0 == numRecords);
+    BSLS_ASSERT(0 <= numRecords);
+    BSLS_ASSERT(0 < maxBufferSize);
+
+    typedef bsl::pair<int, bsl::string> Rotation;
+
+    bsl::vector<Rotation> rotations;  // (status, rotated file name) of each
+                                      // rotation, reported after unlocking
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        for (int i = 0; i < numRecords; ++i) {
+            const Record& record = *records[i];
+
+            bsl::string rotatedFileName;
+            const int   rotationStatus = rotateIfNecessary(
+                                             &rotatedFileName,
+                                             record.fixedFields().timestamp());
+            if (0 >= rotationStatus) {
+                rotations.push_back(Rotation(rotationStatus, rotatedFileName));
+            }
+
+            if (d_logStreamBuf.isOpened()) {
+                d_logFileFunctor(d_batchOutStream, record);
+
+                if (d_batchStreamBuf.length() >=
+                                   static_cast<bsl::size_t>(maxBufferSize)) {
+                    flushBatch();
+                }
+            }
+        }
+
+        flushBatch();
+    }
+
+    if (!rotations.empty()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
+        if (d_onRotationCb) {
+            for (bsl::size_t i = 0; i < rotations.size(); ++i) {
+                d_onRotationCb(rotations[i].first, rotations[i].second);
+            }
+        }
+    }
+}
+
 void FileObserver2::rotateOnLifetime(
                                     const bdlt::DatetimeInterval& timeInterval)
 {
@@ -39,6 +39,7 @@ BSLS_IDENT("$Id: $")
 //                         |              enableFileLogging
 //                         |              enablePublishInLocalTime
 //                         |              forceRotation
+//                         |              publishBatch
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
 //                         |              setLogFileFunctor
@@ -129,6 +130,22 @@ BSLS_IDENT("$Id: $")
 // the a filename with the appearance of "task.log.20110501_123000" if the file
 // is opened on '01-May-2011 12:30:00'.
 //
+///Batch Publication
+///-----------------
+// In addition to the 'publish' methods of the 'ball::Observer' protocol, which
+// write each record to the log file as it is received, 'ball::FileObserver2'
+// provides a 'publishBatch' method that writes a sequence of records.  The
+// records are formatted into an internal buffer that is written to the log
+// file with a single system call once the buffer reaches a caller-supplied
+// size, and after the last record of the sequence.  Output of earlier calls to
+// 'publish' that is still buffered is written to the log file first, so
+// records appear in the log file in the order in which they were published.
+// The lock of the file observer is acquired once for the whole sequence.  Log
+// file rotation is evaluated for each record of the sequence exactly as if the
+// records had been published individually.  'publishBatch' is intended for
+// publishers, such as 'ball::AsyncFileObserver', that accumulate records
+// before writing them.
+//
 ///Log File Rotation
 ///-----------------
 // A 'ball::FileObserver2' may be configured to perform automatic rotation of
@@ -229,6 +246,10 @@ BSLS_IDENT("$Id: $")
 #include <bdls_fdstreambuf.h>
 #endif
 
+#ifndef INCLUDED_BDLSB_MEMOUTSTREAMBUF
+#include <bdlsb_memoutstreambuf.h>
+#endif
+
 #ifndef INCLUDED_BDLT_DATETIME
 #include <bdlt_datetime.h>
 #endif
@@ -319,6 +340,15 @@ class FileObserver2 : public Observer {
                                                        // to the buffer
                                                        // 'd_logStreamBuf')
 
+    bdlsb::MemOutStreamBuf d_batchStreamBuf;           // records formatted by
+                                                       // 'publishBatch' that
+                                                       // are not yet written
+
+    bsl::ostream           d_batchOutStream;           // output stream for
+                                                       // batch formatting
+                                                       // (refers to the buffer
+                                                       // 'd_batchStreamBuf')
+
     bsl::string            d_logFilePattern;           // log filename pattern
 
     bsl::string            d_logFileName;              // current filename
@@ -390,11 +420,20 @@ class FileObserver2 : public Observer {
         // filename, as determined by the 'logFilenamePattern' of latest call
         // to 'enableFileLogging', is the same as the old log filename.
 
+    int flushBatch();
+        // Write the records held in the batch buffer to the log file and
+        // reset the batch buffer.  Return 0 on success (including if the
+        // batch buffer is empty), and a non-zero value otherwise.  If writing
+        // fails, an error is reported to 'stderr' and file logging is
+        // disabled.  The behavior is undefined unless the caller acquired the
+        // lock for this object.
+
     int rotateIfNecessary(bsl::string           *rotatedLogFileName,
                           const bdlt::Datetime&  currentLogTimeUtc);
         // Perform log file rotation if the specified 'currentLogTimeUtc' is
         // later than the scheduled rotation time of the current log file, or
-        // if the log file is larger than the allowable size, and if a rotation
+        // if the log file (including any records held in the batch buffer) is
+        // larger than the allowable size, and if a rotation
         // is performed, load into the specified 'rotatedLogFileName' the name
         // of the rotated file.  Return 0 if the log file is rotated
         // successfully, a positive value if a rotation was determined to be
@@ -515,6 +554,22 @@ class FileObserver2 : public Observer {
         // a file if file logging is enabled for this file observer.  The
         // method has no effect if file logging is not enabled.
 
+    void publishBatch(const bsl::shared_ptr<const Record> *records,
+                      int                                  numRecords,
+                      int                                  maxBufferSize);
+        // Write the specified 'numRecords' records referred to by the
+        // specified 'records' array to the log file, in order, if file
+        // logging is enabled for this file observer.  The records are
+        // formatted into an internal buffer, and that buffer is written to
+        // the log file using a single system call whenever it holds at least
+        // the specified 'maxBufferSize' bytes, and after the last record has
+        // been formatted.  Log file rotation is performed, as necessary,
+        // before formatting each record (see {Log File Rotation}).  The
+        // behavior is undefined unless '0 <= numRecords', 'records' refers to
+        // an array of at least 'numRecords' non-null shared pointers, and
+        // '0 < maxBufferSize'.  Note that the lock of this file observer is
+        // acquired once for the entire sequence of records.
+
     void releaseRecords();
         // Discard any shared reference to a 'Record' object that was supplied
         // to the 'publish' method, and is held by this observer.  Note that
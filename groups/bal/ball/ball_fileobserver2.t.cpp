@@ -57,7 +57,9 @@
 #include <bsl_ctime.h>
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
+#include <bsl_memory.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_stdio.h>  // tempname()
 
@@ -103,6 +105,7 @@ using bsl::flush;
 // [ 1] int enableFileLogging(const char *fileName, bool timestampFlag = false)
 // [ 1] void enablePublishInLocalTime()
 // [ 1] void publish(const ball::Record& record, const ball::Context& context)
+// [13] void publishBatch(const shared_ptr<const Record> *, int, int);
 // [ 2] void forceRotation()
 // [ 2] void rotateOnSize(int size)
 // [ 9] void rotateOnTimeInterval(const bdlt::DatetimeInterval& interval);
@@ -124,6 +127,7 @@ using bsl::flush;
 // [ 8] CONCERN: 'rotateOnSize' triggers correctly for existing files
 // [ 7] CONCERN: Rotation on size is based on file size
 // [12] CONCERN: Published Records Show Current Local-Time Offset
+// [13] CONCERN: 'publishBatch' rotates the log file within a batch
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -280,6 +284,13 @@ void logRecord2(bsl::ostream& stream, const ball::Record& record)
     stream << '\n' << bsl::flush;
 }
 
+void logMessageWithoutFlush(bsl::ostream& stream, const ball::Record& record)
+    // Write the message of the specified 'record', followed by a newline, to
+    // the specified 'stream' without flushing 'stream'.
+{
+    stream << record.fixedFields().message() << '\n';
+}
+
 bsl::string tempFileName(bool verboseFlag)
 {
     bsl::string result;
@@ -672,6 +683,225 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING 'publishBatch'
+        //
+        // Concerns:
+        //: 1 'publishBatch' writes the supplied records to the log file, in
+        //:   order, with the same content as if each record had been
+        //:   published individually, irrespective of the buffer size.
+        //:
+        //: 2 'publishBatch' has no effect if file logging is disabled, or if
+        //:   the number of records is 0.
+        //:
+        //: 3 Rotation-on-size is evaluated for each record of a batch, and
+        //:   accounts for records formatted but not yet written; the rotation
+        //:   callback is invoked for each rotation.
+        //:
+        //: 4 No memory is allocated from the default allocator.
+        //:
+        //: 5 Records published individually, with a log record functor that
+        //:   does not flush the stream, are written to the log file before
+        //:   the records of a subsequent batch.
+        //
+        // Plan:
+        //: 1 Publish a sequence of records individually to one file, and as
+        //:   a batch (using several buffer sizes) to another, and compare the
+        //:   contents of the files.  (C-1, 4)
+        //:
+        //: 2 Call 'publishBatch' with file logging disabled, and with no
+        //:   records, and verify that no file is written.  (C-2)
+        //:
+        //: 3 Enable rotation-on-size, publish a batch of records whose total
+        //:   size exceeds the rotation size, and verify the number of lines
+        //:   in, and the size of, each file, and the invocations of the
+        //:   rotation callback.  (C-3)
+        //:
+        //: 4 Install a log record functor that does not flush the stream,
+        //:   alternate between publishing records individually and in
+        //:   batches, and verify that the log file holds the records in
+        //:   publication order.  (C-5)
+        //
+        // Testing:
+        //   void publishBatch(const shared_ptr<const Record> *, int, int);
+        //   CONCERN: 'publishBatch' rotates the log file within a batch
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'publishBatch'"
+                          << "\n======================" << endl;
+
+        enum { k_NUM_RECORDS = 50 };
+
+        ball::RecordStringFormatter formatter("%m\n", Z);
+
+        bsl::vector<bsl::shared_ptr<const ball::Record> > records(Z);
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            bsl::ostringstream message;
+            message << "batched record " << bsl::setw(12) << i;
+
+            ball::RecordAttributes attr(bdlt::CurrentTime::utc(),
+                                        1,
+                                        2,
+                                        "FILENAME",
+                                        3,
+                                        "CATEGORY",
+                                        ball::Severity::e_INFO,
+                                        message.str().c_str());
+
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace(Z, attr, ball::UserFields(), Z);
+            records.push_back(record);
+        }
+
+        const int RECORD_SIZE = 28;  // "batched record ", id, and '\n'
+
+        if (verbose) cout << "\tCompare with individual publication." << endl;
+        {
+            const bsl::string expectedName = tempFileName(veryVerbose);
+
+            Obj mY(Z);
+            mY.setLogFileFunctor(formatter);
+            ASSERT(0 == mY.enableFileLogging(expectedName.c_str()));
+
+            ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                mY.publish(records[i], context);
+            }
+            mY.disableFileLogging();
+
+            bsl::string expected;
+            ASSERT(k_NUM_RECORDS ==
+                    readFileIntoString(__LINE__, expectedName, expected));
+            ASSERT(k_NUM_RECORDS * RECORD_SIZE == (int)expected.length());
+
+            static const int BUFFER_SIZES[] = { 1, 27, 28, 100, 64 * 1024 };
+            const int NUM_BUFFER_SIZES = sizeof BUFFER_SIZES
+                                       / sizeof *BUFFER_SIZES;
+
+            for (int i = 0; i < NUM_BUFFER_SIZES; ++i) {
+                const int BUFFER_SIZE = BUFFER_SIZES[i];
+
+                const bsl::string filename = tempFileName(veryVerbose);
+
+                Obj mX(Z);
+                mX.setLogFileFunctor(formatter);
+                ASSERT(0 == mX.enableFileLogging(filename.c_str()));
+
+                const bsls::Types::Int64 NUM_DEFAULT_ALLOCATIONS =
+                                             defaultAllocator.numAllocations();
+
+                mX.publishBatch(records.data(), 20, BUFFER_SIZE);
+                mX.publishBatch(records.data() + 20,
+                                k_NUM_RECORDS - 20,
+                                BUFFER_SIZE);
+
+                ASSERTV(BUFFER_SIZE,
+                        NUM_DEFAULT_ALLOCATIONS ==
+                                            defaultAllocator.numAllocations());
+
+                mX.disableFileLogging();
+
+                bsl::string actual;
+                ASSERTV(BUFFER_SIZE, k_NUM_RECORDS ==
+                               readFileIntoString(__LINE__, filename, actual));
+                ASSERTV(BUFFER_SIZE, expected == actual);
+
+                FileUtil::remove(filename.c_str());
+            }
+            FileUtil::remove(expectedName.c_str());
+        }
+
+        if (verbose) cout << "\tFile logging disabled or no records." << endl;
+        {
+            const bsl::string filename = tempFileName(veryVerbose);
+
+            Obj mX(Z);
+            mX.setLogFileFunctor(formatter);
+
+            mX.publishBatch(records.data(), k_NUM_RECORDS, 1024);
+            ASSERT(false == FileUtil::exists(filename.c_str()));
+
+            ASSERT(0 == mX.enableFileLogging(filename.c_str()));
+            mX.publishBatch(records.data(), 0, 1024);
+            mX.disableFileLogging();
+
+            ASSERT(0 == FileUtil::getFileSize(filename.c_str()));
+
+            FileUtil::remove(filename.c_str());
+        }
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        if (verbose) cout << "\tRotation within a batch." << endl;
+        {
+            const bsl::string filename = tempFileName(veryVerbose);
+
+            Obj mX(Z);
+            mX.setLogFileFunctor(formatter);
+
+            RotCb cb(Z);
+            mX.setOnFileRotationCallback(cb);
+
+            ASSERT(0 == mX.enableFileLogging(filename.c_str()));
+            mX.rotateOnSize(1);
+
+            mX.publishBatch(records.data(), k_NUM_RECORDS, 64 * 1024);
+            mX.disableFileLogging();
+
+            ASSERTV(cb.numInvocations(), 1 == cb.numInvocations());
+            ASSERTV(cb.status(), 0 == cb.status());
+
+            // The first file holds the records up to, and including, the
+            // first one taking its size beyond 1024 bytes.
+
+            const int NUM_ROTATED = 1024 / RECORD_SIZE + 1;
+
+            const bsl::string rotatedName = cb.rotatedFileName();
+            ASSERTV(NUM_ROTATED,
+                    getNumLines(rotatedName.c_str()),
+                    NUM_ROTATED == getNumLines(rotatedName.c_str()));
+            ASSERTV(k_NUM_RECORDS - NUM_ROTATED ==
+                                             getNumLines(filename.c_str()));
+
+            removeFilesByPrefix(filename.c_str());
+        }
+#endif
+
+        if (verbose) cout << "\tInterleave with individual publication."
+                          << endl;
+        {
+            const bsl::string filename = tempFileName(veryVerbose);
+
+            Obj mX(Z);
+            mX.setLogFileFunctor(&logMessageWithoutFlush);
+            ASSERT(0 == mX.enableFileLogging(filename.c_str()));
+
+            // Alternate between publishing 5 records individually and 5
+            // records as a batch.
+
+            ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+            for (int i = 0; i < k_NUM_RECORDS; i += 10) {
+                for (int j = i; j < i + 5; ++j) {
+                    mX.publish(records[j], context);
+                }
+                mX.publishBatch(records.data() + i + 5, 5, 1024);
+            }
+            mX.disableFileLogging();
+
+            bsl::string expected;
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                expected += records[i]->fixedFields().message();
+                expected += '\n';
+            }
+
+            bsl::string actual;
+            ASSERT(k_NUM_RECORDS ==
+                               readFileIntoString(__LINE__, filename, actual));
+            ASSERTV(expected, actual, expected == actual);
+
+            FileUtil::remove(filename.c_str());
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // TESTING: Published Records Show Current Local-Time Offset
@@ -129,7 +129,9 @@ char *Log::obtainMessageBuffer(bslmt::Mutex **mutex, int *bufferSize)
 
 void Log::releaseMessageBuffer(bslmt::Mutex *mutex)
 {
-    mutex->unlock();
+    if (mutex) {
+        mutex->unlock();
+    }
 }
 
 const Category *Log::setCategory(const char *categoryName)
@@ -1169,18 +1169,21 @@ struct Log {
         // the specified '*mutex' address, and load the size (in bytes) of the
         // buffer into the specified 'bufferSize' address.  The address remains
         // valid, and the buffer remains locked by this thread of execution,
-        // until the 'Log::releaseMessageBuffer' method is called.  The
-        // behavior is undefined if this thread of execution currently holds a
-        // lock on the buffer.  Note that the buffer is intended to be used
+        // until the 'Log::releaseMessageBuffer' method is called.  If the
+        // active logger supplies each thread with its own message buffer (see
+        // 'ball_loggermanager'), this method does not block and 0 is loaded
+        // into '*mutex'.  The behavior is undefined if this thread of
+        // execution currently holds a lock on the buffer.  Note that the
+        // buffer is intended to be used
         // *only* for formatting log messages immediately before a call to
         // 'Log::logMessage'; other use may adversely affect performance for
         // the entire program.
 
     static void releaseMessageBuffer(bslmt::Mutex *mutex);
         // Unlock the specified '*mutex' that guards the buffer used for
-        // formatting messages in this thread of execution.  The behavior is
-        // undefined unless '*mutex' was obtained by a call to
-        // 'Log::obtainMessageBuffer' and has not yet been unlocked.
+        // formatting messages in this thread of execution, if 'mutex' is not
+        // 0.  The behavior is undefined unless 'mutex' was obtained by a call
+        // to 'Log::obtainMessageBuffer' and has not yet been unlocked.
 
     static const Category *setCategory(const char *categoryName);
         // Return from the logger manager's category registry the address of
@@ -22,6 +22,7 @@ BSLS_IDENT_RCSID(ball_loggermanager_cpp,"$Id$ $CSID$")
 #include <ball_userfieldsschema.h>
 #include <ball_testobserver.h>                // for testing only
 
+#include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
 #include <bslmt_once.h>
 #include <bslmt_readlockguard.h>
@@ -40,6 +41,7 @@ BSLS_IDENT_RCSID(ball_loggermanager_cpp,"$Id$ $CSID$")
 
 #include <bslma_default.h>
 #include <bslma_managedptr.h>
+#include <bsls_alignmentutil.h>
 #include <bsls_assert.h>
 #include <bsls_log.h>
 #include <bsls_objectbuffer.h>
@@ -101,12 +103,54 @@ BSLS_IDENT_RCSID(ball_loggermanager_cpp,"$Id$ $CSID$")
 //        // ...
 //    }
 //..
+//
+///Per-Thread Message Buffers
+///--------------------------
+// When a logger is configured with per-thread message buffers, each buffer is
+// allocated on a thread's first call to 'obtainMessageBuffer' and stored in
+// thread-specific storage keyed by 'd_perThreadBufferKey'.  Each buffer is
+// immediately preceded by a maximally-aligned 'Logger_PerThreadBuffer' header
+// that links it into the logger's list of buffers, 'd_perThreadBufferList_p',
+// and records the allocator that supplied it.  The list is protected by
+// 'd_perThreadBufferListMutex', which is therefore taken only once per thread
+// (on its first allocation) and once more when the thread exits, at which time
+// the key's destructor function unlinks and reclaims the buffer of that
+// thread.  When the logger is destroyed, the key is deleted first, so that no
+// thread-specific destructor runs afterwards, and then every buffer still in
+// the list (i.e., held by a live thread) is reclaimed.  The shared scratch
+// buffer is always allocated, and serves as a fallback should thread-specific
+// storage be unavailable.
 //-----------------------------------------------------------------------------
 
 namespace BloombergLP {
 
 namespace ball {
 
+                       // =============================
+                       // struct Logger_PerThreadBuffer
+                       // =============================
+
+struct Logger_PerThreadBuffer {
+    // This component-private 'struct' provides the header that immediately
+    // precedes each per-thread message buffer of a logger, linking the buffer
+    // into the list of the buffers of that logger.
+
+    Logger_PerThreadBuffer   *d_prev_p;       // previous buffer in the list,
+                                              // or 0 if first
+
+    Logger_PerThreadBuffer   *d_next_p;       // next buffer in the list, or 0
+                                              // if last
+
+    Logger_PerThreadBuffer  **d_list_p;       // address of the first buffer
+                                              // in the list (held, not owned)
+
+    bslmt::Mutex             *d_listMutex_p;  // serializes access to the list
+                                              // (held, not owned)
+
+    bslma::Allocator         *d_allocator_p;  // allocator that supplied the
+                                              // buffer (held, not owned)
+};
+
 namespace {
 
 template <class NewFunc, class OldFunc>
@@ -203,6 +247,94 @@ void bslsLogMessage(const char *fileName,
     }
 }
 
+const int k_PER_THREAD_BUFFER_HEADER_SIZE = static_cast<int>(
+                             bsls::AlignmentUtil::roundUpToMaximalAlignment(
+                                             sizeof(Logger_PerThreadBuffer)));
+    // Size, in bytes, of the header that precedes each per-thread message
+    // buffer.
+
+inline
+Logger_PerThreadBuffer *perThreadBufferHeader(void *buffer)
+    // Return the address of the header of the specified per-thread message
+    // 'buffer'.
+{
+    return reinterpret_cast<Logger_PerThreadBuffer *>(
+                static_cast<char *>(buffer) - k_PER_THREAD_BUFFER_HEADER_SIZE);
+}
+
+char *allocatePerThreadBuffer(int                      numBytes,
+                              Logger_PerThreadBuffer **list,
+                              bslmt::Mutex            *listMutex,
+                              bslma::Allocator        *allocator)
+    // Return the address of a modifiable per-thread message buffer of the
+    // specified 'numBytes', allocated from the specified 'allocator' and
+    // prepended to the specified 'list' of buffers protected by the
+    // specified 'listMutex'.  The buffer must be reclaimed by
+    // 'deallocatePerThreadBuffer', or by 'deallocatePerThreadBufferList'.
+{
+    Logger_PerThreadBuffer *header = static_cast<Logger_PerThreadBuffer *>(
+                                              allocator->allocate(
+                                 k_PER_THREAD_BUFFER_HEADER_SIZE + numBytes));
+    header->d_prev_p      = 0;
+    header->d_list_p      = list;
+    header->d_listMutex_p = listMutex;
+    header->d_allocator_p = allocator;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(listMutex);
+
+        header->d_next_p = *list;
+        if (*list) {
+            (*list)->d_prev_p = header;
+        }
+        *list = header;
+    }
+
+    return reinterpret_cast<char *>(header) + k_PER_THREAD_BUFFER_HEADER_SIZE;
+}
+
+void deallocatePerThreadBuffer(void *buffer)
+    // Unlink the specified per-thread message 'buffer' from the list of
+    // buffers of its logger, and return it to the allocator that supplied it.
+    // The behavior is undefined unless 'buffer' was obtained from
+    // 'allocatePerThreadBuffer' and its list has not been reclaimed.  Note
+    // that this function is suitable for use as a thread-specific key
+    // destructor.
+{
+    Logger_PerThreadBuffer *header = perThreadBufferHeader(buffer);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(header->d_listMutex_p);
+
+        if (header->d_prev_p) {
+            header->d_prev_p->d_next_p = header->d_next_p;
+        }
+        else {
+            *header->d_list_p = header->d_next_p;
+        }
+        if (header->d_next_p) {
+            header->d_next_p->d_prev_p = header->d_prev_p;
+        }
+    }
+
+    header->d_allocator_p->deallocate(header);
+}
+
+void deallocatePerThreadBufferList(Logger_PerThreadBuffer **list,
+                                   bslmt::Mutex            *listMutex)
+    // Return every per-thread message buffer of the specified 'list',
+    // protected by the specified 'listMutex', to the allocator that supplied
+    // it, and reset 'list' to be empty.
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(listMutex);
+
+    while (*list) {
+        Logger_PerThreadBuffer *header = *list;
+        *list = header->d_next_p;
+        header->d_allocator_p->deallocate(header);
+    }
+}
+
 const char *const DEFAULT_CATEGORY_NAME = "";
 const char *const TRIGGER_BEGIN =
                                  "--- BEGIN RECORD DUMP CAUSED BY TRIGGER ---";
@@ -239,6 +371,7 @@ Logger::Logger(
            const Logger::UserFieldsPopulatorCallback&  populator,
            const PublishAllTriggerCallback&            publishAllCallback,
            int                                         scratchBufferSize,
+           bool                                        perThreadBuffers,
            LoggerManagerConfiguration::LogOrder        logOrder,
            LoggerManagerConfiguration::TriggerMarkers  triggerMarkers,
            bslma::Allocator                           *globalAllocator)
@@ -249,6 +382,8 @@ Logger::Logger(
 , d_populator(populator)
 , d_publishAll(publishAllCallback)
 , d_scratchBufferSize(scratchBufferSize)
+, d_perThreadBuffers(perThreadBuffers)
+, d_perThreadBufferList_p(0)
 , d_logOrder(logOrder)
 , d_triggerMarkers(triggerMarkers)
 , d_allocator_p(globalAllocator)
@@ -260,6 +395,17 @@ Logger::Logger(
 
     // 'snprintf' message buffer
     d_scratchBuffer_p = (char *)d_allocator_p->allocate(d_scratchBufferSize);
+
+    if (d_perThreadBuffers
+     && 0 != bslmt::ThreadUtil::createKey(
+                                  &d_perThreadBufferKey,
+                                  (bslmt::ThreadUtil::Destructor)
+                                  &deallocatePerThreadBuffer)) {
+        // No thread-specific storage is available; fall back to the shared
+        // scratch buffer.
+
+        d_perThreadBuffers = false;
+    }
 }
 
 Logger::~Logger()
@@ -273,6 +419,16 @@ Logger::~Logger()
 
     d_recordBuffer_p->removeAll();
     d_allocator_p->deallocate(d_scratchBuffer_p);
+
+    if (d_perThreadBuffers) {
+        // Delete the key before reclaiming the buffers, so that threads
+        // exiting from now on do not reclaim their buffers a second time.
+
+        bslmt::ThreadUtil::setSpecific(d_perThreadBufferKey, 0);
+        bslmt::ThreadUtil::deleteKey(d_perThreadBufferKey);
+        deallocatePerThreadBufferList(&d_perThreadBufferList_p,
+                                      &d_perThreadBufferListMutex);
+    }
 }
 
 // PRIVATE MANIPULATORS
@@ -473,6 +629,28 @@ void Logger::removeAll()
 
 char *Logger::obtainMessageBuffer(bslmt::Mutex **mutex, int *bufferSize)
 {
+    if (d_perThreadBuffers) {
+        char *buffer = static_cast<char *>(
+                        bslmt::ThreadUtil::getSpecific(d_perThreadBufferKey));
+        if (0 == buffer) {
+            buffer = allocatePerThreadBuffer(d_scratchBufferSize,
+                                             &d_perThreadBufferList_p,
+                                             &d_perThreadBufferListMutex,
+                                             d_allocator_p);
+            if (0 != bslmt::ThreadUtil::setSpecific(d_perThreadBufferKey,
+                                                    buffer)) {
+                deallocatePerThreadBuffer(buffer);
+                buffer = 0;
+            }
+        }
+
+        if (buffer) {
+            *mutex      = 0;
+            *bufferSize = d_scratchBufferSize;
+            return buffer;                                            // RETURN
+        }
+    }
+
     d_scratchBufferMutex.lock();
     *mutex = &d_scratchBufferMutex;
     *bufferSize = d_scratchBufferSize;
@@ -714,7 +892,10 @@ void LoggerManager::constructObject(
                                             &d_userFieldsSchema,
                                             d_populator,
                                             d_publishAllCallback,
-                                            d_scratchBufferSize,
+                                            d_perThreadBufferSize
+                                            ? d_perThreadBufferSize
+                                            : d_scratchBufferSize,
+                                            0 != d_perThreadBufferSize,
                                             d_logOrder,
                                             d_triggerMarkers,
                                             d_allocator_p);
@@ -753,6 +934,7 @@ LoggerManager::LoggerManager(
 , d_recordBuffer_p(0)
 , d_defaultCategory_p(0)
 , d_scratchBufferSize(configuration.defaults().defaultLoggerBufferSize())
+, d_perThreadBufferSize(configuration.perThreadMessageBufferSize())
 , d_defaultLoggers(bslma::Default::globalAllocator(globalAllocator))
 , d_logOrder(configuration.logOrder())
 , d_triggerMarkers(configuration.triggerMarkers())
@@ -809,7 +991,10 @@ Logger *LoggerManager::allocateLogger(RecordBuffer *buffer)
                                                 &d_userFieldsSchema,
                                                 d_populator,
                                                 d_publishAllCallback,
-                                                d_scratchBufferSize,
+                                                d_perThreadBufferSize
+                                                ? d_perThreadBufferSize
+                                                : d_scratchBufferSize,
+                                                0 != d_perThreadBufferSize,
                                                 d_logOrder,
                                                 d_triggerMarkers,
                                                 d_allocator_p);
@@ -829,6 +1014,7 @@ Logger *LoggerManager::allocateLogger(RecordBuffer *buffer,
                                                 d_populator,
                                                 d_publishAllCallback,
                                                 scratchBufferSize,
+                                                0 != d_perThreadBufferSize,
                                                 d_logOrder,
                                                 d_triggerMarkers,
                                                 d_allocator_p);
@@ -847,7 +1033,10 @@ Logger *LoggerManager::allocateLogger(RecordBuffer *buffer,
                                                 &d_userFieldsSchema,
                                                 d_populator,
                                                 d_publishAllCallback,
-                                                d_scratchBufferSize,
+                                                d_perThreadBufferSize
+                                                ? d_perThreadBufferSize
+                                                : d_scratchBufferSize,
+                                                0 != d_perThreadBufferSize,
                                                 d_logOrder,
                                                 d_triggerMarkers,
                                                 d_allocator_p);
@@ -868,6 +1057,7 @@ Logger *LoggerManager::allocateLogger(RecordBuffer *buffer,
                                                 d_populator,
                                                 d_publishAllCallback,
                                                 scratchBufferSize,
+                                                0 != d_perThreadBufferSize,
                                                 d_logOrder,
                                                 d_triggerMarkers,
                                                 d_allocator_p);
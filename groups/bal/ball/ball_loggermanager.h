@@ -329,6 +329,22 @@ BSLS_IDENT("$Id: $")
 // have them share a common logger so that the trace-back log *does* include
 // all relevant records.
 //
+///Message Buffers
+///- - - - - - - -
+// Each logger supplies a scratch buffer, accessible via 'obtainMessageBuffer',
+// that is used to format messages before they are logged (e.g., by the
+// 'printf'-style logging macros of 'ball_log').  By default, a logger has a
+// single such buffer, protected by a mutex that is held from the time the
+// buffer is obtained until the formatted record has been logged; concurrent
+// log statements issued through the same logger are therefore serialized.  If
+// the 'perThreadMessageBufferSize' attribute of the
+// 'ball::LoggerManagerConfiguration' supplied to the logger manager is
+// positive, each logger instead supplies every thread with its own buffer,
+// allocated on first use and reused for the lifetime of that thread (or of the
+// logger, if shorter), so that 'obtainMessageBuffer' never blocks.  In this
+// mode the mutex address loaded by 'obtainMessageBuffer' is 0.  The buffers
+// still held by live threads are reclaimed when the logger is destroyed.
+//
 ///'bsls::Log' Logging Redirection
 ///-------------------------------
 // The 'ball::LoggerManager' singleton, on construction, will redirect the
@@ -888,6 +904,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_rwmutex.h>
 #endif
 
+#ifndef INCLUDED_BSLMT_THREADUTIL
+#include <bslmt_threadutil.h>
+#endif
+
 #ifndef INCLUDED_BSLMA_ALLOCATOR
 #include <bslma_allocator.h>
 #endif
@@ -914,6 +934,7 @@ namespace BloombergLP {
 namespace ball {
 
 class LoggerManager;
+struct Logger_PerThreadBuffer;
 class Observer;
 class RecordBuffer;
 
@@ -964,14 +985,34 @@ class Logger {
     PublishAllTriggerCallback
                           d_publishAll;         // publishAll callback functor
 
-    char                 *d_scratchBuffer_p;    // buffer for formatting log
-                                                // messages (owned)
+    char                 *d_scratchBuffer_p;    // shared buffer for
+                                                // formatting log messages
+                                                // (owned)
 
     int                   d_scratchBufferSize;  // message buffer size (bytes)
 
     bslmt::Mutex          d_scratchBufferMutex; // ensure thread-safety of
                                                 // message buffer
 
+    bool                  d_perThreadBuffers;   // 'true' if each thread
+                                                // has its own message buffer
+                                                // (of 'd_scratchBufferSize'
+                                                // bytes)
+
+    bslmt::ThreadUtil::Key
+                          d_perThreadBufferKey; // key for per-thread message
+                                                // buffers (valid only if
+                                                // 'd_perThreadBuffers')
+
+    Logger_PerThreadBuffer
+                         *d_perThreadBufferList_p;
+                                                // per-thread message buffers
+                                                // of the live threads (owned)
+
+    bslmt::Mutex          d_perThreadBufferListMutex;
+                                                // serializes access to
+                                                // 'd_perThreadBufferList_p'
+
     LoggerManagerConfiguration::LogOrder
                           d_logOrder;           // logging order
 
@@ -996,6 +1037,7 @@ class Logger {
            const UserFieldsPopulatorCallback&          populator,
            const PublishAllTriggerCallback&            publishAllCallback,
            int                                         scratchBufferSize,
+           bool                                        perThreadBuffers,
            LoggerManagerConfiguration::LogOrder        logOrder,
            LoggerManagerConfiguration::TriggerMarkers  triggerMarkers,
            bslma::Allocator                           *globalAllocator);
@@ -1007,7 +1049,10 @@ class Logger {
         // 'publishAllCallback' that is invoked when a Trigger-All event
         // occurs, the specified 'scratchBufferSize' for the internal message
         // buffer accessible via 'obtainMessageBuffer', and the specified
-        // 'globalAllocator' used to supply memory.  On a Trigger or
+        // 'globalAllocator' used to supply memory.  If the specified
+        // 'perThreadBuffers' is 'true', each thread is supplied its own
+        // 'scratchBufferSize'-sized message buffer; otherwise a single message
+        // buffer is shared by all threads.  On a Trigger or
         // Trigger-All event, the messages are published in the specified
         // 'logOrder'.  The behavior is undefined unless 'observer',
         // 'recordBuffer', 'schema', and 'globalAllocator' are non-null.  Note
@@ -1121,7 +1166,10 @@ class Logger {
         // '*mutex' address, and load the size (in bytes) of the buffer into
         // the specified 'bufferSize' address.  The address remains valid, and
         // the buffer remains locked by this thread of execution, until this
-        // thread calls 'mutex->unlock()'.  The behavior is undefined if this
+        // thread calls 'mutex->unlock()'.  If this logger supplies per-thread
+        // message buffers, this method does not block, 0 is loaded into
+        // '*mutex', and the returned buffer remains valid until the next call
+        // to this method from this thread.  The behavior is undefined if this
         // thread of execution currently holds a lock on the buffer.  Note that
         // the buffer is intended to be used *only* for formatting log messages
         // immediately before calling 'logMessage'; other use may adversely
@@ -1235,6 +1283,11 @@ class LoggerManager {
     int                    d_scratchBufferSize;  // logger default message
                                                  // buffer size (bytes)
 
+    int                    d_perThreadBufferSize;
+                                                 // per-thread message buffer
+                                                 // size (bytes), or 0 if
+                                                 // loggers share one buffer
+
     bsl::map<void *, Logger *>
                            d_defaultLoggers;     // *registered* loggers
 
@@ -1381,7 +1434,9 @@ class LoggerManager {
         // Return the address of a modifiable logger managed by this logger
         // manager configured with the specified record 'buffer'.  Optionally
         // specify a 'scratchBufferSize' for the logger's user-accessible
-        // message buffer.  Optionally specify an 'observer' that receives
+        // message buffer (or, if this logger manager was configured with
+        // per-thread message buffers, for each of the logger's per-thread
+        // message buffers).  Optionally specify an 'observer' that receives
         // published log records.  Note that this method is primarily intended
         // for use in multi-threaded applications, but can be used to partition
         // logging streams even within a single thread.  Also note that
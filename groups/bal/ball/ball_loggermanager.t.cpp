@@ -171,6 +171,7 @@ using namespace bdlf::PlaceHolders;
 // [27] USAGE EXAMPLE #2
 // [28] USAGE EXAMPLE #3
 // [29] USAGE EXAMPLE #4
+// [30] TESTING: PER-THREAD MESSAGE BUFFERS
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -1295,6 +1296,75 @@ extern "C" {
 
 }  // close namespace BALL_LOGGERMANAGER_TEST_CASE_24
 
+// ============================================================================
+//                         CASE 30 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace BALL_LOGGERMANAGER_TEST_CASE_30 {
+enum {
+    NUM_THREADS = 8 // number of threads
+};
+
+bslmt::Barrier  barrier(NUM_THREADS);
+char           *buffers[NUM_THREADS];
+bslmt::Mutex   *mutexes[NUM_THREADS];
+int             bufferSizes[NUM_THREADS];
+
+bslmt::Barrier  holdBarrier(NUM_THREADS + 1);
+ball::Logger   *heldLogger = 0;
+
+extern "C" {
+    void *obtainBufferThread(void *arg)
+        // Obtain the message buffer of the active logger, record its address,
+        // mutex, and size, and format a message in the buffer.  Verify the
+        // message after all threads have formatted their messages.
+    {
+        const int id = static_cast<int>(reinterpret_cast<bsl::size_t>(arg));
+
+        ball::Logger& logger = ball::LoggerManager::singleton().getLogger();
+
+        buffers[id] = logger.obtainMessageBuffer(&mutexes[id],
+                                                 &bufferSizes[id]);
+        bsl::sprintf(buffers[id], "thread %d", id);
+
+        barrier.wait();
+
+        char expected[32];
+        bsl::sprintf(expected, "thread %d", id);
+        ASSERTV(id, 0 == bsl::strcmp(expected, buffers[id]));
+
+        // Obtaining the buffer again from the same thread yields the same
+        // buffer.
+
+        bslmt::Mutex *mutex;
+        int           size;
+        ASSERTV(id, buffers[id] == logger.obtainMessageBuffer(&mutex, &size));
+        ASSERTV(id, 0 == mutex);
+        return 0;
+    }
+
+    void *holdBufferThread(void *arg)
+        // Obtain the message buffer of 'heldLogger' and format a message in
+        // it, then stay alive until the main thread has deallocated that
+        // logger.
+    {
+        const int id = static_cast<int>(reinterpret_cast<bsl::size_t>(arg));
+
+        bslmt::Mutex *mutex  = 0;
+        int           size   = 0;
+        char         *buffer = heldLogger->obtainMessageBuffer(&mutex, &size);
+        ASSERTV(id, buffer);
+        ASSERTV(id, 0 == mutex);
+        bsl::sprintf(buffer, "thread %d", id);
+
+        holdBarrier.wait();  // all buffers obtained
+        holdBarrier.wait();  // 'heldLogger' deallocated
+        return 0;
+    }
+}  // extern "C"
+
+}  // close namespace BALL_LOGGERMANAGER_TEST_CASE_30
+
 //=============================================================================
 //                  GLOBAL HELPER FUNCTIONS FOR TESTING
 //-----------------------------------------------------------------------------
@@ -1348,6 +1418,190 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 30: {
+        // --------------------------------------------------------------------
+        // TESTING: PER-THREAD MESSAGE BUFFERS
+        //
+        // Concerns:
+        //: 1 If the configuration specifies a positive per-thread message
+        //:   buffer size, 'obtainMessageBuffer' returns a buffer of that size
+        //:   and a null mutex, without blocking.
+        //:
+        //: 2 Each thread is supplied a distinct buffer, and a thread obtains
+        //:   the same buffer on subsequent calls.
+        //:
+        //: 3 The buffer of a thread is reclaimed when the thread exits, and
+        //:   the buffer of the destroying thread is reclaimed when the logger
+        //:   is destroyed.
+        //:
+        //: 6 The buffers of threads that are still alive when the logger is
+        //:   destroyed are reclaimed by the logger, and not again when these
+        //:   threads exit.
+        //:
+        //: 4 Loggers allocated with an explicit message buffer size supply
+        //:   per-thread buffers of that size.
+        //:
+        //: 5 A message formatted in a per-thread buffer is logged normally.
+        //
+        // Plan:
+        //: 1 Initialize the logger manager with a per-thread message buffer
+        //:   size, and obtain the buffer from the main thread and from
+        //:   several concurrent threads that hold their buffers
+        //:   simultaneously; verify the buffer addresses, sizes, and mutexes.
+        //:   (C-1..2)
+        //:
+        //: 2 Verify, using a test allocator, that the memory in use after the
+        //:   threads are joined, and after the logger manager is destroyed,
+        //:   is as expected.  (C-3)
+        //:
+        //: 3 Allocate a logger with an explicit message buffer size and
+        //:   verify the size of its per-thread buffer.  (C-4)
+        //:
+        //: 4 Log a message formatted in the per-thread buffer of the main
+        //:   thread and verify the published record.  (C-5)
+        //:
+        //: 5 Allocate a logger, obtain its buffer from several threads, and
+        //:   deallocate the logger while these threads are alive.  Verify,
+        //:   using a test allocator, that no memory is retained, before and
+        //:   after the threads exit.  (C-6)
+        //
+        // Note that the logger manager singleton can be initialized only once
+        // per process; the shared-buffer (default) mode is tested in case 7.
+        //
+        // Testing:
+        //   TESTING: PER-THREAD MESSAGE BUFFERS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING: PER-THREAD MESSAGE BUFFERS"
+                          << endl << "===================================\n";
+
+        using namespace BALL_LOGGERMANAGER_TEST_CASE_30;
+
+        if (verbose) cout << "\tPer-thread message buffers." << endl;
+        {
+            const int SIZE = 256;
+
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            ball::TestObserver               observer(cout);
+            ball::LoggerManagerConfiguration configuration;
+            ASSERT(0 == configuration.setPerThreadMessageBufferSizeIfValid(
+                                                                       SIZE));
+            {
+                ball::LoggerManagerScopedGuard guard(&observer,
+                                                     configuration,
+                                                     &ta);
+                ball::LoggerManager& mLM    = ball::LoggerManager::singleton();
+                ball::Logger&        logger = mLM.getLogger();
+                ASSERT(SIZE == logger.messageBufferSize());
+
+                bslmt::Mutex *mutex  = 0;
+                int           size   = 0;
+                char         *buffer = logger.obtainMessageBuffer(&mutex,
+                                                                  &size);
+                ASSERT(buffer);
+                ASSERT(0    == mutex);
+                ASSERT(SIZE == size);
+                ASSERT(buffer == logger.obtainMessageBuffer(&mutex, &size));
+
+                const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+                executeInParallel(NUM_THREADS, obtainBufferThread);
+
+                // Buffers of exited threads have been reclaimed.
+
+                ASSERTV(NUM_BLOCKS, ta.numBlocksInUse(),
+                        NUM_BLOCKS == ta.numBlocksInUse());
+
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    ASSERTV(i, buffers[i]);
+                    ASSERTV(i, buffer != buffers[i]);
+                    ASSERTV(i, 0      == mutexes[i]);
+                    ASSERTV(i, SIZE   == bufferSizes[i]);
+                    for (int j = 0; j < i; ++j) {
+                        ASSERTV(i, j, buffers[i] != buffers[j]);
+                    }
+                }
+
+                ball::FixedSizeRecordBuffer recordBuffer(1024, &ta);
+
+                // Allocate and deallocate the logger twice: the first
+                // iteration primes the node pool of the logger manager's
+                // logger set, and the second verifies that no memory
+                // (including the per-thread buffer) is retained.
+
+                bsls::Types::Int64 numBlocks = 0;
+                for (int i = 0; i < 2; ++i) {
+                    ball::Logger *explicitLogger = mLM.allocateLogger(
+                                                              &recordBuffer,
+                                                              2 * SIZE);
+                    ASSERT(2 * SIZE == explicitLogger->messageBufferSize());
+
+                    char *explicitBuffer =
+                           explicitLogger->obtainMessageBuffer(&mutex, &size);
+                    ASSERT(explicitBuffer);
+                    ASSERT(explicitBuffer != buffer);
+                    ASSERT(0        == mutex);
+                    ASSERT(2 * SIZE == size);
+
+                    mLM.deallocateLogger(explicitLogger);
+                    if (0 == i) {
+                        numBlocks = ta.numBlocksInUse();
+                    }
+                    else {
+                        ASSERTV(numBlocks, ta.numBlocksInUse(),
+                                numBlocks == ta.numBlocksInUse());
+                    }
+                }
+
+                if (verbose) cout << "\tDeallocating with live threads."
+                                  << endl;
+                {
+                    heldLogger = mLM.allocateLogger(&recordBuffer, 2 * SIZE);
+
+                    bslmt::ThreadUtil::Handle threads[NUM_THREADS];
+                    for (int i = 0; i < NUM_THREADS; ++i) {
+                        void *arg = reinterpret_cast<void *>(
+                                                  static_cast<bsl::size_t>(i));
+                        ASSERTV(i, 0 == bslmt::ThreadUtil::create(
+                                                             &threads[i],
+                                                             holdBufferThread,
+                                                             arg));
+                    }
+                    holdBarrier.wait();
+
+                    ASSERTV(numBlocks, ta.numBlocksInUse(),
+                            numBlocks + NUM_THREADS < ta.numBlocksInUse());
+
+                    mLM.deallocateLogger(heldLogger);
+                    heldLogger = 0;
+
+                    ASSERTV(numBlocks, ta.numBlocksInUse(),
+                            numBlocks == ta.numBlocksInUse());
+
+                    holdBarrier.wait();
+                    for (int i = 0; i < NUM_THREADS; ++i) {
+                        ASSERTV(i, 0 == bslmt::ThreadUtil::join(threads[i]));
+                    }
+
+                    ASSERTV(numBlocks, ta.numBlocksInUse(),
+                            numBlocks == ta.numBlocksInUse());
+                }
+
+                bsl::strcpy(buffer, "per-thread message");
+                logger.logMessage(mLM.defaultCategory(),
+                                  ball::Severity::e_ERROR,
+                                  __FILE__,
+                                  __LINE__,
+                                  buffer);
+                ASSERT(1 == observer.numPublishedRecords());
+                ASSERT(0 == bsl::strcmp("per-thread message",
+                                        observer.lastPublishedRecord().
+                                                     fixedFields().message()));
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
       case 29: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE #4
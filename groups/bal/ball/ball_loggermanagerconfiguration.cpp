@@ -52,6 +52,12 @@ LoggerManagerConfiguration::areValidDefaultThresholdLevels(int recordLevel,
                                                               triggerAllLevel);
 }
 
+bool
+LoggerManagerConfiguration::isValidPerThreadMessageBufferSize(int numBytes)
+{
+    return 0 <= numBytes;
+}
+
 // CREATORS
 LoggerManagerConfiguration::LoggerManagerConfiguration(
                                               bslma::Allocator *basicAllocator)
@@ -67,6 +73,7 @@ LoggerManagerConfiguration::LoggerManagerConfiguration(
                 bsl::allocator<DefaultThresholdLevelsCallback>(basicAllocator))
 , d_logOrder(e_LIFO)
 , d_triggerMarkers(e_BEGIN_END_MARKERS)
+, d_perThreadBufferSize(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -89,6 +96,7 @@ LoggerManagerConfiguration::LoggerManagerConfiguration(
                 original.d_defaultThresholdsCb)
 , d_logOrder(original.d_logOrder)
 , d_triggerMarkers(original.d_triggerMarkers)
+, d_perThreadBufferSize(original.d_perThreadBufferSize)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -108,6 +116,7 @@ LoggerManagerConfiguration::operator=(const LoggerManagerConfiguration& rhs)
     d_defaultThresholdsCb = rhs.d_defaultThresholdsCb;
     d_logOrder            = rhs.d_logOrder;
     d_triggerMarkers      = rhs.d_triggerMarkers;
+    d_perThreadBufferSize = rhs.d_perThreadBufferSize;
 
     return *this;
 }
@@ -177,6 +186,17 @@ void LoggerManagerConfiguration::setTriggerMarkers(TriggerMarkers value)
     d_triggerMarkers = value;
 }
 
+int LoggerManagerConfiguration::setPerThreadMessageBufferSizeIfValid(
+                                                                  int numBytes)
+{
+    if (!isValidPerThreadMessageBufferSize(numBytes)) {
+        return -1;                                                    // RETURN
+    }
+
+    d_perThreadBufferSize = numBytes;
+    return 0;
+}
+
 // ACCESSORS
 const LoggerManagerDefaults&
 LoggerManagerConfiguration::defaults() const
@@ -250,6 +270,11 @@ LoggerManagerConfiguration::triggerMarkers() const
     return d_triggerMarkers;
 }
 
+int LoggerManagerConfiguration::perThreadMessageBufferSize() const
+{
+    return d_perThreadBufferSize;
+}
+
 bsl::ostream&
 LoggerManagerConfiguration::print(bsl::ostream& stream,
                                   int           level,
@@ -301,6 +326,10 @@ LoggerManagerConfiguration::print(bsl::ostream& stream,
                                                  : "BEGIN_END_MARKERS";
     stream << "Trigger markers are " << triggerMarker << NL;
 
+    bdlb::Print::indent(stream, level + 1, spacesPerLevel);
+    stream << "Per-thread message buffer size is " << d_perThreadBufferSize
+           << NL;
+
     bdlb::Print::indent(stream, level, spacesPerLevel);
     stream << ']' << NL;
 
@@ -325,7 +354,8 @@ bool ball::operator==(const ball::LoggerManagerConfiguration& lhs,
         && (bool)lhs.d_categoryNameFilter  == (bool)rhs.d_categoryNameFilter
         && (bool)lhs.d_defaultThresholdsCb == (bool)rhs.d_defaultThresholdsCb
         && lhs.d_logOrder                  == rhs.d_logOrder
-        && lhs.d_triggerMarkers            == rhs.d_triggerMarkers;
+        && lhs.d_triggerMarkers            == rhs.d_triggerMarkers
+        && lhs.d_perThreadBufferSize       == rhs.d_perThreadBufferSize;
 }
 
 bool ball::operator!=(const ball::LoggerManagerConfiguration& lhs,
@@ -67,6 +67,8 @@ BSLS_IDENT("$Id: $")
 //
 //  TriggerMarkers                               triggerMarkers
 //
+//  int                                          perThreadMessageBufferSize
+//
 //  NAME                            DESCRIPTION
 //  -------------------             -------------------------------------------
 //  defaults                        constrained defaults for buffer size and
@@ -98,6 +100,13 @@ BSLS_IDENT("$Id: $")
 //                                  sequence of records logged due to a Trigger
 //                                  or Trigger-All event; default is
 //                                  'e_BEGIN_END_MARKERS'.
+//
+//  perThreadMessageBufferSize      size (in bytes) of the message buffer
+//                                  provided to each thread that formats log
+//                                  messages (e.g., via the 'printf'-style
+//                                  logging macros); if this attribute is 0,
+//                                  all threads share a single mutex-protected
+//                                  message buffer per logger; default is 0.
 //..
 // The constraints are as follows:
 //..
@@ -116,6 +125,8 @@ BSLS_IDENT("$Id: $")
 //  +--------------------------------+--------------------------------+
 //  | triggerMarkers                 | (none)                         |
 //  +--------------------------------+--------------------------------+
+//  | perThreadMessageBufferSize     | 0 <= value                     |
+//  +--------------------------------+--------------------------------+
 //..
 // For convenience, the 'ball::LoggerManagerConfiguration' interface contains
 // manipulators and accessors to configure and inspect the value of its
@@ -194,12 +205,22 @@ BSLS_IDENT("$Id: $")
 //    config.setTriggerMarkers(
 //                          ball::LoggerManagerConfiguration::e_NO_MARKERS);
 //..
+// Next, we request that each thread formatting log messages be supplied its
+// own 512-byte message buffer, so that concurrent 'printf'-style log
+// statements do not contend on a single shared buffer:
+//..
+//    if (0 != config.setPerThreadMessageBufferSizeIfValid(512)) {
+//       bsl::cerr << "Failed to set per-thread buffer size." << bsl::endl;
+//       bsl::exit(-1);
+//    }
+//..
 // Then, we verify the options are configured correctly:
 //..
 //    ASSERT(schema == config.userFieldsSchema());
 //    ASSERT(ball::LoggerManagerConfiguration::e_FIFO == config.logOrder());
 //    ASSERT(ball::LoggerManagerConfiguration::e_NO_MARKERS
 //                                                 == config.triggerMarkers());
+//    ASSERT(512 == config.perThreadMessageBufferSize());
 //..
 // Finally, we print the configuration value to 'stdout' and return:
 //..
@@ -229,6 +250,7 @@ BSLS_IDENT("$Id: $")
 //      Default Threshold Callback functor is null
 //      Logging order is FIFO
 //      Trigger markers are NO_MARKERS
+//      Per-thread message buffer size is 512
 //  ]
 //..
 
@@ -376,6 +398,10 @@ class LoggerManagerConfiguration {
 
     TriggerMarkers        d_triggerMarkers;       // trigger marker
 
+    int                   d_perThreadBufferSize;  // size of per-thread
+                                                  // message buffers (0 if
+                                                  // buffer is shared)
+
     bslma::Allocator     *d_allocator_p;          // memory allocator (held,
                                                   // not owned)
 
@@ -407,6 +433,11 @@ class LoggerManagerConfiguration {
         // severity threshold level, and 'false' otherwise.  Valid severity
         // threshold levels are in the range '[0 .. 255]'.
 
+    static bool isValidPerThreadMessageBufferSize(int numBytes);
+        // Return 'true' if the specified 'numBytes' is a valid per-thread
+        // message-buffer size value, and 'false' otherwise.  'numBytes' is
+        // valid if '0 <= numBytes'.
+
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(LoggerManagerConfiguration,
                                    bslma::UsesBslmaAllocator);
@@ -504,6 +535,16 @@ class LoggerManagerConfiguration {
         // Set the trigger marker attribute of this object to the specified
         // 'value'.
 
+    int setPerThreadMessageBufferSizeIfValid(int numBytes);
+        // Set the per-thread message-buffer size attribute of this object to
+        // the specified 'numBytes' if '0 <= numBytes'.  Return 0 on success,
+        // and a non-zero value otherwise with no effect on this object.  If
+        // 'numBytes' is positive, loggers created by a logger manager
+        // configured with this object supply each thread with its own
+        // 'numBytes'-sized buffer for formatting log messages, instead of a
+        // single buffer (of the default logger-message-buffer size) that is
+        // shared, under a mutex, by all threads.
+
     // ACCESSORS
     const LoggerManagerDefaults& defaults() const;
         // Return a reference to the non-modifiable defaults object attribute
@@ -559,6 +600,11 @@ class LoggerManagerConfiguration {
         // Return the trigger marker attribute of this object.  See attributes
         // description for effects of the trigger markers.
 
+    int perThreadMessageBufferSize() const;
+        // Return the per-thread message-buffer size attribute of this object.
+        // A value of 0 indicates that loggers share a single message buffer
+        // among all threads.
+
     bsl::ostream& print(bsl::ostream& stream,
                         int           level          = 0,
                         int           spacesPerLevel = 4) const;
@@ -56,6 +56,7 @@ using namespace bsl;  // automatically added by script
 // [ 1] void setDefaultValues(const ball::LMD& defaults);
 // [ 5] void setLogOrder(LogOrder value);
 // [ 6] void setTriggerMarkers(TriggerMarkers value);
+// [ 7] int setPerThreadMessageBufferSizeIfValid(int numBytes);
 // [ 1] void setUserFieldsSchema(const Schema& , const Populator& );
 // [ 1] void setCategoryNameFilterCallback(const CNF& nameFilter);
 // [ 1] void setDefaultThresholdLevelsCallback(const DTC& );
@@ -64,6 +65,8 @@ using namespace bsl;  // automatically added by script
 // [ 1] const ball::UserFieldsSchema& userFieldsSchema() const;
 // [ 5] const LogOrder logOrder() const;
 // [ 6] const TriggerMarkers triggerMarkers() const;
+// [ 7] int perThreadMessageBufferSize() const;
+// [ 7] static bool isValidPerThreadMessageBufferSize(int numBytes);
 // [ 1] const Populator& userFieldsPopulatorCallback() const;
 // [ 1] const CNF& categoryNameFilterCallback() const;
 // [ 1] const DTC& defaultThresholdLevelsCallback() const;
@@ -73,7 +76,7 @@ using namespace bsl;  // automatically added by script
 // [ 1] bool operator!=(const ball::LMC& lhs, const ball::LMC& rhs);
 // [ 1] bsl::ostream& operator<<(bsl::ostream&, const ball::LMC);
 //-----------------------------------------------------------------------------
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -214,12 +217,22 @@ typedef bsl::function<void(int *, int *, int *, int *, const char*)>     DtCb;
       config.setTriggerMarkers(
                             ball::LoggerManagerConfiguration::e_NO_MARKERS);
 //..
+// Next, we request that each thread formatting log messages be supplied its
+// own 512-byte message buffer, so that concurrent 'printf'-style log
+// statements do not contend on a single shared buffer:
+//..
+      if (0 != config.setPerThreadMessageBufferSizeIfValid(512)) {
+         bsl::cerr << "Failed to set per-thread buffer size." << bsl::endl;
+         bsl::exit(-1);
+      }
+//..
 // Then, we verify the options are configured correctly:
 //..
       ASSERT(schema == config.userFieldsSchema());
       ASSERT(ball::LoggerManagerConfiguration::e_FIFO == config.logOrder());
       ASSERT(ball::LoggerManagerConfiguration::e_NO_MARKERS
                                                    == config.triggerMarkers());
+      ASSERT(512 == config.perThreadMessageBufferSize());
 //..
 // Finally, we print the configuration value to 'stdout' and return:
 //..
@@ -249,6 +262,7 @@ typedef bsl::function<void(int *, int *, int *, int *, const char*)>     DtCb;
 //      Default Threshold Callback functor is null
 //      Logging order is FIFO
 //      Trigger markers are NO_MARKERS
+//      Per-thread message buffer size is 512
 //  ]
 //..
 
@@ -341,7 +355,7 @@ int main(int argc, char *argv[])
     const DtCb   DTCB1(dtCb1);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -361,6 +375,69 @@ int main(int argc, char *argv[])
         initializeConfiguration(verbose);
 
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'setPerThreadMessageBufferSizeIfValid'
+        //
+        // Concerns:
+        //: 1 The per-thread message-buffer size is 0 by default.
+        //:
+        //: 2 Non-negative values are accepted and reflected by the accessor.
+        //:
+        //: 3 Negative values are rejected with no effect on the object.
+        //:
+        //: 4 The attribute participates in copy construction, assignment,
+        //:   and equality comparison.
+        //
+        // Plan:
+        //: 1 Create a default object and verify the attribute.  (C-1)
+        //:
+        //: 2 Set a sequence of valid and invalid values and verify the return
+        //:   status and the attribute.  (C-2..3)
+        //:
+        //: 3 Copy, assign, and compare objects differing only in this
+        //:   attribute.  (C-4)
+        //
+        // Testing:
+        //   static bool isValidPerThreadMessageBufferSize(int numBytes);
+        //   int setPerThreadMessageBufferSizeIfValid(int numBytes);
+        //   int perThreadMessageBufferSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "\nTESTING 'setPerThreadMessageBufferSizeIfValid'"
+                 << "\n==============================================\n";
+
+        ASSERT( Obj::isValidPerThreadMessageBufferSize(0));
+        ASSERT( Obj::isValidPerThreadMessageBufferSize(1));
+        ASSERT( Obj::isValidPerThreadMessageBufferSize(65536));
+        ASSERT(!Obj::isValidPerThreadMessageBufferSize(-1));
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == X.perThreadMessageBufferSize());
+
+        ASSERT(0 == mX.setPerThreadMessageBufferSizeIfValid(1024));
+        ASSERT(1024 == X.perThreadMessageBufferSize());
+
+        ASSERT(0 != mX.setPerThreadMessageBufferSizeIfValid(-1));
+        ASSERT(1024 == X.perThreadMessageBufferSize());
+
+        const Obj Z;
+        ASSERT(Z != X);
+
+        Obj mY(X);  const Obj& Y = mY;
+        ASSERT(Y == X);
+        ASSERT(1024 == Y.perThreadMessageBufferSize());
+
+        ASSERT(0 == mY.setPerThreadMessageBufferSizeIfValid(0));
+        ASSERT(0 == Y.perThreadMessageBufferSize());
+        ASSERT(Y != X);
+        ASSERT(Y == Z);
+
+        mY = X;
+        ASSERT(Y == X);
+        ASSERT(1024 == Y.perThreadMessageBufferSize());
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // TESTING  'setTriggerMarkers' AND 'triggerMarkers':
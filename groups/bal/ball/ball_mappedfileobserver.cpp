@@ -0,0 +1,463 @@
+// ball_mappedfileobserver.cpp                                        -*-C++-*-
+#include <ball_mappedfileobserver.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_mappedfileobserver_cpp,"$Id$ $CSID$")
+
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_recordbinaryutil.h>
+#include <ball_userfields.h>
+
+#include <bdlsb_fixedmemoutput.h>
+#include <bdls_memoryutil.h>
+
+#include <bslx_byteinstream.h>
+#include <bslx_genericoutstream.h>
+
+#include <bslma_default.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstring.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+typedef bsls::AtomicOperations                         AtomicOps;
+typedef bdls::FilesystemUtil                           FilesystemUtil;
+typedef bsls::Types::Int64                             Int64;
+typedef bslx::GenericOutStream<bdlsb::FixedMemOutput>  SlotOutStream;
+
+enum {
+    k_BDEX_VERSION_SELECTOR = 20170321,  // selects the binary record format
+                                         // written by this observer
+
+    k_FILE_FORMAT_VERSION   = 1,         // version of the file layout
+
+    k_HEADER_SIZE           = 64,        // size of the file header, in bytes
+
+    k_SLOT_HEADER_SIZE      = 16,        // size of the slot header, in bytes
+
+    k_SLOT_ALIGNMENT        = 8          // alignment of each slot, in bytes
+};
+
+const char  k_MAGIC[8] = { 'B', 'A', 'L', 'L', 'R', 'I', 'N', 'G' };
+
+const Int64 k_EMPTY    =  0;  // sequence stamp of a slot holding no record
+const Int64 k_WRITING  = -1;  // sequence stamp of a slot being written
+
+struct FileHeader {
+    // This 'struct' describes the layout of the header at the start of the
+    // file.
+
+    char                            d_magic[8];        // 'k_MAGIC'
+    int                             d_version;         // file layout version
+    int                             d_recordVersion;   // BDEX version of the
+                                                       // encoded records
+    int                             d_numSlots;        // number of slots
+    int                             d_slotSize;        // size of each slot
+    bsls::AtomicOperations::AtomicTypes::Int64
+                                    d_nextSequence;    // sequence number of
+                                                       // the next record,
+                                                       // less one
+};
+
+struct SlotHeader {
+    // This 'struct' describes the layout of the header at the start of each
+    // slot, which is followed by the encoded record.
+
+    bsls::AtomicOperations::AtomicTypes::Int64
+                                    d_sequence;        // 1 + sequence number
+                                                       // of the record held,
+                                                       // 'k_EMPTY', or
+                                                       // 'k_WRITING'
+    bsls::AtomicOperations::AtomicTypes::Int
+                                    d_length;          // length of the
+                                                       // encoded record
+    int                             d_reserved;        // unused
+};
+
+BSLMF_ASSERT(sizeof(FileHeader) <= k_HEADER_SIZE);
+BSLMF_ASSERT(sizeof(SlotHeader) == k_SLOT_HEADER_SIZE);
+
+inline
+SlotHeader *slotAt(char *mapping, int slotSize, int index)
+    // Return the address of the slot at the specified 'index' within the
+    // specified 'mapping' of a file having slots of the specified 'slotSize'.
+{
+    return reinterpret_cast<SlotHeader *>(
+                                      mapping
+                                    + k_HEADER_SIZE
+                                    + static_cast<Int64>(index) * slotSize);
+}
+
+inline
+void loadFence()
+    // Prevent the loads that precede this call from being reordered after
+    // the loads that follow it.
+{
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+#else
+    // A read-modify-write with acquire-release semantics is a full barrier
+    // on every supported platform.
+
+    static AtomicOps::AtomicTypes::Int fence = { 0 };
+    AtomicOps::addIntNvAcqRel(&fence, 0);
+#endif
+}
+
+int encodeRecord(char *buffer, int capacity, const Record& record)
+    // Encode the specified 'record' into the specified 'buffer' having the
+    // specified 'capacity'.  Return the number of bytes written on success,
+    // and a negative value if 'record' does not fit in 'buffer'.
+{
+    bdlsb::FixedMemOutput output(buffer, capacity);
+    SlotOutStream         stream(&output, k_BDEX_VERSION_SELECTOR);
+
+    RecordBinaryUtil::bdexStreamOut(
+           stream,
+           record,
+           RecordBinaryUtil::maxSupportedBdexVersion(k_BDEX_VERSION_SELECTOR));
+
+    return stream.isValid() ? static_cast<int>(output.length()) : -1;
+}
+
+bool isValidHeader(const FileHeader& header, Int64 fileSize)
+    // Return 'true' if the specified 'header' describes a file, written by
+    // 'MappedFileObserver', that fits in the specified 'fileSize' bytes, and
+    // 'false' otherwise.
+{
+    return 0 == bsl::memcmp(header.d_magic, k_MAGIC, sizeof k_MAGIC)
+        && k_FILE_FORMAT_VERSION == header.d_version
+        && 0 < header.d_numSlots
+        && MappedFileObserver::k_MIN_SLOT_SIZE <= header.d_slotSize
+        && k_HEADER_SIZE + static_cast<Int64>(header.d_numSlots)
+                                                          * header.d_slotSize
+                                                                 <= fileSize;
+}
+
+}  // close unnamed namespace
+
+                          // ------------------------
+                          // class MappedFileObserver
+                          // ------------------------
+
+// PRIVATE MANIPULATORS
+int MappedFileObserver::writeSlot(char *payload, const Record& record)
+{
+    const int capacity = d_slotSize - k_SLOT_HEADER_SIZE;
+
+    int length = encodeRecord(payload, capacity, record);
+    if (0 <= length) {
+        return length;                                                // RETURN
+    }
+
+    // The record does not fit: drop its user fields, and keep as much of its
+    // message as fits in the space left by the other fixed fields.
+
+    Record truncated(record.fixedFields(), UserFields(), d_allocator_p);
+    truncated.fixedFields().clearMessage();
+
+    length = encodeRecord(payload, capacity, truncated);
+    if (0 > length) {
+        return length;                                                // RETURN
+    }
+
+    // Allow for the growth of the message length prefix from one to four
+    // bytes.
+
+    const bslstl::StringRef message = record.fixedFields().messageRef();
+    const int               room    = capacity - length - 3;
+    if (0 < room) {
+        truncated.fixedFields().messageStreamBuf().sputn(
+                           message.data(),
+                           bsl::min(static_cast<int>(message.length()), room));
+    }
+    return encodeRecord(payload, capacity, truncated);
+}
+
+// CREATORS
+MappedFileObserver::MappedFileObserver(bslma::Allocator *basicAllocator)
+: d_descriptor(FilesystemUtil::k_INVALID_FD)
+, d_mapping_p(0)
+, d_mappingSize(0)
+, d_numSlots(0)
+, d_slotSize(0)
+, d_numDiscarded(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+MappedFileObserver::~MappedFileObserver()
+{
+    close();
+}
+
+// MANIPULATORS
+void MappedFileObserver::close()
+{
+    if (!d_mapping_p) {
+        return;                                                       // RETURN
+    }
+
+    FilesystemUtil::unmap(d_mapping_p, d_mappingSize);
+    FilesystemUtil::close(d_descriptor);
+
+    d_descriptor  = FilesystemUtil::k_INVALID_FD;
+    d_mapping_p   = 0;
+    d_mappingSize = 0;
+    d_numSlots    = 0;
+    d_slotSize    = 0;
+}
+
+int MappedFileObserver::open(const char *path, int numSlots, int slotSize)
+{
+    BSLS_ASSERT(path);
+    BSLS_ASSERT(0 < numSlots);
+    BSLS_ASSERT(k_MIN_SLOT_SIZE <= slotSize);
+
+    close();
+
+    if (slotSize > INT_MAX - k_SLOT_ALIGNMENT) {
+        return -1;                                                    // RETURN
+    }
+    slotSize = (slotSize + k_SLOT_ALIGNMENT - 1) & ~(k_SLOT_ALIGNMENT - 1);
+
+    const Int64 pageSize = bdls::MemoryUtil::pageSize();
+    const Int64 fileSize = k_HEADER_SIZE
+                         + static_cast<Int64>(numSlots) * slotSize;
+    const Int64 mappingSize = (fileSize + pageSize - 1) / pageSize * pageSize;
+    if (mappingSize > INT_MAX) {
+        return -2;                                                    // RETURN
+    }
+
+    FilesystemUtil::FileDescriptor descriptor =
+                         FilesystemUtil::open(path,
+                                              FilesystemUtil::e_OPEN_OR_CREATE,
+                                              FilesystemUtil::e_READ_WRITE,
+                                              FilesystemUtil::e_TRUNCATE);
+    if (FilesystemUtil::k_INVALID_FD == descriptor) {
+        return -3;                                                    // RETURN
+    }
+
+    void *mapping = 0;
+    if (0 != FilesystemUtil::growFile(descriptor, mappingSize)
+     || 0 != FilesystemUtil::map(descriptor,
+                                 &mapping,
+                                 0,
+                                 static_cast<int>(mappingSize),
+                                 bdls::MemoryUtil::k_ACCESS_READ_WRITE)) {
+        FilesystemUtil::close(descriptor);
+        return -4;                                                    // RETURN
+    }
+
+    // Clear the whole file, which also commits every page of the mapping, so
+    // that no page fault for a new page is taken while publishing.
+
+    bsl::memset(mapping, 0, static_cast<bsl::size_t>(mappingSize));
+
+    FileHeader *header = static_cast<FileHeader *>(mapping);
+    bsl::memcpy(header->d_magic, k_MAGIC, sizeof k_MAGIC);
+    header->d_version       = k_FILE_FORMAT_VERSION;
+    header->d_recordVersion = RecordBinaryUtil::maxSupportedBdexVersion(
+                                                      k_BDEX_VERSION_SELECTOR);
+    header->d_numSlots      = numSlots;
+    header->d_slotSize      = slotSize;
+    AtomicOps::initInt64(&header->d_nextSequence, 0);
+
+    d_descriptor  = descriptor;
+    d_mapping_p   = static_cast<char *>(mapping);
+    d_mappingSize = static_cast<int>(mappingSize);
+    d_numSlots    = numSlots;
+    d_slotSize    = slotSize;
+    d_numDiscarded.storeRelaxed(0);
+    return 0;
+}
+
+void MappedFileObserver::publish(const Record& record, const Context&)
+{
+    if (!d_mapping_p) {
+        return;                                                       // RETURN
+    }
+
+    FileHeader *header = reinterpret_cast<FileHeader *>(d_mapping_p);
+
+    const Int64 sequence =
+                 AtomicOps::addInt64NvAcqRel(&header->d_nextSequence, 1) - 1;
+
+    SlotHeader *slot = slotAt(d_mapping_p,
+                              d_slotSize,
+                              static_cast<int>(sequence % d_numSlots));
+
+    // Claim the slot, unless a thread that was assigned the slot one cycle
+    // earlier is still writing it (or a thread that was assigned the slot one
+    // cycle later has already claimed it).
+
+    Int64 stamp = AtomicOps::getInt64Acquire(&slot->d_sequence);
+    for (;;) {
+        if (k_WRITING == stamp || sequence < stamp) {
+            ++d_numDiscarded;
+            return;                                                   // RETURN
+        }
+        const Int64 previous = AtomicOps::testAndSwapInt64AcqRel(
+                                                             &slot->d_sequence,
+                                                             stamp,
+                                                             k_WRITING);
+        if (previous == stamp) {
+            break;
+        }
+        stamp = previous;
+    }
+
+    const int length = writeSlot(reinterpret_cast<char *>(slot + 1), record);
+    if (0 > length) {
+        ++d_numDiscarded;
+        AtomicOps::setInt64Release(&slot->d_sequence, k_EMPTY);
+        return;                                                       // RETURN
+    }
+
+    AtomicOps::setIntRelease(&slot->d_length, length);
+    AtomicOps::setInt64Release(&slot->d_sequence, sequence + 1);
+}
+
+int MappedFileObserver::sync(bool waitFlag)
+{
+    if (!d_mapping_p) {
+        return -1;                                                    // RETURN
+    }
+    return FilesystemUtil::sync(d_mapping_p, d_mappingSize, waitFlag);
+}
+
+                        // -----------------------------
+                        // struct MappedFileObserverUtil
+                        // -----------------------------
+
+// CLASS METHODS
+int MappedFileObserverUtil::readLastRecords(bsl::vector<Record> *records,
+                                            const char          *path,
+                                            int                  maxNumRecords)
+{
+    BSLS_ASSERT(records);
+    BSLS_ASSERT(path);
+    BSLS_ASSERT(0 <= maxNumRecords);
+
+    const Int64 fileSize = FilesystemUtil::getFileSize(path);
+    if (k_HEADER_SIZE > fileSize || INT_MAX < fileSize) {
+        return -1;                                                    // RETURN
+    }
+
+    FilesystemUtil::FileDescriptor descriptor = FilesystemUtil::open(
+                                                 path,
+                                                 FilesystemUtil::e_OPEN,
+                                                 FilesystemUtil::e_READ_ONLY);
+    if (FilesystemUtil::k_INVALID_FD == descriptor) {
+        return -2;                                                    // RETURN
+    }
+
+    void *address = 0;
+    if (0 != FilesystemUtil::map(descriptor,
+                                 &address,
+                                 0,
+                                 static_cast<int>(fileSize),
+                                 bdls::MemoryUtil::k_ACCESS_READ)) {
+        FilesystemUtil::close(descriptor);
+        return -3;                                                    // RETURN
+    }
+
+    char             *mapping = static_cast<char *>(address);
+    const FileHeader& header  = *reinterpret_cast<FileHeader *>(mapping);
+
+    if (!isValidHeader(header, fileSize)) {
+        FilesystemUtil::unmap(mapping, static_cast<int>(fileSize));
+        FilesystemUtil::close(descriptor);
+        return -4;                                                    // RETURN
+    }
+
+    const int numSlots      = header.d_numSlots;
+    const int slotSize      = header.d_slotSize;
+    const int recordVersion = header.d_recordVersion;
+
+    // Collect the stamps of the slots holding a complete record, and select
+    // the 'maxNumRecords' most recent ones.
+
+    typedef bsl::pair<Int64, int> StampAndIndex;
+
+    bsl::vector<StampAndIndex> stamps;
+    stamps.reserve(numSlots);
+    for (int i = 0; i < numSlots; ++i) {
+        const SlotHeader *slot  = slotAt(mapping, slotSize, i);
+        const Int64       stamp =
+                                AtomicOps::getInt64Acquire(&slot->d_sequence);
+        if (0 < stamp) {
+            stamps.push_back(StampAndIndex(stamp, i));
+        }
+    }
+    bsl::sort(stamps.begin(), stamps.end());
+    if (stamps.size() > static_cast<bsl::size_t>(maxNumRecords)) {
+        stamps.erase(stamps.begin(), stamps.end() - maxNumRecords);
+    }
+
+    // Decode each selected record from a copy of its slot, skipping any slot
+    // that was overwritten while it was being copied.
+
+    bsl::vector<char> payload(slotSize - k_SLOT_HEADER_SIZE);
+    for (bsl::size_t i = 0; i < stamps.size(); ++i) {
+        SlotHeader *slot   = slotAt(mapping, slotSize, stamps[i].second);
+        const int   length = AtomicOps::getIntAcquire(&slot->d_length);
+
+        if (0 > length || slotSize - k_SLOT_HEADER_SIZE < length) {
+            continue;
+        }
+        bsl::memcpy(&payload[0], slot + 1, length);
+
+        // The copy must complete before the stamp is reloaded, otherwise the
+        // check below could accept a copy torn by a concurrent writer.
+
+        loadFence();
+        if (stamps[i].first != AtomicOps::getInt64Acquire(&slot->d_sequence)) {
+            continue;
+        }
+
+        bslx::ByteInStream stream(&payload[0], length);
+        Record             record;
+        RecordBinaryUtil::bdexStreamIn(stream, &record, recordVersion);
+        if (stream.isValid() && stream.isEmpty()) {
+            records->push_back(record);
+        }
+    }
+
+    FilesystemUtil::unmap(mapping, static_cast<int>(fileSize));
+    FilesystemUtil::close(descriptor);
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,403 @@
+// ball_mappedfileobserver.h                                          -*-C++-*-
+#ifndef INCLUDED_BALL_MAPPEDFILEOBSERVER
+#define INCLUDED_BALL_MAPPEDFILEOBSERVER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an observer that logs to a memory-mapped circular file.
+//
+//@CLASSES:
+//  ball::MappedFileObserver: observer writing records to a mapped ring file
+//  ball::MappedFileObserverUtil: utilities to read a mapped ring file
+//
+//@SEE_ALSO: ball_recordbinaryutil, ball_fixedsizerecordbuffer, ball_observer
+//
+//@DESCRIPTION: This component provides a concrete implementation of the
+// 'ball::Observer' protocol, 'ball::MappedFileObserver', that publishes log
+// records into a fixed-size file mapped into memory, which is used as a
+// circular log.  Because the file is shared with the operating system's page
+// cache, the records it holds survive the abnormal termination of the
+// process: after a crash, the most recent records can be extracted from the
+// file using 'ball::MappedFileObserverUtil::readLastRecords'.  The following
+// inheritance hierarchy diagram shows the classes involved and their methods:
+//..
+//              ,------------------------.
+//             ( ball::MappedFileObserver )
+//              `------------------------'
+//                         |              ctor
+//                         |              close
+//                         |              open
+//                         |              sync
+//                         |              isOpen
+//                         |              numDiscarded
+//                         |              numSlots
+//                         |              slotSize
+//                         V
+//                  ,-------------.
+//                 ( ball::Observer )
+//                  `-------------'
+//                                        dtor
+//                                        publish
+//                                        releaseRecords
+//..
+// Publishing a record performs no system call, takes no lock, and allocates
+// no memory (except to truncate a record that does not fit in a slot, see
+// below): the record is encoded, in the binary form defined by
+// 'ball_recordbinaryutil', directly into the mapped memory.  This makes
+// 'ball::MappedFileObserver' suitable for capturing every record, including
+// those at 'TRACE' severity, at all times, as a replacement for the
+// heap-based buffering of 'ball::FixedSizeRecordBuffer' when the buffered
+// records must outlive the process.
+//
+///File Layout
+///-----------
+// The file opened by 'ball::MappedFileObserver::open' consists of a header
+// followed by a user-specified number of fixed-size *slots*, each of which
+// holds at most one record.  The header records, in particular, the number
+// and size of the slots, and a counter from which each publishing thread
+// atomically claims a *sequence* *number*.  The record having sequence number
+// 'n' is written to slot 'n % numSlots()', overwriting the oldest record in
+// the file once every slot is in use.  A slot is stamped with the sequence
+// number of the record it holds only after that record has been written in
+// its entirety, so a reader never mistakes a partially written slot (for
+// example, one being written when the process terminated) for a record.  All
+// integer fields of the file are stored in the native byte order of the
+// writer, so a file must be read on a platform having the same byte order.
+//
+// A record whose encoded form does not fit in a slot is truncated: its
+// user fields are dropped, and its message is shortened to fit.  A record is
+// discarded, rather than written, if its fixed fields other than the message
+// do not fit in a slot, or if the slot it was assigned is still being
+// written by a thread that claimed it one full cycle earlier.  The number of
+// discarded records is available from 'numDiscarded'.
+//
+// Note that 'open' truncates any existing file at the specified path, so the
+// records left behind by a crashed process must be read (or the file moved
+// aside) before the file is opened again.  Also note that the records written
+// to the file are preserved if the process terminates, but only 'sync'
+// guarantees that they are preserved if the operating system itself fails.
+//
+///Thread Safety
+///-------------
+// The 'publish' methods of 'ball::MappedFileObserver' are thread-safe and
+// lock-free, and can be called concurrently by multiple threads.  The 'open'
+// and 'close' methods are *not* thread-safe, and must not be called
+// concurrently with any other method of the same object.  The methods of
+// 'ball::MappedFileObserverUtil' can be called concurrently with the writing
+// of the file they read, even from another process; a record that is
+// overwritten while it is being read is skipped.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Crash-Survivable Trace Logging
+///- - - - - - - - - - - - - - - - - - - - -
+// In this example we capture every record published by an application into
+// a memory-mapped file, and read back the most recent records after the
+// application has terminated.
+//
+// First, we create the observer, and open a file holding the most recent
+// 4096 records, each encoded in at most 512 bytes:
+//..
+//  ball::MappedFileObserver mappedFileObserver;
+//
+//  int rc = mappedFileObserver.open("/var/tmp/myapp.ring", 4096, 512);
+//  assert(0 == rc);
+//..
+// Then, we install the observer in the logger manager, configured so that
+// records of every severity are published:
+//..
+//  ball::LoggerManagerConfiguration configuration;
+//  configuration.setDefaultThresholdLevelsIfValid(ball::Severity::e_OFF,
+//                                                 ball::Severity::e_TRACE,
+//                                                 ball::Severity::e_OFF,
+//                                                 ball::Severity::e_OFF);
+//  ball::LoggerManagerScopedGuard guard(&mappedFileObserver, configuration);
+//..
+// Next, records logged through the 'ball' macros are written to the file:
+//..
+//  BALL_LOG_SET_CATEGORY("EQUITY.NASD");
+//  BALL_LOG_TRACE << "order received" << BALL_LOG_END;
+//..
+// Finally, after the application has terminated (normally or not), the
+// last 100 records it published can be read from the file, oldest first:
+//..
+//  bsl::vector<ball::Record> records;
+//  rc = ball::MappedFileObserverUtil::readLastRecords(&records,
+//                                                     "/var/tmp/myapp.ring",
+//                                                     100);
+//  assert(0 == rc);
+//
+//  ball::RecordStringFormatter formatter("%d %s %c %m\n");
+//  for (bsl::size_t i = 0; i < records.size(); ++i) {
+//      formatter(bsl::cout, records[i]);
+//  }
+//..
+
+#ifndef INCLUDED_BALSCM_VERSION
+#include <balscm_version.h>
+#endif
+
+#ifndef INCLUDED_BALL_OBSERVER
+#include <ball_observer.h>
+#endif
+
+#ifndef INCLUDED_BALL_RECORD
+#include <ball_record.h>
+#endif
+
+#ifndef INCLUDED_BDLS_FILESYSTEMUTIL
+#include <bdls_filesystemutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_MEMORY
+#include <bsl_memory.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+namespace ball {
+
+class Context;
+
+                          // ========================
+                          // class MappedFileObserver
+                          // ========================
+
+class MappedFileObserver : public Observer {
+    // This class implements the 'Observer' protocol.  The 'publish' method of
+    // this class writes the log records that it receives into a memory-mapped
+    // file used as a circular log.  The 'publish' methods are thread-safe and
+    // lock-free; 'open' and 'close' are not thread-safe.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_SLOT_SIZE = 512,  // default size of a slot, in bytes
+
+        k_MIN_SLOT_SIZE     = 64    // minimum size of a slot, in bytes
+    };
+
+  private:
+    // DATA
+    bdls::FilesystemUtil::FileDescriptor
+                         d_descriptor;    // descriptor of the open file
+
+    char                *d_mapping_p;     // address of the mapped file, or 0
+                                          // if no file is open
+
+    int                  d_mappingSize;   // size of the mapped file
+
+    int                  d_numSlots;      // number of slots in the file
+
+    int                  d_slotSize;      // size of each slot, in bytes
+
+    bsls::AtomicInt64    d_numDiscarded;  // number of records discarded
+                                          // since the file was opened
+
+    bslma::Allocator    *d_allocator_p;   // memory allocator (held, not
+                                          // owned)
+
+  private:
+    // NOT IMPLEMENTED
+    MappedFileObserver(const MappedFileObserver&);
+    MappedFileObserver& operator=(const MappedFileObserver&);
+
+    // PRIVATE MANIPULATORS
+    int writeSlot(char *payload, const Record& record);
+        // Encode the specified 'record' into the specified 'payload' of a
+        // slot, truncating 'record' if it does not otherwise fit.  Return the
+        // number of bytes written on success, and a negative value if even
+        // the truncated 'record' does not fit.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(MappedFileObserver,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit MappedFileObserver(bslma::Allocator *basicAllocator = 0);
+        // Create a mapped file observer having no open file.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  Note that records published before a file is opened are
+        // ignored.
+
+    ~MappedFileObserver();
+        // Close the file of this mapped file observer, if any, and destroy
+        // this mapped file observer.
+
+    // MANIPULATORS
+    void close();
+        // Unmap and close the file of this mapped file observer.  This method
+        // has no effect if no file is open.  Note that the records written to
+        // the file are preserved.
+
+    int open(const char *path,
+             int         numSlots,
+             int         slotSize = k_DEFAULT_SLOT_SIZE);
+        // Create (or truncate) the file at the specified 'path', sized to hold
+        // the specified 'numSlots' records each encoded in at most the
+        // optionally specified 'slotSize' bytes (rounded up to a multiple of
+        // 8), map it into memory, and publish subsequent records to it.  Close
+        // the currently open file, if any, first.  Return 0 on success, and a
+        // non-zero value otherwise (in which case no file is open).  The
+        // behavior is undefined unless '0 < numSlots' and
+        // 'k_MIN_SLOT_SIZE <= slotSize'.
+
+    void publish(const Record& record, const Context& context);
+        // Process the specified log 'record' having the specified publishing
+        // 'context' by writing 'record' to the next slot of the file of this
+        // mapped file observer, if a file is open.
+
+    void publish(const bsl::shared_ptr<const Record>& record,
+                 const Context&                       context);
+        // Process the record referred to by the specified shared pointer
+        // 'record' having the specified publishing 'context' by writing the
+        // record to the next slot of the file of this mapped file observer,
+        // if a file is open.
+
+    void releaseRecords();
+        // Discard any shared reference to a 'Record' object that was supplied
+        // to the 'publish' method, and is held by this observer.  Note that
+        // this observer does not retain references to published records, so
+        // this method has no effect.
+
+    int sync(bool waitFlag);
+        // Schedule the contents of the file of this mapped file observer to be
+        // written to disk, and, if the specified 'waitFlag' is 'true', block
+        // until they have been written.  Return 0 on success, and a non-zero
+        // value otherwise (including if no file is open).
+
+    // ACCESSORS
+    bool isOpen() const;
+        // Return 'true' if this mapped file observer has an open file, and
+        // 'false' otherwise.
+
+    bsls::Types::Int64 numDiscarded() const;
+        // Return the number of records that were discarded, rather than
+        // written to the file, since the file was opened.
+
+    int numSlots() const;
+        // Return the number of slots in the file of this mapped file observer,
+        // or 0 if no file is open.
+
+    int slotSize() const;
+        // Return the size, in bytes, of each slot in the file of this mapped
+        // file observer, or 0 if no file is open.
+};
+
+                        // =============================
+                        // struct MappedFileObserverUtil
+                        // =============================
+
+struct MappedFileObserverUtil {
+    // This 'struct' provides a namespace for functions that read the files
+    // written by 'MappedFileObserver'.
+
+    // CLASS METHODS
+    static int readLastRecords(bsl::vector<Record> *records,
+                               const char          *path,
+                               int                  maxNumRecords);
+        // Append to the specified 'records', in the order in which they were
+        // published, at most the specified 'maxNumRecords' most recent
+        // complete records held in the file at the specified 'path' written
+        // by a 'MappedFileObserver'.  Return 0 on success, and a non-zero
+        // value if the file cannot be read or was not written by a
+        // 'MappedFileObserver' (in which case 'records' is unchanged).  The
+        // behavior is undefined unless '0 <= maxNumRecords'.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // class MappedFileObserver
+                          // ------------------------
+
+// MANIPULATORS
+inline
+void MappedFileObserver::publish(const bsl::shared_ptr<const Record>& record,
+                                 const Context&                       context)
+{
+    publish(*record, context);
+}
+
+inline
+void MappedFileObserver::releaseRecords()
+{
+}
+
+// ACCESSORS
+inline
+bool MappedFileObserver::isOpen() const
+{
+    return 0 != d_mapping_p;
+}
+
+inline
+bsls::Types::Int64 MappedFileObserver::numDiscarded() const
+{
+    return d_numDiscarded;
+}
+
+inline
+int MappedFileObserver::numSlots() const
+{
+    return d_numSlots;
+}
+
+inline
+int MappedFileObserver::slotSize() const
+{
+    return d_slotSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
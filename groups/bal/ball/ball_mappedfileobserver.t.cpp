@@ -0,0 +1,732 @@
+// ball_mappedfileobserver.t.cpp                                      -*-C++-*-
+#include <ball_mappedfileobserver.h>
+
+#include <ball_context.h>
+#include <ball_log.h>                         // for testing only
+#include <ball_loggermanager.h>               // for testing only
+#include <ball_loggermanagerconfiguration.h>  // for testing only
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_recordstringformatter.h>
+#include <ball_severity.h>
+
+#include <bdlf_bind.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bdlt_datetime.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_assert.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_platform.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_fstream.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                   TEST PLAN
+// ----------------------------------------------------------------------------
+//                                   Overview
+//                                   --------
+// The component under test is an observer that writes records into a
+// memory-mapped file used as a circular log, and a utility that reads the
+// most recent records back from such a file.  We verify that the records
+// read back are those most recently published, in order, that records too
+// large for a slot are truncated (or discarded), that concurrent publication
+// from many threads yields only complete records, and that the records
+// survive the abrupt termination of the publishing process.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] MappedFileObserver(bslma::Allocator *basicAllocator = 0);
+// [ 1] ~MappedFileObserver();
+//
+// MANIPULATORS
+// [ 1] void close();
+// [ 1] int open(const char *path, int numSlots, int slotSize);
+// [ 1] void publish(const Record& record, const Context& context);
+// [ 1] void publish(const shared_ptr<const Record>&, const Context&);
+// [ 1] void releaseRecords();
+// [ 1] int sync(bool waitFlag);
+//
+// ACCESSORS
+// [ 1] bool isOpen() const;
+// [ 3] bsls::Types::Int64 numDiscarded() const;
+// [ 1] int numSlots() const;
+// [ 1] int slotSize() const;
+//
+// CLASS METHODS
+// [ 2] int readLastRecords(vector<Record> *, const char *, int);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCURRENT PUBLICATION
+// [ 5] ABRUPT PROCESS TERMINATION
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef ball::MappedFileObserver     Obj;
+typedef ball::MappedFileObserverUtil Util;
+
+// ============================================================================
+//                                 TYPE TRAITS
+// ----------------------------------------------------------------------------
+
+BSLMF_ASSERT(true == bslma::UsesBslmaAllocator<Obj>::value);
+
+//=============================================================================
+//                      HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+bsl::shared_ptr<ball::Record> makeRecord(int               index,
+                                         bslma::Allocator *allocator,
+                                         int               threadId = 0)
+    // Return a shared pointer to a new record, allocated from the specified
+    // 'allocator', whose attributes are derived from the specified 'index'
+    // and the optionally specified 'threadId'.
+{
+    bsl::shared_ptr<ball::Record> record;
+    record.createInplace(allocator, allocator);
+
+    ball::RecordAttributes& fixedFields = record->fixedFields();
+    fixedFields.setTimestamp(
+               bdlt::Datetime(2017, 3, 21, 9, 30, 0, (index + 1000) % 1000));
+    fixedFields.setProcessID(4321);
+    fixedFields.setThreadID(threadId);
+    fixedFields.setSeverity(ball::Severity::e_TRACE);
+    fixedFields.setFileName("ball_mappedfileobserver.t.cpp");
+    fixedFields.setLineNumber(index);
+    fixedFields.setCategory("MAPPED.TEST");
+
+    bsl::ostringstream message;
+    message << "mapped record " << bsl::setw(12) << index;
+    fixedFields.setMessage(message.str().c_str());
+
+    record->userFields().appendInt64(index);
+    record->userFields().appendString("user field");
+
+    return record;
+}
+
+void publishRecords(Obj *observer, int threadId, int numRecords)
+    // Publish to the specified 'observer' the specified 'numRecords' records
+    // created by 'makeRecord' for the specified 'threadId'.
+{
+    bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+
+    for (int i = 0; i < numRecords; ++i) {
+        observer->publish(makeRecord(i, allocator, threadId),
+                          ball::Context());
+    }
+}
+
+class TempDirectoryGuard {
+    // This class creates a temporary directory on construction, and removes
+    // it, and its contents, on destruction.
+
+    // DATA
+    bsl::string d_path;  // path of the temporary directory
+
+  private:
+    // NOT IMPLEMENTED
+    TempDirectoryGuard(const TempDirectoryGuard&);
+    TempDirectoryGuard& operator=(const TempDirectoryGuard&);
+
+  public:
+    // CREATORS
+    TempDirectoryGuard()
+    {
+        int rc = bdls::FilesystemUtil::createTemporaryDirectory(
+                                                    &d_path,
+                                                    "ball_mappedfileobserver");
+        ASSERTV(rc, 0 == rc);
+    }
+
+    ~TempDirectoryGuard()
+    {
+        bdls::FilesystemUtil::remove(d_path, true);
+    }
+
+    // ACCESSORS
+    const bsl::string& path() const
+    {
+        return d_path;
+    }
+};
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, replace 'assert' with 'ASSERT', and
+        //:   replace the file name with a file in a temporary directory.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        TempDirectoryGuard tempDirectory;
+        const bsl::string  fileName = tempDirectory.path() + "/myapp.ring";
+
+        {
+            ball::MappedFileObserver mappedFileObserver;
+
+            int rc = mappedFileObserver.open(fileName.c_str(), 4096, 512);
+            ASSERT(0 == rc);
+
+            ball::LoggerManagerConfiguration configuration;
+            configuration.setDefaultThresholdLevelsIfValid(
+                                                      ball::Severity::e_OFF,
+                                                      ball::Severity::e_TRACE,
+                                                      ball::Severity::e_OFF,
+                                                      ball::Severity::e_OFF);
+            ball::LoggerManagerScopedGuard guard(&mappedFileObserver,
+                                                 configuration);
+
+            BALL_LOG_SET_CATEGORY("EQUITY.NASD");
+            BALL_LOG_TRACE << "order received" << BALL_LOG_END;
+        }
+
+        bsl::vector<ball::Record> records;
+        int rc = ball::MappedFileObserverUtil::readLastRecords(
+                                                             &records,
+                                                             fileName.c_str(),
+                                                             100);
+        ASSERT(0 == rc);
+
+        ball::RecordStringFormatter formatter("%s %c %m\n");
+        bsl::ostringstream          text;
+        for (bsl::size_t i = 0; i < records.size(); ++i) {
+            formatter(text, records[i]);
+        }
+        ASSERTV(text.str(),
+                "TRACE EQUITY.NASD order received\n" == text.str());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ABRUPT PROCESS TERMINATION
+        //
+        // Concerns:
+        //: 1 The records published by a process that terminates without
+        //:   closing the file (or running any destructor) can be read from
+        //:   the file.
+        //
+        // Plan:
+        //: 1 Fork a child process that opens a file, publishes records, and
+        //:   terminates immediately with '_exit'.  In the parent, read the
+        //:   most recent records from the file, and verify their values.
+        //:   (C-1)
+        //
+        // Testing:
+        //   ABRUPT PROCESS TERMINATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ABRUPT PROCESS TERMINATION" << endl
+                          << "==========================" << endl;
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+        enum { NUM_SLOTS = 32, NUM_RECORDS = 100 };
+
+        TempDirectoryGuard tempDirectory;
+        const bsl::string  fileName = tempDirectory.path() + "/ring";
+
+        cout.flush();
+        const pid_t child = fork();
+        ASSERT(-1 != child);
+
+        if (0 == child) {
+            Obj *mX = new Obj;
+            if (0 != mX->open(fileName.c_str(), NUM_SLOTS)) {
+                _exit(1);
+            }
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                mX->publish(makeRecord(i, bslma::Default::defaultAllocator()),
+                            ball::Context());
+            }
+            _exit(0);
+        }
+
+        int status = -1;
+        ASSERT(child == waitpid(child, &status, 0));
+        ASSERTV(status, WIFEXITED(status) && 0 == WEXITSTATUS(status));
+
+        bsl::vector<ball::Record> records;
+        ASSERT(0 == Util::readLastRecords(&records, fileName.c_str(), 10));
+        ASSERTV(records.size(), 10 == records.size());
+
+        for (int i = 0; i < static_cast<int>(records.size()); ++i) {
+            ASSERTV(i, *makeRecord(NUM_RECORDS - 10 + i, &ta) == records[i]);
+        }
+#else
+        if (verbose) cout << "\tSkipped on this platform." << endl;
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENT PUBLICATION
+        //
+        // Concerns:
+        //: 1 Records published concurrently by several threads are each
+        //:   either written in their entirety or discarded (and counted).
+        //:
+        //: 2 The records read back from each thread appear in the order in
+        //:   which that thread published them.
+        //
+        // Plan:
+        //: 1 Publish records from several threads to a file having few
+        //:   slots, so that the threads contend for the slots, then read
+        //:   back every record in the file, and verify that each matches the
+        //:   record published, and that the records of each thread are in
+        //:   increasing order.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENT PUBLICATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT PUBLICATION" << endl
+                          << "======================" << endl;
+
+        enum { NUM_THREADS = 4, NUM_RECORDS = 5000, NUM_SLOTS = 64 };
+
+        TempDirectoryGuard tempDirectory;
+        const bsl::string  fileName = tempDirectory.path() + "/ring";
+
+        Obj mX(&ta);  const Obj& X = mX;
+        ASSERT(0 == mX.open(fileName.c_str(), NUM_SLOTS));
+
+        bslmt::ThreadUtil::Handle handles[NUM_THREADS];
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                   &handles[i],
+                                   bdlf::BindUtil::bind(&publishRecords,
+                                                        &mX,
+                                                        i + 1,
+                                                        NUM_RECORDS + 0)));
+        }
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            bslmt::ThreadUtil::join(handles[i]);
+        }
+
+        if (veryVerbose) { P(X.numDiscarded()); }
+
+        bsl::vector<ball::Record> records;
+        ASSERT(0 == Util::readLastRecords(&records,
+                                          fileName.c_str(),
+                                          NUM_SLOTS));
+        ASSERTV(records.size(), NUM_SLOTS >= records.size());
+        ASSERTV(records.size(), 0 < records.size());
+
+        int lastIndex[NUM_THREADS + 1] = { -1, -1, -1, -1, -1 };
+        for (bsl::size_t i = 0; i < records.size(); ++i) {
+            const ball::RecordAttributes& fixedFields =
+                                                    records[i].fixedFields();
+            const int threadId = static_cast<int>(fixedFields.threadID());
+            const int index    = fixedFields.lineNumber();
+
+            ASSERTV(threadId, 1 <= threadId && threadId <= NUM_THREADS);
+            if (1 > threadId || NUM_THREADS < threadId) {
+                continue;
+            }
+            ASSERTV(i, *makeRecord(index, &ta, threadId) == records[i]);
+            ASSERTV(threadId, index, lastIndex[threadId],
+                    lastIndex[threadId] < index);
+            lastIndex[threadId] = index;
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING TRUNCATION
+        //
+        // Concerns:
+        //: 1 A record that does not fit in a slot is written with its user
+        //:   fields dropped and its message truncated to fit.
+        //:
+        //: 2 A record whose fixed fields, other than the message, do not fit
+        //:   in a slot is discarded, and counted by 'numDiscarded'.
+        //:
+        //: 3 Discarding a record leaves the slot it was assigned empty.
+        //
+        // Plan:
+        //: 1 Publish records having a long message, and a long category, to
+        //:   a file having small slots, and read the records back.  (C-1..3)
+        //
+        // Testing:
+        //   bsls::Types::Int64 numDiscarded() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING TRUNCATION" << endl
+                          << "==================" << endl;
+
+        TempDirectoryGuard tempDirectory;
+        const bsl::string  fileName = tempDirectory.path() + "/ring";
+
+        const bsl::string LONG_MESSAGE(1000, 'm');
+        const bsl::string LONG_CATEGORY(1000, 'c');
+
+        Obj mX(&ta);  const Obj& X = mX;
+        ASSERT(0 == mX.open(fileName.c_str(), 4, 256));
+        ASSERT(0 == X.numDiscarded());
+
+        bsl::shared_ptr<ball::Record> longMessage = makeRecord(0, &ta);
+        longMessage->fixedFields().setMessage(LONG_MESSAGE.c_str());
+        mX.publish(longMessage, ball::Context());
+        ASSERT(0 == X.numDiscarded());
+
+        bsl::shared_ptr<ball::Record> longCategory = makeRecord(1, &ta);
+        longCategory->fixedFields().setCategory(LONG_CATEGORY.c_str());
+        mX.publish(longCategory, ball::Context());
+        ASSERT(1 == X.numDiscarded());
+
+        mX.publish(makeRecord(2, &ta), ball::Context());
+        ASSERT(1 == X.numDiscarded());
+
+        bsl::vector<ball::Record> records;
+        ASSERT(0 == Util::readLastRecords(&records, fileName.c_str(), 4));
+        ASSERTV(records.size(), 2 == records.size());
+
+        if (2 == records.size()) {
+            const ball::RecordAttributes& fixedFields =
+                                                    records[0].fixedFields();
+            const bslstl::StringRef message = fixedFields.messageRef();
+
+            ASSERTV(message.length(), 0 < message.length());
+            ASSERTV(message.length(),
+                    LONG_MESSAGE.length() > message.length());
+            ASSERT(message == bslstl::StringRef(LONG_MESSAGE.data(),
+                                                message.length()));
+            ASSERT(0 == records[0].userFields().length());
+            ASSERT(longMessage->fixedFields().category() ==
+                                       bsl::string(fixedFields.category()));
+            ASSERT(0 == fixedFields.lineNumber());
+
+            ASSERT(*makeRecord(2, &ta) == records[1]);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'readLastRecords'
+        //
+        // Concerns:
+        //: 1 Once the file wraps around, 'readLastRecords' returns the most
+        //:   recent records, oldest first.
+        //:
+        //: 2 At most 'maxNumRecords' records are returned, and they are the
+        //:   most recent ones.
+        //:
+        //: 3 The records are appended to the supplied vector.
+        //:
+        //: 4 'readLastRecords' fails, leaving the vector unchanged, if the
+        //:   file does not exist or was not written by the observer.
+        //:
+        //: 5 Opening a file discards the records it holds.
+        //
+        // Plan:
+        //: 1 Publish more records than there are slots, and read back the
+        //:   file using a variety of limits.  (C-1..3)
+        //:
+        //: 2 Read a file that does not exist, an empty file, and a file
+        //:   containing text.  (C-4)
+        //:
+        //: 3 Reopen a file holding records, and read it back.  (C-5)
+        //
+        // Testing:
+        //   int readLastRecords(vector<Record> *, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'readLastRecords'" << endl
+                          << "=========================" << endl;
+
+        enum { NUM_SLOTS = 8, NUM_RECORDS = 20 };
+
+        TempDirectoryGuard tempDirectory;
+        const bsl::string  fileName = tempDirectory.path() + "/ring";
+
+        {
+            Obj mX(&ta);
+            ASSERT(0 == mX.open(fileName.c_str(), NUM_SLOTS));
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                mX.publish(makeRecord(i, &ta), ball::Context());
+            }
+        }
+
+        if (veryVerbose) cout << "\tWrap around and limits." << endl;
+        {
+            const int LIMITS[] = { 0, 1, 3, NUM_SLOTS - 1, NUM_SLOTS, 100 };
+            const int NUM_LIMITS = sizeof LIMITS / sizeof *LIMITS;
+
+            for (int i = 0; i < NUM_LIMITS; ++i) {
+                const int LIMIT    = LIMITS[i];
+                const int EXPECTED = LIMIT < NUM_SLOTS ? LIMIT : NUM_SLOTS;
+
+                bsl::vector<ball::Record> records(&ta);
+                records.push_back(*makeRecord(-1, &ta));
+
+                ASSERTV(LIMIT, 0 == Util::readLastRecords(&records,
+                                                          fileName.c_str(),
+                                                          LIMIT));
+                ASSERTV(LIMIT, records.size(),
+                        EXPECTED + 1 == static_cast<int>(records.size()));
+                ASSERTV(LIMIT, *makeRecord(-1, &ta) == records[0]);
+
+                for (int j = 1; j < static_cast<int>(records.size()); ++j) {
+                    const int INDEX = NUM_RECORDS - EXPECTED + j - 1;
+                    ASSERTV(LIMIT, j, *makeRecord(INDEX, &ta) == records[j]);
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "\tInvalid files." << endl;
+        {
+            const bsl::string missingName = tempDirectory.path() + "/missing";
+            const bsl::string emptyName   = tempDirectory.path() + "/empty";
+            const bsl::string textName    = tempDirectory.path() + "/text";
+
+            bsl::ofstream(emptyName.c_str());
+            {
+                bsl::ofstream text(textName.c_str());
+                for (int i = 0; i < 100; ++i) {
+                    text << "this is not a mapped log file\n";
+                }
+            }
+
+            const char *NAMES[] = { missingName.c_str(),
+                                    emptyName.c_str(),
+                                    textName.c_str() };
+            const int   NUM_NAMES = sizeof NAMES / sizeof *NAMES;
+
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                bsl::vector<ball::Record> records(&ta);
+                records.push_back(*makeRecord(-1, &ta));
+
+                ASSERTV(NAMES[i],
+                        0 != Util::readLastRecords(&records, NAMES[i], 10));
+                ASSERTV(NAMES[i], 1 == records.size());
+            }
+        }
+
+        if (veryVerbose) cout << "\tReopening a file." << endl;
+        {
+            Obj mX(&ta);
+            ASSERT(0 == mX.open(fileName.c_str(), NUM_SLOTS));
+
+            bsl::vector<ball::Record> records(&ta);
+            ASSERT(0 == Util::readLastRecords(&records, fileName.c_str(), 10));
+            ASSERTV(records.size(), records.empty());
+
+            mX.publish(makeRecord(100, &ta), ball::Context());
+
+            ASSERT(0 == Util::readLastRecords(&records, fileName.c_str(), 10));
+            ASSERTV(records.size(), 1 == records.size());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Publish records with no file open and with a file open, and read
+        //:   back the file.
+        //
+        // Testing:
+        //   MappedFileObserver(bslma::Allocator *basicAllocator = 0);
+        //   ~MappedFileObserver();
+        //   void close();
+        //   int open(const char *path, int numSlots, int slotSize);
+        //   void publish(const Record& record, const Context& context);
+        //   void publish(const shared_ptr<const Record>&, const Context&);
+        //   void releaseRecords();
+        //   int sync(bool waitFlag);
+        //   bool isOpen() const;
+        //   int numSlots() const;
+        //   int slotSize() const;
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        TempDirectoryGuard tempDirectory;
+        const bsl::string  fileName = tempDirectory.path() + "/ring";
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(false == X.isOpen());
+            ASSERT(0     == X.numSlots());
+            ASSERT(0     == X.slotSize());
+            ASSERT(0     == X.numDiscarded());
+            ASSERT(0     != mX.sync(false));
+
+            mX.publish(makeRecord(0, &ta), ball::Context());
+
+            ASSERT(0 == mX.open(fileName.c_str(), 16, 250));
+            ASSERT(true == X.isOpen());
+            ASSERT(16   == X.numSlots());
+            ASSERT(256  == X.slotSize());
+
+            mX.publish(makeRecord(1, &ta), ball::Context());
+            mX.publish(*makeRecord(2, &ta), ball::Context());
+            mX.releaseRecords();
+
+            ASSERT(0 == mX.sync(false));
+            ASSERT(0 == mX.sync(true));
+
+            mX.close();
+            ASSERT(false == X.isOpen());
+            ASSERT(0     == X.numSlots());
+
+            mX.publish(makeRecord(3, &ta), ball::Context());
+            mX.close();
+        }
+
+        bsl::vector<ball::Record> records;
+        ASSERT(0 == Util::readLastRecords(&records, fileName.c_str(), 100));
+        ASSERTV(records.size(), 2 == records.size());
+
+        for (int i = 0; i < static_cast<int>(records.size()); ++i) {
+            ASSERTV(i, *makeRecord(i + 1, &ta) == records[i]);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,125 @@
+// ball_recordbinaryutil.cpp                                          -*-C++-*-
+#include <ball_recordbinaryutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_recordbinaryutil_cpp,"$Id$ $CSID$")
+
+#include <bslx_byteinstream.h>
+#include <bslx_byteoutstream.h>
+#include <bslx_marshallingutil.h>
+
+#include <bsl_climits.h>
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+enum {
+    k_LENGTH_FIELD_SIZE = bslx::MarshallingUtil::k_SIZEOF_INT32
+                                            // size of the frame length prefix
+};
+
+}  // close unnamed namespace
+
+                        // -----------------------
+                        // struct RecordBinaryUtil
+                        // -----------------------
+
+// CLASS METHODS
+int RecordBinaryUtil::readRecord(Record            *record,
+                                 bsl::streambuf    *input,
+                                 bsl::vector<char> *buffer)
+{
+    BSLS_ASSERT(record);
+    BSLS_ASSERT(input);
+    BSLS_ASSERT(buffer);
+
+    char                  lengthField[k_LENGTH_FIELD_SIZE];
+    const bsl::streamsize numRead = input->sgetn(lengthField,
+                                                 k_LENGTH_FIELD_SIZE);
+    if (0 == numRead) {
+        return 1;                                                     // RETURN
+    }
+    if (k_LENGTH_FIELD_SIZE != numRead) {
+        return -1;                                                    // RETURN
+    }
+
+    unsigned int length;
+    bslx::MarshallingUtil::getUint32(&length, lengthField);
+
+    if (0 == length || static_cast<unsigned int>(INT_MAX) < length) {
+        return -2;                                                    // RETURN
+    }
+
+    buffer->resize(length);
+    if (static_cast<bsl::streamsize>(length) !=
+                                        input->sgetn(buffer->data(), length)) {
+        return -3;                                                    // RETURN
+    }
+
+    bslx::ByteInStream stream(buffer->data(), length);
+
+    int version = 0;
+    stream.getVersion(version);
+    bdexStreamIn(stream, record, version);
+
+    if (!stream) {
+        return -4;                                                    // RETURN
+    }
+    if (stream.cursor() != length) {
+        return -5;                                                    // RETURN
+    }
+    return 0;
+}
+
+int RecordBinaryUtil::writeRecord(bsl::streambuf      *output,
+                                  const Record&        record,
+                                  bslx::ByteOutStream *buffer)
+{
+    BSLS_ASSERT(output);
+    BSLS_ASSERT(buffer);
+
+    const int version = maxSupportedBdexVersion(
+                                               buffer->bdexVersionSelector());
+
+    buffer->reset();
+    buffer->putVersion(version);
+    bdexStreamOut(*buffer, record, version);
+
+    if (!*buffer
+     || static_cast<bsl::size_t>(INT_MAX) < buffer->length()) {
+        return -1;                                                    // RETURN
+    }
+
+    const int length = static_cast<int>(buffer->length());
+
+    char lengthField[k_LENGTH_FIELD_SIZE];
+    bslx::MarshallingUtil::putInt32(lengthField, length);
+
+    if (k_LENGTH_FIELD_SIZE != output->sputn(lengthField,
+                                             k_LENGTH_FIELD_SIZE)
+     || length != output->sputn(buffer->data(), length)) {
+        return -2;                                                    // RETURN
+    }
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
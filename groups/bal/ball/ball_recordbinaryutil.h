@@ -0,0 +1,451 @@
+// ball_recordbinaryutil.h                                            -*-C++-*-
+#ifndef INCLUDED_BALL_RECORDBINARYUTIL
+#define INCLUDED_BALL_RECORDBINARYUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a compact, versioned binary encoding of log records.
+//
+//@CLASSES:
+//  ball::RecordBinaryUtil: namespace for binary log record encoding
+//
+//@SEE_ALSO: ball_record, ball_binaryfileobserver, bslx_byteoutstream
+//
+//@DESCRIPTION: This component provides a namespace, 'ball::RecordBinaryUtil',
+// containing functions to encode a 'ball::Record' to, and decode it from, a
+// compact binary representation built on 'bslx' (BDEX) versioned streaming.
+// Writing a record in this form involves no text formatting: integers are
+// stored in fixed-width network byte order and strings are copied verbatim,
+// so encoding a record costs little more than copying its fields.
+//
+// Two levels of interface are provided.  'bdexStreamOut' and 'bdexStreamIn'
+// write and read the body of a record to and from any BDEX stream, in the
+// usual manner of BDEX-compliant types (the caller is responsible for
+// streaming the version).  'writeRecord' and 'readRecord' add a framing
+// layer suitable for files: each record is written to a 'bsl::streambuf' as a
+// length-prefixed frame that also carries the BDEX version of the record, so
+// that a sequence of records can be read back without any other context.
+//
+///Binary Format
+///-------------
+// A frame written by 'writeRecord' has the following layout (multi-byte
+// integers are in network byte order):
+//..
+//  +-----------------+---------+----------------------------------------+
+//  | length (4 bytes)| version |         record body ('length' - 1)     |
+//  +-----------------+---------+----------------------------------------+
+//..
+// where 'length' counts the bytes following the length field itself.  For
+// version 1, the record body consists of the following fields, in order:
+//..
+//  Field          BDEX Representation
+//  -------------  ----------------------------------------------------------
+//  timestamp      'bdlt::Datetime', version 1
+//  process id     32-bit integer
+//  thread id      64-bit unsigned integer
+//  severity       32-bit integer
+//  line number    32-bit integer
+//  file name      length, followed by the characters
+//  category       length, followed by the characters
+//  message        length, followed by the characters
+//  user fields    length, followed by one entry per user field value
+//..
+// where each user field value entry is an 8-bit 'ball::UserFieldType' code
+// followed by the value: nothing for 'e_VOID', a 64-bit integer for
+// 'e_INT64', a 64-bit floating point number for 'e_DOUBLE', a length followed
+// by the characters for 'e_STRING', and a 'bdlt::DatetimeTz' (version 1) for
+// 'e_DATETIMETZ'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing and Reading Records
+/// - - - - - - - - - - - - - - - - - - -
+// In this example we write a log record to a stream buffer in binary form and
+// read it back.
+//
+// First, we create a record and populate some of its attributes:
+//..
+//  ball::Record record;
+//  record.fixedFields().setTimestamp(bdlt::Datetime(2017, 3, 21, 9, 30));
+//  record.fixedFields().setCategory("EQUITY.NASD");
+//  record.fixedFields().setSeverity(ball::Severity::e_WARN);
+//  record.fixedFields().setMessage("price feed stalled");
+//  record.userFields().appendInt64(42);
+//..
+// Then, we write the record as a frame to a stream buffer.  The
+// 'bslx::ByteOutStream' supplies the scratch space used to encode the record;
+// reusing it across calls avoids a memory allocation per record:
+//..
+//  bdlsb::MemOutStreamBuf output;
+//  bslx::ByteOutStream    encodeBuffer(20150813);
+//
+//  int rc = ball::RecordBinaryUtil::writeRecord(&output,
+//                                               record,
+//                                               &encodeBuffer);
+//  assert(0 == rc);
+//..
+// Now, we read the frame back into another record:
+//..
+//  bdlsb::FixedMemInStreamBuf input(output.data(), output.length());
+//  bsl::vector<char>          decodeBuffer;
+//  ball::Record               result;
+//
+//  rc = ball::RecordBinaryUtil::readRecord(&result, &input, &decodeBuffer);
+//  assert(0      == rc);
+//  assert(record == result);
+//..
+// Finally, we observe that attempting to read past the last frame indicates
+// that the input is exhausted:
+//..
+//  rc = ball::RecordBinaryUtil::readRecord(&result, &input, &decodeBuffer);
+//  assert(1 == rc);
+//..
+
+#ifndef INCLUDED_BALSCM_VERSION
+#include <balscm_version.h>
+#endif
+
+#ifndef INCLUDED_BALL_RECORD
+#include <ball_record.h>
+#endif
+
+#ifndef INCLUDED_BALL_RECORDATTRIBUTES
+#include <ball_recordattributes.h>
+#endif
+
+#ifndef INCLUDED_BALL_USERFIELDS
+#include <ball_userfields.h>
+#endif
+
+#ifndef INCLUDED_BALL_USERFIELDTYPE
+#include <ball_userfieldtype.h>
+#endif
+
+#ifndef INCLUDED_BALL_USERFIELDVALUE
+#include <ball_userfieldvalue.h>
+#endif
+
+#ifndef INCLUDED_BDLT_DATETIME
+#include <bdlt_datetime.h>
+#endif
+
+#ifndef INCLUDED_BDLT_DATETIMETZ
+#include <bdlt_datetimetz.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STRINGREF
+#include <bslstl_stringref.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTRING
+#include <bsl_cstring.h>
+#endif
+
+#ifndef INCLUDED_BSL_STREAMBUF
+#include <bsl_streambuf.h>
+#endif
+
+#ifndef INCLUDED_BSL_STRING
+#include <bsl_string.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bslx { class ByteOutStream; }
+
+namespace ball {
+
+                        // =======================
+                        // struct RecordBinaryUtil
+                        // =======================
+
+struct RecordBinaryUtil {
+    // This 'struct' provides a namespace for functions that encode and decode
+    // 'ball::Record' objects in a compact binary form.  See the
+    // component-level documentation for a description of the format.
+
+    // CLASS METHODS
+    static int maxSupportedBdexVersion(int versionSelector);
+        // Return the maximum valid BDEX format version, as indicated by the
+        // specified 'versionSelector', to be passed to 'bdexStreamOut'.  Note
+        // that it is highly recommended that 'versionSelector' be formatted as
+        // "YYYYMMDD", a date representation.  Also note that 'versionSelector'
+        // should be a *compile*-time-chosen value that selects a format
+        // version supported by both externalizer and unexternalizer.  See the
+        // 'bslx' package-level documentation for more information on BDEX
+        // streaming of value-semantic types and containers.
+
+    template <class STREAM>
+    static STREAM& bdexStreamIn(STREAM& stream, Record *record, int version);
+        // Assign to the specified 'record' the value read from the specified
+        // input 'stream' using the specified 'version' format, and return a
+        // reference to 'stream'.  If 'stream' is initially invalid, this
+        // operation has no effect.  If 'version' is not supported, 'stream'
+        // is invalidated, but 'record' is unchanged.  If 'stream' becomes
+        // invalid during this operation, 'record' is valid, but its value is
+        // undefined.  Note that no version is read from 'stream'.  See the
+        // 'bslx' package-level documentation for more information on BDEX
+        // streaming of value-semantic types and containers.
+
+    template <class STREAM>
+    static STREAM& bdexStreamOut(STREAM&       stream,
+                                 const Record& record,
+                                 int           version);
+        // Write the value of the specified 'record', using the specified
+        // 'version' format, to the specified output 'stream', and return a
+        // reference to 'stream'.  If 'stream' is initially invalid, this
+        // operation has no effect.  If 'version' is not supported, 'stream'
+        // is invalidated, but otherwise unmodified.  Note that 'version' is
+        // not written to 'stream'.  See the 'bslx' package-level
+        // documentation for more information on BDEX streaming of
+        // value-semantic types and containers.
+
+    static int readRecord(Record            *record,
+                          bsl::streambuf    *input,
+                          bsl::vector<char> *buffer);
+        // Read the next frame from the specified 'input' stream buffer and
+        // load the record it contains into the specified 'record', using the
+        // specified 'buffer' as scratch space for the frame.  Return 0 on
+        // success, 1 if 'input' holds no more data, and a negative value if
+        // the frame is truncated, carries an unsupported version, or is
+        // otherwise malformed.  On failure, 'record' is valid, but its value
+        // is unspecified, and the position of 'input' is unspecified.
+
+    static int writeRecord(bsl::streambuf      *output,
+                           const Record&        record,
+                           bslx::ByteOutStream *buffer);
+        // Write the specified 'record' as a single frame to the specified
+        // 'output' stream buffer, using the specified 'buffer' (which is
+        // reset by this call) to encode the record.  Return 0 on success, and
+        // a non-zero value if 'output' did not accept the entire frame.  The
+        // frame is encoded using the version returned by
+        // 'maxSupportedBdexVersion(buffer->bdexVersionSelector())'.  Note that
+        // reusing 'buffer' across calls avoids allocating memory once it has
+        // grown to accommodate the largest record written.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                        // -----------------------
+                        // struct RecordBinaryUtil
+                        // -----------------------
+
+// CLASS METHODS
+inline
+int RecordBinaryUtil::maxSupportedBdexVersion(int /* versionSelector */)
+{
+    return 1;
+}
+
+template <class STREAM>
+STREAM& RecordBinaryUtil::bdexStreamIn(STREAM& stream,
+                                       Record *record,
+                                       int     version)
+{
+    BSLS_ASSERT_SAFE(record);
+
+    if (!stream) {
+        return stream;                                                // RETURN
+    }
+
+    switch (version) {  // switch on the schema version
+      case 1: {
+        bdlt::Datetime      timestamp;
+        int                 processID;
+        bsls::Types::Uint64 threadID;
+        int                 severity;
+        int                 lineNumber;
+        bsl::string         fileName;
+        bsl::string         category;
+        bsl::string         message;
+
+        timestamp.bdexStreamIn(stream, 1);
+        stream.getInt32(processID);
+        stream.getUint64(threadID);
+        stream.getInt32(severity);
+        stream.getInt32(lineNumber);
+        stream.getString(fileName);
+        stream.getString(category);
+        stream.getString(message);
+
+        int numUserFields = 0;
+        stream.getLength(numUserFields);
+
+        if (!stream) {
+            return stream;                                            // RETURN
+        }
+
+        RecordAttributes& fixedFields = record->fixedFields();
+        fixedFields.setTimestamp(timestamp);
+        fixedFields.setProcessID(processID);
+        fixedFields.setThreadID(threadID);
+        fixedFields.setSeverity(severity);
+        fixedFields.setLineNumber(lineNumber);
+        fixedFields.setFileName(fileName.c_str());
+        fixedFields.setCategory(category.c_str());
+        fixedFields.clearMessage();
+        fixedFields.messageStreamBuf().sputn(
+                               message.data(),
+                               static_cast<bsl::streamsize>(message.length()));
+
+        UserFields& userFields = record->userFields();
+        userFields.removeAll();
+
+        for (int i = 0; i < numUserFields && stream; ++i) {
+            char type;
+            stream.getInt8(type);
+            if (!stream) {
+                break;
+            }
+
+            switch (type) {
+              case UserFieldType::e_VOID: {
+                userFields.appendNull();
+              } break;
+              case UserFieldType::e_INT64: {
+                bsls::Types::Int64 value;
+                stream.getInt64(value);
+                userFields.appendInt64(value);
+              } break;
+              case UserFieldType::e_DOUBLE: {
+                double value;
+                stream.getFloat64(value);
+                userFields.appendDouble(value);
+              } break;
+              case UserFieldType::e_STRING: {
+                bsl::string value;
+                stream.getString(value);
+                userFields.appendString(value);
+              } break;
+              case UserFieldType::e_DATETIMETZ: {
+                bdlt::DatetimeTz value;
+                value.bdexStreamIn(stream, 1);
+                userFields.appendDatetimeTz(value);
+              } break;
+              default: {
+                stream.invalidate();  // unrecognized user field type
+              }
+            }
+        }
+      } break;
+      default: {
+        stream.invalidate();  // unrecognized version number
+      }
+    }
+    return stream;
+}
+
+template <class STREAM>
+STREAM& RecordBinaryUtil::bdexStreamOut(STREAM&       stream,
+                                        const Record& record,
+                                        int           version)
+{
+    if (!stream) {
+        return stream;                                                // RETURN
+    }
+
+    switch (version) {  // switch on the schema version
+      case 1: {
+        const RecordAttributes& fixedFields = record.fixedFields();
+
+        fixedFields.timestamp().bdexStreamOut(stream, 1);
+        stream.putInt32(fixedFields.processID());
+        stream.putUint64(fixedFields.threadID());
+        stream.putInt32(fixedFields.severity());
+        stream.putInt32(fixedFields.lineNumber());
+
+        const char *fileName       = fixedFields.fileName();
+        const int   fileNameLength = static_cast<int>(bsl::strlen(fileName));
+        stream.putLength(fileNameLength);
+        if (0 != fileNameLength) {
+            stream.putArrayInt8(fileName, fileNameLength);
+        }
+
+        const char *category       = fixedFields.category();
+        const int   categoryLength = static_cast<int>(bsl::strlen(category));
+        stream.putLength(categoryLength);
+        if (0 != categoryLength) {
+            stream.putArrayInt8(category, categoryLength);
+        }
+
+        const bslstl::StringRef message       = fixedFields.messageRef();
+        const int               messageLength =
+                                          static_cast<int>(message.length());
+        stream.putLength(messageLength);
+        if (0 != messageLength) {
+            stream.putArrayInt8(message.data(), messageLength);
+        }
+
+        const UserFields& userFields = record.userFields();
+        stream.putLength(userFields.length());
+
+        for (int i = 0; i < userFields.length(); ++i) {
+            const UserFieldValue& value = userFields[i];
+
+            stream.putInt8(value.type());
+
+            switch (value.type()) {
+              case UserFieldType::e_VOID: {
+              } break;
+              case UserFieldType::e_INT64: {
+                stream.putInt64(value.theInt64());
+              } break;
+              case UserFieldType::e_DOUBLE: {
+                stream.putFloat64(value.theDouble());
+              } break;
+              case UserFieldType::e_STRING: {
+                stream.putString(value.theString());
+              } break;
+              case UserFieldType::e_DATETIMETZ: {
+                value.theDatetimeTz().bdexStreamOut(stream, 1);
+              } break;
+            }
+        }
+      } break;
+      default: {
+        stream.invalidate();  // unrecognized version number
+      }
+    }
+    return stream;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
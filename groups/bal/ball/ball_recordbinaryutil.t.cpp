@@ -0,0 +1,675 @@
+// ball_recordbinaryutil.t.cpp                                        -*-C++-*-
+#include <ball_recordbinaryutil.h>
+
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+#include <ball_userfields.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+#include <bdlsb_fixedmemoutstreambuf.h>
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslx_byteinstream.h>
+#include <bslx_byteoutstream.h>
+
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                   TEST PLAN
+// ----------------------------------------------------------------------------
+//                                   Overview
+//                                   --------
+// The component under test provides a utility for encoding 'ball::Record'
+// objects in binary form.  We verify that 'bdexStreamOut' and 'bdexStreamIn'
+// round-trip every attribute of a record, including each type of user field
+// value, and that unsupported versions are rejected.  We then verify that
+// 'writeRecord' and 'readRecord' frame a sequence of records so that it can be
+// read back, that the end of the input is distinguished from a malformed or
+// truncated frame, and that the encode buffer is reused without allocation.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int maxSupportedBdexVersion(int versionSelector);
+// [ 2] STREAM& bdexStreamIn(STREAM& stream, Record *record, int version);
+// [ 2] STREAM& bdexStreamOut(STREAM& stream, const Record& rec, int version);
+// [ 3] int readRecord(Record *, bsl::streambuf *, bsl::vector<char> *);
+// [ 3] int writeRecord(bsl::streambuf *, const Record&, ByteOutStream *);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef ball::RecordBinaryUtil Util;
+
+const int VERSION_SELECTOR = 20170321;
+
+//=============================================================================
+//                      HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+void populateRecord(ball::Record *record, int index)
+    // Load into the specified 'record' a value that is unique to the specified
+    // 'index', and that exercises a different combination of attributes and
+    // user field values for each 'index' in the range '[0 .. 7]'.
+{
+    ball::RecordAttributes& fixedFields = record->fixedFields();
+
+    fixedFields.setTimestamp(bdlt::Datetime(2017,
+                                            1 + index % 12,
+                                            1 + index % 28,
+                                            index % 24,
+                                            index % 60,
+                                            index % 60,
+                                            index % 1000));
+    fixedFields.setProcessID(1000 + index);
+    fixedFields.setThreadID(0xFFFFFFFF00000000ULL + index);
+    fixedFields.setSeverity(ball::Severity::e_TRACE - index % 6 * 32);
+    fixedFields.setLineNumber(index * 17);
+    fixedFields.setFileName(0 == index % 3 ? "" : "ball_somefile.cpp");
+    fixedFields.setCategory(0 == index % 4 ? "" : "SOME.CATEGORY");
+
+    bsl::string message;
+    switch (index % 4) {
+      case 0: {
+      } break;
+      case 1: {
+        message = "a short message";
+      } break;
+      case 2: {
+        message.assign(300, 'x');  // longer than a one-byte length
+      } break;
+      case 3: {
+        message.assign("embedded\0null", 13);
+      } break;
+    }
+    fixedFields.clearMessage();
+    fixedFields.messageStreamBuf().sputn(message.data(), message.length());
+
+    ball::UserFields& userFields = record->userFields();
+    userFields.removeAll();
+    for (int i = 0; i < index; ++i) {
+        switch (i % 5) {
+          case 0: userFields.appendInt64(-1LL - i * 1000000000000LL); break;
+          case 1: userFields.appendDouble(0.5 + i);                   break;
+          case 2: userFields.appendString("user field");              break;
+          case 3: userFields.appendDatetimeTz(
+                      bdlt::DatetimeTz(bdlt::Datetime(2001, 2, 3, 4, 5, 6),
+                                       -300));                        break;
+          case 4: userFields.appendNull();                            break;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Writing and Reading Records
+/// - - - - - - - - - - - - - - - - - - -
+// In this example we write a log record to a stream buffer in binary form and
+// read it back.
+//
+// First, we create a record and populate some of its attributes:
+//..
+    ball::Record record;
+    record.fixedFields().setTimestamp(bdlt::Datetime(2017, 3, 21, 9, 30));
+    record.fixedFields().setCategory("EQUITY.NASD");
+    record.fixedFields().setSeverity(ball::Severity::e_WARN);
+    record.fixedFields().setMessage("price feed stalled");
+    record.userFields().appendInt64(42);
+//..
+// Then, we write the record as a frame to a stream buffer.  The
+// 'bslx::ByteOutStream' supplies the scratch space used to encode the record;
+// reusing it across calls avoids a memory allocation per record:
+//..
+    bdlsb::MemOutStreamBuf output;
+    bslx::ByteOutStream    encodeBuffer(20150813);
+
+    int rc = ball::RecordBinaryUtil::writeRecord(&output,
+                                                 record,
+                                                 &encodeBuffer);
+    ASSERT(0 == rc);
+//..
+// Now, we read the frame back into another record:
+//..
+    bdlsb::FixedMemInStreamBuf input(output.data(), output.length());
+    bsl::vector<char>          decodeBuffer;
+    ball::Record               result;
+
+    rc = ball::RecordBinaryUtil::readRecord(&result, &input, &decodeBuffer);
+    ASSERT(0      == rc);
+    ASSERT(record == result);
+//..
+// Finally, we observe that attempting to read past the last frame indicates
+// that the input is exhausted:
+//..
+    rc = ball::RecordBinaryUtil::readRecord(&result, &input, &decodeBuffer);
+    ASSERT(1 == rc);
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'writeRecord' AND 'readRecord'
+        //
+        // Concerns:
+        //: 1 A sequence of records written by 'writeRecord' is read back, in
+        //:   order and with the same values, by 'readRecord'.
+        //:
+        //: 2 Each frame starts with the length of the remainder of the frame,
+        //:   followed by the version returned by 'maxSupportedBdexVersion'.
+        //:
+        //: 3 'readRecord' returns 1 when no data remains, and a negative
+        //:   value for a frame that is truncated anywhere, has a zero length,
+        //:   carries an unsupported version, or holds trailing bytes.
+        //:
+        //: 4 'writeRecord' returns a non-zero value if the stream buffer does
+        //:   not accept the whole frame.
+        //:
+        //: 5 Once the encode buffer has grown to accommodate a record,
+        //:   'writeRecord' does not allocate memory to write records of the
+        //:   same size.
+        //
+        // Plan:
+        //: 1 Write a sequence of distinct records to a stream buffer and read
+        //:   them back, comparing each record read with the original, and
+        //:   verifying that reading past the last frame returns 1.  (C-1)
+        //:
+        //: 2 Inspect the bytes of a frame.  (C-2)
+        //:
+        //: 3 Read every proper prefix of a frame, and frames modified to have
+        //:   a zero length, an unsupported version, and trailing bytes, and
+        //:   verify the status returned.  (C-3)
+        //:
+        //: 4 Write a frame to fixed-size stream buffers that are too small to
+        //:   hold it.  (C-4)
+        //:
+        //: 5 Use a test allocator for the encode buffer and verify that no
+        //:   memory is allocated when writing a record a second time.  (C-5)
+        //
+        // Testing:
+        //   int readRecord(Record *, bsl::streambuf *, bsl::vector<char> *);
+        //   int writeRecord(bsl::streambuf *, const Record&, ByteOutStream *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'writeRecord' AND 'readRecord'" << endl
+                          << "======================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        enum { NUM_RECORDS = 8 };
+
+        if (veryVerbose) cout << "\tRound trip a sequence of records." << endl;
+        {
+            bdlsb::MemOutStreamBuf output(&ta);
+            bslx::ByteOutStream    encodeBuffer(VERSION_SELECTOR, &ta);
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                ball::Record record(&ta);
+                populateRecord(&record, i);
+                ASSERTV(i, 0 == Util::writeRecord(&output,
+                                                  record,
+                                                  &encodeBuffer));
+            }
+
+            bdlsb::FixedMemInStreamBuf input(output.data(), output.length());
+            bsl::vector<char>          decodeBuffer(&ta);
+            ball::Record               result(&ta);
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                ball::Record expected(&ta);
+                populateRecord(&expected, i);
+
+                ASSERTV(i, 0 == Util::readRecord(&result,
+                                                 &input,
+                                                 &decodeBuffer));
+                ASSERTV(i, expected == result);
+            }
+            ASSERT(1 == Util::readRecord(&result, &input, &decodeBuffer));
+            ASSERT(1 == Util::readRecord(&result, &input, &decodeBuffer));
+        }
+
+        if (veryVerbose) cout << "\tFrame layout." << endl;
+        {
+            ball::Record record(&ta);
+            populateRecord(&record, 1);
+
+            bdlsb::MemOutStreamBuf output(&ta);
+            bslx::ByteOutStream    encodeBuffer(VERSION_SELECTOR, &ta);
+            ASSERT(0 == Util::writeRecord(&output, record, &encodeBuffer));
+
+            const unsigned char *frame =
+                        reinterpret_cast<const unsigned char *>(output.data());
+            const bsl::size_t    length = (bsl::size_t(frame[0]) << 24)
+                                        | (bsl::size_t(frame[1]) << 16)
+                                        | (bsl::size_t(frame[2]) <<  8)
+                                        |  bsl::size_t(frame[3]);
+
+            ASSERTV(length, output.length(), length + 4 == output.length());
+            ASSERTV(int(frame[4]),
+                    Util::maxSupportedBdexVersion(VERSION_SELECTOR) ==
+                                                                frame[4]);
+        }
+
+        if (veryVerbose) cout << "\tMalformed input." << endl;
+        {
+            ball::Record record(&ta);
+            populateRecord(&record, 5);
+
+            bdlsb::MemOutStreamBuf output(&ta);
+            bslx::ByteOutStream    encodeBuffer(VERSION_SELECTOR, &ta);
+            ASSERT(0 == Util::writeRecord(&output, record, &encodeBuffer));
+
+            const bsl::string FRAME(output.data(), output.length(), &ta);
+
+            bsl::vector<char> decodeBuffer(&ta);
+            ball::Record      result(&ta);
+
+            for (bsl::size_t len = 1; len < FRAME.length(); ++len) {
+                bdlsb::FixedMemInStreamBuf input(FRAME.data(), len);
+                ASSERTV(len, 0 > Util::readRecord(&result,
+                                                  &input,
+                                                  &decodeBuffer));
+            }
+
+            {
+                bsl::string frame(FRAME, &ta);
+                frame[0] = frame[1] = frame[2] = frame[3] = 0;
+
+                bdlsb::FixedMemInStreamBuf input(frame.data(), frame.length());
+                ASSERT(0 > Util::readRecord(&result, &input, &decodeBuffer));
+            }
+
+            {
+                bsl::string frame(FRAME, &ta);
+                frame[4] = 99;
+
+                bdlsb::FixedMemInStreamBuf input(frame.data(), frame.length());
+                ASSERT(0 > Util::readRecord(&result, &input, &decodeBuffer));
+            }
+
+            {
+                // Claim one more byte than the record body occupies.
+
+                bsl::string frame(FRAME, &ta);
+                frame.push_back('\0');
+                ++frame[3];
+
+                bdlsb::FixedMemInStreamBuf input(frame.data(), frame.length());
+                ASSERT(0 > Util::readRecord(&result, &input, &decodeBuffer));
+            }
+
+            {
+                bdlsb::FixedMemInStreamBuf input(FRAME.data(),
+                                                 FRAME.length());
+                ASSERT(0 == Util::readRecord(&result, &input, &decodeBuffer));
+                ASSERT(record == result);
+            }
+        }
+
+        if (veryVerbose) cout << "\tOutput failure." << endl;
+        {
+            ball::Record record(&ta);
+            populateRecord(&record, 2);
+
+            bslx::ByteOutStream encodeBuffer(VERSION_SELECTOR, &ta);
+
+            char buffer[1024];
+
+            bdlsb::FixedMemOutStreamBuf tiny(buffer, 2);
+            ASSERT(0 != Util::writeRecord(&tiny, record, &encodeBuffer));
+
+            bdlsb::FixedMemOutStreamBuf small(buffer, 64);
+            ASSERT(0 != Util::writeRecord(&small, record, &encodeBuffer));
+
+            bdlsb::FixedMemOutStreamBuf large(buffer, sizeof buffer);
+            ASSERT(0 == Util::writeRecord(&large, record, &encodeBuffer));
+        }
+
+        if (veryVerbose) cout << "\tEncode buffer reuse." << endl;
+        {
+            ball::Record record(&ta);
+            populateRecord(&record, 7);
+
+            char                        buffer[4096];
+            bdlsb::FixedMemOutStreamBuf output(buffer, sizeof buffer);
+
+            bslma::TestAllocator encodeAllocator("encode",
+                                                 veryVeryVeryVerbose);
+            bslx::ByteOutStream  encodeBuffer(VERSION_SELECTOR,
+                                              &encodeAllocator);
+
+            ASSERT(0 == Util::writeRecord(&output, record, &encodeBuffer));
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS =
+                                            encodeAllocator.numAllocations();
+
+            for (int i = 0; i < 4; ++i) {
+                ASSERT(0 == Util::writeRecord(&output, record, &encodeBuffer));
+            }
+            ASSERTV(NUM_ALLOCATIONS, encodeAllocator.numAllocations(),
+                    NUM_ALLOCATIONS == encodeAllocator.numAllocations());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING BDEX STREAMING
+        //
+        // Concerns:
+        //: 1 'maxSupportedBdexVersion' returns 1.
+        //:
+        //: 2 'bdexStreamIn' restores every attribute written by
+        //:   'bdexStreamOut', including user field values of each type,
+        //:   empty strings, long strings, and messages containing null
+        //:   characters.
+        //:
+        //: 3 'bdexStreamIn' replaces, rather than appends to, the user
+        //:   fields of the target record.
+        //:
+        //: 4 An unsupported version invalidates the stream.
+        //:
+        //: 5 Streaming into or out of an invalid stream has no effect.
+        //:
+        //: 6 Truncated input invalidates the stream.
+        //
+        // Plan:
+        //: 1 For each record produced by 'populateRecord', stream it out and
+        //:   back in to a record that initially holds a different value, and
+        //:   compare the result with the original.  (C-1..3)
+        //:
+        //: 2 Stream out and in using version 0 and 2 and verify that the
+        //:   streams are invalidated.  (C-4)
+        //:
+        //: 3 Invalidate streams before streaming and verify that neither the
+        //:   stream nor the record is changed.  (C-5)
+        //:
+        //: 4 Stream in every proper prefix of a streamed record.  (C-6)
+        //
+        // Testing:
+        //   int maxSupportedBdexVersion(int versionSelector);
+        //   STREAM& bdexStreamIn(STREAM& stream, Record *record, int version);
+        //   STREAM& bdexStreamOut(STREAM& stream, const Record& rec, int v);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BDEX STREAMING" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        ASSERT(1 == Util::maxSupportedBdexVersion(0));
+        ASSERT(1 == Util::maxSupportedBdexVersion(VERSION_SELECTOR));
+
+        const int VERSION = Util::maxSupportedBdexVersion(VERSION_SELECTOR);
+
+        if (veryVerbose) cout << "\tRound trip." << endl;
+
+        for (int i = 0; i < 8; ++i) {
+            ball::Record record(&ta);
+            populateRecord(&record, i);
+
+            bslx::ByteOutStream out(VERSION_SELECTOR, &ta);
+            Util::bdexStreamOut(out, record, VERSION);
+            ASSERTV(i, out);
+
+            ball::Record result(&ta);
+            populateRecord(&result, (i + 3) % 8);
+
+            bslx::ByteInStream in(out.data(), out.length());
+            Util::bdexStreamIn(in, &result, VERSION);
+            ASSERTV(i, in);
+            ASSERTV(i, in.isEmpty());
+            ASSERTV(i, record == result);
+        }
+
+        if (veryVerbose) cout << "\tUnsupported versions." << endl;
+        {
+            ball::Record record(&ta);
+            populateRecord(&record, 4);
+
+            const int BAD_VERSIONS[] = { 0, 2, 255 };
+            const int NUM_BAD_VERSIONS = sizeof BAD_VERSIONS
+                                       / sizeof *BAD_VERSIONS;
+
+            for (int i = 0; i < NUM_BAD_VERSIONS; ++i) {
+                const int BAD = BAD_VERSIONS[i];
+
+                bslx::ByteOutStream out(VERSION_SELECTOR, &ta);
+                Util::bdexStreamOut(out, record, BAD);
+                ASSERTV(BAD, !out);
+
+                bslx::ByteOutStream good(VERSION_SELECTOR, &ta);
+                Util::bdexStreamOut(good, record, VERSION);
+
+                ball::Record result(&ta);
+                populateRecord(&result, 1);
+                const ball::Record ORIGINAL(result, &ta);
+
+                bslx::ByteInStream in(good.data(), good.length());
+                Util::bdexStreamIn(in, &result, BAD);
+                ASSERTV(BAD, !in);
+                ASSERTV(BAD, ORIGINAL == result);
+            }
+        }
+
+        if (veryVerbose) cout << "\tInvalid streams." << endl;
+        {
+            ball::Record record(&ta);
+            populateRecord(&record, 6);
+
+            bslx::ByteOutStream out(VERSION_SELECTOR, &ta);
+            out.invalidate();
+            Util::bdexStreamOut(out, record, VERSION);
+            ASSERT(!out);
+            ASSERT(0 == out.length());
+
+            bslx::ByteOutStream good(VERSION_SELECTOR, &ta);
+            Util::bdexStreamOut(good, record, VERSION);
+
+            ball::Record result(&ta);
+            populateRecord(&result, 2);
+            const ball::Record ORIGINAL(result, &ta);
+
+            bslx::ByteInStream in(good.data(), good.length());
+            in.invalidate();
+            Util::bdexStreamIn(in, &result, VERSION);
+            ASSERT(!in);
+            ASSERT(ORIGINAL == result);
+        }
+
+        if (veryVerbose) cout << "\tTruncated input." << endl;
+        {
+            ball::Record record(&ta);
+            populateRecord(&record, 7);
+
+            bslx::ByteOutStream out(VERSION_SELECTOR, &ta);
+            Util::bdexStreamOut(out, record, VERSION);
+
+            for (bsl::size_t len = 0; len < out.length(); ++len) {
+                ball::Record result(&ta);
+
+                bslx::ByteInStream in(out.data(), len);
+                Util::bdexStreamIn(in, &result, VERSION);
+                ASSERTV(len, !in);
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write a record to a stream buffer and read it back.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        ball::Record record(&ta);
+        populateRecord(&record, 3);
+
+        bdlsb::MemOutStreamBuf output(&ta);
+        bslx::ByteOutStream    encodeBuffer(VERSION_SELECTOR, &ta);
+        ASSERT(0 == Util::writeRecord(&output, record, &encodeBuffer));
+
+        bdlsb::FixedMemInStreamBuf input(output.data(), output.length());
+        bsl::vector<char>          decodeBuffer(&ta);
+        ball::Record               result(&ta);
+
+        ASSERT(record != result);
+        ASSERT(0 == Util::readRecord(&result, &input, &decodeBuffer));
+        ASSERT(record == result);
+        ASSERT(1 == Util::readRecord(&result, &input, &decodeBuffer));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -14,6 +14,25 @@
 // significant performance overhead.  For this reason, the 'operator()' method
 // is implemented by writing the formatted string to a buffer before inserting
 // to a stream.
+//
+// The format specification is parsed once (by 'compileFormat') into a vector
+// of 'RecordStringFormatter_Op' objects.  Literal text (with '\'-escapes
+// already interpolated, and with undefined '%'-conversions copied verbatim) is
+// accumulated into 'd_literals', and consecutive literal characters are
+// represented by a single 'e_LITERAL' operation.  Formatting a record walks
+// the operation vector, writing into a caller-supplied buffer via the
+// 'Writer' helper, which keeps counting the length of the output after the
+// buffer is exhausted so that 'operator()' can retry with a larger buffer.
+//
+// The local time offset cache, 'd_localTimeOffsetCache', packs the UTC minute
+// (counted from 0001/01/01) of the timestamp for which the offset was obtained
+// into the upper bits of a 64-bit value, and the offset in seconds (biased to
+// be non-negative) into the lower 'k_OFFSET_BITS' bits.  A single atomic
+// 64-bit value is used so that a formatter can be shared by multiple threads
+// without locking; a race merely results in an extra call to the callback.
+// Note that, since the cache is keyed on the minute of the timestamp and not
+// on the time the record is formatted, records published out of order still
+// observe the correct offset.
 
 #include <ball_recordstringformatter.h>
 
@@ -26,74 +45,254 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 #include <ball_userfieldvalue.h>
 #include <ball_userfields.h>
 
-#include <bdlma_bufferedsequentialallocator.h>
-
+#include <bdlt_date.h>
 #include <bdlt_datetime.h>
-#include <bdlt_currenttime.h>
 #include <bdlt_localtimeoffset.h>
-#include <bdlb_print.h>
 
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
 #include <bslstl_stringref.h>
 
 #include <bsl_climits.h>   // for 'INT_MAX'
-#include <bsl_cstring.h>   // for 'bsl::strcmp'
-#include <bsl_c_stdlib.h>
-#include <bsl_c_stdio.h>   // for 'snprintf'
+#include <bsl_cstring.h>   // for 'bsl::strcmp', 'bsl::memcpy'
 
-#include <bsl_iomanip.h>
 #include <bsl_ostream.h>
 #include <bsl_sstream.h>
 
+namespace BloombergLP {
+
 namespace {
 
 const char *const DEFAULT_FORMAT_SPEC = "\n%d %p:%t %s %f:%l %c %m %u\n";
 
-}  // close unnamed namespace
+const int k_BUFFER_SIZE = 512;  // size of the stack buffer used by
+                                // 'operator()'
+
+const int k_OFFSET_BITS = 24;   // number of bits of the local time offset
+                                // cache holding the (biased) offset
+
+const bsls::Types::Int64 k_OFFSET_BIAS = 1 << (k_OFFSET_BITS - 1);
+                                // bias added to the offset (in seconds) so
+                                // that it is stored as a non-negative value
+
+const bsls::Types::Int64 k_OFFSET_MASK = (1 << k_OFFSET_BITS) - 1;
+
+const bsls::Types::Int64 k_INVALID_CACHE = -1;
+                                // value of the local time offset cache that
+                                // does not correspond to any UTC minute
+
+const char HEX[] = "0123456789ABCDEF";
+
+const char *const MONTHS[] = {
+    0,
+    "JAN", "FEB", "MAR", "APR",
+    "MAY", "JUN", "JUL", "AUG",
+    "SEP", "OCT", "NOV", "DEC"
+};
+
+                               // ============
+                               // class Writer
+                               // ============
+
+class Writer {
+    // This class implements a bounded output sequence over a caller-supplied
+    // character buffer.  Characters written beyond the end of the buffer are
+    // discarded, but are still accounted for by 'length'.
+
+    // DATA
+    char *d_cursor_p;  // next position to write
+    char *d_end_p;     // end of the buffer
+    int   d_length;    // total number of characters written (or discarded)
+
+  private:
+    // NOT IMPLEMENTED
+    Writer(const Writer&);
+    Writer& operator=(const Writer&);
+
+  public:
+    // CREATORS
+    Writer(char *buffer, int numBytes)
+        // Create a writer over the specified 'buffer' having the specified
+        // 'numBytes' capacity.
+    : d_cursor_p(buffer)
+    , d_end_p(buffer + numBytes)
+    , d_length(0)
+    {
+    }
 
-namespace BloombergLP {
+    // MANIPULATORS
+    void append(char character)
+        // Append the specified 'character'.
+    {
+        if (d_cursor_p != d_end_p) {
+            *d_cursor_p++ = character;
+        }
+        ++d_length;
+    }
 
+    void append(const char *string, int length)
+        // Append the specified 'length' characters of the specified 'string'.
+    {
+        const int available = static_cast<int>(d_end_p - d_cursor_p);
+        const int numCopied = length < available ? length : available;
 
-static void appendToString(bsl::string *result, int value)
-    // Convert the specified 'value' into ASCII characters and append it to the
-    // specified 'result.
-{
-    char buffer[16];
+        if (0 < numCopied) {
+            bsl::memcpy(d_cursor_p, string, numCopied);
+            d_cursor_p += numCopied;
+        }
+        d_length   += length;
+    }
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
+    void append(const char *string)
+        // Append the specified null-terminated 'string'.
+    {
+        append(string, static_cast<int>(bsl::strlen(string)));
+    }
 
-    snprintf(buffer, sizeof buffer, "%d", value);
+    void appendDecimal(bsls::Types::Uint64 value)
+        // Append the decimal representation of the specified 'value'.
+    {
+        char  buffer[24];
+        char *p = buffer + sizeof buffer;
+        do {
+            *--p  = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value);
+
+        append(p, static_cast<int>(buffer + sizeof buffer - p));
+    }
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
+    void appendDecimal(int value)
+        // Append the decimal representation of the specified 'value'.
+    {
+        if (value < 0) {
+            append('-');
+            appendDecimal(static_cast<bsls::Types::Uint64>(
+                            -static_cast<bsls::Types::Int64>(value)));
+        }
+        else {
+            appendDecimal(static_cast<bsls::Types::Uint64>(value));
+        }
+    }
 
-    *result += buffer;
-}
+    void appendPadded(int value, int width)
+        // Append the decimal representation of the specified non-negative
+        // 'value', left-padded with '0' to the specified 'width'.  The
+        // behavior is undefined unless '0 <= value' and '0 < width <= 4'.
+    {
+        char buffer[4];
+        for (int i = width - 1; 0 <= i; --i) {
+            buffer[i]  = static_cast<char>('0' + value % 10);
+            value     /= 10;
+        }
+        if (value) {
+            // 'value' has more than 'width' digits; do not truncate it.
 
-static void appendToString(bsl::string *result, bsls::Types::Uint64 value)
-    // Convert the specified 'value' into ASCII characters and append it to the
-    // specified 'result.
-{
-    char buffer[32];
+            appendDecimal(value);
+        }
+        append(buffer, width);
+    }
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
+    // ACCESSORS
+    int length() const
+        // Return the total number of characters appended to this writer.
+    {
+        return d_length;
+    }
+};
 
-    snprintf(buffer, sizeof(buffer), "%llu", value);
+void appendEscaped(Writer *writer, const char *string, int length)
+    // Append to the specified 'writer' the specified 'length' characters of
+    // the specified 'string', with each non-printable character rendered as
+    // '\xHH'.  Note that the output is identical to that of
+    // 'bdlb::Print::printString' with 'escapeBackSlash' 'false'.
+{
+    const char *p   = string;
+    const char *q   = string;
+    const char *end = string + length;
+
+    for (; q != end; ++q) {
+        if (*q < 0x20 || *q > 0x7E) {
+            writer->append(p, static_cast<int>(q - p));
+
+            const char escaped[] = { '\\',
+                                     'x',
+                                     HEX[(*q >> 4) & 0xF],
+                                     HEX[*q        & 0xF] };
+            writer->append(escaped, sizeof escaped);
+            p = q + 1;
+        }
+    }
+    writer->append(p, static_cast<int>(q - p));
+}
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
+void appendHex(Writer *writer, const char *string, int length)
+    // Append to the specified 'writer' the hexadecimal representation of the
+    // specified 'length' characters of the specified 'string'.  Note that the
+    // output is identical to that of 'bdlb::Print::singleLineHexDump'.
+{
+    for (int i = 0; i < length; ++i) {
+        const unsigned char c = static_cast<unsigned char>(string[i]);
+        writer->append(HEX[c >> 4]);
+        writer->append(HEX[c & 0xF]);
+    }
+}
+
+void appendDatetime(Writer *writer, const bdlt::Datetime& timestamp)
+    // Append to the specified 'writer' the specified 'timestamp' in the
+    // 'DDMonYYYY_HH:MM:SS.mmm' format.  Note that the output is identical to
+    // that of 'bdlt::Datetime::printToBuffer'.
+{
+    int year, month, day;
+    timestamp.date().getYearMonthDay(&year, &month, &day);
+
+    writer->appendPadded(day, 2);
+    writer->append(MONTHS[month], 3);
+    writer->appendPadded(year, 4);
+    writer->append('_');
+    writer->appendPadded(timestamp.hour(), 2);
+    writer->append(':');
+    writer->appendPadded(timestamp.minute(), 2);
+    writer->append(':');
+    writer->appendPadded(timestamp.second(), 2);
+    writer->append('.');
+    writer->appendPadded(timestamp.millisecond(), 3);
+}
 
-    *result += buffer;
+void appendIso8601(Writer                *writer,
+                   const bdlt::Datetime&  timestamp,
+                   bool                   withMilliseconds)
+    // Append to the specified 'writer' the specified 'timestamp' in the ISO
+    // 8601 "extended" format ('YYYY-MM-DDTHH:MM:SS'), followed by '.mmm' if
+    // the specified 'withMilliseconds' is 'true'.
+{
+    int year, month, day;
+    timestamp.date().getYearMonthDay(&year, &month, &day);
+
+    writer->appendPadded(year, 4);
+    writer->append('-');
+    writer->appendPadded(month, 2);
+    writer->append('-');
+    writer->appendPadded(day, 2);
+    writer->append('T');
+    writer->appendPadded(timestamp.hour(), 2);
+    writer->append(':');
+    writer->appendPadded(timestamp.minute(), 2);
+    writer->append(':');
+    writer->appendPadded(timestamp.second(), 2);
+
+    if (withMilliseconds) {
+        writer->append('.');
+        writer->appendPadded(timestamp.millisecond(), 3);
+    }
 }
 
+}  // close unnamed namespace
+
                         // --------------------------------
                         // class ball::RecordStringFormatter
                         // --------------------------------
@@ -110,19 +309,276 @@ const int RecordStringFormatter::k_DISABLE_PUBLISH_IN_LOCALTIME = INT_MIN;
 // appear in practice.  Real values are (always?) less than one day (plus or
 // minus).
 
+// PRIVATE MANIPULATORS
+void RecordStringFormatter::compileFormat()
+{
+    typedef RecordStringFormatter_Op Op;
+
+    d_ops.clear();
+    d_literals.clear();
+
+    const char *iter = d_formatSpec.data();
+    const char *end  = iter + d_formatSpec.length();
+
+    int literalStart = 0;  // offset in 'd_literals' of text not yet covered
+                           // by an 'e_LITERAL' operation
+
+    while (iter != end) {
+        Op::Type type = Op::e_LITERAL;
+
+        switch (*iter) {
+          case '%': {
+            if (++iter == end) {
+                break;
+            }
+            switch (*iter) {
+              case '%': d_literals += '%';                    break;
+              case 'd': type = Op::e_DATETIME;                break;
+              case 'i': type = Op::e_ISO8601;                 break;
+              case 'I': type = Op::e_ISO8601_MILLISECONDS;    break;
+              case 'p': type = Op::e_PROCESS_ID;              break;
+              case 't': type = Op::e_THREAD_ID;               break;
+              case 's': type = Op::e_SEVERITY;                break;
+              case 'f': type = Op::e_FILENAME;                break;
+              case 'F': type = Op::e_FILENAME_BASE;           break;
+              case 'l': type = Op::e_LINE_NUMBER;             break;
+              case 'c': type = Op::e_CATEGORY;                break;
+              case 'm': type = Op::e_MESSAGE;                 break;
+              case 'x': type = Op::e_MESSAGE_ESCAPED;         break;
+              case 'X': type = Op::e_MESSAGE_HEX;             break;
+              case 'u': type = Op::e_USER_FIELDS;             break;
+              default: {
+                // Undefined: we just output the verbatim characters.
+
+                d_literals += '%';
+                d_literals += *iter;
+              }
+            }
+            ++iter;
+          } break;
+          case '\\': {
+            if (++iter == end) {
+                break;
+            }
+            switch (*iter) {
+              case 'n':  d_literals += '\n';                  break;
+              case 't':  d_literals += '\t';                  break;
+              case '\\': d_literals += '\\';                  break;
+              default: {
+                // Undefined: we just output the verbatim characters.
+
+                d_literals += '\\';
+                d_literals += *iter;
+              }
+            }
+            ++iter;
+          } break;
+          default: {
+            d_literals += *iter;
+            ++iter;
+          }
+        }
+
+        if (Op::e_LITERAL != type || iter == end) {
+            // Emit any pending literal text, followed by the conversion (if
+            // any).
+
+            const int literalEnd = static_cast<int>(d_literals.length());
+
+            if (literalStart != literalEnd) {
+                Op op = { Op::e_LITERAL,
+                          literalStart,
+                          literalEnd - literalStart };
+                d_ops.push_back(op);
+                literalStart = literalEnd;
+            }
+
+            if (Op::e_LITERAL != type) {
+                Op op = { type, 0, 0 };
+                d_ops.push_back(op);
+            }
+        }
+    }
+}
+
+// PRIVATE ACCESSORS
+bdlt::Datetime RecordStringFormatter::adjustedTimestamp(
+                                                   const Record& record) const
+{
+    bdlt::Datetime timestamp = record.fixedFields().timestamp();
+
+    if (k_ENABLE_PUBLISH_IN_LOCALTIME ==
+                                       d_timestampOffset.totalMilliseconds()) {
+        int localTimeOffsetInSeconds;
+
+        if (&bdlt::LocalTimeOffset::localTimeOffsetDefault ==
+                          bdlt::LocalTimeOffset::localTimeOffsetCallback()) {
+            const bsls::Types::Int64 minute =
+                         (timestamp.date() - bdlt::Date()) * 24 * 60
+                       + timestamp.hour() * 60
+                       + timestamp.minute();
+
+            const bsls::Types::Int64 cached = d_localTimeOffsetCache;
+
+            if (k_INVALID_CACHE != cached
+             && minute == (cached >> k_OFFSET_BITS)) {
+                localTimeOffsetInSeconds = static_cast<int>(
+                      (cached & k_OFFSET_MASK) - k_OFFSET_BIAS);
+            }
+            else {
+                localTimeOffsetInSeconds =
+                    bdlt::LocalTimeOffset::localTimeOffset(timestamp).
+                                                                totalSeconds();
+                d_localTimeOffsetCache =
+                           (minute << k_OFFSET_BITS)
+                         | ((localTimeOffsetInSeconds + k_OFFSET_BIAS)
+                                                           & k_OFFSET_MASK);
+            }
+        }
+        else {
+            localTimeOffsetInSeconds =
+                bdlt::LocalTimeOffset::localTimeOffset(timestamp).
+                                                                totalSeconds();
+        }
+        timestamp.addSeconds(localTimeOffsetInSeconds);
+    } else if(k_DISABLE_PUBLISH_IN_LOCALTIME ==
+                                       d_timestampOffset.totalMilliseconds()) {
+        // Do not adjust 'timestamp'.
+    } else {
+        timestamp += d_timestampOffset;
+    }
+
+    return timestamp;
+}
+
+int RecordStringFormatter::formatRecord(
+                                   char                  *buffer,
+                                   int                    numBytes,
+                                   const Record&          record,
+                                   const bdlt::Datetime&  timestamp) const
+{
+    typedef RecordStringFormatter_Op Op;
+
+    const RecordAttributes& fixedFields = record.fixedFields();
+
+    Writer writer(buffer, numBytes);
+
+    const Op *const end = d_ops.data() + d_ops.size();
+    for (const Op *op = d_ops.data(); op != end; ++op) {
+        switch (op->d_type) {
+          case Op::e_LITERAL: {
+            writer.append(d_literals.data() + op->d_offset, op->d_length);
+          } break;
+          case Op::e_DATETIME: {
+            appendDatetime(&writer, timestamp);
+          } break;
+          case Op::e_ISO8601:
+          case Op::e_ISO8601_MILLISECONDS: {
+            appendIso8601(&writer,
+                             timestamp,
+                             Op::e_ISO8601_MILLISECONDS == op->d_type);
+
+            if (0 == d_timestampOffset.totalMilliseconds()) {
+                writer.append('Z');
+            }
+          } break;
+          case Op::e_PROCESS_ID: {
+            writer.appendDecimal(fixedFields.processID());
+          } break;
+          case Op::e_THREAD_ID: {
+            writer.appendDecimal(fixedFields.threadID());
+          } break;
+          case Op::e_SEVERITY: {
+            writer.append(Severity::toAscii(
+                                   (Severity::Level)fixedFields.severity()));
+          } break;
+          case Op::e_FILENAME: {
+            const bsl::string& filename = fixedFields.fileName();
+            writer.append(filename.data(),
+                          static_cast<int>(filename.length()));
+          } break;
+          case Op::e_FILENAME_BASE: {
+            const bsl::string& filename = fixedFields.fileName();
+            bsl::string::size_type rightmostSlashIndex =
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+                filename.rfind('\\');
+#else
+                filename.rfind('/');
+#endif
+            const bsl::string::size_type start =
+                                      bsl::string::npos == rightmostSlashIndex
+                                      ? 0
+                                      : rightmostSlashIndex + 1;
+
+            writer.append(filename.data() + start,
+                          static_cast<int>(filename.length() - start));
+          } break;
+          case Op::e_LINE_NUMBER: {
+            writer.appendDecimal(fixedFields.lineNumber());
+          } break;
+          case Op::e_CATEGORY: {
+            const bsl::string& category = fixedFields.category();
+            writer.append(category.data(),
+                          static_cast<int>(category.length()));
+          } break;
+          case Op::e_MESSAGE: {
+            bslstl::StringRef message = fixedFields.messageRef();
+            writer.append(message.data(), static_cast<int>(message.length()));
+          } break;
+          case Op::e_MESSAGE_ESCAPED: {
+            appendEscaped(&writer,
+                             fixedFields.messageStreamBuf().data(),
+                             fixedFields.messageStreamBuf().length());
+          } break;
+          case Op::e_MESSAGE_HEX: {
+            appendHex(&writer,
+                         fixedFields.messageStreamBuf().data(),
+                         fixedFields.messageStreamBuf().length());
+          } break;
+          case Op::e_USER_FIELDS: {
+            typedef ball::UserFields Values;
+            const Values& userFields = record.userFields();
+            const int numUserFields  = userFields.length();
+
+            if (numUserFields > 0) {
+                bsl::stringstream ss;
+                Values::ConstIterator it = userFields.begin();
+                ss << *it;
+                ++it;
+                for (; it != userFields.end(); ++it) {
+                    ss << " " << *it;
+                }
+                const bsl::string& fields = ss.str();
+                writer.append(fields.data(),
+                              static_cast<int>(fields.length()));
+            }
+          } break;
+        }
+    }
+
+    return writer.length();
+}
 
 // CREATORS
 RecordStringFormatter::RecordStringFormatter(bslma::Allocator *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
 , d_timestampOffset(0)
+, d_ops(basicAllocator)
+, d_literals(basicAllocator)
+, d_localTimeOffsetCache(k_INVALID_CACHE)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(const char       *format,
                                              bslma::Allocator *basicAllocator)
 : d_formatSpec(format, basicAllocator)
 , d_timestampOffset(0)
+, d_ops(basicAllocator)
+, d_literals(basicAllocator)
+, d_localTimeOffsetCache(k_INVALID_CACHE)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -130,7 +586,11 @@ RecordStringFormatter::RecordStringFormatter(
                                  bslma::Allocator              *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
 , d_timestampOffset(offset)
+, d_ops(basicAllocator)
+, d_literals(basicAllocator)
+, d_localTimeOffsetCache(k_INVALID_CACHE)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -144,7 +604,11 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ?  k_ENABLE_PUBLISH_IN_LOCALTIME
                     : k_DISABLE_PUBLISH_IN_LOCALTIME)
+, d_ops(basicAllocator)
+, d_literals(basicAllocator)
+, d_localTimeOffsetCache(k_INVALID_CACHE)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -153,7 +617,11 @@ RecordStringFormatter::RecordStringFormatter(
                                  bslma::Allocator              *basicAllocator)
 : d_formatSpec(format, basicAllocator)
 , d_timestampOffset(offset)
+, d_ops(basicAllocator)
+, d_literals(basicAllocator)
+, d_localTimeOffsetCache(k_INVALID_CACHE)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -168,7 +636,11 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ?  k_ENABLE_PUBLISH_IN_LOCALTIME
                     : k_DISABLE_PUBLISH_IN_LOCALTIME)
+, d_ops(basicAllocator)
+, d_literals(basicAllocator)
+, d_localTimeOffsetCache(k_INVALID_CACHE)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -176,6 +648,9 @@ RecordStringFormatter::RecordStringFormatter(
                                   bslma::Allocator             *basicAllocator)
 : d_formatSpec(original.d_formatSpec, basicAllocator)
 , d_timestampOffset(original.d_timestampOffset)
+, d_ops(original.d_ops, basicAllocator)
+, d_literals(original.d_literals, basicAllocator)
+, d_localTimeOffsetCache(k_INVALID_CACHE)
 {
 }
 
@@ -190,6 +665,8 @@ RecordStringFormatter& RecordStringFormatter::operator=(
     if (this != &rhs) {
         d_formatSpec      = rhs.d_formatSpec;
         d_timestampOffset = rhs.d_timestampOffset;
+        d_ops             = rhs.d_ops;
+        d_literals        = rhs.d_literals;
     }
 
     return *this;
@@ -198,210 +675,52 @@ RecordStringFormatter& RecordStringFormatter::operator=(
 // ACCESSORS
 void RecordStringFormatter::operator()(bsl::ostream& stream,
                                        const Record& record) const
-
 {
-    const RecordAttributes& fixedFields = record.fixedFields();
-    bdlt::Datetime                timestamp   = fixedFields.timestamp();
-
-    if (k_ENABLE_PUBLISH_IN_LOCALTIME ==
-                                       d_timestampOffset.totalMilliseconds()) {
-        int localTimeOffsetInSeconds =
-            bdlt::LocalTimeOffset::localTimeOffset(timestamp).totalSeconds();
-        timestamp.addSeconds(localTimeOffsetInSeconds);
-    } else if(k_DISABLE_PUBLISH_IN_LOCALTIME ==
-                                       d_timestampOffset.totalMilliseconds()) {
-        // Do not adjust 'timestamp'.
-    } else {
-        timestamp += d_timestampOffset;
-    }
+    const bdlt::Datetime timestamp = adjustedTimestamp(record);
 
-    // Step through the format string, outputting the required elements.
+    // Format into a buffer on the stack, falling back to a buffer obtained
+    // from the default allocator if the formatted record does not fit.
 
-    const char* iter = d_formatSpec.data();
-    const char* end  = iter + d_formatSpec.length();
+    char fixedBuffer[k_BUFFER_SIZE];
 
-    // Create a buffer on the stack for formatting the record.  Note that the
-    // size of the buffer should be slightly larger than the amount we reserve
-    // in order to ensure only a single allocation occurs.
+    const int length = formatRecord(fixedBuffer,
+                                    k_BUFFER_SIZE,
+                                    record,
+                                    timestamp);
 
-    const int BUFFER_SIZE        = 512;
-    const int STRING_RESERVATION = BUFFER_SIZE -
-                                   bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
-
-    char fixedBuffer[BUFFER_SIZE];
-    bdlma::BufferedSequentialAllocator stringAllocator(fixedBuffer,
-                                                      BUFFER_SIZE);
-    bsl::string output(&stringAllocator);
-    output.reserve(STRING_RESERVATION);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
-
-    while (iter != end) {
-        switch (*iter) {
-          case '%': {
-            if (++iter == end) {
-                break;
-            }
-            switch (*iter) {
-              case '%': {
-                output += '%';
-              } break;
-              case 'd': {
-                char buffer[32];
-                timestamp.printToBuffer(buffer, sizeof buffer);
-
-                output += buffer;
-              } break;
-              case 'I': // fall through intentionally
-              case 'i': {
-                // use ISO8601 "extended" format
-
-                char buffer[32];
-
-                snprintf(buffer,
-                         sizeof(buffer),
-                         "%04d-%02d-%02dT%02d:%02d:%02d",
-                         timestamp.year(),
-                         timestamp.month(),
-                         timestamp.day(),
-                         timestamp.hour(),
-                         timestamp.minute(),
-                         timestamp.second());
-                output += buffer;
-
-                if ('I' == *iter) {
-                    snprintf(buffer,
-                             sizeof(buffer),
-                             ".%03d",
-                             timestamp.millisecond());
-
-                    output += buffer;
-                }
+    if (length <= k_BUFFER_SIZE) {
+        stream.write(fixedBuffer, length);
+    }
+    else {
+        bsl::vector<char> buffer(length, bslma::Default::defaultAllocator());
 
-                if (0 == d_timestampOffset.totalMilliseconds()) {
-                    output += 'Z';
-                }
-              } break;
-              case 'p': {
-                appendToString(&output, fixedFields.processID());
-              } break;
-              case 't': {
-                appendToString(&output, fixedFields.threadID());
-              } break;
-              case 's': {
-                output += Severity::toAscii(
-                                 (Severity::Level)fixedFields.severity());
-              } break;
-              case 'f': {
-                output += fixedFields.fileName();
-              } break;
-              case 'F': {
-                const bsl::string& filename = fixedFields.fileName();
-                bsl::string::size_type rightmostSlashIndex =
-#ifdef BSLS_PLATFORM_OS_WINDOWS
-                    filename.rfind('\\');
-#else
-                    filename.rfind('/');
-#endif
-                if (bsl::string::npos == rightmostSlashIndex) {
-                    output += filename;
-                }
-                else {
-                    output += filename.substr(rightmostSlashIndex + 1);
-                }
-              } break;
-              case 'l': {
-                appendToString(&output, fixedFields.lineNumber());
-              } break;
-              case 'c': {
-                output += fixedFields.category();
-              } break;
-              case 'm': {
-                bslstl::StringRef message = fixedFields.messageRef();
-                output.append(message.data(), message.length());
-              } break;
-              case 'x': {
-                bsl::stringstream ss;
-                int length = fixedFields.messageStreamBuf().length();
-                bdlb::Print::printString(ss,
-                                        fixedFields.message(),
-                                        length,
-                                        false);
-                output += ss.str();
-              } break;
-              case 'X': {
-                bsl::stringstream ss;
-                int length = fixedFields.messageStreamBuf().length();
-                bdlb::Print::singleLineHexDump(ss,
-                                              fixedFields.message(),
-                                              length);
-                output += ss.str();
-              } break;
-              case 'u': {
-                typedef ball::UserFields Values;
-                const Values& userFields = record.userFields();
-                const int numUserFields  = userFields.length();
-
-                if (numUserFields > 0) {
-                    bsl::stringstream ss;
-                    Values::ConstIterator it = userFields.begin();
-                    ss << *it;
-                    ++it;
-                    for (; it != userFields.end(); ++it) {
-                        ss << " " << *it;
-                    }
-                    output += ss.str();
-                }
-              } break;
-              default: {
-                // Undefined: we just output the verbatim characters.
+        const int rc = formatRecord(buffer.data(), length, record, timestamp);
+        (void)rc;
+        BSLS_ASSERT(length == rc);
 
-                output += '%';
-                output += *iter;
-              }
-            }
-            ++iter;
-          } break;
-          case '\\': {
-            if (++iter == end) {
-                break;
-            }
-            switch (*iter) {
-              case 'n': {
-                output += '\n';
-              } break;
-              case 't': {
-                output += '\t';
-              } break;
-              case '\\': {
-                output += '\\';
-              } break;
-              default: {
-                // Undefined: we just output the verbatim characters.
-
-                output += '\\';
-                output += *iter;
-              }
-            }
-            ++iter;
-          } break;
-          default: {
-            output += *iter;
-            ++iter;
-          }
-        }
+        stream.write(buffer.data(), length);
     }
+    stream.flush();
+}
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
+int RecordStringFormatter::printToBuffer(char          *buffer,
+                                         int            numBytes,
+                                         const Record&  record) const
+{
+    BSLS_ASSERT(buffer || 0 == numBytes);
+    BSLS_ASSERT(0 <= numBytes);
 
-    stream.write(output.c_str(), output.size());
-    stream.flush();
+    const int length = formatRecord(buffer,
+                                    numBytes,
+                                    record,
+                                    adjustedTimestamp(record));
 
+    if (0 < numBytes) {
+        buffer[length < numBytes ? length : numBytes - 1] = '\0';
+    }
+    return length;
 }
+
 }  // close package namespace
 
 // FREE OPERATORS
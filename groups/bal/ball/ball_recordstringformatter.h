@@ -42,6 +42,26 @@ BSLS_IDENT("$Id: $")
 // facilitates the logging of records in local time, if desired, in the event
 // that the timestamp attribute of records are in UTC.
 //
+// A 'printToBuffer' method is also provided that formats a record directly
+// into a caller-supplied character buffer, bypassing the stream entirely.
+//
+///Performance
+///-----------
+// The format specification of a record formatter is parsed once, when it is
+// supplied (at construction, by 'setFormat', or by assignment), into a
+// sequence of formatting operations.  Formatting a record then amounts to
+// executing that sequence, each operation copying a literal run of text or
+// rendering one record attribute directly into the output buffer.
+//
+// When publishing in local time, the local time offset obtained from
+// 'bdlt::LocalTimeOffset' is cached, provided the default local time offset
+// callback is installed.  The cached offset is reused for records whose
+// timestamps fall within the same UTC minute as the record for which it was
+// obtained, so the callback is invoked at most once per minute of logged time
+// and transitions into and out of Daylight Saving Time (which occur on minute
+// boundaries) are still observed.  If a user-supplied callback is installed,
+// it is invoked for every formatted record.
+//
 ///Record Format Specification
 ///---------------------------
 // The following table lists the 'printf'-style ('%'-prefixed) conversion
@@ -127,6 +147,10 @@ BSLS_IDENT("$Id: $")
 #include <balscm_version.h>
 #endif
 
+#ifndef INCLUDED_BDLT_DATETIME
+#include <bdlt_datetime.h>
+#endif
+
 #ifndef INCLUDED_BDLT_DATETIMEINTERVAL
 #include <bdlt_datetimeinterval.h>
 #endif
@@ -143,6 +167,10 @@ BSLS_IDENT("$Id: $")
 #include <bslma_allocator.h>
 #endif
 
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
 #ifndef INCLUDED_BSL_IOSFWD
 #include <bsl_iosfwd.h>
 #endif
@@ -151,12 +179,52 @@ BSLS_IDENT("$Id: $")
 #include <bsl_string.h>
 #endif
 
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
 namespace BloombergLP {
 
 namespace ball {
 
 class Record;
 
+                     // ================================
+                     // struct RecordStringFormatter_Op
+                     // ================================
+
+struct RecordStringFormatter_Op {
+    // This is an implementation type of 'RecordStringFormatter' and should
+    // not be used by clients of this package.  A 'RecordStringFormatter_Op'
+    // describes one step of a parsed format specification: either a run of
+    // literal text (held in a separate buffer owned by the record formatter)
+    // or the rendering of a single record attribute.
+
+    // TYPES
+    enum Type {
+        e_LITERAL,              // literal text
+        e_DATETIME,             // '%d'
+        e_ISO8601,              // '%i'
+        e_ISO8601_MILLISECONDS, // '%I'
+        e_PROCESS_ID,           // '%p'
+        e_THREAD_ID,            // '%t'
+        e_SEVERITY,             // '%s'
+        e_FILENAME,             // '%f'
+        e_FILENAME_BASE,        // '%F'
+        e_LINE_NUMBER,          // '%l'
+        e_CATEGORY,             // '%c'
+        e_MESSAGE,              // '%m'
+        e_MESSAGE_ESCAPED,      // '%x'
+        e_MESSAGE_HEX,          // '%X'
+        e_USER_FIELDS           // '%u'
+    };
+
+    // DATA
+    Type d_type;    // kind of operation
+    int  d_offset;  // offset of literal text (for 'e_LITERAL' only)
+    int  d_length;  // length of literal text (for 'e_LITERAL' only)
+};
+
                         // ===========================
                         // class RecordStringFormatter
                         // ===========================
@@ -190,6 +258,40 @@ class RecordStringFormatter {
     bsl::string            d_formatSpec;       // 'printf'-style format spec.
     bdlt::DatetimeInterval d_timestampOffset;  // offset added to timestamps
 
+    bsl::vector<RecordStringFormatter_Op>
+                           d_ops;              // parsed 'd_formatSpec'
+
+    bsl::string            d_literals;         // literal text referenced by
+                                               // 'd_ops'
+
+    mutable bsls::AtomicInt64
+                           d_localTimeOffsetCache;
+                                               // most recently obtained local
+                                               // time offset (in seconds)
+                                               // packed with the UTC minute
+                                               // for which it was obtained
+
+    // PRIVATE MANIPULATORS
+    void compileFormat();
+        // Parse 'd_formatSpec' into the sequence of operations held in 'd_ops'
+        // (and 'd_literals').
+
+    // PRIVATE ACCESSORS
+    bdlt::Datetime adjustedTimestamp(const Record& record) const;
+        // Return the timestamp of the specified 'record' adjusted by the
+        // timestamp offset (or the current local time offset) of this record
+        // formatter.
+
+    int formatRecord(char                  *buffer,
+                     int                    numBytes,
+                     const Record&          record,
+                     const bdlt::Datetime&  timestamp) const;
+        // Format the specified 'record', using the specified 'timestamp' in
+        // place of its timestamp attribute, into the specified 'buffer' of
+        // the specified 'numBytes' capacity, and return the length of the
+        // complete formatted output.  At most 'numBytes' characters are
+        // written; no null terminator is written.
+
   public:
     // TRAITS
     BSLALG_DECLARE_NESTED_TRAITS(RecordStringFormatter,
@@ -311,6 +413,21 @@ class RecordStringFormatter {
     const char *format() const;
         // Return the format specification of this record formatter.
 
+    int printToBuffer(char          *buffer,
+                      int            numBytes,
+                      const Record&  record) const;
+        // Format the specified 'record' according to the format specification
+        // of this record formatter into the specified 'buffer' having the
+        // specified 'numBytes' capacity.  Return the number of characters
+        // (not including the null character) that would have been written if
+        // the limit imposed by 'numBytes' were not present.  If 'numBytes' is
+        // not 0, 'buffer' is null-terminated.  The behavior is undefined
+        // unless '0 <= numBytes' and 'buffer' has at least 'numBytes'
+        // (writable) characters.  Note that the output is truncated if
+        // 'numBytes' is less than or equal to the returned value, and that
+        // this method does not allocate memory unless the format
+        // specification includes '%u' and 'record' has user fields.
+
     bool isPublishInLocalTimeEnabled() const;
         // Return 'true' if this formatter adjusts the timestamp attribute to
         // the current local time, and 'false' otherwise.
@@ -368,6 +485,7 @@ inline
 void RecordStringFormatter::setFormat(const char *format)
 {
     d_formatSpec = format;
+    compileFormat();
 }
 
 inline
@@ -27,6 +27,7 @@
 #include <bslma_testallocator.h>
 #include <bslma_testallocatormonitor.h>
 #include <bsls_platform.h>
+#include <bsls_timeinterval.h>
 #include <bsls_types.h>
 
 
@@ -85,6 +86,7 @@ using bsl::string;
 // [13] bool isPublishInLocalTimeEnabled() const;
 // [ 2] const bdlt::DatetimeInterval& timestampOffset() const;
 // [11] void operator()(bsl::ostream&, const ball::Record&) const;
+// [14] int printToBuffer(char *, int, const ball::Record&) const;
 // FREE OPERATORS
 // [ 6] bool operator==(const ball::RSF& lhs, const ball::RSF& rhs);
 // [ 6] bool operator!=(const ball::RSF& lhs, const ball::RSF& rhs);
@@ -92,6 +94,7 @@ using bsl::string;
 // ----------------------------------------------------------------------------
 // [ 1] breathing test
 // [12] USAGE example
+// [14] CONCERN: local time offset cached only for default callback
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -248,6 +251,26 @@ bool compareText(bslstl::StringRef lhs, bslstl::StringRef rhs)
 
 namespace {
 
+struct CountingLocalTimeOffsetCallback {
+    // This 'struct' provides a local time offset callback that returns a
+    // configurable offset and counts the number of times it is invoked.
+
+    // CLASS DATA
+    static int s_offsetInSeconds;
+    static int s_loadCount;
+
+    // CLASS METHODS
+    static bsls::TimeInterval localTimeOffset(const bdlt::Datetime&)
+        // Return 's_offsetInSeconds' and increment 's_loadCount'.
+    {
+        ++s_loadCount;
+        return bsls::TimeInterval(s_offsetInSeconds, 0);
+    }
+};
+
+int CountingLocalTimeOffsetCallback::s_offsetInSeconds = 0;
+int CountingLocalTimeOffsetCallback::s_loadCount       = 0;
+
 }  // close unnamed namespace
 
 //=============================================================================
@@ -265,6 +288,316 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'printToBuffer' AND LOCAL TIME OFFSET CACHING
+        //
+        // Concerns:
+        //: 1 'printToBuffer' produces the same output as 'operator()' for
+        //:   every conversion, escape sequence, and undefined sequence.
+        //:
+        //: 2 'printToBuffer' returns the length of the complete output,
+        //:   truncates the output to fit the supplied buffer, always
+        //:   null-terminates a non-empty buffer, and does not write past the
+        //:   end of the buffer.
+        //:
+        //: 3 'printToBuffer' allocates no memory when the format does not
+        //:   contain '%u'.
+        //:
+        //: 4 The parsed format is updated by 'setFormat' and is propagated by
+        //:   copy construction and assignment.
+        //:
+        //: 5 A user-installed local time offset callback is invoked for every
+        //:   record formatted in local time, so changes in the offset it
+        //:   reports are observed immediately.
+        //:
+        //: 6 When the default local time offset callback is installed, the
+        //:   offset applied to each record matches that reported by
+        //:   'bdlt::LocalTimeOffset' for the record's timestamp.
+        //
+        // Plan:
+        //: 1 For a table of format specifications, format a record with both
+        //:   'operator()' and 'printToBuffer' and compare.  (C-1)
+        //:
+        //: 2 Format a record into buffers of every size from 0 to beyond the
+        //:   output length, and verify the returned length, the contents of
+        //:   the buffer, and a sentinel character following it.  (C-2)
+        //:
+        //: 3 Install a test allocator as the default allocator and verify
+        //:   that no memory is allocated by 'printToBuffer'.  (C-3)
+        //:
+        //: 4 Change the format of an object with 'setFormat' and verify the
+        //:   output of the object and of copies of the object.  (C-4)
+        //:
+        //: 5 Install a counting callback, format records having identical
+        //:   timestamps while changing the reported offset, and verify both
+        //:   the load count and the output.  (C-5)
+        //:
+        //: 6 Reinstall the default callback and, for a series of timestamps
+        //:   (several within the same minute), compare the formatted output
+        //:   with that computed from 'bdlt::LocalTimeOffset'.  (C-6)
+        //
+        // Testing:
+        //   int printToBuffer(char *, int, const ball::Record&) const;
+        //   CONCERN: local time offset cached only for default callback
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                 << endl
+                 << "TESTING 'printToBuffer' AND LOCAL TIME OFFSET CACHING"
+                 << endl
+                 << "====================================================="
+                 << endl;
+
+        ball::RecordAttributes fixedFields(bdlt::Datetime(2016, 3, 7,
+                                                          9, 5, 2, 37),
+                                           -42,
+                                           18446744073709551615ULL,
+                                           "dir/sub/file.cpp",
+                                           -7,
+                                           "CAT",
+                                           ball::Severity::e_ERROR,
+                                           "a\rb\\c");
+
+        ball::UserFields userFields;
+        userFields.appendString("field");
+        userFields.appendInt64(12);
+
+        ball::Record        mRecord(fixedFields, userFields);
+        const ball::Record& record = mRecord;
+
+        if (verbose) cout << "\nCompare with 'operator()'." << endl;
+        {
+            static const char *DATA[] = {
+                "",
+                "text only",
+                "%d", "%i", "%I", "%p", "%t", "%s", "%f", "%F", "%l", "%c",
+                "%m", "%x", "%X", "%u", "%%",
+                "\\n\\t\\\\",
+                "%q %", "\\q \\",
+                "%d%i%I%p%t%s%f%F%l%c%m%x%X%u",
+                "\n%d %p:%t %s %f:%l %c %m %u\n",
+                "[%s] %% %F:%l \\t%m\\n"
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const char *SPEC = DATA[i];
+
+                for (int offset = 0; offset < 2; ++offset) {
+                    Obj mX(SPEC, bdlt::DatetimeInterval(0, offset));
+                    const Obj& X = mX;
+
+                    ostringstream oss;
+                    X(oss, record);
+
+                    char      buffer[256];
+                    const int rc = X.printToBuffer(buffer,
+                                                   sizeof buffer,
+                                                   record);
+
+                    if (veryVerbose) { P_(SPEC) P_(oss.str()) P(buffer) }
+
+                    ASSERTV(SPEC, rc, oss.str().length() == (unsigned)rc);
+                    ASSERTV(SPEC, oss.str(), buffer, oss.str() == buffer);
+                }
+            }
+
+            // Spot-check a few conversions against explicit values.
+
+            Obj mX("%d|%I|%p|%t|%F|%l|%x");  const Obj& X = mX;
+
+            char buffer[256];
+            X.printToBuffer(buffer, sizeof buffer, record);
+
+            ASSERTV(buffer, 0 == strcmp(buffer,
+                                        "07MAR2016_09:05:02.037|"
+                                        "2016-03-07T09:05:02.037Z|"
+                                        "-42|"
+                                        "18446744073709551615|"
+                                        "file.cpp|"
+                                        "-7|"
+                                        "a\\x0Db\\c"));
+        }
+
+        if (verbose) cout << "\nTruncation." << endl;
+        {
+            Obj mX("%d %s %m");  const Obj& X = mX;
+
+            char      full[64];
+            const int LENGTH = X.printToBuffer(full, sizeof full, record);
+            ASSERTV(LENGTH, bsl::strlen(full) == (unsigned)LENGTH);
+
+            for (int numBytes = 0; numBytes <= LENGTH + 2; ++numBytes) {
+                char buffer[64];
+                bsl::memset(buffer, '#', sizeof buffer);
+
+                const int rc = X.printToBuffer(buffer, numBytes, record);
+                ASSERTV(numBytes, rc, LENGTH == rc);
+
+                if (numBytes) {
+                    const int expLength = numBytes <= LENGTH
+                                        ? numBytes - 1
+                                        : LENGTH;
+
+                    ASSERTV(numBytes,
+                            0 == bsl::memcmp(buffer, full, expLength));
+                    ASSERTV(numBytes, '\0' == buffer[expLength]);
+                }
+                ASSERTV(numBytes, '#' == buffer[numBytes]);
+            }
+        }
+
+        if (verbose) cout << "\nNo allocation." << endl;
+        {
+            bslma::TestAllocator         da("default", veryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            Obj mX("\n%d %p:%t %s %f:%l %c %m %x %X\n", &oa);
+            const Obj& X = mX;
+
+            const bsls::Types::Int64 NUM_OBJECT_ALLOCATIONS =
+                                                          oa.numAllocations();
+
+            char buffer[512];
+            X.printToBuffer(buffer, sizeof buffer, record);
+            X.printToBuffer(buffer, 10, record);
+
+            ASSERTV(da.numAllocations(), 0 == da.numAllocations());
+            ASSERT(NUM_OBJECT_ALLOCATIONS == oa.numAllocations());
+        }
+
+        if (verbose) cout << "\n'setFormat', copy, and assignment." << endl;
+        {
+            Obj mX("%s");  const Obj& X = mX;
+            Obj mY("%l");  const Obj& Y = mY;
+
+            char buffer[64];
+
+            X.printToBuffer(buffer, sizeof buffer, record);
+            ASSERTV(buffer, 0 == strcmp(buffer, "ERROR"));
+
+            mX.setFormat("<%c>");
+            X.printToBuffer(buffer, sizeof buffer, record);
+            ASSERTV(buffer, 0 == strcmp(buffer, "<CAT>"));
+
+            const Obj Z(X);
+            Z.printToBuffer(buffer, sizeof buffer, record);
+            ASSERTV(buffer, 0 == strcmp(buffer, "<CAT>"));
+
+            mY = X;
+            Y.printToBuffer(buffer, sizeof buffer, record);
+            ASSERTV(buffer, 0 == strcmp(buffer, "<CAT>"));
+
+            mX.setFormat("%l");
+            X.printToBuffer(buffer, sizeof buffer, record);
+            ASSERTV(buffer, 0 == strcmp(buffer, "-7"));
+
+            Y.printToBuffer(buffer, sizeof buffer, record);
+            ASSERTV(buffer, 0 == strcmp(buffer, "<CAT>"));
+        }
+
+        if (verbose) cout << "\nUser-installed offset callback." << endl;
+        {
+            typedef CountingLocalTimeOffsetCallback Callback;
+
+            const bdlt::LocalTimeOffset::LocalTimeOffsetCallback
+                originalCallback =
+                    bdlt::LocalTimeOffset::setLocalTimeOffsetCallback(
+                                                   &Callback::localTimeOffset);
+
+            Obj mX("%d", true);  const Obj& X = mX;
+
+            char buffer[64];
+
+            Callback::s_loadCount       = 0;
+            Callback::s_offsetInSeconds = 60 * 60;
+
+            X.printToBuffer(buffer, sizeof buffer, record);
+            ASSERTV(buffer, 0 == strcmp(buffer, "07MAR2016_10:05:02.037"));
+            ASSERTV(Callback::s_loadCount, 1 == Callback::s_loadCount);
+
+            Callback::s_offsetInSeconds = -2 * 60 * 60;
+
+            X.printToBuffer(buffer, sizeof buffer, record);
+            ASSERTV(buffer, 0 == strcmp(buffer, "07MAR2016_07:05:02.037"));
+            ASSERTV(Callback::s_loadCount, 2 == Callback::s_loadCount);
+
+            ostringstream oss;
+            X(oss, record);
+            ASSERTV(oss.str(), "07MAR2016_07:05:02.037" == oss.str());
+            ASSERTV(Callback::s_loadCount, 3 == Callback::s_loadCount);
+
+            bdlt::LocalTimeOffset::setLocalTimeOffsetCallback(
+                                                             originalCallback);
+        }
+
+        if (verbose) cout << "\nDefault offset callback." << endl;
+        {
+            ASSERT(&bdlt::LocalTimeOffset::localTimeOffsetDefault ==
+                            bdlt::LocalTimeOffset::localTimeOffsetCallback());
+
+            Obj mX("%d", true);  const Obj& X = mX;
+
+            static const struct {
+                int d_line;
+                int d_year;
+                int d_month;
+                int d_day;
+                int d_hour;
+                int d_minute;
+                int d_second;
+            } DATA[] = {
+                //LINE  YEAR  MO  DAY  HR  MIN  SEC
+                //----  ----  --  ---  --  ---  ---
+                { L_,   2016,  1,  15,  12,  30,   0 },
+                { L_,   2016,  1,  15,  12,  30,  59 },
+                { L_,   2016,  7,  15,  12,  30,   0 },
+                { L_,   2016,  7,  15,  12,  30,  30 },
+                { L_,   2016,  1,  15,  12,  30,  30 },
+                { L_,   2016,  3,  13,   6,  59,  59 },
+                { L_,   2016,  3,  13,   7,   0,   0 },
+                { L_,   2016, 11,   6,   5,  59,  59 },
+                { L_,   2016, 11,   6,   6,   0,   0 },
+                { L_,   2016, 11,   6,   6,   0,   1 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const int LINE = DATA[i].d_line;
+
+                const bdlt::Datetime UTC(DATA[i].d_year,
+                                         DATA[i].d_month,
+                                         DATA[i].d_day,
+                                         DATA[i].d_hour,
+                                         DATA[i].d_minute,
+                                         DATA[i].d_second);
+
+                const int OFFSET =
+                  bdlt::LocalTimeOffset::localTimeOffset(UTC).totalSeconds();
+
+                bdlt::Datetime local(UTC);
+                local.addSeconds(OFFSET);
+
+                char expected[32];
+                local.printToBuffer(expected, sizeof expected);
+
+                mRecord.fixedFields().setTimestamp(UTC);
+
+                for (int j = 0; j < 2; ++j) {
+                    char buffer[32];
+                    X.printToBuffer(buffer, sizeof buffer, record);
+
+                    if (veryVerbose) { P_(LINE) P_(expected) P(buffer) }
+
+                    ASSERTV(LINE, j, expected, buffer,
+                            0 == strcmp(expected, buffer));
+                }
+            }
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING: Records Show Calculated Local-Time Offset
@@ -12,12 +12,186 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balm_collector_cpp,"$Id$ $CSID$")
 
+#include <balm_collector_shardutil.h>
+
+#include <bslma_default.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_types.h>
+
 namespace BloombergLP {
+namespace balm {
+
+namespace {
+
+typedef bsls::AtomicOperations AtomicOps;
+typedef Collector_ShardUtil    ShardUtil;
+typedef bsls::Types::Int64     Int64;
+
+enum { k_CACHE_LINE_SIZE = ShardUtil::k_CACHE_LINE_SIZE };
+
+}  // close unnamed namespace
+
+                           // ======================
+                           // struct Collector_Shard
+                           // ======================
+
+struct Collector_Shard {
+    // This 'struct' holds the aggregated values of one shard of a sharded
+    // 'Collector', padded to occupy a whole cache line.  The 'double'
+    // aggregates are stored as their bit patterns.
+
+    AtomicOps::AtomicTypes::Int64 d_count;    // aggregated count of events
+    AtomicOps::AtomicTypes::Int64 d_total;    // bits of the total
+    AtomicOps::AtomicTypes::Int64 d_min;      // bits of the minimum
+    AtomicOps::AtomicTypes::Int64 d_max;      // bits of the maximum
+    char                          d_padding[k_CACHE_LINE_SIZE - 4 * 8];
+};
+
+BSLMF_ASSERT(k_CACHE_LINE_SIZE == sizeof(Collector_Shard));
+
+namespace {
+
+void initShard(Collector_Shard *shard)
+    // Set the specified 'shard' to its default state.
+{
+    const Int64 minBits = ShardUtil::toBits(MetricRecord::k_DEFAULT_MIN);
+    const Int64 maxBits = ShardUtil::toBits(MetricRecord::k_DEFAULT_MAX);
+
+    AtomicOps::initInt64(&shard->d_count, 0);
+    AtomicOps::initInt64(&shard->d_total, ShardUtil::toBits(0.0));
+    AtomicOps::initInt64(&shard->d_min,   minBits);
+    AtomicOps::initInt64(&shard->d_max,   maxBits);
+}
+
+void mergeShards(MetricRecord    *record,
+                 Collector_Shard *shards,
+                 int              numShards,
+                 bool             resetFlag)
+    // Load into the specified 'record' the count, total, minimum, and maximum
+    // aggregated values merged from the specified 'numShards' 'shards', and,
+    // if the specified 'resetFlag' is 'true', atomically reset each field of
+    // each shard to its default value as it is read.
+{
+    const Int64 zeroBits = ShardUtil::toBits(0.0);
+    const Int64 minBits  = ShardUtil::toBits(MetricRecord::k_DEFAULT_MIN);
+    const Int64 maxBits  = ShardUtil::toBits(MetricRecord::k_DEFAULT_MAX);
+
+    Int64  count = 0;
+    double total = 0.0;
+    double min   = MetricRecord::k_DEFAULT_MIN;
+    double max   = MetricRecord::k_DEFAULT_MAX;
+
+    for (int i = 0; i < numShards; ++i) {
+        Collector_Shard& shard = shards[i];
+
+        Int64 totalBits, shardMinBits, shardMaxBits;
+        if (resetFlag) {
+            count        += AtomicOps::swapInt64AcqRel(&shard.d_count, 0);
+            totalBits     = AtomicOps::swapInt64AcqRel(&shard.d_total,
+                                                       zeroBits);
+            shardMinBits  = AtomicOps::swapInt64AcqRel(&shard.d_min, minBits);
+            shardMaxBits  = AtomicOps::swapInt64AcqRel(&shard.d_max, maxBits);
+        }
+        else {
+            count        += AtomicOps::getInt64Acquire(&shard.d_count);
+            totalBits     = AtomicOps::getInt64Acquire(&shard.d_total);
+            shardMinBits  = AtomicOps::getInt64Acquire(&shard.d_min);
+            shardMaxBits  = AtomicOps::getInt64Acquire(&shard.d_max);
+        }
+        total += ShardUtil::fromBits(totalBits);
+        min    = bsl::min(min, ShardUtil::fromBits(shardMinBits));
+        max    = bsl::max(max, ShardUtil::fromBits(shardMaxBits));
+    }
+
+    record->count() = static_cast<int>(count);
+    record->total() = total;
+    record->min()   = min;
+    record->max()   = max;
+}
+
+}  // close unnamed namespace
 
                               // ---------------
                               // class Collector
                               // ---------------
 
+// PRIVATE MANIPULATORS
+void Collector::loadAndResetShards(MetricRecord *record)
+{
+    record->metricId() = d_record.metricId();
+    mergeShards(record, d_shards_p, d_numShards, true);
+}
+
+void Collector::resetShards()
+{
+    const Int64 minBits = ShardUtil::toBits(MetricRecord::k_DEFAULT_MIN);
+    const Int64 maxBits = ShardUtil::toBits(MetricRecord::k_DEFAULT_MAX);
+
+    for (int i = 0; i < d_numShards; ++i) {
+        Collector_Shard& shard = d_shards_p[i];
+        AtomicOps::setInt64Release(&shard.d_count, 0);
+        AtomicOps::setInt64Release(&shard.d_total, ShardUtil::toBits(0.0));
+        AtomicOps::setInt64Release(&shard.d_min,   minBits);
+        AtomicOps::setInt64Release(&shard.d_max,   maxBits);
+    }
+}
+
+void Collector::updateShard(int count, double total, double min, double max)
+{
+    Collector_Shard& shard = d_shards_p[ShardUtil::shardIndex(d_numShards)];
+
+    AtomicOps::addInt64AcqRel(&shard.d_count, count);
+    ShardUtil::addDouble(&shard.d_total, total);
+    ShardUtil::updateMin(&shard.d_min, min);
+    ShardUtil::updateMax(&shard.d_max, max);
+}
+
+// PRIVATE ACCESSORS
+void Collector::loadShards(MetricRecord *record) const
+{
+    record->metricId() = d_record.metricId();
+    mergeShards(record, d_shards_p, d_numShards, false);
+}
+
+// CREATORS
+Collector::Collector(const MetricId&   metricId,
+                     int               numShards,
+                     bslma::Allocator *basicAllocator)
+: d_record(metricId)
+, d_lock()
+, d_shards_p(0)
+, d_shardBuffer_p(0)
+, d_numShards(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 <= numShards);
+
+    if (0 == numShards) {
+        return;                                                       // RETURN
+    }
+
+    d_shards_p  = static_cast<Collector_Shard *>(ShardUtil::allocateAligned(
+                                        &d_shardBuffer_p,
+                                        numShards * sizeof(Collector_Shard),
+                                        d_allocator_p));
+    d_numShards = numShards;
+    for (int i = 0; i < numShards; ++i) {
+        initShard(&d_shards_p[i]);
+    }
+}
+
+Collector::~Collector()
+{
+    if (d_shardBuffer_p) {
+        d_allocator_p->deallocate(d_shardBuffer_p);
+    }
+}
+
+}  // close package namespace
 }  // close enterprise namespace
 
 // ----------------------------------------------------------------------------
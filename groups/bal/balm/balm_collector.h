@@ -36,6 +36,24 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 // clients should not need to access a 'balm::Collector' directly, but instead
 // use it through another type (see 'balm_metric').
 //
+///Sharded Collectors
+///------------------
+// By default, a 'balm::Collector' serializes its operations with a mutex,
+// which becomes a point of contention when a single collector is updated
+// frequently from many threads.  A collector created with a positive number
+// of *shards* instead aggregates values in that many independent,
+// cache-line-sized shards, each updated using atomic operations without
+// taking any lock.  Each thread updates the shard selected by its thread id,
+// and the shards are merged when the collector is loaded.  A sharded
+// collector yields the same aggregated values as a non-sharded one, except
+// that 'load', 'loadAndReset', and 'setCountTotalMinMax' are not atomic with
+// respect to concurrent updates: an update performed concurrently with
+// 'loadAndReset' may be split between the record loaded and the state left
+// in the collector (e.g., its count may be loaded, and its value left to be
+// loaded by the next call).  Sharded collectors are typically obtained from a
+// 'balm::CollectorRepository' (or 'balm::MetricsManager') configured with a
+// number of collector shards, rather than created directly.
+//
 ///Thread Safety
 ///-------------
 // 'balm::Collector' is fully *thread-safe*, meaning that all non-creator
@@ -97,6 +115,10 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 #include <bslmt_lockguard.h>
 #endif
 
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
 #ifndef INCLUDED_BSL_ALGORITHM
 #include <bsl_algorithm.h>
 #endif
@@ -106,6 +128,8 @@ namespace BloombergLP {
 
 namespace balm {
 
+struct Collector_Shard;  // defined in implementation
+
                               // ===============
                               // class Collector
                               // ===============
@@ -121,13 +145,49 @@ class Collector {
     // the default maximum value is 'MetricRecord::k_DEFAULT_MAX'.
 
     // DATA
-    MetricRecord         d_record;  // the recorded metric information
-    mutable bslmt::Mutex d_lock;    // record synchronization mechanism
+    MetricRecord         d_record;         // the recorded metric information
+    mutable bslmt::Mutex d_lock;           // record synchronization mechanism
+
+    Collector_Shard     *d_shards_p;       // cache-line-aligned array of
+                                           // 'd_numShards' shards, or 0 if
+                                           // values are aggregated in
+                                           // 'd_record'
+
+    void                *d_shardBuffer_p;  // memory holding 'd_shards_p'
+                                           // (owned)
+
+    int                  d_numShards;      // number of shards
+
+    bslma::Allocator    *d_allocator_p;    // allocator (held, not owned)
 
     // NOT IMPLEMENTED
     Collector(const Collector&);
     Collector& operator=(const Collector&);
 
+    // PRIVATE MANIPULATORS
+    void loadAndResetShards(MetricRecord *record);
+        // Load into the specified 'record' the id of the metric being
+        // collected, as well as the count, total, minimum, and maximum
+        // aggregated values merged from the shards of this collector, and
+        // reset each shard to its default state as it is merged.  The
+        // behavior is undefined unless this collector is sharded.
+
+    void resetShards();
+        // Reset each shard of this collector to its default state.  The
+        // behavior is undefined unless this collector is sharded.
+
+    void updateShard(int count, double total, double min, double max);
+        // Aggregate the specified 'count', 'total', 'min', and 'max' into the
+        // shard updated by the calling thread.  The behavior is undefined
+        // unless this collector is sharded.
+
+    // PRIVATE ACCESSORS
+    void loadShards(MetricRecord *record) const;
+        // Load into the specified 'record' the id of the metric being
+        // collected, as well as the count, total, minimum, and maximum
+        // aggregated values merged from the shards of this collector.  The
+        // behavior is undefined unless this collector is sharded.
+
   public:
      // CREATORS
     Collector(const MetricId& metricId);
@@ -136,6 +196,19 @@ class Collector {
         // 'MetricRecord::k_DEFAULT_MIN', and max of
         // 'MetricRecord::k_DEFAULT_MAX'.
 
+    Collector(const MetricId&   metricId,
+              int               numShards,
+              bslma::Allocator *basicAllocator = 0);
+        // Create a collector for a metric having the specified 'metricId',
+        // and having an initial count of 0, total of 0.0, min of
+        // 'MetricRecord::k_DEFAULT_MIN', and max of
+        // 'MetricRecord::k_DEFAULT_MAX', that aggregates values in the
+        // specified 'numShards' lock-free shards if '0 < numShards', and under
+        // a mutex otherwise (see {Sharded Collectors}).  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 <= numShards'.
+
     ~Collector();
         // Destroy this object.
 
@@ -177,7 +250,9 @@ class Collector {
     void setCountTotalMinMax(int count, double total, double min, double max);
         // Set the event count to the specified 'count', the total aggregate to
         // the specified 'total', the minimum aggregate to the specified 'min'
-        // and the maximum aggregate to the specified 'max'.
+        // and the maximum aggregate to the specified 'max'.  Note that, if
+        // this collector is sharded, this operation is not atomic with respect
+        // to concurrent updates.
 
     // ACCESSORS
     const MetricId& metricId() const;
@@ -188,6 +263,10 @@ class Collector {
         // Load into the specified 'record' the id of the metric being
         // collected, as well as the current count, total, minimum, and
         // maximum aggregated values for the metric.
+
+    int numShards() const;
+        // Return the number of shards in which this collector aggregates
+        // values, or 0 if this collector is not sharded.
 };
 
 // ============================================================================
@@ -203,11 +282,10 @@ inline
 Collector::Collector(const MetricId& metricId)
 : d_record(metricId)
 , d_lock()
-{
-}
-
-inline
-Collector::~Collector()
+, d_shards_p(0)
+, d_shardBuffer_p(0)
+, d_numShards(0)
+, d_allocator_p(0)
 {
 }
 
@@ -215,6 +293,11 @@ Collector::~Collector()
 inline
 void Collector::reset()
 {
+    if (d_shards_p) {
+        resetShards();
+        return;                                                       // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
     d_record.count() = 0;
     d_record.total() = 0.0;
@@ -225,6 +308,11 @@ void Collector::reset()
 inline
 void Collector::loadAndReset(MetricRecord *record)
 {
+    if (d_shards_p) {
+        loadAndResetShards(record);
+        return;                                                       // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
     *record          = d_record;
     d_record.count() = 0;
@@ -236,6 +324,11 @@ void Collector::loadAndReset(MetricRecord *record)
 inline
 void Collector::update(double value)
 {
+    if (d_shards_p) {
+        updateShard(1, value, value, value);
+        return;                                                       // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
     ++d_record.count();
     d_record.total() += value;
@@ -249,6 +342,11 @@ void Collector::accumulateCountTotalMinMax(int    count,
                                            double min,
                                            double max)
 {
+    if (d_shards_p) {
+        updateShard(count, total, min, max);
+        return;                                                       // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
     d_record.count() += count;
     d_record.total() += total;
@@ -262,6 +360,12 @@ void Collector::setCountTotalMinMax(int    count,
                                     double min,
                                     double max)
 {
+    if (d_shards_p) {
+        resetShards();
+        updateShard(count, total, min, max);
+        return;                                                       // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
     d_record.count() = count;
     d_record.total() = total;
@@ -279,9 +383,20 @@ const MetricId& Collector::metricId() const
 inline
 void Collector::load(MetricRecord *record) const
 {
+    if (d_shards_p) {
+        loadShards(record);
+        return;                                                       // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
     *record = d_record;
 }
+
+inline
+int Collector::numShards() const
+{
+    return d_numShards;
+}
 }  // close package namespace
 
 }  // close enterprise namespace
@@ -0,0 +1,53 @@
+// balm_collector_shardutil.cpp                                       -*-C++-*-
+#include <balm_collector_shardutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_collector_shardutil_cpp,"$Id$ $CSID$")
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                         // --------------------------
+                         // struct Collector_ShardUtil
+                         // --------------------------
+
+// CLASS METHODS
+void *Collector_ShardUtil::allocateAligned(void             **buffer,
+                                           bsl::size_t        size,
+                                           bslma::Allocator  *allocator)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(allocator);
+
+    // Over-allocate by one cache line so that the returned address can be
+    // aligned on a cache line boundary.
+
+    *buffer = allocator->allocate(size + k_CACHE_LINE_SIZE);
+
+    char *address = static_cast<char *>(*buffer);
+    return address + bsls::AlignmentUtil::calculateAlignmentOffset(
+                                                           address,
+                                                           k_CACHE_LINE_SIZE);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
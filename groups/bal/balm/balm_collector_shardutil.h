@@ -0,0 +1,293 @@
+// balm_collector_shardutil.h                                         -*-C++-*-
+#ifndef INCLUDED_BALM_COLLECTOR_SHARDUTIL
+#define INCLUDED_BALM_COLLECTOR_SHARDUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities shared by the sharded 'balm' collectors.
+//
+//@CLASSES:
+//   balm::Collector_ShardUtil: helpers for lock-free, per-thread shards
+//
+//@SEE_ALSO: balm_collector, balm_integercollector, balm_histogramcollector
+//
+//@DESCRIPTION: This component provides a 'struct',
+// 'balm::Collector_ShardUtil', holding the operations shared by the collectors
+// that aggregate values in lock-free, cache-line-aligned shards
+// ('balm::Collector', 'balm::IntegerCollector', and
+// 'balm::HistogramCollector'): selecting the shard updated by the calling
+// thread, allocating an array of shards aligned on a cache line boundary, and
+// atomically aggregating a value into a total, minimum, or maximum.  'double'
+// aggregates are stored in 64-bit atomic integers holding their bit patterns,
+// which 'toBits' and 'fromBits' convert.
+//
+// This component is for use by the 'balm' collectors only, and should not be
+// used directly.
+//
+///Usage
+///-----
+// The following example aggregates values into the minimum held by one of
+// several shards.  First, we allocate an array of 4 shards, each holding the
+// bit pattern of a 'double' minimum, and initialize them:
+//..
+//  typedef bsls::AtomicOperations::AtomicTypes::Int64 AtomicInt64;
+//
+//  bslma::Allocator *allocator = bslma::Default::allocator();
+//
+//  void        *buffer;
+//  AtomicInt64 *shards = static_cast<AtomicInt64 *>(
+//                 balm::Collector_ShardUtil::allocateAligned(
+//                                                    &buffer,
+//                                                    4 * sizeof(AtomicInt64),
+//                                                    allocator));
+//  for (int i = 0; i < 4; ++i) {
+//      bsls::AtomicOperations::initInt64(
+//                          shards + i,
+//                          balm::Collector_ShardUtil::toBits(1000.0));
+//  }
+//..
+// Then, we aggregate a value into the shard selected for the calling thread:
+//..
+//  AtomicInt64 *shard = shards + balm::Collector_ShardUtil::shardIndex(4);
+//  balm::Collector_ShardUtil::updateMin(shard, 42.0);
+//
+//  assert(42.0 == balm::Collector_ShardUtil::fromBits(
+//                            bsls::AtomicOperations::getInt64Acquire(shard)));
+//..
+// Finally, we release the memory holding the shards:
+//..
+//  allocator->deallocate(buffer);
+//..
+
+#ifndef INCLUDED_BALSCM_VERSION
+#include <balscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADUTIL
+#include <bslmt_threadutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTRING
+#include <bsl_cstring.h>
+#endif
+
+namespace BloombergLP {
+namespace balm {
+
+                         // ==========================
+                         // struct Collector_ShardUtil
+                         // ==========================
+
+struct Collector_ShardUtil {
+    // This 'struct' provides a namespace for the operations shared by the
+    // sharded 'balm' collectors.
+
+    // PUBLIC TYPES
+    typedef bsls::AtomicOperations::AtomicTypes::Int   AtomicInt;
+    typedef bsls::AtomicOperations::AtomicTypes::Int64 AtomicInt64;
+
+    // PUBLIC CONSTANTS
+    enum { k_CACHE_LINE_SIZE = 64 };  // assumed size of a cache line, in
+                                      // bytes
+
+    // CLASS METHODS
+    static void *allocateAligned(void             **buffer,
+                                 bsl::size_t        size,
+                                 bslma::Allocator  *allocator);
+        // Allocate from the specified 'allocator' a block of memory holding
+        // at least the specified 'size' bytes starting on a cache line
+        // boundary, load into the specified 'buffer' the address of that
+        // block, to be supplied to 'allocator->deallocate', and return the
+        // address of its first cache-line-aligned byte.
+
+    static double fromBits(bsls::Types::Int64 bits);
+        // Return the 'double' value having the specified 'bits' pattern.
+
+    static int shardIndex(int numShards);
+        // Return the index, in the range '[0 .. numShards - 1]', of the shard
+        // updated by the calling thread among the specified 'numShards'
+        // shards.  The behavior is undefined unless '0 < numShards'.
+
+    static bsls::Types::Int64 toBits(double value);
+        // Return the bit pattern of the specified 'value'.
+
+    static void addDouble(AtomicInt64 *bits, double value);
+        // Atomically add the specified 'value' to the 'double' whose bit
+        // pattern is held by the specified 'bits'.
+
+    static void updateMax(AtomicInt *current, int value);
+    static void updateMax(AtomicInt64 *bits, double value);
+        // Atomically set the specified 'current' value (or the 'double' whose
+        // bit pattern is held by the specified 'bits') to the specified
+        // 'value' if 'value' is greater.
+
+    static void updateMin(AtomicInt *current, int value);
+    static void updateMin(AtomicInt64 *bits, double value);
+        // Atomically set the specified 'current' value (or the 'double' whose
+        // bit pattern is held by the specified 'bits') to the specified
+        // 'value' if 'value' is less.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                         // --------------------------
+                         // struct Collector_ShardUtil
+                         // --------------------------
+
+// CLASS METHODS
+inline
+double Collector_ShardUtil::fromBits(bsls::Types::Int64 bits)
+{
+    double value;
+    bsl::memcpy(&value, &bits, sizeof value);
+    return value;
+}
+
+inline
+int Collector_ShardUtil::shardIndex(int numShards)
+{
+    // Thread ids are typically addresses, whose low-order bits are constant;
+    // mix all of their bits into the high-order half before reducing.
+
+    const bsls::Types::Uint64 hash = bslmt::ThreadUtil::selfIdAsUint64()
+                                   * 0x9E3779B97F4A7C15ULL;
+    return static_cast<int>((hash >> 32) % numShards);
+}
+
+inline
+bsls::Types::Int64 Collector_ShardUtil::toBits(double value)
+{
+    bsls::Types::Int64 bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+    return bits;
+}
+
+inline
+void Collector_ShardUtil::addDouble(AtomicInt64 *bits, double value)
+{
+    typedef bsls::AtomicOperations AtomicOps;
+
+    bsls::Types::Int64 current = AtomicOps::getInt64Relaxed(bits);
+    for (;;) {
+        const bsls::Types::Int64 previous = AtomicOps::testAndSwapInt64AcqRel(
+                                           bits,
+                                           current,
+                                           toBits(fromBits(current) + value));
+        if (previous == current) {
+            break;
+        }
+        current = previous;
+    }
+}
+
+inline
+void Collector_ShardUtil::updateMax(AtomicInt *current, int value)
+{
+    typedef bsls::AtomicOperations AtomicOps;
+
+    int expected = AtomicOps::getIntRelaxed(current);
+    while (value > expected) {
+        const int previous = AtomicOps::testAndSwapIntAcqRel(current,
+                                                             expected,
+                                                             value);
+        if (previous == expected) {
+            break;
+        }
+        expected = previous;
+    }
+}
+
+inline
+void Collector_ShardUtil::updateMax(AtomicInt64 *bits, double value)
+{
+    typedef bsls::AtomicOperations AtomicOps;
+
+    bsls::Types::Int64 current = AtomicOps::getInt64Relaxed(bits);
+    while (value > fromBits(current)) {
+        const bsls::Types::Int64 previous = AtomicOps::testAndSwapInt64AcqRel(
+                                                                bits,
+                                                                current,
+                                                                toBits(value));
+        if (previous == current) {
+            break;
+        }
+        current = previous;
+    }
+}
+
+inline
+void Collector_ShardUtil::updateMin(AtomicInt *current, int value)
+{
+    typedef bsls::AtomicOperations AtomicOps;
+
+    int expected = AtomicOps::getIntRelaxed(current);
+    while (value < expected) {
+        const int previous = AtomicOps::testAndSwapIntAcqRel(current,
+                                                             expected,
+                                                             value);
+        if (previous == expected) {
+            break;
+        }
+        expected = previous;
+    }
+}
+
+inline
+void Collector_ShardUtil::updateMin(AtomicInt64 *bits, double value)
+{
+    typedef bsls::AtomicOperations AtomicOps;
+
+    bsls::Types::Int64 current = AtomicOps::getInt64Relaxed(bits);
+    while (value < fromBits(current)) {
+        const bsls::Types::Int64 previous = AtomicOps::testAndSwapInt64AcqRel(
+                                                                bits,
+                                                                current,
+                                                                toBits(value));
+        if (previous == current) {
+            break;
+        }
+        current = previous;
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,445 @@
+// balm_collector_shardutil.t.cpp                                     -*-C++-*-
+#include <balm_collector_shardutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_types.h>
+
+#include <bsl_cfloat.h>
+#include <bsl_climits.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+#include <bslim_testutil.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'balm::Collector_ShardUtil' is a utility providing the operations shared by
+// the sharded 'balm' collectors.  We verify each operation single-threaded,
+// then verify that concurrent aggregations are never lost.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] void *allocateAligned(void **, bsl::size_t, bslma::Allocator *);
+// [ 2] double fromBits(bsls::Types::Int64 bits);
+// [ 2] int shardIndex(int numShards);
+// [ 2] bsls::Types::Int64 toBits(double value);
+// [ 3] void addDouble(AtomicInt64 *bits, double value);
+// [ 3] void updateMax(AtomicInt *current, int value);
+// [ 3] void updateMax(AtomicInt64 *bits, double value);
+// [ 3] void updateMin(AtomicInt *current, int value);
+// [ 3] void updateMin(AtomicInt64 *bits, double value);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCURRENCY TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        bsl::cout << "Error " << __FILE__ << "(" << i << "): " << s
+                  << "    (failed)" << bsl::endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::Collector_ShardUtil   Util;
+typedef Util::AtomicInt             AtomicInt;
+typedef Util::AtomicInt64           AtomicInt64;
+typedef bsls::AtomicOperations      AtomicOps;
+
+// ============================================================================
+//                     GLOBAL CLASSES/FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+void aggregate(AtomicInt64    *total,
+               AtomicInt      *min,
+               AtomicInt      *max,
+               bslmt::Barrier *barrier,
+               int             first,
+               int             numValues)
+    // Wait on the specified 'barrier', then aggregate each of the values in
+    // the range '[first .. first + numValues - 1]' into the specified
+    // 'total', 'min', and 'max'.
+{
+    barrier->wait();
+    for (int i = first; i < first + numValues; ++i) {
+        Util::addDouble(total, i);
+        Util::updateMin(min, i);
+        Util::updateMax(max, i);
+    }
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
+
+    bslma::TestAllocator testAllocator;
+    bslma::TestAllocator defaultAllocator;
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //
+        // Concerns:
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove leading
+        //   comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Usage Example"
+                          << "\n=====================" << endl;
+
+///Usage
+///-----
+// The following example aggregates values into the minimum held by one of
+// several shards.  First, we allocate an array of 4 shards, each holding the
+// bit pattern of a 'double' minimum, and initialize them:
+//..
+    typedef bsls::AtomicOperations::AtomicTypes::Int64 AtomicInt64;
+
+    bslma::Allocator *allocator = bslma::Default::allocator();
+
+    void        *buffer;
+    AtomicInt64 *shards = static_cast<AtomicInt64 *>(
+                   balm::Collector_ShardUtil::allocateAligned(
+                                                      &buffer,
+                                                      4 * sizeof(AtomicInt64),
+                                                      allocator));
+    for (int i = 0; i < 4; ++i) {
+        bsls::AtomicOperations::initInt64(
+                            shards + i,
+                            balm::Collector_ShardUtil::toBits(1000.0));
+    }
+//..
+// Then, we aggregate a value into the shard selected for the calling thread:
+//..
+    AtomicInt64 *shard = shards + balm::Collector_ShardUtil::shardIndex(4);
+    balm::Collector_ShardUtil::updateMin(shard, 42.0);
+
+    ASSERT(42.0 == balm::Collector_ShardUtil::fromBits(
+                              bsls::AtomicOperations::getInt64Acquire(shard)));
+//..
+// Finally, we release the memory holding the shards:
+//..
+    allocator->deallocate(buffer);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Aggregations performed concurrently from several threads into
+        //:   the same total, minimum, and maximum are never lost.
+        //
+        // Plan:
+        //: 1 Aggregate disjoint ranges of values from several threads started
+        //:   together, and verify the resulting total, minimum, and maximum.
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCURRENCY TEST"
+                          << "\n================" << endl;
+
+        const int k_NUM_THREADS = 8;
+        const int k_NUM_VALUES  = 10000;
+
+        AtomicInt64 total;
+        AtomicInt   min;
+        AtomicInt   max;
+        AtomicOps::initInt64(&total, Util::toBits(0.0));
+        AtomicOps::initInt(&min, INT_MAX);
+        AtomicOps::initInt(&max, INT_MIN);
+
+        bslmt::Barrier     barrier(k_NUM_THREADS);
+        bslmt::ThreadGroup threads(&testAllocator);
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            threads.addThread(bdlf::BindUtil::bind(&aggregate,
+                                                   &total,
+                                                   &min,
+                                                   &max,
+                                                   &barrier,
+                                                   1 + i * k_NUM_VALUES,
+                                                   k_NUM_VALUES));
+        }
+        threads.joinAll();
+
+        const double N = k_NUM_THREADS * k_NUM_VALUES;
+
+        ASSERTV(N * (N + 1) / 2 ==
+                         Util::fromBits(AtomicOps::getInt64Acquire(&total)));
+        ASSERTV(1 == AtomicOps::getIntAcquire(&min));
+        ASSERTV(k_NUM_THREADS * k_NUM_VALUES ==
+                                              AtomicOps::getIntAcquire(&max));
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING AGGREGATION
+        //
+        // Concerns:
+        //: 1 'addDouble' adds its value to the 'double' held as bits.
+        //:
+        //: 2 'updateMin' and 'updateMax' replace the current value only if
+        //:   the new value is, respectively, less or greater.
+        //
+        // Plan:
+        //: 1 Aggregate a sequence of values, and verify the result after each
+        //:   one.  (C-1..2)
+        //
+        // Testing:
+        //   void addDouble(AtomicInt64 *bits, double value);
+        //   void updateMax(AtomicInt *current, int value);
+        //   void updateMax(AtomicInt64 *bits, double value);
+        //   void updateMin(AtomicInt *current, int value);
+        //   void updateMin(AtomicInt64 *bits, double value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING AGGREGATION"
+                          << "\n===================" << endl;
+
+        const double VALUES[]   = { 3.5, -1.25, 7.0, 0.0, 7.0, -2.5 };
+        const int    NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        AtomicInt64 total, minBits, maxBits;
+        AtomicInt   minInt, maxInt;
+        AtomicOps::initInt64(&total,   Util::toBits(0.0));
+        AtomicOps::initInt64(&minBits, Util::toBits(DBL_MAX));
+        AtomicOps::initInt64(&maxBits, Util::toBits(-DBL_MAX));
+        AtomicOps::initInt(&minInt, INT_MAX);
+        AtomicOps::initInt(&maxInt, INT_MIN);
+
+        double expTotal = 0.0;
+        double expMin   = DBL_MAX;
+        double expMax   = -DBL_MAX;
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const double VALUE = VALUES[i];
+            const int    INT   = static_cast<int>(VALUE * 4);
+
+            expTotal += VALUE;
+            expMin    = VALUE < expMin ? VALUE : expMin;
+            expMax    = VALUE > expMax ? VALUE : expMax;
+
+            Util::addDouble(&total, VALUE);
+            Util::updateMin(&minBits, VALUE);
+            Util::updateMax(&maxBits, VALUE);
+            Util::updateMin(&minInt, INT);
+            Util::updateMax(&maxInt, INT);
+
+            ASSERTV(i, expTotal ==
+                         Util::fromBits(AtomicOps::getInt64Acquire(&total)));
+            ASSERTV(i, expMin ==
+                       Util::fromBits(AtomicOps::getInt64Acquire(&minBits)));
+            ASSERTV(i, expMax ==
+                       Util::fromBits(AtomicOps::getInt64Acquire(&maxBits)));
+            ASSERTV(i, static_cast<int>(expMin * 4) ==
+                                           AtomicOps::getIntAcquire(&minInt));
+            ASSERTV(i, static_cast<int>(expMax * 4) ==
+                                           AtomicOps::getIntAcquire(&maxInt));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING BITS, SHARD INDEX, AND ALLOCATION
+        //
+        // Concerns:
+        //: 1 'fromBits' is the inverse of 'toBits'.
+        //:
+        //: 2 'shardIndex' returns a valid index, which is the same on each
+        //:   call from the same thread.
+        //:
+        //: 3 'allocateAligned' returns a cache-line-aligned address within
+        //:   a block large enough to hold the requested size after it.
+        //
+        // Plan:
+        //: 1 Round-trip a set of values through 'toBits' and 'fromBits'.
+        //:   (C-1)
+        //:
+        //: 2 Call 'shardIndex' twice for a range of shard counts.  (C-2)
+        //:
+        //: 3 Allocate blocks of several sizes from a test allocator, and
+        //:   verify the alignment of the returned address, the size of the
+        //:   block, and that deallocating the loaded buffer frees it.  (C-3)
+        //
+        // Testing:
+        //   void *allocateAligned(void **, bsl::size_t, bslma::Allocator *);
+        //   double fromBits(bsls::Types::Int64 bits);
+        //   int shardIndex(int numShards);
+        //   bsls::Types::Int64 toBits(double value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING BITS, SHARD INDEX, AND ALLOCATION"
+                          << "\n=========================================="
+                          << endl;
+
+        const double VALUES[]   = { 0.0, -0.0, 1.0, -1.5, DBL_MAX, -DBL_MAX,
+                                    DBL_MIN, 1e-300 };
+        const int    NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            ASSERTV(i, VALUES[i] == Util::fromBits(Util::toBits(VALUES[i])));
+        }
+        ASSERT(Util::toBits(0.0) != Util::toBits(-0.0));
+
+        for (int n = 1; n <= 64; ++n) {
+            const int INDEX = Util::shardIndex(n);
+            ASSERTV(n, INDEX, 0 <= INDEX && INDEX < n);
+            ASSERTV(n, INDEX == Util::shardIndex(n));
+        }
+
+        const bsl::size_t SIZES[]   = { 1, 8, 63, 64, 65, 1000 };
+        const int         NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            void *buffer  = 0;
+            void *address = Util::allocateAligned(&buffer,
+                                                  SIZES[i],
+                                                  &testAllocator);
+
+            ASSERTV(i, 1 == testAllocator.numBlocksInUse());
+            ASSERTV(i, 0 == bsls::AlignmentUtil::calculateAlignmentOffset(
+                                                    address,
+                                                    Util::k_CACHE_LINE_SIZE));
+            ASSERTV(i, static_cast<char *>(buffer) <=
+                                                 static_cast<char *>(address));
+            ASSERTV(i, static_cast<char *>(address) + SIZES[i] <=
+                       static_cast<char *>(buffer)
+                                    + testAllocator.lastAllocatedNumBytes());
+
+            testAllocator.deallocate(buffer);
+            ASSERTV(i, 0 == testAllocator.numBlocksInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Aggregate a few values into a sharded total.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        void        *buffer;
+        AtomicInt64 *shards = static_cast<AtomicInt64 *>(
+                                Util::allocateAligned(&buffer,
+                                                      4 * sizeof *shards,
+                                                      &testAllocator));
+        for (int i = 0; i < 4; ++i) {
+            AtomicOps::initInt64(shards + i, Util::toBits(0.0));
+        }
+
+        AtomicInt64 *shard = shards + Util::shardIndex(4);
+        Util::addDouble(shard, 1.5);
+        Util::addDouble(shard, 2.5);
+
+        double total = 0.0;
+        for (int i = 0; i < 4; ++i) {
+            total += Util::fromBits(AtomicOps::getInt64Acquire(shards + i));
+        }
+        ASSERTV(total, 4.0 == total);
+
+        testAllocator.deallocate(buffer);
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      }
+    }
+
+    ASSERT(0 == testAllocator.numBlocksInUse());
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << bsl::endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
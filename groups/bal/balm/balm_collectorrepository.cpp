@@ -12,6 +12,7 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balm_collectorrepository_cpp,"$Id$ $CSID$")
 
+#include <balm_histogram.h>
 #include <balm_metricid.h>
 
 #include <bslmt_readlockguard.h>
@@ -78,6 +79,8 @@ class CollectorRepository_Collectors {
     // DATA
     COLLECTOR         d_defaultCollector;  // default collector
     CollectorSet      d_addedCollectors;   // added collectors
+    int               d_numShards;         // number of shards of each
+                                           // collector
     bslma::Allocator *d_allocator_p;       // allocator (held, not owned)
 
     // NOT IMPLEMENTED
@@ -92,14 +95,17 @@ class CollectorRepository_Collectors {
 
     // CREATORS
     CollectorRepository_Collectors(const MetricId&   metricId,
+                                   int               numShards,
                                    bslma::Allocator *basicAllocator = 0);
         // Create a 'CollectorRepository_Collectors' object to hold
         // objects of the templatized type 'COLLECTOR' for the specified
-        // 'metricId'.   Optionally specify a 'basicAllocator' used to supply
-        // memory.  If 'basicAllocator' is 0, the currently installed default
-        // allocator is used.  The behavior is undefined unless the
+        // 'metricId', each having the specified 'numShards' shards (see
+        // 'balm_collector').  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless the
         // templatized type 'COLLECTOR' is either 'Collector' or
-        // 'IntegerCollector', and 'metricId.isValid()' is 'true'.
+        // 'IntegerCollector', 'metricId.isValid()' is 'true', and
+        // '0 <= numShards'.
 
     ~CollectorRepository_Collectors();
         // Destroy this object.
@@ -158,9 +164,11 @@ class CollectorRepository_Collectors {
 template <class COLLECTOR>
 CollectorRepository_Collectors<COLLECTOR>::
       CollectorRepository_Collectors(const MetricId&   metricId,
+                                     int               numShards,
                                      bslma::Allocator *basicAllocator)
-: d_defaultCollector(metricId)
+: d_defaultCollector(metricId, numShards, basicAllocator)
 , d_addedCollectors(basicAllocator)
+, d_numShards(numShards)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -186,7 +194,9 @@ bsl::shared_ptr<COLLECTOR>
 CollectorRepository_Collectors<COLLECTOR>::addCollector()
 {
     Collector collectorPtr(
-                new (*d_allocator_p) COLLECTOR(d_defaultCollector.metricId()),
+                new (*d_allocator_p) COLLECTOR(d_defaultCollector.metricId(),
+                                               d_numShards,
+                                               d_allocator_p),
                 d_allocator_p);
     d_addedCollectors.insert(collectorPtr);
     return collectorPtr;
@@ -256,29 +266,51 @@ CollectorRepository_Collectors<COLLECTOR>::metricId() const
 
 class CollectorRepository_MetricCollectors {
     // This implementation class provides a container mechanism for managing
-    // the 'Collector' and 'IntegerCollector' objects associated with a single
-    // metric.  The 'collector' and 'intCollector' methods are provided to
-    // access the individual containers for 'Collector' objects and
-    // 'IntegerCollector' objects, respectively.   The 'collectAndReset' method
-    // obtains the aggregate value of all the owned collectors and integer
-    // collectors, and then resets those collectors and integer collectors to
-    // their default state.
+    // the 'Collector', 'IntegerCollector', and 'HistogramCollector' objects
+    // associated with a single metric.  The 'collector' and 'intCollector'
+    // methods are provided to access the individual containers for
+    // 'Collector' objects and 'IntegerCollector' objects, respectively.
+    // Histogram collectors, which are comparatively large, are created only
+    // on demand, by 'defaultHistogramCollector' and 'addHistogramCollector'.
+    // The 'collectAndReset' method obtains the aggregate value of all the
+    // owned collectors, integer collectors, and histogram collectors, and
+    // then resets those collectors to their default state.
 
     // PRIVATE TYPES
     typedef CollectorRepository_Collectors<Collector>
                                                         Collectors;
     typedef CollectorRepository_Collectors<IntegerCollector>
                                                         IntCollectors;
+    typedef bsl::shared_ptr<HistogramCollector>         HistogramCollectorSPtr;
+    typedef bsl::set<HistogramCollectorSPtr>            HistogramCollectorSet;
 
     // DATA
-    Collectors    d_collectors;     // collector objects
-    IntCollectors d_intCollectors;  // integer collector objects
+    Collectors             d_collectors;     // collector objects
+    IntCollectors          d_intCollectors;  // integer collector objects
+    HistogramCollectorSPtr d_defaultHistogramCollector;
+                                             // default histogram collector,
+                                             // or null if not yet created
+    HistogramCollectorSet  d_addedHistogramCollectors;
+                                             // added histogram collectors
+    int                    d_numHistogramShards;
+                                             // number of shards of each
+                                             // histogram collector
+    bslma::Allocator      *d_allocator_p;    // allocator (held, not owned)
 
     // NOT IMPLEMENTED
     CollectorRepository_MetricCollectors(
                            const  CollectorRepository_MetricCollectors& );
     CollectorRepository_MetricCollectors& operator=(
                            const  CollectorRepository_MetricCollectors& );
+
+    // PRIVATE MANIPULATORS
+    void collectHistograms(MetricRecord *record, bool resetFlag);
+        // Aggregate into the specified 'record' the values of the histogram
+        // collectors owned by this object, if any, and set the histogram of
+        // 'record' to the histogram merged from those collectors.  If the
+        // specified 'resetFlag' is 'true', reset those collectors to their
+        // default values.
+
   public:
     // PUBLIC TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(CollectorRepository_MetricCollectors,
@@ -286,13 +318,17 @@ class CollectorRepository_MetricCollectors {
 
     // CREATORS
     CollectorRepository_MetricCollectors(const MetricId&   id,
+                                         int               numShards,
                                          bslma::Allocator *basicAllocator = 0);
         // Create a 'CollectorRepository_MetricCollectors' object to hold
-        // collector and integer collector objects for the specified
-        // 'metricId'.   Optionally specify a 'basicAllocator' used to supply
-        // memory.  If 'basicAllocator' is 0, the currently installed default
-        // allocator is used.  The behavior is undefined unless
-        // 'metricId.isValid()' is 'true'.
+        // collector, integer collector, and histogram collector objects for
+        // the specified 'metricId', each having the specified 'numShards'
+        // shards (or, for histogram collectors, a single shard if
+        // 'numShards' is 0).
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'metricId.isValid()' is
+        // 'true' and '0 <= numShards'.
 
     ~CollectorRepository_MetricCollectors();
         // Destroy this object.
@@ -306,6 +342,14 @@ class CollectorRepository_MetricCollectors {
         // Return a reference to the modifiable container of
         // 'IntegerCollector' objects.
 
+    HistogramCollector *defaultHistogramCollector();
+        // Return the address of the modifiable default histogram collector,
+        // creating it if it does not already exist.
+
+    bsl::shared_ptr<HistogramCollector> addHistogramCollector();
+        // Create a new histogram collector, add it to this container, and
+        // return a shared pointer to it.
+
     void collectAndReset(MetricRecord *record);
         // Load into the specified 'record' the aggregate value of all the
         // records collected by the collectors owned by this object; then
@@ -332,6 +376,10 @@ class CollectorRepository_MetricCollectors {
         // Return a reference to the non-modifiable container of
         // 'IntegerCollector' objects.
 
+    HistogramCollector *findDefaultHistogramCollector() const;
+        // Return the address of the modifiable default histogram collector,
+        // or 0 if it has not been created.
+
     const MetricId& metricId() const;
         // Return a reference to the non-modifiable 'MetricId' object
         // identifying the metric for which the collectors in this container
@@ -346,9 +394,14 @@ class CollectorRepository_MetricCollectors {
 inline
 CollectorRepository_MetricCollectors::
 CollectorRepository_MetricCollectors(const MetricId&   id,
+                                     int               numShards,
                                      bslma::Allocator *basicAllocator)
-: d_collectors(id, basicAllocator)
-, d_intCollectors(id, basicAllocator)
+: d_collectors(id, numShards, basicAllocator)
+, d_intCollectors(id, numShards, basicAllocator)
+, d_defaultHistogramCollector()
+, d_addedHistogramCollectors(basicAllocator)
+, d_numHistogramShards(bsl::max(numShards, 1))
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
 
@@ -358,6 +411,46 @@ CollectorRepository_MetricCollectors::
 {
 }
 
+// PRIVATE MANIPULATORS
+void CollectorRepository_MetricCollectors::collectHistograms(
+                                                       MetricRecord *record,
+                                                       bool          resetFlag)
+{
+    if (!d_defaultHistogramCollector && d_addedHistogramCollectors.empty()) {
+        return;                                                       // RETURN
+    }
+
+    bsl::shared_ptr<Histogram> histogram;
+    histogram.createInplace(d_allocator_p, d_allocator_p);
+
+    Histogram tempHistogram(d_allocator_p);
+    if (d_defaultHistogramCollector) {
+        if (resetFlag) {
+            d_defaultHistogramCollector->loadAndReset(histogram.get());
+        }
+        else {
+            d_defaultHistogramCollector->load(histogram.get());
+        }
+    }
+    HistogramCollectorSet::iterator it = d_addedHistogramCollectors.begin();
+    for (; it != d_addedHistogramCollectors.end(); ++it) {
+        if (resetFlag) {
+            (*it)->loadAndReset(&tempHistogram);
+        }
+        else {
+            (*it)->load(&tempHistogram);
+        }
+        histogram->merge(tempHistogram);
+    }
+
+    combine(record, MetricRecord(metricId(),
+                                 static_cast<int>(histogram->count()),
+                                 histogram->total(),
+                                 histogram->min(),
+                                 histogram->max()));
+    record->histogram() = histogram;
+}
+
 // MANIPULATORS
 inline
 CollectorRepository_Collectors<Collector>&
@@ -373,6 +466,30 @@ CollectorRepository_MetricCollectors::intCollectors()
     return d_intCollectors;
 }
 
+HistogramCollector *
+CollectorRepository_MetricCollectors::defaultHistogramCollector()
+{
+    if (!d_defaultHistogramCollector) {
+        d_defaultHistogramCollector.createInplace(d_allocator_p,
+                                                  metricId(),
+                                                  d_numHistogramShards,
+                                                  d_allocator_p);
+    }
+    return d_defaultHistogramCollector.get();
+}
+
+bsl::shared_ptr<HistogramCollector>
+CollectorRepository_MetricCollectors::addHistogramCollector()
+{
+    HistogramCollectorSPtr collectorPtr;
+    collectorPtr.createInplace(d_allocator_p,
+                               metricId(),
+                               d_numHistogramShards,
+                               d_allocator_p);
+    d_addedHistogramCollectors.insert(collectorPtr);
+    return collectorPtr;
+}
+
 void CollectorRepository_MetricCollectors::collectAndReset(
                                                           MetricRecord *record)
 {
@@ -380,6 +497,7 @@ void CollectorRepository_MetricCollectors::collectAndReset(
     MetricRecord tempRecord;
     d_intCollectors.collectAndReset(&tempRecord);
     combine(record, tempRecord);
+    collectHistograms(record, true);
 }
 
 void CollectorRepository_MetricCollectors::collect(MetricRecord *record)
@@ -388,6 +506,7 @@ void CollectorRepository_MetricCollectors::collect(MetricRecord *record)
     MetricRecord tempRecord;
     d_intCollectors.collect(&tempRecord);
     combine(record, tempRecord);
+    collectHistograms(record, false);
 }
 
 // ACCESSORS
@@ -405,6 +524,13 @@ CollectorRepository_MetricCollectors::intCollectors() const
     return d_intCollectors;
 }
 
+inline
+HistogramCollector *
+CollectorRepository_MetricCollectors::findDefaultHistogramCollector() const
+{
+    return d_defaultHistogramCollector.get();
+}
+
 inline
 const MetricId&
 CollectorRepository_MetricCollectors::metricId() const
@@ -429,8 +555,10 @@ CollectorRepository::getMetricCollectors(const MetricId& metricId)
         const Category *category = metricId.category();
 
         MetricCollectorsSPtr collectorsPtr(
-               new (*d_allocator_p) MetricCollectors(metricId, d_allocator_p),
-               d_allocator_p);
+                  new (*d_allocator_p) MetricCollectors(metricId,
+                                                        d_numCollectorShards,
+                                                        d_allocator_p),
+                  d_allocator_p);
 
         // To make this method exception safe: Reserve memory for inserting
         // 'collectorsPtr' into 'd_categories' before inserting it into
@@ -545,6 +673,31 @@ CollectorRepository::addIntegerCollector(const MetricId& metricId)
     return getMetricCollectors(metricId).intCollectors().addCollector();
 }
 
+HistogramCollector *CollectorRepository::getDefaultHistogramCollector(
+                                                      const MetricId& metricId)
+{
+    {
+        bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+        Collectors::iterator it = d_collectors.find(metricId);
+        if (it != d_collectors.end()) {
+            HistogramCollector *collector =
+                                   it->second->findDefaultHistogramCollector();
+            if (collector) {
+                return collector;                                     // RETURN
+            }
+        }
+    }
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    return getMetricCollectors(metricId).defaultHistogramCollector();
+}
+
+bsl::shared_ptr<HistogramCollector>
+CollectorRepository::addHistogramCollector(const MetricId& metricId)
+{
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    return getMetricCollectors(metricId).addHistogramCollector();
+}
+
 int CollectorRepository::getAddedCollectors(
                bsl::vector<bsl::shared_ptr<Collector> >         *collectors,
                bsl::vector<bsl::shared_ptr<IntegerCollector> >  *intCollectors,
@@ -20,7 +20,8 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //   balm::CollectorRepository: a repository for collectors
 //
-//@SEE_ALSO: balm_collector, balm_integercollector, balm_metricsmanager
+//@SEE_ALSO: balm_collector, balm_integercollector, balm_histogramcollector,
+//           balm_metricsmanager
 //
 //@DESCRIPTION: This component defines a class, 'balm::CollectorRepository',
 // that serves as a repository for 'balm::Collector' and
@@ -40,6 +41,33 @@ BSLS_IDENT("$Id: $")
 // collects and returns metric records from each of the collectors in the
 // repository.
 //
+///Histogram Collectors
+///--------------------
+// A collector repository also serves as a repository for
+// 'balm::HistogramCollector' objects, which collect a histogram of the values
+// of a metric from which percentiles of those values can be estimated (see
+// 'balm_histogramcollector').  The 'getDefaultHistogramCollector' and
+// 'addHistogramCollector' operations return the default histogram collector
+// for the supplied metric, and create a new histogram collector for it,
+// respectively.  Histogram collectors are created only on demand, so a
+// metric for which no histogram collector is requested incurs no overhead.
+// When a metric has histogram collectors, the record collected for that
+// metric aggregates their values with those of its other collectors, and
+// holds the histogram merged from every histogram collector for that metric
+// (see 'histogram' in 'balm_metricrecord').
+//
+///Sharded Collectors
+///------------------
+// A collector repository can instead be created with a number of *collector*
+// *shards*, in which case every collector, integer collector, and histogram
+// collector it creates (default or added) aggregates values in that many
+// lock-free, per-thread shards that are merged when the repository is
+// collected (see 'balm_collector' and 'balm_histogramcollector').  This
+// removes the contention on a single collector updated from many threads
+// without requiring clients to obtain additional collectors.  Histogram
+// collectors created by a repository having no collector shards have a single
+// shard.
+//
 ///Thread Safety
 ///-------------
 // 'balm::CollectorRepository' is fully *thread-safe*, meaning that all
@@ -111,6 +139,10 @@ BSLS_IDENT("$Id: $")
 #include <balm_collector.h>
 #endif
 
+#ifndef INCLUDED_BALM_HISTOGRAMCOLLECTOR
+#include <balm_histogramcollector.h>
+#endif
+
 #ifndef INCLUDED_BALM_INTEGERCOLLECTOR
 #include <balm_integercollector.h>
 #endif
@@ -143,6 +175,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_nestedtraitdeclaration.h>
 #endif
 
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
 #ifndef INCLUDED_BSL_MAP
 #include <bsl_map.h>
 #endif
@@ -200,6 +236,9 @@ class CollectorRepository {
     Collectors              d_collectors;  // collectors (owned)
     CategorizedCollectors   d_categories;  // map of category => collectors
     mutable bslmt::RWMutex  d_rwMutex;     // data lock
+    int                     d_numCollectorShards;
+                                           // number of shards of each
+                                           // collector
     bslma::Allocator       *d_allocator_p; // allocator (held, not owned)
 
     // NOT IMPLEMENTED
@@ -231,6 +270,21 @@ class CollectorRepository {
         // 'basicAllocator' is 0, the currently installed default allocator is
         // used.  The behavior is undefined if 'registry' is 0.
 
+    CollectorRepository(MetricRegistry        *registry,
+                        int                    numCollectorShards,
+                        bslma::Allocator      *basicAllocator = 0);
+        // Create an empty collector repository that will use the specified
+        // 'registry' to identify the metrics for which it manages collectors,
+        // and that creates collectors, integer collectors, and histogram
+        // collectors having the specified 'numCollectorShards' shards, if
+        // '0 < numCollectorShards', and non-sharded collectors (and histogram
+        // collectors having a single shard) otherwise (see
+        // {Sharded Collectors}).
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined if 'registry' is 0, or unless
+        // '0 <= numCollectorShards'.
+
     ~CollectorRepository();
         // Free all the collectors in this repository and destroy this object.
 
@@ -331,6 +385,49 @@ class CollectorRepository {
         // repository.  The behavior is undefined unless 'metricId' is a valid
         // id returned by the 'MetricRepository' supplied at construction.
 
+    HistogramCollector *getDefaultHistogramCollector(const char *category,
+                                                     const char *metricName);
+        // Return the address of the modifiable default histogram collector
+        // identified by the specified null-terminated strings 'category' and
+        // 'metricName'.  If a default histogram collector for the identified
+        // metric does not already exist in the repository, create one, add it
+        // to the repository, and return its address.  In addition, if the
+        // identified metric has not already been registered, add the
+        // identified metric to the 'metricRegistry' supplied at construction.
+        // Note that this operation is logically equivalent to:
+        //..
+        //  getDefaultHistogramCollector(registry().getId(category,
+        //                                                metricName))
+        //..
+
+    HistogramCollector *getDefaultHistogramCollector(const MetricId& metricId);
+        // Return the address of the modifiable default histogram collector
+        // identified by the specified 'metricId'.  If a default histogram
+        // collector for the identified metric does not already exist in the
+        // repository, create one, add it to the repository, and return its
+        // address.
+
+    bsl::shared_ptr<HistogramCollector> addHistogramCollector(
+                                                       const char *category,
+                                                       const char *metricName);
+        // Return a shared pointer to a newly-created modifiable histogram
+        // collector identified by the specified null-terminated strings
+        // 'category' and 'metricName', and add that collector to the
+        // repository.  If is not already registered, also add the identified
+        // metric to the 'metricRegistry' supplied at construction.  Note that
+        // this operation is logically equivalent to:
+        //..
+        //  addHistogramCollector(registry().getId(category, metricName))
+        //..
+
+    bsl::shared_ptr<HistogramCollector> addHistogramCollector(
+                                                     const MetricId& metricId);
+        // Return a shared pointer to a newly-created modifiable histogram
+        // collector identified by the specified 'metricId' and add that
+        // collector to the repository.  The behavior is undefined unless
+        // 'metricId' is a valid id returned by the 'MetricRepository'
+        // supplied at construction.
+
     int getAddedCollectors(
                bsl::vector<bsl::shared_ptr<Collector> >         *collectors,
                bsl::vector<bsl::shared_ptr<IntegerCollector> >  *intCollectors,
@@ -350,6 +447,11 @@ class CollectorRepository {
         // this collector repository.
 
     // ACCESSORS
+    int numCollectorShards() const;
+        // Return the number of shards of each collector and integer collector
+        // created by this collector repository, or 0 if the collectors it
+        // creates are not sharded.
+
     const MetricRegistry& registry() const;
         // Return a reference to the non-modifiable registry of metrics used by
         // this collector repository.
@@ -371,8 +473,23 @@ CollectorRepository::CollectorRepository(MetricRegistry   *registry,
 , d_collectors(basicAllocator)
 , d_categories(basicAllocator)
 , d_rwMutex()
+, d_numCollectorShards(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+inline
+CollectorRepository::CollectorRepository(MetricRegistry   *registry,
+                                         int               numCollectorShards,
+                                         bslma::Allocator *basicAllocator)
+: d_registry_p(registry)
+, d_collectors(basicAllocator)
+, d_categories(basicAllocator)
+, d_rwMutex()
+, d_numCollectorShards(numCollectorShards)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
+    BSLS_ASSERT_SAFE(0 <= numCollectorShards);
 }
 
 inline
@@ -413,6 +530,23 @@ CollectorRepository::addIntegerCollector(const char *category,
     return addIntegerCollector(d_registry_p->getId(category, metricName));
 }
 
+inline
+HistogramCollector *CollectorRepository::getDefaultHistogramCollector(
+                                                        const char *category,
+                                                        const char *metricName)
+{
+    return getDefaultHistogramCollector(d_registry_p->getId(category,
+                                                            metricName));
+}
+
+inline
+bsl::shared_ptr<HistogramCollector>
+CollectorRepository::addHistogramCollector(const char *category,
+                                           const char *metricName)
+{
+    return addHistogramCollector(d_registry_p->getId(category, metricName));
+}
+
 inline
 MetricRegistry& CollectorRepository::registry()
 {
@@ -420,6 +554,12 @@ MetricRegistry& CollectorRepository::registry()
 }
 
 // ACCESSORS
+inline
+int CollectorRepository::numCollectorShards() const
+{
+    return d_numCollectorShards;
+}
+
 inline
 const MetricRegistry& CollectorRepository::registry() const
 {
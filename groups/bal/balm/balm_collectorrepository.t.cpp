@@ -51,6 +51,7 @@ using bsl::flush;
 // ----------------------------------------------------------------------------
 // CREATORS
 // [ 2] CollectorRepository(MetricRegistry *, bslma::Allocator *);
+// [ 9] CollectorRepository(MetricRegistry *, int, bslma::Allocator *);
 // [ 2] ~CollectorRepository();
 // MANIPULATORS
 // [ 7] void collect(v<MetricRecord> *, const Category *);
@@ -63,16 +64,23 @@ using bsl::flush;
 // [ 2] addCollector(const MetricId& metricId);
 // [ 5] addIntegerCollector(const StringRef&, const StringRef&);
 // [ 2] addIntegerCollector(const MetricId&);
+// [10] getDefaultHistogramCollector(const char *, const char *);
+// [10] HistogramCollector *getDefaultHistogramCollector(const MetricId&);
+// [10] addHistogramCollector(const char *, const char *);
+// [10] addHistogramCollector(const MetricId&);
 // [ 2] int getAddedCollectors(v<C *> *, v<IC *> *, const MetricId&);
 // [ 2] MetricRegistry &registry();
 // [ 4] void collectAndReset(v<MetricRecord> *, const Category *);
 // ACCESSORS
 // [ 2] int getAddedCollectors(v<C*> *, v<IC*> *, MetricId& ) const;
 // [ 2] const MetricRegistry& registry() const;
+// [ 9] int numCollectorShards() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] CONCURRENCY TEST
-// [ 9] USAGE EXAMPLE
+// [ 9] SHARDED COLLECTORS
+// [10] HISTOGRAM COLLECTORS
+// [11] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -387,7 +395,7 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 11: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -464,6 +472,206 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING HISTOGRAM COLLECTORS
+        //
+        // Concerns:
+        //: 1 'getDefaultHistogramCollector' returns the same collector for a
+        //:   metric on every call, and 'addHistogramCollector' returns a new
+        //:   collector on every call, for the identified metric.
+        //:
+        //: 2 The records collected for a metric having histogram collectors
+        //:   aggregate the values of those collectors with the values of the
+        //:   other collectors for that metric, and hold the histogram merged
+        //:   from the histogram collectors.
+        //:
+        //: 3 The records collected for a metric having no histogram collector
+        //:   have no histogram.
+        //:
+        //: 4 'collect' does not reset the histogram collectors, and
+        //:   'collectAndReset' does.
+        //:
+        //: 5 All memory is supplied by the repository's allocator.
+        //
+        // Plan:
+        //: 1 Obtain default and added histogram collectors from a repository,
+        //:   and verify their identity and metric.  (C-1)
+        //:
+        //: 2 Update histogram collectors and regular collectors for a metric,
+        //:   and a regular collector for another metric, then verify the
+        //:   records returned by 'collect' and 'collectAndReset'.  (C-2..4)
+        //:
+        //: 3 Verify no memory is allocated from the default allocator.  (C-5)
+        //
+        // Testing:
+        //   getDefaultHistogramCollector(const char *, const char *);
+        //   HistogramCollector *getDefaultHistogramCollector(const MetricId&);
+        //   addHistogramCollector(const char *, const char *);
+        //   addHistogramCollector(const MetricId&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING HISTOGRAM COLLECTORS" << endl
+                                  << "============================" << endl;
+
+        {
+            Registry reg(Z);
+            Obj mX(&reg, Z);
+
+            const Id ID_A = reg.getId("A", "A");
+            const Id ID_B = reg.getId("A", "B");
+
+            balm::HistogramCollector *hcol =
+                                     mX.getDefaultHistogramCollector("A", "A");
+            ASSERT(0    != hcol);
+            ASSERT(ID_A == hcol->metricId());
+            ASSERT(hcol == mX.getDefaultHistogramCollector("A", "A"));
+            ASSERT(hcol == mX.getDefaultHistogramCollector(ID_A));
+
+            bsl::shared_ptr<balm::HistogramCollector> added =
+                                            mX.addHistogramCollector("A", "A");
+            ASSERT(ID_A        == added->metricId());
+            ASSERT(hcol        != added.get());
+            ASSERT(added.get() != mX.addHistogramCollector(ID_A).get());
+
+            hcol->update(1.0);
+            hcol->update(2.0);
+            added->update(3.0);
+            mX.getDefaultCollector("A", "A")->update(10.0);
+            mX.getDefaultCollector("A", "B")->update(4.0);
+
+            for (int reset = 0; reset < 2; ++reset) {
+                bsl::vector<Rec> records(Z);
+                if (reset) {
+                    mX.collectAndReset(&records, reg.getCategory("A"));
+                }
+                else {
+                    mX.collect(&records, reg.getCategory("A"));
+                }
+                LOOP_ASSERT(reset, 2 == records.size());
+
+                for (unsigned int i = 0; i < records.size(); ++i) {
+                    const Rec& R = records[i];
+                    if (ID_B == R.metricId()) {
+                        LOOP_ASSERT(reset, 1 == R.count());
+                        LOOP_ASSERT(reset, 0 == R.histogram());
+                        continue;                                   // CONTINUE
+                    }
+                    LOOP_ASSERT(reset, ID_A == R.metricId());
+                    LOOP_ASSERT(reset, 4    == R.count());
+                    LOOP_ASSERT(reset, 16.0 == R.total());
+                    LOOP_ASSERT(reset, 1.0  == R.min());
+                    LOOP_ASSERT(reset, 10.0 == R.max());
+                    LOOP_ASSERT(reset, 0    != R.histogram());
+                    if (R.histogram()) {
+                        const balm::Histogram& H = *R.histogram();
+                        LOOP_ASSERT(reset, 3   == H.count());
+                        LOOP_ASSERT(reset, 6.0 == H.total());
+                        LOOP_ASSERT(reset, 1.0 == H.min());
+                        LOOP_ASSERT(reset, 3.0 == H.max());
+                    }
+                }
+            }
+
+            bsl::vector<Rec> records(Z);
+            mX.collectAndReset(&records, reg.getCategory("A"));
+            ASSERT(2 == records.size());
+            for (unsigned int i = 0; i < records.size(); ++i) {
+                const Rec& R = records[i];
+                ASSERT(0 == R.count());
+                if (ID_A == R.metricId()) {
+                    ASSERT(0 != R.histogram());
+                    ASSERT(0 == R.histogram()->count());
+                }
+            }
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING SHARDED COLLECTORS
+        //
+        // Concerns:
+        //: 1 'numCollectorShards' returns the number of shards supplied at
+        //:   construction, or 0 for a repository created without one.
+        //:
+        //: 2 Every collector and integer collector provided by the repository,
+        //:   whether default or added, has 'numCollectorShards' shards.
+        //:
+        //: 3 The values of sharded collectors are collected and aggregated
+        //:   correctly by 'collectAndReset'.
+        //:
+        //: 4 All memory is supplied by the repository's allocator.
+        //
+        // Plan:
+        //: 1 Create repositories with a varying number of collector shards,
+        //:   obtain collectors of each kind, and verify the number of shards
+        //:   of each.  Update the collectors and verify the records returned
+        //:   by 'collectAndReset'.  Verify no memory is allocated from the
+        //:   default allocator.  (C-1..4)
+        //
+        // Testing:
+        //   CollectorRepository(MetricRegistry *, int, bslma::Allocator *);
+        //   int numCollectorShards() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING SHARDED COLLECTORS" << endl
+                                  << "==========================" << endl;
+
+        {
+            Registry reg(Z);
+            Obj mX(&reg, Z); const Obj& MX = mX;
+            ASSERT(0 == MX.numCollectorShards());
+            ASSERT(0 == mX.getDefaultCollector("A", "A")->numShards());
+            ASSERT(0 == mX.addIntegerCollector("A", "B")->numShards());
+        }
+
+        const int SHARDS[]   = { 0, 1, 4, 16 };
+        const int NUM_SHARDS = sizeof(SHARDS) / sizeof(*SHARDS);
+
+        for (int i = 0; i < NUM_SHARDS; ++i) {
+            const int NUM = SHARDS[i];
+
+            Registry reg(Z);
+            Obj mX(&reg, NUM, Z); const Obj& MX = mX;
+            LOOP_ASSERT(i, NUM == MX.numCollectorShards());
+
+            Col      *col       = mX.getDefaultCollector("A", "A");
+            ICol     *icol      = mX.getDefaultIntegerCollector("A", "A");
+            ColSPtr   addedCol  = mX.addCollector("A", "A");
+            IColSPtr  addedICol = mX.addIntegerCollector("A", "A");
+
+            LOOP_ASSERT(i, NUM == col->numShards());
+            LOOP_ASSERT(i, NUM == icol->numShards());
+            LOOP_ASSERT(i, NUM == addedCol->numShards());
+            LOOP_ASSERT(i, NUM == addedICol->numShards());
+
+            col->update(1.0);
+            icol->update(2);
+            addedCol->update(3.0);
+            addedICol->accumulateCountTotalMinMax(2, 10, 4, 6);
+
+            bsl::vector<Rec> records(Z);
+            mX.collectAndReset(&records, reg.getCategory("A"));
+            LOOP_ASSERT(i, 1 == records.size());
+            if (1 == records.size()) {
+                const Rec& R = records[0];
+                LOOP_ASSERT(i, col->metricId() == R.metricId());
+                LOOP_ASSERT(i, 5    == R.count());
+                LOOP_ASSERT(i, 16.0 == R.total());
+                LOOP_ASSERT(i, 1.0  == R.min());
+                LOOP_ASSERT(i, 6.0  == R.max());
+            }
+
+            records.clear();
+            mX.collectAndReset(&records, reg.getCategory("A"));
+            LOOP_ASSERT(i, 1 == records.size());
+            if (1 == records.size()) {
+                LOOP_ASSERT(i, 0 == records[0].count());
+            }
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // CONCURRENCY TEST
@@ -48,6 +48,21 @@ MetricsManager *DefaultMetricsManager::create(bslma::Allocator *basicAllocator)
     return s_singleton_p;
 }
 
+MetricsManager *DefaultMetricsManager::create(
+                                          int               numCollectorShards,
+                                          bslma::Allocator *basicAllocator)
+{
+    BSLS_ASSERT(0 == s_singleton_p);
+    BSLS_ASSERT(0 == s_allocator_p);
+    BSLS_ASSERT(0 <= numCollectorShards);
+
+    s_allocator_p = bslma::Default::globalAllocator(basicAllocator);
+    s_singleton_p = new (*s_allocator_p) MetricsManager(numCollectorShards,
+                                                        s_allocator_p);
+
+    return s_singleton_p;
+}
+
 MetricsManager *DefaultMetricsManager::create(bsl::ostream&     stream,
                                               bslma::Allocator *basicAllocator)
 {
@@ -163,6 +163,20 @@ struct DefaultMetricsManager {
         // publisher; clients must create a 'Publisher' and add it to the
         // default metrics manager in order to publish metrics.
 
+    static MetricsManager *create(int               numCollectorShards,
+                                  bslma::Allocator *basicAllocator = 0);
+        // Create the default 'MetricsManager' instance, whose collectors have
+        // the specified 'numCollectorShards' shards if
+        // '0 < numCollectorShards' and are not sharded otherwise (see
+        // 'balm_metricsmanager'), and return the address of the modifiable
+        // created instance.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // global allocator is used.  The behavior is undefined unless
+        // '0 <= numCollectorShards' and '0 == MetricsManager::instance()'
+        // prior to calling this method, or if this method is called from one
+        // thread while another thread is attempting to access the default
+        // metrics manager instance (i.e., this method is *not* thread-safe).
+
     static MetricsManager *create(bsl::ostream&     stream,
                                   bslma::Allocator *basicAllocator = 0);
         // Create the default 'MetricsManager' instance and configure it with
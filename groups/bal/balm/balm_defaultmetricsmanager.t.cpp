@@ -49,6 +49,7 @@ using bsl::flush;
 // CLASS METHODS
 // [ 3] static balm::MetricsManager *manager(balm::MetricsManager *manager);
 // [ 1] static balm::MetricsManager *create(bslma::Allocator *);
+// [ 1] static balm::MetricsManager *create(int, bslma::Allocator *);
 // [ 2] static balm::MetricsManager *create(ostream& , Allocator *);
 // [ 1] static balm::MetricsManager *instance();
 // [ 1] static void destroy();
@@ -539,6 +540,7 @@ int main(int argc, char *argv[])
         //
         // Testing:
         //  static balm::MetricsManager *create(bslma::Allocator *);
+        //  static balm::MetricsManager *create(int, bslma::Allocator *);
         //  static balm::MetricsManager *instance();
         //  static void destroy();
         //
@@ -623,6 +625,35 @@ int main(int argc, char *argv[])
             ASSERT(0 == defaultAllocator.numBytesInUse());
 
         }
+        {
+            if (verbose) {
+                bsl::cout
+                    << "\tCreate a default instance with sharded collectors."
+                    << endl;
+            }
+
+            // Create an instance and verify it is initialized.
+            Mgr *x = Obj::create(4, Z);
+            ASSERT(0 != x);
+            ASSERT(x == Obj::instance());
+            ASSERT(4 == x->collectorRepository().numCollectorShards());
+            balm::Collector *collector =
+                 x->collectorRepository().getDefaultCollector("A", "A");
+            ASSERT(4 == collector->numShards());
+
+            // Verify memory usage is from the correct allocator.
+            ASSERT(0 <  testAllocator.numBytesInUse());
+            ASSERT(0 == globalAllocator.numBytesInUse());
+            ASSERT(0 == defaultAllocator.numBytesInUse());
+
+            // Verify release releases the instance
+            Obj::destroy();
+            ASSERT(0 == Obj::instance());
+
+            ASSERT(0 == testAllocator.numBytesInUse());
+            ASSERT(0 == globalAllocator.numBytesInUse());
+            ASSERT(0 == defaultAllocator.numBytesInUse());
+        }
         bslma::Default::setGlobalAllocator(0);
 
       } break;
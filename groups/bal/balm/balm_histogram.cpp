@@ -0,0 +1,243 @@
+// balm_histogram.cpp                                                 -*-C++-*-
+#include <balm_histogram.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_histogram_cpp,"$Id$ $CSID$")
+
+#include <bsl_algorithm.h>
+#include <bsl_cfloat.h>
+#include <bsl_cmath.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace balm {
+
+namespace {
+
+// The default 'min' and 'max' are those of 'MetricRecord' (see the
+// implementation of 'balm_metricrecord' for why 'DBL_MAX' is used to obtain
+// an infinite value).
+
+const double k_DEFAULT_MIN = DBL_MAX * 2;
+const double k_DEFAULT_MAX = DBL_MAX * -2;
+
+}  // close unnamed namespace
+
+                              // ---------------
+                              // class Histogram
+                              // ---------------
+
+// CLASS METHODS
+int Histogram::bucketIndex(double value)
+{
+    static const double k_LOWEST  = bsl::ldexp(1.0, k_MIN_EXPONENT);
+    static const double k_HIGHEST = bsl::ldexp(1.0,
+                                               k_MIN_EXPONENT
+                                                          + k_NUM_EXPONENTS);
+
+    if (!(value >= k_LOWEST)) {
+        // 'value' is below the range of the buckets, or is NaN.
+
+        return 0;                                                     // RETURN
+    }
+    if (value >= k_HIGHEST) {
+        return k_NUM_BUCKETS - 1;                                     // RETURN
+    }
+
+    int          exponent;
+    const double fraction = bsl::frexp(value, &exponent);  // in [0.5, 1)
+
+    const int range     = exponent - 1 - k_MIN_EXPONENT;
+    const int subBucket = static_cast<int>((fraction * 2.0 - 1.0)
+                                                        * k_NUM_SUB_BUCKETS);
+
+    return range * k_NUM_SUB_BUCKETS + subBucket;
+}
+
+double Histogram::bucketLowerBound(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    const int range     = index / k_NUM_SUB_BUCKETS;
+    const int subBucket = index % k_NUM_SUB_BUCKETS;
+
+    return bsl::ldexp(1.0 + static_cast<double>(subBucket) / k_NUM_SUB_BUCKETS,
+                      range + k_MIN_EXPONENT);
+}
+
+double Histogram::bucketUpperBound(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    const int range     = index / k_NUM_SUB_BUCKETS;
+    const int subBucket = index % k_NUM_SUB_BUCKETS + 1;
+
+    return bsl::ldexp(1.0 + static_cast<double>(subBucket) / k_NUM_SUB_BUCKETS,
+                      range + k_MIN_EXPONENT);
+}
+
+// CREATORS
+Histogram::Histogram(bslma::Allocator *basicAllocator)
+: d_bucketCounts(basicAllocator)
+, d_count(0)
+, d_total(0.0)
+, d_min(k_DEFAULT_MIN)
+, d_max(k_DEFAULT_MAX)
+{
+}
+
+Histogram::Histogram(const Histogram&  original,
+                     bslma::Allocator *basicAllocator)
+: d_bucketCounts(original.d_bucketCounts, basicAllocator)
+, d_count(original.d_count)
+, d_total(original.d_total)
+, d_min(original.d_min)
+, d_max(original.d_max)
+{
+}
+
+// MANIPULATORS
+Histogram& Histogram::operator=(const Histogram& rhs)
+{
+    if (this != &rhs) {
+        d_bucketCounts = rhs.d_bucketCounts;
+        d_count        = rhs.d_count;
+        d_total        = rhs.d_total;
+        d_min          = rhs.d_min;
+        d_max          = rhs.d_max;
+    }
+    return *this;
+}
+
+void Histogram::add(double value)
+{
+    accumulateBucket(bucketIndex(value), 1);
+    accumulateTotalMinMax(value, value, value);
+}
+
+void Histogram::accumulateTotalMinMax(double total, double min, double max)
+{
+    d_total += total;
+    d_min    = bsl::min(d_min, min);
+    d_max    = bsl::max(d_max, max);
+}
+
+void Histogram::merge(const Histogram& other)
+{
+    // Note that 'other' may hold a total, minimum, or maximum even if its
+    // count is 0 (e.g., if it was loaded from a 'HistogramCollector'
+    // concurrently with an update), so those are always merged.
+
+    if (0 != other.d_count) {
+        if (d_bucketCounts.empty()) {
+            d_bucketCounts = other.d_bucketCounts;
+        }
+        else {
+            for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+                d_bucketCounts[i] += other.d_bucketCounts[i];
+            }
+        }
+    }
+    d_count += other.d_count;
+    accumulateTotalMinMax(other.d_total, other.d_min, other.d_max);
+}
+
+void Histogram::reset()
+{
+    // Keep the buckets allocated, as a histogram that is reset is typically
+    // reloaded.
+
+    if (!d_bucketCounts.empty()) {
+        bsl::fill(d_bucketCounts.begin(), d_bucketCounts.end(), 0);
+    }
+    d_count = 0;
+    d_total = 0.0;
+    d_min   = k_DEFAULT_MIN;
+    d_max   = k_DEFAULT_MAX;
+}
+
+// ACCESSORS
+double Histogram::percentile(double percent) const
+{
+    BSLS_ASSERT(0 < d_count);
+    BSLS_ASSERT(0 <= percent);
+    BSLS_ASSERT(percent <= 100);
+
+    if (0 == percent) {
+        return d_min;                                                 // RETURN
+    }
+
+    bsls::Types::Int64 rank = static_cast<bsls::Types::Int64>(
+                             bsl::ceil(percent / 100.0 * (double)d_count));
+    if (rank >= d_count) {
+        return d_max;                                                 // RETURN
+    }
+    if (rank < 1) {
+        rank = 1;
+    }
+
+    bsls::Types::Int64 numValues = 0;
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        numValues += d_bucketCounts[i];
+        if (numValues >= rank) {
+            const double midpoint = (bucketLowerBound(i)
+                                                  + bucketUpperBound(i)) / 2;
+            return bsl::min(d_max, bsl::max(d_min, midpoint));        // RETURN
+        }
+    }
+    return d_max;
+}
+
+bsl::ostream& Histogram::print(bsl::ostream& stream) const
+{
+    stream << "[ count = " << d_count << ", total = " << d_total;
+    if (0 < d_count) {
+        stream << ", min = "   << d_min
+               << ", max = "   << d_max
+               << ", p50 = "   << percentile(50)
+               << ", p90 = "   << percentile(90)
+               << ", p99 = "   << percentile(99)
+               << ", p99.9 = " << percentile(99.9);
+    }
+    stream << " ]";
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+bool balm::operator==(const Histogram& lhs, const Histogram& rhs)
+{
+    if (lhs.count() != rhs.count()
+     || lhs.total() != rhs.total()
+     || lhs.min()   != rhs.min()
+     || lhs.max()   != rhs.max()) {
+        return false;                                                 // RETURN
+    }
+    for (int i = 0; i < Histogram::k_NUM_BUCKETS; ++i) {
+        if (lhs.bucketCount(i) != rhs.bucketCount(i)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,394 @@
+// balm_histogram.h                                                   -*-C++-*-
+#ifndef INCLUDED_BALM_HISTOGRAM
+#define INCLUDED_BALM_HISTOGRAM
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a mergeable log-linear histogram of metric values.
+//
+//@CLASSES:
+//   balm::Histogram: log-linear histogram of metric values with percentiles
+//
+//@SEE_ALSO: balm_histogramcollector, balm_metricrecord
+//
+//@DESCRIPTION: This component provides a value-semantic class,
+// 'balm::Histogram', that summarizes the distribution of a set of recorded
+// metric values, and from which percentiles (e.g., the median, or the 99th
+// percentile) of those values can be estimated.  In addition to the
+// distribution, a 'balm::Histogram' maintains the exact count, total,
+// minimum, and maximum of the values it holds.
+//
+///Bucket Layout
+///-------------
+// Values are counted in a fixed set of buckets having a *log-linear* layout
+// (in the style of an HDR histogram): each power-of-two range of values,
+// '[2^e, 2^(e + 1))', is divided into 'k_NUM_SUB_BUCKETS' buckets of equal
+// width.  The width of a bucket is therefore proportional to the values it
+// holds, and the relative error of a percentile estimated from a histogram is
+// at most '1 / (2 * k_NUM_SUB_BUCKETS)' (about 1.6%), regardless of the
+// magnitude of the values.  The buckets cover the power-of-two ranges from
+// '2^k_MIN_EXPONENT' (about 2.3e-10) to '2^(k_MIN_EXPONENT + k_NUM_EXPONENTS)'
+// (about 2.8e14), which is sufficient to record elapsed times expressed in
+// any of the units from seconds to nanoseconds.  Values below that range
+// (including 0 and negative values) are counted in the first bucket, and
+// values above it in the last bucket.
+//
+// Because every histogram has the same bucket layout, any two histograms can
+// be merged (see 'merge'), which is how histograms collected from several
+// independent sources (e.g., from several 'balm::HistogramCollector' objects)
+// are combined.
+//
+///Percentiles
+///-----------
+// The 'percentile' method estimates the value below which the indicated
+// percentage of the recorded values fall, using the *nearest-rank* method:
+// the percentile 'p' of 'N' values is the value having the rank
+// 'ceil(p / 100 * N)' among the values sorted in increasing order.  The value
+// returned is the midpoint of the bucket holding the value of that rank,
+// clamped to the range '[min(), max()]', so that the 0th percentile is always
+// 'min()' and the 100th percentile is always 'max()'.
+//
+///Thread Safety
+///-------------
+// 'balm::Histogram' is *const* *thread-safe*, meaning that accessors may be
+// invoked concurrently from different threads, but it is not safe to access
+// or modify a 'balm::Histogram' in one thread while another thread modifies
+// the same object.  See 'balm_histogramcollector' for a mechanism that can be
+// updated concurrently from multiple threads.
+//
+///Usage
+///-----
+// The following example demonstrates how to record a set of request latencies
+// in a 'balm::Histogram' and estimate their percentiles.
+//
+// We start by creating a histogram, and adding 100 latency values, in
+// milliseconds, to it:
+//..
+//  balm::Histogram latencies;
+//  for (int i = 1; i <= 100; ++i) {
+//      latencies.add(i);
+//  }
+//..
+// The exact count, total, minimum, and maximum of the values are available:
+//..
+//  assert(100    == latencies.count());
+//  assert(5050.0 == latencies.total());
+//  assert(1.0    == latencies.min());
+//  assert(100.0  == latencies.max());
+//..
+// Percentiles are estimated from the buckets holding the values, and are
+// therefore accurate to within the relative error of the bucket layout:
+//..
+//  double median = latencies.percentile(50);
+//  double p99    = latencies.percentile(99);
+//
+//  assert(50 * 0.98 < median && median < 50 * 1.02);
+//  assert(99 * 0.98 < p99    && p99    < 99 * 1.02);
+//  assert(100.0 == latencies.percentile(100));
+//..
+// Finally, we merge the latencies recorded in another histogram:
+//..
+//  balm::Histogram moreLatencies;
+//  moreLatencies.add(1000.0);
+//
+//  latencies.merge(moreLatencies);
+//  assert(101    == latencies.count());
+//  assert(1000.0 == latencies.max());
+//  assert(1000.0 == latencies.percentile(100));
+//..
+
+#ifndef INCLUDED_BALSCM_VERSION
+#include <balscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_IOSFWD
+#include <bsl_iosfwd.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+namespace balm {
+
+                              // ===============
+                              // class Histogram
+                              // ===============
+
+class Histogram {
+    // This class provides a value-semantic log-linear histogram of metric
+    // values, which maintains the exact count, total, minimum, and maximum of
+    // the values it holds, and from which percentiles of those values can be
+    // estimated (see {Bucket Layout} and {Percentiles}).  The default 'min'
+    // is positive infinity and the default 'max' is negative infinity (the
+    // same as the defaults of 'MetricRecord').
+
+    // DATA
+    bsl::vector<bsls::Types::Int64> d_bucketCounts;  // number of values in
+                                                     // each bucket, or empty
+                                                     // if 'd_count' is 0
+
+    bsls::Types::Int64              d_count;         // number of values
+
+    double                          d_total;         // total of the values
+
+    double                          d_min;           // minimum value
+
+    double                          d_max;           // maximum value
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_SUB_BUCKET_BITS = 5,     // base-2 logarithm of the number of buckets
+                                   // per power-of-two range
+
+        k_NUM_SUB_BUCKETS = 1 << k_SUB_BUCKET_BITS,
+                                   // number of buckets per power-of-two range
+
+        k_MIN_EXPONENT    = -32,   // exponent of the lowest power-of-two
+                                   // range
+
+        k_NUM_EXPONENTS   = 80,    // number of power-of-two ranges
+
+        k_NUM_BUCKETS     = k_NUM_EXPONENTS * k_NUM_SUB_BUCKETS
+                                   // total number of buckets
+    };
+
+    // CLASS METHODS
+    static int bucketIndex(double value);
+        // Return the index of the bucket in which the specified 'value' is
+        // counted.  Note that values below the range of the buckets
+        // (including 0, negative values, and NaN) are counted in the first
+        // bucket (index 0), and values above it in the last bucket (index
+        // 'k_NUM_BUCKETS - 1').
+
+    static double bucketLowerBound(int index);
+        // Return the lowest value counted in the bucket having the specified
+        // 'index', ignoring the values below (or above) the range of the
+        // buckets.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    static double bucketUpperBound(int index);
+        // Return the lowest value *above* the values counted in the bucket
+        // having the specified 'index', ignoring the values below (or above)
+        // the range of the buckets.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Histogram, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit Histogram(bslma::Allocator *basicAllocator = 0);
+        // Create an empty histogram having a count of 0, a total of 0.0, and
+        // the default min and max.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  Note that an empty histogram
+        // allocates no memory.
+
+    Histogram(const Histogram&  original,
+              bslma::Allocator *basicAllocator = 0);
+        // Create a histogram having the value of the specified 'original'
+        // histogram.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    // ~Histogram() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    Histogram& operator=(const Histogram& rhs);
+        // Assign to this histogram the value of the specified 'rhs'
+        // histogram, and return a reference to this modifiable histogram.
+
+    void add(double value);
+        // Add the specified 'value' to this histogram.
+
+    void accumulateBucket(int index, bsls::Types::Int64 count);
+        // Add the specified 'count' values to the bucket having the specified
+        // 'index', and to the count of this histogram, without modifying its
+        // total, min, or max.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS' and '0 <= count'.  Note that this
+        // operation, together with 'accumulateTotalMinMax', is intended to be
+        // used to load a histogram from another representation of the same
+        // buckets (see 'balm_histogramcollector').
+
+    void accumulateTotalMinMax(double total, double min, double max);
+        // Add the specified 'total' to the total of this histogram, and
+        // aggregate the specified 'min' and 'max' into its minimum and
+        // maximum, respectively, without modifying its count or buckets.
+
+    void merge(const Histogram& other);
+        // Add the values held by the specified 'other' histogram to this
+        // histogram.
+
+    void reset();
+        // Reset this histogram to the empty state, having a count of 0, a
+        // total of 0.0, and the default min and max.
+
+    // ACCESSORS
+    bsls::Types::Int64 bucketCount(int index) const;
+        // Return the number of values counted in the bucket having the
+        // specified 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    bsls::Types::Int64 count() const;
+        // Return the number of values held by this histogram.
+
+    double max() const;
+        // Return the maximum of the values held by this histogram, or
+        // negative infinity if it is empty.
+
+    double min() const;
+        // Return the minimum of the values held by this histogram, or
+        // positive infinity if it is empty.
+
+    double percentile(double percent) const;
+        // Return an estimate of the specified 'percent' percentile of the
+        // values held by this histogram (see {Percentiles}).  The behavior is
+        // undefined unless '0 < count()' and '0 <= percent <= 100'.
+
+    double total() const;
+        // Return the total of the values held by this histogram.
+
+    bsl::ostream& print(bsl::ostream& stream) const;
+        // Write a description of this histogram, including its count, total,
+        // min, max, and the median, 90th, 99th, and 99.9th percentiles of its
+        // values, to the specified 'stream', and return a reference to the
+        // modifiable 'stream'.
+};
+
+// FREE OPERATORS
+bool operator==(const Histogram& lhs, const Histogram& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' histograms have the same
+    // value, and 'false' otherwise.  Two histograms have the same value if
+    // they have the same count, total, min, and max, and the same number of
+    // values in each of their buckets.
+
+inline
+bool operator!=(const Histogram& lhs, const Histogram& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' histograms do not have
+    // the same value, and 'false' otherwise.  Two histograms do not have the
+    // same value if they differ in their count, total, min, or max, or in the
+    // number of values in any of their buckets.
+
+inline
+bsl::ostream& operator<<(bsl::ostream& stream, const Histogram& histogram);
+    // Write a description of the specified 'histogram' to the specified
+    // 'stream', and return a reference to the modifiable 'stream'.
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // ---------------
+                              // class Histogram
+                              // ---------------
+
+// MANIPULATORS
+inline
+void Histogram::accumulateBucket(int index, bsls::Types::Int64 count)
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < k_NUM_BUCKETS);
+    BSLS_ASSERT_SAFE(0 <= count);
+
+    if (d_bucketCounts.empty()) {
+        d_bucketCounts.resize(k_NUM_BUCKETS, 0);
+    }
+    d_bucketCounts[index] += count;
+    d_count               += count;
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 Histogram::bucketCount(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < k_NUM_BUCKETS);
+
+    return d_bucketCounts.empty() ? 0 : d_bucketCounts[index];
+}
+
+inline
+bsls::Types::Int64 Histogram::count() const
+{
+    return d_count;
+}
+
+inline
+double Histogram::max() const
+{
+    return d_max;
+}
+
+inline
+double Histogram::min() const
+{
+    return d_min;
+}
+
+inline
+double Histogram::total() const
+{
+    return d_total;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool balm::operator!=(const Histogram& lhs, const Histogram& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bsl::ostream& balm::operator<<(bsl::ostream&    stream,
+                               const Histogram& histogram)
+{
+    return histogram.print(stream);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
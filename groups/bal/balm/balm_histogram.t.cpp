@@ -0,0 +1,670 @@
+// balm_histogram.t.cpp                                               -*-C++-*-
+#include <balm_histogram.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsl_cfloat.h>
+#include <bsl_cmath.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#include <bslim_testutil.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'balm::Histogram' is a value-semantic log-linear histogram.  We first test
+// the class methods mapping values to buckets, then the manipulators and
+// accessors maintaining the count, total, minimum, maximum, and buckets,
+// then the value-semantic operations, and finally the estimation of
+// percentiles.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static int bucketIndex(double value);
+// [ 2] static double bucketLowerBound(int index);
+// [ 2] static double bucketUpperBound(int index);
+//
+// CREATORS
+// [ 3] explicit Histogram(bslma::Allocator *basicAllocator = 0);
+// [ 4] Histogram(const Histogram& original, bslma::Allocator *ba = 0);
+//
+// MANIPULATORS
+// [ 4] Histogram& operator=(const Histogram& rhs);
+// [ 3] void add(double value);
+// [ 3] void accumulateBucket(int index, bsls::Types::Int64 count);
+// [ 3] void accumulateTotalMinMax(double total, double min, double max);
+// [ 3] void merge(const Histogram& other);
+// [ 3] void reset();
+//
+// ACCESSORS
+// [ 3] bsls::Types::Int64 bucketCount(int index) const;
+// [ 3] bsls::Types::Int64 count() const;
+// [ 3] double max() const;
+// [ 3] double min() const;
+// [ 5] double percentile(double percent) const;
+// [ 3] double total() const;
+// [ 6] bsl::ostream& print(bsl::ostream& stream) const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const Histogram& lhs, const Histogram& rhs);
+// [ 4] bool operator!=(const Histogram& lhs, const Histogram& rhs);
+// [ 6] bsl::ostream& operator<<(bsl::ostream&, const Histogram&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        bsl::cout << "Error " << __FILE__ << "(" << i << "): " << s
+                  << "    (failed)" << bsl::endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::Histogram    Obj;
+typedef bsls::Types::Int64 Int64;
+
+const double INF = bsl::numeric_limits<double>::infinity();
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
+
+    bslma::TestAllocator testAllocator;
+    bslma::TestAllocator defaultAllocator;
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //
+        // Concerns:
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove leading
+        //   comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Usage Example"
+                          << "\n=====================" << endl;
+
+///Usage
+///-----
+// The following example demonstrates how to record a set of request latencies
+// in a 'balm::Histogram' and estimate their percentiles.
+//
+// We start by creating a histogram, and adding 100 latency values, in
+// milliseconds, to it:
+//..
+    balm::Histogram latencies;
+    for (int i = 1; i <= 100; ++i) {
+        latencies.add(i);
+    }
+//..
+// The exact count, total, minimum, and maximum of the values are available:
+//..
+    ASSERT(100    == latencies.count());
+    ASSERT(5050.0 == latencies.total());
+    ASSERT(1.0    == latencies.min());
+    ASSERT(100.0  == latencies.max());
+//..
+// Percentiles are estimated from the buckets holding the values, and are
+// therefore accurate to within the relative error of the bucket layout:
+//..
+    double median = latencies.percentile(50);
+    double p99    = latencies.percentile(99);
+
+    ASSERT(50 * 0.98 < median && median < 50 * 1.02);
+    ASSERT(99 * 0.98 < p99    && p99    < 99 * 1.02);
+    ASSERT(100.0 == latencies.percentile(100));
+//..
+// Finally, we merge the latencies recorded in another histogram:
+//..
+    balm::Histogram moreLatencies;
+    moreLatencies.add(1000.0);
+
+    latencies.merge(moreLatencies);
+    ASSERT(101    == latencies.count());
+    ASSERT(1000.0 == latencies.max());
+    ASSERT(1000.0 == latencies.percentile(100));
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING PRINT
+        //
+        // Concerns:
+        //: 1 'print' and 'operator<<' write the count and total of an empty
+        //:   histogram, and the count, total, min, max, and percentiles of a
+        //:   non-empty histogram.
+        //
+        // Plan:
+        //: 1 Print an empty and a non-empty histogram, and compare the output
+        //:   to the expected output.  (C-1)
+        //
+        // Testing:
+        //   bsl::ostream& print(bsl::ostream& stream) const;
+        //   bsl::ostream& operator<<(bsl::ostream&, const Histogram&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING PRINT" << endl
+                                  << "=============" << endl;
+
+        Obj mX(&testAllocator); const Obj& X = mX;
+        {
+            bsl::ostringstream oss;
+            ASSERT(&oss == &X.print(oss));
+            ASSERTV(oss.str(), "[ count = 0, total = 0 ]" == oss.str());
+        }
+
+        mX.add(2.0);
+        {
+            bsl::ostringstream oss;
+            oss << X;
+            ASSERTV(oss.str(),
+                    "[ count = 1, total = 2, min = 2, max = 2, p50 = 2, "
+                    "p90 = 2, p99 = 2, p99.9 = 2 ]" == oss.str());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'percentile'
+        //
+        // Concerns:
+        //: 1 The 0th and 100th percentiles are the minimum and maximum.
+        //:
+        //: 2 Percentiles follow the nearest-rank method, and are within the
+        //:   relative error of the bucket layout of the exact value.
+        //:
+        //: 3 Percentiles are clamped to the range '[min(), max()]', including
+        //:   for values outside the range of the buckets.
+        //:
+        //: 4 Percentiles are accurate for values of any magnitude within the
+        //:   range of the buckets.
+        //
+        // Plan:
+        //: 1 Add the values '[1 .. 1000]' to a histogram and verify a set of
+        //:   percentiles against their exact values.  (C-1..2)
+        //:
+        //: 2 Add values outside the range of the buckets and verify the
+        //:   percentiles.  (C-3)
+        //:
+        //: 3 For a set of scales, add scaled values and verify the relative
+        //:   error of percentiles.  (C-4)
+        //
+        // Testing:
+        //   double percentile(double percent) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'percentile'" << endl
+                                  << "====================" << endl;
+
+        const double MAX_ERROR = 1.0 / (2 * Obj::k_NUM_SUB_BUCKETS);
+
+        {
+            Obj mX(&testAllocator); const Obj& X = mX;
+            for (int i = 1; i <= 1000; ++i) {
+                mX.add(i);
+            }
+            ASSERT(1.0    == X.percentile(0));
+            ASSERT(1000.0 == X.percentile(100));
+
+            const double PERCENTS[] = { 0.1, 1, 10, 25, 50, 75, 90, 99, 99.9 };
+            const int NUM_PERCENTS = sizeof PERCENTS / sizeof *PERCENTS;
+
+            for (int i = 0; i < NUM_PERCENTS; ++i) {
+                const double PERCENT = PERCENTS[i];
+                const double EXP     = bsl::ceil(PERCENT * 10);
+                const double VALUE   = X.percentile(PERCENT);
+
+                if (veryVerbose) { P_(PERCENT) P_(EXP) P(VALUE) }
+
+                ASSERTV(PERCENT, EXP, VALUE,
+                        bsl::fabs(VALUE - EXP) <= EXP * MAX_ERROR);
+            }
+        }
+        {
+            Obj mX(&testAllocator); const Obj& X = mX;
+            mX.add(-5.0);
+            mX.add(0.0);
+            mX.add(1e300);
+
+            // '-5.0' and '0.0' are both counted in the first bucket.
+
+            const double LOW = Obj::bucketUpperBound(0);
+
+            ASSERT(-5.0  == X.percentile(0));
+            ASSERT(-5.0  <= X.percentile(10) && X.percentile(10) < LOW);
+            ASSERT(-5.0  <= X.percentile(60) && X.percentile(60) < LOW);
+            ASSERT(1e300 == X.percentile(70));
+            ASSERT(1e300 == X.percentile(100));
+        }
+        {
+            const double SCALES[] = { 1e-9, 1e-6, 1e-3, 1, 1e3, 1e6, 1e9 };
+            const int NUM_SCALES  = sizeof SCALES / sizeof *SCALES;
+
+            for (int i = 0; i < NUM_SCALES; ++i) {
+                const double SCALE = SCALES[i];
+
+                Obj mX(&testAllocator); const Obj& X = mX;
+                for (int j = 1; j <= 100; ++j) {
+                    mX.add(j * SCALE);
+                }
+                const double EXP   = 90 * SCALE;
+                const double VALUE = X.percentile(90);
+
+                ASSERTV(SCALE, VALUE,
+                        bsl::fabs(VALUE - EXP) <= EXP * MAX_ERROR);
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING VALUE SEMANTICS
+        //
+        // Concerns:
+        //: 1 Two histograms compare equal if and only if they have the same
+        //:   count, total, min, max, and bucket counts, regardless of whether
+        //:   their buckets have been allocated.
+        //:
+        //: 2 The copy constructor and assignment operator copy the value, and
+        //:   use the intended allocator.
+        //
+        // Plan:
+        //: 1 Compare histograms differing in each attribute, and histograms
+        //:   that are equal, one of which has been reset.  (C-1)
+        //:
+        //: 2 Copy and assign histograms and verify their value and the
+        //:   allocators used.  (C-2)
+        //
+        // Testing:
+        //   Histogram(const Histogram& original, bslma::Allocator *ba = 0);
+        //   Histogram& operator=(const Histogram& rhs);
+        //   bool operator==(const Histogram& lhs, const Histogram& rhs);
+        //   bool operator!=(const Histogram& lhs, const Histogram& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING VALUE SEMANTICS" << endl
+                                  << "=======================" << endl;
+
+        if (verbose) cout << "\tTesting equality." << endl;
+        {
+            Obj mX(&testAllocator); const Obj& X = mX;
+            Obj mY(&testAllocator); const Obj& Y = mY;
+
+            ASSERT(  X == Y);
+            ASSERT(!(X != Y));
+
+            mX.add(1.0);
+            ASSERT(!(X == Y));
+            ASSERT(  X != Y);
+
+            mX.reset();
+            ASSERT(  X == Y);  // allocated vs. unallocated buckets
+
+            mX.add(1.0);
+            mY.add(1.5);
+            ASSERT(X != Y);    // different buckets and totals
+
+            mX.reset();
+            mY.reset();
+            mX.accumulateBucket(3, 1);
+            mY.accumulateBucket(4, 1);
+            ASSERT(X != Y);    // different buckets only
+
+            mY.reset();
+            mY.accumulateBucket(3, 1);
+            ASSERT(X == Y);
+
+            mX.accumulateTotalMinMax(0.0, 1.0, INF * -1);
+            ASSERT(X != Y);    // different min only
+
+            mY.accumulateTotalMinMax(0.0, 1.0, INF * -1);
+            ASSERT(X == Y);
+
+            mX.accumulateTotalMinMax(0.0, INF, 2.0);
+            ASSERT(X != Y);    // different max only
+        }
+
+        if (verbose) cout << "\tTesting copy and assignment." << endl;
+        {
+            bslma::TestAllocator ta;
+
+            Obj mX(&testAllocator); const Obj& X = mX;
+            mX.add(1.0);
+            mX.add(7.0);
+
+            Obj mY(X, &ta); const Obj& Y = mY;
+            ASSERT(X == Y);
+            ASSERT(0 < ta.numBlocksInUse());
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+            Obj mZ(&ta); const Obj& Z = mZ;
+            ASSERT(X != Z);
+            ASSERT(&mZ == &(mZ = X));
+            ASSERT(X == Z);
+
+            mZ = mZ;
+            ASSERT(X == Z);
+
+            Obj mE(&ta); const Obj& E = mE;
+            mZ = E;
+            ASSERT(E == Z);
+            ASSERT(0 == Z.count());
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed histogram is empty, has the default min and
+        //:   max, and allocates no memory.
+        //:
+        //: 2 'add' updates the count, total, min, max, and the bucket of the
+        //:   value.
+        //:
+        //: 3 'accumulateBucket' updates only the bucket and count, and
+        //:   'accumulateTotalMinMax' updates only the total, min, and max.
+        //:
+        //: 4 'merge' adds the values of another histogram, including to an
+        //:   empty histogram, and merging an empty histogram has no effect.
+        //:
+        //: 5 'reset' restores the default state.
+        //:
+        //: 6 Memory is supplied by the object allocator.
+        //
+        // Plan:
+        //: 1 Exercise each manipulator in turn and verify every accessor, and
+        //:   the allocators used.  (C-1..6)
+        //
+        // Testing:
+        //   explicit Histogram(bslma::Allocator *basicAllocator = 0);
+        //   void add(double value);
+        //   void accumulateBucket(int index, bsls::Types::Int64 count);
+        //   void accumulateTotalMinMax(double total, double min, double max);
+        //   void merge(const Histogram& other);
+        //   void reset();
+        //   bsls::Types::Int64 bucketCount(int index) const;
+        //   bsls::Types::Int64 count() const;
+        //   double max() const;
+        //   double min() const;
+        //   double total() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING MANIPULATORS AND ACCESSORS"
+                          << endl << "=================================="
+                          << endl;
+
+        Obj mX(&testAllocator); const Obj& X = mX;
+        ASSERT(0    == X.count());
+        ASSERT(0.0  == X.total());
+        ASSERT(INF  == X.min());
+        ASSERT(-INF == X.max());
+        ASSERT(0    == X.bucketCount(0));
+        ASSERT(0    == X.bucketCount(Obj::k_NUM_BUCKETS - 1));
+        ASSERT(0    == testAllocator.numBlocksTotal());
+
+        if (verbose) cout << "\tTesting 'add'." << endl;
+
+        mX.add(3.0);
+        mX.add(3.0);
+        mX.add(0.5);
+        ASSERT(3    == X.count());
+        ASSERT(6.5  == X.total());
+        ASSERT(0.5  == X.min());
+        ASSERT(3.0  == X.max());
+        ASSERT(2    == X.bucketCount(Obj::bucketIndex(3.0)));
+        ASSERT(1    == X.bucketCount(Obj::bucketIndex(0.5)));
+        ASSERT(1    == testAllocator.numBlocksInUse());
+        ASSERT(0    == defaultAllocator.numBlocksTotal());
+
+        if (verbose) cout << "\tTesting 'accumulate*'." << endl;
+
+        mX.accumulateBucket(7, 5);
+        ASSERT(8    == X.count());
+        ASSERT(6.5  == X.total());
+        ASSERT(5    == X.bucketCount(7));
+
+        mX.accumulateTotalMinMax(10.0, 0.25, 2.0);
+        ASSERT(8    == X.count());
+        ASSERT(16.5 == X.total());
+        ASSERT(0.25 == X.min());
+        ASSERT(3.0  == X.max());
+
+        if (verbose) cout << "\tTesting 'merge'." << endl;
+        {
+            Obj mY(&testAllocator); const Obj& Y = mY;
+
+            mY.merge(X);
+            ASSERT(X == Y);
+
+            mY.merge(Obj(&testAllocator));
+            ASSERT(X == Y);
+
+            mY.merge(X);
+            ASSERT(16   == Y.count());
+            ASSERT(33.0 == Y.total());
+            ASSERT(0.25 == Y.min());
+            ASSERT(3.0  == Y.max());
+            ASSERT(10   == Y.bucketCount(7));
+            ASSERT(4    == Y.bucketCount(Obj::bucketIndex(3.0)));
+        }
+
+        if (verbose) cout << "\tTesting 'reset'." << endl;
+
+        mX.reset();
+        ASSERT(Obj() == X);
+        ASSERT(0    == X.count());
+        ASSERT(0.0  == X.total());
+        ASSERT(INF  == X.min());
+        ASSERT(-INF == X.max());
+        ASSERT(0    == X.bucketCount(7));
+        ASSERT(0    == defaultAllocator.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING BUCKET LAYOUT
+        //
+        // Concerns:
+        //: 1 Every value within the range of the buckets is counted in a
+        //:   bucket whose bounds contain it.
+        //:
+        //: 2 The buckets are contiguous and their widths are within the
+        //:   intended relative precision.
+        //:
+        //: 3 Values below the range of the buckets (including 0, negative
+        //:   values, and NaN) are counted in the first bucket, and values
+        //:   above it (including infinity) in the last bucket.
+        //
+        // Plan:
+        //: 1 For every bucket, verify that its bounds are contiguous with
+        //:   those of the next bucket, its relative width, and that its lower
+        //:   bound, midpoint, and a value just below its upper bound map to
+        //:   that bucket.  (C-1..2)
+        //:
+        //: 2 Verify the bucket of values outside the range.  (C-3)
+        //
+        // Testing:
+        //   static int bucketIndex(double value);
+        //   static double bucketLowerBound(int index);
+        //   static double bucketUpperBound(int index);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING BUCKET LAYOUT" << endl
+                                  << "=====================" << endl;
+
+        ASSERT(Obj::k_NUM_SUB_BUCKETS == (1 << Obj::k_SUB_BUCKET_BITS));
+        ASSERT(Obj::k_NUM_BUCKETS     ==
+                             Obj::k_NUM_SUB_BUCKETS * Obj::k_NUM_EXPONENTS);
+
+        for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+            const double LOWER = Obj::bucketLowerBound(i);
+            const double UPPER = Obj::bucketUpperBound(i);
+
+            LOOP_ASSERT(i, LOWER < UPPER);
+            LOOP_ASSERT(i, (UPPER - LOWER) / LOWER <=
+                                              1.0 / Obj::k_NUM_SUB_BUCKETS);
+            if (i + 1 < Obj::k_NUM_BUCKETS) {
+                LOOP_ASSERT(i, UPPER == Obj::bucketLowerBound(i + 1));
+            }
+
+            LOOP_ASSERT(i, i == Obj::bucketIndex(LOWER));
+            LOOP_ASSERT(i, i == Obj::bucketIndex((LOWER + UPPER) / 2));
+            LOOP_ASSERT(i, i == Obj::bucketIndex(UPPER * (1 - DBL_EPSILON)));
+        }
+
+        const double LOWEST  = Obj::bucketLowerBound(0);
+        const double HIGHEST = Obj::bucketUpperBound(Obj::k_NUM_BUCKETS - 1);
+
+        ASSERT(bsl::ldexp(1.0, Obj::k_MIN_EXPONENT) == LOWEST);
+
+        ASSERT(0 == Obj::bucketIndex(0.0));
+        ASSERT(0 == Obj::bucketIndex(-1.0));
+        ASSERT(0 == Obj::bucketIndex(-INF));
+        ASSERT(0 == Obj::bucketIndex(LOWEST / 2));
+        ASSERT(0 == Obj::bucketIndex(
+                                  bsl::numeric_limits<double>::quiet_NaN()));
+
+        ASSERT(Obj::k_NUM_BUCKETS - 1 == Obj::bucketIndex(HIGHEST));
+        ASSERT(Obj::k_NUM_BUCKETS - 1 == Obj::bucketIndex(DBL_MAX));
+        ASSERT(Obj::k_NUM_BUCKETS - 1 == Obj::bucketIndex(INF));
+
+        // Elapsed times in seconds and in nanoseconds are within range.
+
+        ASSERT(0 < Obj::bucketIndex(1e-9));
+        ASSERT(Obj::bucketIndex(3600e9) < Obj::k_NUM_BUCKETS - 1);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //   Exercise the basic functionality of the class.
+        //
+        // Plan:
+        //   Add values to a histogram and verify the basic accessors.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        Obj mX(&testAllocator); const Obj& X = mX;
+        ASSERT(0 == X.count());
+
+        mX.add(1.0);
+        mX.add(2.0);
+        mX.add(4.0);
+
+        ASSERT(3   == X.count());
+        ASSERT(7.0 == X.total());
+        ASSERT(1.0 == X.min());
+        ASSERT(4.0 == X.max());
+        ASSERT(1.0 == X.percentile(0));
+        ASSERT(4.0 == X.percentile(100));
+
+        const double MEDIAN = X.percentile(50);
+        ASSERTV(MEDIAN, 1.9 < MEDIAN && MEDIAN < 2.1);
+
+        Obj mY(X, &testAllocator); const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        mY.merge(X);
+        ASSERT(6 == Y.count());
+        ASSERT(X != Y);
+
+        mY.reset();
+        ASSERT(0 == Y.count());
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      }
+    }
+
+    ASSERT(0 == testAllocator.numBlocksInUse());
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << bsl::endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,275 @@
+// balm_histogramcollector.cpp                                        -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_histogramcollector_cpp,"$Id$ $CSID$")
+
+#include <balm_collector_shardutil.h>
+
+#include <bslma_default.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_types.h>
+
+#include <bsl_memory.h>
+
+namespace BloombergLP {
+namespace balm {
+
+namespace {
+
+typedef bsls::AtomicOperations AtomicOps;
+typedef Collector_ShardUtil    ShardUtil;
+typedef bsls::Types::Int64     Int64;
+
+enum { k_CACHE_LINE_SIZE = ShardUtil::k_CACHE_LINE_SIZE };
+
+}  // close unnamed namespace
+
+                       // ===============================
+                       // struct HistogramCollector_Shard
+                       // ===============================
+
+struct HistogramCollector_Shard {
+    // This 'struct' holds the values aggregated by one shard of a
+    // 'HistogramCollector': its total, minimum, and maximum, stored as the bit
+    // patterns of 'double' values and padded to occupy a whole cache line,
+    // followed by its bucket counts.
+
+    ShardUtil::AtomicInt64 d_total;    // bits of the total
+    ShardUtil::AtomicInt64 d_min;      // bits of the minimum
+    ShardUtil::AtomicInt64 d_max;      // bits of the maximum
+    char                   d_padding[k_CACHE_LINE_SIZE - 3 * 8];
+    ShardUtil::AtomicInt64 d_buckets[Histogram::k_NUM_BUCKETS];
+                                       // bucket counts
+};
+
+BSLMF_ASSERT(0 == sizeof(HistogramCollector_Shard) % k_CACHE_LINE_SIZE);
+
+namespace {
+
+void resetShard(HistogramCollector_Shard *shard)
+    // Reset the specified 'shard' to its default state.
+{
+    for (int i = 0; i < Histogram::k_NUM_BUCKETS; ++i) {
+        AtomicOps::setInt64Release(shard->d_buckets + i, 0);
+    }
+    AtomicOps::setInt64Release(&shard->d_total, ShardUtil::toBits(0.0));
+    AtomicOps::setInt64Release(&shard->d_min,
+                               ShardUtil::toBits(MetricRecord::k_DEFAULT_MIN));
+    AtomicOps::setInt64Release(&shard->d_max,
+                               ShardUtil::toBits(MetricRecord::k_DEFAULT_MAX));
+}
+
+}  // close unnamed namespace
+
+                          // ------------------------
+                          // class HistogramCollector
+                          // ------------------------
+
+// PRIVATE MANIPULATORS
+void HistogramCollector::init(int numShards)
+{
+    BSLS_ASSERT(0 < numShards);
+
+    d_shards_p  = static_cast<HistogramCollector_Shard *>(
+                  ShardUtil::allocateAligned(
+                               &d_shardBuffer_p,
+                               numShards * sizeof(HistogramCollector_Shard),
+                               d_allocator_p));
+    d_numShards = numShards;
+    for (int i = 0; i < numShards; ++i) {
+        HistogramCollector_Shard& shard = d_shards_p[i];
+        for (int j = 0; j < Histogram::k_NUM_BUCKETS; ++j) {
+            AtomicOps::initInt64(shard.d_buckets + j, 0);
+        }
+        AtomicOps::initInt64(&shard.d_total, ShardUtil::toBits(0.0));
+        AtomicOps::initInt64(&shard.d_min,
+                             ShardUtil::toBits(MetricRecord::k_DEFAULT_MIN));
+        AtomicOps::initInt64(&shard.d_max,
+                             ShardUtil::toBits(MetricRecord::k_DEFAULT_MAX));
+    }
+}
+
+void HistogramCollector::loadImp(MetricRecord *record,
+                                 Histogram    *histogram,
+                                 bool          resetFlag)
+{
+    BSLS_ASSERT(histogram);
+
+    histogram->reset();
+
+    const Int64 zeroBits = ShardUtil::toBits(0.0);
+    const Int64 minBits  = ShardUtil::toBits(MetricRecord::k_DEFAULT_MIN);
+    const Int64 maxBits  = ShardUtil::toBits(MetricRecord::k_DEFAULT_MAX);
+
+    for (int i = 0; i < d_numShards; ++i) {
+        HistogramCollector_Shard& shard = d_shards_p[i];
+
+        for (int j = 0; j < Histogram::k_NUM_BUCKETS; ++j) {
+            ShardUtil::AtomicInt64 *bucket = shard.d_buckets + j;
+
+            // Most buckets are empty: avoid writing to those.
+
+            Int64 count = AtomicOps::getInt64Acquire(bucket);
+            if (0 != count && resetFlag) {
+                count = AtomicOps::swapInt64AcqRel(bucket, 0);
+            }
+            if (0 != count) {
+                histogram->accumulateBucket(j, count);
+            }
+        }
+
+        Int64 shardTotalBits, shardMinBits, shardMaxBits;
+        if (resetFlag) {
+            shardTotalBits = AtomicOps::swapInt64AcqRel(&shard.d_total,
+                                                        zeroBits);
+            shardMinBits   = AtomicOps::swapInt64AcqRel(&shard.d_min, minBits);
+            shardMaxBits   = AtomicOps::swapInt64AcqRel(&shard.d_max, maxBits);
+        }
+        else {
+            shardTotalBits = AtomicOps::getInt64Acquire(&shard.d_total);
+            shardMinBits   = AtomicOps::getInt64Acquire(&shard.d_min);
+            shardMaxBits   = AtomicOps::getInt64Acquire(&shard.d_max);
+        }
+        histogram->accumulateTotalMinMax(ShardUtil::fromBits(shardTotalBits),
+                                         ShardUtil::fromBits(shardMinBits),
+                                         ShardUtil::fromBits(shardMaxBits));
+    }
+
+    if (record) {
+        record->metricId() = d_metricId;
+        record->count()    = static_cast<int>(histogram->count());
+        record->total()    = histogram->total();
+        record->min()      = histogram->min();
+        record->max()      = histogram->max();
+    }
+}
+
+// CREATORS
+HistogramCollector::HistogramCollector(const MetricId&   metricId,
+                                       bslma::Allocator *basicAllocator)
+: d_metricId(metricId)
+, d_shards_p(0)
+, d_shardBuffer_p(0)
+, d_numShards(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    init(1);
+}
+
+HistogramCollector::HistogramCollector(const MetricId&   metricId,
+                                       int               numShards,
+                                       bslma::Allocator *basicAllocator)
+: d_metricId(metricId)
+, d_shards_p(0)
+, d_shardBuffer_p(0)
+, d_numShards(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < numShards);
+
+    init(numShards);
+}
+
+HistogramCollector::~HistogramCollector()
+{
+    d_allocator_p->deallocate(d_shardBuffer_p);
+}
+
+// MANIPULATORS
+void HistogramCollector::accumulate(const Histogram& histogram)
+{
+    HistogramCollector_Shard& shard =
+                                d_shards_p[ShardUtil::shardIndex(d_numShards)];
+
+    if (0 != histogram.count()) {
+        for (int i = 0; i < Histogram::k_NUM_BUCKETS; ++i) {
+            const Int64 count = histogram.bucketCount(i);
+            if (0 != count) {
+                AtomicOps::addInt64AcqRel(shard.d_buckets + i, count);
+            }
+        }
+    }
+    ShardUtil::addDouble(&shard.d_total, histogram.total());
+    ShardUtil::updateMin(&shard.d_min, histogram.min());
+    ShardUtil::updateMax(&shard.d_max, histogram.max());
+}
+
+void HistogramCollector::loadAndReset(Histogram *histogram)
+{
+    loadImp(0, histogram, true);
+}
+
+void HistogramCollector::loadAndReset(MetricRecord *record)
+{
+    BSLS_ASSERT(record);
+
+    bsl::shared_ptr<Histogram> histogram;
+    histogram.createInplace(d_allocator_p, d_allocator_p);
+
+    loadImp(record, histogram.get(), true);
+    record->histogram() = histogram;
+}
+
+void HistogramCollector::reset()
+{
+    for (int i = 0; i < d_numShards; ++i) {
+        resetShard(d_shards_p + i);
+    }
+}
+
+void HistogramCollector::update(double value)
+{
+    HistogramCollector_Shard& shard =
+                                d_shards_p[ShardUtil::shardIndex(d_numShards)];
+
+    AtomicOps::addInt64AcqRel(shard.d_buckets + Histogram::bucketIndex(value),
+                              1);
+    ShardUtil::addDouble(&shard.d_total, value);
+    ShardUtil::updateMin(&shard.d_min, value);
+    ShardUtil::updateMax(&shard.d_max, value);
+}
+
+// ACCESSORS
+void HistogramCollector::load(Histogram *histogram) const
+{
+    // 'loadImp' does not modify this object if 'resetFlag' is 'false'.
+
+    const_cast<HistogramCollector *>(this)->loadImp(0, histogram, false);
+}
+
+void HistogramCollector::load(MetricRecord *record) const
+{
+    BSLS_ASSERT(record);
+
+    bsl::shared_ptr<Histogram> histogram;
+    histogram.createInplace(d_allocator_p, d_allocator_p);
+
+    const_cast<HistogramCollector *>(this)->loadImp(record,
+                                                    histogram.get(),
+                                                    false);
+    record->histogram() = histogram;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,280 @@
+// balm_histogramcollector.h                                          -*-C++-*-
+#ifndef INCLUDED_BALM_HISTOGRAMCOLLECTOR
+#define INCLUDED_BALM_HISTOGRAMCOLLECTOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free container for collecting a value histogram.
+//
+//@CLASSES:
+//   balm::HistogramCollector: lock-free collector of a histogram of values
+//
+//@SEE_ALSO: balm_histogram, balm_collector, balm_collectorrepository
+//
+//@DESCRIPTION: This component provides a class, 'balm::HistogramCollector',
+// used to accumulate the distribution of the values of a metric (typically a
+// latency) in a log-linear histogram, from which percentiles of those values
+// can be estimated when the metric is published.  Like a 'balm::Collector', a
+// 'balm::HistogramCollector' also maintains the exact count, total, minimum,
+// and maximum of the values recorded, which it loads into a
+// 'balm::MetricRecord' along with the histogram itself (see 'histogram' in
+// 'balm_metricrecord').  The bucket layout of the histogram is that of
+// 'balm::Histogram' (see {'balm_histogram'|Bucket Layout}).
+//
+// Each bucket of a 'balm::HistogramCollector' is an independent atomic
+// counter, and its count, total, minimum, and maximum are updated using
+// atomic operations, so that 'update' never takes a lock.  Histograms are
+// mergeable: a 'balm::CollectorRepository' merges the histograms of every
+// histogram collector for a metric into the record it collects for that
+// metric.
+//
+///Sharded Histogram Collectors
+///----------------------------
+// A histogram collector holds its buckets, total, minimum, and maximum in one
+// or more *shards*, specified at construction.  Each thread updates the shard
+// selected by its thread id (as a sharded 'balm::Collector' does, see
+// 'balm_collector'), and the shards are merged when the collector is loaded,
+// so that threads updating a collector having several shards rarely write to
+// the same cache lines.  Each shard holds a whole array of bucket counts
+// (about 20KB), so the number of shards trades memory for reduced contention.
+// A 'balm::CollectorRepository' configured with a number of collector shards
+// creates histogram collectors having that many shards.
+//
+// Note that, unlike a 'balm::Collector', a 'balm::HistogramCollector' is
+// typically obtained from a 'balm::CollectorRepository' (or the repository of
+// a 'balm::MetricsManager'), and that values are typically recorded to it
+// using a 'balm::StopwatchScopedGuard'.
+//
+///Thread Safety
+///-------------
+// 'balm::HistogramCollector' is fully *thread-safe*, meaning that all
+// non-creator operations on a given instance can be safely invoked
+// simultaneously from multiple threads.  Note, however, that 'load' and
+// 'loadAndReset' are not atomic with respect to concurrent updates: a value
+// recorded concurrently with 'loadAndReset' is never lost, but may be
+// counted in the buckets loaded and its contribution to the total (or
+// minimum, or maximum) left to be loaded by the next call (or vice-versa).
+//
+///Usage
+///-----
+// The following example creates a 'balm::HistogramCollector', records values
+// to it, then collects a 'balm::MetricRecord' holding their histogram.
+//
+// We start by creating a 'balm::MetricId' object by hand; but in practice, an
+// id should be obtained from a 'balm::MetricRegistry' object (such as the one
+// owned by a 'balm::MetricsManager'):
+//..
+//  balm::Category           myCategory("MyCategory");
+//  balm::MetricDescription  description(&myCategory, "RequestLatency");
+//  balm::MetricId           myMetric(&description);
+//..
+// Now we create a 'balm::HistogramCollector' object using 'myMetric', and use
+// the 'update' method to record 1000 request latencies, in microseconds:
+//..
+//  balm::HistogramCollector collector(myMetric);
+//
+//  for (int i = 1; i <= 1000; ++i) {
+//      collector.update(i);
+//  }
+//..
+// Finally, we collect a record for the metric, and verify its aggregate
+// values and the percentiles of its histogram:
+//..
+//  balm::MetricRecord record;
+//  collector.loadAndReset(&record);
+//
+//  assert(myMetric == record.metricId());
+//  assert(1000     == record.count());
+//  assert(500500.0 == record.total());
+//  assert(1.0      == record.min());
+//  assert(1000.0   == record.max());
+//
+//  const balm::Histogram& histogram = *record.histogram();
+//
+//  assert(1000 == histogram.count());
+//  assert(990 * 0.98 < histogram.percentile(99));
+//  assert(990 * 1.02 > histogram.percentile(99));
+//..
+
+#ifndef INCLUDED_BALSCM_VERSION
+#include <balscm_version.h>
+#endif
+
+#ifndef INCLUDED_BALM_HISTOGRAM
+#include <balm_histogram.h>
+#endif
+
+#ifndef INCLUDED_BALM_METRICID
+#include <balm_metricid.h>
+#endif
+
+#ifndef INCLUDED_BALM_METRICRECORD
+#include <balm_metricrecord.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+namespace BloombergLP {
+namespace balm {
+
+struct HistogramCollector_Shard;  // defined in implementation
+
+                          // ========================
+                          // class HistogramCollector
+                          // ========================
+
+class HistogramCollector {
+    // This class provides a mechanism for collecting the histogram, count,
+    // total, minimum, and maximum of the values of a metric, that can be
+    // updated concurrently from multiple threads without locking.
+
+    // DATA
+    MetricId                  d_metricId;       // metric for which values
+                                                // are collected
+
+    HistogramCollector_Shard *d_shards_p;       // cache-line-aligned array
+                                                // of 'd_numShards' shards
+
+    void                     *d_shardBuffer_p;  // memory holding
+                                                // 'd_shards_p' (owned)
+
+    int                       d_numShards;      // number of shards
+
+    bslma::Allocator         *d_allocator_p;    // allocator (held, not
+                                                // owned)
+
+    // NOT IMPLEMENTED
+    HistogramCollector(const HistogramCollector&);
+    HistogramCollector& operator=(const HistogramCollector&);
+
+    // PRIVATE MANIPULATORS
+    void init(int numShards);
+        // Allocate and initialize the specified 'numShards' shards of this
+        // collector.  The behavior is undefined unless '0 < numShards'.
+
+    void loadImp(MetricRecord *record, Histogram *histogram, bool resetFlag);
+        // Load into the specified 'histogram' the values collected by this
+        // collector and, if 'record' is not 0, load into 'record' the id of
+        // the metric being collected as well as the count, total, minimum,
+        // and maximum of those values.  If the specified 'resetFlag' is
+        // 'true', reset each value of this collector as it is loaded.  Note
+        // that if 'resetFlag' is 'false' this operation does not modify this
+        // collector.
+
+  public:
+    // CREATORS
+    explicit HistogramCollector(const MetricId&   metricId,
+                                bslma::Allocator *basicAllocator = 0);
+        // Create a histogram collector for a metric having the specified
+        // 'metricId', and having an initial count of 0, total of 0.0, min of
+        // 'MetricRecord::k_DEFAULT_MIN', max of 'MetricRecord::k_DEFAULT_MAX',
+        // and an empty histogram, that aggregates values in a single shard.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    HistogramCollector(const MetricId&   metricId,
+                       int               numShards,
+                       bslma::Allocator *basicAllocator = 0);
+        // Create a histogram collector for a metric having the specified
+        // 'metricId', and having an initial count of 0, total of 0.0, min of
+        // 'MetricRecord::k_DEFAULT_MIN', max of 'MetricRecord::k_DEFAULT_MAX',
+        // and an empty histogram, that aggregates values in the specified
+        // 'numShards' shards (see {Sharded Histogram Collectors}).
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '0 < numShards'.
+
+    ~HistogramCollector();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void accumulate(const Histogram& histogram);
+        // Add the values held by the specified 'histogram' to the values
+        // collected by this collector.
+
+    void loadAndReset(Histogram *histogram);
+        // Load into the specified 'histogram' the values collected by this
+        // collector, and reset this collector to its default state (i.e., the
+        // state after construction).
+
+    void loadAndReset(MetricRecord *record);
+        // Load into the specified 'record' the id of the metric being
+        // collected, the count, total, minimum, and maximum of the values
+        // collected by this collector, and a newly allocated histogram of
+        // those values (see 'histogram' in 'balm_metricrecord'), then reset
+        // this collector to its default state (i.e., the state after
+        // construction).
+
+    void reset();
+        // Reset this collector to its default state (i.e., the state after
+        // construction).
+
+    void update(double value);
+        // Record the specified 'value' to this collector.
+
+    // ACCESSORS
+    void load(Histogram *histogram) const;
+        // Load into the specified 'histogram' the values collected by this
+        // collector.
+
+    void load(MetricRecord *record) const;
+        // Load into the specified 'record' the id of the metric being
+        // collected, the count, total, minimum, and maximum of the values
+        // collected by this collector, and a newly allocated histogram of
+        // those values (see 'histogram' in 'balm_metricrecord').
+
+    const MetricId& metricId() const;
+        // Return a reference to the non-modifiable metric identifier for this
+        // collector.
+
+    int numShards() const;
+        // Return the number of shards of this collector.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // class HistogramCollector
+                          // ------------------------
+
+// ACCESSORS
+inline
+const MetricId& HistogramCollector::metricId() const
+{
+    return d_metricId;
+}
+
+inline
+int HistogramCollector::numShards() const
+{
+    return d_numShards;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,531 @@
+// balm_histogramcollector.t.cpp                                      -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <balm_category.h>
+#include <balm_metricdescription.h>
+
+#include <bdlf_bind.h>
+#include <bdlmt_fixedthreadpool.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_destructorguard.h>
+#include <bslma_testallocator.h>
+#include <bslmt_barrier.h>
+
+#include <bsls_objectbuffer.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+
+#include <bslim_testutil.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'balm::HistogramCollector' is a mechanism for collecting the histogram of
+// the values of a metric.  We verify that the values recorded to a collector
+// are loaded, as a 'balm::Histogram' and as a 'balm::MetricRecord', with the
+// same value as a 'balm::Histogram' to which the same values were added, and
+// that concurrent updates are never lost.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit HistogramCollector(const MetricId&, bslma::Allocator * = 0);
+// [ 2] HistogramCollector(const MetricId&, int, bslma::Allocator * = 0);
+// [ 2] ~HistogramCollector();
+//
+// MANIPULATORS
+// [ 3] void accumulate(const Histogram& histogram);
+// [ 2] void loadAndReset(Histogram *histogram);
+// [ 2] void loadAndReset(MetricRecord *record);
+// [ 2] void reset();
+// [ 2] void update(double value);
+//
+// ACCESSORS
+// [ 2] void load(Histogram *histogram) const;
+// [ 2] void load(MetricRecord *record) const;
+// [ 2] const MetricId& metricId() const;
+// [ 2] int numShards() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCURRENCY TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        bsl::cout << "Error " << __FILE__ << "(" << i << "): " << s
+                  << "    (failed)" << bsl::endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::HistogramCollector Obj;
+typedef balm::Histogram          Hist;
+typedef balm::MetricRecord       Rec;
+
+// ============================================================================
+//                     GLOBAL CLASSES/FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+void updateCollector(Obj            *collector,
+                     bslmt::Barrier *barrier,
+                     int             numUpdates)
+    // Wait on the specified 'barrier', then update the specified 'collector'
+    // with each of the values in the range '[1 .. numUpdates]'.
+{
+    barrier->wait();
+    for (int i = 1; i <= numUpdates; ++i) {
+        collector->update(i);
+    }
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
+
+    bslma::TestAllocator testAllocator;
+    bslma::TestAllocator defaultAllocator;
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    balm::Category cat_A("A", true);
+    balm::MetricDescription desc_A(&cat_A, "A");
+    balm::MetricDescription desc_B(&cat_A, "B");
+
+    const balm::MetricId METRIC_A(&desc_A);
+    const balm::MetricId METRIC_B(&desc_B);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //
+        // Concerns:
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove leading
+        //   comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Usage Example"
+                          << "\n=====================" << endl;
+
+///Usage
+///-----
+// The following example creates a 'balm::HistogramCollector', records values
+// to it, then collects a 'balm::MetricRecord' holding their histogram.
+//
+// We start by creating a 'balm::MetricId' object by hand; but in practice, an
+// id should be obtained from a 'balm::MetricRegistry' object (such as the one
+// owned by a 'balm::MetricsManager'):
+//..
+    balm::Category           myCategory("MyCategory");
+    balm::MetricDescription  description(&myCategory, "RequestLatency");
+    balm::MetricId           myMetric(&description);
+//..
+// Now we create a 'balm::HistogramCollector' object using 'myMetric', and use
+// the 'update' method to record 1000 request latencies, in microseconds:
+//..
+    balm::HistogramCollector collector(myMetric);
+
+    for (int i = 1; i <= 1000; ++i) {
+        collector.update(i);
+    }
+//..
+// Finally, we collect a record for the metric, and verify its aggregate
+// values and the percentiles of its histogram:
+//..
+    balm::MetricRecord record;
+    collector.loadAndReset(&record);
+
+    ASSERT(myMetric == record.metricId());
+    ASSERT(1000     == record.count());
+    ASSERT(500500.0 == record.total());
+    ASSERT(1.0      == record.min());
+    ASSERT(1000.0   == record.max());
+
+    const balm::Histogram& histogram = *record.histogram();
+
+    ASSERT(1000 == histogram.count());
+    ASSERT(990 * 0.98 < histogram.percentile(99));
+    ASSERT(990 * 1.02 > histogram.percentile(99));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Values recorded concurrently from multiple threads are neither
+        //:   lost nor counted twice, including when the collector is
+        //:   concurrently loaded and reset.
+        //
+        // Plan:
+        //: 1 For collectors having one and several shards, update the
+        //:   collector from several threads while repeatedly calling
+        //:   'loadAndReset' and merging the loaded histograms.  Verify that
+        //:   the merged histogram equals the histogram of the values recorded
+        //:   by every thread.  (C-1)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENCY TEST" << endl
+                                  << "================" << endl;
+
+        enum { k_NUM_THREADS = 8, k_NUM_UPDATES = 20000 };
+
+        const int SHARDS[]   = { 1, 4 };
+        const int NUM_SHARDS = sizeof SHARDS / sizeof *SHARDS;
+
+        for (int si = 0; si < NUM_SHARDS; ++si) {
+            const int SHARD = SHARDS[si];
+
+            bslma::TestAllocator ta;
+            Obj mX(METRIC_A, SHARD, &ta);
+            bslmt::Barrier barrier(k_NUM_THREADS + 1);
+
+            bdlmt::FixedThreadPool pool(k_NUM_THREADS, k_NUM_THREADS, &ta);
+            pool.start();
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                pool.enqueueJob(bdlf::BindUtil::bind(&updateCollector,
+                                                     &mX,
+                                                     &barrier,
+                                                     (int)k_NUM_UPDATES));
+            }
+
+            Hist merged(&ta);
+            Hist loaded(&ta);
+
+            barrier.wait();
+            for (int i = 0; i < 1000; ++i) {
+                mX.loadAndReset(&loaded);
+                merged.merge(loaded);
+            }
+            pool.drain();
+
+            mX.loadAndReset(&loaded);
+            merged.merge(loaded);
+
+            Hist expected(&ta);
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                for (int j = 1; j <= k_NUM_UPDATES; ++j) {
+                    expected.add(j);
+                }
+            }
+
+            ASSERTV(SHARD, merged.count(), expected.count() == merged.count());
+            ASSERTV(SHARD, merged.total(), expected.total() == merged.total());
+            ASSERTV(SHARD, merged.min(),   1.0              == merged.min());
+            ASSERTV(SHARD, merged.max(),   k_NUM_UPDATES    == merged.max());
+            ASSERTV(SHARD, expected == merged);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'accumulate'
+        //
+        // Concerns:
+        //: 1 'accumulate' adds the bucket counts, count, and total of a
+        //:   histogram to those of the collector, and aggregates its minimum
+        //:   and maximum.
+        //:
+        //: 2 Accumulating an empty histogram has no effect.
+        //
+        // Plan:
+        //: 1 Accumulate histograms, and updates, into a collector and into a
+        //:   'Histogram', and compare the loaded value to the histogram.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   void accumulate(const Histogram& histogram);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'accumulate'" << endl
+                                  << "====================" << endl;
+
+        Obj mX(METRIC_A, &testAllocator); const Obj& X = mX;
+
+        Hist empty(&testAllocator);
+        Hist h1(&testAllocator);
+        Hist h2(&testAllocator);
+        h1.add(0.5);
+        h1.add(3.0);
+        h2.add(-1.0);
+        h2.add(1e6);
+
+        Hist expected(&testAllocator);
+        Hist loaded(&testAllocator);
+
+        mX.accumulate(empty);
+        X.load(&loaded);
+        ASSERT(expected == loaded);
+
+        mX.accumulate(h1);
+        expected.merge(h1);
+        X.load(&loaded);
+        ASSERT(expected == loaded);
+
+        mX.update(7.0);
+        expected.add(7.0);
+        mX.accumulate(h2);
+        expected.merge(h2);
+        mX.accumulate(empty);
+        X.load(&loaded);
+        ASSERT(expected == loaded);
+        ASSERT(5    == loaded.count());
+        ASSERT(-1.0 == loaded.min());
+        ASSERT(1e6  == loaded.max());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A newly created collector holds an empty histogram for its
+        //:   metric.
+        //:
+        //: 2 'update' records each value in its bucket and in the count,
+        //:   total, min, and max.
+        //:
+        //: 3 'load' does not modify the collector, and 'loadAndReset' and
+        //:   'reset' reset it to its default state.
+        //:
+        //: 4 Loading a 'MetricRecord' loads the metric id, count, total, min,
+        //:   max, and a newly allocated histogram.
+        //:
+        //: 5 Memory is supplied by the object allocator.
+        //:
+        //: 6 A collector having several shards loads the same values as a
+        //:   collector having a single shard.
+        //
+        // Plan:
+        //: 1 For a set of value sequences, and for collectors having one and
+        //:   several shards, update a collector and add the values to a
+        //:   'Histogram', then compare the values loaded by each accessor and
+        //:   manipulator to that histogram.  (C-1..6)
+        //
+        // Testing:
+        //   explicit HistogramCollector(const MetricId&, Allocator * = 0);
+        //   HistogramCollector(const MetricId&, int, Allocator * = 0);
+        //   ~HistogramCollector();
+        //   void loadAndReset(Histogram *histogram);
+        //   void loadAndReset(MetricRecord *record);
+        //   void reset();
+        //   void update(double value);
+        //   void load(Histogram *histogram) const;
+        //   void load(MetricRecord *record) const;
+        //   const MetricId& metricId() const;
+        //   int numShards() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING MANIPULATORS AND ACCESSORS"
+                          << endl << "=================================="
+                          << endl;
+
+        const double VALUES[] = { 1.0, 1e-9, 0.0, -3.5, 250.0, 250.5,
+                                  1e15, 42.0, 42.0, 0.001 };
+        const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        // Configuration 0 uses the single-shard constructor; the others
+        // specify the number of shards.
+
+        const int SHARDS[]    = { 1, 1, 4 };
+        const int NUM_CONFIGS = sizeof SHARDS / sizeof *SHARDS;
+
+        for (int ti = 0; ti < NUM_CONFIGS * (NUM_VALUES + 1); ++ti) {
+            const int n      = ti % (NUM_VALUES + 1);
+            const int CONFIG = ti / (NUM_VALUES + 1);
+            const int SHARD  = SHARDS[CONFIG];
+
+            bslma::TestAllocator ta;
+            {
+                bsls::ObjectBuffer<Obj> buffer;
+                if (0 == CONFIG) {
+                    new (buffer.buffer()) Obj(METRIC_B, &ta);
+                }
+                else {
+                    new (buffer.buffer()) Obj(METRIC_B, SHARD, &ta);
+                }
+                bslma::DestructorGuard<Obj> guard(&buffer.object());
+
+                Obj& mX = buffer.object(); const Obj& X = mX;
+                ASSERT(METRIC_B == X.metricId());
+                ASSERTV(CONFIG, SHARD == X.numShards());
+                ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+                Hist expected(&ta);
+                for (int i = 0; i < n; ++i) {
+                    mX.update(VALUES[i]);
+                    expected.add(VALUES[i]);
+                }
+
+                Hist loaded(&ta);
+                X.load(&loaded);
+                LOOP_ASSERT(n, expected == loaded);
+
+                Rec record;
+                X.load(&record);
+                LOOP_ASSERT(n, METRIC_B         == record.metricId());
+                LOOP_ASSERT(n, expected.count() == record.count());
+                LOOP_ASSERT(n, expected.total() == record.total());
+                LOOP_ASSERT(n, expected.min()   == record.min());
+                LOOP_ASSERT(n, expected.max()   == record.max());
+                LOOP_ASSERT(n, record.histogram());
+                LOOP_ASSERT(n, expected == *record.histogram());
+
+                mX.loadAndReset(&loaded);
+                LOOP_ASSERT(n, expected == loaded);
+
+                X.load(&loaded);
+                LOOP_ASSERT(n, Hist() == loaded);
+
+                for (int i = 0; i < n; ++i) {
+                    mX.update(VALUES[i]);
+                }
+                Rec record2;
+                mX.loadAndReset(&record2);
+                LOOP_ASSERT(n, record == record2);
+                LOOP_ASSERT(n, expected == *record2.histogram());
+
+                X.load(&record2);
+                LOOP_ASSERT(n, Hist() == *record2.histogram());
+
+                record2.histogram().reset();
+                LOOP_ASSERT(n, Rec(METRIC_B) == record2);
+
+                for (int i = 0; i < n; ++i) {
+                    mX.update(VALUES[i]);
+                }
+                mX.reset();
+                X.load(&loaded);
+                LOOP_ASSERT(n, Hist() == loaded);
+            }
+            LOOP_ASSERT(n, 0 == ta.numBlocksInUse());
+            LOOP_ASSERT(n, 0 == defaultAllocator.numBlocksInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //   Exercise the basic functionality of the class.
+        //
+        // Plan:
+        //   Update a collector, then load and reset it.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        Obj mX(METRIC_A, &testAllocator); const Obj& X = mX;
+        ASSERT(METRIC_A == X.metricId());
+
+        mX.update(1.0);
+        mX.update(2.0);
+        mX.update(4.0);
+
+        Rec record;
+        mX.loadAndReset(&record);
+        ASSERT(METRIC_A == record.metricId());
+        ASSERT(3        == record.count());
+        ASSERT(7.0      == record.total());
+        ASSERT(1.0      == record.min());
+        ASSERT(4.0      == record.max());
+        ASSERT(record.histogram());
+        ASSERT(3        == record.histogram()->count());
+        ASSERT(4.0      == record.histogram()->percentile(100));
+
+        if (veryVerbose) { P(record) }
+
+        Hist histogram(&testAllocator);
+        X.load(&histogram);
+        ASSERT(0 == histogram.count());
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      }
+    }
+
+    ASSERT(0 == testAllocator.numBlocksInUse());
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << bsl::endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -12,21 +12,164 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balm_integercollector_cpp,"$Id$ $CSID$")
 
+#include <balm_collector_shardutil.h>
+
+#include <bslma_default.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
 #include <bsls_types.h>
 
 #include <bsl_climits.h>
 
 namespace BloombergLP {
+namespace balm {
+
+namespace {
+
+typedef bsls::AtomicOperations AtomicOps;
+typedef Collector_ShardUtil    ShardUtil;
+typedef bsls::Types::Int64     Int64;
+
+enum { k_CACHE_LINE_SIZE = ShardUtil::k_CACHE_LINE_SIZE };
+
+}  // close unnamed namespace
+
+                       // =============================
+                       // struct IntegerCollector_Shard
+                       // =============================
+
+struct IntegerCollector_Shard {
+    // This 'struct' holds the aggregated values of one shard of a sharded
+    // 'IntegerCollector', padded to occupy a whole cache line.
+
+    AtomicOps::AtomicTypes::Int64 d_total;    // total of values
+    AtomicOps::AtomicTypes::Int   d_count;    // aggregated count of events
+    AtomicOps::AtomicTypes::Int   d_min;      // minimum value
+    AtomicOps::AtomicTypes::Int   d_max;      // maximum value
+    char                          d_padding[k_CACHE_LINE_SIZE - 8 - 3 * 4];
+};
+
+BSLMF_ASSERT(k_CACHE_LINE_SIZE == sizeof(IntegerCollector_Shard));
+
+namespace {
+
+void mergeShards(int                    *count,
+                 Int64                  *total,
+                 int                    *min,
+                 int                    *max,
+                 IntegerCollector_Shard *shards,
+                 int                     numShards,
+                 bool                    resetFlag)
+    // Load into the specified 'count', 'total', 'min', and 'max' the
+    // aggregated values merged from the specified 'numShards' 'shards', and,
+    // if the specified 'resetFlag' is 'true', atomically reset each field of
+    // each shard to its default value as it is read.
+{
+    *count = 0;
+    *total = 0;
+    *min   = IntegerCollector::k_DEFAULT_MIN;
+    *max   = IntegerCollector::k_DEFAULT_MAX;
+
+    for (int i = 0; i < numShards; ++i) {
+        IntegerCollector_Shard& shard = shards[i];
+        if (resetFlag) {
+            *count += AtomicOps::swapIntAcqRel(&shard.d_count, 0);
+            *total += AtomicOps::swapInt64AcqRel(&shard.d_total, 0);
+            *min    = bsl::min(*min, AtomicOps::swapIntAcqRel(
+                                            &shard.d_min,
+                                            IntegerCollector::k_DEFAULT_MIN));
+            *max    = bsl::max(*max, AtomicOps::swapIntAcqRel(
+                                            &shard.d_max,
+                                            IntegerCollector::k_DEFAULT_MAX));
+        }
+        else {
+            *count += AtomicOps::getIntAcquire(&shard.d_count);
+            *total += AtomicOps::getInt64Acquire(&shard.d_total);
+            *min    = bsl::min(*min, AtomicOps::getIntAcquire(&shard.d_min));
+            *max    = bsl::max(*max, AtomicOps::getIntAcquire(&shard.d_max));
+        }
+    }
+}
+
+}  // close unnamed namespace
 
                         // ----------------------------
                         // class balm::IntegerCollector
                         // ----------------------------
 
 // PUBLIC CONSTANTS
-const int balm::IntegerCollector::k_DEFAULT_MIN = INT_MAX;
-const int balm::IntegerCollector::k_DEFAULT_MAX = INT_MIN;
+const int IntegerCollector::k_DEFAULT_MIN = INT_MAX;
+const int IntegerCollector::k_DEFAULT_MAX = INT_MIN;
+
+// PRIVATE MANIPULATORS
+void IntegerCollector::resetShards()
+{
+    for (int i = 0; i < d_numShards; ++i) {
+        IntegerCollector_Shard& shard = d_shards_p[i];
+        AtomicOps::setIntRelease(&shard.d_count, 0);
+        AtomicOps::setInt64Release(&shard.d_total, 0);
+        AtomicOps::setIntRelease(&shard.d_min, k_DEFAULT_MIN);
+        AtomicOps::setIntRelease(&shard.d_max, k_DEFAULT_MAX);
+    }
+}
+
+void IntegerCollector::updateShard(int count, int total, int min, int max)
+{
+    IntegerCollector_Shard& shard =
+                                d_shards_p[ShardUtil::shardIndex(d_numShards)];
+
+    AtomicOps::addIntAcqRel(&shard.d_count, count);
+    AtomicOps::addInt64AcqRel(&shard.d_total, total);
+    ShardUtil::updateMin(&shard.d_min, min);
+    ShardUtil::updateMax(&shard.d_max, max);
+}
+
+// CREATORS
+IntegerCollector::IntegerCollector(const MetricId&   metricId,
+                                   int               numShards,
+                                   bslma::Allocator *basicAllocator)
+: d_metricId(metricId)
+, d_count(0)
+, d_total(0)
+, d_min(k_DEFAULT_MIN)
+, d_max(k_DEFAULT_MAX)
+, d_mutex()
+, d_shards_p(0)
+, d_shardBuffer_p(0)
+, d_numShards(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 <= numShards);
+
+    if (0 == numShards) {
+        return;                                                       // RETURN
+    }
+
+    d_shards_p  = static_cast<IntegerCollector_Shard *>(
+                    ShardUtil::allocateAligned(
+                                 &d_shardBuffer_p,
+                                 numShards * sizeof(IntegerCollector_Shard),
+                                 d_allocator_p));
+    d_numShards = numShards;
+    for (int i = 0; i < numShards; ++i) {
+        IntegerCollector_Shard& shard = d_shards_p[i];
+        AtomicOps::initInt(&shard.d_count, 0);
+        AtomicOps::initInt64(&shard.d_total, 0);
+        AtomicOps::initInt(&shard.d_min, k_DEFAULT_MIN);
+        AtomicOps::initInt(&shard.d_max, k_DEFAULT_MAX);
+    }
+}
+
+IntegerCollector::~IntegerCollector()
+{
+    if (d_shardBuffer_p) {
+        d_allocator_p->deallocate(d_shardBuffer_p);
+    }
+}
 
-namespace balm {
 // MANIPULATORS
 void IntegerCollector::loadAndReset(MetricRecord *records)
 {
@@ -34,7 +177,10 @@ void IntegerCollector::loadAndReset(MetricRecord *records)
     bsls::Types::Int64 total;
     int                min;
     int                max;
-    {
+    if (d_shards_p) {
+        mergeShards(&count, &total, &min, &max, d_shards_p, d_numShards, true);
+    }
+    else {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
         count = d_count;
         total = d_total;
@@ -66,7 +212,16 @@ void IntegerCollector::load(MetricRecord *record) const
     int                min;
     int                max;
 
-    {
+    if (d_shards_p) {
+        mergeShards(&count,
+                    &total,
+                    &min,
+                    &max,
+                    d_shards_p,
+                    d_numShards,
+                    false);
+    }
+    else {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
         count = d_count;
         total = d_total;
@@ -35,6 +35,19 @@ BSLS_IDENT("$Id: $")
 // finally a combined 'loadAndReset' method that performs both a load and a
 // reset in a single (atomic) operation.
 //
+///Sharded Collectors
+///------------------
+// By default, a 'balm::IntegerCollector' serializes its operations with a
+// mutex.  An integer collector created with a positive number of *shards*
+// instead aggregates values in that many independent, cache-line-sized
+// shards, each updated using atomic operations without taking any lock, which
+// removes the contention between threads frequently updating the same
+// collector.  Each thread updates the shard selected by its thread id, and
+// the shards are merged when the collector is loaded.  Note that, for a
+// sharded integer collector, 'load', 'loadAndReset', and
+// 'setCountTotalMinMax' are not atomic with respect to concurrent updates
+// (see the 'balm_collector' component documentation).
+//
 ///Thread Safety
 ///-------------
 // 'balm::IntegerCollector' is fully *thread-safe*, meaning that all
@@ -92,6 +105,10 @@ BSLS_IDENT("$Id: $")
 #include <balm_metricrecord.h>
 #endif
 
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
 #ifndef INCLUDED_BSLMT_MUTEX
 #include <bslmt_mutex.h>
 #endif
@@ -107,6 +124,9 @@ BSLS_IDENT("$Id: $")
 namespace BloombergLP {
 
 namespace balm {
+
+struct IntegerCollector_Shard;  // defined in implementation
+
                            // ======================
                            // class IntegerCollector
                            // ======================
@@ -129,10 +149,33 @@ class IntegerCollector {
     int                  d_max;       // maximum value across events
     mutable bslmt::Mutex d_mutex;     // synchronizes access to data
 
+    IntegerCollector_Shard
+                        *d_shards_p;       // cache-line-aligned array of
+                                           // 'd_numShards' shards, or 0 if
+                                           // values are aggregated under
+                                           // 'd_mutex'
+
+    void                *d_shardBuffer_p;  // memory holding 'd_shards_p'
+                                           // (owned)
+
+    int                  d_numShards;      // number of shards
+
+    bslma::Allocator    *d_allocator_p;    // allocator (held, not owned)
+
     // NOT IMPLEMENTED
     IntegerCollector(const IntegerCollector&);
     IntegerCollector& operator=(const IntegerCollector&);
 
+    // PRIVATE MANIPULATORS
+    void resetShards();
+        // Reset each shard of this collector to its default state.  The
+        // behavior is undefined unless this collector is sharded.
+
+    void updateShard(int count, int total, int min, int max);
+        // Aggregate the specified 'count', 'total', 'min', and 'max' into the
+        // shard updated by the calling thread.  The behavior is undefined
+        // unless this collector is sharded.
+
   public:
     // PUBLIC CONSTANTS
     static const int k_DEFAULT_MIN;  // default minimum value (INT_MAX)
@@ -144,6 +187,18 @@ class IntegerCollector {
         // 'metricId', and having an initial count of 0, total of 0, min of
         // 'k_DEFAULT_MIN', and max of 'k_DEFAULT_MAX'.
 
+    IntegerCollector(const MetricId&   metricId,
+                     int               numShards,
+                     bslma::Allocator *basicAllocator = 0);
+        // Create an integer collector for a metric having the specified
+        // 'metricId', and having an initial count of 0, total of 0, min of
+        // 'k_DEFAULT_MIN', and max of 'k_DEFAULT_MAX', that aggregates values
+        // in the specified 'numShards' lock-free shards if '0 < numShards',
+        // and under a mutex otherwise (see {Sharded Collectors}).  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '0 <= numShards'.
+
     ~IntegerCollector();
         // Destroy this object.
 
@@ -186,7 +241,9 @@ class IntegerCollector {
     void setCountTotalMinMax(int count, int total, int min, int max);
         // Set the event count to the specified 'count', the total aggregate to
         // the specified 'total', the minimum aggregate to the specified 'min'
-        // and the maximum aggregate to the specified 'max'.
+        // and the maximum aggregate to the specified 'max'.  Note that, if
+        // this collector is sharded, this operation is not atomic with respect
+        // to concurrent updates.
 
     // ACCESSORS
     const MetricId& metricId() const;
@@ -204,6 +261,10 @@ class IntegerCollector {
         // minimum value of 'MetricRecord::k_DEFAULT_MIN' and a maximum value
         // of 'k_DEFAULT_MAX' will populate a maximum value of
         // 'MetricRecord::k_DEFAULT_MAX'.
+
+    int numShards() const;
+        // Return the number of shards in which this collector aggregates
+        // values, or 0 if this collector is not sharded.
 };
 
 // ============================================================================
@@ -223,11 +284,10 @@ IntegerCollector::IntegerCollector(const MetricId& metricId)
 , d_min(k_DEFAULT_MIN)
 , d_max(k_DEFAULT_MAX)
 , d_mutex()
-{
-}
-
-inline
-IntegerCollector::~IntegerCollector()
+, d_shards_p(0)
+, d_shardBuffer_p(0)
+, d_numShards(0)
+, d_allocator_p(0)
 {
 }
 
@@ -235,6 +295,11 @@ IntegerCollector::~IntegerCollector()
 inline
 void IntegerCollector::reset()
 {
+    if (d_shards_p) {
+        resetShards();
+        return;                                                       // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
     d_count = 0;
     d_total = 0;
@@ -245,6 +310,11 @@ void IntegerCollector::reset()
 inline
 void IntegerCollector::update(int value)
 {
+    if (d_shards_p) {
+        updateShard(1, value, value, value);
+        return;                                                       // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
     ++d_count;
     d_total += value;
@@ -258,6 +328,11 @@ void IntegerCollector::accumulateCountTotalMinMax(int count,
                                                   int min,
                                                   int max)
 {
+    if (d_shards_p) {
+        updateShard(count, total, min, max);
+        return;                                                       // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
     d_count += count;
     d_total += total;
@@ -271,6 +346,12 @@ void IntegerCollector::setCountTotalMinMax(int count,
                                            int min,
                                            int max)
 {
+    if (d_shards_p) {
+        resetShards();
+        updateShard(count, total, min, max);
+        return;                                                       // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
     d_count = count;
     d_total = total;
@@ -285,6 +366,12 @@ const MetricId& IntegerCollector::metricId() const
     return d_metricId;
 }
 
+inline
+int IntegerCollector::numShards() const
+{
+    return d_numShards;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -19,6 +19,7 @@
 
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_functional.h>
 #include <bsl_ostream.h>
 #include <bsl_cstring.h>
@@ -46,6 +47,7 @@ using bsl::flush;
 // CREATORS
 // [ 3]  balm::Collector(const balm::MetricId& metric);
 // [ 3]  ~balm::Collector();
+// [ 9]  IntegerCollector(const MetricId&, int numShards, Allocator *ba);
 //
 // MANIPULATORS
 // [ 7]  void reset();
@@ -60,10 +62,12 @@ using bsl::flush;
 // ACCESSORS
 // [ 2]  const balm::MetricId& metric() const;
 // [ 2]  void load(balm::MetricRecord *record) const;
+// [ 9]  int numShards() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] CONCURRENCY TEST
-// [ 9] USAGE EXAMPLE
+// [ 9] SHARDED COLLECTORS
+// [10] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -216,6 +220,18 @@ void ConcurrencyTest::runTest()
     d_pool.drain();
 }
 
+void updateCollector(balm::IntegerCollector *collector,
+                     bslmt::Barrier         *barrier,
+                     int                     numUpdates)
+    // Wait on the specified 'barrier', then update the specified 'collector'
+    // with each of the values in the range '[1 .. numUpdates]'.
+{
+    barrier->wait();
+    for (int i = 1; i <= numUpdates; ++i) {
+        collector->update(i);
+    }
+}
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -248,7 +264,7 @@ int main(int argc, char *argv[])
     Id metric_E(DESC_E); const Id& METRIC_E = metric_E;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -303,6 +319,197 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING SHARDED COLLECTORS
+        //
+        // Concerns:
+        //: 1 A collector created with a positive number of shards reports
+        //:   that number of shards, and a collector created with 0 shards (or
+        //:   with the single-argument constructor) reports 0.
+        //:
+        //: 2 A sharded collector allocates its shards from the supplied
+        //:   allocator, and releases them on destruction; a non-sharded
+        //:   collector allocates no memory.
+        //:
+        //: 3 Every manipulator and accessor of a sharded collector yields the
+        //:   same values as for a non-sharded collector.
+        //:
+        //: 4 Updates performed concurrently from multiple threads on a
+        //:   sharded collector are all accounted for, including when the
+        //:   collector is concurrently loaded and reset.
+        //
+        // Plan:
+        //: 1 Create collectors having a varying number of shards using a test
+        //:   allocator, and verify 'numShards' and the allocator usage.  (C-1,
+        //:   2)
+        //:
+        //: 2 For a table of values, apply the same sequence of operations to a
+        //:   sharded and a non-sharded collector, and verify the loaded values
+        //:   are the same after each operation.  (C-3)
+        //:
+        //: 3 Update a sharded collector from multiple threads, while the main
+        //:   thread repeatedly calls 'loadAndReset'.  Verify the sum of the
+        //:   counts and totals loaded, and the extreme minimum and maximum
+        //:   values loaded, match the values supplied.  (C-4)
+        //
+        // Testing:
+        //   IntegerCollector(const MetricId&, int numShards, Allocator *ba);
+        //   int numShards() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING SHARDED COLLECTORS" << endl
+                                  << "==========================" << endl;
+
+        const int SHARDS[]   = { 0, 1, 2, 3, 8, 64 };
+        const int NUM_SHARDS = sizeof(SHARDS) / sizeof(*SHARDS);
+
+        if (verbose) cout << "\tTesting 'numShards' and memory usage." << endl;
+        {
+            bslma::TestAllocator defaultAllocator;
+            bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+            {
+                Obj mX(METRIC_A); const Obj& MX = mX;
+                ASSERT(0 == MX.numShards());
+            }
+            for (int i = 0; i < NUM_SHARDS; ++i) {
+                bslma::TestAllocator ta;
+                {
+                    Obj mX(METRIC_A, SHARDS[i], &ta); const Obj& MX = mX;
+                    LOOP_ASSERT(i, SHARDS[i] == MX.numShards());
+                    LOOP_ASSERT(i, METRIC_A  == MX.metricId());
+                    LOOP_ASSERT(i, (0 == SHARDS[i] ? 0 : 1) ==
+                                                          ta.numBlocksInUse());
+                }
+                LOOP_ASSERT(i, 0 == ta.numBlocksInUse());
+            }
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\tComparing against a non-sharded collector."
+                          << endl;
+        {
+            struct {
+                int d_count;
+                int d_total;
+                int d_min;
+                int d_max;
+            } VALUES [] = {
+                {      0,        0,           0,           0 },
+                {      1,        1,           1,           1 },
+                {      1,        2,           3,           4 },
+                {     -1,       -2,          -3,          -4 },
+                { 100000,  2000000,     3000000,     4000000 },
+                {     10,  INT_MAX, INT_MIN + 1, INT_MAX - 1 },
+                {     10,  INT_MIN, INT_MAX - 1, INT_MIN + 1 }
+            };
+            const int NUM_VALUES = sizeof(VALUES)/sizeof(*VALUES);
+
+            for (int s = 1; s < NUM_SHARDS; ++s) {
+                bslma::TestAllocator ta;
+                Obj mX(METRIC_B, SHARDS[s], &ta); const Obj& MX = mX;
+                Obj mY(METRIC_B);                 const Obj& MY = mY;
+
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    const int COUNT = VALUES[i].d_count;
+                    const int TOTAL = VALUES[i].d_total;
+                    const int MIN   = VALUES[i].d_min;
+                    const int MAX   = VALUES[i].d_max;
+
+                    Rec r1, r2;
+
+                    mX.update(TOTAL);
+                    mY.update(TOTAL);
+                    MX.load(&r1);
+                    MY.load(&r2);
+                    LOOP2_ASSERT(s, i, r2 == r1);
+
+                    mX.accumulateCountTotalMinMax(COUNT, TOTAL, MIN, MAX);
+                    mY.accumulateCountTotalMinMax(COUNT, TOTAL, MIN, MAX);
+                    MX.load(&r1);
+                    MY.load(&r2);
+                    LOOP2_ASSERT(s, i, r2 == r1);
+
+                    if (i % 2) {
+                        mX.loadAndReset(&r1);
+                        mY.loadAndReset(&r2);
+                        LOOP2_ASSERT(s, i, r2 == r1);
+                    }
+
+                    mX.setCountTotalMinMax(COUNT, TOTAL, MIN, MAX);
+                    mY.setCountTotalMinMax(COUNT, TOTAL, MIN, MAX);
+                    MX.load(&r1);
+                    MY.load(&r2);
+                    LOOP2_ASSERT(s, i, r2 == r1);
+
+                    mX.update(MIN);
+                    mY.update(MIN);
+                    mX.loadAndReset(&r1);
+                    mY.loadAndReset(&r2);
+                    LOOP2_ASSERT(s, i, r2 == r1);
+
+                    MX.load(&r1);
+                    MY.load(&r2);
+                    LOOP2_ASSERT(s, i, r2 == r1);
+
+                    mX.update(MAX);
+                    mX.reset();
+                    MX.load(&r1);
+                    LOOP2_ASSERT(s, i, r2 == r1);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTesting concurrent updates." << endl;
+        {
+            enum { k_NUM_THREADS = 8, k_NUM_UPDATES = 20000 };
+
+            bslma::TestAllocator ta;
+            Obj mX(METRIC_C, 4, &ta);
+            bslmt::Barrier barrier(k_NUM_THREADS + 1);
+
+            bdlmt::FixedThreadPool pool(k_NUM_THREADS, k_NUM_THREADS, &ta);
+            pool.start();
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                pool.enqueueJob(bdlf::BindUtil::bind(&updateCollector,
+                                                     &mX,
+                                                     &barrier,
+                                                     (int)k_NUM_UPDATES));
+            }
+
+            bsls::Types::Int64 count = 0;
+            double             total = 0.0;
+            double             min   = Rec::k_DEFAULT_MIN;
+            double             max   = Rec::k_DEFAULT_MAX;
+
+            barrier.wait();
+            for (int i = 0; i < 1000; ++i) {
+                Rec r;
+                mX.loadAndReset(&r);
+                count += r.count();
+                total += r.total();
+                min    = bsl::min(min, r.min());
+                max    = bsl::max(max, r.max());
+            }
+            pool.drain();
+
+            Rec r;
+            mX.loadAndReset(&r);
+            count += r.count();
+            total += r.total();
+            min    = bsl::min(min, r.min());
+            max    = bsl::max(max, r.max());
+
+            const double EXP_TOTAL = k_NUM_THREADS *
+                      (k_NUM_UPDATES * (k_NUM_UPDATES + 1.0) / 2.0);
+
+            ASSERTV(count, k_NUM_THREADS * k_NUM_UPDATES == count);
+            ASSERTV(total, EXP_TOTAL == total);
+            ASSERTV(min,   1.0 == min);
+            ASSERTV(max,   k_NUM_UPDATES == max);
+        }
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // CONCURRENCY TEST
@@ -35,8 +35,18 @@ BSLS_IDENT("$Id: balm_metricrecord.h,v 1.8 2008/04/16 20:00:49 hversche Exp $")
 //   total        double           total of metric values           0.0
 //   min          double           minimum metric value             Infinity
 //   max          double           maximum metric value             -Infinity
+//   histogram    shared_ptr       histogram of metric values       null
 //..
 //
+// The optional 'histogram' attribute holds a (shared, non-modifiable)
+// 'balm::Histogram' of the recorded metric values, from which percentiles of
+// those values can be estimated.  It is loaded by 'balm::HistogramCollector'
+// (see 'balm_histogramcollector'), and is null for records loaded from other
+// collectors.  Note that the 'histogram' of a record, when not null, holds
+// the values recorded by histogram collectors only, whereas the 'count',
+// 'total', 'min', and 'max' of the record aggregate the values recorded by
+// every collector for the metric.
+//
 ///Thread Safety
 ///-------------
 // 'balm::MetricRecord' is *const* *thread-safe*, meaning that accessors may be
@@ -147,6 +157,10 @@ BSLS_IDENT("$Id: balm_metricrecord.h,v 1.8 2008/04/16 20:00:49 hversche Exp $")
 #include <balscm_version.h>
 #endif
 
+#ifndef INCLUDED_BALM_HISTOGRAM
+#include <balm_histogram.h>
+#endif
+
 #ifndef INCLUDED_BALM_METRICID
 #include <balm_metricid.h>
 #endif
@@ -155,6 +169,10 @@ BSLS_IDENT("$Id: balm_metricrecord.h,v 1.8 2008/04/16 20:00:49 hversche Exp $")
 #include <bsl_iosfwd.h>
 #endif
 
+#ifndef INCLUDED_BSL_MEMORY
+#include <bsl_memory.h>
+#endif
+
 namespace BloombergLP {
 
 namespace balm {
@@ -171,7 +189,8 @@ class MetricRecord {
     // defined 'k_DEFAULT_MIN' constant (the representation for positive
     // default 'total' is 0.0, the default 'min' is the infinity), and the
     // default 'max' is the defined 'k_DEFAULT_MAX' constant (the
-    // representation for negative infinity).
+    // representation for negative infinity).  A metric record may also hold
+    // a histogram of the measured values, which is null by default.
 
     // DATA
     MetricId d_metricId;  // id for the metric
@@ -179,6 +198,8 @@ class MetricRecord {
     double        d_total;     // total of values across events
     double        d_min;       // minimum value across events
     double        d_max;       // maximum value across events
+    bsl::shared_ptr<const Histogram>
+                  d_histogram; // histogram of the values, or null
 
   public:
     // PUBLIC CONSTANTS
@@ -188,20 +209,22 @@ class MetricRecord {
     // CREATORS
     MetricRecord();
         // Create a metric record having default values for its metric
-        // 'metricId', 'count', 'total', 'min', and 'max' attributes.  The
-        // default 'metricId' is the invalid id value, the default 'count' is
-        // 0, the default 'total' is 0.0,  the default 'min' is the defined
-        // 'k_DEFAULT_MIN' constant (the representation for positive infinity),
-        // and the default 'max' is the defined 'k_DEFAULT_MAX' constant (the
-        // representation for negative infinity).
+        // 'metricId', 'count', 'total', 'min', 'max', and 'histogram'
+        // attributes.  The default 'metricId' is the invalid id value, the
+        // default 'count' is 0, the default 'total' is 0.0,  the default 'min'
+        // is the defined 'k_DEFAULT_MIN' constant (the representation for
+        // positive infinity), the default 'max' is the defined
+        // 'k_DEFAULT_MAX' constant (the representation for negative
+        // infinity), and the default 'histogram' is null.
 
     MetricRecord(const MetricId& metricId);
         // Create a metric record having the specified 'metricId', and default
-        // values for the 'total', 'count', 'min', and 'max' attributes.  The
-        // default 'count' is 0, the default 'total' is 0.0, the default 'min'
-        // is the defined 'k_DEFAULT_MIN' constant (the representation for
-        // positive infinity), and the default 'max' is the defined
-        // 'k_DEFAULT_MAX' constant (the representation for negative infinity).
+        // values for the 'total', 'count', 'min', 'max', and 'histogram'
+        // attributes.  The default 'count' is 0, the default 'total' is 0.0,
+        // the default 'min' is the defined 'k_DEFAULT_MIN' constant (the
+        // representation for positive infinity), the default 'max' is the
+        // defined 'k_DEFAULT_MAX' constant (the representation for negative
+        // infinity), and the default 'histogram' is null.
 
     MetricRecord(const MetricId& metricId,
                  int             count,
@@ -209,7 +232,8 @@ class MetricRecord {
                  double          min,
                  double          max);
         // Create a metric record having the specified 'metricId', 'count',
-        // 'total', 'min', and 'max' attribute values.
+        // 'total', 'min', and 'max' attribute values, and a null
+        // 'histogram'.
 
     MetricRecord(const MetricRecord& original);
         // Create a metric record having the value of the specified 'original'
@@ -244,6 +268,11 @@ class MetricRecord {
         // Return a reference to the modifiable 'min' attribute representing
         // the minimum of the individually recorded values.
 
+    bsl::shared_ptr<const Histogram>& histogram();
+        // Return a reference to the modifiable 'histogram' attribute holding
+        // the (shared) histogram of the individually recorded values, or null
+        // if no histogram was recorded.
+
     // ACCESSORS
     const MetricId& metricId() const;
         // Return a reference to the non-modifiable 'metricId' attribute
@@ -265,6 +294,11 @@ class MetricRecord {
         // Return a reference to the non-modifiable 'min' attribute
         // representing the minimum of the individually recorded values.
 
+    const bsl::shared_ptr<const Histogram>& histogram() const;
+        // Return a reference to the non-modifiable 'histogram' attribute
+        // holding the (shared) histogram of the individually recorded values,
+        // or null if no histogram was recorded.
+
     bsl::ostream& print(bsl::ostream& stream) const;
         // Write a description of this record to the specified 'stream' and
         // return a reference to the modifiable 'stream'.
@@ -280,14 +314,18 @@ bool operator==(const MetricRecord& lhs, const MetricRecord& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' metric records have the
     // same value and 'false' otherwise.  Two records have the same value if
     // they have the same values for their 'metricId', 'count', 'total',
-    // 'min', and 'max' attributes, respectively.
+    // 'min', and 'max' attributes, respectively, and either both have a null
+    // 'histogram', or both have a histogram and those histograms have the
+    // same value.
 
 inline
 bool operator!=(const MetricRecord& lhs, const MetricRecord& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' metric records do not
     // have the same value and 'false' otherwise.  Two records do not have
     // same value if they differ in their respective values for 'metricId',
-    // 'count', 'total', 'min', or 'max' attributes.
+    // 'count', 'total', 'min', or 'max' attributes, or if only one of them
+    // has a histogram, or if both have histograms that do not have the same
+    // value.
 
 inline
 bsl::ostream& operator<<(bsl::ostream&       stream,
@@ -312,6 +350,7 @@ MetricRecord::MetricRecord()
 , d_total(0.0)
 , d_min(k_DEFAULT_MIN)
 , d_max(k_DEFAULT_MAX)
+, d_histogram()
 {
 }
 
@@ -322,6 +361,7 @@ MetricRecord::MetricRecord(const MetricId& metricId)
 , d_total(0.0)
 , d_min(k_DEFAULT_MIN)
 , d_max(k_DEFAULT_MAX)
+, d_histogram()
 {
 }
 
@@ -336,6 +376,7 @@ MetricRecord::MetricRecord(const MetricId& metricId,
 , d_total(total)
 , d_min(min)
 , d_max(max)
+, d_histogram()
 {
 }
 
@@ -346,6 +387,7 @@ MetricRecord::MetricRecord(const MetricRecord& original)
 , d_total(original.d_total)
 , d_min(original.d_min)
 , d_max(original.d_max)
+, d_histogram(original.d_histogram)
 {
 }
 
@@ -353,11 +395,12 @@ MetricRecord::MetricRecord(const MetricRecord& original)
 inline
 MetricRecord& MetricRecord::operator=(const MetricRecord& rhs)
 {
-    d_metricId = rhs.d_metricId;
-    d_count    = rhs.d_count;
-    d_total    = rhs.d_total;
-    d_min      = rhs.d_min;
-    d_max      = rhs.d_max;
+    d_metricId  = rhs.d_metricId;
+    d_count     = rhs.d_count;
+    d_total     = rhs.d_total;
+    d_min       = rhs.d_min;
+    d_max       = rhs.d_max;
+    d_histogram = rhs.d_histogram;
     return *this;
 }
 
@@ -391,6 +434,12 @@ double& MetricRecord::min()
     return d_min;
 }
 
+inline
+bsl::shared_ptr<const Histogram>& MetricRecord::histogram()
+{
+    return d_histogram;
+}
+
 // ACCESSORS
 inline
 const MetricId& MetricRecord::metricId() const
@@ -422,6 +471,12 @@ const double& MetricRecord::min() const
     return d_min;
 }
 
+inline
+const bsl::shared_ptr<const Histogram>& MetricRecord::histogram() const
+{
+    return d_histogram;
+}
+
 }  // close package namespace
 
 // FREE OPERATORS
@@ -432,7 +487,10 @@ bool balm::operator==(const MetricRecord& lhs, const MetricRecord& rhs)
         && lhs.count()    == rhs.count()
         && lhs.total()    == rhs.total()
         && lhs.min()      == rhs.min()
-        && lhs.max()      == rhs.max();
+        && lhs.max()      == rhs.max()
+        && (lhs.histogram() == rhs.histogram()
+         || (lhs.histogram() && rhs.histogram()
+          && *lhs.histogram() == *rhs.histogram()));
 }
 
 inline
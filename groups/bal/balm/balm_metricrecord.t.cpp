@@ -17,6 +17,7 @@
 #include <bsl_cstring.h>
 #include <bsl_cstdlib.h>
 #include <bsl_limits.h>
+#include <bsl_memory.h>
 
 #include <bslim_testutil.h>
 
@@ -54,6 +55,7 @@ using bsl::flush;
 // [ 2]  double& total();
 // [ 2]  double& max();
 // [ 2]  double& min();
+// [10]  bsl::shared_ptr<const balm::Histogram>& histogram();
 //
 // ACCESSORS
 // [ 2]  const balm::MetricId& metric() const;
@@ -61,6 +63,7 @@ using bsl::flush;
 // [ 2]  const double& total() const;
 // [ 2]  const double& max() const;
 // [ 2]  const double& min() const;
+// [10]  const bsl::shared_ptr<const balm::Histogram>& histogram() const;
 // [ 7]  bsl::ostream& print(bsl::ostream &stream) const;
 //
 // FREE OPERATORS
@@ -73,6 +76,7 @@ using bsl::flush;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] USAGE EXAMPLE
+// [ 9] CONCERN: DEFAULT VALUES
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -207,6 +211,62 @@ int main(int argc, char *argv[])
     Desc mE(&cA, "E"); const Desc *ME = &mE;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING 'histogram'
+        //
+        // Concerns:
+        //: 1 A record is created without a histogram, and the histogram
+        //:   attribute can be set and cleared.
+        //:
+        //: 2 The histogram is shared by copies of a record.
+        //:
+        //: 3 Records compare equal only if they both have no histogram, or
+        //:   both have histograms having the same value.
+        //
+        // Plan:
+        //: 1 Set, copy, compare, and clear the histogram of records.  (C-1..3)
+        //
+        // Testing:
+        //   bsl::shared_ptr<const balm::Histogram>& histogram();
+        //   const bsl::shared_ptr<const balm::Histogram>& histogram() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting 'histogram'"
+                          << "\n===================" << endl;
+
+        bsl::shared_ptr<balm::Histogram> h1(new balm::Histogram());
+        bsl::shared_ptr<balm::Histogram> h2(new balm::Histogram());
+        h1->add(5.0);
+        h2->add(5.0);
+
+        Obj mX(Id(MA), 1, 5.0, 5.0, 5.0); const Obj& X = mX;
+        Obj mY(Id(MA), 1, 5.0, 5.0, 5.0); const Obj& Y = mY;
+        ASSERT(0 == X.histogram());
+        ASSERT(X == Y);
+
+        mX.histogram() = h1;
+        ASSERT(h1 == X.histogram());
+        ASSERT(X != Y);
+
+        const Obj Z(X);
+        ASSERT(h1 == Z.histogram());
+        ASSERT(X  == Z);
+
+        mY = X;
+        ASSERT(h1 == Y.histogram());
+
+        mY.histogram() = h2;
+        ASSERT(X == Y);
+
+        h2->add(6.0);
+        ASSERT(X != Y);
+
+        mX.histogram().reset();
+        mY.histogram().reset();
+        ASSERT(0 == X.histogram());
+        ASSERT(X == Y);
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // TESTING DEFAULT VALUES
@@ -38,6 +38,16 @@ BSLS_IDENT("$Id: $")
 // event occurrences along with the total, minimum, and maximum aggregates of
 // the measured values.
 //
+///Sharded Collectors
+///------------------
+// A metrics manager created with a positive number of collector shards
+// configures the collector repository it owns so that every collector it
+// creates aggregates values in that many lock-free, per-thread shards (see
+// 'balm_collector').  Metrics that are updated very frequently from many
+// threads (including through the 'balm_metrics' macros, which obtain their
+// collectors from the metrics manager) then no longer contend for a single
+// collector's mutex.
+//
 ///Thread Safety
 ///-------------
 // 'balm::MetricsManager' is fully *thread-safe*, meaning that all non-creator
@@ -535,6 +545,16 @@ class MetricsManager {
         // used to supply memory.  If 'basicAllocator' is 0, the currently
         // installed default allocator is used.
 
+    explicit MetricsManager(int               numCollectorShards,
+                            bslma::Allocator *basicAllocator = 0);
+        // Create a 'MetricsManager' whose collector repository creates
+        // collectors having the specified 'numCollectorShards' shards, if
+        // '0 < numCollectorShards', and non-sharded collectors otherwise (see
+        // {Sharded Collectors}).  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  The behavior is undefined
+        // unless '0 <= numCollectorShards'.
+
     ~MetricsManager();
         // Destroy this 'MetricsManager'.
 
@@ -85,6 +85,7 @@ using bsl::flush;
 // ----------------------------------------------------------------------------
 // CREATORS
 // [ 5]  balm::MetricsManager(bslma::Allocator *basicAllocator = 0);
+// [ 5]  balm::MetricsManager(int numCollectorShards, Allocator *ba = 0);
 // [ 5]  ~balm::MetricsManager();
 // MANIPULATORS
 // [16]  CallbackHandle registerCollectionCallback(const char * ,
@@ -3623,6 +3624,7 @@ int main(int argc, char *argv[])
         //
         // Testing:
         //   balm::MetricsManager(bslma::Allocator *);
+        //   balm::MetricsManager(int, bslma::Allocator *);
         //   ~balm::MetricsManager();
         //   balm::CollectorRepository& collectorRepository();
         //   balm::MetricRegistry& metricRegistry();
@@ -3653,6 +3655,21 @@ int main(int argc, char *argv[])
 
             ASSERT(0 == defaultAllocator.numBytesInUse());
             ASSERT(0 <  testAlloc.numBytesInUse());
+            ASSERT(0 == REPOSITORY.numCollectorShards());
+        }
+        ASSERT(0 == defaultAllocator.numBytesInUse());
+        ASSERT(0 == testAlloc.numBytesInUse());
+        {
+            Obj mX(8, Z); const Obj& MX = mX;
+
+            ASSERT(0 == defaultAllocator.numBytesInUse());
+            ASSERT(0 <  testAlloc.numBytesInUse());
+
+            ASSERT(&MX.metricRegistry() ==
+                   &MX.collectorRepository().registry());
+            ASSERT(8 == MX.collectorRepository().numCollectorShards());
+
+            ASSERT(0 == defaultAllocator.numBytesInUse());
         }
         ASSERT(0 == defaultAllocator.numBytesInUse());
         ASSERT(0 == testAlloc.numBytesInUse());
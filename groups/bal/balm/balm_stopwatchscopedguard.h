@@ -42,6 +42,18 @@ BSLS_IDENT("$Id: $")
 // than an object instance).  In most instances, however, choosing between the
 // two is a matter of taste.
 //
+///Recording Latency Percentiles
+///-----------------------------
+// A 'balm::StopwatchScopedGuard' can also be supplied a
+// 'balm::HistogramCollector' (typically obtained from the
+// 'getDefaultHistogramCollector' method of a 'balm::CollectorRepository'), in
+// which case it records elapsed times to a histogram, so that percentiles of
+// the elapsed times (e.g., the 99th percentile latency) are published along
+// with their count, total, minimum, and maximum (see 'balm_streampublisher').
+// Note that elapsed times are best recorded to a histogram in the smallest
+// units of interest (e.g., 'k_MICROSECONDS'), although the relative precision
+// of the histogram does not depend on those units.
+//
 ///Thread Safety
 ///-------------
 // 'balm::StopwatchScopedGuard' is *const* *thread-safe*, meaning that
@@ -165,6 +177,10 @@ BSLS_IDENT("$Id: $")
 #include <balm_defaultmetricsmanager.h>
 #endif
 
+#ifndef INCLUDED_BALM_HISTOGRAMCOLLECTOR
+#include <balm_histogramcollector.h>
+#endif
+
 #ifndef INCLUDED_BALM_METRIC
 #include <balm_metric.h>
 #endif
@@ -226,6 +242,12 @@ class StopwatchScopedGuard {
     Collector *d_collector_p;  // metric collector (held, not owned); may
                                     // be 0, but cannot be invalid
 
+    HistogramCollector
+                   *d_histogramCollector_p;
+                                    // histogram collector (held, not owned);
+                                    // may be 0, and is 0 unless
+                                    // 'd_collector_p' is 0
+
     // NOT IMPLEMENTED
     StopwatchScopedGuard(const StopwatchScopedGuard&);
     StopwatchScopedGuard& operator=(const StopwatchScopedGuard&);
@@ -256,6 +278,20 @@ class StopwatchScopedGuard {
         // this guard, but does *not* affect the precision of the elapsed time
         // measurement.
 
+    explicit StopwatchScopedGuard(HistogramCollector *collector,
+                                  Units               timeUnits = k_SECONDS);
+        // Initialize this scoped guard to record elapsed time to the
+        // histogram of the specified 'collector' (see {Recording Latency
+        // Percentiles}).  Optionally specify the 'timeUnits' in which to
+        // report elapsed time.  If 'collector' is 0 or
+        // 'collector->category().enabled() == false', this object will be
+        // inactive (i.e., will not record any values).  The behavior is
+        // undefined unless
+        // 'collector == 0 || collector->metricId().isValid()'.  Note that
+        // 'timeUnits' indicates the scale of the double value reported by
+        // this guard, but does *not* affect the precision of the elapsed time
+        // measurement.
+
     StopwatchScopedGuard(const MetricId&  metricId,
                          MetricsManager  *manager = 0);
     StopwatchScopedGuard(const MetricId&  metricId,
@@ -330,6 +366,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(Metric *metric,
 : d_stopwatch()
 , d_timeUnits(timeUnits)
 , d_collector_p(metric->isActive() ? metric->collector() : 0)
+, d_histogramCollector_p(0)
 {
     if (d_collector_p) {
         d_stopwatch.start();
@@ -344,18 +381,36 @@ StopwatchScopedGuard::StopwatchScopedGuard(Collector *collector,
 , d_collector_p((collector && collector->metricId().category()->enabled())
                 ? collector
                 : 0)
+, d_histogramCollector_p(0)
 {
     if (d_collector_p) {
         d_stopwatch.start();
     }
 }
 
+inline
+StopwatchScopedGuard::StopwatchScopedGuard(HistogramCollector *collector,
+                                           Units               timeUnits)
+: d_stopwatch()
+, d_timeUnits(timeUnits)
+, d_collector_p(0)
+, d_histogramCollector_p(
+              (collector && collector->metricId().category()->enabled())
+              ? collector
+              : 0)
+{
+    if (d_histogramCollector_p) {
+        d_stopwatch.start();
+    }
+}
+
 inline
 StopwatchScopedGuard::StopwatchScopedGuard(const MetricId&  metricId,
                                            MetricsManager  *manager)
 : d_stopwatch()
 , d_timeUnits(k_SECONDS)
 , d_collector_p(0)
+, d_histogramCollector_p(0)
 {
     Collector *collector = Metric::lookupCollector(metricId, manager);
     d_collector_p = (collector &&
@@ -373,6 +428,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(const MetricId&  metricId,
 : d_stopwatch()
 , d_timeUnits(timeUnits)
 , d_collector_p(0)
+, d_histogramCollector_p(0)
 {
     Collector *collector = Metric::lookupCollector(metricId, manager);
     d_collector_p = (collector &&
@@ -390,6 +446,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(const char     *category,
 : d_stopwatch()
 , d_timeUnits(k_SECONDS)
 , d_collector_p(0)
+, d_histogramCollector_p(0)
 {
     Collector *collector = Metric::lookupCollector(category, name, manager);
 
@@ -410,6 +467,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(const char     *category,
 : d_stopwatch()
 , d_timeUnits(timeUnits)
 , d_collector_p(0)
+, d_histogramCollector_p(0)
 {
     Collector *collector = Metric::lookupCollector(category, name, manager);
     d_collector_p = (collector && collector->metricId().category()->enabled())
@@ -423,7 +481,13 @@ inline
 StopwatchScopedGuard::~StopwatchScopedGuard()
 {
     if (isActive()) {
-        d_collector_p->update(d_stopwatch.elapsedTime() * d_timeUnits);
+        const double elapsedTime = d_stopwatch.elapsedTime() * d_timeUnits;
+        if (d_collector_p) {
+            d_collector_p->update(elapsedTime);
+        }
+        else {
+            d_histogramCollector_p->update(elapsedTime);
+        }
     }
 }
 
@@ -431,8 +495,11 @@ StopwatchScopedGuard::~StopwatchScopedGuard()
 inline
 bool StopwatchScopedGuard::isActive() const
 {
-    return 0 != d_collector_p
-        && d_collector_p->metricId().category()->enabled();
+    if (d_collector_p) {
+        return d_collector_p->metricId().category()->enabled();       // RETURN
+    }
+    return 0 != d_histogramCollector_p
+        && d_histogramCollector_p->metricId().category()->enabled();
 }
 
 }  // close package namespace
@@ -55,6 +55,7 @@ using bsl::flush;
 // CREATORS
 // [ 4]  explicit balm::StopwatchScopedGuard(balm::Metric *metric);
 // [ 3]  explicit balm::StopwatchScopedGuard(balm::Collector *collector);
+// [ 7]  explicit balm::StopwatchScopedGuard(HistogramCollector *, Units);
 // [ 4]  balm::StopwatchScopedGuard(const balm::MetricId&  ,
 //                                 balm::MetricsManager  * = 0);
 // [ 4]  balm::StopwatchScopedGuard(const char * ,
@@ -68,6 +69,7 @@ using bsl::flush;
 // [ 2] 'TestPublisher'                             (helper classes)
 // [ 3] TESTING REPORTED TIME UNITS
 // [ 6] ELAPSED TIME VALUE
+// [ 7] HISTOGRAM COLLECTOR
 // [ 8] USAGE
 
 // ============================================================================
@@ -507,6 +509,70 @@ int main(int argc, char *argv[])
     }
         ASSERT(0 == balm::DefaultMetricsManager::instance());
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING HISTOGRAM COLLECTOR
+        //
+        // Concerns:
+        //: 1 A guard created with a histogram collector records the elapsed
+        //:   time, in the requested units, to that collector.
+        //:
+        //: 2 A guard created with a null histogram collector, or a histogram
+        //:   collector for a disabled category, is inactive.
+        //
+        // Plan:
+        //: 1 Create guards for a histogram collector, using different time
+        //:   units, and verify the values recorded to the collector.  (C-1)
+        //:
+        //: 2 Create guards for a null collector and a disabled collector, and
+        //:   verify 'isActive' and that no value is recorded.  (C-2)
+        //
+        // Testing:
+        //   explicit balm::StopwatchScopedGuard(HistogramCollector *, Units);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "HISTOGRAM COLLECTOR\n"
+                          << "===================\n";
+
+        MetricsManager  manager(Z);
+        Repository&     repository = manager.collectorRepository();
+        balm::HistogramCollector *collector =
+                              repository.getDefaultHistogramCollector("A", "1");
+
+        double ms = 1.0 * .001;
+        {
+            Obj mX(collector);
+            ASSERT(mX.isActive());
+            bslmt::ThreadUtil::sleep(bsls::TimeInterval(20 * ms));
+        }
+        {
+            Obj mX(collector, Obj::k_MILLISECONDS);
+            ASSERT(mX.isActive());
+            bslmt::ThreadUtil::sleep(bsls::TimeInterval(20 * ms));
+        }
+
+        balm::Histogram histogram(Z);
+        collector->loadAndReset(&histogram);
+        ASSERT(2 == histogram.count());
+        ASSERTV(histogram.min(), 0.02 <= histogram.min());
+        ASSERTV(histogram.min(), histogram.min() <  1.0);
+        ASSERTV(histogram.max(), 20.0 <= histogram.max());
+        ASSERTV(histogram.max(), histogram.max() <  1000.0);
+
+        {
+            Obj mX(static_cast<balm::HistogramCollector *>(0));
+            ASSERT(!mX.isActive());
+        }
+
+        manager.setCategoryEnabled("A", false);
+        {
+            Obj mX(collector);
+            ASSERT(!mX.isActive());
+        }
+        collector->loadAndReset(&histogram);
+        ASSERT(0 == histogram.count());
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // TESTING ELAPSED TIME VALUE:
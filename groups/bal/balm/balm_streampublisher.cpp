@@ -14,6 +14,7 @@ BSLS_IDENT_RCSID(balm_streampublisher_cpp,"$Id$ $CSID$")
 
 #include <bdlt_datetimetz.h>
 
+#include <balm_histogram.h>
 #include <balm_metricformat.h>
 #include <balm_metricrecord.h>
 #include <balm_metricsample.h>
@@ -118,6 +119,31 @@ void formatValue(bsl::ostream&                 stream,
     }
 }
 
+void publishPercentiles(bsl::ostream&                 stream,
+                        const balm::Histogram&        histogram,
+                        const balm::MetricFormatSpec *formatSpec)
+    // Publish, to the specified 'stream', the percentiles of the specified
+    // non-empty 'histogram', formatted using the specified 'formatSpec'.
+{
+    static const struct {
+        double      d_percent;  // percentile
+        const char *d_name;     // published name
+    } PERCENTILES[] = {
+        { 50.0, "p50"   },
+        { 90.0, "p90"   },
+        { 99.0, "p99"   },
+        { 99.9, "p99.9" }
+    };
+    const int NUM_PERCENTILES = sizeof PERCENTILES / sizeof *PERCENTILES;
+
+    for (int i = 0; i < NUM_PERCENTILES; ++i) {
+        stream << ", " << PERCENTILES[i].d_name << " = ";
+        formatValue(stream,
+                    histogram.percentile(PERCENTILES[i].d_percent),
+                    formatSpec);
+    }
+}
+
 void publishRecord(bsl::ostream&             stream,
                    const balm::MetricRecord& record,
                    double                    elapsedTime)
@@ -169,6 +195,14 @@ void publishRecord(bsl::ostream&             stream,
         }
     }
 
+    if (record.histogram() && 0 < record.histogram()->count()) {
+        publishPercentiles(
+                   stream,
+                   *record.histogram(),
+                   format ? format->formatSpec(balm::PublicationType::e_MAX)
+                          : 0);
+    }
+
     stream << " ]\n";
 }
 
@@ -37,6 +37,21 @@ BSLS_IDENT("$Id: $")
 // This implementation of the publisher protocol publishes records to an output
 // stream that is supplied at construction.
 //
+///Percentiles
+///-----------
+// If a published record holds a non-empty histogram of the recorded values
+// (see 'balm_histogramcollector'), the estimated median, 90th, 99th, and
+// 99.9th percentiles of those values are written after its other aggregate
+// values, for example:
+//..
+//  MyCategory.Latency [ count = 1000, total = 500500, min = 1, max = 1000,
+//                       p50 = 500, p90 = 904, p99 = 984, p99.9 = 1000 ]
+//..
+// (shown here on two lines).  If the metric has a format (see
+// 'balm_metricformat'), the percentiles are formatted using the format
+// specification for the 'e_MAX' publication type, since they are expressed in
+// the same units as the maximum.
+//
 ///Usage
 ///-----
 // In the following example we illustrate how to create and publish records
@@ -21,6 +21,9 @@
 #include <bsl_iostream.h>
 #include <bsl_ostream.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
 
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
@@ -40,6 +43,9 @@ using bsl::flush;
 //                                 --------
 // ----------------------------------------------------------------------------
 // ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] PUBLISHING PERCENTILES
+// [ 3] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -101,7 +107,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 2: {
+      case 3: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -168,6 +174,100 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PUBLISHING PERCENTILES
+        //
+        // Concerns:
+        //: 1 The percentiles of a record having a non-empty histogram are
+        //:   published after its other values.
+        //:
+        //: 2 No percentiles are published for a record having no histogram,
+        //:   or an empty histogram.
+        //:
+        //: 3 Percentiles are formatted using the format of the maximum.
+        //
+        // Plan:
+        //: 1 Publish records with and without a histogram, with and without a
+        //:   metric format, and compare the output to the expected output.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   PUBLISHING PERCENTILES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING PUBLISHING PERCENTILES" << endl
+                          << "==============================" << endl;
+
+        bslma::TestAllocator ta, da;
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        balm::Category myCategory("MyCategory");
+        balm::MetricDescription descA(&myCategory, "A");
+        balm::MetricDescription descB(&myCategory, "B");
+        balm::MetricDescription descC(&myCategory, "C");
+        balm::MetricId metricA(&descA);
+        balm::MetricId metricB(&descB);
+        balm::MetricId metricC(&descC);
+
+        bsl::shared_ptr<balm::Histogram> histogram;
+        histogram.createInplace(&ta, &ta);
+        histogram->add(2.0);
+
+        bsl::shared_ptr<balm::Histogram> empty;
+        empty.createInplace(&ta, &ta);
+
+        bsl::vector<balm::MetricRecord> records(&ta);
+        records.push_back(balm::MetricRecord(metricA, 1, 2.0, 2.0, 2.0));
+        records.push_back(balm::MetricRecord(metricB, 1, 2.0, 2.0, 2.0));
+        records.push_back(balm::MetricRecord(metricC, 0, 0.0, 0.0, 0.0));
+        records[0].histogram() = histogram;
+        records[2].histogram() = empty;
+
+        balm::MetricSample sample(&ta);
+        sample.setTimeStamp(bdlt::DatetimeTz(bdlt::CurrentTime::utc(), 0));
+        sample.appendGroup(records.data(),
+                           static_cast<int>(records.size()),
+                           bsls::TimeInterval(1, 0));
+
+        {
+            bsl::ostringstream stream;
+            Obj mX(stream);
+            mX.publish(sample);
+
+            const bsl::string OUTPUT = stream.str();
+            if (veryVerbose) { P(OUTPUT) }
+
+            ASSERTV(OUTPUT, bsl::string::npos != OUTPUT.find(
+                "MyCategory.A[ count = 1, total = 2, min = 2, max = 2, "
+                "p50 = 2, p90 = 2, p99 = 2, p99.9 = 2 ]"));
+            ASSERTV(OUTPUT, bsl::string::npos != OUTPUT.find(
+                "MyCategory.B[ count = 1, total = 2, min = 2, max = 2 ]"));
+            ASSERTV(OUTPUT, bsl::string::npos != OUTPUT.find(
+                "MyCategory.C[ count = 0, total = 0, min = 0, max = 0 ]"));
+        }
+        {
+            bsl::shared_ptr<balm::MetricFormat> format;
+            format.createInplace(&ta, &ta);
+            format->setFormatSpec(balm::PublicationType::e_MAX,
+                                  balm::MetricFormatSpec(1000, "%.1fms"));
+            descA.setFormat(format);
+
+            bsl::ostringstream stream;
+            Obj mX(stream);
+            mX.publish(sample);
+
+            const bsl::string OUTPUT = stream.str();
+            if (veryVerbose) { P(OUTPUT) }
+
+            ASSERTV(OUTPUT, bsl::string::npos != OUTPUT.find(
+                "MyCategory.A[ count = 1, total = 2, min = 2, "
+                "max = 2000.0ms, p50 = 2000.0ms, p90 = 2000.0ms, "
+                "p99 = 2000.0ms, p99.9 = 2000.0ms ]"));
+        }
+        ASSERT(0 == da.numBlocksInUse());
+      } break;
       case 1: {
         // --------------------------------------------------------------------
         // BREATHING TEST:
@@ -197,6 +197,7 @@ Decoder::Decoder(const DecoderOptions *options,
 , d_numUnknownElementsSkipped(0)
 , d_fatalError(false)
 , d_remainingDepth(1)
+, d_attributeNameIndexes(d_allocator)
 {
     BSLS_ASSERT(d_options != 0);
     BSLS_ASSERT(d_reader != 0);
@@ -221,6 +222,7 @@ Decoder::Decoder(const DecoderOptions *options,
 , d_numUnknownElementsSkipped(0)
 , d_fatalError(false)
 , d_remainingDepth(1)
+, d_attributeNameIndexes(d_allocator)
 {
     BSLS_ASSERT(d_options != 0);
     BSLS_ASSERT(d_reader != 0);
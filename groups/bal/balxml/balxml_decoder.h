@@ -292,6 +292,10 @@ BSLS_IDENT("$Id: $")
 #include <bdlat_arrayfunctions.h>
 #endif
 
+#ifndef INCLUDED_BDLAT_ATTRIBUTENAMEINDEX
+#include <bdlat_attributenameindex.h>
+#endif
+
 #ifndef INCLUDED_BDLAT_CHOICEFUNCTIONS
 #include <bdlat_choicefunctions.h>
 #endif
@@ -449,6 +453,8 @@ class Decoder {
     friend class  Decoder_ElementContext;
     friend struct Decoder_decodeImpProxy;
     friend class  Decoder_ErrorLogger;
+    template <class TYPE>
+    friend class  Decoder_SequenceContext;
 
     // PRIVATE TYPES
     class MemOutStream : public bsl::ostream {
@@ -514,6 +520,9 @@ class Decoder {
     int                              d_remainingDepth;
         // remaining number of nesting levels allowed
 
+    bdlat_AttributeNameIndexCache    d_attributeNameIndexes;
+        // attribute name index of each sequence type decoded
+
     // NOT IMPLEMENTED
     Decoder(const Decoder&);
     Decoder operator=(const Decoder&);
@@ -1127,8 +1136,16 @@ class Decoder_SequenceContext : public Decoder_ElementContext {
     // Context for types that fall under 'bdlat_TypeCategory::Sequence'.
 
     // DATA
-    bdlb::NullableValue<int>  d_simpleContentId;
-    TYPE                     *d_object_p;
+    bdlb::NullableValue<int>        d_simpleContentId;
+    TYPE                           *d_object_p;
+
+    const bdlat_AttributeNameIndex *d_attributeNameIndex_p;
+        // attribute name index of 'TYPE', or 0 if there is none (held, not
+        // owned)
+
+    int                             d_nextAttributePosition;
+        // position, in 'd_attributeNameIndex_p', of the attribute expected
+        // to be read next
 
     // NOT IMPLEMENTED
     Decoder_SequenceContext(const Decoder_SequenceContext&);
@@ -2408,6 +2425,8 @@ inline
 Decoder_SequenceContext<TYPE>::Decoder_SequenceContext(TYPE *object,
                                                        int   formattingMode)
 : d_object_p(object)
+, d_attributeNameIndex_p(0)
+, d_nextAttributePosition(0)
 {
     (void) formattingMode;
     BSLS_ASSERT_SAFE(bdlat_FormattingMode::e_DEFAULT ==
@@ -2433,6 +2452,10 @@ int Decoder_SequenceContext<TYPE>::startElement(Decoder *decoder)
                                        << BALXML_DECODER_LOG_END;
     }
 
+    d_attributeNameIndex_p =
+                       decoder->d_attributeNameIndexes.lookupIndex(d_object_p);
+    d_nextAttributePosition = 0;
+
     return ret;
 }
 
@@ -2515,6 +2538,26 @@ int Decoder_SequenceContext<TYPE>::parseSubElement(const char *elementName,
 
     const int lenName = static_cast<int>(bsl::strlen(elementName));
 
+    // Resolve 'elementName' using the attribute name index of 'TYPE',
+    // expecting elements in the order in which 'TYPE' declares them, and fall
+    // back on the name-based lookup of 'TYPE' for names unknown to the index
+    // (see 'bdlat_attributenameindex').
+
+    int attributeId;
+    if (d_attributeNameIndex_p
+     && 0 == d_attributeNameIndex_p->findAttributeId(
+                                                     &attributeId,
+                                                     &d_nextAttributePosition,
+                                                     elementName,
+                                                     lenName)) {
+        Decoder_ParseSequenceSubElement visitor(decoder, elementName, lenName);
+
+        return bdlat_SequenceFunctions::manipulateAttribute(d_object_p,
+                                                            visitor,
+                                                            attributeId);
+                                                                      // RETURN
+    }
+
     if (decoder->options()->skipUnknownElements()
      && false == bdlat_SequenceFunctions::hasAttribute(*d_object_p,
                                                        elementName,
@@ -0,0 +1,162 @@
+// bdlat_attributenameindex.cpp                                       -*-C++-*-
+#include <bdlat_attributenameindex.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlat_attributenameindex_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+
+                       // ------------------------------
+                       // class bdlat_AttributeNameIndex
+                       // ------------------------------
+
+// PRIVATE ACCESSORS
+int bdlat_AttributeNameIndex::findIndex(const char *name,
+                                        int         nameLength) const
+{
+    if (d_table.empty()) {
+        return -1;                                                    // RETURN
+    }
+
+    const unsigned int nameHash = hash(name, nameLength);
+    const bsl::size_t  mask     = d_table.size() - 1;
+
+    // The table is never more than half full, so the probe sequence always
+    // reaches an empty slot.
+
+    for (bsl::size_t slot = nameHash & mask;; slot = (slot + 1) & mask) {
+        const int index = d_table[slot] - 1;
+        if (index < 0) {
+            return -1;                                                // RETURN
+        }
+        if (d_entries[index].d_hash == nameHash
+         && isMatch(index, name, nameLength)) {
+            return index;                                             // RETURN
+        }
+    }
+}
+
+// MANIPULATORS
+int bdlat_AttributeNameIndex::addAttribute(const char *name,
+                                           int         nameLength,
+                                           int         id)
+{
+    BSLS_ASSERT(0 <= nameLength);
+    BSLS_ASSERT(name || 0 == nameLength);
+
+    if (0 <= findIndex(name, nameLength)) {
+        return -1;                                                    // RETURN
+    }
+
+    Entry entry;
+    entry.d_nameOffset = d_names.length();
+    entry.d_nameLength = nameLength;
+    entry.d_id         = id;
+    entry.d_hash       = hash(name, nameLength);
+
+    d_names.append(name, nameLength);
+    d_entries.push_back(entry);
+
+    if (d_table.size() < 2 * d_entries.size()) {
+        // Grow the table, and rehash every entry.
+
+        bsl::size_t size = d_table.empty() ? 8 : d_table.size();
+        while (size < 2 * d_entries.size()) {
+            size *= 2;
+        }
+
+        d_table.assign(size, 0);
+        for (bsl::size_t i = 0; i < d_entries.size(); ++i) {
+            bsl::size_t slot = d_entries[i].d_hash & (size - 1);
+            while (0 != d_table[slot]) {
+                slot = (slot + 1) & (size - 1);
+            }
+            d_table[slot] = static_cast<int>(i + 1);
+        }
+    }
+    else {
+        const bsl::size_t mask = d_table.size() - 1;
+
+        bsl::size_t slot = entry.d_hash & mask;
+        while (0 != d_table[slot]) {
+            slot = (slot + 1) & mask;
+        }
+        d_table[slot] = static_cast<int>(d_entries.size());
+    }
+
+    return 0;
+}
+
+void bdlat_AttributeNameIndex::clear()
+{
+    d_names.clear();
+    d_entries.clear();
+    d_table.clear();
+}
+
+                    // -----------------------------------
+                    // class bdlat_AttributeNameIndexCache
+                    // -----------------------------------
+
+// PRIVATE MANIPULATORS
+bdlat_AttributeNameIndex *bdlat_AttributeNameIndexCache::findOrInsert(
+                                                          const void *key,
+                                                          bool       *isNew)
+{
+    BSLS_ASSERT(isNew);
+
+    IndexMap::iterator it = d_indexes.lower_bound(key);
+    if (d_indexes.end() != it && it->first == key) {
+        *isNew = false;
+        return it->second;                                            // RETURN
+    }
+
+    bdlat_AttributeNameIndex *index = new (*d_allocator_p)
+                                      bdlat_AttributeNameIndex(d_allocator_p);
+
+    d_indexes.insert(it, bsl::make_pair(key, index));
+
+    *isNew = true;
+    return index;
+}
+
+// CREATORS
+bdlat_AttributeNameIndexCache::bdlat_AttributeNameIndexCache(
+                                              bslma::Allocator *basicAllocator)
+: d_indexes(basicAllocator)
+, d_lastKey_p(0)
+, d_lastIndex_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+bdlat_AttributeNameIndexCache::~bdlat_AttributeNameIndexCache()
+{
+    for (IndexMap::iterator it = d_indexes.begin();
+         it != d_indexes.end();
+         ++it) {
+        d_allocator_p->deleteObjectRaw(it->second);
+    }
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,599 @@
+// bdlat_attributenameindex.h                                         -*-C++-*-
+#ifndef INCLUDED_BDLAT_ATTRIBUTENAMEINDEX
+#define INCLUDED_BDLAT_ATTRIBUTENAMEINDEX
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a precomputed index of the attribute names of a sequence.
+//
+//@CLASSES:
+//  bdlat_AttributeNameIndex: hash index from attribute names to attribute ids
+//  bdlat_AttributeNameIndexCache: per-type cache of attribute name indexes
+//
+//@SEE_ALSO: bdlat_sequencefunctions, bdlat_attributeinfo
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'bdlat_AttributeNameIndex', that maps the names of the attributes of a
+// 'bdeat' "sequence" type to their ids, and a mechanism,
+// 'bdlat_AttributeNameIndexCache', that builds and retains one such index per
+// sequence type.
+//
+// Decoders resolve each element name they read using
+// 'bdlat_SequenceFunctions::manipulateAttribute(object, manipulator, name,
+// nameLength)', which, for generated types, is a chain of comparisons whose
+// cost grows with the number of attributes of the type.  A
+// 'bdlat_AttributeNameIndex' is built once from the 'bdlat_AttributeInfo' of
+// each attribute, as visited by
+// 'bdlat_SequenceFunctions::manipulateAttributes' (which, unlike
+// 'accessAttributes', every decodable type provides; the object is not
+// modified), and resolves a name with a single hash-table probe; the
+// attribute can then be manipulated by id.
+//
+///Expected Attribute Position
+///---------------------------
+// Encoders emit the attributes of a sequence in the order in which the type
+// declares them, so a decoder can usually predict which attribute comes next.
+// The 'findAttributeId' overload taking a 'position' argument first compares
+// the name against the attribute at that position (in declaration order), and
+// only probes the hash table if that comparison fails.  On success,
+// 'position' is updated to refer to the attribute following the one found, so
+// that a decoder reading the elements of a sequence in declaration order never
+// computes a hash.
+//
+///Relationship to Name-Based Lookup
+///---------------------------------
+// An index matches names exactly (i.e., case-sensitively), and knows only the
+// names reported by 'manipulateAttributes'.  Names that a type accepts in its
+// name-based lookup functions but does not report that way (e.g.,
+// the selection names of anonymous choices, or case-insensitive matches) are
+// not found in the index.  Clients must therefore treat a failure to find a
+// name as "unknown to the index" and fall back on the name-based functions of
+// 'bdlat_SequenceFunctions'.  Conversely, a name that *is* found identifies
+// the attribute that reported that name, which is the attribute that the
+// name-based lookup of any conforming type would have returned.
+//
+///Per-Type Caching
+///----------------
+// 'bdlat_AttributeNameIndexCache::lookupIndex' returns the index of the
+// attributes of the (template parameter) 'TYPE' of its argument, building it
+// from that argument on first use.  An index is only provided for types whose
+// category is statically 'e_SEQUENCE_CATEGORY'; dynamic types, whose
+// attributes can vary from one object to another, are never indexed.
+//
+///Thread Safety
+///-------------
+// 'bdlat_AttributeNameIndex' is *const* *thread-safe*: distinct threads may
+// look up names in the same index concurrently.
+// 'bdlat_AttributeNameIndexCache' is *not* thread-safe; it is intended to be
+// owned by a decoder, which is itself not thread-safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Resolving Element Names
+/// - - - - - - - - - - - - - - - - -
+// Suppose we have a 'bdeat'-compatible sequence type, 'mine::MySequence',
+// with three attributes, "name", "age", and "salary", having the ids 1, 2, and
+// 3 respectively (see 'bdlat_sequencefunctions' for such a type).
+//
+// First, we build an index for that type:
+//..
+//  mine::MySequence object;
+//
+//  bdlat_AttributeNameIndex index;
+//  int rc = index.loadAttributes(&object);
+//  assert(0 == rc);
+//  assert(3 == index.numAttributes());
+//..
+// Then, we resolve names read, in declaration order, from some input,
+// tracking the position of the attribute we expect to read next:
+//..
+//  int position = 0;
+//  int id;
+//
+//  rc = index.findAttributeId(&id, &position, "name", 4);
+//  assert(0 == rc);  assert(1 == id);  assert(1 == position);
+//
+//  rc = index.findAttributeId(&id, &position, "age", 3);
+//  assert(0 == rc);  assert(2 == id);  assert(2 == position);
+//..
+// Next, we resolve a name that is out of order; the index is probed, and
+// 'position' is updated to follow the attribute that was found:
+//..
+//  rc = index.findAttributeId(&id, &position, "name", 4);
+//  assert(0 == rc);  assert(1 == id);  assert(1 == position);
+//..
+// Finally, we observe that a name unknown to the index is not found, and that
+// the client must fall back on the name-based lookup of the type:
+//..
+//  rc = index.findAttributeId(&id, &position, "NAME", 4);
+//  assert(0 != rc);
+//  assert(bdlat_SequenceFunctions::hasAttribute(object, "NAME", 4));
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLAT_ATTRIBUTEINFO
+#include <bdlat_attributeinfo.h>
+#endif
+
+#ifndef INCLUDED_BDLAT_SEQUENCEFUNCTIONS
+#include <bdlat_sequencefunctions.h>
+#endif
+
+#ifndef INCLUDED_BDLAT_TYPECATEGORY
+#include <bdlat_typecategory.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_METAINT
+#include <bslmf_metaint.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTRING
+#include <bsl_cstring.h>
+#endif
+
+#ifndef INCLUDED_BSL_MAP
+#include <bsl_map.h>
+#endif
+
+#ifndef INCLUDED_BSL_STRING
+#include <bsl_string.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+
+class bdlat_AttributeNameIndex;
+
+                   // ======================================
+                   // class bdlat_AttributeNameIndex_Loader
+                   // ======================================
+
+class bdlat_AttributeNameIndex_Loader {
+    // This component-private 'bdeat' manipulator adds the name and id of each
+    // attribute it visits to an index, without modifying the attribute.
+
+    // DATA
+    bdlat_AttributeNameIndex *d_index_p;  // index to load (held, not owned)
+
+  public:
+    // CREATORS
+    explicit bdlat_AttributeNameIndex_Loader(bdlat_AttributeNameIndex *index);
+        // Create a loader adding attributes to the specified 'index'.
+
+    // MANIPULATORS
+    template <class VALUE_TYPE>
+    int operator()(VALUE_TYPE *value, const bdlat_AttributeInfo& info);
+        // Add to the index of this loader the attribute described by the
+        // specified 'info', ignoring the specified 'value'.  Return 0 on
+        // success, and a non-zero value otherwise.
+};
+
+                       // ==============================
+                       // class bdlat_AttributeNameIndex
+                       // ==============================
+
+class bdlat_AttributeNameIndex {
+    // This mechanism maps the names of the attributes of a sequence to their
+    // ids.  Names are matched exactly.  Both a hash-table lookup and a
+    // position-hinted lookup (see {Expected Attribute Position}) are provided.
+
+    // PRIVATE TYPES
+    struct Entry {
+        // An attribute known to the index.
+
+        bsl::size_t  d_nameOffset;  // offset of the name in 'd_names'
+        int          d_nameLength;  // length of the name
+        int          d_id;          // id of the attribute
+        unsigned int d_hash;        // hash of the name
+    };
+
+    // DATA
+    bsl::string        d_names;    // names of all attributes, concatenated
+
+    bsl::vector<Entry> d_entries;  // attributes, in the order added
+
+    bsl::vector<int>   d_table;    // open-addressing hash table holding
+                                   // indices in 'd_entries' plus one, or 0
+                                   // for an empty slot; its size is zero or a
+                                   // power of two at least twice
+                                   // 'd_entries.size()'
+
+    // PRIVATE CLASS METHODS
+    static unsigned int hash(const char *name, int nameLength);
+        // Return the hash value of the specified 'name' having the specified
+        // 'nameLength'.
+
+    // PRIVATE ACCESSORS
+    bool isMatch(int index, const char *name, int nameLength) const;
+        // Return 'true' if the entry at the specified 'index' in 'd_entries'
+        // has the specified 'name' of the specified 'nameLength', and 'false'
+        // otherwise.
+
+    int findIndex(const char *name, int nameLength) const;
+        // Return the index in 'd_entries' of the attribute having the
+        // specified 'name' of the specified 'nameLength', or -1 if there is no
+        // such attribute.
+
+    // NOT IMPLEMENTED
+    bdlat_AttributeNameIndex(const bdlat_AttributeNameIndex&);
+    bdlat_AttributeNameIndex& operator=(const bdlat_AttributeNameIndex&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(bdlat_AttributeNameIndex,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit bdlat_AttributeNameIndex(bslma::Allocator *basicAllocator = 0);
+        // Create an empty index.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    //! ~bdlat_AttributeNameIndex() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    int addAttribute(const char *name, int nameLength, int id);
+        // Add to this index the attribute having the specified 'name' of the
+        // specified 'nameLength' and the specified 'id'.  Return 0 on success,
+        // and a non-zero value, with no effect, if this index already has an
+        // attribute named 'name'.  The behavior is undefined unless
+        // '0 <= nameLength'.
+
+    void clear();
+        // Remove all attributes from this index.
+
+    template <class TYPE>
+    int loadAttributes(TYPE *object);
+        // Replace the contents of this index with the name and id of each
+        // attribute of the specified 'object', of the (template parameter)
+        // 'TYPE', in the order they are visited by
+        // 'bdlat_SequenceFunctions::manipulateAttributes'.  Return 0 on
+        // success, and a non-zero value, leaving this index empty, if
+        // 'manipulateAttributes' fails or if two attributes have the same
+        // name.  'TYPE' shall be a 'bdeat' sequence type.  Note that 'object'
+        // is not modified.
+
+    // ACCESSORS
+    int findAttributeId(int *id, const char *name, int nameLength) const;
+        // Load into the specified 'id' the id of the attribute having the
+        // specified 'name' of the specified 'nameLength'.  Return 0 on
+        // success, and a non-zero value, with no effect on 'id', if this
+        // index has no such attribute.
+
+    int findAttributeId(int        *id,
+                        int        *position,
+                        const char *name,
+                        int         nameLength) const;
+        // Load into the specified 'id' the id of the attribute having the
+        // specified 'name' of the specified 'nameLength', first comparing
+        // 'name' with the attribute at the specified 'position' (in the order
+        // the attributes were added), and load into 'position' the position
+        // of the attribute following the one found.  Return 0 on success, and
+        // a non-zero value, with no effect on 'id' or 'position', if this
+        // index has no such attribute.  Note that '*position' need not be a
+        // valid position; see {Expected Attribute Position}.
+
+    int numAttributes() const;
+        // Return the number of attributes in this index.
+};
+
+                    // ===================================
+                    // class bdlat_AttributeNameIndexCache
+                    // ===================================
+
+template <class TYPE>
+struct bdlat_AttributeNameIndexCache_TypeKey {
+    // This component-private 'struct' provides, through the address of its
+    // static data member, a key that is distinct for each (template
+    // parameter) 'TYPE'.
+
+    // CLASS DATA
+    static char s_key;  // never read; only its address is used.  Not 'const'
+                        // so that distinct keys are never merged by the
+                        // linker.
+};
+
+class bdlat_AttributeNameIndexCache {
+    // This mechanism owns one 'bdlat_AttributeNameIndex' per sequence type for
+    // which an index was requested, building each index on first request.
+
+    // PRIVATE TYPES
+    typedef bsl::map<const void *, bdlat_AttributeNameIndex *> IndexMap;
+
+    // DATA
+    IndexMap                  d_indexes;      // indexes, by type key (owned)
+
+    const void               *d_lastKey_p;    // key of the most recently
+                                              // requested index
+
+    bdlat_AttributeNameIndex *d_lastIndex_p;  // most recently requested index
+
+    bslma::Allocator         *d_allocator_p;  // memory allocator (held, not
+                                              // owned)
+
+    // PRIVATE MANIPULATORS
+    bdlat_AttributeNameIndex *findOrInsert(const void *key, bool *isNew);
+        // Return the address of the index having the specified 'key', adding
+        // an empty index for 'key' if there is none, and load into the
+        // specified 'isNew' whether an index was added.
+
+    template <class TYPE>
+    const bdlat_AttributeNameIndex *lookupIndexImp(TYPE *,
+                                                   bslmf::MetaInt<0>);
+    template <class TYPE>
+    const bdlat_AttributeNameIndex *lookupIndexImp(TYPE              *object,
+                                                   bslmf::MetaInt<1>);
+        // Return the address of the index of the attributes of the (template
+        // parameter) 'TYPE', building that index from the specified 'object'
+        // if this cache does not have it, or 0 if the last argument is
+        // 'bslmf::MetaInt<0>', indicating that 'TYPE' is not statically a
+        // 'bdeat' sequence type.
+
+    // NOT IMPLEMENTED
+    bdlat_AttributeNameIndexCache(const bdlat_AttributeNameIndexCache&);
+    bdlat_AttributeNameIndexCache& operator=(
+                                         const bdlat_AttributeNameIndexCache&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(bdlat_AttributeNameIndexCache,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit bdlat_AttributeNameIndexCache(
+                                         bslma::Allocator *basicAllocator = 0);
+        // Create an empty cache.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    ~bdlat_AttributeNameIndexCache();
+        // Destroy this object.
+
+    // MANIPULATORS
+    template <class TYPE>
+    const bdlat_AttributeNameIndex *lookupIndex(TYPE *object);
+        // Return the address of the index of the attributes of the (template
+        // parameter) 'TYPE', building that index from the specified 'object'
+        // if this cache does not have it, or 0 if 'TYPE' is not statically a
+        // 'bdeat' sequence type.  The returned index remains valid for the
+        // lifetime of this cache.  Note that 'object' is not modified, and
+        // that the returned index is empty if it could not be built (see
+        // 'bdlat_AttributeNameIndex::loadAttributes').
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                   // --------------------------------------
+                   // class bdlat_AttributeNameIndex_Loader
+                   // --------------------------------------
+
+// CREATORS
+inline
+bdlat_AttributeNameIndex_Loader::bdlat_AttributeNameIndex_Loader(
+                                              bdlat_AttributeNameIndex *index)
+: d_index_p(index)
+{
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE>
+inline
+int bdlat_AttributeNameIndex_Loader::operator()(
+                                            VALUE_TYPE                 *,
+                                            const bdlat_AttributeInfo&  info)
+{
+    return d_index_p->addAttribute(info.name(), info.nameLength(), info.id());
+}
+
+                       // ------------------------------
+                       // class bdlat_AttributeNameIndex
+                       // ------------------------------
+
+// PRIVATE CLASS METHODS
+inline
+unsigned int bdlat_AttributeNameIndex::hash(const char *name, int nameLength)
+{
+    // FNV-1a
+
+    unsigned int result = 2166136261u;
+    for (int i = 0; i < nameLength; ++i) {
+        result = (result ^ static_cast<unsigned char>(name[i])) * 16777619u;
+    }
+    return result;
+}
+
+// PRIVATE ACCESSORS
+inline
+bool bdlat_AttributeNameIndex::isMatch(int         index,
+                                       const char *name,
+                                       int         nameLength) const
+{
+    const Entry& entry = d_entries[index];
+
+    return entry.d_nameLength == nameLength
+        && 0 == bsl::memcmp(d_names.data() + entry.d_nameOffset,
+                            name,
+                            nameLength);
+}
+
+// CREATORS
+inline
+bdlat_AttributeNameIndex::bdlat_AttributeNameIndex(
+                                              bslma::Allocator *basicAllocator)
+: d_names(basicAllocator)
+, d_entries(basicAllocator)
+, d_table(basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+int bdlat_AttributeNameIndex::loadAttributes(TYPE *object)
+{
+    BSLS_ASSERT_SAFE(object);
+
+    clear();
+
+    bdlat_AttributeNameIndex_Loader loader(this);
+    if (0 != bdlat_SequenceFunctions::manipulateAttributes(object, loader)) {
+        clear();
+        return -1;                                                    // RETURN
+    }
+    return 0;
+}
+
+// ACCESSORS
+inline
+int bdlat_AttributeNameIndex::findAttributeId(int        *id,
+                                              const char *name,
+                                              int         nameLength) const
+{
+    BSLS_ASSERT_SAFE(id);
+
+    const int index = findIndex(name, nameLength);
+    if (index < 0) {
+        return -1;                                                    // RETURN
+    }
+
+    *id = d_entries[index].d_id;
+    return 0;
+}
+
+inline
+int bdlat_AttributeNameIndex::findAttributeId(int        *id,
+                                              int        *position,
+                                              const char *name,
+                                              int         nameLength) const
+{
+    BSLS_ASSERT_SAFE(id);
+    BSLS_ASSERT_SAFE(position);
+
+    int index = *position;
+    if (index < 0
+     || index >= static_cast<int>(d_entries.size())
+     || !isMatch(index, name, nameLength)) {
+        index = findIndex(name, nameLength);
+        if (index < 0) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    *id       = d_entries[index].d_id;
+    *position = index + 1;
+    return 0;
+}
+
+inline
+int bdlat_AttributeNameIndex::numAttributes() const
+{
+    return static_cast<int>(d_entries.size());
+}
+
+                    // -----------------------------------
+                    // class bdlat_AttributeNameIndexCache
+                    // -----------------------------------
+
+// CLASS DATA
+template <class TYPE>
+char bdlat_AttributeNameIndexCache_TypeKey<TYPE>::s_key = 0;
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+inline
+const bdlat_AttributeNameIndex *
+bdlat_AttributeNameIndexCache::lookupIndexImp(TYPE *, bslmf::MetaInt<0>)
+{
+    return 0;
+}
+
+template <class TYPE>
+const bdlat_AttributeNameIndex *
+bdlat_AttributeNameIndexCache::lookupIndexImp(TYPE              *object,
+                                              bslmf::MetaInt<1>)
+{
+    const void *key = &bdlat_AttributeNameIndexCache_TypeKey<TYPE>::s_key;
+
+    if (key == d_lastKey_p) {
+        return d_lastIndex_p;                                         // RETURN
+    }
+
+    bool                      isNew;
+    bdlat_AttributeNameIndex *index = findOrInsert(key, &isNew);
+    if (isNew) {
+        index->loadAttributes(object);
+    }
+
+    d_lastKey_p   = key;
+    d_lastIndex_p = index;
+
+    return index;
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+const bdlat_AttributeNameIndex *
+bdlat_AttributeNameIndexCache::lookupIndex(TYPE *object)
+{
+    BSLS_ASSERT_SAFE(object);
+
+    typedef bdlat_TypeCategory::Select<TYPE> Selection;
+
+    enum {
+        k_IS_SEQUENCE =
+                    static_cast<int>(bdlat_TypeCategory::e_SEQUENCE_CATEGORY)
+                 == static_cast<int>(Selection::e_SELECTION)
+    };
+
+    return lookupIndexImp(object, bslmf::MetaInt<k_IS_SEQUENCE>());
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,771 @@
+// bdlat_attributenameindex.t.cpp                                     -*-C++-*-
+#include <bdlat_attributenameindex.h>
+
+#include <bdlat_attributeinfo.h>
+#include <bdlat_formattingmode.h>
+#include <bdlat_sequencefunctions.h>
+
+#include <bdlb_string.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a hash index from attribute names to
+// attribute ids, and a cache of such indexes keyed by type.  The index is
+// tested by adding attributes directly, and by loading the attributes of test
+// sequence types defined in this driver; results are compared against the
+// names and ids of those types.  The cache is tested for the identity and
+// content of the indexes it returns, and for its use of memory.
+// ----------------------------------------------------------------------------
+// bdlat_AttributeNameIndex
+// [ 2] bdlat_AttributeNameIndex(bslma::Allocator *bA = 0);
+// [ 2] int addAttribute(const char *name, int nameLength, int id);
+// [ 2] void clear();
+// [ 4] int loadAttributes(const TYPE& object);
+// [ 2] int findAttributeId(int *id, const char *name, int nameLength);
+// [ 3] int findAttributeId(int *id, int *pos, const char *n, int l);
+// [ 2] int numAttributes() const;
+//
+// bdlat_AttributeNameIndexCache
+// [ 5] bdlat_AttributeNameIndexCache(bslma::Allocator *bA = 0);
+// [ 5] ~bdlat_AttributeNameIndexCache();
+// [ 5] const bdlat_AttributeNameIndex *lookupIndex(const TYPE& object);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlat_AttributeNameIndex      Obj;
+typedef bdlat_AttributeNameIndexCache Cache;
+
+static const char *const NAMES[] = {
+    "name", "age", "salary", "street", "city", "state", "zipcode", "country",
+    "phone", "email", "title", "department", "manager", "startDate",
+    "endDate", "status", "level", "grade", "location", "building", "floor",
+    "room", "desk", "extension", "fax", "mobile", "pager", "assistant",
+    "division", "region", "costCenter", "badge", "shift", "team", "project",
+    "skill", "language", "nickname", "suffix", "prefix"
+};
+const int NUM_NAMES = sizeof NAMES / sizeof *NAMES;
+
+namespace BloombergLP {
+namespace test {
+
+template <int NUM_ATTRIBUTES, bool HAS_DUPLICATE = false>
+struct Sequence {
+    // This 'bdeat' sequence type has the specified 'NUM_ATTRIBUTES' 'int'
+    // attributes, the attribute at index 'i' being named 'NAMES[i]' and having
+    // the id 'i + 1'.  If 'HAS_DUPLICATE' is 'true', the last attribute is
+    // instead named 'NAMES[0]'.  As in the 'bdlat_sequencefunctions' usage
+    // example, name-based lookup is case-insensitive.
+
+    // DATA
+    int d_values[NUM_ATTRIBUTES];
+};
+
+template <int NUM_ATTRIBUTES, bool HAS_DUPLICATE>
+const char *attributeName(const Sequence<NUM_ATTRIBUTES, HAS_DUPLICATE>&,
+                          int                                           index)
+    // Return the name of the attribute at the specified 'index' of a
+    // 'Sequence'.
+{
+    return HAS_DUPLICATE && NUM_ATTRIBUTES - 1 == index ? NAMES[0]
+                                                        : NAMES[index];
+}
+
+template <int NUM_ATTRIBUTES, bool HAS_DUPLICATE, class MANIPULATOR>
+int bdlat_sequenceManipulateAttributes(
+                  Sequence<NUM_ATTRIBUTES, HAS_DUPLICATE> *object,
+                  MANIPULATOR&                             manipulator)
+    // Invoke the specified 'manipulator' on each attribute of the specified
+    // 'object', in order, and return the first non-zero value it returns, or
+    // 0 if there is none.
+{
+    for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+        bdlat_AttributeInfo info;
+
+        info.annotation()     = "";
+        info.formattingMode() = bdlat_FormattingMode::e_DEFAULT;
+        info.id()             = i + 1;
+        info.name()           = attributeName(*object, i);
+        info.nameLength()     = static_cast<int>(bsl::strlen(info.name()));
+
+        const int rc = manipulator(&object->d_values[i], info);
+        if (rc) {
+            return rc;                                                // RETURN
+        }
+    }
+    return 0;
+}
+
+template <int NUM_ATTRIBUTES, bool HAS_DUPLICATE>
+bool bdlat_sequenceHasAttribute(
+                   const Sequence<NUM_ATTRIBUTES, HAS_DUPLICATE>&  object,
+                   const char                                     *name,
+                   int                                             nameLength)
+    // Return 'true' if the specified 'object' has an attribute whose name
+    // matches, ignoring case, the specified 'name' of the specified
+    // 'nameLength', and 'false' otherwise.
+{
+    for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+        if (bdlb::String::areEqualCaseless(attributeName(object, i),
+                                           name,
+                                           nameLength)) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+struct FailingSequence {
+    // This 'bdeat' sequence type fails to manipulate its attributes.
+};
+
+template <class MANIPULATOR>
+int bdlat_sequenceManipulateAttributes(FailingSequence *, MANIPULATOR&)
+    // Return a non-zero value.
+{
+    return -7;
+}
+
+}  // close namespace test
+
+namespace bdlat_SequenceFunctions {
+
+template <int NUM_ATTRIBUTES, bool HAS_DUPLICATE>
+struct IsSequence<test::Sequence<NUM_ATTRIBUTES, HAS_DUPLICATE> > {
+    enum { VALUE = 1 };
+};
+
+template <>
+struct IsSequence<test::FailingSequence> {
+    enum { VALUE = 1 };
+};
+
+}  // close namespace bdlat_SequenceFunctions
+}  // close enterprise namespace
+
+namespace mine {
+
+typedef test::Sequence<3> MySequence;
+    // A sequence having the attributes "name", "age", and "salary", with ids
+    // 1, 2, and 3, as 'mine::MySequence' in the 'bdlat_sequencefunctions'
+    // usage example.
+
+}  // close namespace mine
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+    bool veryVerbose         = argc > 3;
+    bool veryVeryVerbose     = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Resolving Element Names
+/// - - - - - - - - - - - - - - - - -
+// Suppose we have a 'bdeat'-compatible sequence type, 'mine::MySequence',
+// with three attributes, "name", "age", and "salary", having the ids 1, 2, and
+// 3 respectively (see 'bdlat_sequencefunctions' for such a type).
+//
+// First, we build an index for that type:
+//..
+    mine::MySequence object;
+
+    bdlat_AttributeNameIndex index;
+    int rc = index.loadAttributes(&object);
+    ASSERT(0 == rc);
+    ASSERT(3 == index.numAttributes());
+//..
+// Then, we resolve names read, in declaration order, from some input,
+// tracking the position of the attribute we expect to read next:
+//..
+    int position = 0;
+    int id;
+
+    rc = index.findAttributeId(&id, &position, "name", 4);
+    ASSERT(0 == rc);  ASSERT(1 == id);  ASSERT(1 == position);
+
+    rc = index.findAttributeId(&id, &position, "age", 3);
+    ASSERT(0 == rc);  ASSERT(2 == id);  ASSERT(2 == position);
+//..
+// Next, we resolve a name that is out of order; the index is probed, and
+// 'position' is updated to follow the attribute that was found:
+//..
+    rc = index.findAttributeId(&id, &position, "name", 4);
+    ASSERT(0 == rc);  ASSERT(1 == id);  ASSERT(1 == position);
+//..
+// Finally, we observe that a name unknown to the index is not found, and that
+// the client must fall back on the name-based lookup of the type:
+//..
+    rc = index.findAttributeId(&id, &position, "NAME", 4);
+    ASSERT(0 != rc);
+    ASSERT(bdlat_SequenceFunctions::hasAttribute(object, "NAME", 4));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'bdlat_AttributeNameIndexCache'
+        //
+        // Concerns:
+        //: 1 'lookupIndex' returns an index of the attributes of the type of
+        //:   its argument.
+        //:
+        //: 2 'lookupIndex' returns the same index for every object of a type,
+        //:   and distinct indexes for distinct types, whatever the order of
+        //:   the requests.
+        //:
+        //: 3 An index is built only once per type.
+        //:
+        //: 4 'lookupIndex' returns 0 for types that are not statically
+        //:   sequences.
+        //:
+        //: 5 A type whose attributes cannot be indexed is given an empty
+        //:   index.
+        //:
+        //: 6 All memory is supplied by the allocator of the cache, and is
+        //:   released on destruction.
+        //
+        // Plan:
+        //: 1 Request indexes for several sequence types, in an interleaved
+        //:   order, and verify their identity and content.  (C-1..2)
+        //:
+        //: 2 Verify that requesting an index that was already built does not
+        //:   allocate memory.  (C-3)
+        //:
+        //: 3 Request indexes for an 'int' and verify that 0 is returned.
+        //:   (C-4)
+        //:
+        //: 4 Request indexes for a sequence having duplicate names and for a
+        //:   sequence whose attributes cannot be accessed, and verify that
+        //:   they are empty.  (C-5)
+        //:
+        //: 5 Use test allocators to verify memory use.  (C-6)
+        //
+        // Testing:
+        //   bdlat_AttributeNameIndexCache(bslma::Allocator *bA = 0);
+        //   ~bdlat_AttributeNameIndexCache();
+        //   const bdlat_AttributeNameIndex *lookupIndex(const TYPE& object);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'bdlat_AttributeNameIndexCache'" << endl
+                          << "=======================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Cache mX(&oa);
+
+            test::Sequence<3>        s3;
+            test::Sequence<40>       s40;
+            test::Sequence<5, true>  sDup;
+            test::FailingSequence    sFail;
+
+            const Obj *I3 = mX.lookupIndex(&s3);
+            ASSERT(0 != I3);
+            ASSERTV(I3->numAttributes(), 3 == I3->numAttributes());
+
+            const Obj *I40 = mX.lookupIndex(&s40);
+            ASSERT(0 != I40);
+            ASSERT(I3 != I40);
+            ASSERTV(I40->numAttributes(), 40 == I40->numAttributes());
+
+            for (int i = 0; i < 40; ++i) {
+                int id = -1;
+                ASSERTV(i, 0 == I40->findAttributeId(
+                                          &id,
+                                          NAMES[i],
+                                          static_cast<int>(strlen(NAMES[i]))));
+                ASSERTV(i, id, i + 1 == id);
+            }
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            test::Sequence<3>  other3;
+            test::Sequence<40> other40;
+
+            ASSERT(I3  == mX.lookupIndex(&other3));
+            ASSERT(I40 == mX.lookupIndex(&other40));
+            ASSERT(I3  == mX.lookupIndex(&s3));
+            ASSERT(I3  == mX.lookupIndex(&s3));
+            ASSERT(I40 == mX.lookupIndex(&s40));
+
+            ASSERT(NUM_ALLOCATIONS == oa.numAllocations());
+
+            int         i = 5;
+            bsl::string str("name");
+
+            ASSERT(0 == mX.lookupIndex(&i));
+            ASSERT(0 == mX.lookupIndex(&str));
+
+            const Obj *IDUP = mX.lookupIndex(&sDup);
+            ASSERT(0 != IDUP);
+            ASSERTV(IDUP->numAttributes(), 0 == IDUP->numAttributes());
+
+            const Obj *IFAIL = mX.lookupIndex(&sFail);
+            ASSERT(0 != IFAIL);
+            ASSERTV(IFAIL->numAttributes(), 0 == IFAIL->numAttributes());
+
+            ASSERT(I3 == mX.lookupIndex(&s3));
+            ASSERTV(I3->numAttributes(), 3 == I3->numAttributes());
+
+            ASSERT(0 <  oa.numBlocksInUse());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'loadAttributes'
+        //
+        // Concerns:
+        //: 1 'loadAttributes' adds every attribute of the object, in the order
+        //:   visited by 'manipulateAttributes', with its name and id.
+        //:
+        //: 2 'loadAttributes' replaces the previous contents of the index.
+        //:
+        //: 3 'loadAttributes' fails, leaving the index empty, if two
+        //:   attributes have the same name, or if 'manipulateAttributes'
+        //:   fails.
+        //
+        // Plan:
+        //: 1 Load the attributes of test sequences of various sizes, and
+        //:   verify the ids and positions of all names.  (C-1..2)
+        //:
+        //: 2 Load the attributes of a sequence with a duplicate name, and of
+        //:   a sequence whose 'manipulateAttributes' fails.  (C-3)
+        //
+        // Testing:
+        //   int loadAttributes(const TYPE& object);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'loadAttributes'" << endl
+                          << "========================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(0 == mX.addAttribute("unrelated", 9, 99));
+
+        test::Sequence<1> s1;
+        ASSERT(0 == mX.loadAttributes(&s1));
+        ASSERTV(X.numAttributes(), 1 == X.numAttributes());
+
+        int id;
+        ASSERT(0 != X.findAttributeId(&id, "unrelated", 9));
+
+        test::Sequence<40> s40;
+        ASSERT(0 == mX.loadAttributes(&s40));
+        ASSERTV(X.numAttributes(), 40 == X.numAttributes());
+
+        int position = 0;
+        for (int i = 0; i < 40; ++i) {
+            const int LENGTH = static_cast<int>(strlen(NAMES[i]));
+
+            id = -1;
+            ASSERTV(i, 0 == X.findAttributeId(&id, &position, NAMES[i],
+                                                              LENGTH));
+            ASSERTV(i, id,       i + 1 == id);
+            ASSERTV(i, position, i + 1 == position);
+        }
+
+        test::Sequence<5, true> sDup;
+        ASSERT(0 != mX.loadAttributes(&sDup));
+        ASSERTV(X.numAttributes(), 0 == X.numAttributes());
+        ASSERT(0 != X.findAttributeId(&id, "name", 4));
+
+        ASSERT(0 == mX.loadAttributes(&s1));
+        test::FailingSequence sFail;
+        ASSERT(0 != mX.loadAttributes(&sFail));
+        ASSERTV(X.numAttributes(), 0 == X.numAttributes());
+        ASSERT(0 != X.findAttributeId(&id, "name", 4));
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING POSITION-HINTED 'findAttributeId'
+        //
+        // Concerns:
+        //: 1 A name matching the attribute at the hinted position is found,
+        //:   and the position is advanced by one.
+        //:
+        //: 2 A name not matching the attribute at the hinted position, or a
+        //:   hint that is not a valid position, falls back on the hash table,
+        //:   and the position is set to follow the attribute found.
+        //:
+        //: 3 A name that is not found leaves 'id' and 'position' unchanged.
+        //
+        // Plan:
+        //: 1 Using an index of 'NUM_NAMES' attributes, look up every name
+        //:   with every hint in the range '[-2 .. NUM_NAMES + 2]', and verify
+        //:   the results.  (C-1..2)
+        //:
+        //: 2 Look up unknown names, and verify that the outputs are
+        //:   unchanged.  (C-3)
+        //
+        // Testing:
+        //   int findAttributeId(int *id, int *pos, const char *n, int l);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "TESTING POSITION-HINTED 'findAttributeId'" << endl
+                      << "=========================================" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        for (int i = 0; i < NUM_NAMES; ++i) {
+            ASSERTV(i, 0 == mX.addAttribute(
+                                          NAMES[i],
+                                          static_cast<int>(strlen(NAMES[i])),
+                                          1000 + i));
+        }
+
+        for (int i = 0; i < NUM_NAMES; ++i) {
+            const int LENGTH = static_cast<int>(strlen(NAMES[i]));
+
+            for (int hint = -2; hint <= NUM_NAMES + 2; ++hint) {
+                int id       = -1;
+                int position = hint;
+
+                ASSERTV(i, hint,
+                        0 == X.findAttributeId(&id,
+                                               &position,
+                                               NAMES[i],
+                                               LENGTH));
+                ASSERTV(i, hint, id,       1000 + i == id);
+                ASSERTV(i, hint, position, i + 1    == position);
+            }
+        }
+
+        static const char *const UNKNOWN[] = {
+            "", "Name", "nam", "names", "name ", "prefix2", "unknown"
+        };
+        const int NUM_UNKNOWN = sizeof UNKNOWN / sizeof *UNKNOWN;
+
+        for (int i = 0; i < NUM_UNKNOWN; ++i) {
+            const int LENGTH = static_cast<int>(strlen(UNKNOWN[i]));
+
+            for (int hint = -1; hint <= NUM_NAMES; ++hint) {
+                int id       = -1;
+                int position = hint;
+
+                ASSERTV(i, hint, 0 != X.findAttributeId(&id,
+                                                        &position,
+                                                        UNKNOWN[i],
+                                                        LENGTH));
+                ASSERTV(i, hint, id,       -1   == id);
+                ASSERTV(i, hint, position, hint == position);
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed index is empty.
+        //:
+        //: 2 'addAttribute' adds attributes that can then be found by name,
+        //:   for any number of attributes (i.e., across growths of the hash
+        //:   table).
+        //:
+        //: 3 Names are compared exactly, including their length; names that
+        //:   are prefixes of one another are distinct, and the empty name is
+        //:   a valid name.
+        //:
+        //: 4 'addAttribute' fails, with no effect, for a duplicate name.
+        //:
+        //: 5 'clear' removes all attributes.
+        //:
+        //: 6 The names are copied: the index does not refer to the storage
+        //:   supplied to 'addAttribute'.
+        //:
+        //: 7 All memory is supplied by the object allocator.
+        //
+        // Plan:
+        //: 1 Add the names of 'NAMES' one at a time, and after each addition
+        //:   verify that all names added are found with their ids, and that
+        //:   the names not yet added are not found.  (C-1..2)
+        //:
+        //: 2 Add names that are prefixes of one another, and the empty name,
+        //:   from a modifiable buffer that is overwritten after each addition.
+        //:   (C-3, 6)
+        //:
+        //: 3 Add duplicate names, and verify failure.  (C-4)
+        //:
+        //: 4 Call 'clear' and verify that no name is found.  (C-5)
+        //:
+        //: 5 Use test allocators to verify memory use.  (C-7)
+        //
+        // Testing:
+        //   bdlat_AttributeNameIndex(bslma::Allocator *bA = 0);
+        //   int addAttribute(const char *name, int nameLength, int id);
+        //   void clear();
+        //   int findAttributeId(int *id, const char *name, int nameLength);
+        //   int numAttributes() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                    << endl
+                    << "TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS\n"
+                    << "================================================\n";
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(0 == X.numAttributes());
+            ASSERT(0 == oa.numBlocksTotal());
+
+            int id = -1;
+            ASSERT(0 != X.findAttributeId(&id, "name", 4));
+            ASSERT(-1 == id);
+
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                ASSERTV(i, 0 == mX.addAttribute(
+                                          NAMES[i],
+                                          static_cast<int>(strlen(NAMES[i])),
+                                          -i));
+                ASSERTV(i, X.numAttributes(), i + 1 == X.numAttributes());
+
+                for (int j = 0; j < NUM_NAMES; ++j) {
+                    const int LENGTH = static_cast<int>(strlen(NAMES[j]));
+
+                    id = 1;
+                    const int RC = X.findAttributeId(&id, NAMES[j], LENGTH);
+                    if (j <= i) {
+                        ASSERTV(i, j, RC, 0 == RC);
+                        ASSERTV(i, j, id, -j == id);
+                    }
+                    else {
+                        ASSERTV(i, j, RC, 0 != RC);
+                        ASSERTV(i, j, id, 1 == id);
+                    }
+                }
+            }
+
+            ASSERT(0 <  oa.numBlocksInUse());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+            if (verbose) cout << "\nTesting duplicate names." << endl;
+
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                ASSERTV(i, 0 != mX.addAttribute(
+                                          NAMES[i],
+                                          static_cast<int>(strlen(NAMES[i])),
+                                          5000));
+            }
+            ASSERTV(X.numAttributes(), NUM_NAMES == X.numAttributes());
+            ASSERT(0 == X.findAttributeId(&id, "name", 4));
+            ASSERTV(id, 0 == id);
+
+            if (verbose) cout << "\nTesting 'clear'." << endl;
+
+            mX.clear();
+            ASSERT(0 == X.numAttributes());
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                ASSERTV(i, 0 != X.findAttributeId(
+                                         &id,
+                                         NAMES[i],
+                                         static_cast<int>(strlen(NAMES[i]))));
+            }
+
+            if (verbose) cout << "\nTesting prefixes and copies." << endl;
+
+            char buffer[] = "abcdef";
+
+            for (int length = 6; length >= 0; --length) {
+                ASSERTV(length, 0 == mX.addAttribute(buffer, length, length));
+                bsl::memset(buffer, 'X', sizeof buffer - 1);
+                bsl::strcpy(buffer, "abcdef");
+            }
+            bsl::memset(buffer, 'X', sizeof buffer - 1);
+
+            ASSERTV(X.numAttributes(), 7 == X.numAttributes());
+            for (int length = 0; length <= 6; ++length) {
+                ASSERTV(length, 0 == X.findAttributeId(&id, "abcdef", length));
+                ASSERTV(length, id, length == id);
+            }
+            ASSERT(0 != X.findAttributeId(&id, "abcdeg", 6));
+            ASSERT(0 != X.findAttributeId(&id, "abcdefg", 7));
+
+            ASSERT(0 == mX.findAttributeId(&id, 0, 0));
+            ASSERTV(id, 0 == id);
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Add a few attributes to an index, find them by name with and
+        //:   without position hints, and look up an index in a cache.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT(0 == mX.addAttribute("first", 5, 10));
+        ASSERT(0 == mX.addAttribute("second", 6, 20));
+        ASSERT(2 == X.numAttributes());
+
+        int id;
+        ASSERT(0 == X.findAttributeId(&id, "second", 6));
+        ASSERT(20 == id);
+
+        int position = 0;
+        ASSERT(0 == X.findAttributeId(&id, &position, "first", 5));
+        ASSERT(10 == id);
+        ASSERT(1 == position);
+
+        ASSERT(0 != X.findAttributeId(&id, &position, "third", 5));
+
+        Cache cache;
+        test::Sequence<2> s2;
+
+        const Obj *index = cache.lookupIndex(&s2);
+        ASSERT(index);
+        ASSERT(0 == index->findAttributeId(&id, "age", 3));
+        ASSERT(2 == id);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -248,7 +248,10 @@ class FixedQueue {
     enum {
         k_TYPE_PADDING = bslmt::Platform::e_CACHE_LINE_SIZE - sizeof(TYPE *),
         k_SEMA_PADDING = bslmt::Platform::e_CACHE_LINE_SIZE -
-                                                       sizeof(bslmt::Semaphore)
+                                                      sizeof(bslmt::Semaphore),
+        k_MAX_BATCH_SIZE = 32  // maximum number of cells reserved at once by
+                               // the methods pushing or popping arrays of
+                               // elements
     };
 
     // DATA
@@ -284,6 +287,10 @@ class FixedQueue {
     const char        d_pushControlSemaPad[k_SEMA_PADDING];
                                            // padding to prevent false sharing
 
+    bsls::AtomicInt   d_spinCount;         // number of times a thread
+                                           // polls the queue before blocking
+                                           // in 'pushBack' or 'popFront'
+
     bslma::Allocator *d_allocator_p;       // allocator, held not owned
 
   private:
@@ -291,9 +298,29 @@ class FixedQueue {
     FixedQueue(const FixedQueue&);
     FixedQueue& operator=(const FixedQueue&);
 
+    // PRIVATE MANIPULATORS
+    int pushBackImp(const TYPE& value);
+        // Attempt to append the specified 'value' to the back of this queue
+        // without blocking, and without waking a waiting popper.  Return 0 on
+        // success, a positive value if the queue is full, and a negative
+        // value if the queue is disabled.
+
+    void waitUntilNotEmpty();
+        // Poll this queue up to 'spinCount()' times, and then, if it is still
+        // empty, block until an element is pushed.  Note that this method may
+        // return while the queue is empty.
+
+    void waitUntilNotFullOrDisabled();
+        // Poll this queue up to 'spinCount()' times, and then, if it is still
+        // full and enabled, block until an element is popped or the queue is
+        // disabled.  Note that this method may return while the queue is full
+        // and enabled.
+
     // FRIENDS
     template <class VAL> friend class FixedQueue_PushProctor;
+    template <class VAL> friend class FixedQueue_PushRangeProctor;
     template <class VAL> friend class FixedQueue_PopGuard;
+    template <class VAL> friend class FixedQueue_PopRangeGuard;
 
   public:
     // TRAITS
@@ -316,11 +343,27 @@ class FixedQueue {
         // disabled.  Return 0 on success, and a nonzero value if the queue is
         // disabled.
 
+    int pushBack(const TYPE *values, bsl::size_t numValues);
+        // Append, in order, the specified 'numValues' elements of the array
+        // at the specified 'values' to the back of this queue, blocking until
+        // space is available for all of them - if necessary - or the queue is
+        // disabled.  Return 0 on success, and a non-zero value if the queue is
+        // disabled, in which case only the first elements of 'values' may
+        // have been appended.  Note that the elements appended by concurrent
+        // calls to this method may be interleaved.
+
     int tryPushBack(const TYPE& value);
         // Attempt to append the specified 'value' to the back of this queue
         // without blocking.  Return 0 on success, and a non-zero value if the
         // queue is full or disabled.
 
+    bsl::size_t tryPushBack(const TYPE *values, bsl::size_t numValues);
+        // Append, in order and without blocking, as many of the specified
+        // 'numValues' elements of the array at the specified 'values' as
+        // there is space for to the back of this queue, and return the number
+        // of elements appended (0 if the queue is full or disabled).  Waiting
+        // poppers are woken once for the whole batch.
+
     void popFront(TYPE* value);
         // Remove the element from the front of this queue and load that
         // element into the specified 'value'.  If the queue is empty, block
@@ -330,12 +373,26 @@ class FixedQueue {
         // Remove the element from the front of this queue and return it's
         // value.  If the queue is empty, block until it is not empty.
 
+    bsl::size_t popFront(TYPE *values, bsl::size_t maxNumValues);
+        // Remove up to the specified 'maxNumValues' elements from the front
+        // of this queue, load them in order into the array at the specified
+        // 'values', and return the number of elements removed.  If the queue
+        // is empty, block until it is not empty.  The behavior is undefined
+        // unless '1 <= maxNumValues'.
+
     int tryPopFront(TYPE *value);
         // Attempt to remove the element from the front of this queue without
         // blocking, and, if successful, load the specified 'value' with the
         // removed element.  Return 0 on success, and a non-zero value if queue
         // was empty.  On failure, 'value' is not changed.
 
+    bsl::size_t tryPopFront(TYPE *values, bsl::size_t maxNumValues);
+        // Remove, without blocking, up to the specified 'maxNumValues'
+        // elements from the front of this queue, load them in order into the
+        // array at the specified 'values', and return the number of elements
+        // removed (0 if the queue was empty).  Waiting pushers are woken once
+        // for the whole batch.
+
     void removeAll();
         // Remove all items from this queue.  Note that this operation is not
         // atomic; if other threads are concurrently pushing items into the
@@ -352,6 +409,14 @@ class FixedQueue {
         // Enable queuing.  If the queue is not disabled, this call has no
         // effect.
 
+    void setSpinCount(int spinCount);
+        // Set to the specified 'spinCount' the number of times that a thread
+        // calling 'pushBack' on a full queue (or 'popFront' on an empty queue)
+        // polls the state of the queue before blocking.  Spinning reduces the
+        // latency of a thread waiting for a short time, at the expense of
+        // processor time.  The behavior is undefined unless '0 <= spinCount'.
+        // Note that the spin count is 0 (no spinning) at construction.
+
     // ACCESSORS
     int capacity() const;
         // Return the maximum number of elements that may be stored in this
@@ -372,6 +437,10 @@ class FixedQueue {
     int numElements() const;
         // Returns the number of elements currently in this queue.
 
+    int spinCount() const;
+        // Return the number of times that a thread polls the state of this
+        // queue before blocking in 'pushBack' or 'popFront'.
+
     int length() const;
         // [!DEPRECATED!] Invoke 'numElements'.
 
@@ -402,6 +471,10 @@ class FixedQueue_PopGuard {
     unsigned int                  d_index;
                                      // index of cell being popped
 
+    bool                          d_notifyPusher;
+                                     // 'true' if a waiting pusher is woken
+                                     // upon destruction
+
   private:
     // NOT IMPLEMENTED
     FixedQueue_PopGuard(const FixedQueue_PopGuard&);
@@ -411,14 +484,16 @@ class FixedQueue_PopGuard {
     // CREATORS
     FixedQueue_PopGuard(FixedQueue<VALUE> *queue,
                         unsigned int       generation,
-                        unsigned int       index);
+                        unsigned int       index,
+                        bool               notifyPusher = true);
         // Create a guard that, upon its destruction, will update the state of
         // the specified 'queue' to remove (pop) the element at the specified
         // 'index' having the specified 'generation', and destroy that popped
-        // object.  The behavior is undefined unless 'index' and 'generation'
-        // refer to a valid element in 'queue' that the current thread has
-        // acquired a reservation to pop (using
-        // 'FixedQueueIndexManager::reservePopIndex').
+        // object.  Optionally specify 'notifyPusher': if 'false', a pusher
+        // waiting for space is not woken upon destruction.  The behavior is
+        // undefined unless 'index' and 'generation' refer to a valid element
+        // in 'queue' that the current thread has acquired a reservation to pop
+        // (using 'FixedQueueIndexManager::reservePopIndex').
 
     ~FixedQueue_PopGuard();
         // Update the state of the 'FixedQueue' object supplied at construction
@@ -426,6 +501,53 @@ class FixedQueue_PopGuard {
         // object.
 };
 
+                       // ==============================
+                       // class FixedQueue_PopRangeGuard
+                       // ==============================
+
+template <class VALUE>
+class FixedQueue_PopRangeGuard {
+    // This class provides a guard that, upon its destruction, will remove
+    // (pop) the indicated elements from the 'FixedQueue' object supplied at
+    // construction, without waking the waiting pushers.  Note that this guard
+    // is used to provide exception safety when popping an array of elements
+    // from a 'FixedQueue' object.
+
+    // DATA
+    FixedQueue<VALUE>  *d_parent_p;     // object from which the elements will
+                                        // be popped
+
+    const unsigned int *d_generations;  // generation counts of the cells
+                                        // being popped
+
+    const unsigned int *d_indices;      // indices of the cells being popped
+
+    bsl::size_t         d_numIndices;   // number of cells being popped
+
+  private:
+    // NOT IMPLEMENTED
+    FixedQueue_PopRangeGuard(const FixedQueue_PopRangeGuard&);
+    FixedQueue_PopRangeGuard& operator=(const FixedQueue_PopRangeGuard&);
+
+  public:
+    // CREATORS
+    FixedQueue_PopRangeGuard(FixedQueue<VALUE>  *queue,
+                             const unsigned int *generations,
+                             const unsigned int *indices,
+                             bsl::size_t         numIndices);
+        // Create a guard that, upon its destruction, will update the state of
+        // the specified 'queue' to remove (pop) the elements at the specified
+        // 'numIndices' 'indices' having the specified 'generations', and
+        // destroy those popped objects.  The behavior is undefined unless the
+        // current thread has acquired a reservation to pop each of those
+        // elements (using 'FixedQueueIndexManager::reservePopIndices').
+
+    ~FixedQueue_PopRangeGuard();
+        // Update the state of the 'FixedQueue' object supplied at construction
+        // to remove (pop) the indicated elements, and destroy the popped
+        // objects.
+};
+
                         // ============================
                         // class FixedQueue_PushProctor
                         // ============================
@@ -480,6 +602,64 @@ class FixedQueue_PushProctor {
 
 };
 
+                      // =================================
+                      // class FixedQueue_PushRangeProctor
+                      // =================================
+
+template <class VALUE>
+class FixedQueue_PushRangeProctor {
+    // This class provides a proctor that manages the cells of a 'FixedQueue'
+    // object reserved for pushing an array of elements, and that, upon its
+    // destruction, disposes of each cell still under management as a
+    // 'FixedQueue_PushProctor' does (putting the queue into a valid empty
+    // state).  Note that this proctor is used to provide exception safety
+    // when pushing an array of elements into a 'FixedQueue'.
+
+    // DATA
+    FixedQueue<VALUE>  *d_parent_p;     // object in which the elements are
+                                        // pushed
+
+    const unsigned int *d_generations;  // generation counts of the cells
+                                        // being pushed
+
+    const unsigned int *d_indices;      // indices of the cells being pushed
+
+    bsl::size_t         d_begin;        // position of the first cell under
+                                        // management
+
+    bsl::size_t         d_end;          // position one past the last cell
+                                        // under management
+
+  private:
+    // NOT IMPLEMENTED
+    FixedQueue_PushRangeProctor(const FixedQueue_PushRangeProctor&);
+    FixedQueue_PushRangeProctor& operator=(
+                                           const FixedQueue_PushRangeProctor&);
+
+  public:
+    // CREATORS
+    FixedQueue_PushRangeProctor(FixedQueue<VALUE>  *queue,
+                                const unsigned int *generations,
+                                const unsigned int *indices,
+                                bsl::size_t         numIndices);
+        // Create a proctor that manages the cells of the specified 'queue' at
+        // the specified 'numIndices' 'indices' having the specified
+        // 'generations'.  The behavior is undefined unless the current thread
+        // has acquired a reservation to push into each of those cells (using
+        // 'FixedQueueIndexManager::reservePushIndices').
+
+    ~FixedQueue_PushRangeProctor();
+        // Destroy this proctor and, if any cell is still under management,
+        // remove and destroy all the elements from the 'FixedQueue' object
+        // supplied at construction, and release the reservations of the cells
+        // under management.
+
+    // MANIPULATORS
+    void releaseFirst();
+        // Release from management the first cell under management.  The
+        // behavior is undefined unless a cell is under management.
+};
+
 // ============================================================================
 //                            INLINE DEFINITIONS
 // ============================================================================
@@ -502,6 +682,7 @@ FixedQueue<TYPE>::FixedQueue(bsl::size_t       capacity,
 , d_numWaitingPushers(0)
 , d_pushControlSema(0)
 , d_pushControlSemaPad()
+, d_spinCount(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     d_elements = static_cast<TYPE *>(
@@ -515,20 +696,13 @@ FixedQueue<TYPE>::~FixedQueue()
     d_allocator_p->deallocate(d_elements);
 }
 
+// PRIVATE MANIPULATORS
 template <class TYPE>
-int FixedQueue<TYPE>::tryPushBack(const TYPE& value)
+int FixedQueue<TYPE>::pushBackImp(const TYPE& value)
 {
     unsigned int generation;
     unsigned int index;
 
-    // SYNCHRONIZATION POINT 1
-    //
-    // The following call to 'reservePushIndex' writes
-    // 'FixedQueueIndexManaged::d_pushIndex' with full sequential consistency,
-    // which guarantees the subsequent (relaxed) read from
-    // 'd_numWaitingPoppers' sees any waiting pointers from SYNCHRONIZATION
-    // POINT 1-Prime.
-
     int retval = d_impl.reservePushIndex(&generation, &index);
 
     if (0 != retval) {
@@ -548,6 +722,78 @@ int FixedQueue<TYPE>::tryPushBack(const TYPE& value)
     guard.release();
     d_impl.commitPushIndex(generation, index);
 
+    return 0;
+}
+
+template <class TYPE>
+void FixedQueue<TYPE>::waitUntilNotEmpty()
+{
+    for (int i = d_spinCount.loadRelaxed(); 0 < i; --i) {
+        if (!isEmpty()) {
+            return;                                                   // RETURN
+        }
+        bsls::PerformanceHint::spinPause();
+    }
+
+    d_numWaitingPoppers.addRelaxed(1);
+
+    // SYNCHRONIZATION POINT 2-Prime
+    //
+    // The following call to 'isEmpty' loads
+    // 'FixedQueueIndexManager::d_pushIndex' with full sequential consistency,
+    // which is required to ensure the visibility of the preceding change to
+    // 'd_numWaitingPushers' to SYNCHRONIZATION POINT 2.
+
+    if (isEmpty()) {
+        d_popControlSema.wait();
+    }
+
+    d_numWaitingPoppers.addRelaxed(-1);
+}
+
+template <class TYPE>
+void FixedQueue<TYPE>::waitUntilNotFullOrDisabled()
+{
+    for (int i = d_spinCount.loadRelaxed(); 0 < i; --i) {
+        if (!isFull() || !isEnabled()) {
+            return;                                                   // RETURN
+        }
+        bsls::PerformanceHint::spinPause();
+    }
+
+    d_numWaitingPushers.addRelaxed(1);
+
+    // SYNCHRONIZATION POINT 1-Prime
+    //
+    // The following call to 'isFull' loads
+    // 'FixedQueueIndexManager::d_pushIndex' with full sequential consistency,
+    // which is required to ensure the visibility of the preceding change to
+    // 'd_numWaitingPushers' to SYNCHRONIZATION POINT 2.
+
+    if (isFull() && isEnabled()) {
+        d_pushControlSema.wait();
+    }
+
+    d_numWaitingPushers.addRelaxed(-1);
+}
+
+template <class TYPE>
+int FixedQueue<TYPE>::tryPushBack(const TYPE& value)
+{
+    // SYNCHRONIZATION POINT 1
+    //
+    // The following call to 'reservePushIndex' (in 'pushBackImp') writes
+    // 'FixedQueueIndexManaged::d_pushIndex' with full sequential consistency,
+    // which guarantees the subsequent (relaxed) read from
+    // 'd_numWaitingPoppers' sees any waiting pointers from SYNCHRONIZATION
+    // POINT 1-Prime.
+
+    int retval = pushBackImp(value);
+
+    if (0 != retval) {
+        return retval;                                                // RETURN
+    }
+
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_numWaitingPoppers)) {
         d_popControlSema.post();
     }
@@ -555,6 +801,62 @@ int FixedQueue<TYPE>::tryPushBack(const TYPE& value)
     return 0;
 }
 
+template <class TYPE>
+bsl::size_t FixedQueue<TYPE>::tryPushBack(const TYPE  *values,
+                                          bsl::size_t  numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    // See SYNCHRONIZATION POINT 1: the waiting poppers are loaded after the
+    // last successful reservation.  The cells are reserved by ranges of up to
+    // 'k_MAX_BATCH_SIZE' cells, with a single update of the push index per
+    // range.  If an exception is thrown by the copy constructor, the proctor
+    // disposes of the cells not yet committed as 'pushBackImp' does.
+
+    bsl::size_t numPushed = 0;
+    while (numPushed < numValues) {
+        unsigned int generations[k_MAX_BATCH_SIZE];
+        unsigned int indices[k_MAX_BATCH_SIZE];
+
+        const bsl::size_t numReserved = d_impl.reservePushIndices(
+                   generations,
+                   indices,
+                   bsl::min(numValues - numPushed,
+                            static_cast<bsl::size_t>(k_MAX_BATCH_SIZE)));
+
+        if (0 == numReserved) {
+            break;
+        }
+
+        FixedQueue_PushRangeProctor<TYPE> proctor(this,
+                                                  generations,
+                                                  indices,
+                                                  numReserved);
+
+        for (bsl::size_t i = 0; i < numReserved; ++i) {
+            bslalg::ScalarPrimitives::copyConstruct(&d_elements[indices[i]],
+                                                    values[numPushed],
+                                                    d_allocator_p);
+            proctor.releaseFirst();
+            d_impl.commitPushIndex(generations[i], indices[i]);
+            ++numPushed;
+        }
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numPushed &&
+                                              d_numWaitingPoppers)) {
+        int numWakeUps = static_cast<int>(bsl::min(
+                                   numPushed,
+                                   static_cast<bsl::size_t>(
+                                                       d_numWaitingPoppers)));
+        while (numWakeUps--) {
+            d_popControlSema.post();
+        }
+    }
+
+    return numPushed;
+}
+
 template <class TYPE>
 int FixedQueue<TYPE>::tryPopFront(TYPE *value)
 {
@@ -584,6 +886,57 @@ int FixedQueue<TYPE>::tryPopFront(TYPE *value)
     return 0;
 }
 
+template <class TYPE>
+bsl::size_t FixedQueue<TYPE>::tryPopFront(TYPE        *values,
+                                          bsl::size_t  maxNumValues)
+{
+    BSLS_ASSERT(values || 0 == maxNumValues);
+
+    // See SYNCHRONIZATION POINT 2: the waiting pushers are loaded after the
+    // last successful reservation.  The cells are reserved by ranges of up to
+    // 'k_MAX_BATCH_SIZE' cells, with a single update of the pop index per
+    // range.  The guard does not wake the pushers: they are woken once for
+    // the whole batch.
+
+    bsl::size_t numPopped = 0;
+    while (numPopped < maxNumValues) {
+        unsigned int generations[k_MAX_BATCH_SIZE];
+        unsigned int indices[k_MAX_BATCH_SIZE];
+
+        const bsl::size_t numReserved = d_impl.reservePopIndices(
+                   generations,
+                   indices,
+                   bsl::min(maxNumValues - numPopped,
+                            static_cast<bsl::size_t>(k_MAX_BATCH_SIZE)));
+
+        if (0 == numReserved) {
+            break;
+        }
+
+        FixedQueue_PopRangeGuard<TYPE> guard(this,
+                                             generations,
+                                             indices,
+                                             numReserved);
+
+        for (bsl::size_t i = 0; i < numReserved; ++i) {
+            values[numPopped++] = d_elements[indices[i]];
+        }
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numPopped &&
+                                              d_numWaitingPushers)) {
+        int numWakeUps = static_cast<int>(bsl::min(
+                                   numPopped,
+                                   static_cast<bsl::size_t>(
+                                                       d_numWaitingPushers)));
+        while (numWakeUps--) {
+            d_pushControlSema.post();
+        }
+    }
+
+    return numPopped;
+}
+
 // MANIPULATORS
 template <class TYPE>
 int FixedQueue<TYPE>::pushBack(const TYPE& value)
@@ -596,21 +949,30 @@ int FixedQueue<TYPE>::pushBack(const TYPE& value)
             return retval;                                            // RETURN
         }
 
-        d_numWaitingPushers.addRelaxed(1);
+        waitUntilNotFullOrDisabled();
+    }
+
+    return 0;
+}
+
+template <class TYPE>
+int FixedQueue<TYPE>::pushBack(const TYPE *values, bsl::size_t numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    while (0 < numValues) {
+        const bsl::size_t numPushed = tryPushBack(values, numValues);
 
-        // SYNCHRONIZATION POINT 1-Prime
-        //
-        // The following call to 'isFull' loads
-        // 'FixedQueueIndexManager::d_pushIndex' with full sequential
-        // consistency, which is required to ensure the visibility of the
-        // preceding change to 'd_numWaitingPushers' to SYNCHRONIZATION POINT
-        // 2.
+        if (0 == numPushed) {
+            if (!isEnabled()) {
+                return -1;                                            // RETURN
+            }
 
-        if (isFull() && isEnabled()) {
-            d_pushControlSema.wait();
+            waitUntilNotFullOrDisabled();
         }
 
-        d_numWaitingPushers.addRelaxed(-1);
+        values    += numPushed;
+        numValues -= numPushed;
     }
 
     return 0;
@@ -620,21 +982,7 @@ template <class TYPE>
 void FixedQueue<TYPE>::popFront(TYPE *value)
 {
     while (0 != tryPopFront(value)) {
-        d_numWaitingPoppers.addRelaxed(1);
-
-        // SYNCHRONIZATION POINT 2-Prime
-        //
-        // The following call to 'isEmpty' loads
-        // 'FixedQueueIndexManager::d_pushIndex' with full sequential
-        // consistency, which is required to ensure the visibility of the
-        // preceding change to 'd_numWaitingPushers' to SYNCHRONIZATION POINT
-        // 2.
-
-        if (isEmpty()) {
-            d_popControlSema.wait();
-        }
-
-        d_numWaitingPoppers.addRelaxed(-1);
+        waitUntilNotEmpty();
     }
 }
 
@@ -645,13 +993,7 @@ TYPE FixedQueue<TYPE>::popFront()
     unsigned int index;
 
     while (0 != d_impl.reservePopIndex(&generation, &index)) {
-        d_numWaitingPoppers.addRelaxed(1);
-
-        if (isEmpty()) {
-            d_popControlSema.wait();
-        }
-
-        d_numWaitingPoppers.addRelaxed(-1);
+        waitUntilNotEmpty();
     }
 
     // Copy the element.  'FixedQueue_PopGuard' will destroy original object,
@@ -662,6 +1004,21 @@ TYPE FixedQueue<TYPE>::popFront()
     return TYPE(d_elements[index]);
 }
 
+template <class TYPE>
+bsl::size_t FixedQueue<TYPE>::popFront(TYPE        *values,
+                                       bsl::size_t  maxNumValues)
+{
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(1 <= maxNumValues);
+
+    bsl::size_t numPopped;
+    while (0 == (numPopped = tryPopFront(values, maxNumValues))) {
+        waitUntilNotEmpty();
+    }
+
+    return numPopped;
+}
+
 template <class TYPE>
 void FixedQueue<TYPE>::removeAll()
 {
@@ -707,6 +1064,15 @@ void FixedQueue<TYPE>::enable()
     d_impl.enable();
 }
 
+template <class TYPE>
+inline
+void FixedQueue<TYPE>::setSpinCount(int spinCount)
+{
+    BSLS_ASSERT(0 <= spinCount);
+
+    d_spinCount.storeRelaxed(spinCount);
+}
+
 // ACCESSORS
 template <class TYPE>
 inline
@@ -750,6 +1116,13 @@ int FixedQueue<TYPE>::numElements() const
     return static_cast<int>(d_impl.length());
 }
 
+template <class TYPE>
+inline
+int FixedQueue<TYPE>::spinCount() const
+{
+    return d_spinCount.loadRelaxed();
+}
+
 template <class TYPE>
 inline
 int FixedQueue<TYPE>::size() const
@@ -764,12 +1137,15 @@ int FixedQueue<TYPE>::size() const
 // CREATORS
 template <class VALUE>
 inline
-FixedQueue_PopGuard<VALUE>::FixedQueue_PopGuard(FixedQueue<VALUE> *queue,
-                                                unsigned int       generation,
-                                                unsigned int       index)
+FixedQueue_PopGuard<VALUE>::FixedQueue_PopGuard(
+                                               FixedQueue<VALUE> *queue,
+                                               unsigned int       generation,
+                                               unsigned int       index,
+                                               bool               notifyPusher)
 : d_parent_p(queue)
 , d_generation(generation)
 , d_index(index)
+, d_notifyPusher(notifyPusher)
 {
 }
 
@@ -789,11 +1165,41 @@ FixedQueue_PopGuard<VALUE>::~FixedQueue_PopGuard()
     // Notify pusher of available element.
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
-            d_parent_p->d_numWaitingPushers)) {
+            d_notifyPusher && d_parent_p->d_numWaitingPushers)) {
         d_parent_p->d_pushControlSema.post();
     }
 }
 
+                       // ------------------------------
+                       // class FixedQueue_PopRangeGuard
+                       // ------------------------------
+
+// CREATORS
+template <class VALUE>
+inline
+FixedQueue_PopRangeGuard<VALUE>::FixedQueue_PopRangeGuard(
+                                           FixedQueue<VALUE>  *queue,
+                                           const unsigned int *generations,
+                                           const unsigned int *indices,
+                                           bsl::size_t         numIndices)
+: d_parent_p(queue)
+, d_generations(generations)
+, d_indices(indices)
+, d_numIndices(numIndices)
+{
+}
+
+template <class VALUE>
+FixedQueue_PopRangeGuard<VALUE>::~FixedQueue_PopRangeGuard()
+{
+    for (bsl::size_t i = 0; i < d_numIndices; ++i) {
+        bslalg::ScalarDestructionPrimitives::destroy(
+                                        d_parent_p->d_elements + d_indices[i]);
+
+        d_parent_p->d_impl.commitPopIndex(d_generations[i], d_indices[i]);
+    }
+}
+
                         // ----------------------------
                         // class FixedQueue_PushProctor
                         // ----------------------------
@@ -854,6 +1260,50 @@ void FixedQueue_PushProctor<VALUE>::release()
 {
     d_parent_p = 0;
 }
+
+                      // ---------------------------------
+                      // class FixedQueue_PushRangeProctor
+                      // ---------------------------------
+
+// CREATORS
+template <class VALUE>
+inline
+FixedQueue_PushRangeProctor<VALUE>::FixedQueue_PushRangeProctor(
+                                           FixedQueue<VALUE>  *queue,
+                                           const unsigned int *generations,
+                                           const unsigned int *indices,
+                                           bsl::size_t         numIndices)
+: d_parent_p(queue)
+, d_generations(generations)
+, d_indices(indices)
+, d_begin(0)
+, d_end(numIndices)
+{
+}
+
+template <class VALUE>
+FixedQueue_PushRangeProctor<VALUE>::~FixedQueue_PushRangeProctor()
+{
+    // Dispose of the cells still reserved, in order: each
+    // 'FixedQueue_PushProctor' pops and discards the elements up to its cell,
+    // and then releases that cell.
+
+    for (; d_begin < d_end; ++d_begin) {
+        FixedQueue_PushProctor<VALUE> proctor(d_parent_p,
+                                              d_generations[d_begin],
+                                              d_indices[d_begin]);
+    }
+}
+
+// MANIPULATORS
+template <class VALUE>
+inline
+void FixedQueue_PushRangeProctor<VALUE>::releaseFirst()
+{
+    BSLS_ASSERT(d_begin < d_end);
+
+    ++d_begin;
+}
 }  // close package namespace
 
 }  // close enterprise namespace
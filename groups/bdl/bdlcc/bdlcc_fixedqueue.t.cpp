@@ -48,6 +48,7 @@
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_stdlib.h>            // 'atoi'
 
@@ -984,6 +985,91 @@ void runtest(int numIterations, int numPushers, int numPoppers)
 }
 }  // close namespace zerotst
 
+namespace batchtst {
+
+void batchPusher(bdlcc::FixedQueue<int> *queue,
+                 int                     numValues,
+                 int                     batchSize)
+    // Push the values '[0 .. numValues)' in order onto the specified 'queue'
+    // in batches of up to the specified 'batchSize' elements.
+{
+    bsl::vector<int> values(batchSize);
+
+    for (int i = 0; i < numValues; i += batchSize) {
+        const int n = bsl::min(batchSize, numValues - i);
+        for (int j = 0; j < n; ++j) {
+            values[j] = i + j;
+        }
+        ASSERTT(0 == queue->pushBack(values.data(), n));
+    }
+}
+
+void batchPopper(bdlcc::FixedQueue<int> *queue,
+                 int                     numValues,
+                 int                     batchSize)
+    // Pop the specified 'numValues' elements from the specified 'queue' in
+    // batches of up to the specified 'batchSize' elements, and verify that
+    // they are the values '[0 .. numValues)' in order.
+{
+    bsl::vector<int> values(batchSize);
+
+    int expected = 0;
+    while (expected < numValues) {
+        const bsl::size_t n = queue->popFront(values.data(), batchSize);
+        ASSERTT(1 <= n && n <= static_cast<bsl::size_t>(batchSize));
+        for (bsl::size_t j = 0; j < n; ++j) {
+            LOOP2_ASSERTT(expected, values[j], expected == values[j]);
+            ++expected;
+        }
+    }
+}
+
+#ifdef BDE_BUILD_TARGET_EXC
+
+struct ThrowingCopy {
+    // This 'struct' holds a value whose copy constructor and copy assignment
+    // throw when the number of copies set in 's_numCopiesBeforeThrow' is
+    // reached.
+
+    static int s_numCopiesBeforeThrow;  // if positive, number of copies
+                                        // until (and including) the one that
+                                        // throws
+
+    int        d_value;
+
+    explicit ThrowingCopy(int value = 0)
+    : d_value(value)
+    {
+    }
+
+    ThrowingCopy(const ThrowingCopy& original)
+    : d_value(original.d_value)
+    {
+        countCopy();
+    }
+
+    ThrowingCopy& operator=(const ThrowingCopy& rhs)
+    {
+        countCopy();
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    static void countCopy()
+        // Throw if this copy is the one set in 's_numCopiesBeforeThrow'.
+    {
+        if (0 < s_numCopiesBeforeThrow && 0 == --s_numCopiesBeforeThrow) {
+            throw 1;
+        }
+    }
+};
+
+int ThrowingCopy::s_numCopiesBeforeThrow = 0;
+
+#endif
+
+}  // close namespace batchtst
+
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -1099,6 +1185,233 @@ int main(int argc, char *argv[])
 
     switch (test) { case 0:  // Zero is always the leading case.
       case 18: {
+        // --------------------------------------------------------------------
+        // BATCH PUSH/POP AND SPIN COUNT
+        //
+        // Concerns:
+        //: 1 'tryPushBack' with an array appends as many elements as fit, in
+        //:   order, and returns the number appended.
+        //:
+        //: 2 'tryPopFront' with an array removes up to the requested number
+        //:   of elements, in order, and returns the number removed.
+        //:
+        //: 3 The batch methods work across the wrap-around of the ring.
+        //:
+        //: 4 The batch push methods fail on a disabled queue.
+        //:
+        //: 5 'setSpinCount' sets the value returned by 'spinCount', which is
+        //:   initially 0.
+        //:
+        //: 6 A producer and a consumer using the blocking batch methods, with
+        //:   and without a spin count, transfer every element in order.
+        //:
+        //: 7 An exception thrown while copying an element of a batch leaves
+        //:   the queue in a valid state, without any cell left reserved.
+        //
+        // Plan:
+        //: 1 Push and pop batches on a small queue, checking the counts, the
+        //:   values, and 'numElements'.  (C-1..3)
+        //:
+        //: 2 Disable the queue and attempt batch pushes.  (C-4)
+        //:
+        //: 3 Set and read back a number of spin counts.  (C-5)
+        //:
+        //: 4 Run a batch producer against a batch consumer on a queue
+        //:   smaller than the batch size for several spin counts.  (C-6)
+        //:
+        //: 5 Push and pop batches of elements whose copy throws, and verify
+        //:   that the queue is empty and still usable.  (C-7)
+        //
+        // Testing:
+        //   int pushBack(const TYPE *values, size_t numValues);
+        //   size_t tryPushBack(const TYPE *values, size_t numValues);
+        //   size_t popFront(TYPE *values, size_t maxNumValues);
+        //   size_t tryPopFront(TYPE *values, size_t maxNumValues);
+        //   void setSpinCount(int spinCount);
+        //   int spinCount() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH PUSH/POP AND SPIN COUNT" << endl
+                          << "=============================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\nTesting non-blocking batches." << endl;
+        {
+            bdlcc::FixedQueue<int> mX(5, &ta);
+
+            const int VALUES[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+            int       buffer[8];
+
+            ASSERT(0 == mX.tryPushBack(VALUES, 0));
+            ASSERT(0 == mX.tryPopFront(buffer, 8));
+
+            for (int round = 0; round < 10; ++round) {
+                // Each round advances the indices by 6, so that the batches
+                // straddle the end of the ring.
+
+                ASSERTV(round, 3 == mX.tryPushBack(VALUES, 3));
+                ASSERTV(round, 2 == mX.tryPushBack(VALUES + 3, 5));
+                ASSERTV(round, 5 == mX.numElements());
+                ASSERTV(round, 0 == mX.tryPushBack(VALUES, 1));
+
+                ASSERTV(round, 3 == mX.tryPopFront(buffer, 3));
+                ASSERTV(round, 0 == buffer[0]);
+                ASSERTV(round, 1 == buffer[1]);
+                ASSERTV(round, 2 == buffer[2]);
+
+                ASSERTV(round, 1 == mX.tryPushBack(VALUES + 5, 1));
+                ASSERTV(round, 3 == mX.tryPopFront(buffer, 8));
+                ASSERTV(round, 3 == buffer[0]);
+                ASSERTV(round, 4 == buffer[1]);
+                ASSERTV(round, 5 == buffer[2]);
+                ASSERTV(round, mX.isEmpty());
+            }
+
+            ASSERT(4 == mX.tryPushBack(VALUES, 4));
+            ASSERT(4 == mX.popFront(buffer, 8));
+            for (int i = 0; i < 4; ++i) {
+                ASSERTV(i, i == buffer[i]);
+            }
+
+            ASSERT(0 == mX.pushBack(VALUES, 5));
+            ASSERT(mX.isFull());
+            ASSERT(2 == mX.popFront(buffer, 2));
+            ASSERT(0 == buffer[0]);
+            ASSERT(1 == buffer[1]);
+            mX.removeAll();
+
+            if (verbose) cout << "\tTesting a disabled queue." << endl;
+
+            mX.disable();
+            ASSERT(0 == mX.tryPushBack(VALUES, 3));
+            ASSERT(0 != mX.pushBack(VALUES, 3));
+            ASSERT(mX.isEmpty());
+
+            mX.enable();
+            ASSERT(3 == mX.tryPushBack(VALUES, 3));
+            ASSERT(3 == mX.numElements());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\nTesting exceptions in batches." << endl;
+        {
+            typedef batchtst::ThrowingCopy Element;
+
+            bdlcc::FixedQueue<Element> mX(8, &ta);
+
+            Element values[5];
+            for (int i = 0; i < 5; ++i) {
+                values[i].d_value = i;
+            }
+            ASSERT(2 == mX.tryPushBack(values, 2));
+
+            // A copy throwing in the middle of a batch leaves the queue in a
+            // valid empty state, with none of the reserved cells left
+            // behind.
+
+            Element::s_numCopiesBeforeThrow = 3;
+
+            bool caught = false;
+            try {
+                mX.tryPushBack(values, 5);
+            }
+            catch (int) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(mX.isEmpty());
+
+            ASSERT(5 == mX.tryPushBack(values, 5));
+            ASSERT(5 == mX.numElements());
+
+            // An assignment throwing in the middle of a batch removes all the
+            // elements reserved by the batch.
+
+            Element buffer[5];
+
+            Element::s_numCopiesBeforeThrow = 2;
+
+            caught = false;
+            try {
+                mX.tryPopFront(buffer, 5);
+            }
+            catch (int) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(0 == buffer[0].d_value);
+            ASSERT(mX.isEmpty());
+
+            for (int round = 0; round < 3; ++round) {
+                ASSERTV(round, 5 == mX.tryPushBack(values, 5));
+                ASSERTV(round, 5 == mX.tryPopFront(buffer, 8));
+                for (int i = 0; i < 5; ++i) {
+                    ASSERTV(round, i, i == buffer[i].d_value);
+                }
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+#endif
+
+        if (verbose) cout << "\nTesting 'setSpinCount'." << endl;
+        {
+            bdlcc::FixedQueue<int>        mX(5, &ta);
+            const bdlcc::FixedQueue<int>& X = mX;
+
+            ASSERT(0 == X.spinCount());
+
+            const int DATA[]   = { 1, 100, 0, 10000, INT_MAX, 0 };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                mX.setSpinCount(DATA[ti]);
+                ASSERTV(ti, DATA[ti] == X.spinCount());
+            }
+        }
+
+        if (verbose) cout << "\nTesting concurrent batches." << endl;
+        {
+            enum { k_NUM_VALUES = 100000 };
+
+            const int SPIN_COUNTS[]   = { 0, 10, 1000 };
+            const int NUM_SPIN_COUNTS = static_cast<int>(
+                                    sizeof SPIN_COUNTS / sizeof *SPIN_COUNTS);
+
+            const int BATCH_SIZES[]   = { 1, 7, 64 };
+            const int NUM_BATCH_SIZES = static_cast<int>(
+                                    sizeof BATCH_SIZES / sizeof *BATCH_SIZES);
+
+            for (int ti = 0; ti < NUM_SPIN_COUNTS; ++ti) {
+                for (int tj = 0; tj < NUM_BATCH_SIZES; ++tj) {
+                    const int SPIN  = SPIN_COUNTS[ti];
+                    const int BATCH = BATCH_SIZES[tj];
+
+                    if (veryVerbose) { T_ P_(SPIN) P(BATCH) }
+
+                    bdlcc::FixedQueue<int> mX(16, &ta);
+                    mX.setSpinCount(SPIN);
+
+                    bslmt::ThreadUtil::Handle handle;
+                    ASSERT(0 == bslmt::ThreadUtil::create(
+                                  &handle,
+                                  bdlf::BindUtil::bind(&batchtst::batchPopper,
+                                                       &mX,
+                                                       (int)k_NUM_VALUES,
+                                                       BATCH)));
+
+                    batchtst::batchPusher(&mX, k_NUM_VALUES, BATCH);
+
+                    ASSERT(0 == bslmt::ThreadUtil::join(handle));
+                    ASSERTV(SPIN, BATCH, mX.isEmpty());
+                }
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 19: {
         // ---------------------------------------------------------
         // Usage example test
         //
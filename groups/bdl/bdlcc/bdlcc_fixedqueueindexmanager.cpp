@@ -152,6 +152,21 @@ namespace BloombergLP {
 // either 'e_READING' or 'e_WRITING' is such that we can guarantee the queue
 // was either full or empty at the point of that 'testAndSwap'.
 //
+///Reserving Ranges of Indices
+///---------------------------
+// 'reservePushIndices' and 'reservePopIndices' first count the consecutive
+// cells, starting at the cell referred to by the push (or pop) index, that
+// are in the state required to reserve them ('e_EMPTY' or 'e_FULL') in the
+// generation of the index.  They then advance the index past all those cells
+// with a single 'testAndSwap', so that the shared index is modified once per
+// range rather than once per cell, and finally mark each cell 'e_WRITING' (or
+// 'e_READING').  A thread that loaded the index before it was advanced may
+// still reserve one of those cells with its own 'testAndSwap' on the cell
+// state; that cell is then skipped, which is why the reserved indices may not
+// be contiguous.  Note that a cell in the required state in the generation of
+// the index can only be reserved by such a thread, so that no cell is left
+// behind the index in its initial state.
+//
 ///Use of BSLS_ASSERT
 ///------------------
 // 'BSLS_ASSERT' is used frequently in this component to test expected internal
@@ -493,6 +508,91 @@ void FixedQueueIndexManager::commitPushIndex(unsigned int generation,
     d_states[index] = encodeElementState(generation, e_FULL);
 }
 
+bsl::size_t FixedQueueIndexManager::reservePushIndices(
+                                            unsigned int *generations,
+                                            unsigned int *indices,
+                                            bsl::size_t   maxNumIndices)
+{
+    BSLS_ASSERT(0 != generations);
+    BSLS_ASSERT(0 != indices);
+    BSLS_ASSERT(0 <  maxNumIndices);
+
+    unsigned int loadedPushIndex = d_pushIndex.loadRelaxed();
+
+    for (;;) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                         isDisabledFlagSet(loadedPushIndex))) {
+            return 0;                                                 // RETURN
+        }
+
+        // Count the cells that are empty in the generation of the push index.
+
+        const unsigned int combinedIndex = loadedPushIndex;
+        unsigned int       endIndex      = combinedIndex;
+        bsl::size_t        numIndices    = 0;
+
+        while (numIndices < maxNumIndices) {
+            const unsigned int generation =
+                          static_cast<unsigned int>(endIndex / d_capacity);
+            const unsigned int index      =
+                          static_cast<unsigned int>(endIndex % d_capacity);
+
+            if (encodeElementState(generation, e_EMPTY) !=
+                static_cast<unsigned int>(d_states[index].loadRelaxed())) {
+                break;
+            }
+            ++numIndices;
+            endIndex = nextCombinedIndex(endIndex);
+        }
+
+        if (0 == numIndices) {
+            // The next cell is not available: let 'reservePushIndex' wait for
+            // a reading thread, or determine whether the queue is full.
+
+            return 0 == reservePushIndex(generations, indices) ? 1 : 0;
+                                                                      // RETURN
+        }
+
+        // Reserve the range of cells.  Note that this 'testAndSwap' fails if
+        // the queue was disabled in the meantime.
+
+        const unsigned int was = d_pushIndex.testAndSwap(combinedIndex,
+                                                         endIndex);
+        if (combinedIndex != was) {
+            loadedPushIndex = was;
+            continue;
+        }
+
+        // Mark the cells for writing, skipping the cells reserved by the
+        // threads that loaded the push index before it was advanced.
+
+        bsl::size_t  numReserved = 0;
+        unsigned int currIndex   = combinedIndex;
+
+        for (bsl::size_t i = 0; i < numIndices; ++i) {
+            const unsigned int generation =
+                          static_cast<unsigned int>(currIndex / d_capacity);
+            const unsigned int index      =
+                          static_cast<unsigned int>(currIndex % d_capacity);
+
+            const int compare = encodeElementState(generation, e_EMPTY);
+            const int swap    = encodeElementState(generation, e_WRITING);
+
+            if (compare == d_states[index].testAndSwap(compare, swap)) {
+                generations[numReserved] = generation;
+                indices[numReserved]     = index;
+                ++numReserved;
+            }
+            currIndex = nextCombinedIndex(currIndex);
+        }
+
+        if (0 < numReserved) {
+            return numReserved;                                       // RETURN
+        }
+        loadedPushIndex = d_pushIndex.loadRelaxed();
+    }
+}
+
 int FixedQueueIndexManager::reservePopIndex(unsigned int *generation,
                                             unsigned int *index)
 {
@@ -624,6 +724,85 @@ void FixedQueueIndexManager::commitPopIndex(unsigned int generation,
                                          e_EMPTY);
 }
 
+bsl::size_t FixedQueueIndexManager::reservePopIndices(
+                                            unsigned int *generations,
+                                            unsigned int *indices,
+                                            bsl::size_t   maxNumIndices)
+{
+    BSLS_ASSERT(0 != generations);
+    BSLS_ASSERT(0 != indices);
+    BSLS_ASSERT(0 <  maxNumIndices);
+
+    unsigned int loadedPopIndex = d_popIndex.load();
+
+    for (;;) {
+        // Count the cells that are full in the generation of the pop index.
+
+        const unsigned int combinedIndex = loadedPopIndex;
+        unsigned int       endIndex      = combinedIndex;
+        bsl::size_t        numIndices    = 0;
+
+        while (numIndices < maxNumIndices) {
+            const unsigned int generation =
+                          static_cast<unsigned int>(endIndex / d_capacity);
+            const unsigned int index      =
+                          static_cast<unsigned int>(endIndex % d_capacity);
+
+            if (encodeElementState(generation, e_FULL) !=
+                static_cast<unsigned int>(d_states[index].loadRelaxed())) {
+                break;
+            }
+            ++numIndices;
+            endIndex = nextCombinedIndex(endIndex);
+        }
+
+        if (0 == numIndices) {
+            // The next cell is not available: let 'reservePopIndex' wait for
+            // a writing thread, or determine whether the queue is empty.
+
+            return 0 == reservePopIndex(generations, indices) ? 1 : 0;
+                                                                      // RETURN
+        }
+
+        // Reserve the range of cells.
+
+        const unsigned int was = d_popIndex.testAndSwap(combinedIndex,
+                                                        endIndex);
+        if (combinedIndex != was) {
+            loadedPopIndex = was;
+            continue;
+        }
+
+        // Mark the cells for reading, skipping the cells reserved by the
+        // threads that loaded the pop index before it was advanced.
+
+        bsl::size_t  numReserved = 0;
+        unsigned int currIndex   = combinedIndex;
+
+        for (bsl::size_t i = 0; i < numIndices; ++i) {
+            const unsigned int generation =
+                          static_cast<unsigned int>(currIndex / d_capacity);
+            const unsigned int index      =
+                          static_cast<unsigned int>(currIndex % d_capacity);
+
+            const int compare = encodeElementState(generation, e_FULL);
+            const int swap    = encodeElementState(generation, e_READING);
+
+            if (compare == d_states[index].testAndSwap(compare, swap)) {
+                generations[numReserved] = generation;
+                indices[numReserved]     = index;
+                ++numReserved;
+            }
+            currIndex = nextCombinedIndex(currIndex);
+        }
+
+        if (0 < numReserved) {
+            return numReserved;                                       // RETURN
+        }
+        loadedPopIndex = d_popIndex.loadRelaxed();
+    }
+}
+
 void FixedQueueIndexManager::disable()
 {
 
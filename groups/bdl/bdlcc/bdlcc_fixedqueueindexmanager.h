@@ -402,6 +402,23 @@ class FixedQueueIndexManager {
         // 'index' match those returned by a previous successful call to
         // 'reservePushIndex' (that has not previously been committed).
 
+    bsl::size_t reservePushIndices(unsigned int *generations,
+                                   unsigned int *indices,
+                                   bsl::size_t   maxNumIndices);
+        // Reserve up to the specified 'maxNumIndices' available indices at
+        // which to enqueue elements in an (externally managed) circular
+        // buffer, advancing the push index past all of them with a single
+        // atomic operation; load the reserved indices, in the order in which
+        // they are to be popped, into the array at the specified 'indices',
+        // and their generations into the array at the specified
+        // 'generations'.  Return the number of reserved indices, or 0 if the
+        // queue is full or disabled.  Each reserved index must be committed
+        // (see 'commitPushIndex') as for 'reservePushIndex', and in order.
+        // The behavior is undefined unless '0 < maxNumIndices', and the
+        // current thread is not already holding a reservation on either a
+        // push or pop index.  Note that the indices reserved may not be
+        // contiguous if other threads are concurrently pushing elements.
+
                          // Popping Elements
 
     int reservePopIndex(unsigned int *generation, unsigned int *index);
@@ -429,6 +446,23 @@ class FixedQueueIndexManager {
         // successful call to 'reservePopIndex' (that has not previously been
         // committed).
 
+    bsl::size_t reservePopIndices(unsigned int *generations,
+                                  unsigned int *indices,
+                                  bsl::size_t   maxNumIndices);
+        // Reserve up to the specified 'maxNumIndices' next available indices
+        // from which to dequeue elements from an (externally managed)
+        // circular buffer, advancing the pop index past all of them with a
+        // single atomic operation; load the reserved indices, in the order in
+        // which they were pushed, into the array at the specified 'indices',
+        // and their generations into the array at the specified
+        // 'generations'.  Return the number of reserved indices, or 0 if the
+        // queue is empty.  Each reserved index must be committed (see
+        // 'commitPopIndex') as for 'reservePopIndex'.  The behavior is
+        // undefined unless '0 < maxNumIndices', and the current thread is not
+        // already holding a reservation on either a push or pop index.  Note
+        // that the indices reserved may not be contiguous if other threads are
+        // concurrently popping elements.
+
                                 // Disabled State
 
     void disable();
@@ -90,6 +90,8 @@ using namespace bsl;
 // [ 3] void commitPushIndex(unsigned int , unsigned int );
 // [ 3] int reservePopIndex(unsigned int *, unsigned int *);
 // [ 3] void commitPopIndex(unsigned int , unsigned int );
+// [13] size_t reservePushIndices(unsigned *, unsigned *, size_t);
+// [13] size_t reservePopIndices(unsigned *, unsigned *, size_t);
 // [ 6] int reservePopIndexForClear(unsigned *,unsigned *,unsigned,unsigned);
 // [ 7] void abortPushIndexReservation(unsigned int, unsigned int);
 // [ 5] void disable();
@@ -102,7 +104,7 @@ using namespace bsl;
 // [10] bsl::ostream& print(bsl::ostream& ) const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [13] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
 // [ 4] CONCERN: 'gg' generator and 'dirtyGG' generator
 // [11] CONCERN: Thread-Safety (concurrent access does not corrupt state)
 // [12] CONCERN: maxCombinedIndex
@@ -887,6 +889,81 @@ void assertValidState(Obj *x)
     }
 }
 
+void batchWriterThread(Obj             *x,
+                       int              numPushes,
+                       bsls::AtomicInt *numPushed)
+    // Push the specified 'numPushes' elements into the specified 'x' test
+    // object, alternately reserving ranges of indices and single indices, and
+    // add the number of elements pushed to the specified 'numPushed'.
+{
+    const int k_MAX_RANGE = 4;
+
+    unsigned int generations[k_MAX_RANGE];
+    unsigned int indices[k_MAX_RANGE];
+
+    int count = 0;
+    while (count < numPushes) {
+        bsl::size_t numReserved;
+        if (count % 2) {
+            numReserved = x->reservePushIndices(
+                                     generations,
+                                     indices,
+                                     bsl::min(k_MAX_RANGE, numPushes - count));
+        }
+        else {
+            numReserved = 0 == x->reservePushIndex(&generations[0],
+                                                   &indices[0]) ? 1 : 0;
+        }
+
+        if (0 == numReserved) {
+            bslmt::ThreadUtil::yield();
+            continue;
+        }
+        for (bsl::size_t i = 0; i < numReserved; ++i) {
+            x->commitPushIndex(generations[i], indices[i]);
+        }
+        count += static_cast<int>(numReserved);
+    }
+    numPushed->add(count);
+}
+
+void batchReaderThread(Obj             *x,
+                       int              numPops,
+                       bsls::AtomicInt *numPopped)
+    // Pop elements from the specified 'x' test object, alternately reserving
+    // ranges of indices and single indices, until the specified 'numPopped'
+    // reaches the specified 'numPops'.
+{
+    const int k_MAX_RANGE = 4;
+
+    unsigned int generations[k_MAX_RANGE];
+    unsigned int indices[k_MAX_RANGE];
+
+    bool range = false;
+    while (*numPopped < numPops) {
+        bsl::size_t numReserved;
+        if (range) {
+            numReserved = x->reservePopIndices(generations,
+                                               indices,
+                                               k_MAX_RANGE);
+        }
+        else {
+            numReserved = 0 == x->reservePopIndex(&generations[0],
+                                                  &indices[0]) ? 1 : 0;
+        }
+        range = !range;
+
+        if (0 == numReserved) {
+            bslmt::ThreadUtil::yield();
+            continue;
+        }
+        for (bsl::size_t i = 0; i < numReserved; ++i) {
+            x->commitPopIndex(generations[i], indices[i]);
+        }
+        numPopped->add(static_cast<int>(numReserved));
+    }
+}
+
 // ============================================================================
 //                             PERFORMANCE TEST
 // ----------------------------------------------------------------------------
@@ -982,7 +1059,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -1021,6 +1098,200 @@ int main(int argc, char *argv[])
     ASSERT(1 == result);
 //..
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING: 'reservePushIndices' and 'reservePopIndices'
+        //
+        // Concerns:
+        //  1 That 'reservePushIndices' reserves, in order, up to the
+        //    requested number of empty cells following the push index, and
+        //    returns 0 if the queue is full or disabled.
+        //
+        //  2 That 'reservePopIndices' reserves, in order, up to the requested
+        //    number of full cells following the pop index, and returns 0 if
+        //    the queue is empty.
+        //
+        //  3 That a range of indices may wrap around the end of the buffer,
+        //    and around the maximum combined index.
+        //
+        //  4 That concurrent reservations of ranges and single indices do not
+        //    corrupt the state of the buffer.
+        //
+        // Plan:
+        //  1 Reserve and commit ranges of indices on a queue of capacity 5,
+        //    and verify the reserved indices, their generations, and the
+        //    length of the queue.  (C-1..2)
+        //
+        //  2 Repeat starting at the last generation.  (C-3)
+        //
+        //  3 Push and pop a fixed number of elements from several threads,
+        //    alternately reserving ranges and single indices, and verify
+        //    the state of the buffer.  (C-4)
+        //
+        // Testing:
+        //   size_t reservePushIndices(unsigned *, unsigned *, size_t);
+        //   size_t reservePopIndices(unsigned *, unsigned *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: 'reservePushIndices' and "
+                          << "'reservePopIndices'" << endl
+                          << "=================================="
+                          << "===================" << endl;
+
+        unsigned int generations[8];
+        unsigned int indices[8];
+
+        if (verbose) cout << "\tReserve ranges of indices." << endl;
+        {
+            Obj x(5);
+
+            ASSERT(0 == x.reservePopIndices(generations, indices, 8));
+
+            ASSERT(3 == x.reservePushIndices(generations, indices, 3));
+            for (unsigned int i = 0; i < 3; ++i) {
+                ASSERTV(i, 0 == generations[i]);
+                ASSERTV(i, i == indices[i]);
+                x.commitPushIndex(generations[i], indices[i]);
+            }
+            ASSERT(3 == x.length());
+
+            ASSERT(2 == x.reservePushIndices(generations, indices, 8));
+            ASSERT(3 == indices[0]);
+            ASSERT(4 == indices[1]);
+            x.commitPushIndex(generations[0], indices[0]);
+            x.commitPushIndex(generations[1], indices[1]);
+            ASSERT(5 == x.length());
+
+            ASSERT(0 == x.reservePushIndices(generations, indices, 8));
+
+            ASSERT(4 == x.reservePopIndices(generations, indices, 4));
+            for (unsigned int i = 0; i < 4; ++i) {
+                ASSERTV(i, 0 == generations[i]);
+                ASSERTV(i, i == indices[i]);
+                x.commitPopIndex(generations[i], indices[i]);
+            }
+            ASSERT(1 == x.length());
+
+            // The cell at index 4 is still full: the range stops before it.
+
+            ASSERT(4 == x.reservePushIndices(generations, indices, 8));
+            for (unsigned int i = 0; i < 4; ++i) {
+                ASSERTV(i, 1 == generations[i]);
+                ASSERTV(i, i == indices[i]);
+                x.commitPushIndex(generations[i], indices[i]);
+            }
+            ASSERT(5 == x.length());
+
+            ASSERT(5 == x.reservePopIndices(generations, indices, 8));
+            ASSERT(4 == indices[0] && 0 == generations[0]);
+            for (unsigned int i = 1; i < 5; ++i) {
+                ASSERTV(i, 1     == generations[i]);
+                ASSERTV(i, i - 1 == indices[i]);
+            }
+            for (unsigned int i = 0; i < 5; ++i) {
+                x.commitPopIndex(generations[i], indices[i]);
+            }
+            ASSERT(0 == x.length());
+            ASSERT(0 == x.reservePopIndices(generations, indices, 8));
+            assertValidState(&x);
+
+            x.disable();
+            ASSERT(0 == x.reservePushIndices(generations, indices, 8));
+            x.enable();
+            ASSERT(1 == x.reservePushIndices(generations, indices, 1));
+            x.commitPushIndex(generations[0], indices[0]);
+            ASSERT(1 == x.length());
+        }
+
+        if (verbose) cout << "\tWrap around the maximum combined index."
+                          << endl;
+        {
+            Obj x(5);
+
+            FixedQueueState state(&x);
+            const unsigned int MAX_GENERATION = state.maxGeneration();
+
+            dirtyAdjustGeneration(&x, MAX_GENERATION);
+
+            ASSERT(3 == x.reservePushIndices(generations, indices, 3));
+            for (unsigned int i = 0; i < 3; ++i) {
+                x.commitPushIndex(generations[i], indices[i]);
+            }
+            ASSERT(3 == x.reservePopIndices(generations, indices, 8));
+            for (unsigned int i = 0; i < 3; ++i) {
+                x.commitPopIndex(generations[i], indices[i]);
+            }
+
+            ASSERT(5 == x.reservePushIndices(generations, indices, 8));
+            ASSERT(MAX_GENERATION == generations[0] && 3 == indices[0]);
+            ASSERT(MAX_GENERATION == generations[1] && 4 == indices[1]);
+            for (unsigned int i = 2; i < 5; ++i) {
+                ASSERTV(i, 0     == generations[i]);
+                ASSERTV(i, i - 2 == indices[i]);
+            }
+            for (unsigned int i = 0; i < 5; ++i) {
+                x.commitPushIndex(generations[i], indices[i]);
+            }
+            ASSERT(5 == x.length());
+
+            ASSERT(5 == x.reservePopIndices(generations, indices, 8));
+            for (unsigned int i = 0; i < 5; ++i) {
+                x.commitPopIndex(generations[i], indices[i]);
+            }
+            ASSERT(0 == x.length());
+            assertValidState(&x);
+        }
+
+        if (verbose) cout << "\tConcurrent reservations." << endl;
+        {
+            const int NUM_WRITERS = 4;
+            const int NUM_READERS = 4;
+            const int NUM_PUSHES  = 20000;  // per writer
+            const int TOTAL       = NUM_WRITERS * NUM_PUSHES;
+
+            const int CAPACITIES[] = { 1, 7, 64 };
+            const int NUM_CAPACITIES = static_cast<int>(
+                                    sizeof CAPACITIES / sizeof *CAPACITIES);
+
+            for (int ti = 0; ti < NUM_CAPACITIES; ++ti) {
+                Obj x(CAPACITIES[ti]);
+
+                bsls::AtomicInt numPushed(0);
+                bsls::AtomicInt numPopped(0);
+
+                bsl::vector<bslmt::ThreadUtil::Handle> handles(
+                                                    NUM_WRITERS + NUM_READERS);
+
+                for (int i = 0; i < NUM_WRITERS; ++i) {
+                    int rc = bslmt::ThreadUtil::create(
+                                 &handles[i],
+                                 bdlf::BindUtil::bind(&batchWriterThread,
+                                                      &x,
+                                                      NUM_PUSHES,
+                                                      &numPushed));
+                    BSLS_ASSERT_OPT(0 == rc); // test invariant
+                }
+                for (int i = 0; i < NUM_READERS; ++i) {
+                    int rc = bslmt::ThreadUtil::create(
+                                 &handles[NUM_WRITERS + i],
+                                 bdlf::BindUtil::bind(&batchReaderThread,
+                                                      &x,
+                                                      TOTAL,
+                                                      &numPopped));
+                    BSLS_ASSERT_OPT(0 == rc); // test invariant
+                }
+                for (int i = 0; i < NUM_WRITERS + NUM_READERS; ++i) {
+                    bslmt::ThreadUtil::join(handles[i]);
+                }
+
+                ASSERTV(CAPACITIES[ti], TOTAL == numPushed);
+                ASSERTV(CAPACITIES[ti], TOTAL == numPopped);
+                ASSERTV(CAPACITIES[ti], 0 == x.length());
+                assertValidState(&x);
+            }
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // CONCERN: maxCombinedIndex
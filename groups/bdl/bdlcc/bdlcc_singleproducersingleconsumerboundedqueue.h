@@ -0,0 +1,1040 @@
+// bdlcc_singleproducersingleconsumerboundedqueue.h                   -*-C++-*-
+#ifndef INCLUDED_BDLCC_SINGLEPRODUCERSINGLECONSUMERBOUNDEDQUEUE
+#define INCLUDED_BDLCC_SINGLEPRODUCERSINGLECONSUMERBOUNDEDQUEUE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free single-producer single-consumer bounded queue.
+//
+//@CLASSES:
+//  bdlcc::SingleProducerSingleConsumerBoundedQueue: SPSC ring of 'TYPE'
+//
+//@SEE_ALSO: bdlcc_fixedqueue, bdlcc_queue
+//
+//@DESCRIPTION: This component defines a class template,
+// 'bdlcc::SingleProducerSingleConsumerBoundedQueue', that provides a
+// lock-free, fixed-capacity queue of values, for the hand-off of values from
+// exactly one thread (the *producer*), to exactly one other thread (the
+// *consumer*).
+//
+// 'bdlcc::FixedQueue' supports any number of pushing and popping threads, at
+// the cost of atomic read-modify-write operations on each push and pop.  When
+// a queue connects exactly two threads (e.g., two stages of a pipeline), a
+// 'bdlcc::SingleProducerSingleConsumerBoundedQueue' can be used instead: the
+// producer and the consumer each own one index into a ring buffer, which only
+// they modify, and read the index of the other thread only when the cached
+// copy they keep of it no longer lets them proceed.  The indices of the
+// producer and of the consumer are on separate cache lines, so that a push
+// and a pop do not, in the common case, access a cache line modified by the
+// other thread, except for the element itself.
+//
+// Values are pushed with 'pushBack' and 'tryPushBack', and popped with
+// 'popFront' and 'tryPopFront', either one at a time or in batches, from and
+// into an array, which publishes (or releases) a whole batch with a single
+// atomic store.  The 'try' methods return immediately if the queue is full
+// (or empty), whereas the other methods block until there is space (or a
+// value) in the queue.  Blocking does not affect the pushes and pops that do
+// not need to wait: a thread blocks on a semaphore only after registering
+// itself with an atomic flag, which the other thread checks after publishing
+// its index.
+//
+// As for 'bdlcc::FixedQueue', the queue may be placed into a "disabled" state
+// using the 'disable' method, in which 'pushBack' and 'tryPushBack' fail
+// immediately (including a 'pushBack' currently blocked), until the queue is
+// re-enabled with the 'enable' method.
+//
+///Thread Safety
+///-------------
+// 'bdlcc::SingleProducerSingleConsumerBoundedQueue' is *thread-enabled*, with
+// the following restrictions: the methods pushing values ('pushBack' and
+// 'tryPushBack') must be called by at most one thread at any time (the
+// producer), and the methods popping values ('popFront', 'tryPopFront', and
+// 'removeAll') must be called by at most one thread at any time (the
+// consumer).  The producer and the consumer may be different threads over the
+// lifetime of a queue, provided that a handover between two threads is
+// synchronized externally.  'disable', 'enable', and the accessors can be
+// called from any thread.
+//
+///Template Requirements
+///---------------------
+// 'bdlcc::SingleProducerSingleConsumerBoundedQueue' is a template that is
+// parameterized on the type of element contained within the queue, 'TYPE',
+// that must be copy-constructible and copy-assignable.  If 'TYPE' uses a
+// 'bslma::Allocator', the allocator of the queue is passed to the copies of
+// the values held in the queue.
+//
+///Exception Safety
+///----------------
+// If the copy constructor or the assignment operator of 'TYPE' throws an
+// exception, the values of the batch that were pushed (or popped) before the
+// one throwing remain pushed (or popped), and the queue is left in a valid
+// state.  The single-value methods provide the strong exception guarantee.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Two-Stage Pipeline
+///- - - - - - - - - - - - - - - -
+// In this example, a thread reading messages hands them off to a thread
+// processing them, through a 'bdlcc::SingleProducerSingleConsumerBoundedQueue'
+// of integers, where the value -1 signals the end of the messages.
+//
+// First, we define the function of the consumer thread, which pops up to 16
+// values at a time, waiting as needed, and adds them until it pops -1:
+//..
+//  void consume(bdlcc::SingleProducerSingleConsumerBoundedQueue<int> *queue,
+//               bsls::Types::Int64                                   *sum)
+//  {
+//      int values[16];
+//
+//      for (;;) {
+//          bsl::size_t numValues = queue->popFront(values, 16);
+//
+//          for (bsl::size_t i = 0; i < numValues; ++i) {
+//              if (-1 == values[i]) {
+//                  return;                                           // RETURN
+//              }
+//              *sum += values[i];
+//          }
+//      }
+//  }
+//..
+// Then, we create a queue having a capacity of 256 values, and start the
+// consumer thread:
+//..
+//  bdlcc::SingleProducerSingleConsumerBoundedQueue<int> queue(256);
+//
+//  bsls::Types::Int64        sum = 0;
+//  bslmt::ThreadUtil::Handle handle;
+//
+//  int rc = bslmt::ThreadUtil::create(&handle,
+//                                     bdlf::BindUtil::bind(&consume,
+//                                                          &queue,
+//                                                          &sum));
+//  assert(0 == rc);
+//..
+// Next, the producer (i.e., the current thread) pushes the values, one at a
+// time, which blocks when the consumer lags behind by 256 values:
+//..
+//  for (int i = 0; i < 10000; ++i) {
+//      rc = queue.pushBack(i);
+//      assert(0 == rc);
+//  }
+//..
+// Finally, we push the value ending the messages, wait for the consumer
+// thread to complete, and check the result:
+//..
+//  rc = queue.pushBack(-1);
+//  assert(0 == rc);
+//
+//  bslmt::ThreadUtil::join(handle);
+//  assert(10000 * 9999 / 2 == sum);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_PLATFORM
+#include <bslmt_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_SEMAPHORE
+#include <bslmt_semaphore.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
+#include <bslalg_scalardestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSL_CLIMITS
+#include <bsl_climits.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlcc {
+
+template <class TYPE>
+class SingleProducerSingleConsumerBoundedQueue_PopGuard;
+
+template <class TYPE>
+class SingleProducerSingleConsumerBoundedQueue_PushGuard;
+
+            // ==============================================
+            // class SingleProducerSingleConsumerBoundedQueue
+            // ==============================================
+
+template <class TYPE>
+class SingleProducerSingleConsumerBoundedQueue {
+    // This class provides a thread-enabled, lock-free, fixed-capacity queue of
+    // values, that supports exactly one pushing thread and exactly one popping
+    // thread at any time.
+
+  private:
+    // PRIVATE TYPES
+    typedef SingleProducerSingleConsumerBoundedQueue_PopGuard<TYPE>  PopGuard;
+    typedef SingleProducerSingleConsumerBoundedQueue_PushGuard<TYPE> PushGuard;
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_SHARED_PADDING = bslmt::Platform::e_CACHE_LINE_SIZE
+                           - sizeof(TYPE *)
+                           - sizeof(int)
+                           - sizeof(bslma::Allocator *),
+        k_INDEX_PADDING  = bslmt::Platform::e_CACHE_LINE_SIZE
+                           - sizeof(bsls::AtomicInt)
+                           - sizeof(int),
+        k_WAIT_PADDING   = bslmt::Platform::e_CACHE_LINE_SIZE
+                           - sizeof(bsls::AtomicInt)
+                           - sizeof(bslmt::Semaphore)
+    };
+
+    // DATA
+
+    // Members read by both threads, and modified by neither.
+
+    TYPE             *d_elements;        // ring buffer of 'd_size' elements,
+                                         // of which those in
+                                         // '[d_popIndex, d_pushIndex)' are
+                                         // constructed
+
+    const int         d_size;            // number of elements of the ring
+                                         // buffer ('capacity() + 1', so that
+                                         // a full queue is distinguished from
+                                         // an empty one)
+
+    bslma::Allocator *d_allocator_p;     // allocator (held, not owned)
+
+    const char        d_sharedPad[k_SHARED_PADDING];
+                                         // padding to prevent false sharing
+
+    // Members modified by the producer.
+
+    bsls::AtomicInt   d_pushIndex;       // index of the element to be pushed
+                                         // next
+
+    int               d_cachedPopIndex;  // value of 'd_popIndex' last loaded
+                                         // by the producer
+
+    const char        d_pushIndexPad[k_INDEX_PADDING];
+                                         // padding to prevent false sharing
+
+    // Members modified by the consumer.
+
+    bsls::AtomicInt   d_popIndex;        // index of the element to be popped
+                                         // next
+
+    int               d_cachedPushIndex; // value of 'd_pushIndex' last loaded
+                                         // by the consumer
+
+    const char        d_popIndexPad[k_INDEX_PADDING];
+                                         // padding to prevent false sharing
+
+    // Members used to block.
+
+    bsls::AtomicInt   d_popWaiting;      // 1 if the consumer is blocked, or
+                                         // about to block, on 'd_popSema', and
+                                         // 0 otherwise
+
+    bslmt::Semaphore  d_popSema;         // semaphore on which the consumer
+                                         // waits for an element
+
+    const char        d_popSemaPad[k_WAIT_PADDING];
+                                         // padding to prevent false sharing
+
+    bsls::AtomicInt   d_pushWaiting;     // 1 if the producer is blocked, or
+                                         // about to block, on 'd_pushSema',
+                                         // and 0 otherwise
+
+    bslmt::Semaphore  d_pushSema;        // semaphore on which the producer
+                                         // waits for space
+
+    bsls::AtomicInt   d_disabled;        // 1 if pushing is disabled, and 0
+                                         // otherwise
+
+    // FRIENDS
+    friend class SingleProducerSingleConsumerBoundedQueue_PopGuard<TYPE>;
+    friend class SingleProducerSingleConsumerBoundedQueue_PushGuard<TYPE>;
+
+    // NOT IMPLEMENTED
+    SingleProducerSingleConsumerBoundedQueue(
+                              const SingleProducerSingleConsumerBoundedQueue&);
+    SingleProducerSingleConsumerBoundedQueue& operator=(
+                              const SingleProducerSingleConsumerBoundedQueue&);
+
+    // PRIVATE MANIPULATORS
+    int numElementsToPop(int maxNumElements);
+        // Return the number of elements, at most the specified
+        // 'maxNumElements', that the consumer can pop.  Load 'd_pushIndex'
+        // only if 'd_cachedPushIndex' does not allow popping
+        // 'maxNumElements' elements.
+
+    int numElementsToPush(int maxNumElements);
+        // Return the number of elements, at most the specified
+        // 'maxNumElements', that the producer can push.  Load 'd_popIndex'
+        // only if 'd_cachedPopIndex' does not allow pushing 'maxNumElements'
+        // elements.
+
+    void publishPopIndex(int index);
+        // Set 'd_popIndex' to the specified 'index', releasing the elements
+        // that were popped to the producer, and wake the producer if it is
+        // waiting.
+
+    void publishPushIndex(int index);
+        // Set 'd_pushIndex' to the specified 'index', publishing the elements
+        // that were pushed to the consumer, and wake the consumer if it is
+        // waiting.
+
+    void waitUntilNotEmpty();
+        // Block until this queue is not empty.  Note that this method may
+        // return spuriously.
+
+    void waitUntilNotFullOrDisabled();
+        // Block until this queue is not full or is disabled.  Note that this
+        // method may return spuriously.
+
+    // PRIVATE ACCESSORS
+    int nextIndex(int index) const;
+        // Return the index of the element following the element at the
+        // specified 'index' in the ring buffer.
+
+    int numElementsBetween(int popIndex, int pushIndex) const;
+        // Return the number of elements in the ring buffer from the specified
+        // 'popIndex' to the specified 'pushIndex'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(SingleProducerSingleConsumerBoundedQueue,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit
+    SingleProducerSingleConsumerBoundedQueue(
+                                   bsl::size_t       capacity,
+                                   bslma::Allocator *basicAllocator = 0);
+        // Create an empty, enabled queue having the specified 'capacity'.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '1 <= capacity' and
+        // 'capacity < INT_MAX'.
+
+    ~SingleProducerSingleConsumerBoundedQueue();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void disable();
+        // Disable pushing into this queue.  All subsequent invocations of
+        // 'pushBack' or 'tryPushBack' will fail immediately, as will a
+        // blocked invocation of 'pushBack'.  If the queue is already disabled,
+        // this method has no effect.
+
+    void enable();
+        // Enable pushing into this queue.  If the queue is not disabled, this
+        // method has no effect.
+
+    void popFront(TYPE *value);
+        // Remove the element from the front of this queue and load that
+        // element into the specified 'value'.  If the queue is empty, block
+        // until it is not empty.  The behavior is undefined unless this
+        // method is called by the consumer.
+
+    bsl::size_t popFront(TYPE *values, bsl::size_t maxNumValues);
+        // Remove up to the specified 'maxNumValues' elements from the front
+        // of this queue, load them in order into the array at the specified
+        // 'values', and return the number of elements removed.  If the queue
+        // is empty, block until it is not empty.  The behavior is undefined
+        // unless this method is called by the consumer, '1 <= maxNumValues',
+        // and 'values' refers to an array of at least 'maxNumValues'
+        // elements.
+
+    int pushBack(const TYPE& value);
+        // Append the specified 'value' to the back of this queue, blocking
+        // until either space is available - if necessary - or the queue is
+        // disabled.  Return 0 on success, and a non-zero value if the queue
+        // is disabled.  The behavior is undefined unless this method is
+        // called by the producer.
+
+    int pushBack(const TYPE *values, bsl::size_t numValues);
+        // Append, in order, the specified 'numValues' elements of the array
+        // at the specified 'values' to the back of this queue, blocking until
+        // space is available for all of them - if necessary - or the queue is
+        // disabled.  Return 0 on success, and a non-zero value if the queue is
+        // disabled, in which case only the first elements of 'values' may
+        // have been appended.  The behavior is undefined unless this method is
+        // called by the producer.
+
+    void removeAll();
+        // Remove all the elements from this queue.  The behavior is undefined
+        // unless this method is called by the consumer.  Note that the queue
+        // is not empty when this method returns if the producer has
+        // concurrently pushed elements.
+
+    int tryPopFront(TYPE *value);
+        // Attempt to remove the element from the front of this queue without
+        // blocking, and, if successful, load the specified 'value' with the
+        // removed element.  Return 0 on success, and a non-zero value if the
+        // queue was empty, in which case 'value' is not changed.  The behavior
+        // is undefined unless this method is called by the consumer.
+
+    bsl::size_t tryPopFront(TYPE *values, bsl::size_t maxNumValues);
+        // Remove, without blocking, up to the specified 'maxNumValues'
+        // elements from the front of this queue, load them in order into the
+        // array at the specified 'values', and return the number of elements
+        // removed (0 if the queue was empty).  The behavior is undefined
+        // unless this method is called by the consumer, and 'values' refers
+        // to an array of at least 'maxNumValues' elements.
+
+    int tryPushBack(const TYPE& value);
+        // Attempt to append the specified 'value' to the back of this queue
+        // without blocking.  Return 0 on success, and a non-zero value if the
+        // queue is full or disabled.  The behavior is undefined unless this
+        // method is called by the producer.
+
+    bsl::size_t tryPushBack(const TYPE *values, bsl::size_t numValues);
+        // Append, in order and without blocking, as many of the specified
+        // 'numValues' elements of the array at the specified 'values' as
+        // there is space for to the back of this queue, and return the number
+        // of elements appended (0 if the queue is full or disabled).  The
+        // behavior is undefined unless this method is called by the producer.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the maximum number of elements that may be stored in this
+        // queue.
+
+    bool isEmpty() const;
+        // Return 'true' if this queue is empty (has no elements), and 'false'
+        // otherwise.
+
+    bool isEnabled() const;
+        // Return 'true' if this queue is enabled, and 'false' otherwise.  Note
+        // that the queue is created in the "enabled" state.
+
+    bool isFull() const;
+        // Return 'true' if this queue is full (when the number of elements
+        // currently in this queue equals its capacity), and 'false'
+        // otherwise.
+
+    int numElements() const;
+        // Return a snapshot of the number of elements currently in this
+        // queue.
+};
+
+         // =======================================================
+         // class SingleProducerSingleConsumerBoundedQueue_PopGuard
+         // =======================================================
+
+template <class TYPE>
+class SingleProducerSingleConsumerBoundedQueue_PopGuard {
+    // This component-private class provides a guard that, upon its
+    // destruction, releases to the producer the elements popped from the
+    // 'SingleProducerSingleConsumerBoundedQueue' object supplied at
+    // construction, i.e., the elements from the index at construction to the
+    // current index of the guard.  Note that this guard is used to provide
+    // exception safety when popping a batch of elements.
+
+    // DATA
+    SingleProducerSingleConsumerBoundedQueue<TYPE> *d_queue_p;  // held
+    int                                             d_index;    // index of
+                                                                // the next
+                                                                // element
+
+    // NOT IMPLEMENTED
+    SingleProducerSingleConsumerBoundedQueue_PopGuard(
+                     const SingleProducerSingleConsumerBoundedQueue_PopGuard&);
+    SingleProducerSingleConsumerBoundedQueue_PopGuard& operator=(
+                     const SingleProducerSingleConsumerBoundedQueue_PopGuard&);
+
+  public:
+    // CREATORS
+    SingleProducerSingleConsumerBoundedQueue_PopGuard(
+                       SingleProducerSingleConsumerBoundedQueue<TYPE> *queue,
+                       int                                             index);
+        // Create a guard for popping elements from the specified 'queue',
+        // from the element at the specified 'index'.
+
+    ~SingleProducerSingleConsumerBoundedQueue_PopGuard();
+        // Release to the producer of the queue supplied at construction the
+        // elements popped through this guard.
+
+    // MANIPULATORS
+    void popFront(TYPE *value);
+        // Load the value of the element at the index of this guard into the
+        // specified 'value', destroy that element, and advance the index of
+        // this guard.
+};
+
+         // ========================================================
+         // class SingleProducerSingleConsumerBoundedQueue_PushGuard
+         // ========================================================
+
+template <class TYPE>
+class SingleProducerSingleConsumerBoundedQueue_PushGuard {
+    // This component-private class provides a guard that, upon its
+    // destruction, publishes to the consumer the elements pushed into the
+    // 'SingleProducerSingleConsumerBoundedQueue' object supplied at
+    // construction, i.e., the elements from the index at construction to the
+    // current index of the guard.  Note that this guard is used to provide
+    // exception safety when pushing a batch of elements.
+
+    // DATA
+    SingleProducerSingleConsumerBoundedQueue<TYPE> *d_queue_p;  // held
+    int                                             d_index;    // index of
+                                                                // the next
+                                                                // element
+
+    // NOT IMPLEMENTED
+    SingleProducerSingleConsumerBoundedQueue_PushGuard(
+                    const SingleProducerSingleConsumerBoundedQueue_PushGuard&);
+    SingleProducerSingleConsumerBoundedQueue_PushGuard& operator=(
+                    const SingleProducerSingleConsumerBoundedQueue_PushGuard&);
+
+  public:
+    // CREATORS
+    SingleProducerSingleConsumerBoundedQueue_PushGuard(
+                       SingleProducerSingleConsumerBoundedQueue<TYPE> *queue,
+                       int                                             index);
+        // Create a guard for pushing elements into the specified 'queue',
+        // from the element at the specified 'index'.
+
+    ~SingleProducerSingleConsumerBoundedQueue_PushGuard();
+        // Publish to the consumer of the queue supplied at construction the
+        // elements pushed through this guard.
+
+    // MANIPULATORS
+    void pushBack(const TYPE& value);
+        // Construct a copy of the specified 'value' in the element at the
+        // index of this guard, and advance the index of this guard.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+            // ----------------------------------------------
+            // class SingleProducerSingleConsumerBoundedQueue
+            // ----------------------------------------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+inline
+int SingleProducerSingleConsumerBoundedQueue<TYPE>::numElementsToPop(
+                                                            int maxNumElements)
+{
+    const int popIndex = d_popIndex.loadRelaxed();
+
+    int numElements = numElementsBetween(popIndex, d_cachedPushIndex);
+    if (numElements < maxNumElements) {
+        d_cachedPushIndex = d_pushIndex.loadAcquire();
+        numElements       = numElementsBetween(popIndex, d_cachedPushIndex);
+    }
+    return numElements < maxNumElements ? numElements : maxNumElements;
+}
+
+template <class TYPE>
+inline
+int SingleProducerSingleConsumerBoundedQueue<TYPE>::numElementsToPush(
+                                                            int maxNumElements)
+{
+    const int pushIndex = d_pushIndex.loadRelaxed();
+
+    int numFree = d_size - 1 - numElementsBetween(d_cachedPopIndex, pushIndex);
+    if (numFree < maxNumElements) {
+        d_cachedPopIndex = d_popIndex.loadAcquire();
+        numFree = d_size - 1 - numElementsBetween(d_cachedPopIndex, pushIndex);
+    }
+    return numFree < maxNumElements ? numFree : maxNumElements;
+}
+
+template <class TYPE>
+inline
+void SingleProducerSingleConsumerBoundedQueue<TYPE>::publishPopIndex(int index)
+{
+    // SYNCHRONIZATION POINT 1
+    //
+    // 'd_popIndex' is stored, and 'd_pushWaiting' loaded, with sequential
+    // consistency, so that either the producer waiting in
+    // 'waitUntilNotFullOrDisabled' sees the new 'd_popIndex', or this thread
+    // sees the producer waiting and posts to 'd_pushSema'.
+
+    d_popIndex = index;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_pushWaiting)
+     && 1 == d_pushWaiting.testAndSwap(1, 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        d_pushSema.post();
+    }
+}
+
+template <class TYPE>
+inline
+void SingleProducerSingleConsumerBoundedQueue<TYPE>::publishPushIndex(
+                                                                     int index)
+{
+    // SYNCHRONIZATION POINT 2
+    //
+    // See SYNCHRONIZATION POINT 1.
+
+    d_pushIndex = index;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_popWaiting)
+     && 1 == d_popWaiting.testAndSwap(1, 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        d_popSema.post();
+    }
+}
+
+template <class TYPE>
+void SingleProducerSingleConsumerBoundedQueue<TYPE>::waitUntilNotEmpty()
+{
+    // SYNCHRONIZATION POINT 2-Prime
+    //
+    // 'd_popWaiting' is stored before 'isEmpty' loads 'd_pushIndex', both
+    // with sequential consistency.  The thread resetting 'd_popWaiting' to 0
+    // posts to 'd_popSema' exactly once: if it is not this thread, the post
+    // is consumed here even if the queue is no longer empty.
+
+    d_popWaiting = 1;
+
+    if (isEmpty()) {
+        d_popSema.wait();
+    }
+    else if (1 != d_popWaiting.testAndSwap(1, 0)) {
+        d_popSema.wait();
+    }
+}
+
+template <class TYPE>
+void
+SingleProducerSingleConsumerBoundedQueue<TYPE>::waitUntilNotFullOrDisabled()
+{
+    // SYNCHRONIZATION POINT 1-Prime
+    //
+    // See SYNCHRONIZATION POINT 2-Prime.
+
+    d_pushWaiting = 1;
+
+    if (isFull() && isEnabled()) {
+        d_pushSema.wait();
+    }
+    else if (1 != d_pushWaiting.testAndSwap(1, 0)) {
+        d_pushSema.wait();
+    }
+}
+
+// PRIVATE ACCESSORS
+template <class TYPE>
+inline
+int SingleProducerSingleConsumerBoundedQueue<TYPE>::nextIndex(int index) const
+{
+    return d_size - 1 == index ? 0 : index + 1;
+}
+
+template <class TYPE>
+inline
+int SingleProducerSingleConsumerBoundedQueue<TYPE>::numElementsBetween(
+                                                          int popIndex,
+                                                          int pushIndex) const
+{
+    return popIndex <= pushIndex ? pushIndex - popIndex
+                                 : pushIndex + d_size - popIndex;
+}
+
+// CREATORS
+template <class TYPE>
+SingleProducerSingleConsumerBoundedQueue<TYPE>::
+                                      SingleProducerSingleConsumerBoundedQueue(
+                                              bsl::size_t       capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_elements(0)
+, d_size(static_cast<int>(capacity) + 1)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_sharedPad()
+, d_pushIndex(0)
+, d_cachedPopIndex(0)
+, d_pushIndexPad()
+, d_popIndex(0)
+, d_cachedPushIndex(0)
+, d_popIndexPad()
+, d_popWaiting(0)
+, d_popSema(0)
+, d_popSemaPad()
+, d_pushWaiting(0)
+, d_pushSema(0)
+, d_disabled(0)
+{
+    BSLS_ASSERT(1 <= capacity);
+    BSLS_ASSERT(capacity < INT_MAX);
+
+    d_elements = static_cast<TYPE *>(
+                            d_allocator_p->allocate(d_size * sizeof(TYPE)));
+}
+
+template <class TYPE>
+SingleProducerSingleConsumerBoundedQueue<TYPE>::
+                                    ~SingleProducerSingleConsumerBoundedQueue()
+{
+    removeAll();
+    d_allocator_p->deallocate(d_elements);
+}
+
+// MANIPULATORS
+template <class TYPE>
+void SingleProducerSingleConsumerBoundedQueue<TYPE>::disable()
+{
+    d_disabled = 1;
+
+    if (1 == d_pushWaiting.testAndSwap(1, 0)) {
+        d_pushSema.post();
+    }
+}
+
+template <class TYPE>
+inline
+void SingleProducerSingleConsumerBoundedQueue<TYPE>::enable()
+{
+    d_disabled = 0;
+}
+
+template <class TYPE>
+inline
+void SingleProducerSingleConsumerBoundedQueue<TYPE>::popFront(TYPE *value)
+{
+    while (0 != tryPopFront(value)) {
+        waitUntilNotEmpty();
+    }
+}
+
+template <class TYPE>
+bsl::size_t SingleProducerSingleConsumerBoundedQueue<TYPE>::popFront(
+                                                  TYPE        *values,
+                                                  bsl::size_t  maxNumValues)
+{
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(1 <= maxNumValues);
+
+    bsl::size_t numPopped;
+    while (0 == (numPopped = tryPopFront(values, maxNumValues))) {
+        waitUntilNotEmpty();
+    }
+    return numPopped;
+}
+
+template <class TYPE>
+inline
+int SingleProducerSingleConsumerBoundedQueue<TYPE>::pushBack(const TYPE& value)
+{
+    int rc;
+    while (0 != (rc = tryPushBack(value))) {
+        if (!isEnabled()) {
+            return rc;                                                // RETURN
+        }
+        waitUntilNotFullOrDisabled();
+    }
+    return 0;
+}
+
+template <class TYPE>
+int SingleProducerSingleConsumerBoundedQueue<TYPE>::pushBack(
+                                                     const TYPE  *values,
+                                                     bsl::size_t  numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    while (0 < numValues) {
+        const bsl::size_t numPushed = tryPushBack(values, numValues);
+
+        if (0 == numPushed) {
+            if (!isEnabled()) {
+                return -1;                                            // RETURN
+            }
+            waitUntilNotFullOrDisabled();
+        }
+        values    += numPushed;
+        numValues -= numPushed;
+    }
+    return 0;
+}
+
+template <class TYPE>
+void SingleProducerSingleConsumerBoundedQueue<TYPE>::removeAll()
+{
+    const int pushIndex = d_pushIndex.loadAcquire();
+    int       index     = d_popIndex.loadRelaxed();
+
+    if (index == pushIndex) {
+        return;                                                       // RETURN
+    }
+
+    while (index != pushIndex) {
+        bslalg::ScalarDestructionPrimitives::destroy(d_elements + index);
+        index = nextIndex(index);
+    }
+
+    d_cachedPushIndex = pushIndex;
+    publishPopIndex(pushIndex);
+}
+
+template <class TYPE>
+inline
+int SingleProducerSingleConsumerBoundedQueue<TYPE>::tryPopFront(TYPE *value)
+{
+    BSLS_ASSERT(value);
+
+    if (0 == numElementsToPop(1)) {
+        return 1;                                                     // RETURN
+    }
+
+    const int index = d_popIndex.loadRelaxed();
+
+    *value = d_elements[index];
+    bslalg::ScalarDestructionPrimitives::destroy(d_elements + index);
+
+    publishPopIndex(nextIndex(index));
+    return 0;
+}
+
+template <class TYPE>
+bsl::size_t SingleProducerSingleConsumerBoundedQueue<TYPE>::tryPopFront(
+                                                  TYPE        *values,
+                                                  bsl::size_t  maxNumValues)
+{
+    BSLS_ASSERT(values || 0 == maxNumValues);
+
+    const int numElements = numElementsToPop(
+                      maxNumValues < static_cast<bsl::size_t>(d_size)
+                      ? static_cast<int>(maxNumValues)
+                      : d_size);
+    if (0 == numElements) {
+        return 0;                                                     // RETURN
+    }
+
+    PopGuard guard(this, d_popIndex.loadRelaxed());
+
+    for (int i = 0; i < numElements; ++i) {
+        guard.popFront(values + i);
+    }
+    return numElements;
+}
+
+template <class TYPE>
+inline
+int SingleProducerSingleConsumerBoundedQueue<TYPE>::tryPushBack(
+                                                             const TYPE& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_disabled.loadRelaxed())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return -1;                                                    // RETURN
+    }
+
+    if (0 == numElementsToPush(1)) {
+        return 1;                                                     // RETURN
+    }
+
+    const int index = d_pushIndex.loadRelaxed();
+
+    bslalg::ScalarPrimitives::copyConstruct(d_elements + index,
+                                            value,
+                                            d_allocator_p);
+
+    publishPushIndex(nextIndex(index));
+    return 0;
+}
+
+template <class TYPE>
+bsl::size_t SingleProducerSingleConsumerBoundedQueue<TYPE>::tryPushBack(
+                                                     const TYPE  *values,
+                                                     bsl::size_t  numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_disabled.loadRelaxed())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    const int numElements = numElementsToPush(
+                      numValues < static_cast<bsl::size_t>(d_size)
+                      ? static_cast<int>(numValues)
+                      : d_size);
+    if (0 == numElements) {
+        return 0;                                                     // RETURN
+    }
+
+    PushGuard guard(this, d_pushIndex.loadRelaxed());
+
+    for (int i = 0; i < numElements; ++i) {
+        guard.pushBack(values[i]);
+    }
+    return numElements;
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+int SingleProducerSingleConsumerBoundedQueue<TYPE>::capacity() const
+{
+    return d_size - 1;
+}
+
+template <class TYPE>
+inline
+bool SingleProducerSingleConsumerBoundedQueue<TYPE>::isEmpty() const
+{
+    return d_popIndex == d_pushIndex;
+}
+
+template <class TYPE>
+inline
+bool SingleProducerSingleConsumerBoundedQueue<TYPE>::isEnabled() const
+{
+    return 0 == d_disabled;
+}
+
+template <class TYPE>
+inline
+bool SingleProducerSingleConsumerBoundedQueue<TYPE>::isFull() const
+{
+    return nextIndex(d_pushIndex) == d_popIndex;
+}
+
+template <class TYPE>
+inline
+int SingleProducerSingleConsumerBoundedQueue<TYPE>::numElements() const
+{
+    const int popIndex = d_popIndex;
+    return numElementsBetween(popIndex, d_pushIndex);
+}
+
+         // -------------------------------------------------------
+         // class SingleProducerSingleConsumerBoundedQueue_PopGuard
+         // -------------------------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+SingleProducerSingleConsumerBoundedQueue_PopGuard<TYPE>::
+                             SingleProducerSingleConsumerBoundedQueue_PopGuard(
+                         SingleProducerSingleConsumerBoundedQueue<TYPE> *queue,
+                         int                                             index)
+: d_queue_p(queue)
+, d_index(index)
+{
+}
+
+template <class TYPE>
+inline
+SingleProducerSingleConsumerBoundedQueue_PopGuard<TYPE>::
+                           ~SingleProducerSingleConsumerBoundedQueue_PopGuard()
+{
+    d_queue_p->publishPopIndex(d_index);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void SingleProducerSingleConsumerBoundedQueue_PopGuard<TYPE>::popFront(
+                                                                   TYPE *value)
+{
+    *value = d_queue_p->d_elements[d_index];
+    bslalg::ScalarDestructionPrimitives::destroy(
+                                              d_queue_p->d_elements + d_index);
+    d_index = d_queue_p->nextIndex(d_index);
+}
+
+         // --------------------------------------------------------
+         // class SingleProducerSingleConsumerBoundedQueue_PushGuard
+         // --------------------------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+SingleProducerSingleConsumerBoundedQueue_PushGuard<TYPE>::
+                            SingleProducerSingleConsumerBoundedQueue_PushGuard(
+                         SingleProducerSingleConsumerBoundedQueue<TYPE> *queue,
+                         int                                             index)
+: d_queue_p(queue)
+, d_index(index)
+{
+}
+
+template <class TYPE>
+inline
+SingleProducerSingleConsumerBoundedQueue_PushGuard<TYPE>::
+                          ~SingleProducerSingleConsumerBoundedQueue_PushGuard()
+{
+    d_queue_p->publishPushIndex(d_index);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void SingleProducerSingleConsumerBoundedQueue_PushGuard<TYPE>::pushBack(
+                                                             const TYPE& value)
+{
+    bslalg::ScalarPrimitives::copyConstruct(d_queue_p->d_elements + d_index,
+                                            value,
+                                            d_queue_p->d_allocator_p);
+    d_index = d_queue_p->nextIndex(d_index);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
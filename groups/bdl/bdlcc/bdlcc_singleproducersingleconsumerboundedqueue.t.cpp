@@ -0,0 +1,788 @@
+// bdlcc_singleproducersingleconsumerboundedqueue.t.cpp               -*-C++-*-
+#include <bdlcc_singleproducersingleconsumerboundedqueue.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a lock-free ring buffer shared by one pushing
+// thread and one popping thread.  We verify, in a single thread, that values
+// are popped in the order they are pushed (individually and in batches,
+// including across the end of the ring buffer), that the queue reports being
+// full and empty correctly, that the elements are constructed with the
+// allocator of the queue and destroyed when popped, removed, or when the
+// queue is destroyed, and that a disabled queue rejects pushes.  We then
+// verify, with two threads, that the blocking methods transfer every value
+// exactly once and in order, for various capacities, and that 'disable'
+// releases a blocked producer.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] SingleProducerSingleConsumerBoundedQueue(size_t, Allocator *);
+// [ 2] ~SingleProducerSingleConsumerBoundedQueue();
+//
+// MANIPULATORS
+// [ 4] void disable();
+// [ 4] void enable();
+// [ 5] void popFront(TYPE *value);
+// [ 5] size_t popFront(TYPE *values, size_t maxNumValues);
+// [ 5] int pushBack(const TYPE& value);
+// [ 5] int pushBack(const TYPE *values, size_t numValues);
+// [ 2] void removeAll();
+// [ 2] int tryPopFront(TYPE *value);
+// [ 3] size_t tryPopFront(TYPE *values, size_t maxNumValues);
+// [ 2] int tryPushBack(const TYPE& value);
+// [ 3] size_t tryPushBack(const TYPE *values, size_t numValues);
+//
+// ACCESSORS
+// [ 2] int capacity() const;
+// [ 2] bool isEmpty() const;
+// [ 4] bool isEnabled() const;
+// [ 2] bool isFull() const;
+// [ 2] int numElements() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::SingleProducerSingleConsumerBoundedQueue<int>         Obj;
+typedef bdlcc::SingleProducerSingleConsumerBoundedQueue<bsl::string> StrObj;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+void produceSequence(Obj *queue, int numValues, int batchSize)
+    // Push into the specified 'queue' the values from 0 to the specified
+    // 'numValues' (excluded), in batches of the specified 'batchSize' values,
+    // or one at a time if 'batchSize' is 1.
+{
+    bsl::vector<int> values(batchSize);
+
+    for (int i = 0; i < numValues; i += batchSize) {
+        const int n = bsl::min(batchSize, numValues - i);
+
+        if (1 == n) {
+            ASSERT(0 == queue->pushBack(i));
+            continue;
+        }
+        for (int j = 0; j < n; ++j) {
+            values[j] = i + j;
+        }
+        ASSERT(0 == queue->pushBack(values.data(), n));
+    }
+}
+
+void consumeSequence(Obj             *queue,
+                     int              numValues,
+                     int              batchSize,
+                     bsls::AtomicInt *numErrors)
+    // Pop from the specified 'queue' the specified 'numValues' values, in
+    // batches of at most the specified 'batchSize' values, or one at a time
+    // if 'batchSize' is 1, and increment the specified 'numErrors' for each
+    // value that does not follow the previous one.
+{
+    bsl::vector<int> values(batchSize);
+
+    int expected = 0;
+    while (expected < numValues) {
+        if (1 == batchSize) {
+            int value;
+            queue->popFront(&value);
+            if (expected != value) {
+                ++*numErrors;
+            }
+            ++expected;
+            continue;
+        }
+
+        const bsl::size_t n = queue->popFront(values.data(), batchSize);
+        ASSERT(1 <= n && n <= static_cast<bsl::size_t>(batchSize));
+
+        for (bsl::size_t j = 0; j < n; ++j, ++expected) {
+            if (expected != values[j]) {
+                ++*numErrors;
+            }
+        }
+    }
+}
+
+void disableAfterDelay(Obj *queue, int milliseconds)
+    // Sleep for the specified 'milliseconds', and then disable the specified
+    // 'queue'.
+{
+    bslmt::ThreadUtil::microSleep(milliseconds * 1000);
+    queue->disable();
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Two-Stage Pipeline
+///- - - - - - - - - - - - - - - -
+// In this example, a thread reading messages hands them off to a thread
+// processing them, through a 'bdlcc::SingleProducerSingleConsumerBoundedQueue'
+// of integers, where the value -1 signals the end of the messages.
+//
+// First, we define the function of the consumer thread, which pops up to 16
+// values at a time, waiting as needed, and adds them until it pops -1:
+//..
+    void consume(bdlcc::SingleProducerSingleConsumerBoundedQueue<int> *queue,
+                 bsls::Types::Int64                                   *sum)
+    {
+        int values[16];
+
+        for (;;) {
+            bsl::size_t numValues = queue->popFront(values, 16);
+
+            for (bsl::size_t i = 0; i < numValues; ++i) {
+                if (-1 == values[i]) {
+                    return;                                           // RETURN
+                }
+                *sum += values[i];
+            }
+        }
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create a queue having a capacity of 256 values, and start the
+// consumer thread:
+//..
+    bdlcc::SingleProducerSingleConsumerBoundedQueue<int> queue(256);
+
+    bsls::Types::Int64        sum = 0;
+    bslmt::ThreadUtil::Handle handle;
+
+    int rc = bslmt::ThreadUtil::create(&handle,
+                                       bdlf::BindUtil::bind(&consume,
+                                                            &queue,
+                                                            &sum));
+    ASSERT(0 == rc);
+//..
+// Next, the producer (i.e., the current thread) pushes the values, one at a
+// time, which blocks when the consumer lags behind by 256 values:
+//..
+    for (int i = 0; i < 10000; ++i) {
+        rc = queue.pushBack(i);
+        ASSERT(0 == rc);
+    }
+//..
+// Finally, we push the value ending the messages, wait for the consumer
+// thread to complete, and check the result:
+//..
+    rc = queue.pushBack(-1);
+    ASSERT(0 == rc);
+
+    bslmt::ThreadUtil::join(handle);
+    ASSERT(10000 * 9999 / 2 == sum);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENT PUSHING AND POPPING
+        //
+        // Concerns:
+        //: 1 Every value pushed by the producer is popped exactly once by the
+        //:   consumer, in order, whether the values are pushed and popped
+        //:   individually or in batches.
+        //:
+        //: 2 The producer blocks while the queue is full, and the consumer
+        //:   blocks while the queue is empty, without missing a wake-up.
+        //
+        // Plan:
+        //: 1 For capacities from 1 to 1024, and for several combinations of
+        //:   batch sizes (including 1, to use the single-value methods), push
+        //:   a sequence of integers from one thread, and pop them from
+        //:   another, verifying their order.  Small capacities force both
+        //:   threads to block frequently.  (C-1..2)
+        //
+        // Testing:
+        //   void popFront(TYPE *value);
+        //   size_t popFront(TYPE *values, size_t maxNumValues);
+        //   int pushBack(const TYPE& value);
+        //   int pushBack(const TYPE *values, size_t numValues);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT PUSHING AND POPPING" << endl
+                          << "==============================" << endl;
+
+        const int NUM_VALUES   = 200000;
+        const int CAPACITIES[] = { 1, 2, 7, 64, 1024 };
+        const int BATCHES[][2] = { { 1, 1 }, { 1, 16 }, { 5, 1 }, { 100, 3 } };
+
+        const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+        const int NUM_BATCHES    = sizeof BATCHES    / sizeof *BATCHES;
+
+        for (int ci = 0; ci < NUM_CAPACITIES; ++ci) {
+            for (int bi = 0; bi < NUM_BATCHES; ++bi) {
+                const int CAPACITY   = CAPACITIES[ci];
+                const int PUSH_BATCH = BATCHES[bi][0];
+                const int POP_BATCH  = BATCHES[bi][1];
+
+                if (veryVerbose) {
+                    P_(CAPACITY) P_(PUSH_BATCH) P(POP_BATCH)
+                }
+
+                bslma::TestAllocator ta("object", veryVeryVerbose);
+
+                Obj             mX(CAPACITY, &ta);  const Obj& X = mX;
+                bsls::AtomicInt numErrors(0);
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                   &handle,
+                                   bdlf::BindUtil::bind(&consumeSequence,
+                                                        &mX,
+                                                        NUM_VALUES,
+                                                        POP_BATCH,
+                                                        &numErrors)));
+
+                produceSequence(&mX, NUM_VALUES, PUSH_BATCH);
+
+                bslmt::ThreadUtil::join(handle);
+
+                ASSERTV(CAPACITY, PUSH_BATCH, POP_BATCH, numErrors,
+                        0 == numErrors);
+                ASSERT(X.isEmpty());
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'disable' AND 'enable'
+        //
+        // Concerns:
+        //: 1 A disabled queue rejects all pushes, and still allows pops.
+        //:
+        //: 2 'disable' releases a producer blocked in 'pushBack'.
+        //:
+        //: 3 An enabled queue accepts pushes again.
+        //
+        // Plan:
+        //: 1 Disable a queue holding one element, verify that all the methods
+        //:   pushing elements fail, and that the element can be popped.  Then
+        //:   enable it, and verify that elements can be pushed.  (C-1, 3)
+        //:
+        //: 2 Fill a queue, and call 'pushBack' while another thread disables
+        //:   the queue after a delay: verify that 'pushBack', and then the
+        //:   batch 'pushBack', return a non-zero value.  (C-2)
+        //
+        // Testing:
+        //   void disable();
+        //   void enable();
+        //   bool isEnabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'disable' AND 'enable'" << endl
+                          << "======================" << endl;
+
+        const int VALUES[] = { 1, 2, 3 };
+
+        {
+            Obj mX(4);  const Obj& X = mX;
+
+            ASSERT(X.isEnabled());
+            ASSERT(0 == mX.tryPushBack(7));
+
+            mX.disable();
+            ASSERT(!X.isEnabled());
+
+            mX.disable();
+            ASSERT(!X.isEnabled());
+
+            ASSERT(0 != mX.tryPushBack(8));
+            ASSERT(0 != mX.pushBack(8));
+            ASSERT(0 == mX.tryPushBack(VALUES, 3));
+            ASSERT(0 != mX.pushBack(VALUES, 3));
+            ASSERT(1 == X.numElements());
+
+            int value = 0;
+            ASSERT(0 == mX.tryPopFront(&value));
+            ASSERT(7 == value);
+
+            mX.enable();
+            ASSERT(X.isEnabled());
+
+            ASSERT(0 == mX.pushBack(VALUES, 3));
+            ASSERT(3 == X.numElements());
+        }
+
+        if (verbose) cout << "\tReleasing a blocked producer." << endl;
+        {
+            Obj mX(2);  const Obj& X = mX;
+
+            ASSERT(0 == mX.pushBack(VALUES, 2));
+            ASSERT(X.isFull());
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                   &handle,
+                                   bdlf::BindUtil::bind(&disableAfterDelay,
+                                                        &mX,
+                                                        100)));
+
+            ASSERT(0 != mX.pushBack(3));
+            ASSERT(0 != mX.pushBack(VALUES, 3));
+
+            bslmt::ThreadUtil::join(handle);
+
+            ASSERT(!X.isEnabled());
+            ASSERT(2 == X.numElements());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // BATCH 'tryPushBack' AND 'tryPopFront'
+        //
+        // Concerns:
+        //: 1 The batch methods push and pop as many values as there is space
+        //:   for (or as there are values), in order, and return that number.
+        //:
+        //: 2 Batches wrapping around the end of the ring buffer are handled.
+        //:
+        //: 3 Batches and single values can be mixed.
+        //:
+        //: 4 Empty batches have no effect.
+        //
+        // Plan:
+        //: 1 For several capacities and batch sizes, repeatedly push batches
+        //:   of consecutive integers with 'tryPushBack', and pop them in
+        //:   batches of another size with 'tryPopFront', so that the indices
+        //:   wrap around the ring buffer, and verify the number of values
+        //:   transferred by each call against a model, and the order of the
+        //:   values.  (C-1..2)
+        //:
+        //: 2 Push values in a batch, and pop them individually, and
+        //:   conversely.  (C-3)
+        //:
+        //: 3 Push and pop empty batches.  (C-4)
+        //
+        // Testing:
+        //   size_t tryPopFront(TYPE *values, size_t maxNumValues);
+        //   size_t tryPushBack(const TYPE *values, size_t numValues);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH 'tryPushBack' AND 'tryPopFront'" << endl
+                          << "=====================================" << endl;
+
+        for (int capacity = 1; capacity <= 9; ++capacity) {
+            for (int pushSize = 1; pushSize <= 12; ++pushSize) {
+                for (int popSize = 1; popSize <= 12; ++popSize) {
+                    Obj mX(capacity);  const Obj& X = mX;
+
+                    int values[12];
+                    int next     = 0;  // next value to push
+                    int expected = 0;  // next value to pop
+
+                    for (int round = 0; round < 3 * capacity; ++round) {
+                        for (int i = 0; i < pushSize; ++i) {
+                            values[i] = next + i;
+                        }
+
+                        const int numBefore = X.numElements();
+                        const int numPushed = static_cast<int>(
+                                              mX.tryPushBack(values,
+                                                             pushSize));
+                        ASSERTV(capacity, pushSize, popSize, round,
+                                bsl::min(pushSize, capacity - numBefore)
+                                                               == numPushed);
+                        next += numPushed;
+
+                        const int numPopped = static_cast<int>(
+                                              mX.tryPopFront(values,
+                                                             popSize));
+                        ASSERTV(capacity, pushSize, popSize, round,
+                                bsl::min(popSize, numBefore + numPushed)
+                                                               == numPopped);
+
+                        for (int i = 0; i < numPopped; ++i, ++expected) {
+                            ASSERTV(capacity, pushSize, popSize, round, i,
+                                    expected == values[i]);
+                        }
+                        ASSERTV(next - expected == X.numElements());
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tMixing batches and single values." << endl;
+        {
+            const int VALUES[] = { 1, 2, 3, 4, 5 };
+
+            Obj mX(5);  const Obj& X = mX;
+
+            ASSERT(5 == mX.tryPushBack(VALUES, 5));
+            ASSERT(X.isFull());
+
+            for (int i = 0; i < 5; ++i) {
+                int value = 0;
+                ASSERT(0 == mX.tryPopFront(&value));
+                ASSERTV(i, value, VALUES[i] == value);
+            }
+            ASSERT(X.isEmpty());
+
+            for (int i = 0; i < 5; ++i) {
+                ASSERT(0 == mX.tryPushBack(VALUES[i]));
+            }
+
+            int values[5] = { 0 };
+            ASSERT(5 == mX.tryPopFront(values, 5));
+            for (int i = 0; i < 5; ++i) {
+                ASSERTV(i, VALUES[i] == values[i]);
+            }
+
+            ASSERT(0 == mX.tryPushBack(VALUES, 0));
+            ASSERT(0 == mX.tryPopFront(values, 0));
+            ASSERT(0 == mX.tryPopFront(values, 5));
+            ASSERT(X.isEmpty());
+        }
+
+        if (verbose) cout << "\tAllocator propagation in batches." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                const bsl::string VALUES[] = {
+                    "a string long enough to allocate memory, number 1",
+                    "a string long enough to allocate memory, number 2",
+                    "a string long enough to allocate memory, number 3"
+                };
+
+                StrObj mX(2, &ta);
+
+                ASSERT(2 == mX.tryPushBack(VALUES, 3));
+
+                const bsls::Types::Int64 numBlocks = ta.numBlocksInUse();
+                ASSERT(3 == numBlocks);  // the ring buffer and two strings
+
+                bsl::string values[2];
+                ASSERT(2 == mX.tryPopFront(values, 2));
+                ASSERT(VALUES[0] == values[0]);
+                ASSERT(VALUES[1] == values[1]);
+                ASSERT(1 == ta.numBlocksInUse());
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SINGLE-VALUE 'tryPushBack' AND 'tryPopFront'
+        //
+        // Concerns:
+        //: 1 Values are popped in the order they are pushed, including when
+        //:   the indices wrap around the ring buffer.
+        //:
+        //: 2 The queue holds exactly 'capacity()' values: 'tryPushBack' fails
+        //:   on a full queue, and 'tryPopFront' fails on an empty queue
+        //:   without modifying its argument.
+        //:
+        //: 3 'numElements', 'isEmpty', and 'isFull' reflect the state of the
+        //:   queue.
+        //:
+        //: 4 The elements are copies constructed with the allocator of the
+        //:   queue, which are destroyed when popped, by 'removeAll', and by
+        //:   the destructor.
+        //
+        // Plan:
+        //: 1 For capacities from 1 to 10, fill the queue, checking the
+        //:   accessors at each step, then alternately pop and push values for
+        //:   several times the capacity, and finally empty the queue.
+        //:   (C-1..3)
+        //:
+        //: 2 Push strings allocating memory into a queue using a test
+        //:   allocator, and verify the memory in use after pushing, popping,
+        //:   'removeAll', and destroying the queue.  (C-4)
+        //
+        // Testing:
+        //   SingleProducerSingleConsumerBoundedQueue(size_t, Allocator *);
+        //   ~SingleProducerSingleConsumerBoundedQueue();
+        //   void removeAll();
+        //   int tryPopFront(TYPE *value);
+        //   int tryPushBack(const TYPE& value);
+        //   int capacity() const;
+        //   bool isEmpty() const;
+        //   bool isFull() const;
+        //   int numElements() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SINGLE-VALUE 'tryPushBack' AND 'tryPopFront'"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        for (int capacity = 1; capacity <= 10; ++capacity) {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+
+            Obj mX(capacity, &ta);  const Obj& X = mX;
+
+            ASSERTV(capacity, capacity == X.capacity());
+            ASSERTV(capacity, X.isEmpty());
+            ASSERTV(capacity, !X.isFull());
+            ASSERTV(capacity, 0 == X.numElements());
+
+            int next     = 0;
+            int expected = 0;
+
+            for (int i = 0; i < capacity; ++i) {
+                ASSERTV(capacity, i, 0 == mX.tryPushBack(next++));
+                ASSERTV(capacity, i, !X.isEmpty());
+                ASSERTV(capacity, i, i + 1 == X.numElements());
+            }
+            ASSERTV(capacity, X.isFull());
+            ASSERTV(capacity, 0 != mX.tryPushBack(next));
+            ASSERTV(capacity, capacity == X.numElements());
+
+            for (int i = 0; i < 3 * capacity; ++i) {
+                int value = -1;
+                ASSERTV(capacity, i, 0 == mX.tryPopFront(&value));
+                ASSERTV(capacity, i, value, expected++ == value);
+                ASSERTV(capacity, i, !X.isFull());
+
+                ASSERTV(capacity, i, 0 == mX.tryPushBack(next++));
+                ASSERTV(capacity, i, X.isFull());
+            }
+
+            for (int i = 0; i < capacity; ++i) {
+                int value = -1;
+                ASSERTV(capacity, i, 0 == mX.tryPopFront(&value));
+                ASSERTV(capacity, i, value, expected++ == value);
+                ASSERTV(capacity, i, capacity - i - 1 == X.numElements());
+            }
+            ASSERTV(capacity, X.isEmpty());
+
+            int value = -1;
+            ASSERTV(capacity, 0 != mX.tryPopFront(&value));
+            ASSERTV(capacity, -1 == value);
+
+            ASSERTV(capacity, 1 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tElement lifetime." << endl;
+        {
+            const char *LONG = "a string long enough to allocate memory";
+
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                StrObj mX(3, &ta);  const StrObj& X = mX;
+
+                ASSERT(1 == ta.numBlocksInUse());
+
+                const bsl::string value(LONG);
+                ASSERT(0 == mX.tryPushBack(value));
+                ASSERT(0 == mX.tryPushBack(value));
+                ASSERT(3 == ta.numBlocksInUse());
+
+                bsl::string result;
+                ASSERT(0 == mX.tryPopFront(&result));
+                ASSERT(LONG == result);
+                ASSERT(2 == ta.numBlocksInUse());
+
+                mX.removeAll();
+                ASSERT(X.isEmpty());
+                ASSERT(1 == ta.numBlocksInUse());
+
+                mX.removeAll();
+                ASSERT(X.isEmpty());
+
+                ASSERT(0 == mX.tryPushBack(value));
+                ASSERT(0 == mX.tryPushBack(value));
+                ASSERT(0 == mX.tryPushBack(value));
+                ASSERT(X.isFull());
+                ASSERT(4 == ta.numBlocksInUse());
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Push values into a queue, and pop them, individually and in
+        //:   batches.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(4);  const Obj& X = mX;
+
+        ASSERT(4 == X.capacity());
+        ASSERT(X.isEmpty());
+
+        ASSERT(0 == mX.pushBack(1));
+        ASSERT(0 == mX.tryPushBack(2));
+        ASSERT(2 == X.numElements());
+
+        int value;
+        mX.popFront(&value);
+        ASSERT(1 == value);
+        ASSERT(0 == mX.tryPopFront(&value));
+        ASSERT(2 == value);
+        ASSERT(X.isEmpty());
+
+        const int VALUES[] = { 3, 4, 5, 6, 7 };
+        ASSERT(4 == mX.tryPushBack(VALUES, 5));
+        ASSERT(X.isFull());
+
+        int values[5];
+        ASSERT(4 == mX.popFront(values, 5));
+        ASSERT(3 == values[0]);
+        ASSERT(6 == values[3]);
+        ASSERT(X.isEmpty());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
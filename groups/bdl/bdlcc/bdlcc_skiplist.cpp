@@ -15,6 +15,8 @@ BSLS_IDENT_RCSID(bdlcc_skiplist_cpp,"$Id$ $CSID$")
 #include <bdlma_infrequentdeleteblocklist.h>
 #include <bdlb_random.h>
 
+#include <bslmt_threadutil.h>
+
 #include <bslma_allocator.h>
 #include <bslmf_assert.h>
 #include <bsls_assert.h>
@@ -98,6 +100,24 @@ int SkipList_Control::decrementRefCount()
     return newBits & k_REF_COUNT_MASK;
 }
 
+int SkipList_Control::tryIncrementRefCount()
+{
+    int oldBits = d_cw;
+
+    while (oldBits & k_REF_COUNT_MASK) {
+        BSLS_ASSERT((oldBits & k_REF_COUNT_MASK) != k_REF_COUNT_MASK);
+
+        const int newBits = oldBits + k_REF_COUNT_INC;
+        const int result  = d_cw.testAndSwap(oldBits, newBits);
+        if (result == oldBits) {
+            return newBits & k_REF_COUNT_MASK;                        // RETURN
+        }
+        oldBits = result;
+    }
+
+    return 0;
+}
+
 // ACCESSORS
 int SkipList_Control::level() const
 {
@@ -145,6 +165,91 @@ int SkipList_RandomLevelGenerator::randomLevel()
     return level > k_MAX_LEVEL ? k_MAX_LEVEL : level;
 }
 
+                        // ===========================
+                        // class SkipList_EpochManager
+                        // ===========================
+
+// CLASS METHODS
+int SkipList_EpochManager::slot(bsls::Types::Int64 epoch)
+{
+    BSLMF_ASSERT(0 == (k_NUM_EPOCHS & (k_NUM_EPOCHS - 1)));
+
+    return static_cast<int>(epoch & (k_NUM_EPOCHS - 1));
+}
+
+// CREATORS
+SkipList_EpochManager::SkipList_EpochManager()
+: d_epoch(0)
+, d_exclusiveFlag(0)
+{
+}
+
+// MANIPULATORS
+bsls::Types::Int64 SkipList_EpochManager::enter()
+{
+    for (;;) {
+        while (d_exclusiveFlag.loadAcquire()) {
+            bslmt::ThreadUtil::yield();
+        }
+
+        const bsls::Types::Int64  epoch     = d_epoch.load();
+        bsls::AtomicInt&          numActive = d_numActive[slot(epoch)];
+
+        ++numActive;
+
+        // Having announced ourselves in 'epoch', confirm that neither 'lock'
+        // nor an advance of the epoch raced with the announcement.
+
+        if (0 == d_exclusiveFlag.load() && epoch == d_epoch.load()) {
+            return epoch;                                             // RETURN
+        }
+
+        --numActive;
+    }
+}
+
+void SkipList_EpochManager::leave(bsls::Types::Int64 epoch)
+{
+    const int numActive = --d_numActive[slot(epoch)];
+
+    BSLS_ASSERT(0 <= numActive);
+    (void) numActive;    // suppress 'unused variable' warnings
+}
+
+void SkipList_EpochManager::lock()
+{
+    while (0 != d_exclusiveFlag.testAndSwap(0, 1)) {
+        bslmt::ThreadUtil::yield();
+    }
+
+    for (int i = 0; i < k_NUM_EPOCHS; ++i) {
+        while (d_numActive[i].load()) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+}
+
+int SkipList_EpochManager::tryAdvance(bsls::Types::Int64 epoch)
+{
+    // The caller is in 'epoch', so the epoch cannot advance beyond
+    // 'epoch + 1' until the caller leaves.  Once no thread remains in
+    // 'epoch - 1', every thread is in 'epoch' (or later), and nodes retired in
+    // 'epoch - 2' can no longer be observed by any thread.
+
+    if (epoch != d_epoch.load()
+     || 0 != d_numActive[slot(epoch - 1)].load()
+     || epoch != d_epoch.testAndSwap(epoch, epoch + 1)) {
+        return -1;                                                    // RETURN
+    }
+
+    return slot(epoch - 2);
+}
+
+void SkipList_EpochManager::unlock()
+{
+    d_exclusiveFlag.storeRelease(0);
+}
+
 }  // close package namespace
 
                         // ============================
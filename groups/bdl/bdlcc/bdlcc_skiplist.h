@@ -21,6 +21,7 @@ BSLS_IDENT("$Id: $")
 //  bdlcc::SkipList:           generic thread-aware ordered map
 //  bdlcc::SkipListPair:       type for opaque pointers
 //  bdlcc::SkipListPairHandle: scope mechanism for safe item references
+//  bdlcc::SkipListMode:       namespace for synchronization modes of a list
 //
 //@SEE_ALSO:
 //
@@ -128,6 +129,37 @@ BSLS_IDENT("$Id: $")
 // 'bdlcc::SkipListPair' is a name used for opaque pointers; the concept of
 // thread safety does not apply to it.
 //
+///Lock-Free Mode
+///--------------
+// By default, a 'bdlcc::SkipList' serializes all operations with a single
+// mutex.  A list constructed with 'bdlcc::SkipListMode::e_LOCK_FREE' instead
+// links its pairs with atomically-updated "marked" pointers: a pair is removed
+// by first setting the low-order "removed" bit of its forward links (top level
+// first), and is then unlinked by any thread whose search passes it.  In this
+// mode 'add', 'addUnique', 'remove', 'popFront', 'find', 'exists', and the
+// forward-iteration methods proceed concurrently without acquiring any lock,
+// so that many threads may add pairs to (or remove pairs from) the same list
+// without being serialized.  Memory for removed pairs is reclaimed only after
+// every thread that may have observed the pair has completed its operation.
+//
+// The interface and the 'bdlcc::SkipListPairHandle' reference semantics are
+// the same in both modes, with the following differences in a lock-free list:
+//
+//: o 'update' and 'updateR' wait for all concurrent operations on the list to
+//:   complete, and exclude new ones while the pair is moved.
+//:
+//: o Nodes have no backward links; 'back', 'previous', and 'skipBackward'
+//:   perform an O(log n) search rather than a constant-time step, and the "R"
+//:   methods search from the front of the list.
+//:
+//: o 'popFront' removes a pair that was at the front of the list at some point
+//:   during the call, and 'removeAll' removes pairs one at a time, so pairs
+//:   added concurrently with 'removeAll' may remain in the list.
+//:
+//: o 'length', 'print', 'operator==', and the copy constructor and assignment
+//:   operator (reading the source list) do not observe a snapshot of the list
+//:   if it is being modified concurrently.
+//
 ///Exception Safety
 ///----------------
 // 'bdlcc::SkipList' is exception-neutral: no method invokes 'throw' or
@@ -384,6 +416,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_assert.h>
 #endif
 
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
 #ifndef INCLUDED_BSL_OSTREAM
 #include <bsl_ostream.h>
 #endif
@@ -438,6 +474,13 @@ struct SkipList_Control {
         // Return the new reference count.  The behavior is undefined if the
         // reference count is 0.
 
+    int tryIncrementRefCount();
+        // Add 1 to the reference count portion of this control word unless
+        // the reference count is 0.  Return the new reference count, or 0
+        // (with no effect) if the reference count was 0.  The behavior is
+        // undefined if the reference count is at the implementation-defined
+        // maximum.
+
     // ACCESSORS
     int level() const;
         // Return the level stored in this control word.
@@ -456,8 +499,12 @@ struct SkipList_Node {
     typedef SkipList_Node<KEY, DATA> Node;
 
     struct Ptrs {
-        Node *d_next_p;
-        Node *d_prev_p;
+        bsls::AtomicPointer<Node>  d_next_p;  // in a lock-free list, the low
+                                              // bit is the "removed" mark
+
+        Node                      *d_prev_p;  // unused in a lock-free list,
+                                              // except at level 0 to link
+                                              // nodes awaiting reclamation
     };
 
     // DATA
@@ -475,6 +522,7 @@ struct SkipList_Node {
 
     int incrementRefCount();
     int decrementRefCount();
+    int tryIncrementRefCount();
 
     // ACCESSORS
     int level() const;
@@ -512,6 +560,75 @@ class SkipList_RandomLevelGenerator {
         // Return a random integer between 0 and k_MAX_LEVEL.
 };
 
+                    // =================================
+                    // local class SkipList_EpochManager
+                    // =================================
+
+class SkipList_EpochManager {
+    // This component-private class tracks the threads operating on a
+    // lock-free list, so that a node unlinked from the list is reclaimed only
+    // after every thread that may have observed it has left the list.  A
+    // thread "enters" the current epoch before reading the links of a
+    // lock-free list, and "leaves" it afterwards; nodes retired by a thread in
+    // epoch 'e' may be reclaimed once the global epoch has advanced past
+    // 'e + 2'.  The epoch may advance only when no thread remains in the
+    // previous epoch.  In addition, 'lock' provides exclusive access to the
+    // list, excluding all threads from entering an epoch.
+
+  public:
+    // TYPES
+    enum {
+        k_NUM_EPOCHS = 4  // number of distinct epoch slots
+    };
+
+  private:
+    // DATA
+    bsls::AtomicInt64 d_epoch;                    // global epoch
+
+    bsls::AtomicInt   d_numActive[k_NUM_EPOCHS];  // number of threads in each
+                                                  // epoch slot
+
+    bsls::AtomicInt   d_exclusiveFlag;            // 1 if 'lock' is in effect
+
+    // NOT IMPLEMENTED
+    SkipList_EpochManager(const SkipList_EpochManager&);
+    SkipList_EpochManager& operator=(const SkipList_EpochManager&);
+
+  public:
+    // CLASS METHODS
+    static int slot(bsls::Types::Int64 epoch);
+        // Return the slot in '[0 .. k_NUM_EPOCHS - 1]' of the specified
+        // 'epoch'.
+
+    // CREATORS
+    SkipList_EpochManager();
+        // Create an epoch manager in epoch 0 with no threads in any epoch.
+
+    // MANIPULATORS
+    bsls::Types::Int64 enter();
+        // Enter the current epoch, waiting while 'lock' is in effect, and
+        // return that epoch.
+
+    void leave(bsls::Types::Int64 epoch);
+        // Leave the specified 'epoch'.  The behavior is undefined unless
+        // 'epoch' was returned by a matching call to 'enter'.
+
+    void lock();
+        // Wait until no thread is in any epoch, and exclude threads from
+        // entering an epoch until 'unlock' is called.
+
+    int tryAdvance(bsls::Types::Int64 epoch);
+        // Advance the global epoch if it is the specified 'epoch' and no
+        // thread remains in the epoch before 'epoch'.  Return the slot of the
+        // nodes that may be reclaimed as a result, or a negative value if the
+        // epoch was not advanced.  The behavior is undefined unless the
+        // calling thread entered 'epoch' and has not yet left it.  Note that
+        // the slot must be emptied before the calling thread leaves 'epoch'.
+
+    void unlock();
+        // Release the exclusive access acquired by 'lock'.
+};
+
 }  // close package namespace
 
                     // ====================================
@@ -601,6 +718,22 @@ class SkipList_NodeCreationHelper {
         // already been invoked on this scoped guard object.
 };
 
+                             // ===================
+                             // struct SkipListMode
+                             // ===================
+
+struct SkipListMode {
+    // This 'struct' provides a namespace for enumerating the synchronization
+    // modes of a 'SkipList'.  See the component-level documentation for
+    // details.
+
+    // TYPES
+    enum Enum {
+        e_LOCKED,     // operations are serialized by a mutex
+        e_LOCK_FREE   // operations use atomic updates of marked links
+    };
+};
+
                              // ==================
                              // class SkipListPair
                              // ==================
@@ -718,6 +851,41 @@ class SkipListPairHandle {
         // reference.
 };
 
+                         // ==========================
+                         // local class SkipList_Guard
+                         // ==========================
+
+template <class KEY, class DATA>
+class SkipList_Guard {
+    // This component-private class is a scoped guard that, for a list in
+    // 'SkipListMode::e_LOCKED' mode, acquires the mutex of the list, and for a
+    // list in 'SkipListMode::e_LOCK_FREE' mode, enters the current epoch of
+    // the list, for the lifetime of the guard.
+
+    // DATA
+    const SkipList<KEY, DATA> *d_list_p;  // guarded list (held)
+
+    bsls::Types::Int64         d_epoch;   // entered epoch (lock-free only)
+
+    // NOT IMPLEMENTED
+    SkipList_Guard(const SkipList_Guard&);
+    SkipList_Guard& operator=(const SkipList_Guard&);
+
+  public:
+    // CREATORS
+    explicit SkipList_Guard(const SkipList<KEY, DATA> *list);
+        // Create a guard for the specified 'list', and acquire the mutex of
+        // 'list' or enter its current epoch, according to the mode of 'list'.
+
+    ~SkipList_Guard();
+        // Release the mutex of, or leave the epoch of, the guarded list.
+
+    // ACCESSORS
+    bsls::Types::Int64 epoch() const;
+        // Return the epoch entered by this guard.  The behavior is undefined
+        // unless the guarded list is in 'SkipListMode::e_LOCK_FREE' mode.
+};
+
                                // ==============
                                // class SkipList
                                // ==============
@@ -763,6 +931,9 @@ class SkipList {
     typedef bslmt::Mutex                        Lock;
     typedef bslmt::LockGuard<bslmt::Mutex>       LockGuard;
 
+    typedef SkipList_Guard<KEY, DATA>          ListGuard;
+    typedef SkipList_EpochManager              EpochManager;
+
     // DATA
     SkipList_RandomLevelGenerator         d_rand;
 
@@ -772,7 +943,18 @@ class SkipList {
 
     mutable Lock                               d_lock;
 
-    int                                        d_length;
+    bsls::AtomicInt                            d_length;
+
+    SkipListMode::Enum                         d_mode;
+
+    mutable EpochManager                       d_epochManager;
+                                               // lock-free mode only
+
+    mutable bsls::AtomicPointer<Node>          d_retired[
+                                                  EpochManager::k_NUM_EPOCHS];
+                                               // nodes awaiting reclamation,
+                                               // by epoch slot; lock-free
+                                               // mode only
 
     PoolManager                               *d_poolManager_p; // owned
 
@@ -793,6 +975,19 @@ class SkipList {
         // 'newFrontFlag' is not 0, load into it a 'true' value if the node is
         // at the front of the list, and a 'false' value otherwise.
 
+    int addNodeLockFree(bool *newFrontFlag,
+                        Node *newNode,
+                        bool  afterEqualKeys,
+                        bool  unique);
+        // Add the specified 'newNode' to this lock-free list, before any nodes
+        // having the same key value, or after them if the specified
+        // 'afterEqualKeys' is 'true'.  If the specified 'unique' is 'true' and
+        // a node with the same key value as 'newNode' is in the list, do not
+        // add 'newNode'.  If the specified 'newFrontFlag' is not 0 and
+        // 'newNode' is added, load into it a 'true' value if the node is at
+        // the front of the list, and a 'false' value otherwise.  Return 0 on
+        // success, and 'e_DUPLICATE' if 'newNode' was not added.
+
     void addNodeR(bool *newFrontFlag, Node *newNode);
         // Invoke 'addNodeImpR' with lock='true'.  IMPLEMENTATION NOTE: this
         // *particular* flavor of "addNode" is factored into an
@@ -840,11 +1035,21 @@ class SkipList {
         // Like 'insert', but the specified 'node' must already be present in
         // the list.  This internal method must be called under the lock.
 
+    int markNodeLockFree(Node *node);
+        // Mark the specified 'node' of this lock-free list as removed, from
+        // its top level down to level 0.  Return 0 if this call marked level
+        // 0 (and so is responsible for the removal), and 'e_NOT_FOUND' if
+        // 'node' had already been removed.
+
     Node *popFrontImp();
         // Acquire the lock, remove the front of the list, and release the
         // lock.  Return the node that was at the front of the list, or 0 if
         // the list was empty.
 
+    Node *popFrontLockFree();
+        // Remove the front of this lock-free list.  Return the node that was
+        // removed, or 0 if the list was empty.
+
     void releaseNode(Node *node);
         // Decrement the reference count of the specified 'node', and if it
         // reaches 0, destroy 'node' and return it to the pool.  Note that this
@@ -860,11 +1065,21 @@ class SkipList {
         // removed from the list.  This internal method must be called under
         // the lock.
 
+    int removeAllLockFree(bsl::vector<Pair *> *removed);
+        // Remove all items from this lock-free list, one at a time from the
+        // front, and load into the specified 'removed' vector (if not 0)
+        // pointers which can be used to refer to the removed items, in
+        // ascending order by key value.  Return the number of items removed.
+
     int removeNode(Node *node);
         // Acquire the lock, remove the specified 'node' from the list, and
         // release the lock.  Return 0 on success, and 'e_NOT_FOUND' if the
         // 'node' is no longer in the list.
 
+    int removeNodeLockFree(Node *node);
+        // Remove the specified 'node' from this lock-free list.  Return 0 on
+        // success, and 'e_NOT_FOUND' if the 'node' is no longer in the list.
+
     int updateNode(bool       *newFrontFlag,
                    Node       *node,
                    const KEY&  newKey,
@@ -879,6 +1094,22 @@ class SkipList {
         // 'allowDuplicates' is 'false' and 'newKey' already appears in the
         // list.
 
+    int updateNodeLockFree(bool       *newFrontFlag,
+                           Node       *node,
+                           const KEY&  newKey,
+                           bool        allowDuplicates,
+                           bool        afterEqualKeys);
+        // With exclusive access to this lock-free list, move the specified
+        // 'node' to the position for the specified 'newKey' (after any nodes
+        // having the same key value if the specified 'afterEqualKeys' is
+        // 'true', and before them otherwise), and update the key value of
+        // 'node' to 'newKey'.  If the specified 'newFrontFlag' is not 0, load
+        // into it a 'true' value if the new location of the node is the front
+        // of the list, and a 'false' value otherwise.  Return 0 on success,
+        // 'e_NOT_FOUND' if the node is no longer in the list, or
+        // 'e_DUPLICATE' if the specified 'allowDuplicates' is 'false' and
+        // 'newKey' already appears in the list.
+
     int updateNodeR(bool       *newFrontFlag,
                     Node       *node,
                     const KEY&  newKey,
@@ -899,15 +1130,44 @@ class SkipList {
         // Return the node at the back of the list, or 0 if the list is empty.
         // Note that this method acquires and releases the lock.
 
+    Node *backNodeLockFree() const;
+        // Return the node at the back of this lock-free list, or 0 if the
+        // list is empty.
+
     Node *findNode(const KEY& key) const;
     Node *findNodeR(const KEY& key) const;
         // Return the node with the specified 'key', or 0 if no node could be
         // found.  Note that this method acquires and releases the lock.
 
+    Node *findNodeLockFree(const KEY& key, bool lastEqualKey) const;
+        // Return the first node of this lock-free list with the specified
+        // 'key', or the last such node if the specified 'lastEqualKey' is
+        // 'true', or 0 if no node could be found.
+
+    Node *findPrevLockFree(Node *node) const;
+        // Return the node prior to the specified 'node' in this lock-free
+        // list, 'd_head_p' if 'node' is at the front of the list, or 0 if
+        // 'node' has been removed.  Note that this method does not add a
+        // reference to the returned node.  The behavior is undefined unless
+        // the calling thread is in an epoch of the list.
+
     Node *frontNode() const;
         // Return the node at the front of the list, or 0 if the list is empty.
         // Note that this method acquires and releases the lock.
 
+    Node *frontNodeLockFree() const;
+        // Return the node at the front of this lock-free list, or 0 if the
+        // list is empty.
+
+    bool isLockFree() const;
+        // Return 'true' if this list is in 'SkipListMode::e_LOCK_FREE' mode,
+        // and 'false' otherwise.
+
+    void leaveEpoch(bsls::Types::Int64 epoch) const;
+        // Leave the specified 'epoch' of this lock-free list, first advancing
+        // the epoch and reclaiming the nodes retired two epochs earlier if
+        // possible.
+
     void lookupImp(Node *update[], const KEY& key) const;
         // Populate the specified 'update' with the first node less than or
         // equal to the specified 'key' at each level in the list.  Note that
@@ -923,16 +1183,52 @@ class SkipList {
         // loaded into update[0].  This internal method must be called under
         // the lock.
 
+    void lookupImpLockFree(Node      *preds[],
+                           Node      *succs[],
+                           const KEY *key,
+                           bool       afterEqualKeys) const;
+        // Populate the specified 'preds' with the last node less than the
+        // specified 'key' (less than or equal to 'key' if the specified
+        // 'afterEqualKeys' is 'true'), and the specified 'succs' with the node
+        // following it, at each level in this lock-free list, unlinking any
+        // removed nodes encountered.  If 'key' is 0, it is treated as greater
+        // than every key in the list.  Every node loaded is either 'd_head_p',
+        // 'd_tail_p', or a node not removed at the corresponding level when
+        // observed.  Note that, if 'afterEqualKeys' is 'true', every removed
+        // node having a key value of '*key' is unlinked from all levels of
+        // the list on return.  The behavior is undefined unless the calling
+        // thread is in an epoch of the list.
+
     Node *nextNode(Node *node) const;
         // Return the node after to the specified 'node', or 0 if 'node' is at
         // the back of the list.  Note that this method acquires and releases
         // the lock.
 
+    Node *nextNodeLockFree(Node *node) const;
+        // Return the node after the specified 'node' in this lock-free list,
+        // or 0 if 'node' is at the back of the list or has been removed.
+
     Node *prevNode(Node *node) const;
         // Return the node prior to the specified 'node', or 0 if 'node' is at
         // the front of the list.  Note that this method acquires and releases
         // the lock.
 
+    Node *prevNodeLockFree(Node *node) const;
+        // Return the node prior to the specified 'node' in this lock-free
+        // list, or 0 if 'node' is at the front of the list or has been
+        // removed.
+
+    void reclaimNodes(Node *nodes) const;
+        // Destroy the specified 'nodes', a (possibly empty) list of retired
+        // nodes linked by their level-0 'd_prev_p' pointers, and return them
+        // to the pool.
+
+    void retireNode(Node *node, bsls::Types::Int64 epoch) const;
+        // Add the specified 'node', which has been unlinked from this
+        // lock-free list and has no remaining references, to the nodes
+        // awaiting reclamation after the specified 'epoch', which has been
+        // entered by the calling thread.
+
     int skipBackward(Node **node) const;
         // If the item identified by the specified 'node' is not at the front
         // of the list, load a reference to the previous item in the list into
@@ -941,6 +1237,9 @@ class SkipList {
         // no longer in the list.  Note that this method acquires and releases
         // the lock.
 
+    int skipBackwardLockFree(Node **node) const;
+        // Behave as 'skipBackward' for a lock-free list.
+
     int skipForward(Node **node) const;
         // If the item identified by the specified 'node' is not at the back of
         // the list, load a reference to the next item in the list into 'node';
@@ -949,6 +1248,21 @@ class SkipList {
         // no longer in the list.  Note that this method acquires and releases
         // the lock.
 
+    int skipForwardLockFree(Node **node) const;
+        // Behave as 'skipForward' for a lock-free list.
+
+    Node *skipRemovedNodes(Node *node) const;
+        // Return the specified 'node' if it is 'd_tail_p' or has not been
+        // removed from this lock-free list, and the first such node following
+        // 'node' at level 0 otherwise.  The behavior is undefined unless the
+        // calling thread is in an epoch of the list.
+
+    Node *successor(Node *node) const;
+        // Return the node following the specified 'node' at level 0 of this
+        // list, skipping removed nodes if this list is lock-free.  The
+        // behavior is undefined unless the calling thread holds a
+        // 'SkipList_Guard' for this list.
+
     // NOT IMPLEMENTED
     void addPairReferenceRaw(const PairHandle&);
     void releaseReferenceRaw(const PairHandle&);
@@ -959,6 +1273,7 @@ class SkipList {
     // FRIENDS
     friend class SkipListPair<KEY, DATA>;
     friend class SkipListPairHandle<KEY, DATA>;
+    friend class SkipList_Guard<KEY, DATA>;
     friend bool operator==<> (const SkipList<KEY, DATA>& lhs,
                               const SkipList<KEY, DATA>& rhs);
     friend bool operator!=<> (const SkipList<KEY, DATA>& lhs,
@@ -973,6 +1288,16 @@ class SkipList {
         // Return a reference to the modifiable "data" value of the pair
         // identified by the specified 'reference'.
 
+    static bool isMarked(const Node *link);
+        // Return 'true' if the specified 'link' has its "removed" mark set,
+        // and 'false' otherwise.
+
+    static Node *markedLink(Node *link);
+        // Return the specified 'link' with its "removed" mark set.
+
+    static Node *unmarkedLink(Node *link);
+        // Return the specified 'link' with its "removed" mark cleared.
+
   public:
     // TRAITS
     BSLALG_DECLARE_NESTED_TRAITS(SkipList,
@@ -985,15 +1310,24 @@ class SkipList {
 
     // CREATORS
     explicit SkipList(bslma::Allocator *basicAllocator = 0);
-        // Create a new Skip List.  Optionally specify a 'basicAllocator' used
-        // to supply memory.  If 'basicAllocator' is 0, the currently installed
-        // default allocator is used.
+        // Create a new Skip List in 'SkipListMode::e_LOCKED' mode.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    explicit SkipList(SkipListMode::Enum  mode,
+                      bslma::Allocator   *basicAllocator = 0);
+        // Create a new Skip List in the specified synchronization 'mode'.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  See the component-level documentation for details.
 
     SkipList(const SkipList& original, bslma::Allocator *basicAllocator = 0);
-        // Create a new Skip List initialized to the value of the specified
-        // 'original' list.  Optionally specify a 'basicAllocator' used to
-        // supply memory.  If 'basicAllocator' is 0, the currently installed
-        // default allocator is used.
+        // Create a new Skip List, in the synchronization mode of the specified
+        // 'original' list, initialized to the value of 'original'.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
 
     ~SkipList();
         // Destroy this Skip List.  The behavior is undefined if references are
@@ -1337,6 +1671,9 @@ class SkipList {
     int length() const;
         // Return the number of items in this list.
 
+    SkipListMode::Enum mode() const;
+        // Return the synchronization mode of this list.
+
     int next(PairHandle *next, const Pair *reference) const;
         // Load into the specified 'next' a reference to the item that appears
         // in the list after the item identified by the specified 'reference'.
@@ -1604,6 +1941,13 @@ int SkipList_Node<KEY, DATA>::decrementRefCount()
     return d_control.decrementRefCount();
 }
 
+template<class KEY, class DATA>
+inline
+int SkipList_Node<KEY, DATA>::tryIncrementRefCount()
+{
+    return d_control.tryIncrementRefCount();
+}
+
                      // ---------------------------------
                      // class SkipList_NodeCreationHelper
                      // ---------------------------------
@@ -1653,6 +1997,45 @@ void SkipList_NodeCreationHelper<KEY, DATA>::construct(const KEY&  key,
     d_node_p = 0;
 }
 
+                            // --------------------
+                            // class SkipList_Guard
+                            // --------------------
+
+// CREATORS
+template<class KEY, class DATA>
+inline
+SkipList_Guard<KEY, DATA>::SkipList_Guard(const SkipList<KEY, DATA> *list)
+: d_list_p(list)
+, d_epoch(0)
+{
+    if (d_list_p->isLockFree()) {
+        d_epoch = d_list_p->d_epochManager.enter();
+    }
+    else {
+        d_list_p->d_lock.lock();
+    }
+}
+
+template<class KEY, class DATA>
+inline
+SkipList_Guard<KEY, DATA>::~SkipList_Guard()
+{
+    if (d_list_p->isLockFree()) {
+        d_list_p->leaveEpoch(d_epoch);
+    }
+    else {
+        d_list_p->d_lock.unlock();
+    }
+}
+
+// ACCESSORS
+template<class KEY, class DATA>
+inline
+bsls::Types::Int64 SkipList_Guard<KEY, DATA>::epoch() const
+{
+    return d_epoch;
+}
+
                                // --------------
                                // class SkipList
                                // --------------
@@ -1661,9 +2044,14 @@ void SkipList_NodeCreationHelper<KEY, DATA>::construct(const KEY&  key,
 template<class KEY, class DATA>
 void SkipList<KEY, DATA>::addNode(bool *newFrontFlag, Node *newNode)
 {
+    if (isLockFree()) {
+        addNodeLockFree(newFrontFlag, newNode, false, false);
+        return;                                                       // RETURN
+    }
+
     LockGuard guard(&d_lock);
 
-    BSLS_ASSERT(0 == newNode->d_ptrs[0].d_next_p);
+    BSLS_ASSERT(0 == newNode->d_ptrs[0].d_next_p.loadRelaxed());
 
     Node *update[k_MAX_NUM_LEVELS];
     lookupImp(update, newNode->d_key);
@@ -1676,12 +2064,17 @@ void SkipList<KEY, DATA>::addNodeImpR(bool *newFrontFlag,
                                       Node *newNode,
                                       bool  lock)
 {
+    if (isLockFree()) {
+        addNodeLockFree(newFrontFlag, newNode, true, false);
+        return;                                                       // RETURN
+    }
+
     LockGuard lockGuard(&d_lock, !lock);
     if (!lock) {
         lockGuard.release();
     }
 
-    BSLS_ASSERT(0 == newNode->d_ptrs[0].d_next_p);
+    BSLS_ASSERT(0 == newNode->d_ptrs[0].d_next_p.loadRelaxed());
 
     Node *update[k_MAX_NUM_LEVELS];
     lookupImpR(update, newNode->d_key);
@@ -1689,6 +2082,110 @@ void SkipList<KEY, DATA>::addNodeImpR(bool *newFrontFlag,
     insertImp(newFrontFlag, update, newNode);
 }
 
+template<class KEY, class DATA>
+int SkipList<KEY, DATA>::addNodeLockFree(bool *newFrontFlag,
+                                         Node *newNode,
+                                         bool  afterEqualKeys,
+                                         bool  unique)
+{
+    const int level = newNode->level();
+
+    int listLevel = d_listLevel;
+    while (level > listLevel) {
+        const int oldLevel = d_listLevel.testAndSwap(listLevel, level);
+        if (oldLevel == listLevel) {
+            break;
+        }
+        listLevel = oldLevel;
+    }
+
+    // Once 'newNode' is linked at level 0, another thread may remove it and
+    // release the reference held by the list, so hold a reference of our own
+    // until we are done with it.  'd_length' is incremented before 'newNode'
+    // can be removed, so that it never becomes negative.
+
+    newNode->incrementRefCount();
+    ++d_length;
+
+    const bool afterEqual = afterEqualKeys && !unique;
+
+    int rc = 0;
+    {
+        ListGuard guard(this);
+
+        Node *preds[k_MAX_NUM_LEVELS];
+        Node *succs[k_MAX_NUM_LEVELS];
+
+        for (;;) {
+            lookupImpLockFree(preds, succs, &newNode->d_key, afterEqual);
+
+            Node *q = succs[0];
+            if (unique && q != d_tail_p && q->d_key == newNode->d_key) {
+                rc = e_DUPLICATE;
+                break;
+            }
+
+            for (int k = 0; k <= level; ++k) {
+                newNode->d_ptrs[k].d_next_p.storeRelaxed(succs[k]);
+            }
+
+            if (q == preds[0]->d_ptrs[0].d_next_p.testAndSwap(q, newNode)) {
+                break;
+            }
+        }
+
+        if (0 == rc) {
+            if (newFrontFlag) {
+                *newFrontFlag = (preds[0] == d_head_p);
+            }
+
+            // Link the upper levels, bottom up.  Stop if 'newNode' is removed
+            // meanwhile: its upper links are marked before its level-0 link.
+
+            bool removed = false;
+            for (int k = 1; k <= level && !removed; ++k) {
+                for (;;) {
+                    Node *next = newNode->d_ptrs[k].d_next_p.loadAcquire();
+                    if (isMarked(next)) {
+                        removed = true;
+                        break;
+                    }
+                    if (next != succs[k] &&
+                        next != newNode->d_ptrs[k].d_next_p.testAndSwap(
+                                                                next,
+                                                                succs[k])) {
+                        continue;
+                    }
+                    if (succs[k] == preds[k]->d_ptrs[k].d_next_p.testAndSwap(
+                                                                  succs[k],
+                                                                  newNode)) {
+                        break;
+                    }
+                    lookupImpLockFree(preds,
+                                      succs,
+                                      &newNode->d_key,
+                                      afterEqual);
+                }
+            }
+
+            if (isMarked(newNode->d_ptrs[0].d_next_p.loadAcquire())) {
+                // 'newNode' was removed while we were linking it, possibly
+                // after its remover finished unlinking it; unlink it again.
+
+                lookupImpLockFree(preds, succs, &newNode->d_key, true);
+            }
+        }
+    }
+
+    if (rc) {
+        --d_length;
+    }
+
+    releaseNode(newNode);
+
+    return rc;
+}
+
 template<class KEY, class DATA>
 inline
 void SkipList<KEY, DATA>::addNodeR(bool *newFrontFlag, Node *newNode)
@@ -1699,14 +2196,18 @@ void SkipList<KEY, DATA>::addNodeR(bool *newFrontFlag, Node *newNode)
 template<class KEY, class DATA>
 int SkipList<KEY, DATA>::addNodeUnique(bool *newFrontFlag, Node *newNode)
 {
+    if (isLockFree()) {
+        return addNodeLockFree(newFrontFlag, newNode, false, true);   // RETURN
+    }
+
     LockGuard guard(&d_lock);
 
-    BSLS_ASSERT(0 == newNode->d_ptrs[0].d_next_p);
+    BSLS_ASSERT(0 == newNode->d_ptrs[0].d_next_p.loadRelaxed());
 
     Node *update[k_MAX_NUM_LEVELS];
     lookupImp(update, newNode->d_key);
 
-    Node *q = update[0]->d_ptrs[0].d_next_p;
+    Node *q = update[0]->d_ptrs[0].d_next_p.loadRelaxed();
     if (q != d_tail_p && q->d_key == newNode->d_key) {
         return e_DUPLICATE;                                           // RETURN
     }
@@ -1719,14 +2220,18 @@ int SkipList<KEY, DATA>::addNodeUnique(bool *newFrontFlag, Node *newNode)
 template<class KEY, class DATA>
 int SkipList<KEY, DATA>::addNodeUniqueR(bool *newFrontFlag, Node *newNode)
 {
+    if (isLockFree()) {
+        return addNodeLockFree(newFrontFlag, newNode, true, true);    // RETURN
+    }
+
     LockGuard guard(&d_lock);
 
-    BSLS_ASSERT(0 == newNode->d_ptrs[0].d_next_p);
+    BSLS_ASSERT(0 == newNode->d_ptrs[0].d_next_p.loadRelaxed());
 
     Node *update[k_MAX_NUM_LEVELS];
     lookupImpR(update, newNode->d_key);
 
-    Node *q = update[0]->d_ptrs[0].d_next_p;
+    Node *q = update[0]->d_ptrs[0].d_next_p.loadRelaxed();
     if (q != d_tail_p && q->d_key == newNode->d_key) {
         return e_DUPLICATE;                                           // RETURN
     }
@@ -1753,7 +2258,7 @@ SkipList<KEY, DATA>::allocateNode(int level, const KEY& key, const DATA& data)
     nodeGuard.construct(key, data);
 
     node->incrementRefCount();
-    node->d_ptrs[0].d_next_p = 0;
+    node->d_ptrs[0].d_next_p.storeRelaxed(0);
 
     return node;
 }
@@ -1789,10 +2294,10 @@ void SkipList<KEY, DATA>::initialize()
 
     for (int i = 0; i < k_MAX_NUM_LEVELS; ++i) {
         d_head_p->d_ptrs[i].d_prev_p = 0;
-        d_head_p->d_ptrs[i].d_next_p = d_tail_p;
+        d_head_p->d_ptrs[i].d_next_p.storeRelaxed(d_tail_p);
 
         d_tail_p->d_ptrs[i].d_prev_p = d_head_p;
-        d_tail_p->d_ptrs[i].d_next_p = 0;
+        d_tail_p->d_ptrs[i].d_next_p.storeRelaxed(0);
     }
 }
 
@@ -1808,9 +2313,9 @@ void SkipList<KEY, DATA>::insertImp(bool *newFrontFlag,
         d_listLevel = level;
 
         node->d_ptrs[level].d_prev_p = d_head_p;
-        node->d_ptrs[level].d_next_p = d_tail_p;
+        node->d_ptrs[level].d_next_p.storeRelaxed(d_tail_p);
 
-        d_head_p->d_ptrs[level].d_next_p = node;
+        d_head_p->d_ptrs[level].d_next_p.storeRelaxed(node);
         d_tail_p->d_ptrs[level].d_prev_p = node;
 
         level--;
@@ -1818,12 +2323,12 @@ void SkipList<KEY, DATA>::insertImp(bool *newFrontFlag,
 
     for (int k = level; k >= 0; --k) {
         Node *p = location[k];
-        Node *q = p->d_ptrs[k].d_next_p;
+        Node *q = p->d_ptrs[k].d_next_p.loadRelaxed();
 
         node->d_ptrs[k].d_prev_p = p;
-        node->d_ptrs[k].d_next_p = q;
+        node->d_ptrs[k].d_next_p.storeRelaxed(q);
 
-        p->d_ptrs[k].d_next_p = node;
+        p->d_ptrs[k].d_next_p.storeRelaxed(node);
         q->d_ptrs[k].d_prev_p = node;
     }
 
@@ -1844,7 +2349,7 @@ void SkipList<KEY, DATA>::moveImp(bool *newFrontFlag,
 
     for (int k = 0; k <= level; ++k) {
         Node *newP = location[k];
-        Node *newQ = newP->d_ptrs[k].d_next_p;
+        Node *newQ = newP->d_ptrs[k].d_next_p.loadRelaxed();
 
         if (newP == node || newQ == node) {
             // The node's already in the right place.  Since we started at
@@ -1853,15 +2358,15 @@ void SkipList<KEY, DATA>::moveImp(bool *newFrontFlag,
         }
 
         Node *oldP = node->d_ptrs[k].d_prev_p;
-        Node *oldQ = node->d_ptrs[k].d_next_p;
+        Node *oldQ = node->d_ptrs[k].d_next_p.loadRelaxed();
 
         oldQ->d_ptrs[k].d_prev_p = oldP;
-        oldP->d_ptrs[k].d_next_p = oldQ;
+        oldP->d_ptrs[k].d_next_p.storeRelaxed(oldQ);
 
         node->d_ptrs[k].d_prev_p = newP;
-        node->d_ptrs[k].d_next_p = newQ;
+        node->d_ptrs[k].d_next_p.storeRelaxed(newQ);
 
-        newP->d_ptrs[k].d_next_p = node;
+        newP->d_ptrs[k].d_next_p.storeRelaxed(node);
         newQ->d_ptrs[k].d_prev_p = node;
     }
 
@@ -1870,12 +2375,45 @@ void SkipList<KEY, DATA>::moveImp(bool *newFrontFlag,
     }
 }
 
+template<class KEY, class DATA>
+int SkipList<KEY, DATA>::markNodeLockFree(Node *node)
+{
+    for (int k = node->level(); k > 0; --k) {
+        Node *next = node->d_ptrs[k].d_next_p.loadAcquire();
+        while (!isMarked(next)) {
+            Node *oldNext = node->d_ptrs[k].d_next_p.testAndSwap(
+                                                            next,
+                                                            markedLink(next));
+            if (oldNext == next) {
+                break;
+            }
+            next = oldNext;
+        }
+    }
+
+    Node *next = node->d_ptrs[0].d_next_p.loadAcquire();
+    while (!isMarked(next)) {
+        Node *oldNext = node->d_ptrs[0].d_next_p.testAndSwap(next,
+                                                             markedLink(next));
+        if (oldNext == next) {
+            return 0;                                                 // RETURN
+        }
+        next = oldNext;
+    }
+
+    return e_NOT_FOUND;
+}
+
 template<class KEY, class DATA>
 SkipList_Node<KEY, DATA> *SkipList<KEY, DATA>::popFrontImp()
 {
+    if (isLockFree()) {
+        return popFrontLockFree();                                    // RETURN
+    }
+
     LockGuard guard(&d_lock);
 
-    Node *node = d_head_p->d_ptrs[0].d_next_p;
+    Node *node = d_head_p->d_ptrs[0].d_next_p.loadRelaxed();
     if (node == d_tail_p) {
         return 0;                                                     // RETURN
     }
@@ -1883,17 +2421,41 @@ SkipList_Node<KEY, DATA> *SkipList<KEY, DATA>::popFrontImp()
     int level = node->level();
 
     for (int k = level; k >= 0; --k) {
-        Node *q = node->d_ptrs[k].d_next_p;
+        Node *q = node->d_ptrs[k].d_next_p.loadRelaxed();
         q->d_ptrs[k].d_prev_p = d_head_p;
-        d_head_p->d_ptrs[k].d_next_p = q;
+        d_head_p->d_ptrs[k].d_next_p.storeRelaxed(q);
     }
 
-    node->d_ptrs[0].d_next_p = 0;
+    node->d_ptrs[0].d_next_p.storeRelaxed(0);
     --d_length;
 
     return node;
 }
 
+template<class KEY, class DATA>
+SkipList_Node<KEY, DATA> *SkipList<KEY, DATA>::popFrontLockFree()
+{
+    ListGuard guard(this);
+
+    for (;;) {
+        Node *node = skipRemovedNodes(
+                                 d_head_p->d_ptrs[0].d_next_p.loadAcquire());
+        if (node == d_tail_p) {
+            return 0;                                                 // RETURN
+        }
+
+        if (0 == markNodeLockFree(node)) {
+            --d_length;
+
+            Node *preds[k_MAX_NUM_LEVELS];
+            Node *succs[k_MAX_NUM_LEVELS];
+            lookupImpLockFree(preds, succs, &node->d_key, true);
+
+            return node;                                              // RETURN
+        }
+    }
+}
+
 template<class KEY, class DATA>
 inline
 void SkipList<KEY, DATA>::releaseNode(Node *node)
@@ -1901,9 +2463,17 @@ void SkipList<KEY, DATA>::releaseNode(Node *node)
     int refCnt = node->decrementRefCount();
 
     if (!refCnt) {
-        node->d_key.~KEY();
-        node->d_data.~DATA();
-        PoolUtil::deallocate(d_poolManager_p, node);
+        if (isLockFree()) {
+            // Other threads may still be traversing 'node'.
+
+            ListGuard guard(this);
+            retireNode(node, guard.epoch());
+        }
+        else {
+            node->d_key.~KEY();
+            node->d_data.~DATA();
+            PoolUtil::deallocate(d_poolManager_p, node);
+        }
     }
 }
 
@@ -1912,20 +2482,20 @@ int SkipList<KEY, DATA>::removeAllImp(bsl::vector<Pair *> *removed,
                                       bool                 unlock)
 {
     Node *p = d_head_p;
-    Node *q = p->d_ptrs[0].d_next_p;
+    Node *q = p->d_ptrs[0].d_next_p.loadRelaxed();
 
     int numRemoved = 0;
     while (q != d_tail_p) {
         p = q;
-        q = p->d_ptrs[0].d_next_p;
+        q = p->d_ptrs[0].d_next_p.loadRelaxed();
 
-        p->d_ptrs[0].d_next_p = 0;
+        p->d_ptrs[0].d_next_p.storeRelaxed(0);
         numRemoved++;
     }
     d_length -= numRemoved;
 
     for (int i = 0; i <= d_listLevel; ++i) {
-        d_head_p->d_ptrs[i].d_next_p = d_tail_p;
+        d_head_p->d_ptrs[i].d_next_p.storeRelaxed(d_tail_p);
         d_tail_p->d_ptrs[i].d_prev_p = d_head_p;
     }
 
@@ -1953,12 +2523,36 @@ int SkipList<KEY, DATA>::removeAllImp(bsl::vector<Pair *> *removed,
     return numRemoved;
 }
 
+template<class KEY, class DATA>
+int SkipList<KEY, DATA>::removeAllLockFree(bsl::vector<Pair *> *removed)
+{
+    if (removed) {
+        removed->clear();
+    }
+
+    int numRemoved = 0;
+    for (Node *node = popFrontLockFree(); node; node = popFrontLockFree()) {
+        ++numRemoved;
+        if (removed) {
+            removed->push_back(reinterpret_cast<Pair *>(node));
+        }
+        else {
+            releaseNode(node);
+        }
+    }
+    return numRemoved;
+}
+
 template<class KEY, class DATA>
 int SkipList<KEY, DATA>::removeNode(Node *node)
 {
+    if (isLockFree()) {
+        return removeNodeLockFree(node);                              // RETURN
+    }
+
     LockGuard guard(&d_lock);
 
-    if (0 == node->d_ptrs[0].d_next_p) {
+    if (0 == node->d_ptrs[0].d_next_p.loadRelaxed()) {
         return e_NOT_FOUND;                                           // RETURN
     }
 
@@ -1966,14 +2560,32 @@ int SkipList<KEY, DATA>::removeNode(Node *node)
 
     for (int k = level; k >= 0; --k) {
         Node *p = node->d_ptrs[k].d_prev_p;
-        Node *q = node->d_ptrs[k].d_next_p;
+        Node *q = node->d_ptrs[k].d_next_p.loadRelaxed();
 
         q->d_ptrs[k].d_prev_p = p;
-        p->d_ptrs[k].d_next_p = q;
+        p->d_ptrs[k].d_next_p.storeRelaxed(q);
+    }
+
+    node->d_ptrs[0].d_next_p.storeRelaxed(0);
+    --d_length;
+    return 0;
+}
+
+template<class KEY, class DATA>
+int SkipList<KEY, DATA>::removeNodeLockFree(Node *node)
+{
+    ListGuard guard(this);
+
+    if (markNodeLockFree(node)) {
+        return e_NOT_FOUND;                                           // RETURN
     }
 
-    node->d_ptrs[0].d_next_p = 0;
     --d_length;
+
+    Node *preds[k_MAX_NUM_LEVELS];
+    Node *succs[k_MAX_NUM_LEVELS];
+    lookupImpLockFree(preds, succs, &node->d_key, true);
+
     return 0;
 }
 
@@ -1983,9 +2595,17 @@ int SkipList<KEY, DATA>::updateNode(bool       *newFrontFlag,
                                     const KEY&  newKey,
                                     bool        allowDuplicates)
 {
+    if (isLockFree()) {
+        return updateNodeLockFree(newFrontFlag,                       // RETURN
+                                  node,
+                                  newKey,
+                                  allowDuplicates,
+                                  false);
+    }
+
     LockGuard guard(&d_lock);
 
-    if (0 == node->d_ptrs[0].d_next_p) {
+    if (0 == node->d_ptrs[0].d_next_p.loadRelaxed()) {
         return e_NOT_FOUND;                                           // RETURN
     }
 
@@ -1993,7 +2613,7 @@ int SkipList<KEY, DATA>::updateNode(bool       *newFrontFlag,
     lookupImp(update, newKey);
 
     if (!allowDuplicates) {
-        Node *q = update[0]->d_ptrs[0].d_next_p;
+        Node *q = update[0]->d_ptrs[0].d_next_p.loadRelaxed();
         if (q != d_tail_p && q != node && q->d_key == newKey) {
             return e_DUPLICATE;                                       // RETURN
         }
@@ -2007,15 +2627,93 @@ int SkipList<KEY, DATA>::updateNode(bool       *newFrontFlag,
     return 0;
 }
 
+template<class KEY, class DATA>
+int SkipList<KEY, DATA>::updateNodeLockFree(bool       *newFrontFlag,
+                                            Node       *node,
+                                            const KEY&  newKey,
+                                            bool        allowDuplicates,
+                                            bool        afterEqualKeys)
+{
+    // Moving a node cannot be done atomically by marking links, so wait for
+    // all operations on the list to complete, and exclude new ones.  With no
+    // operation in progress, every removed node has been unlinked.
+
+    bslmt::LockGuard<EpochManager> guard(&d_epochManager);
+
+    if (isMarked(node->d_ptrs[0].d_next_p.loadRelaxed())) {
+        return e_NOT_FOUND;                                           // RETURN
+    }
+
+    Node *preds[k_MAX_NUM_LEVELS];
+    Node *succs[k_MAX_NUM_LEVELS];
+
+    if (!allowDuplicates) {
+        lookupImpLockFree(preds, succs, &newKey, afterEqualKeys);
+
+        Node *q = afterEqualKeys ? preds[0] : succs[0];
+        if (q != (afterEqualKeys ? d_head_p : d_tail_p)
+         && q != node
+         && q->d_key == newKey) {
+            return e_DUPLICATE;                                       // RETURN
+        }
+    }
+
+    // Find the predecessors of 'node' at each of its levels.
+
+    const int level = node->level();
+
+    lookupImpLockFree(preds, succs, &node->d_key, false);
+    for (int k = 0; k <= level; ++k) {
+        Node *p = preds[k];
+        Node *q = p->d_ptrs[k].d_next_p.loadRelaxed();
+        while (q != node) {
+            BSLS_ASSERT(!isMarked(q) && q != d_tail_p);
+
+            p = q;
+            q = p->d_ptrs[k].d_next_p.loadRelaxed();
+        }
+        preds[k] = p;
+    }
+
+    node->d_key = newKey;  // may throw
+
+    // now we are committed: change the list!
+
+    for (int k = level; k >= 0; --k) {
+        preds[k]->d_ptrs[k].d_next_p.storeRelaxed(
+                                       node->d_ptrs[k].d_next_p.loadRelaxed());
+    }
+
+    lookupImpLockFree(preds, succs, &node->d_key, afterEqualKeys);
+    for (int k = 0; k <= level; ++k) {
+        node->d_ptrs[k].d_next_p.storeRelaxed(succs[k]);
+        preds[k]->d_ptrs[k].d_next_p.storeRelaxed(node);
+    }
+
+    if (newFrontFlag) {
+        *newFrontFlag = (preds[0] == d_head_p);
+    }
+
+    return 0;
+}
+
 template<class KEY, class DATA>
 int SkipList<KEY, DATA>::updateNodeR(bool       *newFrontFlag,
                                      Node       *node,
                                      const KEY&  newKey,
                                      bool        allowDuplicates)
 {
+    if (isLockFree()) {
+        return updateNodeLockFree(newFrontFlag,                       // RETURN
+                                  node,
+                                  newKey,
+                                  allowDuplicates,
+                                  true);
+    }
+
     LockGuard guard(&d_lock);
 
-    if (0 == node->d_ptrs[0].d_next_p) {
+    if (0 == node->d_ptrs[0].d_next_p.loadRelaxed()) {
         return e_NOT_FOUND;                                           // RETURN
     }
 
@@ -2042,6 +2740,10 @@ template<class KEY, class DATA>
 SkipList_Node<KEY, DATA> *
 SkipList<KEY, DATA>::backNode() const
 {
+    if (isLockFree()) {
+        return backNodeLockFree();                                    // RETURN
+    }
+
     LockGuard guard(&d_lock);
 
     Node *node = d_tail_p->d_ptrs[0].d_prev_p;
@@ -2053,15 +2755,42 @@ SkipList<KEY, DATA>::backNode() const
     return node;
 }
 
+template<class KEY, class DATA>
+SkipList_Node<KEY, DATA> *
+SkipList<KEY, DATA>::backNodeLockFree() const
+{
+    ListGuard guard(this);
+
+    Node *preds[k_MAX_NUM_LEVELS];
+    Node *succs[k_MAX_NUM_LEVELS];
+
+    for (;;) {
+        lookupImpLockFree(preds, succs, 0, true);
+
+        Node *node = preds[0];
+        if (node == d_head_p) {
+            return 0;                                                 // RETURN
+        }
+
+        if (node->tryIncrementRefCount()) {
+            return node;                                              // RETURN
+        }
+    }
+}
+
 template<class KEY, class DATA>
 SkipList_Node<KEY, DATA> *SkipList<KEY, DATA>::findNode(const KEY& key) const
 {
+    if (isLockFree()) {
+        return findNodeLockFree(key, false);                          // RETURN
+    }
+
     Node *locator[k_MAX_NUM_LEVELS];
 
     LockGuard guard(&d_lock);
     lookupImp(locator, key);
 
-    Node *q = locator[0]->d_ptrs[0].d_next_p;
+    Node *q = locator[0]->d_ptrs[0].d_next_p.loadRelaxed();
     if (q != d_tail_p && q->d_key == key) {
         q->incrementRefCount();
         return q;                                                     // RETURN
@@ -2073,6 +2802,10 @@ SkipList_Node<KEY, DATA> *SkipList<KEY, DATA>::findNode(const KEY& key) const
 template<class KEY, class DATA>
 SkipList_Node<KEY, DATA> *SkipList<KEY, DATA>::findNodeR(const KEY& key) const
 {
+    if (isLockFree()) {
+        return findNodeLockFree(key, true);                           // RETURN
+    }
+
     Node *locator[k_MAX_NUM_LEVELS];
 
     LockGuard guard(&d_lock);
@@ -2087,12 +2820,74 @@ SkipList_Node<KEY, DATA> *SkipList<KEY, DATA>::findNodeR(const KEY& key) const
     return 0;
 }
 
+template<class KEY, class DATA>
+SkipList_Node<KEY, DATA> *
+SkipList<KEY, DATA>::findNodeLockFree(const KEY& key, bool lastEqualKey) const
+{
+    ListGuard guard(this);
+
+    Node *preds[k_MAX_NUM_LEVELS];
+    Node *succs[k_MAX_NUM_LEVELS];
+
+    for (;;) {
+        lookupImpLockFree(preds, succs, &key, lastEqualKey);
+
+        Node *node = lastEqualKey ? preds[0] : succs[0];
+        if (node == d_head_p || node == d_tail_p || !(node->d_key == key)) {
+            return 0;                                                 // RETURN
+        }
+
+        if (node->tryIncrementRefCount()) {
+            return node;                                              // RETURN
+        }
+    }
+}
+
+template<class KEY, class DATA>
+SkipList_Node<KEY, DATA> *
+SkipList<KEY, DATA>::findPrevLockFree(Node *node) const
+{
+    Node *preds[k_MAX_NUM_LEVELS];
+    Node *succs[k_MAX_NUM_LEVELS];
+
+    for (;;) {
+        if (isMarked(node->d_ptrs[0].d_next_p.loadAcquire())) {
+            return 0;                                                 // RETURN
+        }
+
+        // Nodes have no backward links; search for the last node less than
+        // 'node', then walk forward through nodes with the same key value.
+
+        lookupImpLockFree(preds, succs, &node->d_key, false);
+
+        Node *prev = preds[0];
+        Node *q    = succs[0];
+        while (q != node && q != d_tail_p && !(node->d_key < q->d_key)) {
+            Node *next = q->d_ptrs[0].d_next_p.loadAcquire();
+            if (!isMarked(next)) {
+                prev = q;
+            }
+            q = unmarkedLink(next);
+        }
+
+        if (q == node) {
+            return prev;                                              // RETURN
+        }
+
+        // The list changed during the walk; try again.
+    }
+}
+
 template<class KEY, class DATA>
 SkipList_Node<KEY, DATA> *SkipList<KEY, DATA>::frontNode() const
 {
+    if (isLockFree()) {
+        return frontNodeLockFree();                                   // RETURN
+    }
+
     LockGuard guard(&d_lock);
 
-    Node *node = d_head_p->d_ptrs[0].d_next_p;
+    Node *node = d_head_p->d_ptrs[0].d_next_p.loadRelaxed();
     if (node == d_tail_p) {
         return 0;                                                     // RETURN
     }
@@ -2101,15 +2896,61 @@ SkipList_Node<KEY, DATA> *SkipList<KEY, DATA>::frontNode() const
     return node;
 }
 
+template<class KEY, class DATA>
+SkipList_Node<KEY, DATA> *SkipList<KEY, DATA>::frontNodeLockFree() const
+{
+    ListGuard guard(this);
+
+    for (;;) {
+        Node *node = skipRemovedNodes(
+                                 d_head_p->d_ptrs[0].d_next_p.loadAcquire());
+        if (node == d_tail_p) {
+            return 0;                                                 // RETURN
+        }
+
+        if (node->tryIncrementRefCount()) {
+            return node;                                              // RETURN
+        }
+    }
+}
+
+template<class KEY, class DATA>
+inline
+bool SkipList<KEY, DATA>::isLockFree() const
+{
+    return SkipListMode::e_LOCK_FREE == d_mode;
+}
+
+template<class KEY, class DATA>
+void SkipList<KEY, DATA>::leaveEpoch(bsls::Types::Int64 epoch) const
+{
+    // Try to advance the epoch only if there are nodes awaiting reclamation.
+
+    for (int i = 0; i < EpochManager::k_NUM_EPOCHS; ++i) {
+        if (d_retired[i].loadRelaxed()) {
+            const int slot = d_epochManager.tryAdvance(epoch);
+            if (0 <= slot) {
+                Node *nodes = d_retired[slot].swap(0);
+                d_epochManager.leave(epoch);
+                reclaimNodes(nodes);
+                return;                                               // RETURN
+            }
+            break;
+        }
+    }
+
+    d_epochManager.leave(epoch);
+}
+
 template<class KEY, class DATA>
 void SkipList<KEY, DATA>::lookupImp(Node *update[], const KEY& key) const
 {
     Node *p = d_head_p;
     for (int k = d_listLevel; k >= 0; --k) {
-        Node *q = p->d_ptrs[k].d_next_p;
+        Node *q = p->d_ptrs[k].d_next_p.loadRelaxed();
         while (q != d_tail_p && q->d_key < key) {
             p = q;
-            q = p->d_ptrs[k].d_next_p;
+            q = p->d_ptrs[k].d_next_p.loadRelaxed();
         }
         update[k] = p;
     }
@@ -2129,15 +2970,77 @@ void SkipList<KEY, DATA>::lookupImpR(Node *update[], const KEY& key) const
     }
 }
 
+template<class KEY, class DATA>
+void SkipList<KEY, DATA>::lookupImpLockFree(Node      *preds[],
+                                            Node      *succs[],
+                                            const KEY *key,
+                                            bool       afterEqualKeys) const
+{
+    // The search at each level starts from the last node less than 'key' at
+    // the level above, so that every node with a key value of '*key' is
+    // visited even if such nodes are in a different order on different
+    // levels.  A removed node is unlinked by swinging the link of its
+    // predecessor; if that fails, or the predecessor was itself removed, the
+    // search restarts from the head.
+
+    int k;
+    do {
+        Node *p = d_head_p;  // last node less than 'key' at level 'k'
+
+        for (k = d_listLevel.loadAcquire(); k >= 0; --k) {
+            Node *pp = p;
+            Node *q  = p->d_ptrs[k].d_next_p.loadAcquire();
+            if (isMarked(q)) {
+                break;
+            }
+
+            while (q != d_tail_p) {
+                Node *next = q->d_ptrs[k].d_next_p.loadAcquire();
+                if (isMarked(next)) {
+                    next = unmarkedLink(next);
+                    if (q != pp->d_ptrs[k].d_next_p.testAndSwap(q, next)) {
+                        q = 0;
+                        break;
+                    }
+                    q = next;
+                }
+                else if (0 == key || q->d_key < *key) {
+                    p  = q;
+                    pp = q;
+                    q  = next;
+                }
+                else if (afterEqualKeys && !(*key < q->d_key)) {
+                    pp = q;
+                    q  = next;
+                }
+                else {
+                    break;
+                }
+            }
+
+            if (0 == q) {
+                break;
+            }
+
+            preds[k] = pp;
+            succs[k] = q;
+        }
+    } while (k >= 0);
+}
+
 template<class KEY, class DATA>
 SkipList_Node<KEY, DATA> *
 SkipList<KEY, DATA>::nextNode(Node *node) const
 {
     BSLS_ASSERT(node != d_head_p && node != d_tail_p);
 
+    if (isLockFree()) {
+        return nextNodeLockFree(node);                                // RETURN
+    }
+
     LockGuard guard(&d_lock);
 
-    Node *next = node->d_ptrs[0].d_next_p;
+    Node *next = node->d_ptrs[0].d_next_p.loadRelaxed();
     if (0 == next || d_tail_p == next) {
         return 0;                                                     // RETURN
     }
@@ -2146,14 +3049,41 @@ SkipList<KEY, DATA>::nextNode(Node *node) const
     return next;
 }
 
+template<class KEY, class DATA>
+SkipList_Node<KEY, DATA> *
+SkipList<KEY, DATA>::nextNodeLockFree(Node *node) const
+{
+    ListGuard guard(this);
+
+    for (;;) {
+        Node *next = node->d_ptrs[0].d_next_p.loadAcquire();
+        if (isMarked(next)) {
+            return 0;                                                 // RETURN
+        }
+
+        next = skipRemovedNodes(next);
+        if (d_tail_p == next) {
+            return 0;                                                 // RETURN
+        }
+
+        if (next->tryIncrementRefCount()) {
+            return next;                                              // RETURN
+        }
+    }
+}
+
 template<class KEY, class DATA>
 SkipList_Node<KEY, DATA> *
 SkipList<KEY, DATA>::prevNode(Node *node) const
 {
     BSLS_ASSERT(node != d_head_p && node != d_tail_p);
 
+    if (isLockFree()) {
+        return prevNodeLockFree(node);                                // RETURN
+    }
+
     LockGuard guard(&d_lock);
-    if (0 == node->d_ptrs[0].d_next_p) {
+    if (0 == node->d_ptrs[0].d_next_p.loadRelaxed()) {
         return 0;                                                     // RETURN
     }
 
@@ -2166,6 +3096,56 @@ SkipList<KEY, DATA>::prevNode(Node *node) const
     return prev;
 }
 
+template<class KEY, class DATA>
+SkipList_Node<KEY, DATA> *
+SkipList<KEY, DATA>::prevNodeLockFree(Node *node) const
+{
+    ListGuard guard(this);
+
+    for (;;) {
+        Node *prev = findPrevLockFree(node);
+        if (0 == prev || d_head_p == prev) {
+            return 0;                                                 // RETURN
+        }
+
+        if (prev->tryIncrementRefCount()) {
+            return prev;                                              // RETURN
+        }
+    }
+}
+
+template<class KEY, class DATA>
+void SkipList<KEY, DATA>::reclaimNodes(Node *nodes) const
+{
+    while (nodes) {
+        Node *next = nodes->d_ptrs[0].d_prev_p;
+
+        nodes->d_key.~KEY();
+        nodes->d_data.~DATA();
+        PoolUtil::deallocate(d_poolManager_p, nodes);
+
+        nodes = next;
+    }
+}
+
+template<class KEY, class DATA>
+void SkipList<KEY, DATA>::retireNode(Node               *node,
+                                     bsls::Types::Int64  epoch) const
+{
+    bsls::AtomicPointer<Node>& retired = d_retired[EpochManager::slot(epoch)];
+
+    Node *head = retired.loadRelaxed();
+    for (;;) {
+        node->d_ptrs[0].d_prev_p = head;
+
+        Node *oldHead = retired.testAndSwap(head, node);
+        if (oldHead == head) {
+            break;
+        }
+        head = oldHead;
+    }
+}
+
 template<class KEY, class DATA>
 int SkipList<KEY, DATA>::skipBackward(Node **node) const
 {
@@ -2173,9 +3153,13 @@ int SkipList<KEY, DATA>::skipBackward(Node **node) const
     BSLS_ASSERT(current);
     BSLS_ASSERT(current != d_head_p && current != d_tail_p);
 
+    if (isLockFree()) {
+        return skipBackwardLockFree(node);                            // RETURN
+    }
+
     LockGuard guard(&d_lock);
 
-    if (0 == current->d_ptrs[0].d_next_p) {
+    if (0 == current->d_ptrs[0].d_next_p.loadRelaxed()) {
         // We set this pointer to 0 only when removing from the list.
         return e_NOT_FOUND;                                           // RETURN
     }
@@ -2195,6 +3179,32 @@ int SkipList<KEY, DATA>::skipBackward(Node **node) const
     return 0;
 }
 
+template<class KEY, class DATA>
+int SkipList<KEY, DATA>::skipBackwardLockFree(Node **node) const
+{
+    Node *current = *node;
+
+    ListGuard guard(this);
+
+    for (;;) {
+        Node *prev = findPrevLockFree(current);
+        if (0 == prev) {
+            return e_NOT_FOUND;                                       // RETURN
+        }
+
+        if (d_head_p == prev || prev->tryIncrementRefCount()) {
+            if (0 == current->decrementRefCount()) {
+                // 'current' was removed concurrently.
+
+                retireNode(current, guard.epoch());
+            }
+
+            *node = d_head_p == prev ? 0 : prev;
+            return 0;                                                 // RETURN
+        }
+    }
+}
+
 template<class KEY, class DATA>
 int SkipList<KEY, DATA>::skipForward(Node **node) const
 {
@@ -2202,9 +3212,13 @@ int SkipList<KEY, DATA>::skipForward(Node **node) const
     BSLS_ASSERT(current);
     BSLS_ASSERT(current != d_head_p && current != d_tail_p);
 
+    if (isLockFree()) {
+        return skipForwardLockFree(node);                             // RETURN
+    }
+
     LockGuard guard(&d_lock);
 
-    if (0 == current->d_ptrs[0].d_next_p) {
+    if (0 == current->d_ptrs[0].d_next_p.loadRelaxed()) {
         // We set this pointer to 0 only when removing from the list.
         return e_NOT_FOUND;                                           // RETURN
     }
@@ -2213,7 +3227,7 @@ int SkipList<KEY, DATA>::skipForward(Node **node) const
     BSLS_ASSERT(count);
     (void) count;    // suppress 'unused variable' warnings
 
-    Node *next = current->d_ptrs[0].d_next_p;
+    Node *next = current->d_ptrs[0].d_next_p.loadRelaxed();
     if (d_tail_p == next) {
         *node = 0;
         return 0;                                                     // RETURN
@@ -2224,6 +3238,59 @@ int SkipList<KEY, DATA>::skipForward(Node **node) const
     return 0;
 }
 
+template<class KEY, class DATA>
+int SkipList<KEY, DATA>::skipForwardLockFree(Node **node) const
+{
+    Node *current = *node;
+
+    ListGuard guard(this);
+
+    for (;;) {
+        Node *next = current->d_ptrs[0].d_next_p.loadAcquire();
+        if (isMarked(next)) {
+            return e_NOT_FOUND;                                       // RETURN
+        }
+
+        next = skipRemovedNodes(next);
+        if (d_tail_p == next || next->tryIncrementRefCount()) {
+            if (0 == current->decrementRefCount()) {
+                // 'current' was removed concurrently.
+
+                retireNode(current, guard.epoch());
+            }
+
+            *node = d_tail_p == next ? 0 : next;
+            return 0;                                                 // RETURN
+        }
+    }
+}
+
+template<class KEY, class DATA>
+SkipList_Node<KEY, DATA> *
+SkipList<KEY, DATA>::skipRemovedNodes(Node *node) const
+{
+    while (node != d_tail_p) {
+        Node *next = node->d_ptrs[0].d_next_p.loadAcquire();
+        if (!isMarked(next)) {
+            break;
+        }
+        node = unmarkedLink(next);
+    }
+    return node;
+}
+
+template<class KEY, class DATA>
+inline
+SkipList_Node<KEY, DATA> *SkipList<KEY, DATA>::successor(Node *node) const
+{
+    if (!isLockFree()) {
+        return node->d_ptrs[0].d_next_p.loadRelaxed();                // RETURN
+    }
+
+    return skipRemovedNodes(
+                        unmarkedLink(node->d_ptrs[0].d_next_p.loadAcquire()));
+}
+
 // PRIVATE CLASS METHODS
 template<class KEY, class DATA>
 inline
@@ -2241,6 +3308,32 @@ DATA& SkipList<KEY, DATA>::data(const Pair *reference)
     return node->d_data;
 }
 
+template<class KEY, class DATA>
+inline
+bool SkipList<KEY, DATA>::isMarked(const Node *link)
+{
+    return reinterpret_cast<bsls::Types::UintPtr>(link) & 1;
+}
+
+template<class KEY, class DATA>
+inline
+SkipList_Node<KEY, DATA> *SkipList<KEY, DATA>::markedLink(Node *link)
+{
+    typedef bsls::Types::UintPtr UintPtr;
+
+    return reinterpret_cast<Node *>(reinterpret_cast<UintPtr>(link) | 1);
+}
+
+template<class KEY, class DATA>
+inline
+SkipList_Node<KEY, DATA> *SkipList<KEY, DATA>::unmarkedLink(Node *link)
+{
+    typedef bsls::Types::UintPtr UintPtr;
+
+    return reinterpret_cast<Node *>(reinterpret_cast<UintPtr>(link) &
+                                    ~static_cast<UintPtr>(1));
+}
+
 // CLASS METHODS
 template<class KEY, class DATA>
 inline
@@ -2255,6 +3348,19 @@ template<class KEY, class DATA>
 SkipList<KEY, DATA>::SkipList(bslma::Allocator *basicAllocator)
 : d_listLevel(0)
 , d_length(0)
+, d_mode(SkipListMode::e_LOCKED)
+, d_poolManager_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize();
+}
+
+template<class KEY, class DATA>
+SkipList<KEY, DATA>::SkipList(SkipListMode::Enum  mode,
+                              bslma::Allocator   *basicAllocator)
+: d_listLevel(0)
+, d_length(0)
+, d_mode(mode)
 , d_poolManager_p(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -2266,6 +3372,7 @@ SkipList<KEY, DATA>::SkipList(const SkipList&   original,
                               bslma::Allocator *basicAllocator)
 : d_listLevel(0)
 , d_length(0)
+, d_mode(original.d_mode)
 , d_poolManager_p(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -2276,7 +3383,7 @@ SkipList<KEY, DATA>::SkipList(const SkipList&   original,
 template<class KEY, class DATA>
 SkipList<KEY, DATA>::~SkipList()
 {
-    Node *p = d_head_p->d_ptrs[0].d_next_p;
+    Node *p = d_head_p->d_ptrs[0].d_next_p.loadRelaxed();
     while (p != d_tail_p) {
         const int count = p->decrementRefCount();
         BSLS_ASSERT(0 == count);
@@ -2284,7 +3391,11 @@ SkipList<KEY, DATA>::~SkipList()
 
         p->d_key.~KEY();
         p->d_data.~DATA();
-        p = p->d_ptrs[0].d_next_p;
+        p = p->d_ptrs[0].d_next_p.loadRelaxed();
+    }
+
+    for (int i = 0; i < EpochManager::k_NUM_EPOCHS; ++i) {
+        reclaimNodes(d_retired[i].swap(0));
     }
 
     PoolUtil::deletePoolManager(d_allocator_p, d_poolManager_p);
@@ -2301,31 +3412,38 @@ SkipList<KEY, DATA>::operator=(const SkipList& rhs)
 
     // first empty this list
     LockGuard guard(&d_lock);
-    removeAllImp(0, false);
-
-    // Now lock the other list and get handles to all its elements.  Once we
-    // have locked it, we need to do all operations manually because the
-    // important functions of 'rhs' (like frontNode and nextNode) will lock the
-    // mutex.
+    if (isLockFree()) {
+        removeAllLockFree(0);
+    }
+    else {
+        removeAllImp(0, false);
+    }
 
-    LockGuard rhsGuard(&rhs.d_lock);
+    // Now lock (or enter an epoch of) the other list and get handles to all
+    // its elements.  Once we have done so, we need to do all operations
+    // manually because the important functions of 'rhs' (like frontNode and
+    // nextNode) will lock the mutex.  A node of a lock-free 'rhs' whose
+    // reference count has dropped to 0 is being removed, and is skipped.
 
     bsl::vector<PairHandle> rhsElements;
-    for (Node *node = rhs.d_head_p->d_ptrs[0].d_next_p;
-         node && node != rhs.d_tail_p;
-         node = node->d_ptrs[0].d_next_p)
     {
-        node->incrementRefCount();
-        rhsElements.insert(rhsElements.end(),
-                           PairHandle())->reset(
+        ListGuard rhsGuard(&rhs);
+
+        for (Node *node = rhs.successor(rhs.d_head_p);
+             node && node != rhs.d_tail_p;
+             node = rhs.successor(node))
+        {
+            if (node->tryIncrementRefCount()) {
+                rhsElements.insert(rhsElements.end(),
+                                   PairHandle())->reset(
                                                &rhs,
                                                reinterpret_cast<Pair *>(node));
+            }
+        }
     }
 
-    // Now we can unlock the other list, since our handles will remain valid
-    // even if the referenced elements are removed.
-
-    rhsGuard.release()->unlock();
+    // Now we have unlocked the other list, since our handles will remain
+    // valid even if the referenced elements are removed.
 
     for (typename bsl::vector<PairHandle>::iterator it = rhsElements.begin();
          it != rhsElements.end(); ++it) {
@@ -2653,6 +3771,10 @@ template<class KEY, class DATA>
 inline
 int SkipList<KEY, DATA>::removeAllRaw(bsl::vector<Pair *> *removed)
 {
+    if (isLockFree()) {
+        return removeAllLockFree(removed);                            // RETURN
+    }
+
     d_lock.lock();
 
     return removeAllImp(removed, true); // true = unlock after removal
@@ -2724,12 +3846,22 @@ int SkipList<KEY, DATA>::backRaw(Pair **back) const
 template<class KEY, class DATA>
 bool SkipList<KEY, DATA>::exists(const KEY& key) const
 {
+    if (isLockFree()) {
+        ListGuard guard(this);
+
+        Node *preds[k_MAX_NUM_LEVELS];
+        Node *succs[k_MAX_NUM_LEVELS];
+        lookupImpLockFree(preds, succs, &key, false);
+
+        return succs[0] != d_tail_p && succs[0]->d_key == key;        // RETURN
+    }
+
     Node *locator[k_MAX_NUM_LEVELS];
 
     LockGuard guard(&d_lock);
     lookupImp(locator, key);
 
-    Node *q = locator[0]->d_ptrs[0].d_next_p;
+    Node *q = locator[0]->d_ptrs[0].d_next_p.loadRelaxed();
     if (q != d_tail_p && q->d_key == key) {
         return true;                                                  // RETURN
     }
@@ -2801,20 +3933,31 @@ template<class KEY, class DATA>
 inline
 bool SkipList<KEY, DATA>::isEmpty() const
 {
-    LockGuard guard(&d_lock);
+    ListGuard guard(this);
 
-    return d_tail_p == d_head_p->d_ptrs[0].d_next_p;
+    return d_tail_p == successor(d_head_p);
 }
 
 template<class KEY, class DATA>
 inline
 int SkipList<KEY, DATA>::length() const
 {
+    if (isLockFree()) {
+        return d_length;                                              // RETURN
+    }
+
     LockGuard guard(&d_lock);
 
     return d_length;
 }
 
+template<class KEY, class DATA>
+inline
+SkipListMode::Enum SkipList<KEY, DATA>::mode() const
+{
+    return d_mode;
+}
+
 template<class KEY, class DATA>
 inline
 int SkipList<KEY, DATA>::nextRaw(Pair **next, const Pair *reference) const
@@ -2884,7 +4027,7 @@ SkipList<KEY, DATA>::print(bsl::ostream& stream,
 
     bdlb::Print::indent(stream, level, spacesPerLevel);
 
-    LockGuard guard(&d_lock);
+    ListGuard guard(this);
     // Now we must do all operations manually, since all important functions
     // like frontNode() and nextNode will lock the mutex
 
@@ -2899,9 +4042,9 @@ SkipList<KEY, DATA>::print(bsl::ostream& stream,
 
         const int levelPlus1 = level + 1;
 
-        for (Node *node = d_head_p->d_ptrs[0].d_next_p;
+        for (Node *node = successor(d_head_p);
              node && node != d_tail_p;
-             node = node->d_ptrs[0].d_next_p) {
+             node = successor(node)) {
             bdlb::Print::indent(stream, levelPlus1, spacesPerLevel);
             stream << "[\n";
 
@@ -2934,9 +4077,9 @@ SkipList<KEY, DATA>::print(bsl::ostream& stream,
 
         stream << "[";
 
-        for (Node *node = d_head_p->d_ptrs[0].d_next_p;
+        for (Node *node = successor(d_head_p);
              node && node != d_tail_p;
-             node = node->d_ptrs[0].d_next_p) {
+             node = successor(node)) {
             stream << "[ (level = " << node->level() << ") ";
 
             bdlb::PrintMethods::print(stream, node->d_key, 0, -1);
@@ -3003,18 +4146,17 @@ bool bdlcc::operator==(const SkipList<KEY, DATA>& lhs,
     if (&lhs == &rhs) {
         return true;                                                  // RETURN
     }
-    bslmt::LockGuard<bslmt::Mutex> lhsGuard(&lhs.d_lock);
-    bslmt::LockGuard<bslmt::Mutex> rhsGuard(&rhs.d_lock);
-
-    // Once we have locked the lists, we need to do all operations manually
-    // because the important functions of the lists (like frontNode and
-    // nextNode) will lock the mutex.
-    for (SkipList_Node<KEY, DATA>
-              *lhsNode = lhs.d_head_p->d_ptrs[0].d_next_p,
-              *rhsNode = rhs.d_head_p->d_ptrs[0].d_next_p;
+    SkipList_Guard<KEY, DATA> lhsGuard(&lhs);
+    SkipList_Guard<KEY, DATA> rhsGuard(&rhs);
+
+    // Once we have locked (or entered an epoch of) the lists, we need to do
+    // all operations manually because the important functions of the lists
+    // (like frontNode and nextNode) will lock the mutex.
+    for (SkipList_Node<KEY, DATA> *lhsNode = lhs.successor(lhs.d_head_p),
+                                  *rhsNode = rhs.successor(rhs.d_head_p);
          ;
-         lhsNode = lhsNode->d_ptrs[0].d_next_p,
-         rhsNode = rhsNode->d_ptrs[0].d_next_p)
+         lhsNode = lhs.successor(lhsNode),
+         rhsNode = rhs.successor(rhsNode))
     {
         if ((!lhsNode && !rhsNode)
          || (lhsNode == lhs.d_tail_p && rhsNode == rhs.d_tail_p)) {
@@ -3045,18 +4187,17 @@ bool bdlcc::operator!=(const SkipList<KEY, DATA>& lhs,
     if (&lhs == &rhs) {
         return false;                                                 // RETURN
     }
-    bslmt::LockGuard<bslmt::Mutex> lhsGuard(&lhs.d_lock);
-    bslmt::LockGuard<bslmt::Mutex> rhsGuard(&rhs.d_lock);
-
-    // Once we have locked the lists, we need to do all operations manually
-    // because the important functions of the lists (like frontNode and
-    // nextNode) will lock the mutex.
-    for (SkipList_Node<KEY, DATA>
-              *lhsNode = lhs.d_head_p->d_ptrs[0].d_next_p,
-              *rhsNode = rhs.d_head_p->d_ptrs[0].d_next_p;
+    SkipList_Guard<KEY, DATA> lhsGuard(&lhs);
+    SkipList_Guard<KEY, DATA> rhsGuard(&rhs);
+
+    // Once we have locked (or entered an epoch of) the lists, we need to do
+    // all operations manually because the important functions of the lists
+    // (like frontNode and nextNode) will lock the mutex.
+    for (SkipList_Node<KEY, DATA> *lhsNode = lhs.successor(lhs.d_head_p),
+                                  *rhsNode = rhs.successor(rhs.d_head_p);
          ;
-         lhsNode = lhsNode->d_ptrs[0].d_next_p,
-         rhsNode = rhsNode->d_ptrs[0].d_next_p)
+         lhsNode = lhs.successor(lhsNode),
+         rhsNode = rhs.successor(rhsNode))
     {
         if ((!lhsNode && !rhsNode)
          || (lhsNode == lhs.d_tail_p && rhsNode == rhs.d_tail_p)) {
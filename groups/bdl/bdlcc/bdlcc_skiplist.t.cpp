@@ -33,6 +33,9 @@
 
 #include <bsls_assert.h>
 
+#include <bdlb_random.h>
+
+#include <bsl_algorithm.h>
 #include <bsl_cstdlib.h>
 #include <bsl_c_stdlib.h>  // 'rand_r'
 #include <bsl_cmath.h>     // 'floor', 'ceil'
@@ -297,6 +300,112 @@ void case19(bdlcc::SkipList<int, int>* list,
     }
 }
 
+void case25(bdlcc::SkipList<int, int> *list,
+            int                        phase,
+            int                        id,
+            int                        numThreads,
+            int                        numKeys,
+            bsl::vector<int>          *popped,
+            bslmt::Barrier            *barrier)
+    // Perform the specified 'phase' of the lock-free stress test on the
+    // specified 'list' as thread number 'id' of the specified 'numThreads',
+    // each thread owning the keys 'k' in '[0 .. numKeys)' such that
+    // 'k % numThreads == id'.  Load into the specified 'popped' the keys
+    // popped in phase 3.  Use the specified 'barrier' to synchronize the
+    // threads within phase 4.
+{
+    typedef bdlcc::SkipList<int, int> Obj;
+
+    switch (phase) {
+      case 1: {
+        // Add the owned keys in an interleaved order, while looking up and
+        // iterating over the keys of the other threads.
+
+        for (int key = id; key < numKeys; key += numThreads) {
+            ASSERTT(0 == list->addUnique(key, id));
+
+            Obj::PairHandle h;
+            ASSERTT(0 == list->find(&h, key));
+            ASSERTT(key == h.key());
+            ASSERTT(id  == h.data());
+
+            int otherKey = (key + 1) % numKeys;
+            if (0 == list->find(&h, otherKey)) {
+                ASSERTT(otherKey == h.key());
+            }
+        }
+      } break;
+      case 2: {
+        // Remove the owned even keys, while iterating over the list.
+
+        Obj::PairHandle h;
+        for (int key = id; key < numKeys; key += numThreads) {
+            if (0 == key % 2) {
+                ASSERTT(0 == list->find(&h, key));
+                ASSERTT(0 == list->remove(h));
+                ASSERTT(Obj::e_NOT_FOUND == list->remove(h));
+            }
+            else if (0 == list->front(&h)) {
+                int prevKey = h.key();
+                int count   = 0;
+                while (count < 100 && 0 == list->skipForward(&h) && h) {
+                    ASSERTT(prevKey <= h.key());
+                    prevKey = h.key();
+                    ++count;
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // Pop the front of the list until it is empty, while adding the owned
+        // keys at and above 'numKeys'.
+
+        for (int key = numKeys + id; key < 2 * numKeys; key += numThreads) {
+            list->addR(key, id);
+
+            Obj::PairHandle h;
+            if (0 == list->popFront(&h)) {
+                popped->push_back(h.key());
+            }
+        }
+
+        Obj::PairHandle h;
+        while (0 == list->popFront(&h)) {
+            popped->push_back(h.key());
+        }
+      } break;
+      case 4: {
+        // Add the same keys in all threads, so that exactly one 'addUnique'
+        // of each key succeeds, then move the added keys above 'numKeys',
+        // while looking up keys.
+
+        bsl::vector<Obj::PairHandle> added;
+        for (int key = 0; key < numKeys; ++key) {
+            Obj::PairHandle h;
+            int rc = list->addUnique(&h, key, id);
+            ASSERTT(0 == rc || Obj::e_DUPLICATE == rc);
+            if (0 == rc) {
+                added.push_back(h);
+            }
+            ASSERTT(list->exists(key));
+        }
+
+        barrier->wait();
+
+        for (bsl::size_t i = 0; i < added.size(); ++i) {
+            ASSERTT(0 == list->update(added[i],
+                                      added[i].key() + numKeys,
+                                      0,
+                                      false));
+
+            Obj::PairHandle h;
+            ASSERTT(0 == list->findR(&h, added[i].key()));
+            ASSERTT(id == h.data());
+        }
+      } break;
+    }
+}
+
 class SimpleScheduler
 {
     // DATA
@@ -783,6 +892,423 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 25: {
+        // --------------------------------------------------------------------
+        // LOCK-FREE MODE: CONCURRENCY
+        //
+        // Concerns:
+        //: 1 Concurrent adds, removals, lookups, iteration, 'popFront', and
+        //:   'update' on a lock-free list neither lose nor duplicate pairs,
+        //:   and keep the list ordered.
+        //:
+        //: 2 Exactly one of concurrent 'addUnique' calls for a key succeeds.
+        //:
+        //: 3 All memory of removed pairs is reclaimed.
+        //
+        // Plan:
+        //: 1 In successive phases, run threads that add, remove, pop, and
+        //:   update disjoint or overlapping sets of keys while looking up and
+        //:   iterating, and verify the contents of the list after each phase.
+        //:   (C-1..2)
+        //:
+        //: 2 Verify that the test allocator has no memory in use once the list
+        //:   is destroyed.  (C-3)
+        //
+        // Testing:
+        //   CONCURRENCY OF LOCK-FREE MODE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LOCK-FREE MODE: CONCURRENCY" << endl
+                          << "===========================" << endl;
+
+        typedef bdlcc::SkipList<int, int> Obj;
+
+        enum {
+            k_NUM_THREADS = 4,
+            k_NUM_KEYS    = 4000
+        };
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj mX(bdlcc::SkipListMode::e_LOCK_FREE, &ta);
+            const Obj& X = mX;
+
+            bslmt::Barrier   barrier(k_NUM_THREADS);
+            bsl::vector<int> popped[k_NUM_THREADS];
+
+            for (int phase = 1; phase <= 4; ++phase) {
+                if (verbose) { P(phase) }
+
+                bslmt::ThreadGroup tg;
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    tg.addThread(bdlf::BindUtil::bind(&case25,
+                                                      &mX,
+                                                      phase,
+                                                      i,
+                                                      (int)k_NUM_THREADS,
+                                                      (int)k_NUM_KEYS,
+                                                      &popped[i],
+                                                      &barrier));
+                }
+                tg.joinAll();
+
+                Obj::PairHandle h;
+                int             expected = 0;
+
+                switch (phase) {
+                  case 1: {
+                    ASSERTV(X.length(), k_NUM_KEYS == X.length());
+
+                    for (int rc = X.front(&h);
+                         0 == rc && h;
+                         rc = X.skipForward(&h)) {
+                        ASSERTV(expected, h.key(), expected == h.key());
+                        ++expected;
+                    }
+                    ASSERTV(expected, k_NUM_KEYS == expected);
+                  } break;
+                  case 2: {
+                    ASSERTV(X.length(), k_NUM_KEYS / 2 == X.length());
+
+                    for (int key = 0; key < k_NUM_KEYS; ++key) {
+                        ASSERTV(key, (1 == key % 2) == X.exists(key));
+                    }
+                  } break;
+                  case 3: {
+                    ASSERT(X.isEmpty());
+                    ASSERTV(X.length(), 0 == X.length());
+
+                    bsl::vector<int> all;
+                    for (int i = 0; i < k_NUM_THREADS; ++i) {
+                        for (bsl::size_t j = 0; j < popped[i].size(); ++j) {
+                            all.push_back(popped[i][j]);
+                        }
+                    }
+                    bsl::sort(all.begin(), all.end());
+
+                    bsl::vector<int> exp;
+                    for (int key = 1; key < k_NUM_KEYS; key += 2) {
+                        exp.push_back(key);
+                    }
+                    for (int key = k_NUM_KEYS; key < 2 * k_NUM_KEYS; ++key) {
+                        exp.push_back(key);
+                    }
+                    ASSERTV(all.size(), exp.size(), exp == all);
+                  } break;
+                  case 4: {
+                    ASSERTV(X.length(), k_NUM_KEYS == X.length());
+
+                    expected = k_NUM_KEYS;
+                    for (int rc = X.front(&h);
+                         0 == rc && h;
+                         rc = X.skipForward(&h)) {
+                        ASSERTV(expected, h.key(), expected == h.key());
+                        ++expected;
+                    }
+                    ASSERTV(expected, 2 * k_NUM_KEYS == expected);
+                  } break;
+                }
+            }
+        }
+        ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+      } break;
+      case 24: {
+        // --------------------------------------------------------------------
+        // LOCK-FREE MODE: CONFORMANCE
+        //
+        // Concerns:
+        //: 1 A list constructed in lock-free mode reports that mode, and its
+        //:   copies are in the same mode.
+        //:
+        //: 2 Single-threaded, every operation on a lock-free list has the same
+        //:   result and effect as on a list in the default (locked) mode,
+        //:   including the relative order of pairs with equal keys.
+        //:
+        //: 3 References to pairs removed from a lock-free list remain valid
+        //:   until released, and operations on them report 'e_NOT_FOUND'.
+        //:
+        //: 4 The key and data of every pair are destroyed exactly once, and
+        //:   all memory is reclaimed.
+        //
+        // Plan:
+        //: 1 Construct lists in both modes and verify 'mode'.  (C-1)
+        //:
+        //: 2 Apply the same pseudo-random sequence of operations to a locked
+        //:   and a lock-free list, comparing the results and the values of
+        //:   the lists after each operation.  Then compare iteration in both
+        //:   directions, copies, assignment, printing, and 'removeAll'.
+        //:   (C-1..2)
+        //:
+        //: 3 Remove a pair to which a handle is held, and verify the handle
+        //:   and the operations taking it.  (C-3)
+        //:
+        //: 4 Count the destructions of 'CountedDelete' data, and verify the
+        //:   test allocator has no memory in use at the end.  (C-4)
+        //
+        // Testing:
+        //   SkipList(SkipListMode::Enum, bslma::Allocator *);
+        //   SkipListMode::Enum mode() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LOCK-FREE MODE: CONFORMANCE" << endl
+                          << "===========================" << endl;
+
+        typedef bdlcc::SkipList<int, int> Obj;
+        typedef Obj::PairHandle           H;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj mL(&ta);                                   const Obj& L = mL;
+            Obj mX(bdlcc::SkipListMode::e_LOCK_FREE, &ta); const Obj& X = mX;
+
+            ASSERT(bdlcc::SkipListMode::e_LOCKED    == L.mode());
+            ASSERT(bdlcc::SkipListMode::e_LOCK_FREE == X.mode());
+            ASSERT(X.isEmpty());
+            ASSERT(L == X);
+
+            if (verbose) cout << "\tRandom operations." << endl;
+
+            int seed = 12345;
+            for (int i = 0; i < 6000; ++i) {
+                const int op     = bdlb::Random::generate15(&seed) % 10;
+                const int key    = bdlb::Random::generate15(&seed) % 32;
+                const int newKey = bdlb::Random::generate15(&seed) % 32;
+
+                bool lFront = false;
+                bool xFront = false;
+                H    lH, xH, lN, xN;
+
+                switch (op) {
+                  case 0: {
+                    mL.add(key, i, &lFront);
+                    mX.add(key, i, &xFront);
+                    ASSERTV(i, lFront == xFront);
+                  } break;
+                  case 1: {
+                    mL.addR(&lH, key, i, &lFront);
+                    mX.addR(&xH, key, i, &xFront);
+                    ASSERTV(i, lFront == xFront);
+                    ASSERTV(i, lH.data() == xH.data());
+                  } break;
+                  case 2: {
+                    const int lRc = mL.addUnique(key, i, &lFront);
+                    const int xRc = mX.addUnique(key, i, &xFront);
+                    ASSERTV(i, lRc, xRc, lRc == xRc);
+                    ASSERTV(i, 0 != lRc || lFront == xFront);
+                  } break;
+                  case 3: {
+                    const int lRc = L.find(&lH, key);
+                    const int xRc = X.find(&xH, key);
+                    ASSERTV(i, lRc, xRc, lRc == xRc);
+                    if (0 == lRc) {
+                        ASSERTV(i, lH.data() == xH.data());
+                        ASSERTV(i, 0 == mL.remove(lH));
+                        ASSERTV(i, 0 == mX.remove(xH));
+                        ASSERTV(i, Obj::e_NOT_FOUND == mX.remove(xH));
+                    }
+                  } break;
+                  case 4: {
+                    const int lRc = L.findR(&lH, key);
+                    const int xRc = X.findR(&xH, key);
+                    ASSERTV(i, lRc, xRc, lRc == xRc);
+                    if (0 == lRc) {
+                        ASSERTV(i, lH.data() == xH.data());
+                        ASSERTV(i, 0 == mL.remove(lH));
+                        ASSERTV(i, 0 == mX.remove(xH));
+                    }
+                  } break;
+                  case 5: {
+                    const int lRc = mL.popFront(&lH);
+                    const int xRc = mX.popFront(&xH);
+                    ASSERTV(i, lRc, xRc, lRc == xRc);
+                    ASSERTV(i, 0 != lRc || lH.data() == xH.data());
+                  } break;
+                  case 6: {
+                    if (0 == L.find(&lH, key)) {
+                        ASSERTV(i, 0 == X.find(&xH, key));
+
+                        const int lRc = mL.update(lH, newKey, &lFront);
+                        const int xRc = mX.update(xH, newKey, &xFront);
+                        ASSERTV(i, lRc, xRc, lRc == xRc);
+
+                        // Note that a locked list reports 'false' if the pair
+                        // was already at the front and stays there.
+
+                        ASSERTV(i, 0 == X.front(&xN));
+                        ASSERTV(i, xFront == (xN == xH));
+                    }
+                  } break;
+                  case 7: {
+                    if (0 == L.findR(&lH, key)) {
+                        ASSERTV(i, 0 == X.findR(&xH, key));
+
+                        const int lRc = mL.updateR(lH, newKey, &lFront, false);
+                        const int xRc = mX.updateR(xH, newKey, &xFront, false);
+                        ASSERTV(i, lRc, xRc, lRc == xRc);
+
+                        ASSERTV(i, 0 == X.front(&xN));
+                        ASSERTV(i, 0 != xRc || xFront == (xN == xH));
+                    }
+                  } break;
+                  case 8: {
+                    int lRc = L.back(&lH);
+                    int xRc = X.back(&xH);
+                    ASSERTV(i, lRc, xRc, lRc == xRc);
+                    ASSERTV(i, 0 != lRc || lH.data() == xH.data());
+
+                    if (0 == L.find(&lH, key)) {
+                        ASSERTV(i, 0 == X.find(&xH, key));
+
+                        lRc = L.next(&lN, lH);
+                        xRc = X.next(&xN, xH);
+                        ASSERTV(i, lRc, xRc, lRc == xRc);
+                        ASSERTV(i, 0 != lRc || lN.data() == xN.data());
+
+                        lRc = L.previous(&lN, lH);
+                        xRc = X.previous(&xN, xH);
+                        ASSERTV(i, lRc, xRc, lRc == xRc);
+                        ASSERTV(i, 0 != lRc || lN.data() == xN.data());
+                    }
+                  } break;
+                  case 9: {
+                    ASSERTV(i, L.exists(key) == X.exists(key));
+                    ASSERTV(i, L.isEmpty() == X.isEmpty());
+
+                    if (0 == i % 7) {
+                        bsl::vector<H> lV, xV;
+                        const int lRc = mL.removeAll(&lV);
+                        const int xRc = mX.removeAll(&xV);
+                        ASSERTV(i, lRc, xRc, lRc == xRc);
+                        ASSERTV(i, lV.size() == xV.size());
+                        for (bsl::size_t j = 0; j < lV.size(); ++j) {
+                            ASSERTV(i, j, lV[j].key()  == xV[j].key());
+                            ASSERTV(i, j, lV[j].data() == xV[j].data());
+                        }
+                    }
+                  } break;
+                }
+
+                ASSERTV(i, L.length(), X.length(), L.length() == X.length());
+                ASSERTV(i, L == X);
+                ASSERTV(i, !(L != X));
+            }
+
+            if (verbose) cout << "\tIteration." << endl;
+            {
+                H lH, xH;
+
+                int lRc = L.front(&lH);
+                int xRc = X.front(&xH);
+                while (0 == lRc && lH) {
+                    ASSERT(0 == xRc && xH);
+                    ASSERT(lH.data() == xH.data());
+                    lRc = L.skipForward(&lH);
+                    xRc = X.skipForward(&xH);
+                    ASSERTV(lRc, xRc, lRc == xRc);
+                }
+                ASSERT(!xH);
+
+                lRc = L.back(&lH);
+                xRc = X.back(&xH);
+                while (0 == lRc && lH) {
+                    ASSERT(0 == xRc && xH);
+                    ASSERT(lH.data() == xH.data());
+                    lRc = L.skipBackward(&lH);
+                    xRc = X.skipBackward(&xH);
+                    ASSERTV(lRc, xRc, lRc == xRc);
+                }
+                ASSERT(!xH);
+            }
+
+            if (verbose) cout << "\tHandles to removed pairs." << endl;
+            {
+                H h, h2;
+                mX.add(&h, 100, -1);
+                ASSERT(0 == mX.remove(h));
+                ASSERT(Obj::e_NOT_FOUND == mX.remove(h));
+                ASSERT(100 == h.key());
+                ASSERT(-1  == h.data());
+                ASSERT(0 != X.next(&h2, h));
+                ASSERT(0 != X.previous(&h2, h));
+                ASSERT(Obj::e_NOT_FOUND == mX.update(h, 5));
+                ASSERT(Obj::e_NOT_FOUND == X.skipForward(&h));
+                ASSERT(Obj::e_NOT_FOUND == X.skipBackward(&h));
+                ASSERT(h);
+                ASSERT(L == X);
+
+                ASSERT(0 == mX.addUniqueR(&h, 100, -1));
+                ASSERT(Obj::e_DUPLICATE == mX.addUniqueR(100, -2));
+                ASSERT(Obj::e_DUPLICATE == mX.addUnique(100, -3));
+                ASSERT(0 == mX.remove(h));
+                ASSERT(L == X);
+            }
+
+            if (verbose) cout << "\tCopy and assignment." << endl;
+            {
+                Obj mY(X, &ta);
+                ASSERT(bdlcc::SkipListMode::e_LOCK_FREE == mY.mode());
+                ASSERT(mY == L);
+
+                Obj mZ(&ta);
+                mZ = X;
+                ASSERT(bdlcc::SkipListMode::e_LOCKED == mZ.mode());
+                ASSERT(mZ == L);
+
+                mY.add(-1, -1);
+                ASSERT(mY != L);
+                mY = L;
+                ASSERT(bdlcc::SkipListMode::e_LOCK_FREE == mY.mode());
+                ASSERT(mY == X);
+            }
+
+            if (verbose) cout << "\tPrinting." << endl;
+            {
+                Obj mA(&ta);
+                Obj mB(bdlcc::SkipListMode::e_LOCK_FREE, &ta);
+                for (int level = 0; level < 3; ++level) {
+                    mA.addAtLevelRaw(0, level, level, 10 * level);
+                    mB.addAtLevelRaw(0, level, level, 10 * level);
+                }
+
+                bsl::ostringstream aOs, bOs;
+                aOs << mA;
+                bOs << mB;
+                ASSERTV(aOs.str(), bOs.str(), aOs.str() == bOs.str());
+
+                aOs.str("");
+                bOs.str("");
+                mA.print(aOs, 1, 4);
+                mB.print(bOs, 1, 4);
+                ASSERTV(aOs.str(), bOs.str(), aOs.str() == bOs.str());
+            }
+        }
+        ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tDestruction of data." << endl;
+        {
+            typedef bdlcc::SkipList<int, CountedDelete> CObj;
+
+            {
+                CObj mX(bdlcc::SkipListMode::e_LOCK_FREE, &ta);
+                CObj::PairHandle h;
+                for (int i = 0; i < 100; ++i) {
+                    mX.add(i, CountedDelete());
+                }
+                ASSERT(0 == mX.find(&h, 10));
+                for (int i = 0; i < 50; ++i) {
+                    ASSERT(0 == mX.popFront());
+                }
+                ASSERTV(CountedDelete::getDeleteCount(),
+                        0 < CountedDelete::getDeleteCount());
+                mX.removeAll();
+            }
+            ASSERTV(CountedDelete::getDeleteCount(),
+                    100 == CountedDelete::getDeleteCount());
+        }
+        ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+      } break;
       case 23: {
         // --------------------------------------------------------------------
         // DISTRIBUTION TEST
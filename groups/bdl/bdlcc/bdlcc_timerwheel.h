@@ -0,0 +1,1728 @@
+// bdlcc_timerwheel.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLCC_TIMERWHEEL
+#define INCLUDED_BDLCC_TIMERWHEEL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a hierarchical timer wheel with the interface of TimeQueue.
+//
+//@CLASSES:
+//      bdlcc::TimerWheel: hierarchical hashed timer wheel of 'DATA' items
+//  bdlcc::TimerWheelMode: namespace for the precision modes of a 'TimerWheel'
+//
+//@SEE_ALSO: bdlcc_timequeue, bdlmt_timereventscheduler
+//
+//@DESCRIPTION: This component defines a class template, 'bdlcc::TimerWheel',
+// that provides a thread-safe queue of time events having the interface of
+// 'bdlcc::TimeQueue', but in which adding, removing, and updating (i.e.,
+// rescheduling) an item take constant time, independently of the number of
+// items in the queue.
+//
+// 'bdlcc::TimeQueue' keeps its items in a 'bsl::map' ordered by time, so that
+// each 'add', 'remove', and 'update' costs a logarithmic number of
+// comparisons, and the insertion or removal of a node of the map, under the
+// mutex of the queue.  A client that reschedules the read timeout of each of
+// a large number of connections upon every read spends most of its use of the
+// queue in 'update', and contends on its mutex as a result.  A
+// 'bdlcc::TimerWheel' is suited to such clients: its items are not ordered
+// with respect to one another as they are added, but are hashed by time into
+// buckets, and only the items that have come due are sorted, as they are
+// popped.
+//
+///Structure
+///---------
+// Time is divided into *ticks* of a fixed duration, the *resolution* of the
+// wheel, specified at construction (1 millisecond by default).  The wheel
+// consists of 4 levels of 256 buckets each: a bucket of level 0 holds the
+// items due in one tick, a bucket of level 1 the items due in a range of 256
+// ticks, a bucket of level 2 the items due in a range of '256 * 256' ticks,
+// and a bucket of level 3 the items due in a range of '256 * 256 * 256' ticks.
+// Each item is placed at the lowest level having a bucket for its tick,
+// relative to the current tick of the wheel.  The items due more than
+// '2 ** 32' ticks after the current tick (about 50 days at the default
+// resolution) are kept in a separate overflow list.
+//
+// As 'popLE' advances the current tick, the earliest bucket of a level above
+// 0 is redistributed ("cascaded") into the levels below it, so that each item
+// moves at most once per level between the time it is added and the time it
+// is popped.  A bitmap of the non-empty buckets locates the earliest bucket in
+// constant time, however far apart in time the items are.  Adding, removing,
+// and updating an item therefore take constant time, and popping an item
+// takes amortized constant time, plus its share of sorting the items due in
+// the same tick.
+//
+///Exact and Coarse Modes
+///----------------------
+// A 'bdlcc::TimerWheel' operates in one of two modes, specified at
+// construction by a 'bdlcc::TimerWheelMode::Enum' value:
+//
+//: 'e_EXACT' (the default):
+//:   The wheel behaves as a 'bdlcc::TimeQueue': 'popLE' removes, in time
+//:   order, the items whose time is less than or equal to the specified time,
+//:   and 'minTime' reports the time of the earliest item.  The resolution only
+//:   affects performance: each bucket keeps track of its earliest item as
+//:   items are placed in it, so that reporting the earliest time, or whether
+//:   an added item is the new earliest item, takes constant time, except that
+//:   the wheel scans the items of the earliest bucket the first time its
+//:   earliest item is needed after that item was removed.
+//:
+//: 'e_COARSE':
+//:   The time of each item is rounded up to the next tick boundary, and the
+//:   items due in the same tick are considered simultaneous: 'popLE' removes,
+//:   in the order of their rounded-up times (and in an unspecified order
+//:   within a tick), the items whose rounded-up time is less than or equal to
+//:   the specified time, so that an item may be popped up to one tick after
+//:   its time, but never before.  'minTime' reports, in constant time, a time
+//:   that is never later than the rounded-up time of the earliest item, but
+//:   may be earlier (down to the start of the time range of the earliest
+//:   bucket): a client that waits until 'minTime' and then calls 'popLE' may
+//:   occasionally find no item due.
+//
+// Note that, in both modes, the time of a popped item (i.e., 'item.time()') is
+// the time with which the item was last added or updated.
+//
+///Interface Compatibility with 'bdlcc::TimeQueue'
+///-----------------------------------------------
+// 'bdlcc::TimerWheel<DATA>' uses the 'Handle' and 'Key' types of
+// 'bdlcc::TimeQueue<DATA>', exchanges items as 'bdlcc::TimeQueueItem<DATA>'
+// objects, and provides the manipulators and accessors of
+// 'bdlcc::TimeQueue<DATA>', with the same signatures and, in exact mode, the
+// same behavior.  In particular, a time wheel can be constructed with a
+// 'numIndexBits' argument, which has the same meaning for the uniqueness and
+// reuse of handles as for a time queue (see 'bdlcc_timequeue').  A client,
+// such as 'bdlmt::TimerEventScheduler', can therefore switch from one to the
+// other by changing a 'typedef'.
+//
+///Thread Safety
+///-------------
+// It is safe to access or modify two distinct 'bdlcc::TimerWheel' objects
+// simultaneously, each from a separate thread.  It is safe to access or modify
+// a single 'bdlcc::TimerWheel' object simultaneously from two or more separate
+// threads.
+//
+// As for 'bdlcc::TimeQueue', it is safe to enqueue objects in a
+// 'bdlcc::TimerWheel' object whose destructor may access or even modify the
+// same 'bdlcc::TimerWheel' object, but there is no guarantee regarding the
+// safety of enqueuing objects whose copy constructors or assignment operators
+// may access or modify the same object (except 'length').
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Connection Read Timeouts
+///- - - - - - - - - - - - - - - - - -
+// Suppose that a server closes the connections on which no data has been read
+// for 30 seconds.  Upon each read, the timeout of the connection is pushed
+// back, so that the timer of a connection is updated far more often than it
+// expires.
+//
+// First, we define a class, 'my_ConnectionMonitor', that keeps a timer for
+// each connection in a coarse 'bdlcc::TimerWheel' having a resolution of 10
+// milliseconds, as closing a connection a few milliseconds late is of no
+// consequence:
+//..
+//  class my_ConnectionMonitor {
+//      // This class monitors the inactivity of connections identified by an
+//      // integer.
+//
+//      // DATA
+//      bdlcc::TimerWheel<int> d_timers;   // timers, holding connection ids
+//      bsls::TimeInterval     d_timeout;  // inactivity timeout
+//
+//    public:
+//      // TYPES
+//      typedef bdlcc::TimerWheel<int>::Handle Handle;
+//
+//      // CREATORS
+//      explicit my_ConnectionMonitor(const bsls::TimeInterval& timeout)
+//          // Create a monitor closing the connections after the specified
+//          // 'timeout' of inactivity.
+//      : d_timers(bsls::TimeInterval(0, 10 * 1000 * 1000),
+//                 bdlcc::TimerWheelMode::e_COARSE)
+//      , d_timeout(timeout)
+//      {
+//      }
+//
+//      // MANIPULATORS
+//      Handle open(int connectionId, const bsls::TimeInterval& now)
+//          // Start monitoring the connection having the specified
+//          // 'connectionId', opened at the specified 'now' time, and return
+//          // the handle of its timer.
+//      {
+//          return d_timers.add(now + d_timeout, connectionId);
+//      }
+//
+//      void onRead(Handle handle, const bsls::TimeInterval& now)
+//          // Push back the timeout of the connection having the specified
+//          // 'handle' upon a read at the specified 'now' time.
+//      {
+//          d_timers.update(handle, now + d_timeout);
+//      }
+//
+//      void close(Handle handle)
+//          // Stop monitoring the connection having the specified 'handle'.
+//      {
+//          d_timers.remove(handle);
+//      }
+//
+//      void expire(bsl::vector<int>          *expired,
+//                  const bsls::TimeInterval&  now)
+//          // Stop monitoring the connections that have been inactive for the
+//          // timeout as of the specified 'now' time, and append their
+//          // identifiers to the specified 'expired' vector.
+//      {
+//          bsl::vector<bdlcc::TimeQueueItem<int> > items;
+//          d_timers.popLE(now, &items);
+//          for (bsl::size_t i = 0; i < items.size(); ++i) {
+//              expired->push_back(items[i].data());
+//          }
+//      }
+//  };
+//..
+// Then, we open three connections at time 0:
+//..
+//  my_ConnectionMonitor monitor(bsls::TimeInterval(30, 0));
+//
+//  my_ConnectionMonitor::Handle h1 = monitor.open(1, bsls::TimeInterval());
+//  my_ConnectionMonitor::Handle h2 = monitor.open(2, bsls::TimeInterval());
+//  my_ConnectionMonitor::Handle h3 = monitor.open(3, bsls::TimeInterval());
+//..
+// Next, data is read on the first connection at time 10 and on the second
+// connection at time 20, and the third connection is closed:
+//..
+//  monitor.onRead(h1, bsls::TimeInterval(10, 0));
+//  monitor.onRead(h2, bsls::TimeInterval(20, 0));
+//  monitor.close(h3);
+//..
+// Finally, we observe that no connection has timed out at time 35, and that
+// the first connection has timed out at time 45:
+//..
+//  bsl::vector<int> expired;
+//
+//  monitor.expire(&expired, bsls::TimeInterval(35, 0));
+//  assert(expired.empty());
+//
+//  monitor.expire(&expired, bsls::TimeInterval(45, 0));
+//  assert(1 == expired.size());
+//  assert(1 == expired[0]);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLCC_TIMEQUEUE
+#include <bdlcc_timequeue.h>
+#endif
+
+#ifndef INCLUDED_BDLB_BITUTIL
+#include <bdlb_bitutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_LOCKGUARD
+#include <bslmt_lockguard.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_MUTEX
+#include <bslmt_mutex.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TIMEINTERVAL
+#include <bsls_timeinterval.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_ALGORITHM
+#include <bsl_algorithm.h>
+#endif
+
+#ifndef INCLUDED_BSL_CLIMITS
+#include <bsl_climits.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDINT
+#include <bsl_cstdint.h>
+#endif
+
+#ifndef INCLUDED_BSL_LIMITS
+#include <bsl_limits.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                            // =====================
+                            // struct TimerWheelMode
+                            // =====================
+
+struct TimerWheelMode {
+    // This 'struct' provides a namespace for enumerating the precision modes
+    // of a 'TimerWheel'.  See the component-level documentation for details.
+
+    // TYPES
+    enum Enum {
+        e_EXACT,   // items are popped, in time order, at their exact time
+        e_COARSE   // items are popped at the end of the tick of their time
+    };
+};
+
+                              // ================
+                              // class TimerWheel
+                              // ================
+
+template <class DATA>
+class TimerWheel {
+    // This class template provides a thread-safe queue of time events, having
+    // the interface of 'TimeQueue<DATA>', in which items are hashed by time in
+    // a hierarchy of buckets, so that adding, removing, and updating an item
+    // take constant time.  See the component-level documentation for details.
+
+    // PRIVATE TYPES
+    enum {
+        k_NUM_INDEX_BITS_MIN     = 8,
+        k_NUM_INDEX_BITS_MAX     = 24,
+        k_NUM_INDEX_BITS_DEFAULT = 17,
+
+        k_BITS_PER_LEVEL         = 8,
+        k_NUM_LEVELS             = 4,
+        k_NUM_SLOTS              = 1 << k_BITS_PER_LEVEL,
+        k_NUM_BUCKETS            = k_NUM_LEVELS * k_NUM_SLOTS,
+        k_OVERFLOW               = k_NUM_BUCKETS,  // index of overflow list
+        k_BITS_PER_WORD          = 64,
+        k_NUM_WORDS              = k_NUM_BUCKETS / k_BITS_PER_WORD,
+
+        k_NANOSECS_PER_SEC       = 1000 * 1000 * 1000,
+        k_DEFAULT_RESOLUTION     = 1000 * 1000     // in nanoseconds
+    };
+
+  public:
+    // TYPES
+    typedef typename TimeQueue<DATA>::Handle Handle;
+        // 'Handle' defines an alias for uniquely identifying a valid item in
+        // the wheel, having the same type and meaning as the handles of a
+        // 'TimeQueue<DATA>'.
+
+    typedef typename TimeQueue<DATA>::Key Key;
+        // 'Key' defines an alias for the type of the optional value supplied
+        // by clients to further identify an item in the wheel.
+
+  private:
+    // PRIVATE TYPES
+    struct Node {
+        // This 'struct' provides an item of the wheel.  The items of a bucket
+        // form a doubly-linked circular list in the order in which they were
+        // placed in the bucket.
+
+        int                       d_index;   // handle of the item
+        int                       d_bucket;  // bucket of the item, or -1
+        bsls::Types::Int64        d_tick;    // tick at which item is due
+        bsls::TimeInterval        d_time;    // time of the item
+        Key                       d_key;     // key of the item
+        Node                     *d_prev_p;  // previous node in bucket
+        Node                     *d_next_p;  // next node in bucket
+        bsls::ObjectBuffer<DATA>  d_data;    // data of the item
+
+        // CREATORS
+        Node()
+        : d_index(0)
+        , d_bucket(-1)
+        , d_tick(0)
+        , d_key(0)
+        , d_prev_p(0)
+        , d_next_p(0)
+            // Create a 'Node' that is in no bucket.
+        {
+        }
+    };
+
+    typedef bsls::Types::Int64  Int64;
+    typedef bsls::Types::Uint64 Uint64;
+
+    // DATA
+    const int                  d_indexMask;
+    const int                  d_indexIterationMask;
+    const int                  d_indexIterationInc;
+
+    const Int64                d_resolution;      // duration of a tick, in
+                                                  // nanoseconds
+
+    const TimerWheelMode::Enum d_mode;            // precision mode
+
+    mutable bslmt::Mutex       d_mutex;           // serializes access to the
+                                                  // buckets
+
+    bsl::vector<Node *>        d_nodeArray;       // all the nodes, by index
+
+    bsls::AtomicPointer<Node>  d_nextFreeNode_p;  // free list, singly linked
+                                                  // through 'd_next_p'
+
+    Node                      *d_buckets[k_NUM_BUCKETS + 1];
+                                                  // first node of each bucket,
+                                                  // level by level, followed
+                                                  // by the overflow list
+
+    mutable Node              *d_earliest[k_NUM_BUCKETS + 1];
+                                                  // earliest node of each
+                                                  // bucket, or 0 if the bucket
+                                                  // is empty or its earliest
+                                                  // node was unlinked
+
+    bsl::uint64_t              d_occupied[k_NUM_WORDS];
+                                                  // one bit per non-empty
+                                                  // bucket, excluding the
+                                                  // overflow list
+
+    Int64                      d_currentTick;     // tick relative to which
+                                                  // the items are placed
+
+    bsls::AtomicInt            d_length;          // number of items
+
+    bslma::Allocator          *d_allocator_p;     // allocator (held, not
+                                                  // owned)
+
+    // PRIVATE CLASS METHODS
+    static bsl::uint64_t bucketBit(int bucket);
+        // Return the bit of the specified 'bucket' in its word of the bitmap
+        // of the non-empty buckets.
+
+    static Int64 bucketStart(int bucket, Int64 currentTick);
+        // Return the first tick of the range of ticks of the specified
+        // 'bucket' of a level of the wheel when its current tick is the
+        // specified 'currentTick'.  The behavior is undefined unless
+        // '0 <= bucket < k_NUM_BUCKETS'.
+
+    // PRIVATE MANIPULATORS
+    Node *detachBucket(int bucket);
+        // Empty the specified 'bucket', and return the first of its nodes,
+        // which are singly linked through 'd_next_p' in their order in the
+        // bucket, the last one having a null 'd_next_p'.
+
+    void anchor(Int64 tick);
+        // Restart this wheel, which holds no items, at the specified 'tick'
+        // if 'tick' is earlier than the current tick, or too far after it to
+        // be placed in a level of the wheel.  Note that items popped or
+        // removed in the meantime may have left the current tick far behind
+        // (as does the construction of the wheel, at tick 0).
+
+    void freeNode(Node *node);
+        // Prepare the specified 'node' for being reused on the free list by
+        // incrementing the iteration count of its handle, and mark it as being
+        // in no bucket.
+
+    void insertNode(Node *node);
+        // Place the specified 'node', which is in no bucket, in the bucket
+        // for its tick relative to the current tick, or, if its tick is not
+        // later than the current tick, in the bucket of the current tick.
+
+    void linkNode(Node *node, int bucket);
+        // Append the specified 'node', which is in no bucket, to the specified
+        // 'bucket'.
+
+    int popDue(Node                              **freeList,
+               int                                *maxTimers,
+               int                                 bucket,
+               const bsls::TimeInterval&           time,
+               Int64                               tick,
+               bsl::vector<TimeQueueItem<DATA> >  *buffer);
+        // Remove from the specified 'bucket' of the current tick, in order, up
+        // to the specified 'maxTimers' of its items that are due at the
+        // specified 'time', whose tick is the specified 'tick', decrement
+        // 'maxTimers' by their number, optionally append them to the
+        // specified 'buffer', and prepend their nodes to the specified
+        // 'freeList'.  Return 0 if the bucket is empty upon return, and a
+        // non-zero value otherwise.
+
+    void popLEImp(const bsls::TimeInterval&          time,
+                  int                                maxTimers,
+                  bsl::vector<TimeQueueItem<DATA> > *buffer,
+                  int                               *newLength,
+                  bsls::TimeInterval                *newMinTime);
+        // Implement 'popLE' for the specified 'time', 'maxTimers', 'buffer',
+        // 'newLength', and 'newMinTime'.
+
+    void putFreeNode(Node *node);
+        // Destroy the data located at the specified 'node' and reattach this
+        // 'node' to the front of the free list.  Note that the caller must not
+        // have acquired the lock to this wheel.
+
+    void putFreeNodeList(Node *begin);
+        // Destroy the 'DATA' of every node in the singly-linked list starting
+        // at the specified 'begin' node and ending with a null pointer, and
+        // reattach these nodes to the front of the free list.  Note that the
+        // caller must not have acquired the lock to this wheel.
+
+    void redistribute(int bucket);
+        // Empty the specified 'bucket' and place each of its nodes again,
+        // relative to the current tick.
+
+    void unlinkNode(Node *node);
+        // Remove the specified 'node' from its bucket.
+
+    // PRIVATE ACCESSORS
+    int bucketOf(Int64 tick) const;
+        // Return the index of the bucket for the specified 'tick' relative to
+        // the current tick, which is the bucket of the current tick if 'tick'
+        // is not later than the current tick.
+
+    Node *earliestNode(int bucket) const;
+        // Return the earliest node of the specified non-empty 'bucket', or,
+        // if several nodes are the earliest, the first of them in the bucket.
+        // Note that the bucket is scanned only if its earliest node is not
+        // known, i.e., if that node was unlinked since it was last computed.
+
+    int firstBucket() const;
+        // Return the index of the bucket holding the earliest items, or -1 if
+        // this wheel is empty.
+
+    bool isLess(const Node *lhs, const Node *rhs) const;
+        // Return 'true' if the specified 'lhs' node is due before the
+        // specified 'rhs' node, and 'false' otherwise.
+
+    bool isNewTop(const Node *node) const;
+        // Return 'true' if the specified 'node', which is in no bucket, is due
+        // before every item of this wheel, and 'false' otherwise.
+
+    int minTimeImp(bsls::TimeInterval *buffer) const;
+        // Implement 'minTime' for the specified 'buffer', the lock to this
+        // wheel being held.
+
+    Node *sortList(Node *list) const;
+        // Sort, in a stable manner, the nodes of the specified 'list', singly
+        // linked through 'd_next_p', by their due times, and return the first
+        // node of the sorted list.
+
+    Int64 tickOf(const bsls::TimeInterval& time, bool roundUp) const;
+        // Return the tick of the specified 'time', rounded down, or, if the
+        // specified 'roundUp' is 'true', up.  Note that a time too far from
+        // the epoch for its number of nanoseconds to be representable is
+        // clamped.
+
+    bsls::TimeInterval timeOf(Int64 tick) const;
+        // Return the time at which the specified 'tick' begins.
+
+  private:
+    // NOT IMPLEMENTED
+    TimerWheel(const TimerWheel&);
+    TimerWheel& operator=(const TimerWheel&);
+
+  public:
+    // CREATORS
+    explicit TimerWheel(bslma::Allocator *basicAllocator = 0);
+    explicit TimerWheel(int               numIndexBits,
+                        bslma::Allocator *basicAllocator = 0);
+        // Create an empty timer wheel in exact mode, having a resolution of 1
+        // millisecond.  Optionally specify 'numIndexBits' to configure the
+        // number of index bits of the handles of this object.  If
+        // 'numIndexBits' is not specified a default value of 17 is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '8 <= numIndexBits <= 24'.
+        // See the component-level documentation of 'bdlcc_timequeue' for
+        // more information regarding 'numIndexBits'.
+
+    TimerWheel(const bsls::TimeInterval&  resolution,
+               TimerWheelMode::Enum       mode,
+               bslma::Allocator          *basicAllocator = 0);
+    TimerWheel(int                        numIndexBits,
+               const bsls::TimeInterval&  resolution,
+               TimerWheelMode::Enum       mode,
+               bslma::Allocator          *basicAllocator = 0);
+        // Create an empty timer wheel having the specified 'resolution' as
+        // the duration of a tick, and operating in the specified 'mode'.
+        // Optionally specify 'numIndexBits' to configure the number of index
+        // bits of the handles of this object.  If 'numIndexBits' is not
+        // specified a default value of 17 is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '8 <= numIndexBits <= 24', and
+        // 'bsls::TimeInterval() < resolution <= bsls::TimeInterval(3600, 0)'.
+
+    ~TimerWheel();
+        // Destroy this timer wheel.
+
+    // MANIPULATORS
+    Handle add(const bsls::TimeInterval&  time,
+               const DATA&                data,
+               int                       *isNewTop = 0,
+               int                       *newLength = 0);
+    Handle add(const bsls::TimeInterval&  time,
+               const DATA&                data,
+               const Key&                 key,
+               int                       *isNewTop = 0,
+               int                       *newLength = 0);
+        // Add a new item to this wheel having the specified 'time' value, and
+        // associated 'data'.  Optionally use the specified 'key' to uniquely
+        // identify the item in subsequent calls to 'remove' and 'update'.
+        // Optionally load into the optionally specified 'isNewTop' a non-zero
+        // value if the item is now due before every other item in this wheel,
+        // and a 0 value otherwise.  If specified, load into the optionally
+        // specified 'newLength', the new number of items in this wheel.
+        // Return a value that may be used to identify the newly added item in
+        // future calls to this wheel on success, and -1 if the maximum number
+        // of items has been reached.
+
+    Handle add(const TimeQueueItem<DATA>&  item,
+               int                        *isNewTop = 0,
+               int                        *newLength = 0);
+        // Add the value of the specified 'item' to this wheel.  Optionally
+        // load into the optionally specified 'isNewTop' a non-zero value if
+        // the item is now due before every other item in this wheel, and a 0
+        // value otherwise.  If specified, load into the optionally specified
+        // 'newLength', the new number of items in this wheel.  Return a value
+        // that may be used to identify the newly added item in future calls
+        // to this wheel on success, and -1 if the maximum number of items has
+        // been reached.
+
+    int popFront(TimeQueueItem<DATA> *buffer = 0,
+                 int                 *newLength = 0,
+                 bsls::TimeInterval  *newMinTime = 0);
+        // Atomically remove the earliest item from this wheel, and optionally
+        // load into the optionally specified 'buffer' the time and associated
+        // data of the item removed.  Optionally load into the optionally
+        // specified 'newLength', the number of items remaining in the wheel.
+        // Optionally load into the optionally specified 'newMinTime' the new
+        // value of 'minTime'.  Return 0 on success, and a non-zero value if
+        // there are no items in the wheel.  Note that if 'DATA' follows the
+        // 'bdema' allocator model, the allocator of the 'buffer' is used to
+        // supply memory.
+
+    void popLE(const bsls::TimeInterval&          time,
+               bsl::vector<TimeQueueItem<DATA> > *buffer = 0,
+               int                               *newLength = 0,
+               bsls::TimeInterval                *newMinTime = 0);
+        // Remove from this wheel all the items that are due at the specified
+        // 'time', and optionally append into the optionally specified
+        // 'buffer' a list of the removed items, ordered by their due times
+        // (earliest item first).  Optionally load into the optionally
+        // specified 'newLength' the number of items remaining in this wheel,
+        // and into the optionally specified 'newMinTime' the new value of
+        // 'minTime'.  In exact mode, an item is due if its time is less than
+        // or equal to 'time'; in coarse mode, if its time rounded up to a
+        // tick boundary is.  Note that 'newMinTime' is only loaded if there
+        // are items remaining in the wheel.  Also note that if 'DATA' follows
+        // the 'bdema' allocator model, the allocator of the 'buffer' vector is
+        // used to supply memory for the items appended to the 'buffer'.
+
+    void popLE(const bsls::TimeInterval&          time,
+               int                                maxTimers,
+               bsl::vector<TimeQueueItem<DATA> > *buffer = 0,
+               int                               *newLength = 0,
+               bsls::TimeInterval                *newMinTime = 0);
+        // Remove from this wheel up to the specified 'maxTimers' number of
+        // items that are due at the specified 'time', and optionally append
+        // into the optionally specified 'buffer' a list of the removed items,
+        // ordered by their due times (earliest item first).  Optionally load
+        // into the optionally specified 'newLength' the number of items
+        // remaining in this wheel, and into the optionally specified
+        // 'newMinTime' the new value of 'minTime'.  The behavior is undefined
+        // unless '0 <= maxTimers'.  Note that 'newMinTime' is only loaded if
+        // there are items remaining in the wheel.  Also note that if 'DATA'
+        // follows the 'bdema' allocator model, the allocator of the 'buffer'
+        // vector is used to supply memory.  Note finally that all the items
+        // appended into 'buffer' are due no later than the items remaining in
+        // this wheel.
+
+    int remove(Handle               handle,
+               int                 *newLength = 0,
+               bsls::TimeInterval  *newMinTime = 0,
+               TimeQueueItem<DATA> *item = 0);
+    int remove(Handle               handle,
+               const Key&           key,
+               int                 *newLength = 0,
+               bsls::TimeInterval  *newMinTime = 0,
+               TimeQueueItem<DATA> *item = 0);
+        // Remove from this wheel the item having the specified 'handle', and
+        // optionally load into the optionally specified 'item' the time and
+        // data values of the removed item.  Optionally use the specified
+        // 'key' to uniquely identify the item.  If specified, load into the
+        // optionally specified 'newLength' the number of items remaining in
+        // the wheel, and into the optionally specified 'newMinTime' the new
+        // value of 'minTime'.  Return 0 on success, and a non-zero value if no
+        // item with the 'handle' exists in the wheel.  Note that if 'DATA'
+        // follows the 'bdema' allocator model, the allocator of the 'item'
+        // instance is used to supply memory.
+
+    void removeAll(bsl::vector<TimeQueueItem<DATA> > *buffer = 0);
+        // Optionally load all the items in this wheel, ordered by their due
+        // times, to the optionally specified 'buffer', and remove all the
+        // items in this wheel.  Note that the allocator of the 'buffer'
+        // vector is used to supply memory.
+
+    int update(Handle                     handle,
+               const bsls::TimeInterval&  newTime,
+               int                       *isNewTop = 0);
+    int update(Handle                     handle,
+               const Key&                 key,
+               const bsls::TimeInterval&  newTime,
+               int                       *isNewTop = 0);
+        // Update the time value of the item having the specified 'handle' to
+        // the specified 'newTime' and optionally load into the optionally
+        // specified 'isNewTop' a non-zero value if the modified item is now
+        // due before every other item in this wheel, and a 0 value otherwise.
+        // Optionally use the specified 'key' to uniquely identify the item.
+        // Return 0 on success, and a non-zero value if there is currently no
+        // item having the 'handle' registered with this wheel.
+
+    // ACCESSORS
+    bool isRegisteredHandle(Handle handle) const;
+    bool isRegisteredHandle(Handle handle, const Key& key) const;
+        // Return 'true' if an item having the specified 'handle' (and
+        // optionally specified 'key') is currently registered with this
+        // wheel, and 'false' otherwise.
+
+    int length() const;
+        // Return a "snapshot" of the current number of items in this wheel.
+
+    int minTime(bsls::TimeInterval *buffer) const;
+        // Load into the specified 'buffer' the time of the earliest item in
+        // this wheel, or, in coarse mode, a time no later than the rounded-up
+        // time of the earliest item (see the component-level documentation).
+        // Return 0 on success, and a non-zero value if this wheel is empty.
+
+    TimerWheelMode::Enum mode() const;
+        // Return the precision mode of this wheel.
+
+    bsls::TimeInterval resolution() const;
+        // Return the duration of a tick of this wheel.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // ----------------
+                              // class TimerWheel
+                              // ----------------
+
+// PRIVATE CLASS METHODS
+template <class DATA>
+inline
+bsl::uint64_t TimerWheel<DATA>::bucketBit(int bucket)
+{
+    return static_cast<bsl::uint64_t>(1) << (bucket % k_BITS_PER_WORD);
+}
+
+template <class DATA>
+inline
+bsls::Types::Int64 TimerWheel<DATA>::bucketStart(int   bucket,
+                                                 Int64 currentTick)
+{
+    const int shift = (bucket / k_NUM_SLOTS) * k_BITS_PER_LEVEL;
+    const int slot  = bucket % k_NUM_SLOTS;
+
+    const int width = shift + k_BITS_PER_LEVEL;
+
+    Uint64 start = static_cast<Uint64>(currentTick);
+    start = (start >> width) << width;
+    return static_cast<Int64>(start | (static_cast<Uint64>(slot) << shift));
+}
+
+// PRIVATE MANIPULATORS
+template <class DATA>
+inline
+void TimerWheel<DATA>::anchor(Int64 tick)
+{
+    if (tick < d_currentTick || k_OVERFLOW == bucketOf(tick)) {
+        d_currentTick = tick;
+    }
+}
+
+template <class DATA>
+typename TimerWheel<DATA>::Node *TimerWheel<DATA>::detachBucket(int bucket)
+{
+    Node *first = d_buckets[bucket];
+    if (first) {
+        first->d_prev_p->d_next_p = 0;
+
+        d_buckets[bucket]  = 0;
+        d_earliest[bucket] = 0;
+        if (k_OVERFLOW != bucket) {
+            d_occupied[bucket / k_BITS_PER_WORD] &= ~bucketBit(bucket);
+        }
+    }
+    return first;
+}
+
+template <class DATA>
+inline
+void TimerWheel<DATA>::freeNode(Node *node)
+{
+    node->d_index = ((node->d_index + d_indexIterationInc) &
+                         d_indexIterationMask) | (node->d_index & d_indexMask);
+
+    if (!(node->d_index & d_indexIterationMask)) {
+        node->d_index += d_indexIterationInc;
+    }
+    node->d_bucket = -1;
+    node->d_prev_p = 0;
+}
+
+template <class DATA>
+inline
+void TimerWheel<DATA>::insertNode(Node *node)
+{
+    linkNode(node, bucketOf(node->d_tick));
+}
+
+template <class DATA>
+void TimerWheel<DATA>::linkNode(Node *node, int bucket)
+{
+    node->d_bucket = bucket;
+
+    Node *first = d_buckets[bucket];
+    if (first) {
+        node->d_prev_p = first->d_prev_p;
+        node->d_next_p = first;
+        first->d_prev_p->d_next_p = node;
+        first->d_prev_p = node;
+
+        // An appended node replaces the earliest node of the bucket only if
+        // it is strictly earlier, so that the first of equal nodes is kept.
+        // An unknown earliest node stays unknown.
+
+        Node *earliest = d_earliest[bucket];
+        if (earliest && isLess(node, earliest)) {
+            d_earliest[bucket] = node;
+        }
+    }
+    else {
+        node->d_prev_p = node;
+        node->d_next_p = node;
+        d_buckets[bucket]  = node;
+        d_earliest[bucket] = node;
+        if (k_OVERFLOW != bucket) {
+            d_occupied[bucket / k_BITS_PER_WORD] |= bucketBit(bucket);
+        }
+    }
+}
+
+template <class DATA>
+int TimerWheel<DATA>::popDue(Node                              **freeList,
+                             int                                *maxTimers,
+                             int                                 bucket,
+                             const bsls::TimeInterval&           time,
+                             Int64                               tick,
+                             bsl::vector<TimeQueueItem<DATA> >  *buffer)
+{
+    // The bucket of the current tick may hold items due before the current
+    // tick (i.e., added after the current tick was reached), and, in exact
+    // mode, items due after 'time' in the same tick: separate the due items,
+    // and put the others back.
+
+    Node  *due     = 0;
+    Node **dueTail = &due;
+
+    Node *node = detachBucket(bucket);
+    while (node) {
+        Node *next = node->d_next_p;
+
+        if (TimerWheelMode::e_EXACT == d_mode ? node->d_time <= time
+                                              : node->d_tick <= tick) {
+            *dueTail = node;
+            dueTail  = &node->d_next_p;
+        }
+        else {
+            linkNode(node, bucket);
+        }
+        node = next;
+    }
+    *dueTail = 0;
+
+    due = sortList(due);
+
+    while (due && 0 < *maxTimers) {
+        node = due;
+        due  = due->d_next_p;
+
+        if (buffer) {
+            buffer->push_back(TimeQueueItem<DATA>(node->d_time,
+                                                  node->d_data.object(),
+                                                  node->d_index,
+                                                  node->d_key,
+                                                  d_allocator_p));
+        }
+        freeNode(node);
+        node->d_next_p = *freeList;
+        *freeList = node;
+
+        --d_length;
+        --*maxTimers;
+    }
+
+    while (due) {
+        node = due;
+        due  = due->d_next_p;
+        linkNode(node, bucket);
+    }
+
+    return 0 != d_buckets[bucket];
+}
+
+template <class DATA>
+void TimerWheel<DATA>::popLEImp(
+                               const bsls::TimeInterval&          time,
+                               int                                maxTimers,
+                               bsl::vector<TimeQueueItem<DATA> > *buffer,
+                               int                               *newLength,
+                               bsls::TimeInterval                *newMinTime)
+{
+    BSLS_ASSERT(0 <= maxTimers);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    const Int64 tick = tickOf(time, false);
+
+    // Advance the current tick, never beyond 'tick', to the earliest bucket,
+    // cascading the buckets of the upper levels into the lower ones, until
+    // the earliest bucket is not due or 'maxTimers' items have been popped.
+
+    Node *begin = 0;
+    while (0 < maxTimers) {
+        const int bucket = firstBucket();
+
+        if (0 > bucket) {
+            break;
+        }
+
+        if (k_OVERFLOW == bucket) {
+            const Int64 minTick = earliestNode(bucket)->d_tick;
+            if (minTick > tick) {
+                break;
+            }
+            d_currentTick = minTick;
+            redistribute(bucket);
+            continue;
+        }
+
+        const Int64 start = bucketStart(bucket, d_currentTick);
+
+        if (k_NUM_SLOTS <= bucket) {
+            if (start > tick) {
+                break;
+            }
+            d_currentTick = start;
+            redistribute(bucket);
+            continue;
+        }
+
+        if (start != d_currentTick) {
+            if (start > tick) {
+                break;
+            }
+            d_currentTick = start;
+        }
+
+        if (0 != popDue(&begin, &maxTimers, bucket, time, tick, buffer)) {
+            break;
+        }
+    }
+
+    if (0 == d_length) {
+        // Restart an empty wheel at 'tick', which, being the time at which
+        // items are popped, is usually the current time.
+
+        d_currentTick = tick;
+    }
+
+    if (newLength) {
+        *newLength = d_length;
+    }
+    if (d_length && newMinTime) {
+        minTimeImp(newMinTime);
+    }
+
+    lock.release()->unlock();
+    putFreeNodeList(begin);
+}
+
+template <class DATA>
+void TimerWheel<DATA>::putFreeNode(Node *node)
+{
+    node->d_data.object().~DATA();
+
+    Node *nextFreeNode = d_nextFreeNode_p;
+    node->d_next_p = nextFreeNode;
+    while (nextFreeNode != d_nextFreeNode_p.testAndSwap(nextFreeNode, node)) {
+        nextFreeNode = d_nextFreeNode_p;
+        node->d_next_p = nextFreeNode;
+    }
+}
+
+template <class DATA>
+void TimerWheel<DATA>::putFreeNodeList(Node *begin)
+{
+    if (begin) {
+        begin->d_data.object().~DATA();
+
+        Node *end = begin;
+        while (end->d_next_p) {
+            end = end->d_next_p;
+            end->d_data.object().~DATA();
+        }
+
+        Node *nextFreeNode = d_nextFreeNode_p;
+        end->d_next_p = nextFreeNode;
+
+        while (nextFreeNode !=
+                           d_nextFreeNode_p.testAndSwap(nextFreeNode, begin)) {
+            nextFreeNode = d_nextFreeNode_p;
+            end->d_next_p = nextFreeNode;
+        }
+    }
+}
+
+template <class DATA>
+void TimerWheel<DATA>::redistribute(int bucket)
+{
+    Node *node = detachBucket(bucket);
+    while (node) {
+        Node *next = node->d_next_p;
+        insertNode(node);
+        node = next;
+    }
+}
+
+template <class DATA>
+void TimerWheel<DATA>::unlinkNode(Node *node)
+{
+    const int bucket = node->d_bucket;
+
+    if (node->d_next_p == node) {
+        d_buckets[bucket]  = 0;
+        d_earliest[bucket] = 0;
+        if (k_OVERFLOW != bucket) {
+            d_occupied[bucket / k_BITS_PER_WORD] &= ~bucketBit(bucket);
+        }
+    }
+    else {
+        node->d_prev_p->d_next_p = node->d_next_p;
+        node->d_next_p->d_prev_p = node->d_prev_p;
+        if (d_buckets[bucket] == node) {
+            d_buckets[bucket] = node->d_next_p;
+        }
+
+        // Defer finding the next earliest node until it is needed, so that
+        // removing several items between two queries scans the bucket once.
+
+        if (d_earliest[bucket] == node) {
+            d_earliest[bucket] = 0;
+        }
+    }
+    node->d_bucket = -1;
+}
+
+// PRIVATE ACCESSORS
+template <class DATA>
+int TimerWheel<DATA>::bucketOf(Int64 tick) const
+{
+    if (tick < d_currentTick) {
+        tick = d_currentTick;
+    }
+    const Uint64 diff = static_cast<Uint64>(tick)
+                      ^ static_cast<Uint64>(d_currentTick);
+
+    // Use the lowest level whose buckets share, with the current tick, all
+    // the digits of 'tick' above that level.
+
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        const int shift = level * k_BITS_PER_LEVEL;
+
+        if (0 == (diff >> (shift + k_BITS_PER_LEVEL))) {
+            const Uint64 slot = (static_cast<Uint64>(tick) >> shift)
+                              & (k_NUM_SLOTS - 1);
+
+            return level * k_NUM_SLOTS + static_cast<int>(slot);      // RETURN
+        }
+    }
+    return k_OVERFLOW;
+}
+
+template <class DATA>
+typename TimerWheel<DATA>::Node *
+TimerWheel<DATA>::earliestNode(int bucket) const
+{
+    Node *earliest = d_earliest[bucket];
+
+    if (!earliest) {
+        Node *const first = d_buckets[bucket];
+
+        earliest = first;
+        for (Node *node = first->d_next_p;
+             node != first;
+             node = node->d_next_p) {
+            if (isLess(node, earliest)) {
+                earliest = node;
+            }
+        }
+        d_earliest[bucket] = earliest;
+    }
+    return earliest;
+}
+
+template <class DATA>
+int TimerWheel<DATA>::firstBucket() const
+{
+    // The buckets are indexed level by level, and, within a level, by tick,
+    // so that the first non-empty bucket holds the earliest items.
+
+    for (int i = 0; i < k_NUM_WORDS; ++i) {
+        if (d_occupied[i]) {
+            return i * k_BITS_PER_WORD                                // RETURN
+                               + bdlb::BitUtil::numTrailingUnsetBits(
+                                                               d_occupied[i]);
+        }
+    }
+    return d_buckets[k_OVERFLOW] ? k_OVERFLOW : -1;
+}
+
+template <class DATA>
+inline
+bool TimerWheel<DATA>::isLess(const Node *lhs, const Node *rhs) const
+{
+    return TimerWheelMode::e_EXACT == d_mode ? lhs->d_time < rhs->d_time
+                                             : lhs->d_tick < rhs->d_tick;
+}
+
+template <class DATA>
+bool TimerWheel<DATA>::isNewTop(const Node *node) const
+{
+    const int bucket = firstBucket();
+
+    if (0 > bucket) {
+        return true;                                                  // RETURN
+    }
+
+    if (k_OVERFLOW != bucket) {
+        // Compare the tick of 'node' with the range of ticks of the earliest
+        // bucket, and scan the bucket only if the tick is within that range.
+        // Note that the bucket of the current tick may hold earlier ticks.
+
+        const int   level = bucket / k_NUM_SLOTS;
+        const Int64 start = bucketStart(bucket, d_currentTick);
+        const Int64 end   = start + ((static_cast<Int64>(1) <<
+                                              (level * k_BITS_PER_LEVEL)) - 1);
+
+        if (node->d_tick > end) {
+            return false;                                             // RETURN
+        }
+        if (node->d_tick < start && start != d_currentTick) {
+            return true;                                              // RETURN
+        }
+    }
+
+    return isLess(node, earliestNode(bucket));
+}
+
+template <class DATA>
+int TimerWheel<DATA>::minTimeImp(bsls::TimeInterval *buffer) const
+{
+    const int bucket = firstBucket();
+
+    if (0 > bucket) {
+        return 1;                                                     // RETURN
+    }
+
+    if (TimerWheelMode::e_COARSE == d_mode && k_OVERFLOW != bucket) {
+        const Int64 start = bucketStart(bucket, d_currentTick);
+
+        if (start != d_currentTick) {
+            // The start of the range of the bucket is a lower bound of the
+            // ticks of its items, and, at level 0, their tick.
+
+            *buffer = timeOf(start);
+            return 0;                                                 // RETURN
+        }
+    }
+
+    const Node *node = earliestNode(bucket);
+    *buffer = TimerWheelMode::e_EXACT == d_mode ? node->d_time
+                                                : timeOf(node->d_tick);
+    return 0;
+}
+
+template <class DATA>
+typename TimerWheel<DATA>::Node *TimerWheel<DATA>::sortList(Node *list) const
+{
+    if (!list || !list->d_next_p) {
+        return list;                                                  // RETURN
+    }
+
+    // Split the list in two halves, sort them, and merge them, taking from
+    // the first half on ties.
+
+    Node *middle = list;
+    Node *end    = list->d_next_p;
+    while (end && end->d_next_p) {
+        middle = middle->d_next_p;
+        end    = end->d_next_p->d_next_p;
+    }
+
+    Node *rhs = sortList(middle->d_next_p);
+    middle->d_next_p = 0;
+    Node *lhs = sortList(list);
+
+    Node  *result = 0;
+    Node **tail   = &result;
+    while (lhs && rhs) {
+        if (isLess(rhs, lhs)) {
+            *tail = rhs;
+            rhs   = rhs->d_next_p;
+        }
+        else {
+            *tail = lhs;
+            lhs   = lhs->d_next_p;
+        }
+        tail = &(*tail)->d_next_p;
+    }
+    *tail = lhs ? lhs : rhs;
+
+    return result;
+}
+
+template <class DATA>
+bsls::Types::Int64
+TimerWheel<DATA>::tickOf(const bsls::TimeInterval& time, bool roundUp) const
+{
+    // Clamping at about 285 years from the epoch keeps the number of
+    // nanoseconds representable, and preserves the order of the ticks.
+
+    static const Int64 k_MAX_SECONDS = 9000000000LL;
+
+    Int64 seconds     = time.seconds();
+    int   nanoseconds = time.nanoseconds();
+
+    if (seconds >= k_MAX_SECONDS) {
+        seconds     = k_MAX_SECONDS;
+        nanoseconds = 0;
+    }
+    else if (seconds <= -k_MAX_SECONDS) {
+        seconds     = -k_MAX_SECONDS;
+        nanoseconds = 0;
+    }
+
+    const Int64 total = seconds * k_NANOSECS_PER_SEC + nanoseconds;
+
+    Int64 tick      = total / d_resolution;
+    Int64 remainder = total % d_resolution;
+
+    if (0 > remainder) {
+        --tick;
+        remainder += d_resolution;
+    }
+    if (roundUp && 0 != remainder) {
+        ++tick;
+    }
+    return tick;
+}
+
+template <class DATA>
+inline
+bsls::TimeInterval TimerWheel<DATA>::timeOf(Int64 tick) const
+{
+    bsls::TimeInterval result;
+    result.setTotalNanoseconds(tick * d_resolution);
+    return result;
+}
+
+// CREATORS
+template <class DATA>
+TimerWheel<DATA>::TimerWheel(bslma::Allocator *basicAllocator)
+: d_indexMask((1 << k_NUM_INDEX_BITS_DEFAULT) - 1)
+, d_indexIterationMask(~d_indexMask)
+, d_indexIterationInc(d_indexMask + 1)
+, d_resolution(k_DEFAULT_RESOLUTION)
+, d_mode(TimerWheelMode::e_EXACT)
+, d_nodeArray(basicAllocator)
+, d_nextFreeNode_p(0)
+, d_currentTick(0)
+, d_length(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    bsl::fill(d_buckets,  d_buckets  + k_NUM_BUCKETS + 1, (Node *)0);
+    bsl::fill(d_earliest, d_earliest + k_NUM_BUCKETS + 1, (Node *)0);
+    bsl::fill(d_occupied, d_occupied + k_NUM_WORDS, 0);
+}
+
+template <class DATA>
+TimerWheel<DATA>::TimerWheel(int               numIndexBits,
+                             bslma::Allocator *basicAllocator)
+: d_indexMask((1 << numIndexBits) - 1)
+, d_indexIterationMask(~d_indexMask)
+, d_indexIterationInc(d_indexMask + 1)
+, d_resolution(k_DEFAULT_RESOLUTION)
+, d_mode(TimerWheelMode::e_EXACT)
+, d_nodeArray(basicAllocator)
+, d_nextFreeNode_p(0)
+, d_currentTick(0)
+, d_length(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(k_NUM_INDEX_BITS_MIN <= numIndexBits
+             && k_NUM_INDEX_BITS_MAX >= numIndexBits);
+
+    bsl::fill(d_buckets,  d_buckets  + k_NUM_BUCKETS + 1, (Node *)0);
+    bsl::fill(d_earliest, d_earliest + k_NUM_BUCKETS + 1, (Node *)0);
+    bsl::fill(d_occupied, d_occupied + k_NUM_WORDS, 0);
+}
+
+template <class DATA>
+TimerWheel<DATA>::TimerWheel(const bsls::TimeInterval&  resolution,
+                             TimerWheelMode::Enum       mode,
+                             bslma::Allocator          *basicAllocator)
+: d_indexMask((1 << k_NUM_INDEX_BITS_DEFAULT) - 1)
+, d_indexIterationMask(~d_indexMask)
+, d_indexIterationInc(d_indexMask + 1)
+, d_resolution(resolution.totalNanoseconds())
+, d_mode(mode)
+, d_nodeArray(basicAllocator)
+, d_nextFreeNode_p(0)
+, d_currentTick(0)
+, d_length(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(bsls::TimeInterval() < resolution);
+    BSLS_ASSERT(bsls::TimeInterval(3600, 0) >= resolution);
+
+    bsl::fill(d_buckets,  d_buckets  + k_NUM_BUCKETS + 1, (Node *)0);
+    bsl::fill(d_earliest, d_earliest + k_NUM_BUCKETS + 1, (Node *)0);
+    bsl::fill(d_occupied, d_occupied + k_NUM_WORDS, 0);
+}
+
+template <class DATA>
+TimerWheel<DATA>::TimerWheel(int                        numIndexBits,
+                             const bsls::TimeInterval&  resolution,
+                             TimerWheelMode::Enum       mode,
+                             bslma::Allocator          *basicAllocator)
+: d_indexMask((1 << numIndexBits) - 1)
+, d_indexIterationMask(~d_indexMask)
+, d_indexIterationInc(d_indexMask + 1)
+, d_resolution(resolution.totalNanoseconds())
+, d_mode(mode)
+, d_nodeArray(basicAllocator)
+, d_nextFreeNode_p(0)
+, d_currentTick(0)
+, d_length(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(k_NUM_INDEX_BITS_MIN <= numIndexBits
+             && k_NUM_INDEX_BITS_MAX >= numIndexBits);
+    BSLS_ASSERT(bsls::TimeInterval() < resolution);
+    BSLS_ASSERT(bsls::TimeInterval(3600, 0) >= resolution);
+
+    bsl::fill(d_buckets,  d_buckets  + k_NUM_BUCKETS + 1, (Node *)0);
+    bsl::fill(d_earliest, d_earliest + k_NUM_BUCKETS + 1, (Node *)0);
+    bsl::fill(d_occupied, d_occupied + k_NUM_WORDS, 0);
+}
+
+template <class DATA>
+TimerWheel<DATA>::~TimerWheel()
+{
+    removeAll();
+    if (!d_nodeArray.empty()) {
+        Node **data = &d_nodeArray.front();
+        const int numNodes = static_cast<int>(d_nodeArray.size());
+        for (int i = 0; i < numNodes; ++i) {
+            d_allocator_p->deleteObjectRaw(data[i]);
+        }
+    }
+}
+
+// MANIPULATORS
+template <class DATA>
+inline
+typename TimerWheel<DATA>::Handle TimerWheel<DATA>::add(
+                                          const bsls::TimeInterval&  time,
+                                          const DATA&                data,
+                                          int                       *isNewTop,
+                                          int                       *newLength)
+{
+    return add(time, data, Key(0), isNewTop, newLength);
+}
+
+template <class DATA>
+typename TimerWheel<DATA>::Handle TimerWheel<DATA>::add(
+                                          const bsls::TimeInterval&  time,
+                                          const DATA&                data,
+                                          const Key&                 key,
+                                          int                       *isNewTop,
+                                          int                       *newLength)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    Node *node;
+    if (d_nextFreeNode_p) {
+        // All allocation of nodes goes through this routine, which is guarded
+        // by the mutex.  So no other thread will remove anything from the free
+        // list while this code is executing.  However, other threads may add
+        // to the free list.
+
+        node = d_nextFreeNode_p;
+        Node *next = node->d_next_p;
+        while (node != d_nextFreeNode_p.testAndSwap(node, next)) {
+            node = d_nextFreeNode_p;
+            next = node->d_next_p;
+        }
+    }
+    else {
+        // The number of nodes cannot grow to a size larger than the range of
+        // available indices.
+
+        if ((int)d_nodeArray.size() >= d_indexMask - 1) {
+            return -1;                                                // RETURN
+        }
+
+        node = new (*d_allocator_p) Node;
+        d_nodeArray.push_back(node);
+        node->d_index =
+                    static_cast<int>(d_nodeArray.size()) | d_indexIterationInc;
+    }
+    node->d_time = time;
+    node->d_tick = tickOf(time, TimerWheelMode::e_COARSE == d_mode);
+    node->d_key  = key;
+    bslalg::ScalarPrimitives::copyConstruct(&node->d_data.object(),
+                                            data,
+                                            d_allocator_p);
+
+    if (isNewTop) {
+        *isNewTop = this->isNewTop(node);
+    }
+
+    if (0 == d_length) {
+        anchor(node->d_tick);
+    }
+    insertNode(node);
+
+    ++d_length;
+    if (newLength) {
+        *newLength = d_length;
+    }
+
+    BSLS_ASSERT(-1 != node->d_index);
+    return node->d_index;
+}
+
+template <class DATA>
+inline
+typename TimerWheel<DATA>::Handle TimerWheel<DATA>::add(
+                                         const TimeQueueItem<DATA>&  item,
+                                         int                        *isNewTop,
+                                         int                        *newLength)
+{
+    return add(item.time(), item.data(), item.key(), isNewTop, newLength);
+}
+
+template <class DATA>
+int TimerWheel<DATA>::popFront(TimeQueueItem<DATA> *buffer,
+                               int                 *newLength,
+                               bsls::TimeInterval  *newMinTime)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    const int bucket = firstBucket();
+
+    if (0 > bucket) {
+        return 1;                                                     // RETURN
+    }
+
+    // Scan, rather than cascade, the earliest bucket, so that the current
+    // tick does not move ahead of the time at which items are popped.
+
+    Node *node = earliestNode(bucket);
+
+    if (buffer) {
+        buffer->time()   = node->d_time;
+        buffer->data()   = node->d_data.object();
+        buffer->handle() = node->d_index;
+        buffer->key()    = node->d_key;
+    }
+    unlinkNode(node);
+    freeNode(node);
+    --d_length;
+
+    if (d_length && newMinTime) {
+        minTimeImp(newMinTime);
+    }
+
+    if (newLength) {
+        *newLength = d_length;
+    }
+
+    lock.release()->unlock();
+
+    putFreeNode(node);
+    return 0;
+}
+
+template <class DATA>
+inline
+void TimerWheel<DATA>::popLE(const bsls::TimeInterval&          time,
+                             bsl::vector<TimeQueueItem<DATA> > *buffer,
+                             int                               *newLength,
+                             bsls::TimeInterval                *newMinTime)
+{
+    popLEImp(time, INT_MAX, buffer, newLength, newMinTime);
+}
+
+template <class DATA>
+inline
+void TimerWheel<DATA>::popLE(const bsls::TimeInterval&          time,
+                             int                                maxTimers,
+                             bsl::vector<TimeQueueItem<DATA> > *buffer,
+                             int                               *newLength,
+                             bsls::TimeInterval                *newMinTime)
+{
+    popLEImp(time, maxTimers, buffer, newLength, newMinTime);
+}
+
+template <class DATA>
+inline
+int TimerWheel<DATA>::remove(Handle               handle,
+                             int                 *newLength,
+                             bsls::TimeInterval  *newMinTime,
+                             TimeQueueItem<DATA> *item)
+{
+    return remove(handle, Key(0), newLength, newMinTime, item);
+}
+
+template <class DATA>
+int TimerWheel<DATA>::remove(Handle               handle,
+                             const Key&           key,
+                             int                 *newLength,
+                             bsls::TimeInterval  *newMinTime,
+                             TimeQueueItem<DATA> *item)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    const int index = ((int)handle & d_indexMask) - 1;
+    if (index < 0 || index >= (int)d_nodeArray.size()) {
+        return 1;                                                     // RETURN
+    }
+    Node *node = d_nodeArray[index];
+
+    if (node->d_index != (int)handle
+     || node->d_key != key
+     || 0 > node->d_bucket) {
+        return 1;                                                     // RETURN
+    }
+
+    if (item) {
+        item->time()   = node->d_time;
+        item->data()   = node->d_data.object();
+        item->handle() = node->d_index;
+        item->key()    = node->d_key;
+    }
+
+    unlinkNode(node);
+    freeNode(node);
+    --d_length;
+
+    if (newLength) {
+        *newLength = d_length;
+    }
+
+    if (d_length && newMinTime) {
+        minTimeImp(newMinTime);
+    }
+
+    lock.release()->unlock();
+
+    putFreeNode(node);
+    return 0;
+}
+
+template <class DATA>
+void TimerWheel<DATA>::removeAll(bsl::vector<TimeQueueItem<DATA> > *buffer)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    Node  *begin = 0;
+    Node **tail  = &begin;
+    for (int bucket = 0; bucket <= k_OVERFLOW; ++bucket) {
+        Node *node = detachBucket(bucket);
+        if (node) {
+            *tail = node;
+            while (node->d_next_p) {
+                node = node->d_next_p;
+            }
+            tail = &node->d_next_p;
+        }
+    }
+
+    if (buffer) {
+        begin = sortList(begin);
+    }
+
+    for (Node *node = begin; node; node = node->d_next_p) {
+        if (buffer) {
+            buffer->push_back(TimeQueueItem<DATA>(node->d_time,
+                                                  node->d_data.object(),
+                                                  node->d_index,
+                                                  node->d_key,
+                                                  d_allocator_p));
+        }
+        freeNode(node);
+        --d_length;
+    }
+
+    lock.release()->unlock();
+    putFreeNodeList(begin);
+}
+
+template <class DATA>
+inline
+int TimerWheel<DATA>::update(Handle                     handle,
+                             const bsls::TimeInterval&  newTime,
+                             int                       *isNewTop)
+{
+    return update(handle, Key(0), newTime, isNewTop);
+}
+
+template <class DATA>
+int TimerWheel<DATA>::update(Handle                     handle,
+                             const Key&                 key,
+                             const bsls::TimeInterval&  newTime,
+                             int                       *isNewTop)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    const int index = ((int)handle & d_indexMask) - 1;
+    if (index < 0 || index >= (int)d_nodeArray.size()) {
+        return 1;                                                     // RETURN
+    }
+    Node *node = d_nodeArray[index];
+
+    if (node->d_index != (int)handle
+     || node->d_key != key
+     || 0 > node->d_bucket) {
+        return 1;                                                     // RETURN
+    }
+
+    unlinkNode(node);
+
+    node->d_time = newTime;
+    node->d_tick = tickOf(newTime, TimerWheelMode::e_COARSE == d_mode);
+
+    if (isNewTop) {
+        *isNewTop = this->isNewTop(node);
+    }
+
+    if (1 == d_length) {
+        anchor(node->d_tick);
+    }
+    insertNode(node);
+
+    return 0;
+}
+
+// ACCESSORS
+template <class DATA>
+inline
+bool TimerWheel<DATA>::isRegisteredHandle(Handle handle) const
+{
+    return isRegisteredHandle(handle, Key(0));
+}
+
+template <class DATA>
+bool TimerWheel<DATA>::isRegisteredHandle(Handle     handle,
+                                          const Key& key) const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    const int index = (handle & d_indexMask) - 1;
+    if (0 > index || index >= (int)d_nodeArray.size()) {
+        return false;                                                 // RETURN
+    }
+    const Node *node = d_nodeArray[index];
+
+    return node->d_index == (int)handle
+        && node->d_key   == key
+        && 0 <= node->d_bucket;
+}
+
+template <class DATA>
+inline
+int TimerWheel<DATA>::length() const
+{
+    return d_length;
+}
+
+template <class DATA>
+inline
+int TimerWheel<DATA>::minTime(bsls::TimeInterval *buffer) const
+{
+    BSLS_ASSERT(buffer);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    return minTimeImp(buffer);
+}
+
+template <class DATA>
+inline
+TimerWheelMode::Enum TimerWheel<DATA>::mode() const
+{
+    return d_mode;
+}
+
+template <class DATA>
+inline
+bsls::TimeInterval TimerWheel<DATA>::resolution() const
+{
+    return timeOf(1);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
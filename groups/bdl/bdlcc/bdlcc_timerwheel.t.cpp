@@ -0,0 +1,1157 @@
+// bdlcc_timerwheel.t.cpp                                             -*-C++-*-
+#include <bdlcc_timerwheel.h>
+
+#include <bdlcc_timequeue.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a hierarchical timer wheel providing the
+// interface of 'bdlcc::TimeQueue'.  We first verify the management of handles
+// and keys, and of the memory of the items.  We then verify that, in exact
+// mode, the wheel behaves as a 'bdlcc::TimeQueue' by applying long random
+// sequences of operations to both a wheel and a time queue and comparing every
+// result, for resolutions and ranges of times that exercise every level of the
+// wheel, the overflow list, and items added in the past.  We verify the
+// semantics of coarse mode against a brute-force model, and finally verify
+// that concurrent additions, updates, removals, and pops account for every
+// item exactly once.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] TimerWheel(Allocator *basicAllocator = 0);
+// [ 2] TimerWheel(int numIndexBits, Allocator *basicAllocator = 0);
+// [ 3] TimerWheel(const TimeInterval&, TimerWheelMode::Enum, Allocator *);
+// [ 2] TimerWheel(int, const TimeInterval&, Mode::Enum, Allocator *);
+// [ 2] ~TimerWheel();
+//
+// MANIPULATORS
+// [ 2] Handle add(const TimeInterval&, const DATA&, int *, int *);
+// [ 2] Handle add(const TimeInterval&, const DATA&, const Key&, int *, ...);
+// [ 2] Handle add(const TimeQueueItem<DATA>& item, int *, int *);
+// [ 3] int popFront(TimeQueueItem<DATA> *, int *, TimeInterval *);
+// [ 3] void popLE(const TimeInterval&, vector<Item> *, int *, TimeInterval *);
+// [ 3] void popLE(const TimeInterval&, int, vector<Item> *, int *, Interval*);
+// [ 2] int remove(Handle, int *, TimeInterval *, TimeQueueItem<DATA> *);
+// [ 2] int remove(Handle, const Key&, int *, TimeInterval *, Item *);
+// [ 3] void removeAll(bsl::vector<TimeQueueItem<DATA> > *buffer = 0);
+// [ 3] int update(Handle, const TimeInterval&, int *isNewTop = 0);
+// [ 2] int update(Handle, const Key&, const TimeInterval&, int *);
+//
+// ACCESSORS
+// [ 2] bool isRegisteredHandle(Handle handle) const;
+// [ 2] bool isRegisteredHandle(Handle handle, const Key& key) const;
+// [ 2] int length() const;
+// [ 3] int minTime(bsls::TimeInterval *buffer) const;
+// [ 2] TimerWheelMode::Enum mode() const;
+// [ 2] bsls::TimeInterval resolution() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: COARSE MODE
+// [ 5] CONCERN: CONCURRENT ACCESS
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::TimerWheel<int>         Obj;
+typedef bdlcc::TimerWheel<bsl::string> StrObj;
+typedef bdlcc::TimeQueue<int>          Oracle;
+typedef bdlcc::TimeQueueItem<int>      Item;
+typedef bdlcc::TimerWheelMode          Mode;
+typedef bsls::Types::Int64             Int64;
+typedef bsls::Types::Uint64            Uint64;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+class Random {
+    // This class provides a deterministic generator of pseudo-random numbers.
+
+    // DATA
+    Uint64 d_state;
+
+  public:
+    // CREATORS
+    explicit Random(Uint64 seed)
+    : d_state(seed)
+        // Create a generator having the specified 'seed'.
+    {
+    }
+
+    // MANIPULATORS
+    Uint64 next()
+        // Return the next pseudo-random 64-bit number.
+    {
+        d_state = d_state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return (d_state >> 32) ^ (d_state << 21);
+    }
+
+    Int64 next(Int64 limit)
+        // Return the next pseudo-random number in the range '[0 .. limit)'.
+        // The behavior is undefined unless '0 < limit'.
+    {
+        return static_cast<Int64>(next() % static_cast<Uint64>(limit));
+    }
+};
+
+bsls::TimeInterval fromNanoseconds(Int64 nanoseconds)
+    // Return the time interval having the specified number of 'nanoseconds'.
+{
+    bsls::TimeInterval result;
+    result.setTotalNanoseconds(nanoseconds);
+    return result;
+}
+
+Int64 roundUp(Int64 nanoseconds, Int64 resolution)
+    // Return the specified 'nanoseconds' rounded up to a multiple of the
+    // specified 'resolution'.
+{
+    Int64 tick = nanoseconds / resolution;
+    if (nanoseconds % resolution > 0) {
+        ++tick;
+    }
+    return tick * resolution;
+}
+
+void verifyAgainstOracle(int   line,
+                         Int64 resolution,
+                         Int64 start,
+                         Int64 spread,
+                         int   seed,
+                         int   numOperations)
+    // Apply the specified 'numOperations' random operations, generated from
+    // the specified 'seed', to both an exact-mode wheel having the specified
+    // 'resolution' (in nanoseconds) and a time queue, with times starting at
+    // the specified 'start' and spreading, after the time of the latest
+    // 'popLE', over the specified 'spread' (both in nanoseconds), and verify
+    // that they produce the same results.  Report failures using the
+    // specified 'line'.
+{
+    bslma::TestAllocator ta("object", false);
+    {
+        Obj    mX(fromNanoseconds(resolution), Mode::e_EXACT, &ta);
+        Oracle mY(&ta);
+
+        Random random(seed);
+        Int64  now = start;
+
+        bsl::vector<Obj::Handle>    xHandles;  // by data
+        bsl::vector<Oracle::Handle> yHandles;  // by data
+        bsl::vector<int>            live;      // data of the items
+        bsl::vector<int>            position;  // in 'live', by data
+
+        bsl::vector<Item> xItems;
+        bsl::vector<Item> yItems;
+
+        for (int i = 0; i < numOperations; ++i) {
+            const int op = static_cast<int>(random.next(100));
+
+            // Draw a time from somewhat before 'now' to 'spread' after it,
+            // with many duplicates.
+
+            Int64 offset = random.next(spread + spread / 8) - spread / 8;
+            if (0 == random.next(3)) {
+                offset -= offset % (resolution * 3 + 1);
+            }
+            const bsls::TimeInterval time = fromNanoseconds(now + offset);
+
+            if (op < 40 || live.empty()) {
+                const int data = static_cast<int>(xHandles.size());
+
+                int xNewTop = -1, xLength = -1;
+                int yNewTop = -1, yLength = -1;
+
+                xHandles.push_back(mX.add(time, data, &xNewTop, &xLength));
+                yHandles.push_back(mY.add(time, data, &yNewTop, &yLength));
+                position.push_back(static_cast<int>(live.size()));
+                live.push_back(data);
+
+                ASSERTV(line, i, -1 != xHandles.back());
+                ASSERTV(line, i, xNewTop, yNewTop,
+                      !xNewTop == !yNewTop);
+                ASSERTV(line, i, xLength, yLength, xLength == yLength);
+            }
+            else if (op < 65) {
+                const int data = live[random.next(live.size())];
+
+                int xNewTop = -1, yNewTop = -1;
+
+                ASSERTV(line, i,
+                      0 == mX.update(xHandles[data], time, &xNewTop));
+                ASSERTV(line, i,
+                      0 == mY.update(yHandles[data], time, &yNewTop));
+                ASSERTV(line, i, xNewTop, yNewTop,
+                      !xNewTop == !yNewTop);
+            }
+            else if (op < 75) {
+                const int data = live[random.next(live.size())];
+
+                Item xItem, yItem;
+                int  xLength = -1, yLength = -1;
+
+                ASSERTV(line, i,
+                      0 == mX.remove(xHandles[data], &xLength, 0,
+                                     &xItem));
+                ASSERTV(line, i,
+                      0 == mY.remove(yHandles[data], &yLength, 0,
+                                     &yItem));
+                ASSERTV(line, i, data == xItem.data());
+                ASSERTV(line, i, yItem.time() == xItem.time());
+                ASSERTV(line, i, xLength, yLength, xLength == yLength);
+                ASSERTV(line, i, 0 != mX.remove(xHandles[data]));
+
+                xItems.assign(1, xItem);
+            }
+            else if (op < 97) {
+                if (random.next(4)) {
+                    now += random.next(spread / 4 + 1);
+                }
+                const bsls::TimeInterval popTime = fromNanoseconds(now);
+
+                bsls::TimeInterval xMinTime(-1, 0), yMinTime(-1, 0);
+                int                xLength = -1, yLength = -1;
+
+                xItems.clear();
+                yItems.clear();
+                if (random.next(2)) {
+                    const int maxTimers = static_cast<int>(random.next(4));
+
+                    mX.popLE(popTime, maxTimers, &xItems, &xLength,
+                             &xMinTime);
+                    mY.popLE(popTime, maxTimers, &yItems, &yLength,
+                             &yMinTime);
+                }
+                else {
+                    mX.popLE(popTime, &xItems, &xLength, &xMinTime);
+                    mY.popLE(popTime, &yItems, &yLength, &yMinTime);
+                }
+                ASSERTV(line, i, xLength, yLength, xLength == yLength);
+                ASSERTV(line, i, xMinTime, yMinTime,
+                      xMinTime == yMinTime);
+                ASSERTV(line, i, xItems.size(), yItems.size(),
+                      xItems.size() == yItems.size());
+            }
+            else {
+                Item xItem, yItem;
+                int  xLength = -1, yLength = -1;
+
+                ASSERT(0 == mX.popFront(&xItem, &xLength));
+                ASSERT(0 == mY.popFront(&yItem, &yLength));
+                ASSERTV(line, i, xLength, yLength, xLength == yLength);
+
+                xItems.assign(1, xItem);
+                yItems.assign(1, yItem);
+            }
+
+            // Compare the popped items, and stop tracking them.
+
+            if (op >= 65) {
+                const bsl::size_t n = bsl::min(xItems.size(), yItems.size());
+                for (bsl::size_t j = 0; op >= 75 && j < n; ++j) {
+                    ASSERTV(line, i, j, xItems[j].data(),
+                          yItems[j].data(),
+                          xItems[j].data() == yItems[j].data());
+                    ASSERTV(line, i, j,
+                          xItems[j].time() == yItems[j].time());
+                    ASSERTV(line, i, j,
+                          xHandles[xItems[j].data()] ==
+                                                 xItems[j].handle());
+                }
+                for (bsl::size_t j = 0; j < xItems.size(); ++j) {
+                    const int data = xItems[j].data();
+                    const int last = live.back();
+
+                    live[position[data]] = last;
+                    position[last] = position[data];
+                    live.pop_back();
+                    position[data] = -1;
+                }
+                xItems.clear();
+                yItems.clear();
+            }
+
+            ASSERTV(line, i, mY.length() == mX.length());
+            ASSERTV(line, i, live.size() == (bsl::size_t)mX.length());
+
+            bsls::TimeInterval xMinTime, yMinTime;
+            ASSERTV(line, i,
+                  mX.minTime(&xMinTime) == mY.minTime(&yMinTime));
+            ASSERTV(line, i, xMinTime, yMinTime, xMinTime == yMinTime);
+        }
+
+        // Registered handles are those of the items remaining.
+
+        for (bsl::size_t data = 0; data < xHandles.size(); ++data) {
+            const bool isLive = 0 <= position[data];
+            ASSERTV(line, data,
+                  isLive == mX.isRegisteredHandle(xHandles[data]));
+        }
+
+        mX.removeAll(&xItems);
+        mY.removeAll(&yItems);
+
+        ASSERTV(line, xItems.size(), yItems.size(),
+              xItems.size() == yItems.size());
+        for (bsl::size_t j = 0; j < xItems.size() && j < yItems.size(); ++j) {
+            ASSERTV(line, j, xItems[j].data() == yItems[j].data());
+        }
+        ASSERT(0 == mX.length());
+    }
+    LOOP_ASSERT(line, 0 == ta.numBytesInUse());
+}
+
+void concurrentClient(Obj             *wheel,
+                      bsls::AtomicInt *numRemoved,
+                      bslmt::Barrier  *barrier,
+                      int              threadIndex,
+                      int              numItems)
+    // Add to the specified 'wheel' the specified 'numItems' items, whose data
+    // is 'threadIndex * numItems' plus their index for the specified
+    // 'threadIndex', update each of them several times, and remove every
+    // third of them, incrementing the specified 'numRemoved' upon each
+    // successful removal.  Wait on the specified 'barrier' before starting.
+{
+    Random random(threadIndex + 1);
+
+    bsl::vector<Obj::Handle> handles(numItems);
+
+    barrier->wait();
+
+    for (int i = 0; i < numItems; ++i) {
+        handles[i] = wheel->add(bsls::TimeInterval(0, 1000 * static_cast<int>(
+                                                        random.next(1000000))),
+                                threadIndex * numItems + i);
+        ASSERT(-1 != handles[i]);
+    }
+    for (int pass = 0; pass < 3; ++pass) {
+        for (int i = 0; i < numItems; ++i) {
+            // The item may already have been popped.
+
+            wheel->update(handles[i],
+                          bsls::TimeInterval(0, 1000 * static_cast<int>(
+                                                       random.next(1000000))));
+        }
+    }
+    for (int i = 0; i < numItems; i += 3) {
+        if (0 == wheel->remove(handles[i])) {
+            ++*numRemoved;
+        }
+    }
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Connection Read Timeouts
+///- - - - - - - - - - - - - - - - - -
+// Suppose that a server closes the connections on which no data has been read
+// for 30 seconds.  Upon each read, the timeout of the connection is pushed
+// back, so that the timer of a connection is updated far more often than it
+// expires.
+//
+// First, we define a class, 'my_ConnectionMonitor', that keeps a timer for
+// each connection in a coarse 'bdlcc::TimerWheel' having a resolution of 10
+// milliseconds, as closing a connection a few milliseconds late is of no
+// consequence:
+//..
+    class my_ConnectionMonitor {
+        // This class monitors the inactivity of connections identified by an
+        // integer.
+
+        // DATA
+        bdlcc::TimerWheel<int> d_timers;   // timers, holding connection ids
+        bsls::TimeInterval     d_timeout;  // inactivity timeout
+
+      public:
+        // TYPES
+        typedef bdlcc::TimerWheel<int>::Handle Handle;
+
+        // CREATORS
+        explicit my_ConnectionMonitor(const bsls::TimeInterval& timeout)
+            // Create a monitor closing the connections after the specified
+            // 'timeout' of inactivity.
+        : d_timers(bsls::TimeInterval(0, 10 * 1000 * 1000),
+                   bdlcc::TimerWheelMode::e_COARSE)
+        , d_timeout(timeout)
+        {
+        }
+
+        // MANIPULATORS
+        Handle open(int connectionId, const bsls::TimeInterval& now)
+            // Start monitoring the connection having the specified
+            // 'connectionId', opened at the specified 'now' time, and return
+            // the handle of its timer.
+        {
+            return d_timers.add(now + d_timeout, connectionId);
+        }
+
+        void onRead(Handle handle, const bsls::TimeInterval& now)
+            // Push back the timeout of the connection having the specified
+            // 'handle' upon a read at the specified 'now' time.
+        {
+            d_timers.update(handle, now + d_timeout);
+        }
+
+        void close(Handle handle)
+            // Stop monitoring the connection having the specified 'handle'.
+        {
+            d_timers.remove(handle);
+        }
+
+        void expire(bsl::vector<int>          *expired,
+                    const bsls::TimeInterval&  now)
+            // Stop monitoring the connections that have been inactive for the
+            // timeout as of the specified 'now' time, and append their
+            // identifiers to the specified 'expired' vector.
+        {
+            bsl::vector<bdlcc::TimeQueueItem<int> > items;
+            d_timers.popLE(now, &items);
+            for (bsl::size_t i = 0; i < items.size(); ++i) {
+                expired->push_back(items[i].data());
+            }
+        }
+    };
+//..
+
+}  // close namespace usage
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace usage;
+
+// Then, we open three connections at time 0:
+//..
+    my_ConnectionMonitor monitor(bsls::TimeInterval(30, 0));
+
+    my_ConnectionMonitor::Handle h1 = monitor.open(1, bsls::TimeInterval());
+    my_ConnectionMonitor::Handle h2 = monitor.open(2, bsls::TimeInterval());
+    my_ConnectionMonitor::Handle h3 = monitor.open(3, bsls::TimeInterval());
+//..
+// Next, data is read on the first connection at time 10 and on the second
+// connection at time 20, and the third connection is closed:
+//..
+    monitor.onRead(h1, bsls::TimeInterval(10, 0));
+    monitor.onRead(h2, bsls::TimeInterval(20, 0));
+    monitor.close(h3);
+//..
+// Finally, we observe that no connection has timed out at time 35, and that
+// the first connection has timed out at time 45:
+//..
+    bsl::vector<int> expired;
+
+    monitor.expire(&expired, bsls::TimeInterval(35, 0));
+    ASSERT(expired.empty());
+
+    monitor.expire(&expired, bsls::TimeInterval(45, 0));
+    ASSERT(1 == expired.size());
+    ASSERT(1 == expired[0]);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONCURRENT ACCESS
+        //
+        // Concerns:
+        //: 1 Items added, updated, and removed by several threads while
+        //:   another thread pops the items that are due are each either
+        //:   popped or removed, exactly once.
+        //:
+        //: 2 Each call to 'popLE' returns items in time order.
+        //
+        // Plan:
+        //: 1 Start several threads adding, updating, and removing items with
+        //:   random times, while the main thread pops the items due at a
+        //:   steadily increasing time, checking the order of each batch of
+        //:   popped items.  Then pop the remaining items, and verify that the
+        //:   number of items popped or removed is the number of items added,
+        //:   and that no item was popped twice.  (C-1, 2)
+        //
+        // Testing:
+        //   CONCERN: CONCURRENT ACCESS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: CONCURRENT ACCESS" << endl
+                          << "==========================" << endl;
+
+        enum { k_NUM_THREADS = 4, k_NUM_ITEMS = 5000 };
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj             mX(bsls::TimeInterval(0, 1000), Mode::e_EXACT,
+                               &ta);
+            bsls::AtomicInt numRemoved(0);
+            bslmt::Barrier  barrier(k_NUM_THREADS + 1);
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                   &handles[i],
+                                   bdlf::BindUtil::bind(&concurrentClient,
+                                                        &mX,
+                                                        &numRemoved,
+                                                        &barrier,
+                                                        i,
+                                                        (int)k_NUM_ITEMS)));
+            }
+
+            bsl::vector<int>  popped(k_NUM_THREADS * k_NUM_ITEMS, 0);
+            bsl::vector<Item> items;
+            int               numPopped = 0;
+
+            barrier.wait();
+
+            for (int t = 0; t < 1000; ++t) {
+                items.clear();
+                mX.popLE(bsls::TimeInterval(0, t * 1000 * 1000), &items);
+                for (bsl::size_t j = 0; j < items.size(); ++j) {
+                    ++popped[items[j].data()];
+                    LOOP_ASSERT(j, 0 == j
+                                  || items[j - 1].time() <= items[j].time());
+                }
+                numPopped += static_cast<int>(items.size());
+                bslmt::ThreadUtil::yield();
+            }
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            items.clear();
+            mX.popLE(bsls::TimeInterval(1, 0), &items);
+            for (bsl::size_t j = 0; j < items.size(); ++j) {
+                ++popped[items[j].data()];
+            }
+            numPopped += static_cast<int>(items.size());
+
+            if (veryVerbose) { P_(numPopped) P(numRemoved) }
+
+            ASSERT(0 == mX.length());
+            ASSERTV(numPopped, numRemoved,
+                    k_NUM_THREADS * k_NUM_ITEMS == numPopped + numRemoved);
+            for (bsl::size_t i = 0; i < popped.size(); ++i) {
+                ASSERTV(i, popped[i], 1 >= popped[i]);
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: COARSE MODE
+        //
+        // Concerns:
+        //: 1 In coarse mode, 'popLE' pops exactly the items whose time rounded
+        //:   up to a tick boundary is less than or equal to the specified
+        //:   time: an item is never popped before its time, nor more than one
+        //:   tick after it.
+        //:
+        //: 2 The popped items are ordered by rounded-up time.
+        //:
+        //: 3 'minTime' reports a time no later than the rounded-up time of
+        //:   the earliest item, and exactly that time when the earliest item
+        //:   is due in the 256-tick range of the current tick.
+        //
+        // Plan:
+        //: 1 Add items to a coarse wheel in the range of its current tick, and
+        //:   verify that 'minTime' reports their rounded-up time.  (C-3)
+        //:
+        //: 2 Apply random additions, updates, and pops to a coarse wheel, and
+        //:   compare the popped items, and the reported minimum time, with
+        //:   those computed by brute force.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: COARSE MODE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: COARSE MODE" << endl
+                          << "====================" << endl;
+
+        {
+            Obj mX(bsls::TimeInterval(0, 1000), Mode::e_COARSE);
+            const Obj& X = mX;
+
+            bsls::TimeInterval minTime;
+
+            mX.popLE(bsls::TimeInterval(7, 1000 * 256));
+
+            mX.add(bsls::TimeInterval(7, 1000 * 300 + 1), 1);
+            ASSERT(0 == X.minTime(&minTime));
+            ASSERTV(minTime, bsls::TimeInterval(7, 1000 * 301) == minTime);
+
+            mX.add(bsls::TimeInterval(7, 1000 * 290), 2);
+            ASSERT(0 == X.minTime(&minTime));
+            ASSERTV(minTime, bsls::TimeInterval(7, 1000 * 290) == minTime);
+
+            bsl::vector<Item> items;
+            mX.popLE(bsls::TimeInterval(7, 1000 * 300), &items);
+            ASSERT(1 == items.size());
+            ASSERT(2 == items[0].data());
+
+            mX.popLE(bsls::TimeInterval(7, 1000 * 301), &items);
+            ASSERT(2 == items.size());
+            ASSERT(1 == items[1].data());
+            ASSERT(bsls::TimeInterval(7, 1000 * 300 + 1) == items[1].time());
+        }
+
+        const Int64 RESOLUTIONS[] = { 1, 1000, 10 * 1000 * 1000 };
+        const int   NUM_RESOLUTIONS = sizeof RESOLUTIONS / sizeof *RESOLUTIONS;
+
+        for (int ri = 0; ri < NUM_RESOLUTIONS; ++ri) {
+            const Int64 RES = RESOLUTIONS[ri];
+
+            if (veryVerbose) { T_ P(RES) }
+
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                Obj mX(fromNanoseconds(RES), Mode::e_COARSE, &ta);
+                const Obj& X = mX;
+
+                ASSERT(Mode::e_COARSE == X.mode());
+                ASSERT(fromNanoseconds(RES) == X.resolution());
+
+                Random random(ri + 7);
+                Int64  now = 1000 * 1000 * 1000;
+
+                bsl::vector<Obj::Handle> handles;
+                bsl::vector<Int64>       times;   // in ns, -1 once popped
+                bsl::vector<Item>        items;
+
+                for (int i = 0; i < 5000; ++i) {
+                    const Int64 time = now + random.next(RES * 1000)
+                                                                - RES * 100;
+                    const int   op   = static_cast<int>(random.next(10));
+
+                    if (op < 5) {
+                        handles.push_back(mX.add(fromNanoseconds(time),
+                                                 (int)handles.size()));
+                        times.push_back(time);
+                    }
+                    else if (op < 7 && !handles.empty()) {
+                        const int data = static_cast<int>(
+                                                   random.next(times.size()));
+                        const int rc = mX.update(handles[data],
+                                                 fromNanoseconds(time));
+                        LOOP_ASSERT(i, (0 == rc) == (-1 != times[data]));
+                        if (0 == rc) {
+                            times[data] = time;
+                        }
+                    }
+                    else {
+                        now += random.next(RES * 20);
+
+                        items.clear();
+                        mX.popLE(fromNanoseconds(now), &items);
+
+                        Int64 previous = LLONG_MIN;
+                        for (bsl::size_t j = 0; j < items.size(); ++j) {
+                            const int   data    = items[j].data();
+                            const Int64 rounded = roundUp(times[data], RES);
+
+                            ASSERTV(i, j, -1 != times[data]);
+                            ASSERTV(i, j, rounded <= now);
+                            ASSERTV(i, j, previous <= rounded);
+                            ASSERTV(i, j, fromNanoseconds(times[data])
+                                               == items[j].time());
+                            previous    = rounded;
+                            times[data] = -1;
+                        }
+                    }
+
+                    // Brute-force check of the remaining items.
+
+                    Int64 minRounded = LLONG_MAX;
+                    int   numLive    = 0;
+                    for (bsl::size_t d = 0; d < times.size(); ++d) {
+                        if (-1 == times[d]) {
+                            continue;
+                        }
+                        ++numLive;
+                        const Int64 rounded = roundUp(times[d], RES);
+                        if (op >= 7) {
+                            ASSERTV(i, d, rounded > now);
+                        }
+                        minRounded = bsl::min(minRounded, rounded);
+                    }
+                    LOOP_ASSERT(i, numLive == X.length());
+
+                    bsls::TimeInterval minTime;
+                    if (0 == numLive) {
+                        LOOP_ASSERT(i, 0 != X.minTime(&minTime));
+                        continue;
+                    }
+                    LOOP_ASSERT(i, 0 == X.minTime(&minTime));
+                    ASSERTV(i, minTime, fromNanoseconds(minRounded),
+                          minTime <= fromNanoseconds(minRounded));
+                }
+            }
+            ASSERT(0 == ta.numBytesInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // EXACT MODE AGAINST 'TimeQueue'
+        //
+        // Concerns:
+        //: 1 In exact mode, every method returns the same results as the
+        //:   corresponding method of a 'TimeQueue' to which the same
+        //:   operations are applied: 'popLE' and 'popFront' return the same
+        //:   items in the same order (including items having the same time,
+        //:   in the order in which they were added or updated), and the same
+        //:   new length and minimum time, and 'add' and 'update' report the
+        //:   same 'isNewTop'.
+        //:
+        //: 2 This holds for items due in every level of the wheel, in the
+        //:   overflow list, and in the past, for items far from the epoch,
+        //:   and when 'popLE' is limited by 'maxTimers'.
+        //:
+        //: 3 This holds when many items of distinct times share a bucket, and
+        //:   its earliest item is repeatedly removed, popped, or updated, so
+        //:   that the earliest item of the bucket must be found again.
+        //:
+        //: 4 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, apply long random sequences of
+        //:   operations to a wheel and to a time queue, for resolutions and
+        //:   ranges of times such that items are due in every level and in
+        //:   the overflow list, or in a few buckets of a coarse resolution,
+        //:   and compare the results of every operation.  (C-1..4)
+        //
+        // Testing:
+        //   TimerWheel(const TimeInterval&, TimerWheelMode::Enum, Allocator*);
+        //   int popFront(TimeQueueItem<DATA> *, int *, TimeInterval *);
+        //   void popLE(const TimeInterval&, vector<Item> *, int *, Interval*);
+        //   void popLE(const TimeInterval&, int, vector<Item>*, int*, Intvl*);
+        //   void removeAll(bsl::vector<TimeQueueItem<DATA> > *buffer = 0);
+        //   int update(Handle, const TimeInterval&, int *isNewTop = 0);
+        //   int minTime(bsls::TimeInterval *buffer) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXACT MODE AGAINST 'TimeQueue'" << endl
+                          << "==============================" << endl;
+
+        const Int64 k_SEC  = 1000LL * 1000 * 1000;
+        const Int64 k_2_32 = 1LL << 32;
+
+        static const struct {
+            int   d_line;
+            Int64 d_resolution;  // in nanoseconds
+            Int64 d_start;       // in nanoseconds
+            Int64 d_spread;      // in nanoseconds
+        } DATA[] = {
+            //LINE  RESOLUTION  START                  SPREAD
+            //----  ----------  ---------------------  ------------------
+            { L_,            1,                     0,                  50 },
+            { L_,      1000000,                     0,               1000 },
+            { L_,      1000000,                     0,           3000000 },
+            { L_,            1,                     0,               1000 },
+            { L_,            1,                     0,         1LL << 20 },
+            { L_,            1,                 -k_SEC,        1LL << 28 },
+            { L_,            1,                     0,        4 * k_2_32 },
+            { L_,         1000,   1500000000LL * k_SEC,        10 * k_SEC },
+            { L_,      1000000,   1500000000LL * k_SEC,      1000 * k_SEC },
+            { L_,      1000000,                     0, 100000000 * k_SEC },
+            { L_,      1000000, 9100000000LL * k_SEC,        10 * k_SEC },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE       = DATA[ti].d_line;
+            const Int64 RESOLUTION = DATA[ti].d_resolution;
+            const Int64 START      = DATA[ti].d_start;
+            const Int64 SPREAD     = DATA[ti].d_spread;
+
+            if (veryVerbose) { T_ P_(LINE) P_(RESOLUTION) P(SPREAD) }
+
+            for (int seed = 1; seed <= 3; ++seed) {
+                verifyAgainstOracle(LINE,
+                                    RESOLUTION,
+                                    START,
+                                    SPREAD,
+                                    seed,
+                                    4000);
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // HANDLES, KEYS, AND MEMORY
+        //
+        // Concerns:
+        //: 1 The handle returned by 'add' identifies the item until it is
+        //:   removed or popped, after which it is not registered, and
+        //:   'remove' and 'update' fail for it, even after its node is reused.
+        //:
+        //: 2 An item added with a key can only be removed and updated, and is
+        //:   only registered, with that key.
+        //:
+        //: 3 'add' fails once the number of items reaches the capacity of the
+        //:   handles implied by 'numIndexBits'.
+        //:
+        //: 4 Items are copied using the allocator of the wheel, and destroyed
+        //:   when removed, popped, or when the wheel is destroyed.
+        //:
+        //: 5 The default constructors create an exact wheel having a
+        //:   resolution of 1 millisecond.
+        //
+        // Plan:
+        //: 1 Add, remove, update, and pop items with and without keys, and
+        //:   verify the handles that are registered.  (C-1, 2)
+        //:
+        //: 2 Fill a wheel having 8 index bits, and verify that 'add' fails,
+        //:   and succeeds again after an item is removed.  (C-3)
+        //:
+        //: 3 Use 'bsl::string' items, long enough to allocate, with a test
+        //:   allocator, and verify that no memory is leaked and that the
+        //:   default allocator is not used.  (C-4)
+        //:
+        //: 4 Verify 'mode' and 'resolution' of default-constructed wheels.
+        //:   (C-5)
+        //
+        // Testing:
+        //   TimerWheel(Allocator *basicAllocator = 0);
+        //   TimerWheel(int numIndexBits, Allocator *basicAllocator = 0);
+        //   TimerWheel(int, const TimeInterval&, Mode::Enum, Allocator *);
+        //   ~TimerWheel();
+        //   Handle add(const TimeInterval&, const DATA&, int *, int *);
+        //   Handle add(const TimeInterval&, const DATA&, const Key&, int *, ...);
+        //   Handle add(const TimeQueueItem<DATA>& item, int *, int *);
+        //   int remove(Handle, int *, TimeInterval *, TimeQueueItem<DATA> *);
+        //   int remove(Handle, const Key&, int *, TimeInterval *, Item *);
+        //   int update(Handle, const Key&, const TimeInterval&, int *);
+        //   bool isRegisteredHandle(Handle handle) const;
+        //   bool isRegisteredHandle(Handle handle, const Key& key) const;
+        //   int length() const;
+        //   TimerWheelMode::Enum mode() const;
+        //   bsls::TimeInterval resolution() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "HANDLES, KEYS, AND MEMORY" << endl
+                          << "=========================" << endl;
+
+        if (verbose) cout << "\tDefault constructors." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(Mode::e_EXACT == X.mode());
+            ASSERT(bsls::TimeInterval(0, 1000000) == X.resolution());
+
+            Obj mY(12);  const Obj& Y = mY;
+            ASSERT(Mode::e_EXACT == Y.mode());
+            ASSERT(bsls::TimeInterval(0, 1000000) == Y.resolution());
+        }
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        if (verbose) cout << "\tHandles and keys." << endl;
+        {
+            const bsl::string LONG(100, 'x');
+
+            StrObj mX(bsls::TimeInterval(0, 1000), Mode::e_EXACT, &ta);
+            const StrObj& X = mX;
+
+            const StrObj::Key KEY1(1);
+            const StrObj::Key KEY2(2);
+
+            int isNewTop = -1, newLength = -1;
+
+            const StrObj::Handle H1 = mX.add(bsls::TimeInterval(5, 0),
+                                             LONG,
+                                             &isNewTop,
+                                             &newLength);
+            ASSERT(1 == isNewTop);
+            ASSERT(1 == newLength);
+
+            const StrObj::Handle H2 = mX.add(bsls::TimeInterval(3, 0),
+                                             LONG + "2",
+                                             KEY1,
+                                             &isNewTop,
+                                             &newLength);
+            ASSERT(1 == isNewTop);
+            ASSERT(2 == newLength);
+
+            const StrObj::Handle H3 = mX.add(
+                             bdlcc::TimeQueueItem<bsl::string>(
+                                                      bsls::TimeInterval(3, 0),
+                                                      LONG + "3",
+                                                      0,
+                                                      KEY2,
+                                                      &ta),
+                             &isNewTop);
+            ASSERT(0 == isNewTop);
+            ASSERT(3 == X.length());
+            ASSERT(H1 != H2 && H2 != H3 && H1 != H3);
+
+            ASSERT( X.isRegisteredHandle(H1));
+            ASSERT(!X.isRegisteredHandle(H2));
+            ASSERT( X.isRegisteredHandle(H2, KEY1));
+            ASSERT(!X.isRegisteredHandle(H2, KEY2));
+            ASSERT( X.isRegisteredHandle(H3, KEY2));
+
+            ASSERT(0 != mX.update(H2, bsls::TimeInterval(1, 0)));
+            ASSERT(0 != mX.update(H2, KEY2, bsls::TimeInterval(1, 0)));
+            ASSERT(0 == mX.update(H3, KEY2, bsls::TimeInterval(1, 0),
+                                  &isNewTop));
+            ASSERT(1 == isNewTop);
+
+            bdlcc::TimeQueueItem<bsl::string> item(&ta);
+            bsls::TimeInterval                newMinTime;
+
+            ASSERT(0 != mX.remove(H2, &newLength));
+            ASSERT(0 == mX.remove(H2, KEY1, &newLength, &newMinTime, &item));
+            ASSERT(LONG + "2" == item.data());
+            ASSERT(bsls::TimeInterval(3, 0) == item.time());
+            ASSERT(H2 == item.handle());
+            ASSERT(KEY1 == item.key());
+            ASSERT(2 == newLength);
+            ASSERT(bsls::TimeInterval(1, 0) == newMinTime);
+            ASSERT(!X.isRegisteredHandle(H2, KEY1));
+            ASSERT(0 != mX.remove(H2, KEY1));
+
+            // The node of 'H2' is reused with a different handle.
+
+            const StrObj::Handle H4 = mX.add(bsls::TimeInterval(2, 0),
+                                             LONG + "4",
+                                             KEY1);
+            ASSERT(H4 != H2);
+            ASSERT(!X.isRegisteredHandle(H2, KEY1));
+            ASSERT( X.isRegisteredHandle(H4, KEY1));
+            ASSERT(0 != mX.update(H2, KEY1, bsls::TimeInterval(9, 0)));
+
+            bsl::vector<bdlcc::TimeQueueItem<bsl::string> > items(&ta);
+            mX.popLE(bsls::TimeInterval(2, 0), &items, &newLength,
+                     &newMinTime);
+            ASSERT(2 == items.size());
+            ASSERT(LONG + "3" == items[0].data());
+            ASSERT(H3 == items[0].handle());
+            ASSERT(KEY2 == items[0].key());
+            ASSERT(LONG + "4" == items[1].data());
+            ASSERT(1 == newLength);
+            ASSERT(bsls::TimeInterval(5, 0) == newMinTime);
+            ASSERT(!X.isRegisteredHandle(H3, KEY2));
+            ASSERT(0 != mX.remove(H3, KEY2));
+            ASSERT(X.isRegisteredHandle(H1));
+
+            // 'H1' is destroyed with the wheel.
+        }
+        ASSERT(0 == ta.numBytesInUse());
+        ASSERT(0 == defaultAllocator.numBytesInUse());
+
+        if (verbose) cout << "\tCapacity of the handles." << endl;
+        {
+            Obj mX(8, bsls::TimeInterval(0, 1000), Mode::e_EXACT, &ta);
+            const Obj& X = mX;
+
+            bsl::vector<Obj::Handle> handles;
+            for (int i = 0; i < 254; ++i) {
+                handles.push_back(mX.add(bsls::TimeInterval(i, 0), i));
+                LOOP_ASSERT(i, -1 != handles.back());
+            }
+            ASSERT(254 == X.length());
+            ASSERT(-1 == mX.add(bsls::TimeInterval(1, 0), 1000));
+            ASSERT(254 == X.length());
+
+            ASSERT(0 == mX.remove(handles[7]));
+            const Obj::Handle H = mX.add(bsls::TimeInterval(1, 0), 1000);
+            ASSERT(-1 != H);
+            ASSERT(H != handles[7]);
+            ASSERT((H & 0xff) == (handles[7] & 0xff));
+            ASSERT(-1 == mX.add(bsls::TimeInterval(1, 0), 1001));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Add, update, remove, and pop a few items.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        bsls::TimeInterval minTime;
+        ASSERT(0 == X.length());
+        ASSERT(0 != X.minTime(&minTime));
+
+        const Obj::Handle H1 = mX.add(bsls::TimeInterval(3, 0), 1);
+        const Obj::Handle H2 = mX.add(bsls::TimeInterval(1, 0), 2);
+        const Obj::Handle H3 = mX.add(bsls::TimeInterval(2, 0), 3);
+        ASSERT(3 == X.length());
+        ASSERT(0 == X.minTime(&minTime));
+        ASSERT(bsls::TimeInterval(1, 0) == minTime);
+
+        ASSERT(0 == mX.update(H2, bsls::TimeInterval(4, 0)));
+        ASSERT(0 == mX.remove(H3));
+        ASSERT(0 == X.minTime(&minTime));
+        ASSERT(bsls::TimeInterval(3, 0) == minTime);
+
+        bsl::vector<Item> items;
+        mX.popLE(bsls::TimeInterval(2, 0), &items);
+        ASSERT(items.empty());
+
+        mX.popLE(bsls::TimeInterval(4, 0), &items);
+        ASSERT(2 == items.size());
+        ASSERT(1 == items[0].data());
+        ASSERT(H1 == items[0].handle());
+        ASSERT(2 == items[1].data());
+        ASSERT(0 == X.length());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,658 @@
+// bdlmt_workstealingthreadpool.cpp                                   -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_workstealingthreadpool_cpp,"$Id$ $CSID$")
+
+#include <bslmt_lockguard.h>
+#include <bslmt_platform.h>
+
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+namespace {
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void initBlockSet(sigset_t *blockSet)
+    // Load into the specified 'blockSet' all the signals, except the
+    // synchronous ones.
+{
+    sigfillset(blockSet);
+
+    const int synchronousSignals[] = {
+      SIGBUS,
+      SIGFPE,
+      SIGILL,
+      SIGSEGV,
+      SIGSYS,
+      SIGABRT,
+      SIGTRAP,
+     #if !defined(BSLS_PLATFORM_OS_CYGWIN) || defined(SIGIOT)
+      SIGIOT
+     #endif
+    };
+
+    const int SIZE = sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i = 0; i < SIZE; ++i) {
+        sigdelset(blockSet, synchronousSignals[i]);
+    }
+}
+#endif
+
+                               // ===========
+                               // class Deque
+                               // ===========
+
+class Deque {
+    // This class implements a Chase-Lev work-stealing deque of fixed
+    // capacity, holding pointers to jobs.  The owner of the deque pushes and
+    // pops jobs at its bottom, and any thread can steal jobs at its top.
+
+    // PRIVATE TYPES
+    typedef WorkStealingThreadPool::Job Job;
+
+    enum {
+        k_CAPACITY = 1024,  // must be a power of 2
+        k_MASK     = k_CAPACITY - 1,
+        k_PADDING  = bslmt::Platform::e_CACHE_LINE_SIZE
+                                                   - sizeof(bsls::AtomicInt64)
+    };
+
+    // DATA
+    bsls::AtomicInt64        d_top;                // index of the next job to
+                                                   // steal
+
+    char                     d_topPadding[k_PADDING];
+                                                   // avoid false sharing of
+                                                   // 'd_top' and 'd_bottom'
+
+    bsls::AtomicInt64        d_bottom;             // index of the next job to
+                                                   // push
+
+    char                     d_bottomPadding[k_PADDING];
+
+    bsls::AtomicPointer<Job> d_jobs[k_CAPACITY];   // circular array of jobs
+
+  private:
+    // NOT IMPLEMENTED
+    Deque(const Deque&);
+    Deque& operator=(const Deque&);
+
+  public:
+    // CREATORS
+    Deque();
+        // Create an empty deque.
+
+    // MANIPULATORS
+    Job *pop();
+        // Remove the job at the bottom of this deque and return it, or return
+        // 0 if this deque is empty.  The behavior is undefined unless this
+        // method is called by the owner of this deque.
+
+    bool push(Job *job);
+        // Push the specified 'job' at the bottom of this deque.  Return
+        // 'true' on success, and 'false', with no effect, if this deque is
+        // full.  The behavior is undefined unless this method is called by
+        // the owner of this deque.
+
+    Job *steal();
+        // Remove the job at the top of this deque and return it, or return 0
+        // if this deque is empty or another thread removed that job
+        // concurrently.
+
+    // ACCESSORS
+    int length() const;
+        // Return a snapshot of the number of jobs in this deque.
+};
+
+                               // -----------
+                               // class Deque
+                               // -----------
+
+// CREATORS
+Deque::Deque()
+: d_top(0)
+, d_bottom(0)
+{
+}
+
+// MANIPULATORS
+Deque::Job *Deque::pop()
+{
+    // Reserve the bottom job before checking whether a thief may be taking
+    // it: both 'd_bottom' and 'd_top' are accessed with sequential
+    // consistency, so that the owner and a thief cannot both miss each other.
+
+    const bsls::Types::Int64 bottom = d_bottom.loadRelaxed() - 1;
+    d_bottom = bottom;
+
+    const bsls::Types::Int64 top = d_top;
+
+    if (bottom < top) {
+        d_bottom.storeRelaxed(top);
+        return 0;                                                     // RETURN
+    }
+
+    Job *job = d_jobs[bottom & k_MASK].loadRelaxed();
+
+    if (bottom == top) {
+        // This is the last job: race with the thieves for it.
+
+        if (d_top.testAndSwap(top, top + 1) != top) {
+            job = 0;
+        }
+        d_bottom.storeRelaxed(top + 1);
+    }
+    return job;
+}
+
+bool Deque::push(Job *job)
+{
+    const bsls::Types::Int64 bottom = d_bottom.loadRelaxed();
+
+    if (bottom - d_top.loadAcquire() >= k_CAPACITY) {
+        return false;                                                 // RETURN
+    }
+
+    // Publish the job with sequential consistency, so that either an idle
+    // thread sees it, or the caller sees that thread (see 'workerThread').
+
+    d_jobs[bottom & k_MASK].storeRelaxed(job);
+    d_bottom = bottom + 1;
+    return true;
+}
+
+Deque::Job *Deque::steal()
+{
+    const bsls::Types::Int64 top    = d_top;
+    const bsls::Types::Int64 bottom = d_bottom;
+
+    if (bottom <= top) {
+        return 0;                                                     // RETURN
+    }
+
+    // Note that, if the owner overwrote the slot read below, 'd_top' was
+    // incremented since it was read, and the swap fails.
+
+    Job *job = d_jobs[top & k_MASK].loadRelaxed();
+
+    if (d_top.testAndSwap(top, top + 1) != top) {
+        return 0;                                                     // RETURN
+    }
+    return job;
+}
+
+// ACCESSORS
+int Deque::length() const
+{
+    const bsls::Types::Int64 top    = d_top;
+    const bsls::Types::Int64 bottom = d_bottom;
+
+    return bottom > top ? static_cast<int>(bottom - top) : 0;
+}
+
+}  // close unnamed namespace
+
+                    // ===================================
+                    // class WorkStealingThreadPool_Worker
+                    // ===================================
+
+class WorkStealingThreadPool_Worker {
+    // This component-private class holds the state of a thread of a
+    // 'WorkStealingThreadPool'.
+
+    // PRIVATE TYPES
+    struct FreeJob {
+        // This 'struct' overlays the memory of a destroyed 'Job' in the cache
+        // of a worker.
+
+        FreeJob *d_next_p;  // next free memory block
+    };
+
+    enum { k_MAX_FREE_JOBS = 64 };  // capacity of the cache
+
+  public:
+    // PUBLIC DATA
+    Deque         d_deque;        // jobs enqueued by the thread
+
+    unsigned int  d_seed;         // state of the generator of the random
+                                  // numbers choosing the victims of the
+                                  // thefts
+
+    FreeJob      *d_freeJobs_p;   // memory of the jobs destroyed by the
+                                  // thread, to be reused by the jobs that it
+                                  // enqueues
+
+    int           d_numFreeJobs;  // length of 'd_freeJobs_p'
+
+    // CREATORS
+    explicit WorkStealingThreadPool_Worker(unsigned int seed)
+    : d_seed(seed | 1)
+    , d_freeJobs_p(0)
+    , d_numFreeJobs(0)
+    {
+    }
+
+    // MANIPULATORS
+    void *allocateJob(bdlma::ConcurrentPool *pool)
+        // Return a block of memory for a 'Job', taken from the cache of this
+        // worker, or from the specified 'pool' if the cache is empty.
+    {
+        if (!d_freeJobs_p) {
+            return pool->allocate();                                  // RETURN
+        }
+
+        FreeJob *block = d_freeJobs_p;
+        d_freeJobs_p = block->d_next_p;
+        --d_numFreeJobs;
+        return block;
+    }
+
+    void deallocateJob(void *memory, bdlma::ConcurrentPool *pool)
+        // Return the specified 'memory' of a destroyed 'Job' to the cache of
+        // this worker, or to the specified 'pool' if the cache is full.
+    {
+        if (k_MAX_FREE_JOBS <= d_numFreeJobs) {
+            pool->deallocate(memory);
+            return;                                                   // RETURN
+        }
+
+        FreeJob *block = static_cast<FreeJob *>(memory);
+        block->d_next_p = d_freeJobs_p;
+        d_freeJobs_p = block;
+        ++d_numFreeJobs;
+    }
+
+    unsigned int random()
+        // Return the next pseudo-random number of this worker.
+    {
+        // xorshift32
+
+        d_seed ^= d_seed << 13;
+        d_seed ^= d_seed >> 17;
+        d_seed ^= d_seed << 5;
+        return d_seed;
+    }
+};
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// PRIVATE MANIPULATORS
+WorkStealingThreadPool::Job *WorkStealingThreadPool::findJob(Worker *worker)
+{
+    Job *job = worker->d_deque.pop();
+
+    if (!job && 0 < d_queueLength) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_queueMutex);
+
+        if (!d_queue.empty()) {
+            job = d_queue.front();
+            d_queue.pop_front();
+            d_queueLength.addRelaxed(-1);
+        }
+    }
+
+    if (!job && 1 < d_numThreads) {
+        // Try each other worker once, starting from a random one.
+
+        const int first = static_cast<int>(worker->random() % d_numThreads);
+
+        for (int i = 0; i < d_numThreads && !job; ++i) {
+            Worker *victim = d_workers[(first + i) % d_numThreads];
+
+            if (victim != worker) {
+                job = victim->d_deque.steal();
+            }
+        }
+    }
+    return job;
+}
+
+void WorkStealingThreadPool::releaseJob(Worker *worker, Job *job)
+{
+    job->~Job();
+
+    if (worker) {
+        worker->deallocateJob(job, &d_jobPool);
+    }
+    else {
+        d_jobPool.deallocate(job);
+    }
+}
+
+void WorkStealingThreadPool::removeAllJobs()
+{
+    for (int i = 0; i < d_numThreads; ++i) {
+        while (Job *job = d_workers[i]->d_deque.pop()) {
+            releaseJob(0, job);
+        }
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_queueMutex);
+
+    while (!d_queue.empty()) {
+        Job *job = d_queue.front();
+        d_queue.pop_front();
+        d_queueLength.addRelaxed(-1);
+
+        releaseJob(0, job);
+    }
+}
+
+void WorkStealingThreadPool::setState(State state)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_queueMutex);
+        d_state = state;
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_sleepMutex);
+    d_jobAvailableCond.broadcast();
+}
+
+void WorkStealingThreadPool::workerThread(int index)
+{
+    Worker *worker = d_workers[index];
+
+    bslmt::ThreadUtil::setSpecific(d_workerKey, worker);
+
+    for (;;) {
+        const int state = d_state;
+
+        if (e_STOPPED == state) {
+            break;
+        }
+
+        Job *job = findJob(worker);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(job)) {
+            (*job)();
+            releaseJob(worker, job);
+            continue;
+        }
+
+        if (e_STOPPING == state) {
+            // All the jobs that this worker can see are taken, and no more
+            // jobs can be enqueued by threads not in the pool: the workers
+            // still executing jobs execute the jobs that they enqueue.
+
+            break;
+        }
+
+        // Wait for a job.  Note that 'enqueueJob' publishes the new job
+        // before checking 'd_numIdleThreads', and that this thread increments
+        // 'd_numIdleThreads' before checking the queues, all with sequential
+        // consistency, so that either this thread sees the new job, or
+        // 'enqueueJob' sees this thread and signals it.  The last thread to
+        // become idle, with no job pending, notifies 'drain'.
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_sleepMutex);
+
+        ++d_numIdleThreads;
+        while (!hasPendingJobs() && e_RUNNING == d_state) {
+            if (d_numIdleThreads >= d_threadGroup.numThreads()) {
+                d_drainedCond.broadcast();
+            }
+            d_jobAvailableCond.wait(&d_sleepMutex);
+        }
+        --d_numIdleThreads;
+    }
+
+    // Count this thread as idle until the next 'start', so that 'drain' does
+    // not wait for it.
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_sleepMutex);
+
+    ++d_numIdleThreads;
+    d_drainedCond.broadcast();
+}
+
+// PRIVATE ACCESSORS
+bool WorkStealingThreadPool::hasPendingJobs() const
+{
+    if (0 < d_queueLength) {
+        return true;                                                  // RETURN
+    }
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        if (0 < d_workers[i]->d_deque.length()) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+// CREATORS
+WorkStealingThreadPool::WorkStealingThreadPool(
+                                              int               numThreads,
+                                              bslma::Allocator *basicAllocator)
+: d_jobPool(sizeof(Job), basicAllocator)
+, d_workers(basicAllocator)
+, d_queue(basicAllocator)
+, d_queueLength(0)
+, d_state(e_STOPPED)
+, d_numIdleThreads(0)
+, d_threadGroup(basicAllocator)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= numThreads);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    initBlockSet(&d_blockSet);
+#endif
+
+    const int rc = bslmt::ThreadUtil::createKey(&d_workerKey, 0);
+    BSLS_ASSERT_OPT(0 == rc);
+
+    d_workers.reserve(numThreads);
+    for (int i = 0; i < numThreads; ++i) {
+        d_workers.push_back(new (*d_allocator_p) Worker(
+                                    static_cast<unsigned int>(i) * 2654435761u
+                                                                      + 1));
+    }
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                      const bslmt::ThreadAttributes&  threadAttributes,
+                      int                             numThreads,
+                      bslma::Allocator               *basicAllocator)
+: d_jobPool(sizeof(Job), basicAllocator)
+, d_workers(basicAllocator)
+, d_queue(basicAllocator)
+, d_queueLength(0)
+, d_state(e_STOPPED)
+, d_numIdleThreads(0)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(threadAttributes)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= numThreads);
+
+    // Force all threads to be joinable.
+
+    d_threadAttributes.setDetachedState(
+                               bslmt::ThreadAttributes::e_CREATE_JOINABLE);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    initBlockSet(&d_blockSet);
+#endif
+
+    const int rc = bslmt::ThreadUtil::createKey(&d_workerKey, 0);
+    BSLS_ASSERT_OPT(0 == rc);
+
+    d_workers.reserve(numThreads);
+    for (int i = 0; i < numThreads; ++i) {
+        d_workers.push_back(new (*d_allocator_p) Worker(
+                                    static_cast<unsigned int>(i) * 2654435761u
+                                                                      + 1));
+    }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    shutdown();
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        d_allocator_p->deleteObjectRaw(d_workers[i]);
+    }
+
+    bslmt::ThreadUtil::deleteKey(d_workerKey);
+}
+
+// MANIPULATORS
+int WorkStealingThreadPool::enqueueJob(const Job& functor)
+{
+    BSLS_ASSERT(functor);
+
+    Worker *worker = static_cast<Worker *>(
+                                 bslmt::ThreadUtil::getSpecific(d_workerKey));
+
+    void *memory = worker ? worker->allocateJob(&d_jobPool)
+                          : d_jobPool.allocate();
+
+    bslma::DeallocatorProctor<bdlma::ConcurrentPool> proctor(memory,
+                                                             &d_jobPool);
+
+    Job *job = new (memory) Job(bsl::allocator_arg_t(),
+                                d_allocator_p,
+                                functor);
+    proctor.release();
+
+    if (!worker || !worker->d_deque.push(job)) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_queueMutex);
+
+        if (!worker && e_RUNNING != d_state) {
+            guard.release()->unlock();
+            releaseJob(0, job);
+            return -1;                                                // RETURN
+        }
+
+        d_queue.push_back(job);
+        d_queueLength.add(1);
+    }
+
+    if (0 < d_numIdleThreads) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_sleepMutex);
+        d_jobAvailableCond.signal();
+    }
+    return 0;
+}
+
+void WorkStealingThreadPool::drain()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_sleepMutex);
+
+    // All the jobs have completed once all the threads are idle (or exited)
+    // with no job pending.
+
+    while (d_numIdleThreads < d_threadGroup.numThreads()
+        || hasPendingJobs()) {
+        d_drainedCond.wait(&d_sleepMutex);
+    }
+}
+
+void WorkStealingThreadPool::shutdown()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_metaMutex);
+
+    setState(e_STOPPED);
+    d_threadGroup.joinAll();
+
+    removeAllJobs();
+}
+
+int WorkStealingThreadPool::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_metaMutex);
+
+    if (0 < d_threadGroup.numThreads()) {
+        return 0;                                                     // RETURN
+    }
+
+    // All the threads of a previous 'start' have been joined.
+
+    d_numIdleThreads = 0;
+
+    setState(e_RUNNING);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Block all asynchronous signals.
+
+    sigset_t oldset;
+    pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
+#endif
+
+    int rc = 0;
+    for (int i = 0; i < d_numThreads && 0 == rc; ++i) {
+        rc = d_threadGroup.addThread(
+                        bdlf::BindUtil::bind(&WorkStealingThreadPool::
+                                                                  workerThread,
+                                             this,
+                                             i),
+                        d_threadAttributes);
+    }
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Restore the mask.
+
+    pthread_sigmask(SIG_SETMASK, &oldset, &d_blockSet);
+#endif
+
+    if (0 != rc) {
+        setState(e_STOPPED);
+        d_threadGroup.joinAll();
+        removeAllJobs();
+        return -1;                                                    // RETURN
+    }
+    return 0;
+}
+
+void WorkStealingThreadPool::stop()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_metaMutex);
+
+    setState(e_STOPPING);
+    d_threadGroup.joinAll();
+
+    setState(e_STOPPED);
+}
+
+// ACCESSORS
+int WorkStealingThreadPool::numPendingJobs() const
+{
+    int numPendingJobs = d_queueLength;
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        numPendingJobs += d_workers[i]->d_deque.length();
+    }
+    return numPendingJobs;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,475 @@
+// bdlmt_workstealingthreadpool.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+#define INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size pool of threads with work stealing.
+//
+//@CLASSES:
+//  bdlmt::WorkStealingThreadPool: fixed-size work-stealing thread pool
+//
+//@SEE_ALSO: bdlmt_fixedthreadpool, bdlmt_threadpool
+//
+//@DESCRIPTION: This component defines a thread pool,
+// 'bdlmt::WorkStealingThreadPool', that executes user-defined functions
+// ("jobs") concurrently in a fixed number of threads, and that is designed for
+// fine-grained jobs that enqueue other jobs from inside the pool (e.g., the
+// recursive decomposition of a parallel computation).
+//
+// 'bdlmt::FixedThreadPool' and 'bdlmt::ThreadPool' feed all their threads
+// from a single queue, on which the threads contend when the jobs are short.
+// Instead, each thread of a 'bdlmt::WorkStealingThreadPool' (a *worker*) has
+// its own queue of jobs, a double-ended queue owned by that worker:
+//
+//: o A job enqueued by a worker (i.e., by a job executing in the pool) is
+//:   pushed onto the queue of that worker, without any lock.
+//:
+//: o A worker executes the job most recently pushed onto its own queue first
+//:   (i.e., in LIFO order), which is usually the job whose data is the most
+//:   likely to still be in the cache of its processor.
+//:
+//: o A worker whose queue is empty takes the jobs enqueued by threads that do
+//:   not belong to the pool, which are held in a queue shared by all the
+//:   workers, in FIFO order.
+//:
+//: o If there are none, it *steals* the *oldest* job of the queue of another
+//:   worker chosen at random, which, for a recursive decomposition, is
+//:   usually the largest piece of work left in that queue.
+//
+// The queue of each worker is a lock-free Chase-Lev deque of fixed capacity:
+// the owner pushes and pops jobs at one end, and the other workers steal jobs
+// at the other end with a single atomic compare-and-swap.  A job enqueued by a
+// worker whose queue is full is enqueued in the shared queue instead.  Idle
+// workers block until a job is enqueued.
+//
+// Enqueuing and executing jobs from the workers does not update any state
+// shared by all the workers: the memory of the jobs is recycled through a
+// small cache held by each worker, and the number of pending jobs is computed
+// from the lengths of the queues.  The workers only update the shared state
+// when they become idle, which is also when 'drain' is notified.
+//
+// The interface of 'bdlmt::WorkStealingThreadPool' follows the one of
+// 'bdlmt::FixedThreadPool': jobs are enqueued as 'bsl::function<void()>'
+// objects, or as a function taking a 'void *' argument, with 'enqueueJob', and
+// the pool is controlled with 'start', 'drain', 'stop', and 'shutdown'.  Note
+// that the number of pending jobs is not bounded, so that 'enqueueJob' never
+// blocks.
+//
+///Thread Safety
+///-------------
+// The 'bdlmt::WorkStealingThreadPool' class is both *fully thread-safe*
+// (i.e., all non-creator methods can correctly execute concurrently), and is
+// *thread-enabled* (i.e., the class does not function correctly in a
+// non-multi-threading environment).  See 'bsldoc_glossary' for complete
+// definitions of *fully thread-safe* and *thread-enabled*.  Note that 'drain',
+// 'stop', and 'shutdown' must not be called from a job executing in the pool.
+//
+///Synchronous Signals on Unix
+///---------------------------
+// As for 'bdlmt::FixedThreadPool', all the threads of the pool block all
+// asynchronous signals on unix platforms.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parallel Reduction
+///- - - - - - - - - - - - - - -
+// In this example, we sum the elements of a large array by recursively
+// splitting the array into halves, until the pieces are small enough to be
+// summed sequentially.
+//
+// First, we define the function summing the elements of the range
+// '[begin, end)'.  A range longer than 1000 elements is split in two, and the
+// first half is enqueued as a new job, which another worker may steal, while
+// the current job proceeds with the second half:
+//..
+//  void sumRange(bdlmt::WorkStealingThreadPool *pool,
+//                const int                     *begin,
+//                const int                     *end,
+//                bsls::AtomicInt64             *sum)
+//  {
+//      while (end - begin > 1000) {
+//          const int *middle = begin + (end - begin) / 2;
+//
+//          pool->enqueueJob(bdlf::BindUtil::bind(&sumRange,
+//                                                pool,
+//                                                begin,
+//                                                middle,
+//                                                sum));
+//          begin = middle;
+//      }
+//
+//      bsls::Types::Int64 partialSum = 0;
+//      for (; begin != end; ++begin) {
+//          partialSum += *begin;
+//      }
+//      sum->add(partialSum);
+//  }
+//..
+// Then, we create the array to sum, and a pool of 4 threads, that we start:
+//..
+//  bsl::vector<int> values(1000000);
+//  for (bsl::size_t i = 0; i < values.size(); ++i) {
+//      values[i] = static_cast<int>(i % 7);
+//  }
+//
+//  bdlmt::WorkStealingThreadPool pool(4);
+//  int rc = pool.start();
+//  assert(0 == rc);
+//..
+// Next, we enqueue the job summing the whole array:
+//..
+//  bsls::AtomicInt64 sum(0);
+//
+//  rc = pool.enqueueJob(bdlf::BindUtil::bind(&sumRange,
+//                                            &pool,
+//                                            values.data(),
+//                                            values.data() + values.size(),
+//                                            &sum));
+//  assert(0 == rc);
+//..
+// Finally, we wait until that job, and all the jobs it enqueued (directly or
+// not), have completed, and verify the sum:
+//..
+//  pool.drain();
+//
+//  bsls::Types::Int64 expected = 0;
+//  for (bsl::size_t i = 0; i < values.size(); ++i) {
+//      expected += values[i];
+//  }
+//  assert(expected == sum);
+//
+//  pool.stop();
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLF_BIND
+#include <bdlf_bind.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_CONCURRENTPOOL
+#include <bdlma_concurrentpool.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_CONDITION
+#include <bslmt_condition.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_MUTEX
+#include <bslmt_mutex.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADATTRIBUTES
+#include <bslmt_threadattributes.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADGROUP
+#include <bslmt_threadgroup.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADUTIL
+#include <bslmt_threadutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSL_DEQUE
+#include <bsl_deque.h>
+#endif
+
+#ifndef INCLUDED_BSL_FUNCTIONAL
+#include <bsl_functional.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#ifndef INCLUDED_BSL_C_SIGNAL
+#include <bsl_c_signal.h>
+#endif
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+extern "C" typedef void (*WorkStealingThreadPoolJobFunc)(void *);
+    // This type declares the prototype for functions that are suitable to be
+    // specified to 'bdlmt::WorkStealingThreadPool::enqueueJob'.
+
+class WorkStealingThreadPool_Worker;
+
+                        // ============================
+                        // class WorkStealingThreadPool
+                        // ============================
+
+class WorkStealingThreadPool {
+    // This class implements a thread pool used for concurrently executing
+    // multiple user-defined functions ("jobs"), in which each thread has its
+    // own queue of jobs, and steals the jobs of the other threads when it has
+    // none.
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+  private:
+    // PRIVATE TYPES
+    typedef WorkStealingThreadPool_Worker Worker;
+
+    enum State {
+        e_STOPPED,   // no thread is running (or threads are exiting without
+                     // executing any more job)
+        e_RUNNING,   // threads are running, and jobs can be enqueued by any
+                     // thread
+        e_STOPPING   // threads are exiting after executing all the jobs
+    };
+
+    // DATA
+    bdlma::ConcurrentPool   d_jobPool;           // memory of the 'Job'
+                                                 // objects not cached by a
+                                                 // worker
+
+    bsl::vector<Worker *>   d_workers;           // per-thread state (owned)
+
+    bsl::deque<Job *>       d_queue;             // jobs enqueued by threads
+                                                 // not in the pool
+
+    bsls::AtomicInt         d_queueLength;       // length of 'd_queue'
+
+    bslmt::Mutex            d_queueMutex;        // protects 'd_queue', and
+                                                 // serializes the changes of
+                                                 // 'd_state'
+
+    bsls::AtomicInt         d_state;             // 'State' of this pool
+
+    bsls::AtomicInt         d_numIdleThreads;    // number of threads waiting
+                                                 // for a job, or exited since
+                                                 // the last 'start'
+
+    bslmt::Mutex            d_sleepMutex;        // protects the waits on
+                                                 // 'd_jobAvailableCond' and
+                                                 // 'd_drainedCond'
+
+    bslmt::Condition        d_jobAvailableCond;  // signaled when a job is
+                                                 // enqueued or the state
+                                                 // changes
+
+    bslmt::Condition        d_drainedCond;       // signaled when all the
+                                                 // threads are idle
+
+    bslmt::ThreadUtil::Key  d_workerKey;         // key of the 'Worker' of the
+                                                 // calling thread
+
+    bslmt::Mutex            d_metaMutex;         // ensures that there is only
+                                                 // one controlling thread at
+                                                 // any time
+
+    bslmt::ThreadGroup      d_threadGroup;       // threads of this pool
+
+    bslmt::ThreadAttributes d_threadAttributes;  // attributes of the threads
+
+    const int               d_numThreads;        // number of threads
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sigset_t                d_blockSet;          // set of signals to be
+                                                 // blocked in managed threads
+#endif
+
+    bslma::Allocator       *d_allocator_p;       // memory allocator (held)
+
+    // PRIVATE MANIPULATORS
+    Job *findJob(Worker *worker);
+        // Take and return the next job to be executed by the specified
+        // 'worker': the last job of the queue of 'worker', or else the first
+        // job of the shared queue, or else the first job of the queue of
+        // another worker.  Return 0 if no job was found.
+
+    void releaseJob(Worker *worker, Job *job);
+        // Destroy the specified 'job', and return its memory to the cache of
+        // the specified 'worker', or to the pool shared by all the workers if
+        // 'worker' is 0 or its cache is full.
+
+    void removeAllJobs();
+        // Destroy all the jobs of the queues without executing them.  The
+        // behavior is undefined unless no thread of this pool is running.
+
+    void setState(State state);
+        // Set the state of this pool to the specified 'state', and awaken all
+        // the threads waiting for a job.
+
+    void workerThread(int index);
+        // Execute the jobs of this pool in the calling thread, as the worker
+        // at the specified 'index', until the pool is stopped.
+
+    // PRIVATE ACCESSORS
+    bool hasPendingJobs() const;
+        // Return 'true' if a job is enqueued and not yet taken by a thread of
+        // this pool, and 'false' otherwise.
+
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool(const WorkStealingThreadPool&);
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&);
+
+  public:
+    // CREATORS
+    explicit
+    WorkStealingThreadPool(int               numThreads,
+                           bslma::Allocator *basicAllocator = 0);
+        // Create a thread pool having the specified 'numThreads' threads,
+        // which are started by 'start'.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  The behavior is undefined
+        // unless '1 <= numThreads'.
+
+    WorkStealingThreadPool(
+                      const bslmt::ThreadAttributes&  threadAttributes,
+                      int                             numThreads,
+                      bslma::Allocator               *basicAllocator = 0);
+        // Create a thread pool having the specified 'numThreads' threads,
+        // created with the specified 'threadAttributes' when 'start' is
+        // called.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '1 <= numThreads'.
+
+    ~WorkStealingThreadPool();
+        // Remove all pending jobs without executing them, block until all
+        // currently running jobs complete, and then destroy this thread pool.
+
+    // MANIPULATORS
+    int enqueueJob(const Job& functor);
+        // Enqueue the specified 'functor' to be executed by a thread of this
+        // pool.  If called from a job executing in this pool, 'functor' is
+        // pushed onto the queue of the calling thread, and onto the queue
+        // shared by all the threads otherwise.  Return 0 on success, and a
+        // non-zero value if this function is not called from a job executing
+        // in this pool and the pool is not started (or is being stopped).
+        // The behavior is undefined unless 'functor' is not "unset".
+
+    int enqueueJob(WorkStealingThreadPoolJobFunc function, void *userData);
+        // Enqueue the specified 'function' to be executed, with the specified
+        // 'userData' as argument, by a thread of this pool.  Return 0 on
+        // success, and a non-zero value if this function is not called from a
+        // job executing in this pool and the pool is not started (or is being
+        // stopped).
+
+    void drain();
+        // Wait until all the enqueued jobs, including the jobs that they
+        // enqueue, have completed.  Note that if jobs are enqueued
+        // concurrently with this method by threads not in the pool, this
+        // method may or may not wait until they have also completed.  The
+        // behavior is undefined if this method is called from a job executing
+        // in this pool.
+
+    void shutdown();
+        // Disable enqueuing jobs from threads not in this pool, remove all
+        // pending jobs without executing them, and, after all the jobs being
+        // executed have completed, join all the threads of this pool.  The
+        // behavior is undefined if this method is called from a job executing
+        // in this pool.
+
+    int start();
+        // Spawn 'numThreads()' threads, and enable enqueuing jobs.  Return 0
+        // on success, and a non-zero value otherwise, in which case no thread
+        // is running.  This method has no effect if the pool is started.
+
+    void stop();
+        // Disable enqueuing jobs from threads not in this pool, wait until
+        // all the enqueued jobs (including the jobs that they enqueue) have
+        // completed, and join all the threads of this pool.  The behavior is
+        // undefined if this method is called from a job executing in this
+        // pool.
+
+    // ACCESSORS
+    bool isStarted() const;
+        // Return 'true' if 'numThreads()' threads are started in this pool,
+        // and 'false' otherwise.
+
+    int numPendingJobs() const;
+        // Return a snapshot of the number of jobs enqueued and not yet taken
+        // by a thread of this pool.
+
+    int numThreads() const;
+        // Return the number of threads passed to this thread pool at
+        // construction.
+
+    int numThreadsStarted() const;
+        // Return a snapshot of the number of threads currently started by this
+        // thread pool.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// MANIPULATORS
+inline
+int WorkStealingThreadPool::enqueueJob(WorkStealingThreadPoolJobFunc  function,
+                                       void                          *userData)
+{
+    return enqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
+}
+
+// ACCESSORS
+inline
+bool WorkStealingThreadPool::isStarted() const
+{
+    return d_numThreads == d_threadGroup.numThreads();
+}
+
+inline
+int WorkStealingThreadPool::numThreads() const
+{
+    return d_numThreads;
+}
+
+inline
+int WorkStealingThreadPool::numThreadsStarted() const
+{
+    return d_threadGroup.numThreads();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
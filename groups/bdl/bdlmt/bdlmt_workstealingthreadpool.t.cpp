@@ -0,0 +1,732 @@
+// bdlmt_workstealingthreadpool.t.cpp                                 -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a thread pool in which each thread has its own
+// lock-free deque of jobs and steals the jobs of the other threads when it
+// has none.  We verify that every enqueued job is executed exactly once,
+// whether it is enqueued from outside the pool or recursively from a job, that
+// jobs pushed onto the deque of a busy thread are stolen by the other threads,
+// that a job enqueued onto a full deque is still executed, and that 'stop' and
+// 'shutdown' respectively execute and discard the pending jobs without leaking
+// memory.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] WorkStealingThreadPool(int, bslma::Allocator *);
+// [ 4] WorkStealingThreadPool(const ThreadAttributes&, int, Allocator *);
+// [ 1] ~WorkStealingThreadPool();
+//
+// MANIPULATORS
+// [ 1] int enqueueJob(const Job& functor);
+// [ 4] int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+// [ 2] void drain();
+// [ 4] void shutdown();
+// [ 1] int start();
+// [ 4] void stop();
+//
+// ACCESSORS
+// [ 1] bool isStarted() const;
+// [ 4] int numPendingJobs() const;
+// [ 1] int numThreads() const;
+// [ 1] int numThreadsStarted() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] RECURSIVE ENQUEUING
+// [ 3] WORK STEALING
+// [ 5] OVERFLOW OF THE DEQUE OF A THREAD
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::WorkStealingThreadPool Obj;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+void increment(bsls::AtomicInt *counter)
+    // Increment the specified 'counter'.
+{
+    ++*counter;
+}
+
+extern "C" void incrementCallback(void *counter)
+    // Increment the 'bsls::AtomicInt' at the specified 'counter'.
+{
+    ++*static_cast<bsls::AtomicInt *>(counter);
+}
+
+void waitForFlag(bsls::AtomicInt *flag, bsls::AtomicInt *counter)
+    // Increment the specified 'counter', and then wait until the specified
+    // 'flag' is not 0.
+{
+    ++*counter;
+    while (0 == *flag) {
+        bslmt::ThreadUtil::microSleep(1000);
+    }
+}
+
+void setFlagAfterDelay(bsls::AtomicInt *flag, int milliseconds)
+    // Sleep for the specified 'milliseconds', and then set the specified
+    // 'flag' to 1.
+{
+    bslmt::ThreadUtil::microSleep(milliseconds * 1000);
+    *flag = 1;
+}
+
+void tree(Obj *pool, int depth, bsls::AtomicInt *counter)
+    // Increment the specified 'counter', and, unless the specified 'depth' is
+    // 0, enqueue in the specified 'pool' two jobs calling this function with
+    // 'depth - 1'.  Note that calling this function executes, directly or
+    // not, '2^(depth + 1) - 1' jobs.
+{
+    ++*counter;
+
+    if (0 < depth) {
+        for (int i = 0; i < 2; ++i) {
+            const int rc = pool->enqueueJob(bdlf::BindUtil::bind(&tree,
+                                                                 pool,
+                                                                 depth - 1,
+                                                                 counter));
+            ASSERTV(rc, 0 == rc);
+        }
+    }
+}
+
+                           // =====================
+                           // struct StealingRecord
+                           // =====================
+
+struct StealingRecord {
+    // This 'struct' records the threads that executed the children enqueued
+    // by a parent job.
+
+    bslmt::Mutex                    d_mutex;
+    bsl::set<bsls::Types::Uint64>   d_threadIds;  // threads of the children
+    bsls::AtomicInt                 d_numDone;    // number of children done
+};
+
+void child(StealingRecord *record)
+    // Sleep briefly, and then record the calling thread in the specified
+    // 'record'.
+{
+    bslmt::ThreadUtil::microSleep(100);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&record->d_mutex);
+        record->d_threadIds.insert(bslmt::ThreadUtil::selfIdAsUint64());
+    }
+    ++record->d_numDone;
+}
+
+void parent(Obj *pool, int numChildren, StealingRecord *record)
+    // Enqueue the specified 'numChildren' jobs recording their thread in the
+    // specified 'record' in the specified 'pool', and wait (for at most 10
+    // seconds) until they have all completed.  Note that the children are
+    // pushed onto the deque of the calling thread, which is busy executing
+    // this job: they complete only if they are stolen by other threads.
+{
+    for (int i = 0; i < numChildren; ++i) {
+        pool->enqueueJob(bdlf::BindUtil::bind(&child, record));
+    }
+
+    for (int i = 0; i < 10000 && record->d_numDone < numChildren; ++i) {
+        bslmt::ThreadUtil::microSleep(1000);
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&record->d_mutex);
+        ASSERT(0 == record->d_threadIds.count(
+                                        bslmt::ThreadUtil::selfIdAsUint64()));
+    }
+}
+
+void fanOut(Obj *pool, int numChildren, bsls::AtomicInt *counter)
+    // Enqueue in the specified 'pool' the specified 'numChildren' jobs
+    // incrementing the specified 'counter'.
+{
+    for (int i = 0; i < numChildren; ++i) {
+        const int rc = pool->enqueueJob(bdlf::BindUtil::bind(&increment,
+                                                             counter));
+        ASSERTV(rc, 0 == rc);
+    }
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parallel Reduction
+///- - - - - - - - - - - - - - -
+// In this example, we sum the elements of a large array by recursively
+// splitting the array into halves, until the pieces are small enough to be
+// summed sequentially.
+//
+// First, we define the function summing the elements of the range
+// '[begin, end)'.  A range longer than 1000 elements is split in two, and the
+// first half is enqueued as a new job, which another worker may steal, while
+// the current job proceeds with the second half:
+//..
+    void sumRange(bdlmt::WorkStealingThreadPool *pool,
+                  const int                     *begin,
+                  const int                     *end,
+                  bsls::AtomicInt64             *sum)
+    {
+        while (end - begin > 1000) {
+            const int *middle = begin + (end - begin) / 2;
+
+            pool->enqueueJob(bdlf::BindUtil::bind(&sumRange,
+                                                  pool,
+                                                  begin,
+                                                  middle,
+                                                  sum));
+            begin = middle;
+        }
+
+        bsls::Types::Int64 partialSum = 0;
+        for (; begin != end; ++begin) {
+            partialSum += *begin;
+        }
+        sum->add(partialSum);
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create the array to sum, and a pool of 4 threads, that we start:
+//..
+    bsl::vector<int> values(1000000);
+    for (bsl::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>(i % 7);
+    }
+
+    bdlmt::WorkStealingThreadPool pool(4);
+    int rc = pool.start();
+    ASSERT(0 == rc);
+//..
+// Next, we enqueue the job summing the whole array:
+//..
+    bsls::AtomicInt64 sum(0);
+
+    rc = pool.enqueueJob(bdlf::BindUtil::bind(&sumRange,
+                                              &pool,
+                                              values.data(),
+                                              values.data() + values.size(),
+                                              &sum));
+    ASSERT(0 == rc);
+//..
+// Finally, we wait until that job, and all the jobs it enqueued (directly or
+// not), have completed, and verify the sum:
+//..
+    pool.drain();
+
+    bsls::Types::Int64 expected = 0;
+    for (bsl::size_t i = 0; i < values.size(); ++i) {
+        expected += values[i];
+    }
+    ASSERT(expected == sum);
+
+    pool.stop();
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // OVERFLOW OF THE DEQUE OF A THREAD
+        //
+        // Concerns:
+        //: 1 A job enqueued by a thread of the pool whose deque is full is
+        //:   executed.
+        //
+        // Plan:
+        //: 1 For pools of 1 and 4 threads, enqueue a job that enqueues many
+        //:   more jobs than the capacity of a deque, and verify, after
+        //:   'drain', that all of them were executed.  (C-1)
+        //
+        // Testing:
+        //   OVERFLOW OF THE DEQUE OF A THREAD
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "OVERFLOW OF THE DEQUE OF A THREAD" << endl
+                          << "=================================" << endl;
+
+        const int NUM_CHILDREN = 10000;
+        const int NUM_THREADS[] = { 1, 4 };
+
+        for (int ti = 0; ti < 2; ++ti) {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                Obj mX(NUM_THREADS[ti], &ta);
+                ASSERT(0 == mX.start());
+
+                bsls::AtomicInt counter(0);
+
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&fanOut,
+                                                               &mX,
+                                                               NUM_CHILDREN,
+                                                               &counter)));
+                mX.drain();
+
+                ASSERTV(NUM_THREADS[ti], counter, NUM_CHILDREN == counter);
+                ASSERT(0 == mX.numPendingJobs());
+
+                mX.stop();
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'stop', 'shutdown', AND 'enqueueJob' OF A FUNCTION
+        //
+        // Concerns:
+        //: 1 Jobs can not be enqueued from outside the pool while it is not
+        //:   running, and can be enqueued again once restarted.
+        //:
+        //: 2 'stop' executes all the pending jobs, including the jobs that
+        //:   they enqueue, before joining the threads.
+        //:
+        //: 3 'shutdown' discards the pending jobs, without leaking them.
+        //:
+        //: 4 'enqueueJob' accepts a function taking a 'void *'.
+        //:
+        //: 5 The thread attributes passed at construction are accepted.
+        //
+        // Plan:
+        //: 1 Verify that 'enqueueJob' fails on a pool that is not started,
+        //:   and after 'stop' and 'shutdown'.  (C-1)
+        //:
+        //: 2 Enqueue a recursive tree of jobs, call 'stop' without 'drain',
+        //:   and verify that all the jobs were executed.  (C-2)
+        //:
+        //: 3 With a single thread, enqueue a job blocking the thread until a
+        //:   flag is set by another thread after a delay, and, once it is
+        //:   executing, functions taking a 'void *'; call 'shutdown', and
+        //:   verify that no function was executed, and that all memory is
+        //:   returned.  (C-3, 4)
+        //:
+        //: 4 Restart the pool, and verify that the functions are executed.
+        //:   (C-1, 4)
+        //
+        // Testing:
+        //   WorkStealingThreadPool(const ThreadAttributes&, int, Allocator *);
+        //   int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+        //   void shutdown();
+        //   void stop();
+        //   int numPendingJobs() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'stop', 'shutdown', AND 'enqueueJob' OF A "
+                             "FUNCTION" << endl
+                          << "=========================================="
+                             "========" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        bsls::AtomicInt counter(0);
+
+        if (verbose) cout << "\tEnqueuing in a stopped pool." << endl;
+        {
+            Obj mX(2, &ta);
+
+            ASSERT(0 != mX.enqueueJob(&incrementCallback, &counter));
+            ASSERT(0 != mX.enqueueJob(bdlf::BindUtil::bind(&increment,
+                                                           &counter)));
+            ASSERT(0 == mX.numPendingJobs());
+            ASSERT(0 == counter);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\t'stop' executes the pending jobs." << endl;
+        {
+            bslmt::ThreadAttributes attributes;
+            attributes.setStackSize(1024 * 1024);
+
+            Obj mX(attributes, 4, &ta);
+            ASSERT(0 == mX.start());
+
+            const int DEPTH = 12;
+
+            counter = 0;
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&tree,
+                                                           &mX,
+                                                           DEPTH,
+                                                           &counter)));
+            mX.stop();
+
+            ASSERTV(counter, (1 << (DEPTH + 1)) - 1 == counter);
+            ASSERT(0 == mX.numThreadsStarted());
+            ASSERT(0 == mX.numPendingJobs());
+
+            ASSERT(0 != mX.enqueueJob(&incrementCallback, &counter));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\t'shutdown' discards the pending jobs."
+                          << endl;
+        {
+            const int NUM_JOBS = 10;
+
+            Obj mX(1, &ta);
+            ASSERT(0 == mX.start());
+
+            bsls::AtomicInt flag(0);
+            bsls::AtomicInt blockedCounter(0);
+
+            counter = 0;
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&waitForFlag,
+                                                           &flag,
+                                                           &blockedCounter)));
+            while (0 == blockedCounter) {
+                bslmt::ThreadUtil::yield();
+            }
+
+            for (int i = 0; i < NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(&incrementCallback, &counter));
+            }
+            ASSERT(NUM_JOBS <= mX.numPendingJobs());
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                 &handle,
+                                 bdlf::BindUtil::bind(&setFlagAfterDelay,
+                                                      &flag,
+                                                      500)));
+
+            mX.shutdown();
+            bslmt::ThreadUtil::join(handle);
+
+            ASSERT(1 == blockedCounter);
+            ASSERTV(counter, 0 == counter);
+            ASSERT(0 == mX.numPendingJobs());
+            ASSERT(0 == mX.numThreadsStarted());
+            ASSERT(!mX.isStarted());
+
+            ASSERT(0 != mX.enqueueJob(&incrementCallback, &counter));
+
+            if (verbose) cout << "\tRestarting the pool." << endl;
+
+            ASSERT(0 == mX.start());
+            ASSERT(mX.isStarted());
+
+            for (int i = 0; i < NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(&incrementCallback, &counter));
+            }
+            mX.drain();
+
+            ASSERTV(counter, NUM_JOBS == counter);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // WORK STEALING
+        //
+        // Concerns:
+        //: 1 The jobs pushed onto the deque of a thread that is busy are
+        //:   executed by the other threads of the pool.
+        //
+        // Plan:
+        //: 1 In a pool of 4 threads, enqueue a job that enqueues children
+        //:   jobs recording their thread, and waits until they have
+        //:   completed: verify that they completed, and that none of them was
+        //:   executed by the thread of the parent.  (C-1)
+        //
+        // Testing:
+        //   WORK STEALING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "WORK STEALING" << endl
+                          << "=============" << endl;
+
+        const int NUM_CHILDREN = 200;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(4, &ta);
+            ASSERT(0 == mX.start());
+
+            StealingRecord record;
+
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&parent,
+                                                           &mX,
+                                                           NUM_CHILDREN,
+                                                           &record)));
+            mX.drain();
+
+            ASSERTV(record.d_numDone, NUM_CHILDREN == record.d_numDone);
+            ASSERT(1 <= record.d_threadIds.size());
+            ASSERT(3 >= record.d_threadIds.size());
+
+            if (verbose) {
+                P(record.d_threadIds.size());
+            }
+
+            mX.stop();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // RECURSIVE ENQUEUING
+        //
+        // Concerns:
+        //: 1 Every job enqueued from a job executing in the pool is executed
+        //:   exactly once.
+        //:
+        //: 2 'drain' waits until the jobs enqueued by the jobs have also
+        //:   completed.
+        //:
+        //: 3 The pool can be drained several times.
+        //
+        // Plan:
+        //: 1 For pools of 1 to 8 threads, enqueue, several times, a job that
+        //:   enqueues a binary tree of jobs counting their executions, and
+        //:   verify the count after 'drain'.  (C-1..3)
+        //
+        // Testing:
+        //   void drain();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RECURSIVE ENQUEUING" << endl
+                          << "===================" << endl;
+
+        const int DEPTH = 14;
+        const int NUM_JOBS = (1 << (DEPTH + 1)) - 1;
+
+        for (int numThreads = 1; numThreads <= 8; ++numThreads) {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                Obj mX(numThreads, &ta);
+                ASSERT(0 == mX.start());
+
+                for (int i = 0; i < 3; ++i) {
+                    bsls::AtomicInt counter(0);
+
+                    ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&tree,
+                                                                   &mX,
+                                                                   DEPTH,
+                                                                   &counter)));
+                    mX.drain();
+
+                    ASSERTV(numThreads, i, counter, NUM_JOBS == counter);
+                    ASSERT(0 == mX.numPendingJobs());
+                }
+
+                mX.stop();
+            }
+            ASSERTV(numThreads, 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a pool, start it, enqueue jobs from the main thread, drain
+        //:   it, and stop it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   WorkStealingThreadPool(int, bslma::Allocator *);
+        //   ~WorkStealingThreadPool();
+        //   int enqueueJob(const Job& functor);
+        //   int start();
+        //   bool isStarted() const;
+        //   int numThreads() const;
+        //   int numThreadsStarted() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const int NUM_JOBS = 1000;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(3, &ta);  const Obj& X = mX;
+
+            ASSERT(3 == X.numThreads());
+            ASSERT(0 == X.numThreadsStarted());
+            ASSERT(!X.isStarted());
+
+            ASSERT(0 == mX.start());
+            ASSERT(3 == X.numThreadsStarted());
+            ASSERT(X.isStarted());
+
+            ASSERT(0 == mX.start());
+            ASSERT(3 == X.numThreadsStarted());
+
+            bsls::AtomicInt counter(0);
+
+            for (int i = 0; i < NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&increment,
+                                                               &counter)));
+            }
+            mX.drain();
+
+            ASSERTV(counter, NUM_JOBS == counter);
+            ASSERT(0 == X.numPendingJobs());
+
+            mX.stop();
+            ASSERT(0 == X.numThreadsStarted());
+            ASSERT(!X.isStarted());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
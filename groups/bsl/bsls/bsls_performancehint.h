@@ -20,9 +20,10 @@ BSLS_IDENT("$Id: $")
 //  BSLS_PERFORMANCEHINT_OPTIMIZATION_FENCE: prevent compiler optimizations
 //
 //@DESCRIPTION: This component provides performance hints for the compiler or
-// hardware.  There are currently two types of hints that are supported:
+// hardware.  There are currently three types of hints that are supported:
 //: o branch prediction
 //: o data cache prefetching
+//: o spin-wait pausing
 //
 ///Branch Prediction
 ///-----------------
@@ -131,6 +132,16 @@ BSLS_IDENT("$Id: $")
 // used to understand the program's behavior before attempting to optimize with
 // these functions.
 //
+///Spin-Wait Pause
+///---------------
+// The 'spinPause' function provided in the 'bsls::PerformanceHint' 'struct'
+// is intended to be called in each iteration of a loop polling a memory
+// location modified by another thread.  On x86 platforms, it issues a 'pause'
+// instruction, which reduces the power consumed by the loop, yields the
+// resources of the processor to a sibling hyper-thread, and avoids the
+// penalty of a memory-order violation when the loop exits.  On other
+// platforms, this function has no effect.
+//
 ///Optimization Fence
 ///------------------
 // The macro 'BSLS_PERFORMANCEHINT_OPTIMIZATION_FENCE' prevents some compiler
@@ -519,6 +530,12 @@ struct PerformanceHint {
         // level document for limitations).  Otherwise this method has no
         // effect.
 
+    static void spinPause();
+        // Hint to the processor that the calling thread is polling a memory
+        // location in a spin-wait loop, if such a hint is available (see the
+        // component-level documentation).  Otherwise this method has no
+        // effect.
+
     static void rarelyCalled();
         // This is an empty function that is marked as rarely called using
         // pragmas.  If this function is placed in a block of code inside a
@@ -621,6 +638,22 @@ void PerformanceHint::prefetchForWriting(void *address)
 #endif
 }
 
+inline
+void PerformanceHint::spinPause()
+{
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+
+    __builtin_ia32_pause();
+
+#elif defined(BSLS_PLATFORM_CMP_MSVC)
+
+    _mm_pause();
+
+#endif
+#endif
+}
+
 // This function must be inlined for the pragma to take effect on the branch
 // prediction in IBM xlC.
 
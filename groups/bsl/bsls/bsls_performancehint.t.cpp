@@ -46,6 +46,7 @@ using namespace bsls;
 //                     'BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY'
 // [ 2] Usage Example: Using 'BSLS_PERFORMANCEHINT_PREDICT_EXPECT'
 // [ 3] Usage Example: Using 'prefetchForReading' and 'prefetchForWriting'
+// [ 6] void spinPause();
 //-----------------------------------------------------------------------------
 // [-1] Performance Test: Verifies the performance of test 1, 2, 3
 //-----------------------------------------------------------------------------
@@ -641,7 +642,33 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'spinPause'
+        //
+        // Concerns:
+        //   'spinPause' compiles, links, and returns on all platforms, and
+        //   can be called in a loop polling a variable.
+        //
+        // Plan:
+        //   Call 'spinPause' in a loop polling a 'volatile' counter, and
+        //   verify that the loop completes.
+        //
+        // Testing:
+        //   void spinPause();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'spinPause'"
+                            "\n===================\n");
 
+        volatile int counter = 0;
+        while (counter < 1000) {
+            BloombergLP::bsls::PerformanceHint::spinPause();
+            counter = counter + 1;
+        }
+        ASSERT(1000 == counter);
+
+      } break;
 
       case 5: {
         // --------------------------------------------------------------------
@@ -0,0 +1,272 @@
+// btlb_blobframingutil.cpp                                           -*-C++-*-
+#include <btlb_blobframingutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(btlb_blobframingutil_cpp,"$Id$ $CSID$")
+
+#include <btlb_blobutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace {
+
+int fixedHeaderLength(btlb::BlobFramingUtil::HeaderFormat format)
+    // Return the length of a header in the specified 'format', or 0 if
+    // headers in 'format' have a variable length.
+{
+    switch (format) {
+      case btlb::BlobFramingUtil::e_UINT8:  return 1;                 // RETURN
+      case btlb::BlobFramingUtil::e_UINT16: return 2;                 // RETURN
+      case btlb::BlobFramingUtil::e_UINT32: return 4;                 // RETURN
+      case btlb::BlobFramingUtil::e_VARINT: return 0;                 // RETURN
+    }
+
+    BSLS_ASSERT(!"Unknown header format");
+    return 0;
+}
+
+}  // close unnamed namespace
+
+namespace btlb {
+
+                           // ----------------------
+                           // struct BlobFramingUtil
+                           // ----------------------
+
+// CLASS METHODS
+int BlobFramingUtil::encodeHeader(char         *buffer,
+                                  int           messageLength,
+                                  HeaderFormat  format)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 <= messageLength);
+
+    const unsigned int value = static_cast<unsigned int>(messageLength);
+
+    switch (format) {
+      case e_UINT8: {
+        if (0xFF < value) {
+            return -1;                                                // RETURN
+        }
+        buffer[0] = static_cast<char>(value);
+        return 1;                                                     // RETURN
+      }
+      case e_UINT16: {
+        if (0xFFFF < value) {
+            return -1;                                                // RETURN
+        }
+        buffer[0] = static_cast<char>(value >> 8);
+        buffer[1] = static_cast<char>(value);
+        return 2;                                                     // RETURN
+      }
+      case e_UINT32: {
+        buffer[0] = static_cast<char>(value >> 24);
+        buffer[1] = static_cast<char>(value >> 16);
+        buffer[2] = static_cast<char>(value >> 8);
+        buffer[3] = static_cast<char>(value);
+        return 4;                                                     // RETURN
+      }
+      case e_VARINT: {
+        unsigned int remaining = value;
+        int          length    = 0;
+        while (0x7F < remaining) {
+            buffer[length++] = static_cast<char>(0x80 | (remaining & 0x7F));
+            remaining >>= 7;
+        }
+        buffer[length++] = static_cast<char>(remaining);
+        return length;                                                // RETURN
+      }
+    }
+
+    BSLS_ASSERT(!"Unknown header format");
+    return -1;
+}
+
+int BlobFramingUtil::extractDelimited(Blob       *message,
+                                      int        *numNeeded,
+                                      Blob       *data,
+                                      const char *delimiter,
+                                      int         delimiterLength,
+                                      int        *scanPosition,
+                                      int         maxMessageLength)
+{
+    BSLS_ASSERT(message);
+    BSLS_ASSERT(numNeeded);
+    BSLS_ASSERT(data);
+    BSLS_ASSERT(delimiter);
+    BSLS_ASSERT(0 < delimiterLength);
+    BSLS_ASSERT(!scanPosition || 0 <= *scanPosition);
+    BSLS_ASSERT(!scanPosition || *scanPosition <= data->length());
+    BSLS_ASSERT(0 <= maxMessageLength);
+
+    const int length = data->length();
+    const int start  = scanPosition ? *scanPosition : 0;
+
+    const int position = BlobUtil::findSequence(*data,
+                                                delimiter,
+                                                delimiterLength,
+                                                start);
+
+    if (position < 0) {
+        // The next search must consider the bytes that may start a
+        // delimiter completed by the next bytes.
+
+        const int nextStart = bsl::max(start, length - delimiterLength + 1);
+
+        if (nextStart > maxMessageLength) {
+            return -1;                                                // RETURN
+        }
+
+        if (scanPosition) {
+            *scanPosition = nextStart;
+        }
+        *numNeeded = nextStart + delimiterLength - length;
+        return 1;                                                     // RETURN
+    }
+
+    if (position > maxMessageLength) {
+        return -1;                                                    // RETURN
+    }
+
+    message->removeAll();
+    BlobUtil::append(message, *data, 0, position);
+    BlobUtil::erase(data, 0, position + delimiterLength);
+
+    if (scanPosition) {
+        *scanPosition = 0;
+    }
+    return 0;
+}
+
+int BlobFramingUtil::extractLengthPrefixed(Blob         *message,
+                                           int          *numNeeded,
+                                           Blob         *data,
+                                           HeaderFormat  format,
+                                           int           maxMessageLength)
+{
+    BSLS_ASSERT(message);
+    BSLS_ASSERT(numNeeded);
+    BSLS_ASSERT(data);
+    BSLS_ASSERT(0 <= maxMessageLength);
+
+    const int length = data->length();
+
+    // Copy the bytes that may hold the header (wherever they are in the
+    // buffers of 'data').
+
+    unsigned char header[k_MAX_HEADER_LENGTH];
+
+    const int fixedLength = fixedHeaderLength(format);
+    const int numCopied   = bsl::min(length,
+                                     fixedLength ? fixedLength
+                                                 : k_MAX_HEADER_LENGTH);
+    if (0 < numCopied) {
+        BlobUtil::copy(reinterpret_cast<char *>(header), *data, 0, numCopied);
+    }
+
+    bsls::Types::Uint64 messageLength = 0;
+    int                 headerLength  = 0;
+
+    if (fixedLength) {
+        if (numCopied < fixedLength) {
+            *numNeeded = fixedLength - numCopied;
+            return 1;                                                 // RETURN
+        }
+
+        for (int i = 0; i < fixedLength; ++i) {
+            messageLength = (messageLength << 8) | header[i];
+        }
+        headerLength = fixedLength;
+    }
+    else {
+        for (;;) {
+            if (headerLength == numCopied) {
+                if (k_MAX_HEADER_LENGTH == headerLength) {
+                    return -1;                                        // RETURN
+                }
+                *numNeeded = 1;
+                return 1;                                             // RETURN
+            }
+
+            const unsigned char byte = header[headerLength];
+
+            messageLength |= static_cast<bsls::Types::Uint64>(byte & 0x7F)
+                                                        << (7 * headerLength);
+            ++headerLength;
+
+            if (0 == (byte & 0x80)) {
+                if (1 < headerLength && 0 == byte) {
+                    return -1;                                        // RETURN
+                }
+                break;
+            }
+        }
+    }
+
+    if (messageLength > static_cast<bsls::Types::Uint64>(maxMessageLength)) {
+        return -1;                                                    // RETURN
+    }
+
+    const int bodyLength = static_cast<int>(messageLength);
+    const int available  = length - headerLength;
+
+    if (available < bodyLength) {
+        *numNeeded = bodyLength - available;
+        return 1;                                                     // RETURN
+    }
+
+    message->removeAll();
+    BlobUtil::append(message, *data, headerLength, bodyLength);
+    BlobUtil::erase(data, 0, headerLength + bodyLength);
+    return 0;
+}
+
+int BlobFramingUtil::prependHeader(Blob              *message,
+                                   HeaderFormat       format,
+                                   BlobBufferFactory *factory)
+{
+    BSLS_ASSERT(message);
+    BSLS_ASSERT(factory);
+
+    char      header[k_MAX_HEADER_LENGTH];
+    const int headerLength = encodeHeader(header, message->length(), format);
+
+    if (headerLength < 0) {
+        return -1;                                                    // RETURN
+    }
+
+    BlobBuffer buffer;
+    factory->allocate(&buffer);
+
+    BSLS_ASSERT(headerLength <= buffer.size());
+
+    bsl::memcpy(buffer.data(), header, headerLength);
+    buffer.setSize(headerLength);
+
+    message->prependDataBuffer(buffer);
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,246 @@
+// btlb_blobframingutil.h                                             -*-C++-*-
+#ifndef INCLUDED_BTLB_BLOBFRAMINGUTIL
+#define INCLUDED_BTLB_BLOBFRAMINGUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities to split a stream of blob data into messages.
+//
+//@CLASSES:
+//  btlb::BlobFramingUtil: suite of message framing functions on 'btlb::Blob'
+//
+//@SEE_ALSO: btlb_blob, btlb_blobutil, btlmt_channelpool
+//
+//@DESCRIPTION: This component provides a 'struct', 'btlb::BlobFramingUtil',
+// that provides a suite of functions to split a stream of bytes held in a
+// 'btlb::Blob' (e.g., the data supplied to a 'btlmt::ChannelPool' blob-based
+// read callback) into messages, and to frame messages to be written to such a
+// stream.  Two framing schemes are supported:
+//
+//: o *Length-prefixed* messages, each preceded by a header holding the length
+//:   of the message, encoded as specified by a 'HeaderFormat': an unsigned
+//:   integer of 1, 2, or 4 bytes in network byte order, or a variable-length
+//:   integer of 1 to 5 bytes (see {Variable-Length Headers}).
+//:
+//: o *Delimited* messages, each followed by a delimiter sequence of one or
+//:   more bytes (e.g., "\r\n").
+//
+// The 'extract*' functions are designed to be called in a loop from a read
+// callback: each call either moves the first complete message of the data
+// into a separate blob, or loads the minimum number of additional bytes the
+// data must have before it holds a complete message (i.e., the 'numNeeded'
+// expected by 'btlmt::ChannelPool').
+//
+///Performance
+///-----------
+// The messages are extracted *without* *copying* their bytes: the extracted
+// message blob refers to the same 'btlb::BlobBuffer' objects (or parts of
+// them) as the data it was extracted from, and the data simply stops
+// referring to them.  In particular, the messages need not be (and are not)
+// made contiguous, so that the copy that 'btlb::BlobUtil::getContiguousRange'
+// 'OrCopy' performs for messages spanning several buffers is avoided.  Note
+// that an extracted message keeps its buffers alive (and, for a
+// 'btlb::PooledBlobBufferFactory', out of the pool) for as long as it refers
+// to them.
+//
+// The data is scanned in a single pass, buffer by buffer.  When searching for
+// a delimiter, the position at which an unsuccessful search ended can be
+// retained across calls (see the 'scanPosition' argument of
+// 'extractDelimited'), so that the bytes of a long message arriving in many
+// reads are scanned only once.
+//
+///Variable-Length Headers
+///-----------------------
+// A length encoded in the 'e_VARINT' format is a sequence of 1 to 5 bytes,
+// each holding 7 bits of the length (least significant group first) in its
+// low bits, and having its high bit set if, and only if, another byte
+// follows.  This is the encoding of unsigned integers used by, e.g., Google
+// Protocol Buffers, and lengths less than 128 are encoded in a single byte.
+// A header encoding a length greater than 'INT_MAX', or that is not minimal
+// (i.e., that has a trailing zero group), is invalid.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Splitting Length-Prefixed Messages
+///- - - - - - - - - - - - - - - - - - - - - - -
+// In this example, we split a stream of messages, each prefixed with its
+// length as a 2-byte integer in network byte order, as a blob-based read
+// callback of 'btlmt::ChannelPool' would.
+//
+// First, we create the data received so far: a complete message "hello"
+// followed by the first 3 bytes of a message "world", in buffers of 4 bytes,
+// so that the first message spans two buffers:
+//..
+//  btlb::PooledBlobBufferFactory factory(4);
+//  btlb::Blob                    data(&factory);
+//
+//  btlb::BlobUtil::append(&data, "\x00\x05hello\x00\x05wor", 12);
+//  assert(3 == data.numDataBuffers());
+//..
+// Then, we extract the messages of 'data', until it does not hold a complete
+// message anymore:
+//..
+//  btlb::Blob message;
+//  int        numNeeded = 0;
+//  int        rc;
+//
+//  while (0 == (rc = btlb::BlobFramingUtil::extractLengthPrefixed(
+//                                 &message,
+//                                 &numNeeded,
+//                                 &data,
+//                                 btlb::BlobFramingUtil::e_UINT16))) {
+//..
+// Next, we verify that the message is "hello", and observe that it refers to
+// the two buffers that it spans in 'data' (without copying them):
+//..
+//      assert(5 == message.length());
+//      assert(2 == message.numDataBuffers());
+//
+//      char buffer[5];
+//      btlb::BlobUtil::copy(buffer, message, 0, 5);
+//      assert(0 == bsl::memcmp("hello", buffer, 5));
+//  }
+//..
+// Finally, we observe that 2 more bytes are needed to complete the next
+// message, which is still held by 'data':
+//..
+//  assert(1 == rc);
+//  assert(2 == numNeeded);
+//  assert(5 == data.length());
+//..
+
+#ifndef INCLUDED_BTLSCM_VERSION
+#include <btlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BTLB_BLOB
+#include <btlb_blob.h>
+#endif
+
+#ifndef INCLUDED_BSL_CLIMITS
+#include <bsl_climits.h>
+#endif
+
+namespace BloombergLP {
+namespace btlb {
+
+                           // ======================
+                           // struct BlobFramingUtil
+                           // ======================
+
+struct BlobFramingUtil {
+    // This 'struct' provides a namespace for a suite of functions that split
+    // a stream of bytes held in a 'Blob' into messages, and that frame
+    // messages to be written to such a stream.
+
+    // TYPES
+    enum HeaderFormat {
+        // Enumerate the formats of the header of a length-prefixed message.
+
+        e_UINT8,   // 1-byte unsigned integer
+        e_UINT16,  // 2-byte unsigned integer, in network byte order
+        e_UINT32,  // 4-byte unsigned integer, in network byte order
+        e_VARINT   // 1 to 5 bytes variable-length integer
+    };
+
+    enum {
+        k_MAX_HEADER_LENGTH = 5  // maximum length of a header, in any format
+    };
+
+    // CLASS METHODS
+    static int encodeHeader(char         *buffer,
+                            int           messageLength,
+                            HeaderFormat  format);
+        // Load into the specified 'buffer' the header of a message having the
+        // specified 'messageLength', in the specified 'format'.  Return the
+        // length of the header on success, and a negative value, with no
+        // effect on 'buffer', if 'messageLength' cannot be represented in
+        // 'format'.  The behavior is undefined unless '0 <= messageLength' and
+        // 'buffer' has room for 'k_MAX_HEADER_LENGTH' bytes.
+
+    static int extractDelimited(Blob       *message,
+                                int        *numNeeded,
+                                Blob       *data,
+                                const char *delimiter,
+                                int         delimiterLength,
+                                int        *scanPosition = 0,
+                                int         maxMessageLength = INT_MAX);
+        // Search the specified 'data' for the first occurrence of the
+        // specified 'delimiter' having the specified 'delimiterLength' and, if
+        // found, load into the specified 'message' the bytes of 'data'
+        // preceding it, and remove these bytes and the delimiter from 'data'.
+        // Return 0 on success, 1 if 'data' does not hold a delimiter, and a
+        // negative value if the message would be longer than the optionally
+        // specified 'maxMessageLength'.  If 1 is returned, load into the
+        // specified 'numNeeded' the minimum number of bytes that must be
+        // appended to 'data' for it to hold a delimiter.  Optionally specify
+        // a 'scanPosition' holding the position of 'data' from which to start
+        // the search: if 1 is returned, '*scanPosition' is loaded with the
+        // position from which the next search must start, and is reset to 0
+        // otherwise; the bytes of 'data' that precede '*scanPosition' are
+        // assumed not to start a delimiter.  'message' is not modified
+        // unless 0 is returned, and 'data' is not modified unless 0 is
+        // returned.  The behavior is undefined unless '0 < delimiterLength',
+        // 'delimiter' refers to 'delimiterLength' bytes, 'scanPosition' is 0
+        // or '0 <= *scanPosition <= data->length()', and
+        // '0 <= maxMessageLength'.  Note that the bytes of the message are not
+        // copied: 'message' refers to the buffers that held them in 'data'.
+
+    static int extractLengthPrefixed(Blob         *message,
+                                     int          *numNeeded,
+                                     Blob         *data,
+                                     HeaderFormat  format,
+                                     int           maxMessageLength = INT_MAX);
+        // Load into the specified 'message' the first message of the
+        // specified 'data', preceded by a header in the specified 'format'
+        // holding its length, and remove that message and its header from
+        // 'data'.  Return 0 on success, 1 if 'data' does not hold a complete
+        // message, and a negative value if the header of the first message of
+        // 'data' is invalid or holds a length greater than the optionally
+        // specified 'maxMessageLength'.  If 1 is returned, load into the
+        // specified 'numNeeded' the minimum number of bytes that must be
+        // appended to 'data' for it to hold a complete message.  'message' is
+        // not modified unless 0 is returned, and 'data' is not modified unless
+        // 0 is returned.  The behavior is undefined unless
+        // '0 <= maxMessageLength'.  Note that the bytes of the message are not
+        // copied: 'message' refers to the buffers that held them in 'data'.
+
+    static int prependHeader(Blob              *message,
+                             HeaderFormat       format,
+                             BlobBufferFactory *factory);
+        // Insert before the beginning of the specified 'message' a header
+        // holding its length in the specified 'format', using a buffer
+        // allocated by the specified 'factory'.  Return 0 on success, and a
+        // negative value, with no effect on 'message', if its length cannot
+        // be represented in 'format'.  The behavior is undefined unless the
+        // buffers allocated by 'factory' have room for 'k_MAX_HEADER_LENGTH'
+        // bytes.  Note that the header buffer is trimmed to the length of the
+        // header, so that writing 'message' to a channel does not write the
+        // unused bytes of that buffer.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
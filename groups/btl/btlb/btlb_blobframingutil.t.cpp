@@ -0,0 +1,844 @@
+// btlb_blobframingutil.t.cpp                                         -*-C++-*-
+#include <btlb_blobframingutil.h>
+
+#include <btlb_blob.h>
+#include <btlb_blobutil.h>
+#include <btlb_pooledblobbufferfactory.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdlib.h>     // atoi()
+#include <bsl_cstring.h>     // memcmp()
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                   TEST PLAN
+// ----------------------------------------------------------------------------
+//                                   Overview
+// 'btlb::BlobFramingUtil' is a utility.  The extraction functions are tested
+// by splitting streams of messages held in blobs of buffers of various sizes
+// (so that headers, messages, and delimiters span buffer boundaries), both
+// all at once and as they would be received one byte at a time, and by
+// verifying that the extracted messages refer to the buffers of the data.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int encodeHeader(char *buffer, int messageLength, HeaderFormat f);
+// [ 3] int extractLengthPrefixed(Blob *, int *, Blob *, HeaderFormat, ...);
+// [ 4] int extractDelimited(Blob *, int *, Blob *, const char *, ...);
+// [ 5] int prependHeader(Blob *, HeaderFormat, BlobBufferFactory *);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACROS
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+#define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT(I,X) { \
+   if (!(X)) { cout << #I << ": " << I << "\n"; aSsErT(1, #X, __LINE__); }}
+
+#define LOOP2_ASSERT(I,J,X) { \
+   if (!(X)) { cout << #I << ": " << I << "\t" << #J << ": " \
+              << J << "\n"; aSsErT(1, #X, __LINE__); } }
+
+#define LOOP3_ASSERT(I,J,K,X) { \
+   if (!(X)) { cout << #I << ": " << I << "\t" << #J << ": " << J << "\t" \
+              << #K << ": " << K << "\n"; aSsErT(1, #X, __LINE__); } }
+
+//=============================================================================
+//                  SEMI-STANDARD TEST OUTPUT MACROS
+//-----------------------------------------------------------------------------
+#define P(X) cout << #X " = " << (X) << endl; // Print identifier and value.
+#define Q(X) cout << "<| " #X " |>" << endl;  // Quote identifier literally.
+#define P_(X) cout << #X " = " << (X) << ", "<< flush; // P(X) without '\n'
+#define L_ __LINE__                           // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef btlb::BlobFramingUtil Util;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bsl::string toString(const btlb::Blob& blob)
+    // Return the bytes of the specified 'blob' as a string.
+{
+    bsl::string result(blob.length(), '\0');
+    if (0 < blob.length()) {
+        btlb::BlobUtil::copy(&result[0], blob, 0, blob.length());
+    }
+    return result;
+}
+
+static bool isAliased(const btlb::Blob& message, const char *first)
+    // Return 'true' if the first byte of the specified 'message' is stored at
+    // the specified 'first' address, and 'false' otherwise.
+{
+    return 0 < message.numDataBuffers() && first == message.buffer(0).data();
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator da("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove leading
+        //   comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Usage Example"
+                          << "\n=====================" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Splitting Length-Prefixed Messages
+///- - - - - - - - - - - - - - - - - - - - - - -
+// In this example, we split a stream of messages, each prefixed with its
+// length as a 2-byte integer in network byte order, as a blob-based read
+// callback of 'btlmt::ChannelPool' would.
+//
+// First, we create the data received so far: a complete message "hello"
+// followed by the first 3 bytes of a message "world", in buffers of 4 bytes,
+// so that the first message spans two buffers:
+//..
+    btlb::PooledBlobBufferFactory factory(4);
+    btlb::Blob                    data(&factory);
+
+    btlb::BlobUtil::append(&data, "\x00\x05hello\x00\x05wor", 12);
+    ASSERT(3 == data.numDataBuffers());
+//..
+// Then, we extract the messages of 'data', until it does not hold a complete
+// message anymore:
+//..
+    btlb::Blob message;
+    int        numNeeded = 0;
+    int        rc;
+
+    while (0 == (rc = btlb::BlobFramingUtil::extractLengthPrefixed(
+                                   &message,
+                                   &numNeeded,
+                                   &data,
+                                   btlb::BlobFramingUtil::e_UINT16))) {
+//..
+// Next, we verify that the message is "hello", and observe that it refers to
+// the two buffers that it spans in 'data' (without copying them):
+//..
+        ASSERT(5 == message.length());
+        ASSERT(2 == message.numDataBuffers());
+
+        char buffer[5];
+        btlb::BlobUtil::copy(buffer, message, 0, 5);
+        ASSERT(0 == bsl::memcmp("hello", buffer, 5));
+    }
+//..
+// Finally, we observe that 2 more bytes are needed to complete the next
+// message, which is still held by 'data':
+//..
+    ASSERT(1 == rc);
+    ASSERT(2 == numNeeded);
+    ASSERT(5 == data.length());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'prependHeader'
+        //
+        // Concerns:
+        //: 1 The header prepended to a message can be extracted by
+        //:   'extractLengthPrefixed', in each format.
+        //:
+        //: 2 The header buffer is trimmed to the length of the header.
+        //:
+        //: 3 A message too long for a format is rejected, and left unchanged.
+        //
+        // Plan:
+        //: 1 For each format and several message lengths, prepend a header
+        //:   to a message, verify the resulting length, and extract the
+        //:   message back.  (C-1..2)
+        //:
+        //: 2 Prepend a 'e_UINT8' header to a message of 256 bytes.  (C-3)
+        //
+        // Testing:
+        //   int prependHeader(Blob *, HeaderFormat, BlobBufferFactory *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'prependHeader'"
+                          << "\n=======================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            btlb::PooledBlobBufferFactory factory(16, &ta);
+
+            const Util::HeaderFormat FORMATS[] = {
+                Util::e_UINT8, Util::e_UINT16, Util::e_UINT32, Util::e_VARINT
+            };
+            const int HEADER_LENGTHS[][3] = {
+                // lengths 0, 200, 300
+                { 1, 1, -1 },
+                { 2, 2,  2 },
+                { 4, 4,  4 },
+                { 1, 2,  2 },
+            };
+            const int MESSAGE_LENGTHS[] = { 0, 200, 300 };
+
+            for (int fi = 0; fi < 4; ++fi) {
+                for (int li = 0; li < 3; ++li) {
+                    const Util::HeaderFormat FORMAT = FORMATS[fi];
+                    const int                LENGTH = MESSAGE_LENGTHS[li];
+                    const int                HEADER = HEADER_LENGTHS[fi][li];
+
+                    if (veryVerbose) { P_(FORMAT) P_(LENGTH) P(HEADER) }
+
+                    bsl::string payload(LENGTH, 'x', &ta);
+                    for (int i = 0; i < LENGTH; ++i) {
+                        payload[i] = static_cast<char>('a' + i % 26);
+                    }
+
+                    btlb::Blob mX(&factory, &ta);
+                    btlb::BlobUtil::append(&mX, payload.data(), LENGTH);
+
+                    const int rc = Util::prependHeader(&mX, FORMAT, &factory);
+                    if (HEADER < 0) {
+                        LOOP2_ASSERT(fi, li, 0 != rc);
+                        LOOP2_ASSERT(fi, li, LENGTH == mX.length());
+                        continue;
+                    }
+                    LOOP2_ASSERT(fi, li, 0 == rc);
+                    LOOP2_ASSERT(fi, li, HEADER + LENGTH == mX.length());
+                    LOOP2_ASSERT(fi, li, HEADER == mX.buffer(0).size());
+
+                    btlb::Blob message(&ta);
+                    int        numNeeded = -1;
+                    LOOP2_ASSERT(fi, li, 0 == Util::extractLengthPrefixed(
+                                                                   &message,
+                                                                   &numNeeded,
+                                                                   &mX,
+                                                                   FORMAT));
+                    LOOP2_ASSERT(fi, li, payload == toString(message));
+                    LOOP2_ASSERT(fi, li, 0 == mX.length());
+                }
+            }
+        }
+        LOOP_ASSERT(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'extractDelimited'
+        //
+        // Concerns:
+        //: 1 The messages of the data are extracted in order, without their
+        //:   delimiters, whatever the buffers the delimiters span.
+        //:
+        //: 2 A partial delimiter at the end of the data is not mistaken for
+        //:   a delimiter, and 'numNeeded' allows for its completion.
+        //:
+        //: 3 When a 'scanPosition' is supplied, data received a byte at a
+        //:   time is split the same way, and 'scanPosition' is updated.
+        //:
+        //: 4 Messages longer than 'maxMessageLength' are rejected, whether
+        //:   or not their delimiter has been received.
+        //:
+        //: 5 The extracted messages refer to the buffers of the data.
+        //
+        // Plan:
+        //: 1 For a set of delimiters and streams, and for buffer sizes from 1
+        //:   to 8, split the stream all at once, and as received a byte at a
+        //:   time (with a 'scanPosition'), and verify the extracted messages,
+        //:   'numNeeded', and the remaining data.  (C-1..3, 5)
+        //:
+        //: 2 Verify the rejection of messages longer than a maximum.  (C-4)
+        //
+        // Testing:
+        //   int extractDelimited(Blob *, int *, Blob *, const char *, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'extractDelimited'"
+                          << "\n==========================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_delimiter;
+            const char *d_stream;
+            const char *d_messages;   // messages separated by '|'
+            int         d_numNeeded;  // 'numNeeded' after the last message
+        } DATA[] = {
+            //LINE  DELIM   STREAM                   MESSAGES       NEEDED
+            //----  ------  -----------------------  -------------  ------
+            { L_,   "\n",   "",                      "",                 1 },
+            { L_,   "\n",   "\n",                    "|",                1 },
+            { L_,   "\n",   "a\nbc\n\nd",            "a|bc||",           1 },
+            { L_,   "\r\n", "a\r\nb\rc\r\n\r",       "a|b\rc|",          1 },
+            { L_,   "\r\n", "\r\r\n\r\r",            "\r|",              1 },
+            { L_,   "\r\n", "abc",                   "",                 1 },
+            { L_,   "END",  "xENDyEENDzENENEND",     "x|yE|zENEN|",      3 },
+            { L_,   "END",  "ENDE",                  "|",                2 },
+            { L_,   "END",  "abcEN",                 "",                 1 },
+            { L_,   "aab",  "aaabaab",               "a||",              3 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE      = DATA[ti].d_line;
+            const bsl::string  DELIMITER(DATA[ti].d_delimiter);
+            const bsl::string  STREAM(DATA[ti].d_stream);
+            const char        *MESSAGES  = DATA[ti].d_messages;
+            const int          NUM_NEEDED = DATA[ti].d_numNeeded;
+
+            bsl::vector<bsl::string> expected;
+            {
+                bsl::string messages(MESSAGES);
+                bsl::string::size_type begin = 0, end;
+                while (bsl::string::npos !=
+                                         (end = messages.find('|', begin))) {
+                    expected.push_back(messages.substr(begin, end - begin));
+                    begin = end + 1;
+                }
+            }
+
+            if (veryVerbose) { P_(LINE) P(expected.size()) }
+
+            for (int bufferSize = 1; bufferSize <= 8; ++bufferSize) {
+                bslma::TestAllocator ta("test", veryVeryVerbose);
+                {
+                    btlb::PooledBlobBufferFactory factory(bufferSize, &ta);
+
+                    // Split the stream all at once.
+
+                    btlb::Blob data(&factory, &ta);
+                    btlb::BlobUtil::append(&data,
+                                           STREAM.data(),
+                                           static_cast<int>(STREAM.size()));
+
+                    bsl::vector<bsl::string> messages;
+                    btlb::Blob               message(&ta);
+                    int                      numNeeded = -1;
+                    int                      rc;
+
+                    for (;;) {
+                        const char *first = 0 < data.length()
+                                          ? data.buffer(0).data()
+                                          : 0;
+
+                        rc = Util::extractDelimited(
+                                       &message,
+                                       &numNeeded,
+                                       &data,
+                                       DELIMITER.data(),
+                                       static_cast<int>(DELIMITER.size()));
+                        if (0 != rc) {
+                            break;
+                        }
+                        if (0 < message.length()) {
+                            LOOP2_ASSERT(LINE, bufferSize,
+                                         isAliased(message, first));
+                        }
+                        messages.push_back(toString(message));
+                    }
+
+                    LOOP2_ASSERT(LINE, bufferSize, 1 == rc);
+                    LOOP3_ASSERT(LINE, bufferSize, numNeeded,
+                                 NUM_NEEDED == numNeeded);
+                    LOOP2_ASSERT(LINE, bufferSize, expected == messages);
+
+                    // Split the stream as received a byte at a time.
+
+                    btlb::Blob received(&factory, &ta);
+                    int        scanPosition = 0;
+                    messages.clear();
+
+                    for (bsl::size_t i = 0; i < STREAM.size(); ++i) {
+                        btlb::BlobUtil::append(&received, &STREAM[i], 1);
+
+                        while (0 == (rc = Util::extractDelimited(
+                                       &message,
+                                       &numNeeded,
+                                       &received,
+                                       DELIMITER.data(),
+                                       static_cast<int>(DELIMITER.size()),
+                                       &scanPosition))) {
+                            LOOP2_ASSERT(LINE, bufferSize,
+                                         0 == scanPosition);
+                            messages.push_back(toString(message));
+                        }
+
+                        LOOP2_ASSERT(LINE, bufferSize, 1 == rc);
+                        LOOP2_ASSERT(LINE, bufferSize,
+                                     scanPosition <= received.length());
+                        LOOP2_ASSERT(LINE, bufferSize,
+                                     received.length() - scanPosition <
+                                     static_cast<int>(DELIMITER.size()));
+                    }
+                    LOOP2_ASSERT(LINE, bufferSize, expected == messages);
+                    LOOP2_ASSERT(LINE, bufferSize,
+                                 toString(data) == toString(received));
+                }
+                LOOP2_ASSERT(LINE, bufferSize, 0 == ta.numBytesInUse());
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'maxMessageLength'." << endl;
+        {
+            btlb::PooledBlobBufferFactory factory(4);
+
+            btlb::Blob data(&factory);
+            btlb::Blob message;
+            int        numNeeded = -1;
+
+            btlb::BlobUtil::append(&data, "abcd\r\nabcdef", 12);
+
+            ASSERT(0 == Util::extractDelimited(&message,
+                                               &numNeeded,
+                                               &data,
+                                               "\r\n",
+                                               2,
+                                               0,
+                                               4));
+            ASSERT("abcd" == toString(message));
+
+            // "abcdef" cannot be the beginning of a message of 4 bytes.
+
+            ASSERT(0 >  Util::extractDelimited(&message,
+                                               &numNeeded,
+                                               &data,
+                                               "\r\n",
+                                               2,
+                                               0,
+                                               4));
+            ASSERT("abcd" == toString(message));
+            ASSERT("abcdef" == toString(data));
+
+            // "abcd\r" may be the beginning of a message of 4 bytes.
+
+            btlb::BlobUtil::erase(&data, 4, 2);
+            btlb::BlobUtil::append(&data, "\r", 1);
+            ASSERT(1 == Util::extractDelimited(&message,
+                                               &numNeeded,
+                                               &data,
+                                               "\r\n",
+                                               2,
+                                               0,
+                                               4));
+            ASSERT(1 == numNeeded);
+
+            btlb::BlobUtil::append(&data, "\n", 1);
+            ASSERT(0 >  Util::extractDelimited(&message,
+                                               &numNeeded,
+                                               &data,
+                                               "\r\n",
+                                               2,
+                                               0,
+                                               3));
+            ASSERT(0 == Util::extractDelimited(&message,
+                                               &numNeeded,
+                                               &data,
+                                               "\r\n",
+                                               2,
+                                               0,
+                                               4));
+            ASSERT("abcd" == toString(message));
+            ASSERT(0 == data.length());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'extractLengthPrefixed'
+        //
+        // Concerns:
+        //: 1 The messages of the data are extracted in order, whatever the
+        //:   buffers the headers and messages span.
+        //:
+        //: 2 'numNeeded' is the number of bytes missing from the first
+        //:   message (or, when its header is incomplete, from its header).
+        //:
+        //: 3 Invalid variable-length headers, and lengths greater than
+        //:   'maxMessageLength', are rejected without modifying the data.
+        //:
+        //: 4 The extracted messages refer to the buffers of the data.
+        //
+        // Plan:
+        //: 1 For each format, and for buffer sizes from 1 to 8, encode a
+        //:   stream of messages of various lengths, and split each of its
+        //:   prefixes, verifying the extracted messages and 'numNeeded'.
+        //:   (C-1..2, 4)
+        //:
+        //: 2 Verify the rejection of a set of invalid headers.  (C-3)
+        //
+        // Testing:
+        //   int extractLengthPrefixed(Blob *, int *, Blob *, HeaderFormat...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'extractLengthPrefixed'"
+                          << "\n===============================" << endl;
+
+        const Util::HeaderFormat FORMATS[] = {
+            Util::e_UINT8, Util::e_UINT16, Util::e_UINT32, Util::e_VARINT
+        };
+        const int NUM_FORMATS = sizeof FORMATS / sizeof *FORMATS;
+
+        const int LENGTHS[] = { 0, 1, 5, 127, 128, 200, 0, 3 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int fi = 0; fi < NUM_FORMATS; ++fi) {
+            const Util::HeaderFormat FORMAT = FORMATS[fi];
+
+            // Encode the stream, recording the position at which each message
+            // ends.
+
+            bsl::string      stream;
+            bsl::vector<int> ends;
+            for (int i = 0; i < NUM_LENGTHS; ++i) {
+                char      header[Util::k_MAX_HEADER_LENGTH];
+                const int headerLength = Util::encodeHeader(header,
+                                                            LENGTHS[i],
+                                                            FORMAT);
+                ASSERT(0 < headerLength);
+
+                stream.append(header, headerLength);
+                for (int j = 0; j < LENGTHS[i]; ++j) {
+                    stream.push_back(static_cast<char>('A' + (i + j) % 26));
+                }
+                ends.push_back(static_cast<int>(stream.size()));
+            }
+
+            if (veryVerbose) { P_(FORMAT) P(stream.size()) }
+
+            for (int bufferSize = 1; bufferSize <= 8; ++bufferSize) {
+                // Note that 'ta' verifies, on destruction, that all memory
+                // has been released.
+
+                bslma::TestAllocator          ta("test", veryVeryVerbose);
+                btlb::PooledBlobBufferFactory factory(bufferSize, &ta);
+
+                for (int prefix = 0;
+                     prefix <= static_cast<int>(stream.size());
+                     prefix += bufferSize == 1 ? 1 : 7) {
+                    btlb::Blob data(&factory, &ta);
+                    btlb::BlobUtil::append(&data, stream.data(), prefix);
+
+                    btlb::Blob message(&ta);
+                    int        numNeeded = -1;
+                    int        numMessages = 0;
+                    int        position = 0;
+                    int        rc;
+
+                    for (;;) {
+                        const char *first     = 0 < data.length()
+                                              ? data.buffer(0).data()
+                                              : 0;
+                        const int   firstSize = 1 < data.numDataBuffers()
+                                              ? data.buffer(0).size()
+                                              : data.lastDataBufferLength();
+
+                        rc = Util::extractLengthPrefixed(&message,
+                                                         &numNeeded,
+                                                         &data,
+                                                         FORMAT);
+                        if (0 != rc) {
+                            break;
+                        }
+
+                        const int end = ends[numMessages];
+                        const int length = LENGTHS[numMessages];
+
+                        LOOP3_ASSERT(fi, bufferSize, prefix,
+                                     end <= prefix);
+                        LOOP3_ASSERT(fi, bufferSize, prefix,
+                                     length == message.length());
+                        LOOP3_ASSERT(fi, bufferSize, prefix,
+                                     stream.substr(end - length, length) ==
+                                                           toString(message));
+                        const int headerLength = end - length - position;
+                        if (0 < length && headerLength < firstSize) {
+                            // The message begins in the first buffer of the
+                            // data, after the header.
+
+                            LOOP3_ASSERT(fi, bufferSize, prefix,
+                                         isAliased(message,
+                                                   first + headerLength));
+                        }
+
+                        position = end;
+                        ++numMessages;
+                    }
+
+                    LOOP3_ASSERT(fi, bufferSize, prefix, 1 == rc);
+                    LOOP3_ASSERT(fi, bufferSize, prefix,
+                                 prefix - position == data.length());
+
+                    if (numMessages < NUM_LENGTHS) {
+                        // Either the header is incomplete, in which case more
+                        // header bytes are needed, or all the message is.
+
+                        const int next   = ends[numMessages];
+                        const int length = LENGTHS[numMessages];
+                        const int headerEnd = next - length;
+
+                        const int EXP = prefix < headerEnd
+                                      ? (Util::e_VARINT == FORMAT
+                                         ? 1
+                                         : headerEnd - prefix)
+                                      : next - prefix;
+                        LOOP3_ASSERT(fi, bufferSize, prefix,
+                                     EXP == numNeeded);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting invalid headers." << endl;
+        {
+            static const struct {
+                int                 d_line;
+                Util::HeaderFormat  d_format;
+                const char         *d_header;
+                int                 d_headerLength;
+                int                 d_maxMessageLength;
+                int                 d_expected;  // 0, 1, or -1 (invalid)
+            } DATA[] = {
+                //LINE  FORMAT          HEADER                  LEN  MAX  EXP
+                //----  --------------  ----------------------  ---  ---  ---
+                { L_,   Util::e_VARINT, "\x80\x00",               2,  10, -1 },
+                { L_,   Util::e_VARINT, "\x80\x80\x80\x80\x80",   5,  10, -1 },
+                { L_,   Util::e_VARINT, "\x80\x80\x80\x80\x08",   5,
+                                                                INT_MAX, -1 },
+                { L_,   Util::e_VARINT, "\xFF\xFF\xFF\xFF\x07",   5,
+                                                                INT_MAX,  1 },
+                { L_,   Util::e_VARINT, "\x80\x80\x80\x80",       4,  10,  1 },
+                { L_,   Util::e_VARINT, "\x0B",                   1,  10, -1 },
+                { L_,   Util::e_VARINT, "\x0A",                   1,  10,  1 },
+                { L_,   Util::e_UINT8,  "\x0B",                   1,  10, -1 },
+                { L_,   Util::e_UINT16, "\x01\x00",               2, 255, -1 },
+                { L_,   Util::e_UINT32, "\xFF\xFF\xFF\xFF",       4,
+                                                                INT_MAX, -1 },
+                { L_,   Util::e_UINT32, "\x7F\xFF\xFF\xFF",       4,
+                                                                INT_MAX,  1 },
+                { L_,   Util::e_UINT32, "\x00\x00\x00\x00",       4,   0,  0 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            btlb::PooledBlobBufferFactory factory(2);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int                LINE   = DATA[ti].d_line;
+                const Util::HeaderFormat FORMAT = DATA[ti].d_format;
+                const int                MAX    = DATA[ti].d_maxMessageLength;
+                const int                EXP    = DATA[ti].d_expected;
+
+                btlb::Blob data(&factory);
+                btlb::BlobUtil::append(&data,
+                                       DATA[ti].d_header,
+                                       DATA[ti].d_headerLength);
+
+                btlb::Blob message;
+                int        numNeeded = -1;
+
+                const int rc = Util::extractLengthPrefixed(&message,
+                                                           &numNeeded,
+                                                           &data,
+                                                           FORMAT,
+                                                           MAX);
+                if (0 > EXP) {
+                    LOOP2_ASSERT(LINE, rc, 0 > rc);
+                }
+                else {
+                    LOOP2_ASSERT(LINE, rc, EXP == rc);
+                }
+                if (0 != EXP) {
+                    LOOP_ASSERT(LINE, DATA[ti].d_headerLength ==
+                                                               data.length());
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'encodeHeader'
+        //
+        // Concerns:
+        //: 1 Headers are encoded as documented, in each format.
+        //:
+        //: 2 Lengths that cannot be represented in a format are rejected.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, encode a set of lengths in each
+        //:   format, and verify the encoded bytes.  (C-1..2)
+        //
+        // Testing:
+        //   int encodeHeader(char *buffer, int messageLength, HeaderFormat f);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'encodeHeader'"
+                          << "\n======================" << endl;
+
+        static const struct {
+            int                 d_line;
+            Util::HeaderFormat  d_format;
+            int                 d_length;
+            const char         *d_expected;  // expected header
+            int                 d_rc;        // expected return value
+        } DATA[] = {
+            //LINE  FORMAT          LENGTH       EXPECTED                 RC
+            //----  --------------  -----------  ----------------------  ---
+            { L_,   Util::e_UINT8,            0, "\x00",                  1 },
+            { L_,   Util::e_UINT8,          255, "\xFF",                  1 },
+            { L_,   Util::e_UINT8,          256, "",                     -1 },
+            { L_,   Util::e_UINT16,           1, "\x00\x01",              2 },
+            { L_,   Util::e_UINT16,      0xABCD, "\xAB\xCD",              2 },
+            { L_,   Util::e_UINT16,     0x10000, "",                     -1 },
+            { L_,   Util::e_UINT32,           2, "\x00\x00\x00\x02",      4 },
+            { L_,   Util::e_UINT32,     INT_MAX, "\x7F\xFF\xFF\xFF",      4 },
+            { L_,   Util::e_VARINT,           0, "\x00",                  1 },
+            { L_,   Util::e_VARINT,         127, "\x7F",                  1 },
+            { L_,   Util::e_VARINT,         128, "\x80\x01",              2 },
+            { L_,   Util::e_VARINT,         300, "\xAC\x02",              2 },
+            { L_,   Util::e_VARINT,     INT_MAX, "\xFF\xFF\xFF\xFF\x07",  5 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int                LINE   = DATA[ti].d_line;
+            const Util::HeaderFormat FORMAT = DATA[ti].d_format;
+            const int                LENGTH = DATA[ti].d_length;
+            const char              *EXP    = DATA[ti].d_expected;
+            const int                RC     = DATA[ti].d_rc;
+
+            char buffer[Util::k_MAX_HEADER_LENGTH];
+            bsl::memset(buffer, '?', sizeof buffer);
+
+            const int rc = Util::encodeHeader(buffer, LENGTH, FORMAT);
+            if (0 > RC) {
+                LOOP2_ASSERT(LINE, rc, 0 > rc);
+                LOOP_ASSERT(LINE, '?' == buffer[0]);
+                continue;
+            }
+            LOOP2_ASSERT(LINE, rc, RC == rc);
+            LOOP_ASSERT(LINE, 0 == bsl::memcmp(EXP, buffer, RC));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Frame two messages, concatenate them, and split them back.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        btlb::PooledBlobBufferFactory factory(8);
+
+        btlb::Blob first(&factory), second(&factory), data(&factory);
+        btlb::BlobUtil::append(&first, "first message", 13);
+        btlb::BlobUtil::append(&second, "second", 6);
+
+        ASSERT(0 == Util::prependHeader(&first, Util::e_VARINT, &factory));
+        ASSERT(0 == Util::prependHeader(&second, Util::e_VARINT, &factory));
+
+        btlb::BlobUtil::append(&data, first);
+        btlb::BlobUtil::append(&data, second);
+        ASSERT(21 == data.length());
+
+        btlb::Blob message;
+        int        numNeeded = 0;
+
+        ASSERT(0 == Util::extractLengthPrefixed(&message,
+                                                &numNeeded,
+                                                &data,
+                                                Util::e_VARINT));
+        ASSERT("first message" == toString(message));
+
+        ASSERT(0 == Util::extractLengthPrefixed(&message,
+                                                &numNeeded,
+                                                &data,
+                                                Util::e_VARINT));
+        ASSERT("second" == toString(message));
+
+        ASSERT(1 == Util::extractLengthPrefixed(&message,
+                                                &numNeeded,
+                                                &data,
+                                                Util::e_VARINT));
+        ASSERT(1 == numNeeded);
+        ASSERT(0 == data.length());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -23,8 +23,11 @@ BSLS_IDENT("$Id: $")
 //@SEE_ALSO: btlb_blob
 //
 //@DESCRIPTION: This 'struct' provides a variety of utilities for 'btlb::Blob'
-// objects, 'btlb::BlobUtil', such as I/O functions, comparison functions, and
-// streaming functions.
+// objects, 'btlb::BlobUtil', such as I/O functions, comparison functions,
+// search and checksum functions, and streaming functions.  The search,
+// comparison, and checksum functions operate on the data of the blob buffers
+// in place, and handle ranges spanning any number of buffers without copying
+// them.
 
 #ifndef INCLUDED_BDLSCM_VERSION
 #include <bdlscm_version.h>
@@ -232,6 +235,72 @@ struct BlobUtil {
         // lexicographically less than 'b', and a positive value if 'a' is
         // lexicographically greater than 'b'.
 
+    static int compare(const Blob& a,
+                       int         aPosition,
+                       const Blob& b,
+                       int         bPosition,
+                       int         length);
+        // Compare, lexicographically, the specified 'length' bytes starting at
+        // the specified 'aPosition' in the specified 'a' blob with the
+        // 'length' bytes starting at the specified 'bPosition' in the
+        // specified 'b' blob.  Return 0 if the two ranges hold the same bytes,
+        // a negative value if the range of 'a' is lexicographically less than
+        // the range of 'b', and a positive value otherwise.  The behavior is
+        // undefined unless '0 <= length', '0 <= aPosition',
+        // 'aPosition <= a.length() - length', '0 <= bPosition', and
+        // 'bPosition <= b.length() - length'.
+
+    static int compare(const Blob&  blob,
+                       int          position,
+                       const char  *data,
+                       int          length);
+        // Compare, lexicographically, the specified 'length' bytes starting at
+        // the specified 'position' in the specified 'blob' with the 'length'
+        // bytes at the specified 'data' address.  Return 0 if they are the
+        // same, a negative value if the range of 'blob' is lexicographically
+        // less than 'data', and a positive value otherwise.  The behavior is
+        // undefined unless '0 <= length', '0 <= position',
+        // 'position <= blob.length() - length', and 'data' refers to 'length'
+        // bytes.
+
+    static int findByte(const Blob& blob, char byte, int position = 0);
+        // Return the position of the first occurrence of the specified 'byte'
+        // in the specified 'blob' at or after the optionally specified
+        // 'position', or -1 if 'byte' does not occur there.  The behavior is
+        // undefined unless '0 <= position <= blob.length()'.  Note that each
+        // buffer of 'blob' is scanned with 'memchr', which is vectorized on
+        // most platforms.
+
+    static int findSequence(const Blob&  blob,
+                            const char  *sequence,
+                            int          sequenceLength,
+                            int          position = 0);
+        // Return the position of the first occurrence of the specified
+        // 'sequence' having the specified 'sequenceLength' in the specified
+        // 'blob' at or after the optionally specified 'position', or -1 if
+        // 'sequence' does not occur there.  An occurrence of 'sequence' may
+        // span any number of buffers of 'blob'.  The behavior is undefined
+        // unless '0 < sequenceLength', 'sequence' refers to 'sequenceLength'
+        // bytes, and '0 <= position <= blob.length()'.
+
+    static unsigned int crc32c(const Blob&  blob,
+                               int          position,
+                               int          length,
+                               unsigned int crc = 0);
+        // Return the CRC-32C (Castagnoli) checksum of the specified 'length'
+        // bytes starting at the specified 'position' in the specified 'blob',
+        // continuing the optionally specified 'crc' of the bytes that precede
+        // them (e.g., the result of a previous call for the preceding range).
+        // The behavior is undefined unless '0 <= length', '0 <= position',
+        // and 'position <= blob.length() - length'.  Note that the checksum
+        // of the 9 bytes "123456789" is '0xE3069283', and that the 'crc32'
+        // instruction of SSE 4.2 is used if it is supported by the processor
+        // on which this function runs.
+
+    static unsigned int crc32c(const Blob& blob);
+        // Return the CRC-32C (Castagnoli) checksum of the data of the
+        // specified 'blob'.
+
     // ---------- DEPRECATED FUNCTIONS ------------- //
 
     // DEPRECATED FUNCTIONS: basicAllocator is no longer used
@@ -394,6 +463,12 @@ bsl::ostream& BlobUtil::hexDump(bsl::ostream& stream, const Blob& source)
     return hexDump(stream, source, 0, source.length());
 }
 
+inline
+unsigned int BlobUtil::crc32c(const Blob& blob)
+{
+    return crc32c(blob, 0, blob.length());
+}
+
 template <class STREAM>
 STREAM& BlobUtil::read(STREAM& stream, Blob *dest, int numBytes)
 {
@@ -37,6 +37,7 @@ using namespace bsl;  // automatically added by script
 //                                  TEST PLAN
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
+// [10] Testing findByte, findSequence, range compare, and crc32c
 // [ 9] Testing getContiguousRangeOrCopy
 // [ 8] Testing getContiguousDataBuffer
 // [ 7] Testing copy
@@ -315,6 +316,27 @@ static bool bad_jk(int j, int k, btlb::Blob& blob)
     return (j < 0 || k < 0 || j + k > blob.totalSize());
 }
 
+static unsigned int crc32cOracle(const char *data, int length)
+    // Return the CRC-32C of the specified 'length' bytes at the specified
+    // 'data' address, computed one bit at a time.
+{
+    unsigned int crc = 0xFFFFFFFF;
+    for (int i = 0; i < length; ++i) {
+        crc ^= static_cast<unsigned char>(data[i]);
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (0x82F63B78 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+static int sign(int value)
+    // Return -1, 0, or 1 if the specified 'value' is negative, zero, or
+    // positive, respectively.
+{
+    return (0 < value) - (value < 0);
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -332,6 +354,176 @@ int main(int argc, char *argv[]) {
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING 'findByte', 'findSequence', RANGE 'compare', AND 'crc32c'
+        //
+        // Concerns:
+        //: 1 'findByte' and 'findSequence' find the first occurrence at or
+        //:   after the specified position, including occurrences spanning
+        //:   several buffers, and return -1 if there is none.
+        //:
+        //: 2 A partial match of the sequence at the end of a buffer or of the
+        //:   blob does not hide a later occurrence.
+        //:
+        //: 3 The range 'compare' functions compare the specified ranges only,
+        //:   whatever the buffers of the two operands.
+        //:
+        //: 4 'crc32c' computes the standard CRC-32C of any range, whatever its
+        //:   alignment and the buffers holding it, and can be continued over
+        //:   consecutive ranges.
+        //
+        // Plan:
+        //: 1 For blobs holding the same data in buffers of each size from 1
+        //:   to 9, verify the results of each function for every position
+        //:   (and every length) against the results of the same operation on
+        //:   a 'bsl::string'.  (C-1..4)
+        //:
+        //: 2 Verify the CRC-32C of the standard check value "123456789".
+        //:   (C-4)
+        //
+        // Testing:
+        //   int compare(const Blob&, int, const Blob&, int, int);
+        //   int compare(const Blob&, int, const char *, int);
+        //   int findByte(const Blob& blob, char byte, int position);
+        //   int findSequence(const Blob&, const char *, int, int);
+        //   unsigned int crc32c(const Blob&, int, int, unsigned int);
+        //   unsigned int crc32c(const Blob& blob);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'findByte', 'findSequence', RANGE "
+                             "'compare', AND 'crc32c'"
+                          << "\n=============================================="
+                             "==========\n";
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        const bsl::string DATA("abaabaaab\r\nabcab\r\rx\r\nzyxabaaabaaz",
+                               &ta);
+        const int         LENGTH = static_cast<int>(DATA.length());
+
+        if (verbose) cout << "\tCheck value." << endl;
+        {
+            BlobBufferFactory factory(4, &ta);
+            btlb::Blob        blob(&factory, &ta);
+
+            copyStringToBlob(&blob, "123456789");
+
+            ASSERTV(Util::crc32c(blob), 0xE3069283 == Util::crc32c(blob));
+            ASSERTV(0xE3069283 == Util::crc32c(blob,
+                                               5,
+                                               4,
+                                               Util::crc32c(blob, 0, 5)));
+            ASSERT(0 == Util::crc32c(blob, 3, 0));
+        }
+
+        if (verbose) cout << "\tSearching." << endl;
+
+        static const char *const SEQUENCES[] = {
+            "a", "z", "q", "\r\n", "aab", "abaaab", "aaz", "zz", "xabaaabaaz",
+            "abaabaaab\r\nabcab\r\rx\r\nzyxabaaabaaz"
+        };
+        enum { k_NUM_SEQUENCES = sizeof SEQUENCES / sizeof *SEQUENCES };
+
+        for (int bufferSize = 1; bufferSize <= 9; ++bufferSize) {
+            BlobBufferFactory factory(bufferSize, &ta);
+            btlb::Blob        blob(&factory, &ta);
+
+            copyStringToBlob(&blob, DATA);
+
+            for (int position = 0; position <= LENGTH; ++position) {
+                for (char c = 'a'; c <= 'z'; ++c) {
+                    const bsl::size_t EXP = DATA.find(c, position);
+                    const int         RESULT = Util::findByte(blob,
+                                                              c,
+                                                              position);
+
+                    ASSERTV(bufferSize, position, c, EXP, RESULT,
+                            bsl::string::npos == EXP ? -1 == RESULT
+                                                     : int(EXP) == RESULT);
+                }
+
+                for (int i = 0; i < k_NUM_SEQUENCES; ++i) {
+                    const char *SEQ    = SEQUENCES[i];
+                    const int   SEQLEN = static_cast<int>(bsl::strlen(SEQ));
+
+                    const bsl::size_t EXP = DATA.find(SEQ, position);
+                    const int         RESULT = Util::findSequence(blob,
+                                                                  SEQ,
+                                                                  SEQLEN,
+                                                                  position);
+
+                    ASSERTV(bufferSize, position, i, EXP, RESULT,
+                            bsl::string::npos == EXP ? -1 == RESULT
+                                                     : int(EXP) == RESULT);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tComparing and checksumming ranges." << endl;
+
+        for (int aSize = 1; aSize <= 9; ++aSize) {
+            BlobBufferFactory aFactory(aSize, &ta);
+            btlb::Blob        a(&aFactory, &ta);
+
+            copyStringToBlob(&a, DATA);
+
+            ASSERTV(aSize, crc32cOracle(DATA.data(), LENGTH)
+                                                         == Util::crc32c(a));
+
+            for (int bSize = 1; bSize <= 9; bSize += 4) {
+                BlobBufferFactory bFactory(bSize, &ta);
+                btlb::Blob        b(&bFactory, &ta);
+
+                copyStringToBlob(&b, DATA);
+
+                for (int aPos = 0; aPos <= LENGTH; ++aPos) {
+                for (int bPos = 0; bPos <= LENGTH; bPos += 3) {
+                    const int MAXLEN = LENGTH - bsl::max(aPos, bPos);
+
+                    for (int len = 0; len <= MAXLEN; ++len) {
+                        const int EXP = sign(bsl::memcmp(DATA.data() + aPos,
+                                                         DATA.data() + bPos,
+                                                         len));
+
+                        ASSERTV(aSize, bSize, aPos, bPos, len,
+                                EXP == sign(Util::compare(a,
+                                                          aPos,
+                                                          b,
+                                                          bPos,
+                                                          len)));
+                        ASSERTV(aSize, aPos, bPos, len,
+                                EXP == sign(Util::compare(a,
+                                                          aPos,
+                                                          DATA.data() + bPos,
+                                                          len)));
+                    }
+                }
+                }
+            }
+
+            for (int pos = 0; pos <= LENGTH; ++pos) {
+                for (int len = 0; len <= LENGTH - pos; ++len) {
+                    const unsigned int EXP = crc32cOracle(DATA.data() + pos,
+                                                          len);
+
+                    ASSERTV(aSize, pos, len,
+                            EXP == Util::crc32c(a, pos, len));
+
+                    // Continue the checksum of the first half of the range
+                    // with its second half.
+
+                    const int HALF = len / 2;
+
+                    ASSERTV(aSize, pos, len,
+                            EXP == Util::crc32c(a,
+                                                pos + HALF,
+                                                len - HALF,
+                                                Util::crc32c(a, pos, HALF)));
+                }
+            }
+        }
+      } break;
         case 9: {
         // -------------------------------------------------------------------
         // TESTING 'getContiguousRangeOrCopy' FUNCTION
@@ -12,9 +12,309 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(btlb_pooledblobbufferfactory_cpp,"$Id$ $CSID$")
 
+#include <bslmt_lockguard.h>
+
+#include <bslma_default.h>
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_performancehint.h>
+
 namespace BloombergLP {
 namespace btlb {
 
+                // ==========================================
+                // struct PooledBlobBufferFactory_ThreadCache
+                // ==========================================
+
+struct PooledBlobBufferFactory_ThreadCache {
+    // This component-private 'struct' holds the free blocks cached by a
+    // thread allocating from a 'PooledBlobBufferFactory_CachingAllocator'.
+
+    // TYPES
+    union Header {
+        // Header preceding the memory of each block, holding the cache of the
+        // thread that allocated it while the block is in use, and the next
+        // free block while it is in a list of free blocks.
+
+        PooledBlobBufferFactory_ThreadCache *d_origin_p;
+        Header                              *d_next_p;
+        bsls::AlignmentUtil::MaxAlignedType  d_align;  // force alignment
+    };
+
+    // DATA
+    Header                         *d_free_p;       // blocks cached by the
+                                                    // thread, accessed by
+                                                    // that thread only
+
+    int                             d_numFree;      // number of blocks in
+                                                    // 'd_free_p'
+
+    bsls::AtomicPointer<Header>     d_returned;     // blocks allocated by the
+                                                    // thread and released by
+                                                    // other threads
+
+    bsls::AtomicInt                 d_numReturned;  // number of blocks in, or
+                                                    // being pushed to,
+                                                    // 'd_returned'
+
+    bsls::AtomicInt                 d_exitedFlag;   // 1 if the thread has
+                                                    // exited and no other
+                                                    // thread uses this cache,
+                                                    // and 0 otherwise
+
+    bdlma::ConcurrentPoolAllocator *d_pool_p;       // pool of the allocator
+                                                    // (held)
+
+    PooledBlobBufferFactory_ThreadCache
+                                   *d_next_p;       // next cache of the
+                                                    // allocator
+
+    // CREATORS
+    explicit
+    PooledBlobBufferFactory_ThreadCache(bdlma::ConcurrentPoolAllocator *pool)
+    : d_free_p(0)
+    , d_numFree(0)
+    , d_returned(0)
+    , d_numReturned(0)
+    , d_exitedFlag(0)
+    , d_pool_p(pool)
+    , d_next_p(0)
+    {
+    }
+
+    // MANIPULATORS
+    void releaseFree();
+        // Return all the blocks of 'd_free_p' to the pool.  The behavior is
+        // undefined unless this method is called by the thread of this cache.
+
+    void releaseReturned();
+        // Return all the blocks of 'd_returned' to the pool.
+};
+
+// MANIPULATORS
+void PooledBlobBufferFactory_ThreadCache::releaseFree()
+{
+    while (d_free_p) {
+        Header *next = d_free_p->d_next_p;
+        d_pool_p->deallocate(d_free_p);
+        d_free_p = next;
+    }
+    d_numFree = 0;
+}
+
+void PooledBlobBufferFactory_ThreadCache::releaseReturned()
+{
+    Header *block       = d_returned.swap(0);
+    int     numReleased = 0;
+
+    while (block) {
+        Header *next = block->d_next_p;
+        d_pool_p->deallocate(block);
+        block = next;
+        ++numReleased;
+    }
+    d_numReturned.add(-numReleased);
+}
+
+             // ----------------------------------------------
+             // class PooledBlobBufferFactory_CachingAllocator
+             // ----------------------------------------------
+
+// PRIVATE CLASS METHODS
+void PooledBlobBufferFactory_CachingAllocator::releaseThreadCache(void *cache)
+{
+    ThreadCache *threadCache = static_cast<ThreadCache *>(cache);
+
+    threadCache->releaseFree();
+
+    // The blocks still in use keep referring to this cache: once it is
+    // flagged, the threads releasing them return them to the pool, and
+    // return any block they pushed to 'd_returned' concurrently with this
+    // call (see 'deallocate').
+
+    threadCache->d_exitedFlag = 1;
+    threadCache->releaseReturned();
+}
+
+// PRIVATE MANIPULATORS
+PooledBlobBufferFactory_ThreadCache *
+PooledBlobBufferFactory_CachingAllocator::threadCache()
+{
+    ThreadCache *cache = static_cast<ThreadCache *>(
+                                       bslmt::ThreadUtil::getSpecific(d_key));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(cache)) {
+        return cache;                                                 // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesLock);
+
+        // Reuse the cache of a thread that has exited, if any.
+
+        cache = d_caches_p;
+        while (cache && !cache->d_exitedFlag.load()) {
+            cache = cache->d_next_p;
+        }
+
+        if (cache) {
+            cache->d_exitedFlag = 0;
+        }
+        else {
+            cache = new (*d_allocator_p) ThreadCache(d_pool_p);
+
+            cache->d_next_p = d_caches_p;
+            d_caches_p      = cache;
+        }
+    }
+
+    const int rc = bslmt::ThreadUtil::setSpecific(d_key, cache);
+    BSLS_ASSERT_OPT(0 == rc);
+
+    return cache;
+}
+
+// CREATORS
+PooledBlobBufferFactory_CachingAllocator::
+PooledBlobBufferFactory_CachingAllocator(
+                                   bdlma::ConcurrentPoolAllocator *pool,
+                                   int                             maxCached,
+                                   bslma::Allocator               *allocator)
+: d_pool_p(pool)
+, d_maxCachedBlocks(maxCached)
+, d_caches_p(0)
+, d_allocator_p(allocator)
+{
+    BSLS_ASSERT(pool);
+    BSLS_ASSERT(0 < maxCached);
+    BSLS_ASSERT(allocator);
+
+    const int rc = bslmt::ThreadUtil::createKey(
+                                &d_key,
+                                (bslmt::ThreadUtil::Destructor)
+                                PooledBlobBufferFactory_CachingAllocator::
+                                                           releaseThreadCache);
+    BSLS_ASSERT_OPT(0 == rc);
+}
+
+PooledBlobBufferFactory_CachingAllocator::
+~PooledBlobBufferFactory_CachingAllocator()
+{
+    bslmt::ThreadUtil::deleteKey(d_key);
+
+    while (d_caches_p) {
+        ThreadCache *cache = d_caches_p;
+        d_caches_p = cache->d_next_p;
+        d_allocator_p->deleteObjectRaw(cache);
+    }
+}
+
+// MANIPULATORS
+void *PooledBlobBufferFactory_CachingAllocator::allocate(size_type size)
+{
+    typedef ThreadCache::Header Header;
+
+    ThreadCache *cache = threadCache();
+    Header      *block = cache->d_free_p;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!block)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Take back the blocks released by other threads (at most
+        // 'd_maxCachedBlocks' of them), or allocate a block from the pool if
+        // there are none.
+
+        block = cache->d_returned.swap(0);
+
+        if (!block) {
+            block = static_cast<Header *>(
+                                   d_pool_p->allocate(sizeof(Header) + size));
+            block->d_origin_p = cache;
+            return block + 1;                                         // RETURN
+        }
+
+        int numFree = 1;
+        for (Header *last = block; last->d_next_p; last = last->d_next_p) {
+            ++numFree;
+        }
+
+        cache->d_numReturned.add(-numFree);
+        cache->d_numFree = numFree;
+    }
+
+    cache->d_free_p = block->d_next_p;
+    --cache->d_numFree;
+
+    block->d_origin_p = cache;
+    return block + 1;
+}
+
+void PooledBlobBufferFactory_CachingAllocator::deallocate(void *address)
+{
+    typedef ThreadCache::Header Header;
+
+    if (!address) {
+        return;                                                       // RETURN
+    }
+
+    Header      *block  = static_cast<Header *>(address) - 1;
+    ThreadCache *origin = block->d_origin_p;
+
+    if (origin == bslmt::ThreadUtil::getSpecific(d_key)) {
+        if (origin->d_numFree < d_maxCachedBlocks) {
+            block->d_next_p = origin->d_free_p;
+            origin->d_free_p = block;
+            ++origin->d_numFree;
+        }
+        else {
+            d_pool_p->deallocate(block);
+        }
+        return;                                                       // RETURN
+    }
+
+    // Return the block to the cache of the thread that allocated it, unless
+    // that thread has exited or the blocks already returned to it would fill
+    // its cache, in which case the block goes back to the pool.
+
+    if (origin->d_exitedFlag.load()) {
+        d_pool_p->deallocate(block);
+        return;                                                       // RETURN
+    }
+
+    if (d_maxCachedBlocks < origin->d_numReturned.add(1)) {
+        origin->d_numReturned.add(-1);
+        d_pool_p->deallocate(block);
+        return;                                                       // RETURN
+    }
+
+    // Note that, since the blocks are only removed from 'd_returned' all at
+    // once, there is no ABA problem.
+
+    Header *head = origin->d_returned.loadRelaxed();
+    for (;;) {
+        block->d_next_p = head;
+
+        Header *previous = origin->d_returned.testAndSwap(head, block);
+        if (previous == head) {
+            break;
+        }
+        head = previous;
+    }
+
+    // If the origin thread exited while the block was being pushed, it may
+    // not have found the block in 'd_returned': return that list to the pool.
+    // Note that the sequentially consistent operations on 'd_returned' and
+    // 'd_exitedFlag' ensure that either this thread or 'releaseThreadCache'
+    // finds the block.
+
+    if (origin->d_exitedFlag.load()) {
+        origin->releaseReturned();
+    }
+}
+
                       // -----------------------------
                       // class PooledBlobBufferFactory
                       // -----------------------------
@@ -24,19 +324,50 @@ PooledBlobBufferFactory::PooledBlobBufferFactory(
         int               bufferSize,
         bslma::Allocator *basicAllocator)
 : d_bufferSize(bufferSize)
+, d_maxCachedBuffersPerThread(0)
 , d_spPool(basicAllocator)
+, d_blockAllocator_p(&d_spPool)
+, d_cachingAllocator_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
 
+PooledBlobBufferFactory::PooledBlobBufferFactory(
+        int               bufferSize,
+        int               maxCachedBuffersPerThread,
+        bslma::Allocator *basicAllocator)
+: d_bufferSize(bufferSize)
+, d_maxCachedBuffersPerThread(maxCachedBuffersPerThread)
+, d_spPool(basicAllocator)
+, d_blockAllocator_p(&d_spPool)
+, d_cachingAllocator_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 <= maxCachedBuffersPerThread);
+
+    if (0 < maxCachedBuffersPerThread) {
+        d_cachingAllocator_p = new (*d_allocator_p)
+                         PooledBlobBufferFactory_CachingAllocator(
+                                                    &d_spPool,
+                                                    maxCachedBuffersPerThread,
+                                                    d_allocator_p);
+        d_blockAllocator_p = d_cachingAllocator_p;
+    }
+}
+
 PooledBlobBufferFactory::~PooledBlobBufferFactory()
 {
+    if (d_cachingAllocator_p) {
+        d_allocator_p->deleteObjectRaw(d_cachingAllocator_p);
+    }
 }
 
 // MANIPULATORS
 void PooledBlobBufferFactory::allocate(BlobBuffer *buffer)
 {
     buffer->reset(bslstl::SharedPtrUtil::createInplaceUninitializedBuffer(
-                                               d_bufferSize, &d_spPool),
+                                               d_bufferSize,
+                                               d_blockAllocator_p),
                   d_bufferSize);
 }
 }  // close package namespace
@@ -31,6 +31,38 @@ BSLS_IDENT("$Id: $")
 // general-purpose memory allocator.  In order to gain further efficiency, this
 // factory allocates the shared pointer representation together with the buffer
 // (contiguously).
+//
+///Per-Thread Caching
+///------------------
+// The buffers are allocated from a thread-safe pool shared by all threads,
+// whose free list is updated with an atomic compare-and-swap on every
+// allocation and deallocation.  When many threads allocate buffers at a high
+// rate (e.g., the dispatcher threads of a 'btlmt::ChannelPool'), these
+// updates contend.  A factory can therefore be configured, at construction,
+// to keep in each thread that allocates buffers a cache of up to a specified
+// number of free buffers, from which the buffers allocated by that thread are
+// taken without any synchronization.  A buffer is returned to the cache of
+// the thread that allocated it, which is its *origin*, whichever thread
+// releases its last reference:
+//
+//: o A buffer released by its origin thread is pushed to its cache, unless
+//:   the cache is full, in which case it is returned to the shared pool.
+//:
+//: o A buffer released by any other thread is pushed, with a single atomic
+//:   operation, to a list of the cache of its origin thread, unless that list
+//:   already holds as many buffers as the cache can, in which case it is
+//:   returned to the shared pool.  The origin thread takes all the buffers of
+//:   that list, with a single atomic operation, when its cache is empty.
+//
+// Thus, a thread allocating buffers that are released by other threads (e.g.,
+// a thread reading messages that are processed and released by worker
+// threads) keeps recycling the same buffers.  Each thread cache is created
+// the first time its thread allocates a buffer from the factory.  When that
+// thread exits, the buffers held by its cache are returned to the shared
+// pool, as are the buffers it allocated and that are released afterwards,
+// and the cache is reused by the next thread that allocates a buffer from
+// the factory.  Note that each buffer allocated by a caching factory uses a
+// few more bytes of memory (to hold its origin).
 
 #ifndef INCLUDED_BDLSCM_VERSION
 #include <bdlscm_version.h>
@@ -44,9 +76,107 @@ BSLS_IDENT("$Id: $")
 #include <bdlma_concurrentpoolallocator.h>
 #endif
 
+#ifndef INCLUDED_BSLMT_MUTEX
+#include <bslmt_mutex.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADUTIL
+#include <bslmt_threadutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
 namespace BloombergLP {
 namespace btlb {
 
+struct PooledBlobBufferFactory_ThreadCache;
+
+             // ==============================================
+             // class PooledBlobBufferFactory_CachingAllocator
+             // ==============================================
+
+class PooledBlobBufferFactory_CachingAllocator : public bslma::Allocator {
+    // This component-private class implements the 'bslma::Allocator' protocol
+    // to provide a thread-safe allocator of blocks of uniform size, taken from
+    // a cache of free blocks local to the calling thread and, if that cache is
+    // empty, from an underlying 'bdlma::ConcurrentPoolAllocator'.  Each block
+    // is returned to the cache of the thread that allocated it.  See
+    // {Per-Thread Caching}.
+
+    // PRIVATE TYPES
+    typedef PooledBlobBufferFactory_ThreadCache ThreadCache;
+
+    // DATA
+    bdlma::ConcurrentPoolAllocator *d_pool_p;           // pool supplying the
+                                                        // blocks (held)
+
+    int                             d_maxCachedBlocks;  // capacity of each
+                                                        // thread cache
+
+    bslmt::ThreadUtil::Key          d_key;              // key of the cache of
+                                                        // the calling thread
+
+    ThreadCache                    *d_caches_p;         // list of all the
+                                                        // thread caches
+
+    bslmt::Mutex                    d_cachesLock;       // protects
+                                                        // 'd_caches_p'
+
+    bslma::Allocator               *d_allocator_p;      // allocator of the
+                                                        // thread caches (held)
+
+  private:
+    // NOT IMPLEMENTED
+    PooledBlobBufferFactory_CachingAllocator(
+                             const PooledBlobBufferFactory_CachingAllocator&);
+    PooledBlobBufferFactory_CachingAllocator& operator=(
+                             const PooledBlobBufferFactory_CachingAllocator&);
+
+    // PRIVATE CLASS METHODS
+    static void releaseThreadCache(void *cache);
+        // Return the free blocks held by the specified thread 'cache' to the
+        // pool, and flag 'cache' so that the blocks it allocated and that are
+        // still in use are returned to the pool, and that 'cache' is reused by
+        // the next thread needing a cache.  Note that this function is
+        // invoked when the thread of 'cache' exits.
+
+    // PRIVATE MANIPULATORS
+    ThreadCache *threadCache();
+        // Return the cache of the calling thread, reusing the cache of an
+        // exited thread or creating one if needed.
+
+  public:
+    // CREATORS
+    PooledBlobBufferFactory_CachingAllocator(
+                                   bdlma::ConcurrentPoolAllocator *pool,
+                                   int                             maxCached,
+                                   bslma::Allocator               *allocator);
+        // Create an allocator of blocks taken from the specified 'pool', and
+        // keeping up to the specified 'maxCached' free blocks in the cache of
+        // each thread, which is allocated with the specified 'allocator'.
+        // The behavior is undefined unless '0 < maxCached'.
+
+    virtual ~PooledBlobBufferFactory_CachingAllocator();
+        // Destroy this allocator and the thread caches.  Note that the blocks
+        // held by the caches of the threads still running are not returned to
+        // the pool.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return a newly allocated block of memory of (at least) the specified
+        // positive 'size' (in bytes).  The behavior is undefined unless 'size'
+        // is the same for all the calls to 'allocate' on this object.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to the
+        // cache of the thread that allocated it, or to the pool.  If 'address'
+        // is 0, this function has no effect.  The behavior is undefined unless
+        // 'address' was allocated using this allocator object and has not
+        // already been deallocated.
+};
+
                       // =============================
                       // class PooledBlobBufferFactory
                       // =============================
@@ -59,9 +189,30 @@ class PooledBlobBufferFactory: public BlobBufferFactory {
     // DATA
     int                 d_bufferSize;         // size of allocated blob buffers
 
+    int                 d_maxCachedBuffersPerThread;
+                                              // capacity of each thread cache
+
     bdlma::ConcurrentPoolAllocator d_spPool;  // pool used to allocate shared
                                               // pointers and buffers
                                               // contiguously
+
+    bslma::Allocator   *d_blockAllocator_p;   // allocator of the shared
+                                              // pointers and buffers (either
+                                              // 'd_spPool' or
+                                              // 'd_cachingAllocator_p')
+
+    PooledBlobBufferFactory_CachingAllocator
+                       *d_cachingAllocator_p; // per-thread caches in front of
+                                              // 'd_spPool', or 0 if caching is
+                                              // disabled (owned)
+
+    bslma::Allocator   *d_allocator_p;        // memory allocator (held)
+
+  private:
+    // NOT IMPLEMENTED
+    PooledBlobBufferFactory(const PooledBlobBufferFactory&);
+    PooledBlobBufferFactory& operator=(const PooledBlobBufferFactory&);
+
   public:
     // CREATORS
     PooledBlobBufferFactory(int               bufferSize,
@@ -71,8 +222,22 @@ class PooledBlobBufferFactory: public BlobBufferFactory {
         // to supply memory.  If 'basicAllocator' is 0, the currently installed
         // default allocator is used.
 
+    PooledBlobBufferFactory(int               bufferSize,
+                            int               maxCachedBuffersPerThread,
+                            bslma::Allocator *basicAllocator=0);
+        // Create a pooled factory for allocating 'BlobBuffer' objects of the
+        // specified 'bufferSize', keeping up to the specified
+        // 'maxCachedBuffersPerThread' free buffers in a cache local to each
+        // thread allocating buffers (see {Per-Thread Caching}).  If
+        // 'maxCachedBuffersPerThread' is 0, no buffer is cached.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless
+        // '0 <= maxCachedBuffersPerThread'.
+
     ~PooledBlobBufferFactory();
-        // Destroy this factory.
+        // Destroy this factory.  The behavior is undefined unless all the
+        // buffers allocated by this factory have been released.
 
     // MANIPULATORS
     void allocate(BlobBuffer *buffer);
@@ -82,6 +247,10 @@ class PooledBlobBufferFactory: public BlobBufferFactory {
     // ACCESSORS
     int bufferSize() const;
         // Return the buffer size specified at construction of this factory.
+
+    int maxCachedBuffersPerThread() const;
+        // Return the maximum number of free buffers cached by each thread, as
+        // specified at construction of this factory.
 };
 
 // ============================================================================
@@ -99,6 +268,12 @@ int PooledBlobBufferFactory::bufferSize() const
     return d_bufferSize;
 }
 
+inline
+int PooledBlobBufferFactory::maxCachedBuffersPerThread() const
+{
+    return d_maxCachedBuffersPerThread;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
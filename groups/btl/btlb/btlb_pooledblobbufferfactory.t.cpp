@@ -11,14 +11,20 @@
 
 #include <bslim_testutil.h>
 
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
 #include <bslma_testallocator.h>                // for testing only
 #include <bslma_testallocatorexception.h>       // for testing only
 #include <bslma_defaultallocatorguard.h>        // for testing only
+#include <bsls_types.h>
 
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>     // 'atoi'
 #include <bsl_iostream.h>
 #include <bsl_cstring.h>     // 'memcpy', 'memset'
+#include <bsl_set.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;  // automatically added by script
@@ -26,7 +32,18 @@ using namespace bsl;  // automatically added by script
 //=============================================================================
 //                                  TEST PLAN
 //-----------------------------------------------------------------------------
+// CREATORS
+// [ 1] PooledBlobBufferFactory(int bufferSize, Allocator *ba = 0);
+// [ 2] PooledBlobBufferFactory(int, int maxCached, Allocator *ba = 0);
+//
+// MANIPULATORS
+// [ 1] void allocate(BlobBuffer *buffer);
+//
+// ACCESSORS
+// [ 2] int maxCachedBuffersPerThread() const;
 //-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] PER-THREAD CACHING
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -103,6 +120,96 @@ void checkBlob(int         LINE,
     }
 }
 
+namespace TEST_CASE_CACHING {
+
+typedef bsl::vector<btlb::BlobBuffer> Buffers;
+
+struct ReleaseBuffers {
+    // Functor releasing a vector of buffers in the thread invoking it, and
+    // then allocating the same number of buffers in that thread.
+
+    Buffers *d_released_p;   // buffers to release
+    Buffers *d_allocated_p;  // buffers allocated
+    Obj     *d_factory_p;
+
+    void operator()() const
+    {
+        const bsl::size_t numBuffers = d_released_p->size();
+
+        d_released_p->clear();
+
+        d_allocated_p->resize(numBuffers);
+        for (bsl::size_t i = 0; i < numBuffers; ++i) {
+            d_factory_p->allocate(&(*d_allocated_p)[i]);
+        }
+    }
+};
+
+struct ExchangeBuffers {
+    // Functor allocating, in each round, buffers filled with the index of the
+    // thread invoking it, and then verifying and releasing the buffers
+    // allocated by the next thread.
+
+    int             d_index;       // index of this thread
+    int             d_numThreads;
+    int             d_numRounds;
+    int             d_numBuffers;  // buffers allocated by round
+    Buffers        *d_slots_p;     // buffers allocated by each thread
+    bslmt::Barrier *d_barrier_p;
+    Obj            *d_factory_p;
+
+    void operator()() const
+    {
+        const int BUFFER_SIZE = d_factory_p->bufferSize();
+
+        Buffers& mine = d_slots_p[d_index];
+        Buffers& next = d_slots_p[(d_index + 1) % d_numThreads];
+
+        for (int round = 0; round < d_numRounds; ++round) {
+            mine.resize(d_numBuffers);
+            for (int i = 0; i < d_numBuffers; ++i) {
+                d_factory_p->allocate(&mine[i]);
+                bsl::memset(mine[i].data(), d_index, BUFFER_SIZE);
+            }
+
+            d_barrier_p->wait();
+
+            const char EXPECTED = static_cast<char>((d_index + 1)
+                                                    % d_numThreads);
+            for (bsl::size_t i = 0; i < next.size(); ++i) {
+                for (int j = 0; j < BUFFER_SIZE; ++j) {
+                    ASSERTV(d_index, round, i, j,
+                            EXPECTED == next[i].data()[j]);
+                }
+            }
+            next.clear();
+
+            d_barrier_p->wait();
+        }
+    }
+};
+
+struct AllocateAndRelease {
+    // Functor allocating and then releasing a number of buffers in the thread
+    // invoking it, optionally keeping some of them allocated.
+
+    int      d_numBuffers;  // buffers allocated
+    int      d_numKept;     // buffers kept allocated, in 'd_kept_p'
+    Buffers *d_kept_p;
+    Obj     *d_factory_p;
+
+    void operator()() const
+    {
+        Buffers buffers(d_numBuffers);
+        for (int i = 0; i < d_numBuffers; ++i) {
+            d_factory_p->allocate(&buffers[i]);
+        }
+        d_kept_p->assign(buffers.begin(), buffers.begin() + d_numKept);
+    }
+};
+
+}  // close namespace TEST_CASE_CACHING
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -117,6 +224,237 @@ int main(int argc, char *argv[]) {
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
+      case 2: {
+        // --------------------------------------------------------------------
+        // PER-THREAD CACHING
+        //
+        // Concerns:
+        //: 1 A factory created without 'maxCachedBuffersPerThread', or with 0,
+        //:   does not cache buffers.
+        //:
+        //: 2 A buffer released by the thread that allocated it is reused by
+        //:   the next allocation of that thread.
+        //:
+        //: 3 A buffer released by another thread is returned to the thread
+        //:   that allocated it, and is not reused by the releasing thread.
+        //:
+        //: 4 Buffers can be allocated and released concurrently by several
+        //:   threads, and the buffers in use are never shared.
+        //:
+        //: 5 All memory is returned to the allocator when the factory is
+        //:   destroyed.
+        //:
+        //: 6 The buffers released by other threads are returned to the cache
+        //:   of their origin thread only up to the capacity of the cache, and
+        //:   to the shared pool beyond that.
+        //:
+        //: 7 When a thread exits, the buffers held by its cache, and those it
+        //:   allocated that are released afterwards, are returned to the
+        //:   shared pool, and its cache is reused by another thread.
+        //
+        // Plan:
+        //: 1 Verify the value of 'maxCachedBuffersPerThread' of factories
+        //:   created with each constructor.  (C-1)
+        //:
+        //: 2 Allocate, release, and allocate again a buffer in the same
+        //:   thread, and verify that the same memory is used.  (C-2)
+        //:
+        //: 3 Allocate buffers in the main thread and release them in another
+        //:   thread, which then allocates the same number of buffers.  Verify
+        //:   that the buffers allocated by the other thread are distinct from
+        //:   the released ones, and that the next buffers allocated by the
+        //:   main thread are the released ones.  (C-3)
+        //:
+        //: 4 In several threads, allocate buffers filled with the index of the
+        //:   thread, then verify and release the buffers of another thread,
+        //:   for several rounds and cache capacities.  (C-4)
+        //:
+        //: 5 Verify that no memory is in use after destroying the factories.
+        //:   (C-5)
+        //:
+        //: 6 Allocate twice the capacity of the cache in the main thread and
+        //:   release them in another thread, which then allocates the same
+        //:   number of buffers.  Verify that exactly the buffers in excess of
+        //:   the capacity are reused by the other thread.  (C-6)
+        //:
+        //: 7 Repeatedly create a thread that allocates and releases buffers,
+        //:   keeping some of them allocated until after it exits, and verify
+        //:   that the memory in use does not grow with the number of threads.
+        //:   (C-7)
+        //
+        // Testing:
+        //   PooledBlobBufferFactory(int, int maxCachedPerThread, Allocator *);
+        //   int maxCachedBuffersPerThread() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PER-THREAD CACHING" << endl
+                          << "==================" << endl;
+
+        using namespace TEST_CASE_CACHING;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\tConfiguration." << endl;
+        {
+            Obj mX(64, &ta);     const Obj& X = mX;
+            Obj mY(64, 0, &ta);  const Obj& Y = mY;
+            Obj mZ(64, 8, &ta);  const Obj& Z = mZ;
+
+            ASSERT(0 == X.maxCachedBuffersPerThread());
+            ASSERT(0 == Y.maxCachedBuffersPerThread());
+            ASSERT(8 == Z.maxCachedBuffersPerThread());
+            ASSERT(64 == Z.bufferSize());
+        }
+        ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tReuse by the same thread." << endl;
+        {
+            Obj mX(64, 4, &ta);
+
+            btlb::BlobBuffer buffer;
+            mX.allocate(&buffer);
+            ASSERT(64 == buffer.size());
+
+            const char *DATA = buffer.data();
+            buffer.reset();
+
+            mX.allocate(&buffer);
+            ASSERT(DATA == buffer.data());
+        }
+        ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tReturn to the allocating thread." << endl;
+        {
+            enum { k_NUM_BUFFERS = 6 };
+
+            Obj mX(32, k_NUM_BUFFERS, &ta);
+
+            Buffers released(&ta);
+            Buffers allocated(&ta);
+            released.resize(k_NUM_BUFFERS);
+
+            bsl::set<const char *> mine(&ta);
+            for (int i = 0; i < k_NUM_BUFFERS; ++i) {
+                mX.allocate(&released[i]);
+                mine.insert(released[i].data());
+            }
+
+            ReleaseBuffers job = { &released, &allocated, &mX };
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle, job));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERT(k_NUM_BUFFERS == allocated.size());
+            for (int i = 0; i < k_NUM_BUFFERS; ++i) {
+                ASSERTV(i, 0 == mine.count(allocated[i].data()));
+            }
+
+            for (int i = 0; i < k_NUM_BUFFERS; ++i) {
+                btlb::BlobBuffer buffer;
+                mX.allocate(&buffer);
+                ASSERTV(i, 1 == mine.count(buffer.data()));
+            }
+        }
+        ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tReturn beyond the cache capacity." << endl;
+        {
+            enum { k_CAPACITY = 4, k_NUM_BUFFERS = 2 * k_CAPACITY };
+
+            Obj mX(32, k_CAPACITY, &ta);
+
+            Buffers released(&ta);
+            Buffers allocated(&ta);
+            released.resize(k_NUM_BUFFERS);
+
+            bsl::set<const char *> mine(&ta);
+            for (int i = 0; i < k_NUM_BUFFERS; ++i) {
+                mX.allocate(&released[i]);
+                mine.insert(released[i].data());
+            }
+
+            ReleaseBuffers job = { &released, &allocated, &mX };
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle, job));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERT(k_NUM_BUFFERS == allocated.size());
+
+            int numReused = 0;
+            for (int i = 0; i < k_NUM_BUFFERS; ++i) {
+                numReused += static_cast<int>(mine.count(allocated[i].data()));
+            }
+            ASSERTV(numReused, k_NUM_BUFFERS - k_CAPACITY == numReused);
+        }
+        ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tReclaiming the caches of exited threads."
+                          << endl;
+        {
+            enum { k_CAPACITY = 8, k_NUM_BUFFERS = 12, k_NUM_THREADS = 20 };
+
+            Obj mX(32, k_CAPACITY, &ta);
+
+            bsls::Types::Int64 numBytesInUse = 0;
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                Buffers            kept(&ta);
+                AllocateAndRelease job = { k_NUM_BUFFERS, 2, &kept, &mX };
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERTV(i, 0 == bslmt::ThreadUtil::create(&handle, job));
+                ASSERTV(i, 0 == bslmt::ThreadUtil::join(handle));
+
+                ASSERTV(i, 2 == kept.size());
+                kept.clear();
+
+                if (0 == i) {
+                    numBytesInUse = ta.numBytesInUse();
+                }
+                ASSERTV(i, numBytesInUse, ta.numBytesInUse(),
+                        numBytesInUse == ta.numBytesInUse());
+            }
+        }
+        ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tConcurrent exchanges." << endl;
+
+        static const int CAPACITIES[] = { 0, 1, 7, 64 };
+        enum { k_NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES };
+
+        for (int ci = 0; ci < k_NUM_CAPACITIES; ++ci) {
+            enum { k_NUM_THREADS = 4 };
+
+            const int CAPACITY = CAPACITIES[ci];
+
+            Obj            mX(48, CAPACITY, &ta);
+            bslmt::Barrier barrier(k_NUM_THREADS);
+
+            bsl::vector<Buffers> slots(k_NUM_THREADS, Buffers(&ta), &ta);
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ExchangeBuffers job = { i,
+                                        k_NUM_THREADS,
+                                        50,
+                                        1 + i * 10,
+                                        slots.data(),
+                                        &barrier,
+                                        &mX };
+
+                ASSERTV(CAPACITY, i,
+                        0 == bslmt::ThreadUtil::create(&handles[i], job));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERTV(CAPACITY, i,
+                        0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+        }
+        ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+      } break;
       case 1: {
         // --------------------------------------------------------------------
         // BREATHING TEST
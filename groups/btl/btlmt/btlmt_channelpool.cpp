@@ -14,6 +14,7 @@
 BSLS_IDENT("$Id$ $CSID$")
 
 #include <btls_iovecutil.h>
+#include <btlso_ipv6address.h>
 #include <btlso_resolveutil.h>
 #include <btlso_socketimputil.h>
 #include <btlso_lingeroptions.h>
@@ -38,6 +39,7 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <bdlb_nullablevalue.h>
 
 #include <bslma_default.h>
+#include <bslmf_issame.h>
 #include <bslmf_metaint.h>
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
@@ -46,6 +48,8 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_deque.h>
 #include <bsl_functional.h>
 #include <bsl_string.h>
 #include <bsl_utility.h>
@@ -57,6 +61,18 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <fcntl.h>
 #endif
 
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <linux/errqueue.h>
+#include <errno.h>
+
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY) \
+                                             && defined(SO_EE_ORIGIN_ZEROCOPY)
+#define BTLMT_CHANNELPOOL_ZEROCOPY 1
+#endif
+#endif
+
 #ifdef min
 #undef min
 #endif
@@ -67,6 +83,8 @@ namespace btlmt {
 
 typedef btlso::StreamSocket<btlso::IPv4Address>        StreamSocket;
 typedef btlso::StreamSocketFactory<btlso::IPv4Address> StreamSocketFactory;
+typedef btlso::InetStreamSocketFactory<btlso::IPv4Address>
+                                                       InetStreamSocketFactory;
 
 typedef btlso::StreamSocketFactoryAutoDeallocateGuard<btlso::IPv4Address>
                                                        AutoCloseSocket;
@@ -100,6 +118,9 @@ enum {
 // channel) are:
 //..
 //  btlmt::Channel::readTimeoutCb              // via registerTimer
+//  btlmt::Channel::coalescingTimeoutCb        // via registerTimer
+//  btlmt::Channel::flushCoalescedWrites       // via execute
+//  btlmt::Channel::zeroCopyTimeoutCb          // via registerTimer
 //  btlmt::Channel::registerWriteCb            // via execute
 //  btlmt::Channel::disableRead                // via execute
 //  btlmt::Channel::initiateReadSequence       // via execute
@@ -140,6 +161,11 @@ enum {
 
     k_MAX_SPIN           = 1000,         // iterations
 
+    // Polling period for zero-copy completions while no socket event of the
+    // channel is registered.
+
+    k_ZEROCOPY_POLL_INTERVAL = 10,       // 10ms
+
     // Exponential backoff parameters in acceptCb (if FD limit reached).
 
     k_WAIT_FOR_RESOURCES = 1,            // 1s
@@ -162,6 +188,192 @@ enum ChannelDownMask {
     e_CLOSED_BOTH_MASK    = e_CLOSED_SEND_MASK | e_CLOSED_RECEIVE_MASK
 };
 
+                    // ==============================
+                    // local struct SocketAddressUtil
+                    // ==============================
+
+struct SocketAddressUtil {
+    // This 'struct' provides a namespace for the operations of this channel
+    // pool that depend on the address family of a socket.  Every socket is
+    // held as a 'StreamSocket' (i.e., for the IPv4 family), whose other
+    // operations do not depend on the family and are also valid on an IPv6
+    // socket.  The functions below operate on IPv6 sockets through their
+    // handle, and on IPv4 sockets through their 'StreamSocket' interface with
+    // the IPv4-mapped form of IPv4 addresses.
+
+    // CLASS METHODS
+    static StreamSocket *allocate(InetStreamSocketFactory *factory,
+                                  bool                     isIPv6);
+        // Return a socket allocated from the specified 'factory', opened in
+        // the IPv6 family if the specified 'isIPv6' is 'true' and in the IPv4
+        // family otherwise, or 0 on failure.
+
+    static int bind(StreamSocket              *socket,
+                    const btlso::IPv6Address&  address,
+                    bool                       isIPv6);
+        // Bind the specified 'socket' to the specified 'address', where the
+        // specified 'isIPv6' indicates the family of 'socket'.  Return 0 on
+        // success, and a non-zero value otherwise.  The behavior is undefined
+        // unless 'isIPv6' or 'address' is IPv4-mapped.
+
+    static int connect(StreamSocket              *socket,
+                       const btlso::IPv6Address&  address,
+                       bool                       isIPv6);
+        // Initiate the connection of the specified 'socket' to the specified
+        // 'address', where the specified 'isIPv6' indicates the family of
+        // 'socket'.  Return 0 on success, and the same non-zero values as
+        // 'StreamSocket::connect' otherwise.  The behavior is undefined
+        // unless 'isIPv6' or 'address' is IPv4-mapped.
+
+    static int localAddress(btlso::IPv6Address *result,
+                            const StreamSocket *socket,
+                            bool                isIPv6);
+    static int peerAddress(btlso::IPv6Address *result,
+                           const StreamSocket *socket,
+                           bool                isIPv6);
+        // Load into the specified 'result' the local (respectively, peer)
+        // address of the specified 'socket', where the specified 'isIPv6'
+        // indicates the family of 'socket', in its IPv4-mapped form for an
+        // IPv4 socket.  Return 0 on success, and a non-zero value with no
+        // effect on 'result' otherwise.
+
+    static int resolve(btlso::IPv6Address *result,
+                       const char         *hostname,
+                       int                 portNumber,
+                       bool                isIPv6);
+        // Load into the specified 'result' the address of the specified
+        // 'hostname' on the specified 'portNumber', resolved for a socket of
+        // the family indicated by the specified 'isIPv6': the most preferred
+        // IPv6 or (IPv4-mapped) IPv4 address if 'isIPv6' is 'true', and the
+        // IPv4-mapped form of an IPv4 address otherwise.  Return 0 on
+        // success, and a non-zero value with no effect on 'result' otherwise.
+};
+
+StreamSocket *SocketAddressUtil::allocate(InetStreamSocketFactory *factory,
+                                          bool                     isIPv6)
+{
+    if (!isIPv6) {
+        return factory->allocate();                                   // RETURN
+    }
+
+    btlso::SocketHandle::Handle handle;
+    if (0 != btlso::SocketImpUtil::open<btlso::IPv6Address>(
+                                      &handle,
+                                      btlso::SocketImpUtil::k_SOCKET_STREAM)) {
+        return 0;                                                     // RETURN
+    }
+
+    return factory->allocate(handle);
+}
+
+int SocketAddressUtil::bind(StreamSocket              *socket,
+                            const btlso::IPv6Address&  address,
+                            bool                       isIPv6)
+{
+    if (isIPv6) {
+        return btlso::SocketImpUtil::bind<btlso::IPv6Address>(
+                                                              socket->handle(),
+                                                              address);
+                                                                      // RETURN
+    }
+
+    btlso::IPv4Address ipv4Address;
+    const int rc = address.loadIPv4Address(&ipv4Address);
+    BSLS_ASSERT(0 == rc);  (void)rc;
+
+    return socket->bind(ipv4Address);
+}
+
+int SocketAddressUtil::connect(StreamSocket              *socket,
+                               const btlso::IPv6Address&  address,
+                               bool                       isIPv6)
+{
+    if (isIPv6) {
+        return btlso::SocketImpUtil::connect<btlso::IPv6Address>(
+                                                              socket->handle(),
+                                                              address);
+                                                                      // RETURN
+    }
+
+    btlso::IPv4Address ipv4Address;
+    const int rc = address.loadIPv4Address(&ipv4Address);
+    BSLS_ASSERT(0 == rc);  (void)rc;
+
+    return socket->connect(ipv4Address);
+}
+
+int SocketAddressUtil::localAddress(btlso::IPv6Address *result,
+                                    const StreamSocket *socket,
+                                    bool                isIPv6)
+{
+    if (isIPv6) {
+        return btlso::SocketImpUtil::getLocalAddress<btlso::IPv6Address>(
+                                                             result,
+                                                             socket->handle());
+                                                                      // RETURN
+    }
+
+    btlso::IPv4Address ipv4Address;
+    const int rc = socket->localAddress(&ipv4Address);
+    if (rc) {
+        return rc;                                                    // RETURN
+    }
+
+    *result = btlso::IPv6Address(ipv4Address);
+    return 0;
+}
+
+int SocketAddressUtil::peerAddress(btlso::IPv6Address *result,
+                                   const StreamSocket *socket,
+                                   bool                isIPv6)
+{
+    if (isIPv6) {
+        return btlso::SocketImpUtil::getPeerAddress<btlso::IPv6Address>(
+                                                             result,
+                                                             socket->handle());
+                                                                      // RETURN
+    }
+
+    btlso::IPv4Address ipv4Address;
+    const int rc = socket->peerAddress(&ipv4Address);
+    if (rc) {
+        return rc;                                                    // RETURN
+    }
+
+    *result = btlso::IPv6Address(ipv4Address);
+    return 0;
+}
+
+int SocketAddressUtil::resolve(btlso::IPv6Address *result,
+                               const char         *hostname,
+                               int                 portNumber,
+                               bool                isIPv6)
+{
+    btlso::IPv6Address address;
+    int                errorCode = 0;
+
+    if (isIPv6) {
+        if (0 != btlso::ResolveUtil::getAddress(&address,
+                                                hostname,
+                                                &errorCode)) {
+            return -1;                                                // RETURN
+        }
+    }
+    else {
+        btlso::IPv4Address ipv4Address;
+        if (0 != btlso::ResolveUtil::getAddress(&ipv4Address,
+                                                hostname,
+                                                &errorCode)) {
+            return -1;                                                // RETURN
+        }
+        address = btlso::IPv6Address(ipv4Address);
+    }
+
+    address.setPortNumber(portNumber);
+    *result = address;
+    return 0;
+}
+
                     // ===================
                     // local class Channel
                     // ===================
@@ -193,6 +405,23 @@ class Channel {
     // Synchronization between these two modes is done using the outgoing flag,
     // while synchronizing between any outgoing element (outgoing blob,
     // message, or flag) is done using the outgoing mutex.
+    //
+    // If write coalescing is enabled, a message written when no write is in
+    // progress is not written from the calling thread.  It is enqueued into
+    // the outgoing blob instead, along with all the messages written after it,
+    // until the coalescing interval elapses (or until they fill a single
+    // 'writev'), at which point 'flushCoalescedWrites' transfers them to the
+    // outgoing message and lets 'writeCb' write them.
+    //
+    // If zero-copy sends are enabled, blob messages large enough to be sent
+    // without copying are never written from the calling thread, and 'writeCb'
+    // sends data with 'MSG_ZEROCOPY' whenever enough bytes are ready to be
+    // sent in a single system call.  The blob buffers of each such send are
+    // retained until the kernel reports, on the error queue of the socket,
+    // that it no longer references them.  These reports are processed by
+    // 'readCb' and 'writeCb' (which are woken up by the event manager when the
+    // error queue is not empty), or by a polling timer if neither is
+    // registered.
 
     // PRIVATE TYPES
     typedef ChannelPool::ChannelStateChangeCallback ChannelStateChangeCallback;
@@ -276,6 +505,16 @@ class Channel {
 
     const int                        d_minIncomingMessageSize;
 
+    const bool                       d_coalesceWritesFlag;
+                                                         // 'true' if written
+                                                         // messages are
+                                                         // gathered
+
+    const bsls::TimeInterval         d_coalescingInterval;
+                                                         // maximum time a
+                                                         // message is delayed
+                                                         // to be gathered
+
     // Channel state section (continued)
 
     bsls::AtomicInt                  d_channelDownFlag;  // are we down?
@@ -330,7 +569,13 @@ class Channel {
 
     btlb::Blob                       d_blobReadData;     // blob for read data
 
-    btlso::IPv4Address               d_peerAddress;      // peer address
+    btlso::IPv6Address               d_peerAddress;      // peer address
+                                                         // (IPv4-mapped for
+                                                         // an IPv4 socket)
+
+    bool                             d_isIPv6;           // whether the
+                                                         // socket is an IPv6
+                                                         // socket
 
     // Memory allocation section (pointers held, not owned)
 
@@ -358,6 +603,21 @@ class Channel {
     bool                             d_isWriteActive;    // a thread is
                                                          // actively writing
 
+    bool                             d_isWriteCoalescing;// messages are being
+                                                         // gathered into the
+                                                         // outgoing blob
+                                                         // until the next
+                                                         // flush
+
+    unsigned int                     d_coalescingGeneration;
+                                                         // number of batches
+                                                         // of gathered
+                                                         // messages started
+
+    void                            *d_coalescingTimerId;// flush timer of the
+                                                         // current batch, if
+                                                         // not yet fired
+
     bsls::AtomicInt                  d_writeActiveCacheSize;
                                                          // number of bytes
                                                          // currently being
@@ -365,6 +625,38 @@ class Channel {
                                                          // in
                                                          // d_writeActiveData)
 
+    // Zero-copy section (only accessed in the dispatcher thread)
+
+    struct ZeroCopySend {
+        // Record of a single zero-copy send still referenced by the kernel.
+
+        int  d_numBuffers;     // number of blob buffers retained in
+                               // 'd_zeroCopyBuffers' for this send
+
+        bool d_completedFlag;  // 'true' once the kernel released this send
+    };
+
+    int                              d_zeroCopyThreshold;// minimum number of
+                                                         // bytes sent with
+                                                         // 'MSG_ZEROCOPY', or
+                                                         // 0 if disabled
+
+    unsigned int                     d_zeroCopyFirstId;  // kernel id of
+                                                         // the first element
+                                                         // of
+                                                         // 'd_zeroCopySends'
+
+    bsl::deque<ZeroCopySend>         d_zeroCopySends;    // sends not yet
+                                                         // released by the
+                                                         // kernel, in order
+
+    bsl::deque<btlb::BlobBuffer>     d_zeroCopyBuffers;  // buffers retained
+                                                         // for
+                                                         // 'd_zeroCopySends'
+
+    void                            *d_zeroCopyTimerId;  // completion polling
+                                                         // timer, if any
+
     bdlma::ConcurrentPoolAllocator  *d_sharedPtrRepAllocator_p;
 
     bslma::Allocator                *d_allocator_p;      // for memory
@@ -389,10 +681,45 @@ class Channel {
         // invoking the user callback if required, and adjusting the internal
         // data buffer as needed.
 
+    void processZeroCopyCompletions();
+        // Dequeue all the zero-copy completion notifications available on the
+        // error queue of the socket underlying this channel, release the blob
+        // buffers of every zero-copy send that is no longer referenced by the
+        // kernel, and invoke the channel state callback with
+        // 'e_ZERO_COPY_COMPLETE' if any buffer was released.  Note that this
+        // function should always be executed in the dispatcher thread of the
+        // event manager associated with this channel.
+
+    bool releaseZeroCopySends();
+        // Dequeue all the zero-copy completion notifications available on the
+        // error queue of the socket underlying this channel, and release the
+        // blob buffers of every zero-copy send that is no longer referenced by
+        // the kernel.  Return 'true' if any buffer was released, and 'false'
+        // otherwise.
+
+    int writeZeroCopy(bool *isZeroCopy, int numVecs);
+        // Send the data described by the first specified 'numVecs' elements of
+        // 'd_ovecs' to the socket underlying this channel without copying it
+        // into the kernel if possible, and load into the specified
+        // 'isZeroCopy' whether the kernel now references the sent data.
+        // Return the number of bytes sent on success, and a negative value (as
+        // returned by 'writev' on the underlying socket) otherwise.  If
+        // 'isZeroCopy' is loaded with 'true', the caller must retain the blob
+        // buffers holding the sent bytes as a new element of
+        // 'd_zeroCopySends'.  Note that if the kernel cannot pin the data, it
+        // is sent by a regular 'writev'.
+
     // PRIVATE METHODS
     void cancelAll();
         // Remove all the pending timers from the event manager.
 
+    void coalescingTimeoutCb(ChannelHandle self, unsigned int generation);
+        // Flush the batch of gathered messages having the specified
+        // 'generation' at the end of its coalescing interval, unless it was
+        // already flushed.  Note that this function should always be executed
+        // in the dispatcher thread of the event manager associated with this
+        // channel.
+
     void deregisterSocketRead(ChannelHandle self);
         // Deregister this channel for receiving socket read events.  Must be
         // called only when a read event is registered for the socket
@@ -405,6 +732,14 @@ class Channel {
         // underlying this channel in the event manager associated with this
         // channel.
 
+    void flushCoalescedWrites(ChannelHandle self, unsigned int generation);
+        // Transfer the messages gathered in the outgoing blob to the outgoing
+        // message and register 'writeCb' to write them, unless the batch
+        // having the specified 'generation' was already flushed, and
+        // deregister the flush timer of that batch if it has not yet fired.
+        // Note that this function should always be executed in the dispatcher
+        // thread of the event manager associated with this channel.
+
     void invokeChannelDown(ChannelHandle              self,
                            ChannelPool::ChannelEvents type);
         // Invoke user-installed channel state callback with the specified
@@ -458,6 +793,14 @@ class Channel {
         // function should always be executed in the dispatcher thread of the
         // event manager associated with this channel.
 
+    void registerZeroCopyTimer(const ChannelHandle& self);
+        // Register 'zeroCopyTimeoutCb' to be called by the manager in its
+        // dispatcher thread after 'k_ZEROCOPY_POLL_INTERVAL' milliseconds, if
+        // some zero-copy sends are not yet released and no such timer is
+        // already registered.  Note that this function should always be
+        // executed in the dispatcher thread of the event manager associated
+        // with this channel.
+
     int refillOutgoingMsg();
         // Empty the outgoing message, swap it with the outgoing blob, and
         // return non-zero, if there is more data enqueued in the outgoing
@@ -477,6 +820,15 @@ class Channel {
         // also that the specified 'self' is guaranteed to live throughout the
         // lifetime of this function call.
 
+    void zeroCopyTimeoutCb(ChannelHandle self);
+        // Process the zero-copy completions available for this channel, and
+        // register this callback again if some zero-copy sends are still
+        // referenced by the kernel.  This callback is needed because the
+        // completions are only otherwise processed by 'readCb' and 'writeCb',
+        // neither of which may be registered.  Note that this function should
+        // always be executed in the dispatcher thread of the event manager
+        // associated with this channel.
+
     void writeCb(ChannelHandle self);
         // Write the first message(s) enqueued for this channel to the
         // underlying 'StreamSocket'.  If more data is available for writing
@@ -507,6 +859,7 @@ class Channel {
             const ChannelPoolConfiguration&  configuration,
             ChannelType::Value               channelType,
             bool                             mode,
+            bool                             isIPv6,
             ChannelStateChangeCallback       channelCb,
             BlobBasedReadCallback            blobBasedReadCb,
             btlb::BlobBufferFactory         *writeBlobBufferPool,
@@ -518,7 +871,8 @@ class Channel {
         // Create a channel belonging to the specified 'channelPool' and
         // managed by the specified 'eventManager' with the specified
         // 'sourceId', 'channelId', and 'configuration'.  Assume ownership of
-        // the specified 'socket' to use as the underlying socket.  Load this
+        // the specified 'socket' to use as the underlying socket, which is an
+        // IPv6 socket if the specified 'isIPv6' is 'true'.  Load this
         // channel's channel callback with the specified 'channelCb' and
         // 'blobBasedReadCb' to decide which data callback to use.  Use the
         // specified 'sharedPtrAllocator' to create shared pointer rep
@@ -614,8 +968,13 @@ class Channel {
     TcpTimerEventManager *eventManager() const;
         // Return a pointer to this channel's event manager.
 
-    const btlso::IPv4Address& peerAddress() const;
-        // Return the address of the peer that this channel is connected to.
+    const btlso::IPv6Address& peerAddress() const;
+        // Return the address of the peer that this channel is connected to,
+        // in its IPv4-mapped form if this channel is not an IPv6 channel.
+
+    bool isIPv6() const;
+        // Return 'true' if the socket of this channel is an IPv6 socket, and
+        // 'false' otherwise.
 
     bool isChannelDown(ChannelDownMask mask) const;
         // Return 'true' is this channel is down for the specified 'mask'
@@ -711,11 +1070,17 @@ bool Channel::isChannelDown(ChannelDownMask mask) const
 }
 
 inline
-const btlso::IPv4Address& Channel::peerAddress() const
+const btlso::IPv6Address& Channel::peerAddress() const
 {
     return d_peerAddress;
 }
 
+inline
+bool Channel::isIPv6() const
+{
+    return d_isIPv6;
+}
+
 inline
 bsls::Types::Int64 Channel::numBytesRead() const
 {
@@ -794,7 +1159,13 @@ class Connector {
                                                        // unless the resolution
                                                        // flag is set
 
-    btlso::IPv4Address             d_serverAddress;    // server to connect to
+    btlso::IPv6Address             d_serverAddress;    // server to connect
+                                                       // to (IPv4-mapped
+                                                       // unless the IPv6 flag
+                                                       // is set)
+
+    bool                           d_isIPv6;           // whether to connect
+                                                       // from an IPv6 socket
 
     bsls::TimeInterval             d_creationTime;     // time at which
                                                        // connection was
@@ -835,9 +1206,11 @@ class Connector {
                                    d_socketOptions;    // socket options
                                                        // provided for connect
 
-    bdlb::NullableValue<btlso::IPv4Address>
+    bdlb::NullableValue<btlso::IPv6Address>
                                    d_localAddress;     // client address to
                                                        // bind while connecting
+                                                       // (IPv4-mapped unless
+                                                       // the IPv6 flag is set)
 
     // CREATORS
     Connector(const bsl::shared_ptr<btlso::StreamSocket<btlso::IPv4Address> >&
@@ -848,7 +1221,7 @@ class Connector {
               bool                        readEnabledFlag,
               bool                        keepHalfOpenMode,
               const btlso::SocketOptions *socketOptions = 0,
-              const btlso::IPv4Address   *localAddress = 0,
+              const btlso::IPv6Address   *localAddress = 0,
               bslma::Allocator           *basicAllocator = 0);
         // Create an connector initialized with the specified 'manager',
         // 'numAttempts', and 'interval' period parameters and the specified
@@ -876,11 +1249,12 @@ Connector::Connector(
                bool                        readEnabledFlag,
                bool                        keepHalfOpenMode,
                const btlso::SocketOptions *socketOptions,
-               const btlso::IPv4Address   *localAddress,
+               const btlso::IPv6Address   *localAddress,
                bslma::Allocator           *basicAllocator)
 : d_socket(socket)
 , d_manager_p(manager)
 , d_serverName(basicAllocator)
+, d_isIPv6(false)
 , d_creationTime(bdlt::CurrentTime::now())
 , d_period(interval)
 , d_start(d_creationTime)
@@ -909,6 +1283,7 @@ Connector::Connector(const Connector&  original,
 , d_manager_p (original.d_manager_p)
 , d_serverName(original.d_serverName, basicAllocator)
 , d_serverAddress(original.d_serverAddress)
+, d_isIPv6(original.d_isIPv6)
 , d_creationTime(original.d_creationTime)
 , d_period(original.d_period)
 , d_start(original.d_start)
@@ -934,7 +1309,12 @@ class ServerState {
     // open.
 
     // DATA MEMBERS
-    btlso::IPv4Address          d_endpoint;           // server address
+    btlso::IPv6Address          d_endpoint;           // server address
+                                                      // (IPv4-mapped unless
+                                                      // the IPv6 flag is set)
+
+    bool                        d_isIPv6;             // is the accepting
+                                                      // socket an IPv6 socket?
 
     StreamSocket               *d_socket_p;           // accepting socket
                                                       // (owned)
@@ -987,6 +1367,24 @@ class ServerState {
                                                       // server connections
                                                       // must create channels
 
+    bool                        d_isPrimaryFlag;      // is this the server
+                                                      // state held in
+                                                      // 'd_acceptors' (which
+                                                      // owns the accept
+                                                      // timeout)?
+
+    bool                        d_keepOnManagerFlag;  // are accepted channels
+                                                      // managed by
+                                                      // 'd_manager_p' (i.e.,
+                                                      // is this one of
+                                                      // several 'SO_REUSEPORT'
+                                                      // listeners)?
+
+    bsl::shared_ptr<ServerState>
+                                d_nextListener;       // next 'SO_REUSEPORT'
+                                                      // listener of the same
+                                                      // server, if any
+
     // CREATORS
     ~ServerState();
         // Destroy this server,
@@ -1119,6 +1517,139 @@ void Channel::processReadData(int numBytes)
         d_minBytesBeforeNextCb = minAdditional;
     }
 }
+
+void Channel::processZeroCopyCompletions()
+{
+    if (releaseZeroCopySends()) {
+        d_channelStateCb(d_channelId,
+                         d_sourceId,
+                         ChannelPool::e_ZERO_COPY_COMPLETE,
+                         d_userData);
+    }
+}
+
+bool Channel::releaseZeroCopySends()
+{
+    bool releasedFlag = false;
+
+#ifdef BTLMT_CHANNELPOOL_ZEROCOPY
+    if (d_zeroCopySends.empty()) {
+        return false;                                                 // RETURN
+    }
+
+    const int fd = socket()->handle();
+
+    while (1) {
+        char          control[128];
+        struct msghdr msg;
+
+        bsl::memset(&msg, 0, sizeof msg);
+        msg.msg_control    = control;
+        msg.msg_controllen = sizeof control;
+
+        if (0 > ::recvmsg(fd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT)) {
+            // The error queue is empty.
+
+            break;
+        }
+
+        for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+             cmsg;
+             cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+            if (!(SOL_IP == cmsg->cmsg_level && IP_RECVERR == cmsg->cmsg_type)
+             && !(SOL_IPV6     == cmsg->cmsg_level
+               && IPV6_RECVERR == cmsg->cmsg_type)) {
+                continue;
+            }
+
+            const struct sock_extended_err *err =
+                       reinterpret_cast<const struct sock_extended_err *>(
+                                                             CMSG_DATA(cmsg));
+
+            if (0 != err->ee_errno
+             || SO_EE_ORIGIN_ZEROCOPY != err->ee_origin) {
+                continue;
+            }
+
+            // The kernel numbers the zero-copy sends of a socket in sequence,
+            // and reports the inclusive range '[ee_info, ee_data]' of sends it
+            // no longer references.  Ranges may be reported out of order.
+
+            const unsigned int numSends = static_cast<unsigned int>(
+                                                       d_zeroCopySends.size());
+            const unsigned int last = err->ee_data - d_zeroCopyFirstId;
+
+            for (unsigned int i = err->ee_info - d_zeroCopyFirstId;
+                 i < numSends && i <= last;
+                 ++i) {
+                d_zeroCopySends[i].d_completedFlag = true;
+            }
+        }
+    }
+
+    while (!d_zeroCopySends.empty()
+        && d_zeroCopySends.front().d_completedFlag) {
+        d_zeroCopyBuffers.erase(
+                  d_zeroCopyBuffers.begin(),
+                  d_zeroCopyBuffers.begin() +
+                                       d_zeroCopySends.front().d_numBuffers);
+        d_zeroCopySends.pop_front();
+        ++d_zeroCopyFirstId;
+        releasedFlag = true;
+    }
+#endif
+
+    return releasedFlag;
+}
+
+int Channel::writeZeroCopy(bool *isZeroCopy, int numVecs)
+{
+    BSLS_ASSERT(isZeroCopy);
+
+    *isZeroCopy = false;
+
+#ifdef BTLMT_CHANNELPOOL_ZEROCOPY
+    struct msghdr msg;
+
+    bsl::memset(&msg, 0, sizeof msg);
+    msg.msg_iov    = reinterpret_cast<struct iovec *>(d_ovecs);
+    msg.msg_iovlen = numVecs;
+
+    while (1) {
+        const ssize_t rc = ::sendmsg(socket()->handle(),
+                                     &msg,
+                                     MSG_ZEROCOPY | MSG_NOSIGNAL);
+
+        if (0 < rc) {
+            *isZeroCopy = true;
+            return static_cast<int>(rc);                              // RETURN
+        }
+
+        if (EINTR == errno) {
+            continue;
+        }
+
+        if (EAGAIN == errno || EWOULDBLOCK == errno) {
+            return btlso::SocketHandle::e_ERROR_WOULDBLOCK;           // RETURN
+        }
+
+        if (EPIPE == errno || ECONNRESET == errno) {
+            return btlso::SocketHandle::e_ERROR_CONNDEAD;             // RETURN
+        }
+
+        if (ENOBUFS != errno) {
+            return btlso::SocketHandle::e_ERROR_UNCLASSIFIED;         // RETURN
+        }
+
+        // The kernel could not pin the data (e.g., the 'optmem' limit is
+        // reached): send a copy instead.
+
+        break;
+    }
+#endif
+
+    return socket()->writev(d_ovecs, numVecs);
+}
 }  // close package namespace
 
 // ============================================================================
@@ -1136,6 +1667,58 @@ namespace btlmt {
                     // -------------------
 
 // PRIVATE MANIPULATORS
+void Channel::coalescingTimeoutCb(ChannelHandle self, unsigned int generation)
+{
+    {
+        // This timer has fired, so it must not be deregistered by the flush.
+
+        bslmt::LockGuard<bslmt::Mutex> oGuard(&d_writeMutex);
+
+        if (generation == d_coalescingGeneration) {
+            d_coalescingTimerId = 0;
+        }
+    }
+
+    flushCoalescedWrites(self, generation);
+}
+
+void Channel::flushCoalescedWrites(ChannelHandle self, unsigned int generation)
+{
+    if (0 != protectAndCheckCallback(self, e_CLOSED_SEND_MASK)) {
+        return;                                                       // RETURN
+    }
+
+    void *timerId;
+    {
+        bslmt::LockGuard<bslmt::Mutex> oGuard(&d_writeMutex);
+
+        if (!d_isWriteCoalescing || generation != d_coalescingGeneration) {
+            // These messages were already flushed, because they filled a
+            // 'writev' before the end of the coalescing interval.
+
+            return;                                                   // RETURN
+        }
+
+        d_isWriteCoalescing = false;
+
+        timerId             = d_coalescingTimerId;
+        d_coalescingTimerId = 0;
+    }
+
+    if (timerId) {
+        // This batch is flushed before the end of its coalescing interval.
+
+        d_eventManager_p->deregisterTimer(timerId);
+    }
+
+    // The outgoing message is necessarily empty while messages are gathered,
+    // since 'd_isWriteActive' was set by the first of them.
+
+    if (refillOutgoingMsg()) {
+        registerWriteCb(self);
+    }
+}
+
 void Channel::invokeChannelDown(ChannelHandle              self,
                                 ChannelPool::ChannelEvents type)
 {
@@ -1168,6 +1751,32 @@ void Channel::invokeChannelDown(ChannelHandle              self,
         }
     }
 
+    // Keep polling for zero-copy completions once the write part is closed:
+    // the polling timer holds this channel, and hence its socket and the
+    // buffers still retained, until the kernel no longer references them
+    // (see 'zeroCopyTimeoutCb').
+
+    if (ChannelPool::e_CHANNEL_DOWN_READ != type) {
+        registerZeroCopyTimer(self);
+    }
+
+    // The messages being gathered will never be flushed once the write part
+    // is closed.
+
+    if (ChannelPool::e_CHANNEL_DOWN_READ != type) {
+        void *timerId;
+        {
+            bslmt::LockGuard<bslmt::Mutex> oGuard(&d_writeMutex);
+
+            timerId             = d_coalescingTimerId;
+            d_coalescingTimerId = 0;
+        }
+
+        if (timerId) {
+            d_eventManager_p->deregisterTimer(timerId);
+        }
+    }
+
     d_channelStateCb(d_channelId, d_sourceId, type, d_userData);
     d_channelUpFlag = 0;
 }
@@ -1343,6 +1952,11 @@ void Channel::readCb(ChannelHandle self)
         return;                                                       // RETURN
     }
 
+    // The event manager also invokes this callback when zero-copy completions
+    // are pending on the error queue of the socket.
+
+    processZeroCopyCompletions();
+
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_enableReadFlag)) {
         // This readCb was still pending while we were executing 'disableRead'
         // and didn't get properly deregistered.  We abort now to avoid
@@ -1570,6 +2184,24 @@ void Channel::registerWriteCb(ChannelHandle self)
     // We simply wait until the socket calls us back.
 }
 
+void Channel::registerZeroCopyTimer(const ChannelHandle& self)
+{
+    if (d_zeroCopyTimerId || d_zeroCopySends.empty()) {
+        return;                                                       // RETURN
+    }
+
+    bsl::function<void()> zeroCopyFunctor(bdlf::BindUtil::bind(
+                                                   &Channel::zeroCopyTimeoutCb,
+                                                    this,
+                                                    self));
+
+    bsls::TimeInterval timeout = bdlt::CurrentTime::now();
+    timeout.addMilliseconds(k_ZEROCOPY_POLL_INTERVAL);
+
+    d_zeroCopyTimerId = d_eventManager_p->registerTimer(timeout,
+                                                        zeroCopyFunctor);
+}
+
 void Channel::writeCb(ChannelHandle self)
 {
     // This callback is executed whenever the write buffer of 'd_socket_p' has
@@ -1579,6 +2211,11 @@ void Channel::writeCb(ChannelHandle self)
         return;                                                       // RETURN
     }
 
+    // The event manager also invokes this callback when zero-copy completions
+    // are pending on the error queue of the socket.
+
+    processZeroCopyCompletions();
+
     // This method is always executed in the dispatcher thread of the event
     // manager, and thus there is no race with 'writeMessage', as long as the
     // outgoing flag is set (since 'writeMessage' will append to the outgoing
@@ -1637,7 +2274,16 @@ void Channel::writeCb(ChannelHandle self)
                                   : d_writeActiveData->lastDataBufferLength());
         }
 
-        int writeRet = socket()->writev(d_ovecs, numVecs);
+        int  writeRet;
+        bool isZeroCopy = false;
+
+        if (d_zeroCopyThreshold
+         && d_zeroCopyThreshold <= btls::IovecUtil::length(d_ovecs, numVecs)) {
+            writeRet = writeZeroCopy(&isZeroCopy, numVecs);
+        }
+        else {
+            writeRet = socket()->writev(d_ovecs, numVecs);
+        }
 
         if (btlso::SocketHandle::e_ERROR_WOULDBLOCK == writeRet) {
             // In theory, this is the only writing thread so if 'writeCb' we
@@ -1694,6 +2340,8 @@ void Channel::writeCb(ChannelHandle self)
         // bytes written in the iovec write buffers, and should be 0, except if
         // the last buffer is not completely written.
 
+        const int firstBuffer = currentBuffer;
+
         while (0 < writeRet && bufSize <= writeRet + currentOffset) {
             writeRet -= bufSize - currentOffset;
             ++currentBuffer;
@@ -1705,6 +2353,22 @@ void Channel::writeCb(ChannelHandle self)
         currentOffset += writeRet;
         BSLS_ASSERT(currentBuffer <= numBuffers);
 
+        if (isZeroCopy) {
+            // Retain every buffer holding some of the bytes just sent until
+            // the kernel no longer references them.
+
+            const int lastBuffer = currentOffset ? currentBuffer
+                                                 : currentBuffer - 1;
+
+            for (int i = firstBuffer; i <= lastBuffer; ++i) {
+                d_zeroCopyBuffers.push_back(d_writeActiveData->buffer(i));
+            }
+
+            ZeroCopySend zeroCopySend = { lastBuffer - firstBuffer + 1,
+                                          false };
+            d_zeroCopySends.push_back(zeroCopySend);
+        }
+
         // Update the outgoing message with the new current buffer and offset
         // information.
 
@@ -1730,9 +2394,11 @@ void Channel::writeCb(ChannelHandle self)
             // done in 'refillOutgoingMsg'.
 
             if (isChannelDown(e_CLOSED_SEND_MASK) || !refillOutgoingMsg()) {
-                // There isn't any pending data, our work here is done.
+                // There isn't any pending data, our work here is done, except
+                // for waiting on the completion of zero-copy sends.
 
                 deregisterSocketWrite(self);
+                registerZeroCopyTimer(self);
                 return;                                               // RETURN
             }
 
@@ -1752,6 +2418,28 @@ void Channel::writeCb(ChannelHandle self)
     BSLS_ASSERT(0 && "Unreachable by design");
 }
 
+void Channel::zeroCopyTimeoutCb(ChannelHandle self)
+{
+    BSLS_ASSERT(bslmt::ThreadUtil::isEqual(
+                                  bslmt::ThreadUtil::self(),
+                                  d_eventManager_p->dispatcherThreadHandle()));
+
+    d_zeroCopyTimerId = 0;
+
+    if (isChannelDown(e_CLOSED_SEND_MASK)) {
+        // No callback is invoked once the write part is closed.  The sends
+        // still referenced by the kernel keep this channel (and its socket)
+        // alive through the timer registered below.
+
+        releaseZeroCopySends();
+    }
+    else {
+        processZeroCopyCompletions();
+    }
+
+    registerZeroCopyTimer(self);
+}
+
 // CREATORS
 Channel::Channel(bslma::ManagedPtr<StreamSocket> *socket,
                  int                              channelId,
@@ -1759,6 +2447,7 @@ Channel::Channel(bslma::ManagedPtr<StreamSocket> *socket,
                  const ChannelPoolConfiguration&  config,
                  ChannelType::Value               channelType,
                  bool                             mode,
+                 bool                             isIPv6,
                  ChannelStateChangeCallback       channelCb,
                  BlobBasedReadCallback            blobBasedReadCb,
                  btlb::BlobBufferFactory         *writeBlobBufferPool,
@@ -1784,6 +2473,8 @@ Channel::Channel(bslma::ManagedPtr<StreamSocket> *socket,
 , d_writeCacheLowWat(config.writeCacheLowWatermark())
 , d_writeCacheHiWat(config.writeCacheHiWatermark())
 , d_minIncomingMessageSize(config.minIncomingMessageSize())
+, d_coalesceWritesFlag(config.coalesceWrites())
+, d_coalescingInterval(config.coalescingInterval())
 , d_channelDownFlag(0)
 , d_channelUpFlag(0)
 , d_channelPool_p(channelPool)
@@ -1796,18 +2487,27 @@ Channel::Channel(bslma::ManagedPtr<StreamSocket> *socket,
 , d_recordedMaxWriteCacheSize(0)
 , d_readBlobFactory_p(readBlobBufferPool)
 , d_blobReadData(d_readBlobFactory_p, basicAllocator)
+, d_isIPv6(isIPv6)
 , d_writeBlobFactory_p(writeBlobBufferPool)
 , d_writeActiveDataCurrentBuffer(0)
 , d_writeActiveDataCurrentOffset(0)
 , d_isWriteActive(false)
+, d_isWriteCoalescing(false)
+, d_coalescingGeneration(0)
+, d_coalescingTimerId(0)
 , d_writeActiveCacheSize(0)
+, d_zeroCopyThreshold(0)
+, d_zeroCopyFirstId(0)
+, d_zeroCopySends(basicAllocator)
+, d_zeroCopyBuffers(basicAllocator)
+, d_zeroCopyTimerId(0)
 , d_sharedPtrRepAllocator_p(sharedPtrAllocator)
 , d_allocator_p(basicAllocator)
 {
     BSLS_ASSERT(d_socket);
 
     d_socket->setBlockingMode(btlso::Flag::e_NONBLOCKING_MODE);
-    d_socket->peerAddress(&d_peerAddress);
+    SocketAddressUtil::peerAddress(&d_peerAddress, d_socket.get(), d_isIPv6);
 
 #ifdef BSLS_PLATFORM_OS_UNIX
     // Set close-on-exec flag: this only makes sense in Unix, there is no
@@ -1820,6 +2520,24 @@ Channel::Channel(bslma::ManagedPtr<StreamSocket> *socket,
     BSLS_ASSERT( -1 != ret);
 #endif
 
+#ifdef BTLMT_CHANNELPOOL_ZEROCOPY
+    // Zero-copy sends are only enabled if the kernel accepts 'SO_ZEROCOPY'
+    // for this socket, since 'MSG_ZEROCOPY' is otherwise silently ignored and
+    // no completion would ever be reported.
+
+    if (0 < config.zeroCopyThreshold()) {
+        const int enable = 1;
+
+        if (0 == ::setsockopt(this->socket()->handle(),
+                              SOL_SOCKET,
+                              SO_ZEROCOPY,
+                              &enable,
+                              sizeof enable)) {
+            d_zeroCopyThreshold = config.zeroCopyThreshold();
+        }
+    }
+#endif
+
     d_writeEnqueuedData.createInplace(d_allocator_p,
                                       d_writeBlobFactory_p,
                                       d_allocator_p);
@@ -1844,6 +2562,13 @@ Channel::~Channel()
     // pertaining to this deallocated socket.
 
     BSLS_ASSERT(d_recordedMaxWriteCacheSize >= 0);
+
+    // The zero-copy polling timer holds this channel until the kernel
+    // releases all its zero-copy sends, unless the event manager is being
+    // destroyed.  In either case, the socket is closed before the buffers
+    // retained for these sends are released with 'd_zeroCopyBuffers'.
+
+    d_socket.clear();
 }
 
 // MANIPULATORS
@@ -2025,13 +2750,74 @@ int Channel::writeMessage(const MessageType&   msg,
         BSLS_ASSERT(0 == d_writeActiveDataCurrentBuffer);
         BSLS_ASSERT(0 == d_writeActiveDataCurrentOffset);
 
+        if (d_coalesceWritesFlag) {
+            // Start gathering messages into 'd_writeEnqueuedData' (the
+            // messages written until the flush are appended to it below), and
+            // schedule the flush at the end of the coalescing interval.  This
+            // bounds the latency of every message in the batch.
+
+            BSLS_ASSERT(0 == d_writeEnqueuedData->length());
+
+            d_isWriteCoalescing = true;
+            MessageUtil::appendToBlob(d_writeEnqueuedData.get(), msg);
+
+            const unsigned int generation = ++d_coalescingGeneration;
+
+            oGuard.release()->unlock();
+
+            if (bsls::TimeInterval() == d_coalescingInterval) {
+                bsl::function<void()> flushFunctor(bdlf::BindUtil::bind(
+                                                &Channel::flushCoalescedWrites,
+                                                 this,
+                                                 self,
+                                                 generation));
+
+                d_eventManager_p->execute(flushFunctor);
+                return e_SUCCESS;                                     // RETURN
+            }
+
+            bsl::function<void()> timeoutFunctor(bdlf::BindUtil::bind(
+                                                 &Channel::coalescingTimeoutCb,
+                                                  this,
+                                                  self,
+                                                  generation));
+
+            const bsls::TimeInterval timeout =
+                               bdlt::CurrentTime::now() + d_coalescingInterval;
+
+            void *timerId = d_eventManager_p->registerTimer(timeout,
+                                                            timeoutFunctor);
+
+            // Record the timer so that an early flush of this batch can
+            // deregister it, unless the batch was already flushed (in which
+            // case the timer may have fired, and is ignored if it has not).
+
+            bslmt::LockGuard<bslmt::Mutex> timerGuard(&d_writeMutex);
+
+            if (d_isWriteCoalescing && generation == d_coalescingGeneration) {
+                d_coalescingTimerId = timerId;
+            }
+            return e_SUCCESS;                                         // RETURN
+        }
+
         d_writeActiveCacheSize.addRelaxed(static_cast<int>(dataLength));
 
         oGuard.release()->unlock();
 
-        // Let's first attempt to write the blob directly using iovec.
+        // Let's first attempt to write the blob directly using iovec, unless
+        // it should be sent without copying, which is done only by 'writeCb'
+        // in the dispatcher thread (where the retained buffers are managed).
+
+        int writeRet;
 
-        int writeRet = MessageUtil::write(this->socket(), d_ovecs, msg);
+        if (bsl::is_same<MessageType, btlb::Blob>::value
+         && d_zeroCopyThreshold
+         && d_zeroCopyThreshold <= dataLength) {
+            writeRet = btlso::SocketHandle::e_ERROR_WOULDBLOCK;
+        }
+        else {
+            writeRet = MessageUtil::write(this->socket(), d_ovecs, msg);
+        }
 
         if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 < writeRet)) {
             // 'd_numBytesWritten' is modified only in the 'writeCb' or
@@ -2116,8 +2902,25 @@ int Channel::writeMessage(const MessageType&   msg,
 
     d_writeEnqueuedData->trimLastDataBuffer();
 
+    const int numBuffers = d_writeEnqueuedData->numDataBuffers();
+
     MessageUtil::appendToBlob(d_writeEnqueuedData.get(), msg);
 
+    if (d_isWriteCoalescing
+     && numBuffers < k_MAX_IOVEC_SIZE
+     && k_MAX_IOVEC_SIZE <= d_writeEnqueuedData->numDataBuffers()) {
+        // The gathered messages fill a 'writev': there is no point in waiting
+        // for the end of the coalescing interval.
+
+        bsl::function<void()> flushFunctor(bdlf::BindUtil::bind(
+                                                &Channel::flushCoalescedWrites,
+                                                 this,
+                                                 self,
+                                                 d_coalescingGeneration));
+
+        d_eventManager_p->execute(flushFunctor);
+    }
+
     return e_SUCCESS;
 }
 
@@ -2298,8 +3101,11 @@ void ChannelPool::init()
 
     for (int i = 0; i < maxThread; ++i) {
         TcpTimerEventManager *manager =
-                new (*d_allocator_p) TcpTimerEventManager(d_collectTimeMetrics,
-                                                          d_allocator_p);
+                new (*d_allocator_p) TcpTimerEventManager(
+                                                   d_config.eventManagerType(),
+                                                   d_collectTimeMetrics,
+                                                   false,
+                                                   d_allocator_p);
 
         if (d_startFlag) {
             bslmt::ThreadAttributes attr;
@@ -2425,7 +3231,12 @@ void ChannelPool::acceptCb(int serverId, bsl::shared_ptr<ServerState> server)
         return;                                                       // RETURN
     }
 
-    TcpTimerEventManager *manager = allocateEventManager();
+    // A channel accepted on one of several 'SO_REUSEPORT' listeners stays in
+    // this dispatcher thread: the kernel already balanced the load.
+
+    TcpTimerEventManager *manager = server->d_keepOnManagerFlag
+                                  ? server->d_manager_p
+                                  : allocateEventManager();
     BSLS_ASSERT(manager);
 
     // Reserve location for new channel.  This is so we have a 'newId' to
@@ -2442,6 +3253,7 @@ void ChannelPool::acceptCb(int serverId, bsl::shared_ptr<ServerState> server)
                                                d_config,
                                                ChannelType::e_ACCEPTED_CHANNEL,
                                                server->d_keepHalfOpenMode,
+                                               server->d_isIPv6,
                                                d_channelStateCb,
                                                d_blobBasedReadCb,
                                                d_writeBlobFactory.ptr(),
@@ -2457,23 +3269,28 @@ void ChannelPool::acceptCb(int serverId, bsl::shared_ptr<ServerState> server)
     int rc = d_channels.replace(newId, channelHandle);
     BSLS_ASSERT(0 == rc);
 
-    // Reschedule the acceptTimeoutCb.
+    // Reschedule the acceptTimeoutCb.  The timeout is owned by the server
+    // state held in 'd_acceptors', which must be rescheduled in its own
+    // dispatcher thread.
 
     if (server->d_isTimedFlag) {
-        BSLS_ASSERT(server->d_timeoutTimerId);
-        server->d_manager_p->deregisterTimer(server->d_timeoutTimerId);
+        if (server->d_isPrimaryFlag) {
+            restartAcceptTimeoutCb(serverId, server);
+        }
+        else {
+            bslmt::LockGuard<bslmt::Mutex> aGuard(&d_acceptorsLock);
 
-        bsl::function<void()> acceptTimeoutFunctor(
-                            bdlf::BindUtil::bind(&ChannelPool::acceptTimeoutCb,
-                                                  this,
-                                                  serverId,
-                                                  server));
+            ServerStateMap::iterator idx = d_acceptors.find(serverId);
+            if (!server->d_isClosedFlag && idx != d_acceptors.end()) {
+                bsl::function<void()> restartFunctor(bdlf::BindUtil::bind(
+                                          &ChannelPool::restartAcceptTimeoutCb,
+                                           this,
+                                           serverId,
+                                           idx->second));
 
-        server->d_start = bdlt::CurrentTime::now() + server->d_timeout;
-        server->d_timeoutTimerId = server->d_manager_p->registerTimer(
-                                                         server->d_start,
-                                                         acceptTimeoutFunctor);
-        BSLS_ASSERT(server->d_timeoutTimerId);
+                idx->second->d_manager_p->execute(restartFunctor);
+            }
+        }
     }
 
     bsl::function<void()> invokeChannelUpCommand(
@@ -2556,15 +3373,46 @@ void ChannelPool::acceptTimeoutCb(int                          serverId,
     d_poolStateCb(e_ACCEPT_TIMEOUT, serverId, e_ALERT);
 }
 
-int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
-                        int                         backlog,
-                        int                         serverId,
-                        int                         reuseAddress,
-                        bool                        readEnabledFlag,
-                        KeepHalfOpenMode            mode,
-                        bool                        isTimedFlag,
-                        const bsls::TimeInterval&   timeout,
-                        const btlso::SocketOptions *socketOptions)
+void ChannelPool::restartAcceptTimeoutCb(int                          serverId,
+                                         bsl::shared_ptr<ServerState> server)
+{
+    // Always executed in the event manager's dispatcher thread.
+    BSLS_ASSERT(server->d_isTimedFlag);
+    BSLS_ASSERT(server->d_isPrimaryFlag);
+    BSLS_ASSERT(bslmt::ThreadUtil::isEqual(
+                               bslmt::ThreadUtil::self(),
+                               server->d_manager_p->dispatcherThreadHandle()));
+
+    if (server->d_isClosedFlag) {
+        return;                                                       // RETURN
+    }
+
+    BSLS_ASSERT(server->d_timeoutTimerId);
+    server->d_manager_p->deregisterTimer(server->d_timeoutTimerId);
+
+    bsl::function<void()> acceptTimeoutFunctor(
+                            bdlf::BindUtil::bind(&ChannelPool::acceptTimeoutCb,
+                                                  this,
+                                                  serverId,
+                                                  server));
+
+    server->d_start = bdlt::CurrentTime::now() + server->d_timeout;
+    server->d_timeoutTimerId = server->d_manager_p->registerTimer(
+                                                         server->d_start,
+                                                         acceptTimeoutFunctor);
+    BSLS_ASSERT(server->d_timeoutTimerId);
+}
+
+int ChannelPool::listenImp(const btlso::IPv6Address&   endpoint,
+                           bool                        isIPv6,
+                           int                         backlog,
+                           int                         serverId,
+                           int                         reuseAddress,
+                           bool                        readEnabledFlag,
+                           KeepHalfOpenMode            mode,
+                           bool                        isTimedFlag,
+                           const bsls::TimeInterval&   timeout,
+                           const btlso::SocketOptions *socketOptions)
 {
     enum {
         e_AMBIGUOUS_REUSE_ADDRESS     = -11,
@@ -2595,97 +3443,142 @@ int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
         return e_DUPLICATE_ID;                                        // RETURN
     }
 
-    bsl::shared_ptr<ServerState> server;
-    server.createInplace(d_allocator_p);
-    ServerState *ss = server.get();
-
-    ss->d_socket_p  = 0;                            // must be initialized to 0
-    ss->d_factory_p = &d_factory;
+    // If so configured, open one 'SO_REUSEPORT' listening socket per event
+    // manager, each registered with (and creating channels in) its own
+    // manager.  The first listener is held in 'd_acceptors' and owns the
+    // accept timeout; the others are chained from it through
+    // 'd_nextListener'.
 
-    // The following members are initialized further below:
-    //   - d_endpoint
-    //   - d_manager_p
-
-    ss->d_timeoutTimerId     = 0;
-    ss->d_creationTime       = bdlt::CurrentTime::now();
-    ss->d_start              = ss->d_creationTime;
-    ss->d_timeout            = timeout;
-    ss->d_acceptAgainId      = 0;
-    ss->d_exponentialBackoff = false;
-    ss->d_isClosedFlag       = false;
-    ss->d_isTimedFlag        = isTimedFlag;
-    ss->d_readEnabledFlag    = readEnabledFlag;
-    ss->d_keepHalfOpenMode   = mode;
+#ifdef SO_REUSEPORT
+    const bool reusePort = d_config.reusePortListeners();
+#else
+    const bool reusePort = false;
+#endif
 
-    // Open the server socket: from btlsos_tcptimedcbacceptor.  Upon early
-    // return, destroying the shared ptr 'server' destroys 'ss'.  (In
-    // particular, it will deallocate the socket, which is why it must be set
-    // to 0 above in case we exit before 'ss->d_socket_p = serverSocket'.)
+    const int numListeners = reusePort ? static_cast<int>(d_managers.size())
+                                       : 1;
+
+    bsl::shared_ptr<ServerState>  server;
+    bsl::shared_ptr<ServerState> *nextListener = &server;
+    btlso::IPv6Address            bindAddress(endpoint);
+
+    for (int i = 0; i < numListeners; ++i) {
+        bsl::shared_ptr<ServerState> listener;
+        listener.createInplace(d_allocator_p);
+        ServerState *ss = listener.get();
+
+        ss->d_socket_p  = 0;                        // must be initialized to 0
+        ss->d_factory_p = &d_factory;
+        ss->d_isIPv6    = isIPv6;
+
+        // The following member is initialized further below:
+        //   - d_endpoint
+
+        ss->d_manager_p          = reusePort ? d_managers[i] : 0;
+        ss->d_timeoutTimerId     = 0;
+        ss->d_creationTime       = bdlt::CurrentTime::now();
+        ss->d_start              = ss->d_creationTime;
+        ss->d_timeout            = timeout;
+        ss->d_acceptAgainId      = 0;
+        ss->d_exponentialBackoff = false;
+        ss->d_isClosedFlag       = false;
+        ss->d_isTimedFlag        = isTimedFlag;
+        ss->d_readEnabledFlag    = readEnabledFlag;
+        ss->d_keepHalfOpenMode   = mode;
+        ss->d_isPrimaryFlag      = 0 == i;
+        ss->d_keepOnManagerFlag  = reusePort;
+
+        *nextListener = listener;
+        nextListener  = &ss->d_nextListener;
+
+        // Open the server socket: from btlsos_tcptimedcbacceptor.  Upon early
+        // return, destroying the shared ptr 'server' destroys the chain of
+        // listeners, including 'ss'.  (In particular, it will deallocate the
+        // socket, which is why it must be set to 0 above in case we exit
+        // before 'ss->d_socket_p = serverSocket'.)
+
+        StreamSocket *serverSocket = SocketAddressUtil::allocate(&d_factory,
+                                                                 isIPv6);
+        if (!serverSocket) {
+            return e_ALLOCATE_FAILED;                                 // RETURN
+        }
+        ss->d_socket_p = serverSocket;
 
-    StreamSocket *serverSocket = d_factory.allocate();
-    if (!serverSocket) {
-        return e_ALLOCATE_FAILED;                                     // RETURN
-    }
-    ss->d_socket_p = serverSocket;
+        // From now on, destroying the shared ptr 'server' deallocates
+        // 'serverSocket' (in dtor of 'ss') and also deallocates 'ss'.
 
-    // From now on, destroying the shared ptr 'server' deallocates
-    // 'serverSocket' (in dtor of 'ss') and also deallocates 'ss'.
+        btlso::IPv6Address serverAddress;
+        if (0 != serverSocket->setOption(btlso::SocketOptUtil::k_SOCKETLEVEL,
+                                         btlso::SocketOptUtil::k_REUSEADDRESS,
+                                         !!reuseAddress)) {
+            return e_SET_OPTION_FAILED;                               // RETURN
+        }
 
-    btlso::IPv4Address serverAddress;
-    if (0 != serverSocket->setOption(btlso::SocketOptUtil::k_SOCKETLEVEL,
-                                     btlso::SocketOptUtil::k_REUSEADDRESS,
-                                     !!reuseAddress)) {
-        return e_SET_OPTION_FAILED;                                   // RETURN
-    }
+#ifdef SO_REUSEPORT
+        if (reusePort
+         && 0 != serverSocket->setOption(btlso::SocketOptUtil::k_SOCKETLEVEL,
+                                         btlso::SocketOptUtil::k_REUSEPORT,
+                                         1)) {
+            return e_SET_OPTION_FAILED;                               // RETURN
+        }
+#endif
 
-    if (socketOptions) {
-        const int rc = btlso::SocketOptUtil::setSocketOptions(
+        if (socketOptions) {
+            const int rc = btlso::SocketOptUtil::setSocketOptions(
                                                         serverSocket->handle(),
                                                        *socketOptions);
-        if (rc) {
-            return e_SET_SOCKET_OPTION_FAILED;                        // RETURN
+            if (rc) {
+                return e_SET_SOCKET_OPTION_FAILED;                    // RETURN
+            }
         }
-    }
 
-    if (0 != serverSocket->bind(endpoint)) {
-        return e_BIND_FAILED;                                         // RETURN
-    }
+        // Every listener after the first binds to the address actually bound
+        // by the first, so that an ephemeral port is shared.
 
-    if (0 != serverSocket->localAddress(&serverAddress)) {
-        return e_LOCAL_ADDRESS_FAILED;                                // RETURN
-    }
+        if (0 != SocketAddressUtil::bind(serverSocket, bindAddress, isIPv6)) {
+            return e_BIND_FAILED;                                     // RETURN
+        }
 
-    BSLS_ASSERT(serverAddress.portNumber());
-    ss->d_endpoint = serverAddress;
+        if (0 != SocketAddressUtil::localAddress(&serverAddress,
+                                                 serverSocket,
+                                                 isIPv6)) {
+            return e_LOCAL_ADDRESS_FAILED;                            // RETURN
+        }
 
-    if (0 != serverSocket->listen(backlog)) {
-        return e_LISTEN_FAILED;                                       // RETURN
-    }
+        BSLS_ASSERT(serverAddress.portNumber());
+        ss->d_endpoint = serverAddress;
+        bindAddress    = serverAddress;
+
+        if (0 != serverSocket->listen(backlog)) {
+            return e_LISTEN_FAILED;                                   // RETURN
+        }
 
 #ifndef BTLSO_PLATFORM_WIN_SOCKETS
         // Windows has a bug -- setting listening socket to non-blocking mode
         // will force subsequent 'accept' calls to return WSAEWOULDBLOCK *even
         // when connection is present*.
 
-    if (0 != serverSocket->setBlockingMode(btlso::Flag::e_NONBLOCKING_MODE)) {
-        return e_SET_NONBLOCKING_FAILED;                              // RETURN
-    }
+        if (0 != serverSocket->setBlockingMode(
+                                            btlso::Flag::e_NONBLOCKING_MODE)) {
+            return e_SET_NONBLOCKING_FAILED;                          // RETURN
+        }
 
 #endif
 
 #ifdef BSLS_PLATFORM_OS_UNIX
-    // Set close-on-exec flag: this only makes sense in Unix, there is no
-    // equivalent for Windows.
+        // Set close-on-exec flag: this only makes sense in Unix, there is no
+        // equivalent for Windows.
 
-    int fd    = serverSocket->handle();
-    int flags = fcntl(fd, F_GETFD);
-    int ret   = fcntl(fd, F_SETFD, flags | FD_CLOEXEC);
+        int fd    = serverSocket->handle();
+        int flags = fcntl(fd, F_GETFD);
+        int ret   = fcntl(fd, F_SETFD, flags | FD_CLOEXEC);
 
-    if (-1 == ret) {
-        return e_SET_CLOEXEC_FAILED;                                  // RETURN
-    }
+        if (-1 == ret) {
+            return e_SET_CLOEXEC_FAILED;                              // RETURN
+        }
 
 #endif
+    }
 
     bsl::pair<ServerStateMap::iterator, bool> idx_status =
                                     d_acceptors.insert(bsl::make_pair(serverId,
@@ -2693,28 +3586,41 @@ int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
     idx = idx_status.first;
     BSLS_ASSERT(idx_status.second);
 
-    TcpTimerEventManager *manager = allocateEventManager();
-    BSLS_ASSERT(manager);
-
-    ss->d_manager_p = manager;
+    if (!reusePort) {
+        server->d_manager_p = allocateEventManager();
+    }
 
     // Closely identical to allocateServer, but must execute the pool state
     // callback in the event manager's dispatcher thread.
 
-    bsl::function<void()> acceptFunctor(bdlf::BindUtil::bind(
+    for (bsl::shared_ptr<ServerState> listener = server;
+         listener;
+         listener = listener->d_nextListener) {
+        bsl::function<void()> acceptFunctor(bdlf::BindUtil::bind(
                                                         &ChannelPool::acceptCb,
                                                          this,
                                                          serverId,
-                                                         server));
+                                                         listener));
+
+        if (0 != listener->d_manager_p->registerSocketEvent(
+                                                listener->d_socket_p->handle(),
+                                                btlso::EventType::e_ACCEPT,
+                                                acceptFunctor)) {
+            // Deregister the listeners registered so far.
+
+            for (ServerState *ss = server.get();
+                 ss != listener.get();
+                 ss = ss->d_nextListener.get()) {
+                ss->d_isClosedFlag = 1;
+                ss->d_manager_p->deregisterSocket(ss->d_socket_p->handle());
+            }
 
-    if (0 != manager->registerSocketEvent(serverSocket->handle(),
-                                          btlso::EventType::e_ACCEPT,
-                                          acceptFunctor)) {
-        d_acceptors.erase(idx);
+            d_acceptors.erase(idx);
 
-        aGuard.release()->unlock();
+            aGuard.release()->unlock();
 
-        return e_REGISTER_FAILED;                                     // RETURN
+            return e_REGISTER_FAILED;                                 // RETURN
+        }
     }
 
     if (isTimedFlag) {
@@ -2724,10 +3630,10 @@ int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
                                                   serverId,
                                                   server));
 
-        ss->d_timeoutTimerId = manager->registerTimer(
+        server->d_timeoutTimerId = server->d_manager_p->registerTimer(
                                             bdlt::CurrentTime::now() + timeout,
                                             acceptTimeoutFunctor);
-        BSLS_ASSERT(ss->d_timeoutTimerId);
+        BSLS_ASSERT(server->d_timeoutTimerId);
     }
 
     return e_SUCCESS;
@@ -2747,6 +3653,7 @@ void ChannelPool::connectCb(ConnectorMap::iterator idx)
 
     bool readEnabledFlag = cs.d_readEnabledFlag;
     bool halfOpenMode    = cs.d_keepHalfOpenMode;
+    bool isIPv6          = cs.d_isIPv6;
 
     // The rest is identical to 'importCb', except that we must erase 'idx'
     // from the map of active connectors, and choose a manager for handling the
@@ -2768,7 +3675,8 @@ void ChannelPool::connectCb(ConnectorMap::iterator idx)
              clientId,
              readEnabledFlag,
              halfOpenMode,
-             false);
+             false,
+             isIPv6);
 }
 
 void ChannelPool::connectEventCb(ConnectorMap::iterator idx)
@@ -2856,19 +3764,19 @@ void ChannelPool::connectInitiateCb(ConnectorMap::iterator idx)
 
     bool continueFlag = true;
 
-    if (cs.d_resolutionFlag) {
-        int errorCode;
-        int retCode = btlso::ResolveUtil::getAddress(&cs.d_serverAddress,
-                                                     cs.d_serverName.c_str(),
-                                                     &errorCode);
-        if (retCode) {
-            d_poolStateCb(e_ERROR_CONNECTING, clientId, e_ALERT);
-            continueFlag = false;
-        }
+    if (cs.d_resolutionFlag
+     && 0 != SocketAddressUtil::resolve(&cs.d_serverAddress,
+                                        cs.d_serverName.c_str(),
+                                        cs.d_serverAddress.portNumber(),
+                                        cs.d_isIPv6)) {
+        d_poolStateCb(e_ERROR_CONNECTING, clientId, e_ALERT);
+        continueFlag = false;
     }
 
     if (continueFlag && !cs.d_socket) {
-        StreamSocket *connectionSocket = d_factory.allocate();
+        StreamSocket *connectionSocket = SocketAddressUtil::allocate(
+                                                                  &d_factory,
+                                                                  cs.d_isIPv6);
 
         if (connectionSocket) {
             if (0 == connectionSocket->setBlockingMode(
@@ -2915,7 +3823,9 @@ void ChannelPool::connectInitiateCb(ConnectorMap::iterator idx)
         // If a client address is specified bind to that address.
 
         if (!cs.d_localAddress.isNull()) {
-            const int rc = socket->bind(cs.d_localAddress.value());
+            const int rc = SocketAddressUtil::bind(socket,
+                                                   cs.d_localAddress.value(),
+                                                   cs.d_isIPv6);
 
             if (rc) {
                 d_poolStateCb(e_ERROR_BINDING_CLIENT_ADDR,
@@ -2928,7 +3838,9 @@ void ChannelPool::connectInitiateCb(ConnectorMap::iterator idx)
             }
         }
 
-        int retCode = socket->connect(cs.d_serverAddress);
+        int retCode = SocketAddressUtil::connect(socket,
+                                                 cs.d_serverAddress,
+                                                 cs.d_isIPv6);
 
         if (0 == retCode && 0 == socket->connectionStatus()) {
             // Since we are already in the event manager dispatcher's thread...
@@ -3050,7 +3962,8 @@ void ChannelPool::importCb(StreamSocket                    *socket_p,
                            int                              sourceId,
                            bool                             readEnabledFlag,
                            bool                             mode,
-                           bool                             imported)
+                           bool                             imported,
+                           bool                             isIPv6)
 {
     bslma::ManagedPtr<StreamSocket> socket;
     if (deleter.object() == socket_p) {
@@ -3092,6 +4005,7 @@ void ChannelPool::importCb(StreamSocket                    *socket_p,
                                                d_config,
                                                type,
                                                mode,
+                                               isIPv6,
                                                d_channelStateCb,
                                                d_blobBasedReadCb,
                                                d_writeBlobFactory.ptr(),
@@ -3314,31 +4228,38 @@ int ChannelPool::close(int serverId)
         return e_NOT_FOUND;                                           // RETURN
     }
 
-    ServerState *ss = idx->second.get();
+    // Close every listener of this server (there is more than one only with
+    // 'SO_REUSEPORT' listeners).
 
-    // Safe even if not in the dispatcher thread, because all accesses to idx
-    // (and hence the lifetime of ss) are safeguarded by the acceptors lock.
+    for (ServerState *ss = idx->second.get();
+         ss;
+         ss = ss->d_nextListener.get()) {
+        // Safe even if not in the dispatcher thread, because all accesses to
+        // idx (and hence the lifetime of ss) are safeguarded by the acceptors
+        // lock.
 
-    ss->d_isClosedFlag = 1;
+        ss->d_isClosedFlag = 1;
 
-    // Each call below erases one reference to the shared ptr to the server
-    // state, but the deregisterTimer may not succeed if the callback is
-    // pending or being executed; no matter, callback cannot acquire the lock,
-    // and as soon as this method returns, the flag above will make the
-    // callback exit right away.  Last reference will trigger destruction of
-    // the server state, i.e., deallocation of the server socket.
+        // Each call below erases one reference to the shared ptr to the
+        // server state, but the deregisterTimer may not succeed if the
+        // callback is pending or being executed; no matter, callback cannot
+        // acquire the lock, and as soon as this method returns, the flag
+        // above will make the callback exit right away.  Last reference will
+        // trigger destruction of the server state, i.e., deallocation of the
+        // server socket.
 
-    if (ss->d_timeoutTimerId) {
-        ss->d_manager_p->deregisterTimer(ss->d_timeoutTimerId);
-        ss->d_timeoutTimerId = 0;
-    }
+        if (ss->d_timeoutTimerId) {
+            ss->d_manager_p->deregisterTimer(ss->d_timeoutTimerId);
+            ss->d_timeoutTimerId = 0;
+        }
 
-    if (ss->d_acceptAgainId) {
-        ss->d_manager_p->deregisterTimer(ss->d_acceptAgainId);
-        ss->d_acceptAgainId = 0;
-    }
+        if (ss->d_acceptAgainId) {
+            ss->d_manager_p->deregisterTimer(ss->d_acceptAgainId);
+            ss->d_acceptAgainId = 0;
+        }
 
-    ss->d_manager_p->deregisterSocket(ss->d_socket_p->handle());
+        ss->d_manager_p->deregisterSocket(ss->d_socket_p->handle());
+    }
 
     d_acceptors.erase(idx);
 
@@ -3357,15 +4278,16 @@ int ChannelPool::listen(int                         port,
     btlso::IPv4Address endpoint;
     endpoint.setPortNumber(port);
 
-    return this->listen(endpoint,
-                        backlog,
-                        serverId,
-                        reuseAddress,
-                        readEnabledFlag,
-                        e_CLOSE_BOTH,
-                        e_IS_NOT_TIMED,
-                        bsls::TimeInterval(),
-                        socketOptions);
+    return listenImp(btlso::IPv6Address(endpoint),
+                     false,
+                     backlog,
+                     serverId,
+                     reuseAddress,
+                     readEnabledFlag,
+                     e_CLOSE_BOTH,
+                     e_IS_NOT_TIMED,
+                     bsls::TimeInterval(),
+                     socketOptions);
 }
 
 int ChannelPool::listen(int                         port,
@@ -3381,15 +4303,16 @@ int ChannelPool::listen(int                         port,
     btlso::IPv4Address endpoint;
     endpoint.setPortNumber(port);
 
-    return this->listen(endpoint,
-                        backlog,
-                        serverId,
-                        reuseAddress,
-                        readEnabledFlag,
-                        e_CLOSE_BOTH,
-                        e_IS_TIMED,
-                        timeout,
-                        socketOptions);
+    return listenImp(btlso::IPv6Address(endpoint),
+                     false,
+                     backlog,
+                     serverId,
+                     reuseAddress,
+                     readEnabledFlag,
+                     e_CLOSE_BOTH,
+                     e_IS_TIMED,
+                     timeout,
+                     socketOptions);
 }
 
 int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
@@ -3401,15 +4324,16 @@ int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
 {
     enum { e_IS_NOT_TIMED = 0 };
 
-    return this->listen(endpoint,
-                        backlog,
-                        serverId,
-                        reuseAddress,
-                        readEnabledFlag,
-                        e_CLOSE_BOTH,
-                        e_IS_NOT_TIMED,
-                        bsls::TimeInterval(),
-                        socketOptions);
+    return listenImp(btlso::IPv6Address(endpoint),
+                     false,
+                     backlog,
+                     serverId,
+                     reuseAddress,
+                     readEnabledFlag,
+                     e_CLOSE_BOTH,
+                     e_IS_NOT_TIMED,
+                     bsls::TimeInterval(),
+                     socketOptions);
 }
 
 int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
@@ -3423,15 +4347,60 @@ int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
 {
     enum { e_IS_TIMED = 1 };
 
-    return this->listen(endpoint,
-                        backlog,
-                        serverId,
-                        reuseAddress,
-                        readEnabledFlag,
-                        mode,
-                        e_IS_TIMED,
-                        timeout,
-                        socketOptions);
+    return listenImp(btlso::IPv6Address(endpoint),
+                     false,
+                     backlog,
+                     serverId,
+                     reuseAddress,
+                     readEnabledFlag,
+                     mode,
+                     e_IS_TIMED,
+                     timeout,
+                     socketOptions);
+}
+
+int ChannelPool::listen(const btlso::IPv6Address&   endpoint,
+                        int                         backlog,
+                        int                         serverId,
+                        int                         reuseAddress,
+                        bool                        readEnabledFlag,
+                        const btlso::SocketOptions *socketOptions)
+{
+    enum { e_IS_NOT_TIMED = 0 };
+
+    return listenImp(endpoint,
+                     true,
+                     backlog,
+                     serverId,
+                     reuseAddress,
+                     readEnabledFlag,
+                     e_CLOSE_BOTH,
+                     e_IS_NOT_TIMED,
+                     bsls::TimeInterval(),
+                     socketOptions);
+}
+
+int ChannelPool::listen(const btlso::IPv6Address&   endpoint,
+                        int                         backlog,
+                        int                         serverId,
+                        const bsls::TimeInterval&   timeout,
+                        int                         reuseAddress,
+                        bool                        readEnabledFlag,
+                        KeepHalfOpenMode            mode,
+                        const btlso::SocketOptions *socketOptions)
+{
+    enum { e_IS_TIMED = 1 };
+
+    return listenImp(endpoint,
+                     true,
+                     backlog,
+                     serverId,
+                     reuseAddress,
+                     readEnabledFlag,
+                     mode,
+                     e_IS_TIMED,
+                     timeout,
+                     socketOptions);
 }
 
                          // *** Client-related section
@@ -3463,6 +4432,7 @@ int ChannelPool::connect(
                       sourceId,
                       socket,
                       resolutionMode,
+                      false,
                       readEnabledFlag,
                       halfCloseMode,
                       0,
@@ -3487,7 +4457,8 @@ int ChannelPool::connect(
         return e_SET_NONBLOCKING_FAILED;                              // RETURN
     }
 
-    return connectImp(serverAddress,
+    return connectImp(btlso::IPv6Address(serverAddress),
+                      false,
                       numAttempts,
                       interval,
                       sourceId,
@@ -3507,12 +4478,15 @@ int ChannelPool::connectImp(
                     bslma::ManagedPtr<btlso::StreamSocket<btlso::IPv4Address> >
                                                *socket,
                     ConnectResolutionMode       resolutionMode,
+                    bool                        isIPv6,
                     bool                        readEnabledFlag,
                     KeepHalfOpenMode            keepHalfOpenMode,
                     const btlso::SocketOptions *socketOptions,
-                    const btlso::IPv4Address   *localAddress)
+                    const btlso::IPv6Address   *localAddress)
 {
     BSLS_ASSERT(0 == socketOptions || (0 == socket && 0 == localAddress));
+    BSLS_ASSERT(!isIPv6 || 0 == socket);
+    BSLS_ASSERT(isIPv6 || 0 == localAddress || localAddress->isIPv4Mapped());
 
     if (!d_startFlag) {
         return e_NOT_RUNNING;                                         // RETURN
@@ -3528,20 +4502,21 @@ int ChannelPool::connectImp(
     TcpTimerEventManager *manager = allocateEventManager();
     BSLS_ASSERT(manager);
 
-    btlso::IPv4Address serverAddress;
+    btlso::IPv6Address serverAddress;
     bool               resolutionFlag;
 
     if (e_RESOLVE_ONCE == resolutionMode) {
-        int errorCode = 0;
-        if (btlso::ResolveUtil::getAddress(&serverAddress,
-                                           serverName,
-                                           &errorCode)) {
+        if (0 != SocketAddressUtil::resolve(&serverAddress,
+                                            serverName,
+                                            portNumber,
+                                            isIPv6)) {
             return e_FAILED_RESOLUTION;                               // RETURN
         }
         resolutionFlag = false;
     }
     else {
         BSLS_ASSERT(e_RESOLVE_AT_EACH_ATTEMPT == resolutionMode);
+        serverAddress.setPortNumber(portNumber);
         resolutionFlag = true;
     }
 
@@ -3553,23 +4528,24 @@ int ChannelPool::connectImp(
     }
 
     bsl::pair<ConnectorMap::iterator,bool> idx_status =
-                 d_connectors.insert(bsl::make_pair(clientId,
-                                                    Connector(socket_sp,
-                                                              manager,
-                                                              numAttempts,
-                                                              interval,
-                                                              readEnabledFlag,
-                                                              keepHalfOpenMode,
-                                                              socketOptions,
-                                                              localAddress)));
+                 d_connectors.insert(bsl::make_pair(
+                                       clientId,
+                                       Connector(socket_sp,
+                                                 manager,
+                                                 numAttempts,
+                                                 interval,
+                                                 readEnabledFlag,
+                                                 keepHalfOpenMode,
+                                                 socketOptions,
+                                                 localAddress)));
     idx = idx_status.first;
     BSLS_ASSERT(idx_status.second);
 
     Connector& cs = idx->second;
 
     cs.d_serverName     = serverName;
-    cs.d_serverAddress  = serverAddress;
-    cs.d_serverAddress.setPortNumber(portNumber);  // never overwritten
+    cs.d_serverAddress  = serverAddress;     // port number never overwritten
+    cs.d_isIPv6         = isIPv6;
     cs.d_resolutionFlag = resolutionFlag;
 
     cGuard.release()->unlock();
@@ -3585,7 +4561,8 @@ int ChannelPool::connectImp(
 }
 
 int ChannelPool::connectImp(
-                    const btlso::IPv4Address&   server,
+                    const btlso::IPv6Address&   server,
+                    bool                        isIPv6,
                     int                         numAttempts,
                     const bsls::TimeInterval&   interval,
                     int                         clientId,
@@ -3594,9 +4571,10 @@ int ChannelPool::connectImp(
                     bool                        readEnabledFlag,
                     KeepHalfOpenMode            mode,
                     const btlso::SocketOptions *socketOptions,
-                    const btlso::IPv4Address   *localAddress)
+                    const btlso::IPv6Address   *localAddress)
 {
     BSLS_ASSERT(0 == socketOptions || 0 == socket);
+    BSLS_ASSERT(!isIPv6 || 0 == socket);
 
     if (!d_startFlag) {
         return e_NOT_RUNNING;                                         // RETURN
@@ -3632,6 +4610,7 @@ int ChannelPool::connectImp(
     idx = idx_status.first;
     BSLS_ASSERT(idx_status.second);
     idx->second.d_serverAddress = server;
+    idx->second.d_isIPv6        = isIPv6;
 
     cGuard.release()->unlock();
 
@@ -3729,7 +4708,8 @@ int ChannelPool::import(
                                                          sourceId,
                                                          readEnabledFlag,
                                                          mode,
-                                                         true));
+                                                         true,
+                                                         false));
 
     manager->execute(importFunctor);
     return e_SUCCESS;
@@ -4319,8 +5299,12 @@ void *ChannelPool::channelContext(int channelId) const
 bsl::shared_ptr<const btlso::StreamSocket<btlso::IPv4Address> >
 ChannelPool::streamSocket(int channelId) const
 {
+    // The socket of an IPv6 channel is not a stream socket over IPv4
+    // addresses, so it is not handed out.
+
     ChannelHandle channelHandle;
-    if (0 == findChannelHandle(&channelHandle, channelId)) {
+    if (0 == findChannelHandle(&channelHandle, channelId)
+     && !channelHandle->isIPv6()) {
         bsl::shared_ptr<const btlso::StreamSocket<btlso::IPv4Address> >
                                                   ptr(channelHandle,
                                                       channelHandle->socket());
@@ -4464,6 +5448,20 @@ ChannelPool::getServerAddress(btlso::IPv4Address *result,
         return -1;                                                    // RETURN
     }
 
+    return idx->second->d_endpoint.loadIPv4Address(result);
+}
+
+int
+ChannelPool::getServerAddress(btlso::IPv6Address *result,
+                              int                 serverId) const
+{
+    bslmt::LockGuard<bslmt::Mutex> aGuard(&d_acceptorsLock);
+
+    ServerStateMap::const_iterator idx = d_acceptors.find(serverId);
+    if (idx == d_acceptors.end()) {
+        return -1;                                                    // RETURN
+    }
+
     *result = idx->second->d_endpoint;
     return 0;
 }
@@ -4479,7 +5477,31 @@ ChannelPool::getLocalAddress(btlso::IPv4Address *result,
         return -1;                                                    // RETURN
     }
 
-    return channelHandle->socket()->localAddress(result);
+    btlso::IPv6Address address;
+    const int rc = SocketAddressUtil::localAddress(&address,
+                                                   channelHandle->socket(),
+                                                   channelHandle->isIPv6());
+    if (rc) {
+        return rc;                                                    // RETURN
+    }
+
+    return address.loadIPv4Address(result);
+}
+
+int
+ChannelPool::getLocalAddress(btlso::IPv6Address *result,
+                             int                 channelId) const
+{
+    BSLS_ASSERT(result);
+
+    ChannelHandle channelHandle;
+    if (0 != findChannelHandle(&channelHandle, channelId)) {
+        return -1;                                                    // RETURN
+    }
+
+    return SocketAddressUtil::localAddress(result,
+                                           channelHandle->socket(),
+                                           channelHandle->isIPv6());
 }
 
 int
@@ -4488,6 +5510,20 @@ ChannelPool::getPeerAddress(btlso::IPv4Address *result,
 {
     BSLS_ASSERT(result);
 
+    ChannelHandle channelHandle;
+    if (0 == findChannelHandle(&channelHandle, channelId)
+     && 0 == channelHandle->peerAddress().loadIPv4Address(result)) {
+        return 0;                                                     // RETURN
+    }
+    return 1;
+}
+
+int
+ChannelPool::getPeerAddress(btlso::IPv6Address *result,
+                            int                 channelId) const
+{
+    BSLS_ASSERT(result);
+
     ChannelHandle channelHandle;
     if (0 == findChannelHandle(&channelHandle, channelId)) {
         *result = channelHandle->peerAddress();
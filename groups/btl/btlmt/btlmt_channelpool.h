@@ -72,6 +72,26 @@ BSLS_IDENT("$Id: $")
 // to only two outcomes -- success or failure.  In particular, it can't be
 // canceled.
 //
+///IPv6 Support
+///------------
+// Both 'listen' and 'connect' have overloads taking a 'btlso::IPv6Address',
+// which establish the listening or connecting socket (and hence the channels
+// created from it) in the IPv6 address family.  An IPv6 listening socket
+// bound to the unspecified address '::' also accepts IPv4 connections (unless
+// the 'IPV6_V6ONLY' option is set, e.g., system-wide), whose peers are then
+// reported as IPv4-mapped IPv6 addresses.  The address accessors
+// ('getServerAddress', 'getLocalAddress', and 'getPeerAddress') have overloads
+// for both address types: the IPv6 overloads report the addresses of IPv4
+// servers and channels in their IPv4-mapped form, and the IPv4 overloads fail
+// for IPv6 servers and channels unless their address is IPv4-mapped.
+// 'streamSocket', whose result is typed for IPv4 addresses, returns an empty
+// pointer for IPv6 channels.  The 'connect' overloads taking a host name
+// resolve it to an IPv4 address, and connect from an IPv4 socket, unless they
+// are passed the 'e_CONNECT_DUAL_STACK' address family: the host name is then
+// resolved to its most preferred IPv6 or (IPv4-mapped) IPv4 address, and the
+// connection is made from an IPv6 socket, so that a peer reachable only over
+// IPv6 can be connected to by name.
+//
 ///Half-Open Connections
 ///---------------------
 // It is already possible to import a half-duplex connection into a channel
@@ -133,6 +153,91 @@ BSLS_IDENT("$Id: $")
 // processes, which may potentially outlive the lifetime of the channel pool,
 // preventing the channel's socket files from being closed properly.
 //
+///Per-Thread Listening Sockets
+///----------------------------
+// By default, 'listen' opens a single listening socket that is serviced by one
+// of the managed threads, and each accepted connection is handed to the least
+// loaded managed thread.  Under a burst of incoming connections the thread
+// servicing the listening socket can become a bottleneck.  If the
+// 'reusePortListeners' attribute of the 'btlmt::ChannelPoolConfiguration'
+// supplied at construction is 'true', and the platform supports
+// 'SO_REUSEPORT', 'listen' instead opens one listening socket per managed
+// thread, all bound to the same endpoint with 'SO_REUSEPORT'.  The operating
+// system then distributes incoming connections across these sockets, and each
+// accepted channel is managed by the thread that accepted it.  All the
+// listening sockets of a server share its 'serverId', and 'close' closes them
+// all.  If 'listen' is given a timeout, the timeout is tracked across all the
+// listening sockets of the server (i.e., a connection accepted on any of them
+// restarts it).
+//
+///Socket Event Manager
+///--------------------
+// Each managed thread of a channel pool is a 'btlmt::TcpTimerEventManager'
+// that monitors its sockets with a socket event manager.  The
+// 'eventManagerType' attribute of 'btlmt::ChannelPoolConfiguration' selects
+// which one is used; for example, 'btlmt::EventManagerType::e_FLAT_EPOLL'
+// selects an 'epoll'-based event manager that indexes its registrations by
+// socket handle and is intended for threads managing many channels, and
+// 'btlmt::EventManagerType::e_IO_URING' selects an 'io_uring'-based one,
+// which submits the poll requests of a thread in batches.  Whatever the socket
+// event manager, channels read and write their sockets with 'readv' and
+// 'writev' once they are reported ready.  A type that is not supported on the
+// current platform (e.g., 'e_IO_URING' on a kernel without 'io_uring') is
+// replaced by the default socket event manager, which is 'epoll'-based on
+// Linux.
+//
+///Write Coalescing
+///----------------
+// By default, a message written to a channel with no pending data is written
+// right away from the calling thread, so that many small messages written to
+// the same channel result in as many 'writev' system calls.  Setting the
+// 'coalesceWrites' attribute of 'btlmt::ChannelPoolConfiguration' instead
+// gathers such messages: the first message written to a channel with no
+// pending data starts a batch, which collects all the messages written to
+// that channel until the 'coalescingInterval' attribute has elapsed (or, if
+// that interval is 0, until the next iteration of the dispatcher thread of
+// the channel).  The batch is then written from the dispatcher thread with as
+// few 'writev' calls (of up to 'IOV_MAX' buffers each) as possible.  A batch
+// is written early if it fills a single 'writev' call.
+//
+// Since the end of a batch is scheduled when its first message is written, no
+// message is delayed by more than 'coalescingInterval' (in addition to the
+// latency of the dispatcher thread).  Note that this is independent of, and
+// does not enable, Nagle's algorithm on the underlying socket.
+//
+///Zero-Copy Writes
+///----------------
+// On Linux, a channel pool can send large blob messages without copying their
+// data into the kernel (using 'MSG_ZEROCOPY'), which is enabled by setting the
+// 'zeroCopyThreshold' attribute of 'btlmt::ChannelPoolConfiguration' to a
+// positive value.  Whenever at least that many bytes are ready to be sent on
+// a channel in a single system call, they are sent without copying, and the
+// channel retains (shares ownership of) the blob buffers holding them until
+// the kernel reports that it no longer references them.  A blob passed to
+// 'write' that is at least as large as the threshold is always sent from the
+// dispatcher thread of the channel, rather than from the calling thread.
+//
+// Each time some retained buffers are released, the channel state callback is
+// invoked with 'e_ZERO_COPY_COMPLETE' in the dispatcher thread of the channel.
+// Clients can therefore rely on the memory of the blob buffers (when supplied
+// by a factory under their control) not being read by the kernel after the
+// last buffer they wrote is released.  Note that the buffers still retained
+// when the channel shuts down are released without further notification: the
+// channel keeps polling for the completion of their sends in its dispatcher
+// thread, and its socket is closed (normally, so that the peer receives all
+// the data) only once the kernel no longer references any of them.  Also
+// note that a peer that stops reading therefore delays the closing of the
+// socket and the release of the retained buffers, and that destroying the
+// channel pool closes the sockets of all its channels regardless.
+//
+// Zero-copy writes are only beneficial for large messages (typically of at
+// least tens of kilobytes), since the kernel must pin the pages of the data
+// and notify their release.  They are silently disabled on platforms that do
+// not support 'MSG_ZEROCOPY', and for sockets that reject the 'SO_ZEROCOPY'
+// option.  Also note that zero-copy writes bypass the 'writev' method of the
+// underlying stream socket, and must not be enabled for channels whose
+// sockets (e.g., imported ones) transform the data they write.
+//
 ///Metrics and Capacity
 ///--------------------
 // By default, the channel pool monitors the workload of managed event managers
@@ -558,6 +663,10 @@ BSLS_IDENT("$Id: $")
 #include <btlso_inetstreamsocketfactory.h>
 #endif
 
+#ifndef INCLUDED_BTLSO_IPV6ADDRESS
+#include <btlso_ipv6address.h>
+#endif
+
 #ifndef INCLUDED_BTLSO_SOCKETHANDLE
 #include <btlso_sockethandle.h>
 #endif
@@ -792,7 +901,8 @@ class ChannelPool {
         e_WRITE_CACHE_LOWWAT   = 7,
         e_WRITE_CACHE_HIWAT    = e_WRITE_BUFFER_FULL,
         e_CHANNEL_DOWN_READ    = 8,
-        e_CHANNEL_DOWN_WRITE   = 9
+        e_CHANNEL_DOWN_WRITE   = 9,
+        e_ZERO_COPY_COMPLETE   = 10   // see "Zero-Copy Writes"
 
 
     };
@@ -820,6 +930,18 @@ class ChannelPool {
                                             // connect attempt
     };
 
+    enum ConnectAddressFamily {
+        // Address family in which 'connect' resolves a host name and opens
+        // the connecting socket (see {IPv6 Support}).
+
+        e_CONNECT_IPV4                = 0,  // resolve to an IPv4 address, and
+                                            // connect from an IPv4 socket
+
+        e_CONNECT_DUAL_STACK          = 1   // resolve to an IPv6 or an
+                                            // (IPv4-mapped) IPv4 address, and
+                                            // connect from an IPv6 socket
+    };
+
     enum KeepHalfOpenMode {
         // Mode affecting how half-open connections are handled by a server or
         // a client channel, passed to 'connect', 'import' or 'listen'.
@@ -1031,20 +1153,31 @@ class ChannelPool {
         // server state since the last server connection or last timeout
         // callback.
 
-    int listen(const btlso::IPv4Address&   endpoint,
-               int                         backlog,
-               int                         serverId,
-               int                         reuseAddress,
-               bool                        readEnabledFlag,
-               KeepHalfOpenMode            mode,
-               bool                        isTimedFlag,
-               const bsls::TimeInterval&   timeout = bsls::TimeInterval(),
-               const btlso::SocketOptions *socketOptions = 0);
+    void restartAcceptTimeoutCb(int serverId, ServerHandle server);
+        // Re-schedule the 'acceptTimeoutCb' of the server whose ID is the
+        // specified 'serverId', held in the specified 'server' state, to
+        // expire one timeout period from now.  This callback is executed in
+        // the dispatcher thread of the event manager of 'server' when a
+        // connection is accepted on another 'SO_REUSEPORT' listening socket
+        // of the same server.
+
+    int listenImp(const btlso::IPv6Address&   endpoint,
+                  bool                        isIPv6,
+                  int                         backlog,
+                  int                         serverId,
+                  int                         reuseAddress,
+                  bool                        readEnabledFlag,
+                  KeepHalfOpenMode            mode,
+                  bool                        isTimedFlag,
+                  const bsls::TimeInterval&   timeout = bsls::TimeInterval(),
+                  const btlso::SocketOptions *socketOptions = 0);
         // Establish a listening socket having the specified 'backlog' maximum
         // number of pending connections on the specified 'endpoint' and the
         // specified 'reuseAddress' used in setting 'e_REUSEADDRESS' socket
         // option, and associate this newly established socket with the
-        // specified 'serverId'.  If the specified 'readEnabledFlag' is
+        // specified 'serverId'.  Open an IPv6 socket if the specified 'isIPv6'
+        // is 'true', and an IPv4 socket bound to the IPv4-mapped 'endpoint'
+        // otherwise.  If the specified 'readEnabledFlag' is
         // non-zero, any channel created by 'acceptCb' will be enabled for read
         // upon creation, and otherwise it will not.  If the specified
         // 'isTimedFlag' is non-zero, register a timer which will execute
@@ -1056,7 +1189,10 @@ class ChannelPool {
         // 0 on success, a positive value if there is a listening socket
         // associated with 'serverId' (i.e., 'serverId' is not unique) and a
         // negative value if an error occurred.  The behavior is undefined
-        // unless '0 < backlog'.
+        // unless '0 < backlog'.  Note that if the configuration of this pool
+        // has 'reusePortListeners' set and 'SO_REUSEPORT' is supported, one
+        // listening socket is established per event manager of this pool, all
+        // associated with 'serverId'.
 
                                   // *** Client part ***
 
@@ -1097,7 +1233,8 @@ class ChannelPool {
         // 'connectInitiateCb' or through a 'connectEventCb' after the last
         // 'connectInitiateCb'.
 
-    int connectImp(const btlso::IPv4Address&   serverAddress,
+    int connectImp(const btlso::IPv6Address&   serverAddress,
+                   bool                        isIPv6,
                    int                         numAttempts,
                    const bsls::TimeInterval&   interval,
                    int                         sourceId,
@@ -1106,9 +1243,12 @@ class ChannelPool {
                    bool                        readEnabledFlag,
                    KeepHalfOpenMode            mode,
                    const btlso::SocketOptions *socketOptions,
-                   const btlso::IPv4Address   *localAddress);
+                   const btlso::IPv6Address   *localAddress);
         // Asynchronously issue up to the specified 'numAttempts' connection
-        // requests to a server at the specified 'serverAddress', with at least
+        // requests to a server at the specified 'serverAddress', using an IPv6
+        // socket if the specified 'isIPv6' is 'true' and an IPv4 socket
+        // connecting to the IPv4-mapped 'serverAddress' (and binding to the
+        // IPv4-mapped 'localAddress', if any) otherwise, with at least
         // the specified (relative) time 'interval' after each attempt before
         // either a new connection is retried (if 'numAttempts' is not reached)
         // or the connection attempts are abandoned (if 'numAttempts' is
@@ -1146,13 +1286,17 @@ class ChannelPool {
                    bslma::ManagedPtr<btlso::StreamSocket<btlso::IPv4Address> >
                                               *socket,
                    ConnectResolutionMode       resolutionMode,
+                   bool                        isIPv6,
                    bool                        readEnabledFlag,
                    KeepHalfOpenMode            halfCloseMode,
                    const btlso::SocketOptions *socketOptions,
-                   const btlso::IPv4Address   *localAddress);
+                   const btlso::IPv6Address   *localAddress);
         // Asynchronously issue up to the specified 'numAttempts' connection
         // requests to a server at the address resolved from the specified
-        // 'hostname' on the specified 'portNumber', with at least the
+        // 'hostname' on the specified 'portNumber', using an IPv6 socket and
+        // a dual-stack resolution if the specified 'isIPv6' is 'true', and an
+        // IPv4 socket, an IPv4 resolution, and the IPv4-mapped
+        // 'localAddress', if any, otherwise, with at least the
         // specified (relative) time 'interval' after each attempt before
         // either a new connection is retried (if 'numAttempts' is not reached)
         // or the connection attempts are abandoned (if 'numAttempts' is
@@ -1183,8 +1327,10 @@ class ChannelPool {
         // connection either succeeds, fails, or times out), or a negative
         // value if an error occurred, with the value of -1 indicating that the
         // channel pool is not running.  The behavior is undefined unless
-        // '0 < numAttempts', '0 < interval || 1 == numAttempts', and
-        // '0 == socketOptions || (0 == socket && 0 == localAddress)'
+        // '0 < numAttempts', '0 < interval || 1 == numAttempts',
+        // '0 == socketOptions || (0 == socket && 0 == localAddress)',
+        // '!isIPv6 || 0 == socket', and either 'isIPv6', or
+        // '0 == localAddress', or 'localAddress' is IPv4-mapped.
 
                                   // *** Channel management part ***
     void importCb(btlso::StreamSocket<btlso::IPv4Address> *socket,
@@ -1194,16 +1340,18 @@ class ChannelPool {
                   int                                      sourceId,
                   bool                                     readEnabledFlag,
                   bool                                     mode,
-                  bool                                     imported);
+                  bool                                     imported,
+                  bool                                     isIPv6);
         // Add a newly allocated channel to the set of channels managed by this
         // channel pool and invoke the channel pool callback in the specified
         // 'manager'.  Upon destruction, 'socket' will be destroyed via the
-        // specified 'factory'.  Note that this method is executed whenever a
-        // connection is imported on the 'socket' corresponding to 'sourceId'.
-        // In addition, it is invoked by 'connectCb' to create a newly
-        // allocated channel once the socket connection is established.  This
-        // function should be executed in the dispatcher thread of the
-        // specified 'srcManager'.
+        // specified 'factory'.  The specified 'isIPv6' indicates whether
+        // 'socket' is an IPv6 (rather than IPv4) socket.  Note that this
+        // method is executed whenever a connection is imported on the 'socket'
+        // corresponding to 'sourceId'.  In addition, it is invoked by
+        // 'connectCb' to create a newly allocated channel once the socket
+        // connection is established.  This function should be executed in the
+        // dispatcher thread of the specified 'srcManager'.
 
                                   // *** Clock management ***
 
@@ -1309,16 +1457,32 @@ class ChannelPool {
                bool                        readEnabledFlag = true,
                KeepHalfOpenMode            mode = e_CLOSE_BOTH,
                const btlso::SocketOptions *socketOptions = 0);
+    int listen(const btlso::IPv6Address&   endpoint,
+               int                         backlog,
+               int                         serverId,
+               int                         reuseAddress = 1,
+               bool                        readEnabledFlag = true,
+               const btlso::SocketOptions *socketOptions = 0);
+    int listen(const btlso::IPv6Address&   endpoint,
+               int                         backlog,
+               int                         serverId,
+               const bsls::TimeInterval&   timeout,
+               int                         reuseAddress = 1,
+               bool                        readEnabledFlag = true,
+               KeepHalfOpenMode            mode = e_CLOSE_BOTH,
+               const btlso::SocketOptions *socketOptions = 0);
         // Establish a listening socket having the specified 'backlog' maximum
         // number of pending connections on the specified 'portNumber' on all
         // local interfaces or the specified 'endpoint', depending on which
         // overload of 'listen' is used, and associate this newly established
-        // socket with the specified 'serverId'.  Optionally, specify a
-        // 'timeout' *duration* for accepting a connection.  If no connection
-        // attempt is received for a period of 'timeout' since the last
-        // connection or the last timeout, a pool state callback is invoked
-        // with event equal to 'e_ACCEPT_TIMEOUT'.  Optionally specify a
-        // 'reuseAddress' value to be used in setting 'e_REUSEADDRESS' socket
+        // socket with the specified 'serverId'.  If 'endpoint' is a
+        // 'btlso::IPv6Address', the listening socket is an IPv6 socket (see
+        // {IPv6 Support}), and otherwise it is an IPv4 socket.  Optionally,
+        // specify a 'timeout' *duration* for accepting a connection.  If no
+        // connection attempt is received for a period of 'timeout' since the
+        // last connection or the last timeout, a pool state callback is
+        // invoked with event equal to 'e_ACCEPT_TIMEOUT'.  Optionally specify
+        // a 'reuseAddress' value to be used in setting 'e_REUSEADDRESS' socket
         // option; if 'reuseAddress' is not specified, 1 is used (i.e.,
         // 'e_REUSEADDRESS' is enabled).  Optionally specify via a
         // 'readEnabledFlag' whether automatic reading should be enabled on
@@ -1337,7 +1501,10 @@ class ChannelPool {
         // Every time a connection is accepted by this pool on this (newly
         // established) listening socket, 'serverId' is passed to the callback
         // provided in the configuration at construction.  The behavior is
-        // undefined unless '0 < backlog'.
+        // undefined unless '0 < backlog'.  Note that if the configuration
+        // supplied at construction has 'reusePortListeners' set, one listening
+        // socket per managed thread may be established for 'serverId' (see
+        // {Per-Thread Listening Sockets}).
 
                                   // *** Client part ***
 
@@ -1412,6 +1579,39 @@ class ChannelPool {
         // of this function call, that is, 'hostname' need not remain valid
         // until the last connection attempt but can be deleted upon return.
 
+    int connect(const char                 *hostname,
+                int                         portNumber,
+                ConnectAddressFamily        addressFamily,
+                int                         numAttempts,
+                const bsls::TimeInterval&   interval,
+                int                         sourceId,
+                ConnectResolutionMode       resolutionMode = e_RESOLVE_ONCE,
+                bool                        readEnabledFlag = true,
+                KeepHalfOpenMode            halfCloseMode = e_CLOSE_BOTH,
+                const btlso::SocketOptions *socketOptions = 0,
+                const btlso::IPv6Address   *localAddress = 0);
+        // Asynchronously issue up to the specified 'numAttempts' connection
+        // requests to a server at the address resolved from the specified
+        // 'hostname' on the specified 'portNumber' in the specified
+        // 'addressFamily' (see {IPv6 Support}), with at least the specified
+        // (relative) time 'interval' after each attempt before either a new
+        // connection is retried (if 'numAttempts' is not reached) or the
+        // connection attempts are abandoned (if 'numAttempts' is reached).
+        // When the connection is established, an internal channel is created
+        // and a channel state callback, with the event 'e_CHANNEL_UP', the
+        // newly created channel ID, and the specified 'sourceId' is invoked
+        // in an internal thread.  Optionally specify 'resolutionMode',
+        // 'readEnabledFlag', 'halfCloseMode', 'socketOptions', and
+        // 'localAddress' having the same meaning as for the 'connect'
+        // overload taking a host name and a 'btlso::IPv4Address' local
+        // address.  Return 0 on successful initiation, a positive value if
+        // there is an active connection attempt with the same 'sourceId', or
+        // a negative value if an error occurred, with the value of -1
+        // indicating that the channel pool is not running.  The behavior is
+        // undefined unless '0 < numAttempts', either '0 < interval' or
+        // '1 == numAttempts' or both, and, if 'addressFamily' is
+        // 'e_CONNECT_IPV4', 'localAddress' is 0 or IPv4-mapped.
+
     int connect(const btlso::IPv4Address&   serverAddress,
                 int                         numAttempts,
                 const bsls::TimeInterval&   interval,
@@ -1468,6 +1668,33 @@ class ChannelPool {
         // can be used in several calls to 'connect' or 'import' as long as two
         // calls to connect with the same 'sourceId' do not overlap.
 
+    int connect(const btlso::IPv6Address&   serverAddress,
+                int                         numAttempts,
+                const bsls::TimeInterval&   interval,
+                int                         sourceId,
+                bool                        readEnabledFlag = true,
+                KeepHalfOpenMode            mode = e_CLOSE_BOTH,
+                const btlso::SocketOptions *socketOptions = 0,
+                const btlso::IPv6Address   *localAddress = 0);
+        // Asynchronously issue up to the specified 'numAttempts' connection
+        // requests from an IPv6 socket to a server at the specified
+        // 'serverAddress' (see {IPv6 Support}), with at least the specified
+        // (relative) time 'interval' after each attempt before either a new
+        // connection is retried (if 'numAttempts' is not reached) or the
+        // connection attempts are abandoned (if 'numAttempts' is reached).
+        // When the connection is established, an internal channel is created
+        // and a channel state callback, with the event 'e_CHANNEL_UP', the
+        // newly created channel ID, and the specified 'sourceId' is invoked
+        // in an internal thread.  Optionally specify 'readEnabledFlag',
+        // 'mode', 'socketOptions', and 'localAddress' having the same meaning
+        // as for the 'connect' overload taking a 'btlso::IPv4Address'.
+        // Return 0 on successful initiation, a positive value if there is an
+        // active connection attempt with the same 'sourceId', or a negative
+        // value if an error occurred, with the value of -1 indicating that the
+        // channel pool is not running.  The behavior is undefined unless
+        // '0 < numAttempts', and either '0 < interval' or '1 == numAttempts'
+        // or both.
+
                                   // *** Channel management ***
 
     int disableRead(int channelId);
@@ -1856,22 +2083,34 @@ class ChannelPool {
         // clear this vector prior to calling this function if desired.
 
     int getServerAddress(btlso::IPv4Address *result, int serverId) const;
+    int getServerAddress(btlso::IPv6Address *result, int serverId) const;
         // Load into the specified 'result' the complete IP address associated
         // with the server with the specified 'serverId' that is managed by
         // this channel pool if the server is established.  Return 0 on
         // success, and a non-zero value with no effect on 'result' otherwise.
+        // Note that loading a 'btlso::IPv4Address' fails for an IPv6 server
+        // unless its address is IPv4-mapped, and that a 'btlso::IPv6Address'
+        // is loaded with the IPv4-mapped address of an IPv4 server.
 
     int getLocalAddress(btlso::IPv4Address *result, int channelId) const;
+    int getLocalAddress(btlso::IPv6Address *result, int channelId) const;
         // Load into the specified 'result' the complete IP address associated
         // with the local (i.e., this process) end-point of the communication
         // channel having the specified 'channelId'.  Return 0 on success, and
-        // a non-zero value with no effect on 'result' otherwise.
+        // a non-zero value with no effect on 'result' otherwise.  Note that
+        // loading a 'btlso::IPv4Address' fails for an IPv6 channel unless
+        // its local address is IPv4-mapped, and that a 'btlso::IPv6Address'
+        // is loaded with the IPv4-mapped address of an IPv4 channel.
 
     int getPeerAddress(btlso::IPv4Address *result, int channelId) const;
+    int getPeerAddress(btlso::IPv6Address *result, int channelId) const;
         // Load into the specified 'result' the complete IP address associated
         // with the remote (i.e., peer process) end-point of the communication
         // channel having the specified 'channelId'.  Return 0 on success, and
-        // a non-zero value with no effect on 'result' otherwise.
+        // a non-zero value with no effect on 'result' otherwise.  Note that
+        // loading a 'btlso::IPv4Address' fails for an IPv6 channel unless
+        // its peer address is IPv4-mapped, and that a 'btlso::IPv6Address'
+        // is loaded with the IPv4-mapped address of an IPv4 channel.
 
     int numBytesRead(bsls::Types::Int64 *result, int channelId) const;
         // Load, into the specified 'result', the number of bytes read by the
@@ -1911,13 +2150,16 @@ class ChannelPool {
                                              streamSocket(int channelId) const;
         // Return a shared pointer to the non-modifiable stream socket
         // associated with the specified 'channelId', and an empty shared
-        // pointer if a corresponding channel does not exist.  The returned
-        // shared pointer is aliased to the underlying channel and the channel
-        // will not be closed until this shared pointer is destroyed.
-        // Therefore, it is important that clients carefully manage the
-        // lifetime of the returned shared pointer.  The behavior of this
-        // channel pool is undefined if the underlying socket is manipulated
-        // while still under management by this channel pool.
+        // pointer if a corresponding channel does not exist or if its socket
+        // is an IPv6 socket (see {IPv6 Support}).  The returned shared
+        // pointer is aliased to the underlying channel and the channel will
+        // not be closed until this shared pointer is destroyed.  Therefore,
+        // it is important that clients carefully manage the lifetime of the
+        // returned shared pointer.  The behavior of this channel pool is
+        // undefined if the underlying socket is manipulated while still under
+        // management by this channel pool.  Note that the addresses of an
+        // IPv6 channel are available from the 'btlso::IPv6Address' overloads
+        // of 'getLocalAddress' and 'getPeerAddress'.
 
     void totalBytesRead(bsls::Types::Int64 *result) const;
         // Load, into the specified 'result', the total number of bytes read by
@@ -2131,8 +2373,36 @@ int ChannelPool::connect(const btlso::IPv4Address&   serverAddress,
                          KeepHalfOpenMode            mode,
                          const btlso::SocketOptions *socketOptions,
                          const btlso::IPv4Address   *localAddress)
+{
+    btlso::IPv6Address mappedLocalAddress;
+    if (localAddress) {
+        mappedLocalAddress = btlso::IPv6Address(*localAddress);
+    }
+
+    return connectImp(btlso::IPv6Address(serverAddress),
+                      false,
+                      numAttempts,
+                      interval,
+                      sourceId,
+                      0,
+                      readEnabledFlag,
+                      mode,
+                      socketOptions,
+                      localAddress ? &mappedLocalAddress : 0);
+}
+
+inline
+int ChannelPool::connect(const btlso::IPv6Address&   serverAddress,
+                         int                         numAttempts,
+                         const bsls::TimeInterval&   interval,
+                         int                         sourceId,
+                         bool                        readEnabledFlag,
+                         KeepHalfOpenMode            mode,
+                         const btlso::SocketOptions *socketOptions,
+                         const btlso::IPv6Address   *localAddress)
 {
     return connectImp(serverAddress,
+                      true,
                       numAttempts,
                       interval,
                       sourceId,
@@ -2154,6 +2424,38 @@ int ChannelPool::connect(const char                 *hostname,
                          KeepHalfOpenMode            halfCloseMode,
                          const btlso::SocketOptions *socketOptions,
                          const btlso::IPv4Address   *localAddress)
+{
+    btlso::IPv6Address mappedLocalAddress;
+    if (localAddress) {
+        mappedLocalAddress = btlso::IPv6Address(*localAddress);
+    }
+
+    return connectImp(hostname,
+                      portNumber,
+                      numAttempts,
+                      interval,
+                      sourceId,
+                      0,
+                      resolutionMode,
+                      false,
+                      readEnabledFlag,
+                      halfCloseMode,
+                      socketOptions,
+                      localAddress ? &mappedLocalAddress : 0);
+}
+
+inline
+int ChannelPool::connect(const char                 *hostname,
+                         int                         portNumber,
+                         ConnectAddressFamily        addressFamily,
+                         int                         numAttempts,
+                         const bsls::TimeInterval&   interval,
+                         int                         sourceId,
+                         ConnectResolutionMode       resolutionMode,
+                         bool                        readEnabledFlag,
+                         KeepHalfOpenMode            halfCloseMode,
+                         const btlso::SocketOptions *socketOptions,
+                         const btlso::IPv6Address   *localAddress)
 {
     return connectImp(hostname,
                       portNumber,
@@ -2162,6 +2464,7 @@ int ChannelPool::connect(const char                 *hostname,
                       sourceId,
                       0,
                       resolutionMode,
+                      e_CONNECT_DUAL_STACK == addressFamily,
                       readEnabledFlag,
                       halfCloseMode,
                       socketOptions,
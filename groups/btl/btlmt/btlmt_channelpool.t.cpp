@@ -12,11 +12,13 @@
 
 #include <btlmt_channelpoolconfiguration.h>
 #include <btlmt_asyncchannel.h>
+#include <btlmt_eventmanagertype.h>
 
 #include <btls_iovecutil.h>
 #include <btlso_flag.h>
 #include <btlso_inetstreamsocketfactory.h>
 #include <btlso_ipv4address.h>
+#include <btlso_ipv6address.h>
 #include <btlso_resolveutil.h>
 #include <btlso_streamsocket.h>
 #include <btlso_socketoptions.h>
@@ -166,7 +168,11 @@ using namespace bdlf::PlaceHolders;
 // [28] TESTING: 'busyMetrics' and time metrics collection.
 // [28] CONCERN: Event Manager Allocation
 // [30] Implementing a QueueProcessor
-// [37] USAGE EXAMPLE
+// [37] CONCERN: 'SO_REUSEPORT' listeners
+// [38] CONCERN: zero-copy writes
+// [39] CONCERN: write coalescing
+// [40] CONCERN: choice of socket event manager
+// [41] USAGE EXAMPLE
 //=============================================================================
 //                       STANDARD BDE ASSERT TEST MACROS
 //-----------------------------------------------------------------------------
@@ -710,6 +716,359 @@ void populateMessage(btlb::Blob       *msg,
     msg->appendDataBuffer(blobBuffer);
 }
 
+//-----------------------------------------------------------------------------
+//                                  TEST_CASE_REUSEPORT_LISTENERS
+//-----------------------------------------------------------------------------
+
+namespace TEST_CASE_REUSEPORT_LISTENERS {
+
+bsls::AtomicInt numChannelsUp(0);
+bsls::AtomicInt numAcceptTimeouts(0);
+
+bslmt::Mutex                          threadsMutex;
+bsl::map<bsls::Types::Uint64, int>    threads;
+    // number of channels that came up in each dispatcher thread
+
+void poolStateCb(int state, int source, int severity)
+{
+    if (veryVerbose) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&coutMutex);
+        bsl::cout << "Pool state callback called with"
+                  << " State: " << state
+                  << " Source: "  << source
+                  << " Severity: " << severity << bsl::endl;
+    }
+    if (btlmt::ChannelPool::e_ACCEPT_TIMEOUT == state) {
+        ++numAcceptTimeouts;
+    }
+}
+
+void channelStateCb(int channelId, int serverId, int state, void *)
+{
+    if (veryVerbose) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&coutMutex);
+        bsl::cout << "Channel state callback called with"
+                  << " Channel Id: " << channelId
+                  << " Server Id: "  << serverId
+                  << " State: " << state << bsl::endl;
+    }
+    if (btlmt::ChannelPool::e_CHANNEL_UP == state) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&threadsMutex);
+            ++threads[bslmt::ThreadUtil::selfIdAsUint64()];
+        }
+        ++numChannelsUp;
+    }
+}
+
+void blobBasedReadCb(int *needed, btlb::Blob *msg, int, void *)
+{
+    *needed = 1;
+    msg->removeAll();
+}
+
+bool waitForChannels(int expected)
+    // Wait up to 10 seconds for the specified 'expected' number of channels
+    // to come up.  Return 'true' if they did, and 'false' otherwise.
+{
+    for (int i = 0; i < 1000 && numChannelsUp < expected; ++i) {
+        bslmt::ThreadUtil::microSleep(10 * 1000);
+    }
+    return expected == numChannelsUp;
+}
+
+}  // close namespace TEST_CASE_REUSEPORT_LISTENERS
+
+//-----------------------------------------------------------------------------
+//                                  TEST_CASE_ZERO_COPY
+//-----------------------------------------------------------------------------
+
+namespace TEST_CASE_ZERO_COPY {
+
+bsls::AtomicInt channelId(-1);
+bsls::AtomicInt numZeroCopyCompletions(0);
+
+void poolStateCb(int, int, int)
+{
+}
+
+void channelStateCb(int id, int serverId, int state, void *)
+{
+    if (veryVerbose) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&coutMutex);
+        bsl::cout << "Channel state callback called with"
+                  << " Channel Id: " << id
+                  << " Server Id: "  << serverId
+                  << " State: " << state << bsl::endl;
+    }
+    if (btlmt::ChannelPool::e_CHANNEL_UP == state) {
+        channelId = id;
+    }
+    else if (btlmt::ChannelPool::e_ZERO_COPY_COMPLETE == state) {
+        ++numZeroCopyCompletions;
+    }
+}
+
+void blobBasedReadCb(int *needed, btlb::Blob *msg, int, void *)
+{
+    *needed = 1;
+    msg->removeAll();
+}
+
+char fillValue(int offset)
+    // Return the value of the byte at the specified 'offset' of the messages
+    // written by this test case.
+{
+    return static_cast<char>((offset * 7 + offset / 251) & 0xff);
+}
+
+void loadMessage(btlb::Blob                        *message,
+                 bsl::vector<bsl::weak_ptr<char> > *buffers,
+                 int                                bufferSize,
+                 int                                numBuffers,
+                 bslma::Allocator                  *allocator)
+    // Load into the specified 'message' the specified 'numBuffers' buffers of
+    // the specified 'bufferSize' allocated from the specified 'allocator' and
+    // filled according to 'fillValue', and append to the specified 'buffers'
+    // a weak reference to each of them.
+{
+    int offset = 0;
+    for (int i = 0; i < numBuffers; ++i) {
+        bsl::shared_ptr<char> buffer =
+            bslstl::SharedPtrUtil::createInplaceUninitializedBuffer(bufferSize,
+                                                                    allocator);
+        for (int j = 0; j < bufferSize; ++j, ++offset) {
+            buffer.get()[j] = fillValue(offset);
+        }
+        buffers->push_back(buffer);
+        message->appendDataBuffer(btlb::BlobBuffer(buffer, bufferSize));
+    }
+}
+
+bool readMessage(btlso::StreamSocket<btlso::IPv4Address> *socket, int length)
+    // Read from the specified blocking 'socket' the specified 'length' bytes
+    // and return 'true' if they match 'fillValue', and 'false' otherwise.
+{
+    bsl::vector<char> data(length);
+    int               numRead = 0;
+
+    while (numRead < length) {
+        const int rc = socket->read(&data[numRead], length - numRead);
+        if (0 >= rc) {
+            return false;                                             // RETURN
+        }
+        numRead += rc;
+    }
+
+    for (int i = 0; i < length; ++i) {
+        if (fillValue(i) != data[i]) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+bool areReleased(const bsl::vector<bsl::weak_ptr<char> >& buffers)
+    // Wait up to 10 seconds for all the specified 'buffers' to be released.
+    // Return 'true' if they were, and 'false' otherwise.
+{
+    for (int i = 0; i < 1000; ++i) {
+        bool releasedFlag = true;
+        for (bsl::size_t j = 0; j < buffers.size(); ++j) {
+            releasedFlag = releasedFlag && buffers[j].expired();
+        }
+        if (releasedFlag) {
+            return true;                                              // RETURN
+        }
+        bslmt::ThreadUtil::microSleep(10 * 1000);
+    }
+    return false;
+}
+
+}  // close namespace TEST_CASE_ZERO_COPY
+
+//-----------------------------------------------------------------------------
+//                                  TEST_CASE_WRITE_COALESCING
+//-----------------------------------------------------------------------------
+
+namespace TEST_CASE_WRITE_COALESCING {
+
+bsls::AtomicInt channelId(-1);
+
+void poolStateCb(int, int, int)
+{
+}
+
+void channelStateCb(int id, int serverId, int state, void *)
+{
+    if (veryVerbose) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&coutMutex);
+        bsl::cout << "Channel state callback called with"
+                  << " Channel Id: " << id
+                  << " Server Id: "  << serverId
+                  << " State: " << state << bsl::endl;
+    }
+    if (btlmt::ChannelPool::e_CHANNEL_UP == state) {
+        channelId = id;
+    }
+}
+
+void blobBasedReadCb(int *needed, btlb::Blob *msg, int, void *)
+{
+    *needed = 1;
+    msg->removeAll();
+}
+
+int writeMessages(btlmt::ChannelPool       *pool,
+                  int                       id,
+                  int                       numMessages,
+                  btlb::BlobBufferFactory  *factory)
+    // Write to the channel having the specified 'id' in the specified 'pool'
+    // the specified 'numMessages' messages, each holding its sequence number
+    // in a buffer allocated from the specified 'factory'.  Return the number
+    // of messages that could not be written.
+{
+    int numFailures = 0;
+    for (int i = 0; i < numMessages; ++i) {
+        btlb::Blob message(factory);
+        btlb::BlobUtil::append(&message,
+                               reinterpret_cast<const char *>(&i),
+                               static_cast<int>(sizeof i));
+        if (0 != pool->write(id, message)) {
+            ++numFailures;
+        }
+    }
+    return numFailures;
+}
+
+bool readMessages(btlso::StreamSocket<btlso::IPv4Address> *socket,
+                  int                                      numMessages)
+    // Read from the specified blocking 'socket' the specified 'numMessages'
+    // messages written by 'writeMessages', and return 'true' if they are
+    // received in order, and 'false' otherwise.
+{
+    for (int i = 0; i < numMessages; ++i) {
+        int value   = -1;
+        int numRead = 0;
+        while (numRead < static_cast<int>(sizeof value)) {
+            const int rc = socket->read(
+                                   reinterpret_cast<char *>(&value) + numRead,
+                                   static_cast<int>(sizeof value) - numRead);
+            if (0 >= rc) {
+                return false;                                         // RETURN
+            }
+            numRead += rc;
+        }
+        if (i != value) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close namespace TEST_CASE_WRITE_COALESCING
+
+//-----------------------------------------------------------------------------
+//                                  TEST_CASE_IPV6
+//-----------------------------------------------------------------------------
+
+namespace TEST_CASE_IPV6 {
+
+bsls::AtomicInt acceptedId(-1);
+bsls::AtomicInt connectedId(-1);
+
+bslmt::Mutex    dataMutex;
+bsl::string     data;
+
+enum {
+    k_SERVER_ID = 1,
+    k_CLIENT_ID = 2
+};
+
+void poolStateCb(int, int, int)
+{
+}
+
+void channelStateCb(int id, int sourceId, int state, void *)
+{
+    if (veryVerbose) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&coutMutex);
+        bsl::cout << "Channel state callback called with"
+                  << " Channel Id: " << id
+                  << " Source Id: "  << sourceId
+                  << " State: " << state << bsl::endl;
+    }
+    if (btlmt::ChannelPool::e_CHANNEL_UP == state) {
+        if (k_SERVER_ID == sourceId) {
+            acceptedId = id;
+        }
+        else {
+            connectedId = id;
+        }
+    }
+}
+
+void blobBasedReadCb(int *needed, btlb::Blob *msg, int, void *)
+{
+    *needed = 1;
+
+    bsl::vector<char> buffer(msg->length());
+    btlb::BlobUtil::copy(buffer.data(), *msg, 0, msg->length());
+    msg->removeAll();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&dataMutex);
+    data.append(buffer.begin(), buffer.end());
+}
+
+bool waitForChannels()
+    // Wait for up to 10 seconds until both an accepted and a connected
+    // channel are up, and return 'true' if they are, and 'false' otherwise.
+{
+    for (int i = 0; i < 1000 && (-1 == acceptedId || -1 == connectedId);
+         ++i) {
+        bslmt::ThreadUtil::microSleep(10 * 1000);
+    }
+    return -1 != acceptedId && -1 != connectedId;
+}
+
+bool waitForData(const bsl::string& expected)
+    // Wait for up to 10 seconds until the data read on all channels is the
+    // specified 'expected' data, and return 'true' if it is, and 'false'
+    // otherwise.
+{
+    for (int i = 0; i < 1000; ++i) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&dataMutex);
+            if (expected == data) {
+                return true;                                          // RETURN
+            }
+        }
+        bslmt::ThreadUtil::microSleep(10 * 1000);
+    }
+    return false;
+}
+
+bool isIPv6LoopbackAvailable()
+    // Return 'true' if an IPv6 socket can be bound to the IPv6 loopback
+    // address, and 'false' otherwise.
+{
+    btlso::SocketHandle::Handle handle;
+    if (0 != btlso::SocketImpUtil::open<btlso::IPv6Address>(
+                                      &handle,
+                                      btlso::SocketImpUtil::k_SOCKET_STREAM)) {
+        return false;                                                 // RETURN
+    }
+
+    const btlso::IPv6Address LOOPBACK("::1", 0);
+
+    const int rc = btlso::SocketImpUtil::bind<btlso::IPv6Address>(handle,
+                                                                  LOOPBACK);
+    btlso::SocketImpUtil::close(handle);
+    return 0 == rc;
+}
+
+}  // close namespace TEST_CASE_IPV6
+
 //-----------------------------------------------------------------------------
 //                                  TEST_CASE_CTOR_TAKING_FACTORY
 //-----------------------------------------------------------------------------
@@ -7724,9 +8083,30 @@ class TestDriver {
 
   public:
     // TEST CASES
-    static void testCase37();
+    static void testCase42();
         // Test usage example.
 
+    static void testCase41();
+        // Test that a channel pool listens on and connects to IPv6 addresses,
+        // and reports the addresses of its servers and channels in both
+        // address families.
+
+    static void testCase40();
+        // Test that a channel pool transfers data on each configurable socket
+        // event manager.
+
+    static void testCase39();
+        // Test that written messages are gathered when configured, and that
+        // their delay is bounded by the coalescing interval.
+
+    static void testCase38();
+        // Test that large blobs are written without copying when configured,
+        // and that their buffers are released once the kernel is done.
+
+    static void testCase37();
+        // Test that 'SO_REUSEPORT' listeners accept connections and are all
+        // closed by 'close'.
+
     static void testCase36();
         // Test the new constructor form that takes a BlobBufferFactory.
 
@@ -7852,7 +8232,7 @@ class TestDriver {
                                // TEST APPARATUS
                                // --------------
 
-void TestDriver::testCase37()
+void TestDriver::testCase42()
 {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
@@ -7889,6 +8269,916 @@ void TestDriver::testCase37()
         monitorPool(&coutMutex, echoServer.pool(), NUM_MONITOR);
 }
 
+void TestDriver::testCase41()
+{
+        // --------------------------------------------------------------------
+        // TESTING IPV6 LISTEN AND CONNECT
+        //
+        // Concerns:
+        //: 1 A channel pool listens on, and connects to, an IPv6 address, and
+        //:   transfers data on the resulting channels.
+        //:
+        //: 2 The IPv6 address accessors report the addresses of IPv6 servers
+        //:   and channels, and the IPv4 address accessors fail for them.
+        //:
+        //: 3 The IPv6 address accessors report the IPv4-mapped addresses of
+        //:   IPv4 servers and channels.
+        //:
+        //: 4 'streamSocket' returns an empty pointer for IPv6 channels, and
+        //:   the socket of IPv4 channels.
+        //:
+        //: 5 A dual-stack 'connect' taking a host name resolves it to an IPv6
+        //:   address, with either resolution mode, and connects from an IPv6
+        //:   socket, so that a server listening on the IPv6 loopback address
+        //:   only is reached by name.
+        //
+        // Plan:
+        //: 1 Unless the IPv6 loopback address is unavailable, listen on
+        //:   "::1", connect to the server address, verify the addresses of
+        //:   the accepted and connected channels, and write a message on
+        //:   each of them.  (C-1..2, 4)
+        //:
+        //: 2 Unless the IPv6 loopback address is unavailable, listen on
+        //:   "::1", and, for each resolution mode, connect in the dual-stack
+        //:   address family to the host names "::1" and "localhost" (which
+        //:   resolves to "::1" unless the host maps it to the IPv4 loopback
+        //:   address only, in which case it is skipped), and verify that the
+        //:   connected channels are IPv6 channels connected to the server.
+        //:   (C-4..5)
+        //:
+        //: 3 Listen on, and connect to, the IPv4 loopback address, and verify
+        //:   the addresses reported by the IPv6 address accessors.  (C-3..4)
+        //
+        // Testing:
+        //   int listen(const IPv6Address&, int, int, int, bool, opts*);
+        //   int connect(const IPv6Address&, int, ..., const IPv6Address*);
+        //   int connect(const char *, int, ConnectAddressFamily, int, ...);
+        //   int getServerAddress(btlso::IPv6Address *, int) const;
+        //   int getLocalAddress(btlso::IPv6Address *, int) const;
+        //   int getPeerAddress(btlso::IPv6Address *, int) const;
+        //   shared_ptr<const StreamSocket<IPv4Address> > streamSocket(int);
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "\nTESTING IPV6 LISTEN AND CONNECT"
+                 << "\n===============================" << endl;
+
+        using namespace TEST_CASE_IPV6;
+
+        btlmt::ChannelPoolConfiguration config;
+        config.setMaxThreads(2);
+        config.setReadTimeout(0);
+
+        btlmt::ChannelPool::ChannelStateChangeCallback channelCb(
+                                                              &channelStateCb);
+        btlmt::ChannelPool::BlobBasedReadCallback      dataCb(
+                                                             &blobBasedReadCb);
+        btlmt::ChannelPool::PoolStateChangeCallback    poolCb(&poolStateCb);
+
+        const bsls::TimeInterval INTERVAL(1.0);
+
+        if (!isIPv6LoopbackAvailable()) {
+            if (verbose) cout << "\tIPv6 loopback unavailable: skipping"
+                              << endl;
+        }
+        else {
+            if (verbose) cout << "\tIPv6 server and client" << endl;
+
+            bslma::TestAllocator ta("testAllocator", veryVeryVerbose);
+            {
+                btlb::PooledBlobBufferFactory bufferFactory(16, &ta);
+
+                btlmt::ChannelPool pool(channelCb,
+                                        dataCb,
+                                        poolCb,
+                                        config,
+                                        &ta);
+                ASSERT(0 == pool.start());
+
+                acceptedId  = -1;
+                connectedId = -1;
+                data.clear();
+
+                const btlso::IPv6Address LOOPBACK("::1", 0);
+
+                ASSERT(0 == pool.listen(LOOPBACK, 1, k_SERVER_ID));
+
+                btlso::IPv6Address server;
+                ASSERT(0 == pool.getServerAddress(&server, k_SERVER_ID));
+                ASSERT(0 != server.portNumber());
+                ASSERT(!server.isIPv4Mapped());
+                ASSERT(0 == bsl::memcmp(LOOPBACK.ipAddress(),
+                                        server.ipAddress(),
+                                        btlso::IPv6Address::k_ADDRESS_LENGTH));
+
+                btlso::IPv4Address server4;
+                ASSERT(0 != pool.getServerAddress(&server4, k_SERVER_ID));
+
+                ASSERT(0 == pool.connect(server, 1, INTERVAL, k_CLIENT_ID));
+                ASSERT(waitForChannels());
+
+                btlso::IPv6Address local, peer, acceptedPeer;
+                ASSERT(0 == pool.getLocalAddress(&local, connectedId));
+                ASSERT(0 == pool.getPeerAddress(&peer, connectedId));
+                ASSERT(0 == pool.getPeerAddress(&acceptedPeer, acceptedId));
+
+                if (veryVerbose) {
+                    P_(server); P_(local); P(acceptedPeer);
+                }
+
+                ASSERT(server       == peer);
+                ASSERT(local        == acceptedPeer);
+                ASSERT(!local.isIPv4Mapped());
+
+                btlso::IPv4Address address4;
+                ASSERT(0 != pool.getLocalAddress(&address4, connectedId));
+                ASSERT(0 != pool.getPeerAddress(&address4, connectedId));
+                ASSERT(0 != pool.getPeerAddress(&address4, acceptedId));
+
+                ASSERT(!pool.streamSocket(connectedId));
+                ASSERT(!pool.streamSocket(acceptedId));
+
+                btlb::Blob message(&bufferFactory);
+                btlb::BlobUtil::append(&message, "IPv6", 4);
+                ASSERT(0 == pool.write(connectedId, message));
+                ASSERT(waitForData("IPv6"));
+
+                ASSERT(0 == pool.write(acceptedId, message));
+                ASSERT(waitForData("IPv6IPv6"));
+
+                ASSERT(0 == pool.stop());
+            }
+            ASSERT(0 == ta.numBytesInUse());
+
+            if (verbose) cout << "\tIPv6 connect by host name" << endl;
+
+            {
+                btlmt::ChannelPool pool(channelCb,
+                                        dataCb,
+                                        poolCb,
+                                        config,
+                                        &ta);
+                ASSERT(0 == pool.start());
+
+                ASSERT(0 == pool.listen(btlso::IPv6Address("::1", 0),
+                                        1,
+                                        k_SERVER_ID));
+
+                btlso::IPv6Address server;
+                ASSERT(0 == pool.getServerAddress(&server, k_SERVER_ID));
+
+                btlso::IPv6Address localhost;
+                const bool isLocalhostIPv6 =
+                         0 == btlso::ResolveUtil::getAddress(&localhost,
+                                                             "localhost")
+                      && !localhost.isIPv4Mapped();
+
+                const char *HOSTNAMES[] = { "::1", "localhost" };
+                const int   NUM_HOSTNAMES = isLocalhostIPv6 ? 2 : 1;
+
+                const btlmt::ChannelPool::ConnectResolutionMode MODES[] = {
+                    btlmt::ChannelPool::e_RESOLVE_ONCE,
+                    btlmt::ChannelPool::e_RESOLVE_AT_EACH_ATTEMPT
+                };
+
+                for (int ti = 0; ti < NUM_HOSTNAMES; ++ti) {
+                    for (int mi = 0; mi < 2; ++mi) {
+                        const char *HOSTNAME = HOSTNAMES[ti];
+
+                        if (veryVerbose) { T_() P_(HOSTNAME) P(mi) }
+
+                        acceptedId  = -1;
+                        connectedId = -1;
+
+                        LOOP2_ASSERT(HOSTNAME, mi, 0 == pool.connect(
+                                      HOSTNAME,
+                                      server.portNumber(),
+                                      btlmt::ChannelPool::e_CONNECT_DUAL_STACK,
+                                      1,
+                                      INTERVAL,
+                                      k_CLIENT_ID,
+                                      MODES[mi]));
+                        LOOP2_ASSERT(HOSTNAME, mi, waitForChannels());
+
+                        btlso::IPv6Address peer;
+                        LOOP2_ASSERT(HOSTNAME, mi,
+                                0 == pool.getPeerAddress(&peer, connectedId));
+                        LOOP3_ASSERT(HOSTNAME, mi, peer, server == peer);
+
+                        LOOP2_ASSERT(HOSTNAME, mi,
+                                     !pool.streamSocket(connectedId));
+
+                        LOOP2_ASSERT(HOSTNAME, mi,
+                                     0 == pool.shutdown(connectedId));
+                    }
+                }
+
+                ASSERT(0 == pool.stop());
+            }
+            ASSERT(0 == ta.numBytesInUse());
+        }
+
+        if (verbose) cout << "\tIPv4 server and client" << endl;
+
+        bslma::TestAllocator ta("testAllocator", veryVeryVerbose);
+        {
+            btlmt::ChannelPool pool(channelCb, dataCb, poolCb, config, &ta);
+            ASSERT(0 == pool.start());
+
+            acceptedId  = -1;
+            connectedId = -1;
+
+            ASSERT(0 == pool.listen(btlso::IPv4Address("127.0.0.1", 0),
+                                    1,
+                                    k_SERVER_ID));
+
+            btlso::IPv4Address server4;
+            ASSERT(0 == pool.getServerAddress(&server4, k_SERVER_ID));
+
+            btlso::IPv6Address server;
+            ASSERT(0 == pool.getServerAddress(&server, k_SERVER_ID));
+            ASSERT(btlso::IPv6Address(server4) == server);
+
+            ASSERT(0 == pool.connect(server4, 1, INTERVAL, k_CLIENT_ID));
+            ASSERT(waitForChannels());
+
+            btlso::IPv4Address local4, peer4;
+            ASSERT(0 == pool.getLocalAddress(&local4, connectedId));
+            ASSERT(0 == pool.getPeerAddress(&peer4, acceptedId));
+            ASSERT(local4 == peer4);
+
+            btlso::IPv6Address local, peer, acceptedPeer;
+            ASSERT(0 == pool.getLocalAddress(&local, connectedId));
+            ASSERT(0 == pool.getPeerAddress(&peer, connectedId));
+            ASSERT(0 == pool.getPeerAddress(&acceptedPeer, acceptedId));
+
+            ASSERT(btlso::IPv6Address(server4) == peer);
+            ASSERT(btlso::IPv6Address(local4)  == local);
+            ASSERT(local                       == acceptedPeer);
+
+            ASSERT(pool.streamSocket(connectedId));
+            ASSERT(pool.streamSocket(acceptedId));
+
+            ASSERT(0 == pool.stop());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+}
+
+void TestDriver::testCase40()
+{
+        // --------------------------------------------------------------------
+        // TESTING CHOICE OF SOCKET EVENT MANAGER
+        //
+        // Concerns:
+        //: 1 A channel pool configured with any 'eventManagerType' accepts
+        //:   connections and writes messages in full and in order.
+        //
+        // Plan:
+        //: 1 For each event manager type, connect a blocking client socket
+        //:   to a channel pool configured with that type, write a number of
+        //:   messages large enough to fill the socket buffers, and verify
+        //:   that they are received in order.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: choice of socket event manager
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "\nTESTING CHOICE OF SOCKET EVENT MANAGER"
+                 << "\n======================================" << endl;
+
+        using namespace TEST_CASE_WRITE_COALESCING;
+
+        typedef btlmt::EventManagerType EMT;
+
+        const EMT::Value TYPES[] = {
+            EMT::e_DEFAULT, EMT::e_FLAT_EPOLL, EMT::e_IO_URING
+        };
+        const int        NUM_TYPES = sizeof TYPES / sizeof *TYPES;
+
+        enum { k_NUM_MESSAGES = 100000 };
+
+        for (int ti = 0; ti < NUM_TYPES; ++ti) {
+            const EMT::Value TYPE = TYPES[ti];
+
+            if (verbose) {
+                P(TYPE);
+            }
+
+            btlmt::ChannelPoolConfiguration config;
+            config.setMaxThreads(2);
+            config.setReadTimeout(0);
+            ASSERT(0 == config.setEventManagerType(TYPE));
+
+            btlmt::ChannelPool::ChannelStateChangeCallback channelCb(
+                                                              &channelStateCb);
+            btlmt::ChannelPool::BlobBasedReadCallback      dataCb(
+                                                             &blobBasedReadCb);
+            btlmt::ChannelPool::PoolStateChangeCallback    poolCb(
+                                                                 &poolStateCb);
+
+            bslma::TestAllocator ta("testAllocator", veryVeryVerbose);
+            {
+                btlb::PooledBlobBufferFactory bufferFactory(16, &ta);
+
+                btlmt::ChannelPool pool(channelCb,
+                                        dataCb,
+                                        poolCb,
+                                        config,
+                                        &ta);
+                ASSERT(0 == pool.start());
+
+                channelId = -1;
+
+                ASSERT(0 == pool.listen(getLocalAddress(), 1, ti));
+
+                const btlso::IPv4Address ADDRESS =
+                                             getServerLocalAddress(&pool, ti);
+
+                btlso::InetStreamSocketFactory<btlso::IPv4Address> factory(
+                                                                          &ta);
+                btlso::StreamSocket<btlso::IPv4Address> *socket =
+                                                            factory.allocate();
+                ASSERT(0 == socket->connect(ADDRESS));
+                ASSERT(0 == socket->setBlockingMode(
+                                               btlso::Flag::e_BLOCKING_MODE));
+
+                for (int i = 0; i < 1000 && -1 == channelId; ++i) {
+                    bslmt::ThreadUtil::microSleep(10 * 1000);
+                }
+                LOOP_ASSERT(TYPE, -1 != channelId);
+
+                LOOP_ASSERT(TYPE, 0 == writeMessages(&pool,
+                                                     channelId,
+                                                     k_NUM_MESSAGES,
+                                                     &bufferFactory));
+
+                LOOP_ASSERT(TYPE, readMessages(socket, k_NUM_MESSAGES));
+
+                factory.deallocate(socket);
+
+                ASSERT(0 == pool.stop());
+            }
+            LOOP_ASSERT(TYPE, 0 == ta.numBytesInUse());
+        }
+}
+
+void TestDriver::testCase39()
+{
+        // --------------------------------------------------------------------
+        // TESTING WRITE COALESCING
+        //
+        // Concerns:
+        //: 1 When 'coalesceWrites' is configured, messages are written in
+        //:   full and in order, whatever the coalescing interval.
+        //:
+        //: 2 A message is not written before the end of the coalescing
+        //:   interval, unless its batch fills a 'writev'.
+        //:
+        //: 3 A batch filling a 'writev' is written without waiting for the
+        //:   end of the coalescing interval.
+        //:
+        //: 4 The flush timer of a batch written early does not cut short the
+        //:   coalescing interval of a later batch.
+        //
+        // Plan:
+        //: 1 For a coalescing interval of 0 and of 0.2s, connect a blocking
+        //:   client socket to a channel pool configured with
+        //:   'coalesceWrites', write a few small messages, and verify that
+        //:   they are received in order, and not before the end of the
+        //:   interval.  (C-1..2)
+        //:
+        //: 2 With a coalescing interval of 60s, write more small messages
+        //:   than fit in a 'writev', and verify that the messages of the
+        //:   first 'writev' are received in order well before the end of the
+        //:   interval.  Note that the remaining messages start a new batch,
+        //:   and are thus not expected before the end of the interval.  (C-3)
+        //:
+        //: 3 With a coalescing interval of 1s, write and read a batch filling
+        //:   a 'writev', wait for half the interval, and write one more
+        //:   message.  Verify that this message is not received before the
+        //:   end of its own interval, i.e., after the timer of the first
+        //:   batch would have fired.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: write coalescing
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "\nTESTING WRITE COALESCING"
+                 << "\n========================" << endl;
+
+        using namespace TEST_CASE_WRITE_COALESCING;
+
+        const struct {
+            int    d_line;
+            double d_interval;     // coalescing interval
+            int    d_numMessages;  // number of messages to write
+            int    d_numExpected;  // number of messages to read
+            double d_minDelay;     // minimum delay before reception
+            double d_maxDelay;     // maximum delay before reception
+        } DATA[] = {
+            //LINE  INTERVAL  NUM WRITTEN  NUM READ  MIN DELAY  MAX DELAY
+            //----  --------  -----------  --------  ---------  ---------
+            { L_,        0.0,          10,       10,       0.0,      30.0 },
+            { L_,        0.2,          10,       10,      0.15,      30.0 },
+            { L_,       60.0,        3000,      500,       0.0,      30.0 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE         = DATA[ti].d_line;
+            const double INTERVAL     = DATA[ti].d_interval;
+            const int    NUM_MESSAGES = DATA[ti].d_numMessages;
+            const int    NUM_EXPECTED = DATA[ti].d_numExpected;
+            const double MIN_DELAY    = DATA[ti].d_minDelay;
+            const double MAX_DELAY    = DATA[ti].d_maxDelay;
+
+            if (verbose) {
+                P_(LINE) P_(INTERVAL) P(NUM_MESSAGES);
+            }
+
+            btlmt::ChannelPoolConfiguration config;
+            config.setMaxThreads(1);
+            config.setReadTimeout(0);
+            config.setCoalesceWrites(true);
+            config.setCoalescingInterval(INTERVAL);
+
+            btlmt::ChannelPool::ChannelStateChangeCallback channelCb(
+                                                              &channelStateCb);
+            btlmt::ChannelPool::BlobBasedReadCallback      dataCb(
+                                                             &blobBasedReadCb);
+            btlmt::ChannelPool::PoolStateChangeCallback    poolCb(
+                                                                 &poolStateCb);
+
+            bslma::TestAllocator ta("testAllocator", veryVeryVerbose);
+            {
+                btlb::PooledBlobBufferFactory bufferFactory(16, &ta);
+
+                btlmt::ChannelPool pool(channelCb,
+                                        dataCb,
+                                        poolCb,
+                                        config,
+                                        &ta);
+                ASSERT(0 == pool.start());
+
+                channelId = -1;
+
+                ASSERT(0 == pool.listen(getLocalAddress(), 1, ti));
+
+                const btlso::IPv4Address ADDRESS =
+                                             getServerLocalAddress(&pool, ti);
+
+                btlso::InetStreamSocketFactory<btlso::IPv4Address> factory(
+                                                                          &ta);
+                btlso::StreamSocket<btlso::IPv4Address> *socket =
+                                                            factory.allocate();
+                ASSERT(0 == socket->connect(ADDRESS));
+                ASSERT(0 == socket->setBlockingMode(
+                                               btlso::Flag::e_BLOCKING_MODE));
+
+                for (int i = 0; i < 1000 && -1 == channelId; ++i) {
+                    bslmt::ThreadUtil::microSleep(10 * 1000);
+                }
+                LOOP_ASSERT(LINE, -1 != channelId);
+
+                const bsls::TimeInterval start = bdlt::CurrentTime::now();
+
+                LOOP_ASSERT(LINE, 0 == writeMessages(&pool,
+                                                     channelId,
+                                                     NUM_MESSAGES,
+                                                     &bufferFactory));
+
+                LOOP_ASSERT(LINE, readMessages(socket, NUM_EXPECTED));
+
+                const double delay = (bdlt::CurrentTime::now() - start)
+                                                      .totalSecondsAsDouble();
+
+                if (verbose) {
+                    P(delay);
+                }
+                LOOP2_ASSERT(LINE, delay, MIN_DELAY <= delay);
+                LOOP2_ASSERT(LINE, delay, MAX_DELAY >= delay);
+
+                factory.deallocate(socket);
+
+                ASSERT(0 == pool.stop());
+            }
+            LOOP_ASSERT(LINE, 0 == ta.numBytesInUse());
+        }
+
+        if (verbose) cout << "\tBatch following an early flush" << endl;
+        {
+            const double INTERVAL = 1.0;
+
+            btlmt::ChannelPoolConfiguration config;
+            config.setMaxThreads(1);
+            config.setReadTimeout(0);
+            config.setCoalesceWrites(true);
+            config.setCoalescingInterval(INTERVAL);
+
+            btlmt::ChannelPool::ChannelStateChangeCallback channelCb(
+                                                              &channelStateCb);
+            btlmt::ChannelPool::BlobBasedReadCallback      dataCb(
+                                                             &blobBasedReadCb);
+            btlmt::ChannelPool::PoolStateChangeCallback    poolCb(
+                                                                 &poolStateCb);
+
+            bslma::TestAllocator ta("testAllocator", veryVeryVerbose);
+            {
+                btlb::PooledBlobBufferFactory bufferFactory(16, &ta);
+
+                btlmt::ChannelPool pool(channelCb,
+                                        dataCb,
+                                        poolCb,
+                                        config,
+                                        &ta);
+                ASSERT(0 == pool.start());
+
+                channelId = -1;
+
+                ASSERT(0 == pool.listen(getLocalAddress(), 1, NUM_DATA));
+
+                const btlso::IPv4Address ADDRESS =
+                                       getServerLocalAddress(&pool, NUM_DATA);
+
+                btlso::InetStreamSocketFactory<btlso::IPv4Address> factory(
+                                                                          &ta);
+                btlso::StreamSocket<btlso::IPv4Address> *socket =
+                                                            factory.allocate();
+                ASSERT(0 == socket->connect(ADDRESS));
+                ASSERT(0 == socket->setBlockingMode(
+                                               btlso::Flag::e_BLOCKING_MODE));
+
+                for (int i = 0; i < 1000 && -1 == channelId; ++i) {
+                    bslmt::ThreadUtil::microSleep(10 * 1000);
+                }
+                ASSERT(-1 != channelId);
+
+                const int NUM_MESSAGES =
+                               btlmt::ChannelPool_MessageUtil::e_MAX_IOVEC_SIZE;
+
+                ASSERT(0 == writeMessages(&pool,
+                                          channelId,
+                                          NUM_MESSAGES,
+                                          &bufferFactory));
+                ASSERT(readMessages(socket, NUM_MESSAGES));
+
+                bslmt::ThreadUtil::microSleep(500 * 1000);
+
+                const bsls::TimeInterval start = bdlt::CurrentTime::now();
+
+                ASSERT(0 == writeMessages(&pool,
+                                          channelId,
+                                          1,
+                                          &bufferFactory));
+                ASSERT(readMessages(socket, 1));
+
+                const double delay = (bdlt::CurrentTime::now() - start)
+                                                      .totalSecondsAsDouble();
+
+                if (verbose) {
+                    P(delay);
+                }
+                LOOP_ASSERT(delay, 0.9 * INTERVAL <= delay);
+
+                factory.deallocate(socket);
+
+                ASSERT(0 == pool.stop());
+            }
+            ASSERT(0 == ta.numBytesInUse());
+        }
+}
+
+void TestDriver::testCase38()
+{
+        // --------------------------------------------------------------------
+        // TESTING ZERO-COPY WRITES
+        //
+        // Concerns:
+        //: 1 When 'zeroCopyThreshold' is configured, a blob at least that
+        //:   large is written in full and in order.
+        //:
+        //: 2 The blob buffers are retained until the kernel reports that it
+        //:   no longer references them, which is reported with
+        //:   'e_ZERO_COPY_COMPLETE', and are then released.
+        //:
+        //: 3 Messages smaller than the threshold are written as usual.
+        //:
+        //: 4 The buffers retained when a channel is shut down are not
+        //:   released while the kernel may still send their data, and the
+        //:   peer receives all the data handed to the kernel before the
+        //:   shutdown, followed by a normal end of stream.
+        //
+        // Plan:
+        //: 1 Create a channel pool with a zero-copy threshold, and connect a
+        //:   blocking client socket to one of its servers.
+        //:
+        //: 2 Write a large blob made of buffers the test only holds weakly,
+        //:   read it from the client and verify its contents.  Verify that
+        //:   the buffers are eventually released and that zero-copy
+        //:   completions were reported.  (C-1..2)
+        //:
+        //: 3 Write a small message and verify that it is received and that no
+        //:   further completion is reported.  (C-3)
+        //:
+        //: 4 Connect a second client socket that does not read, write a blob
+        //:   on the new channel, wait until the channel has handed all of it
+        //:   to the kernel, and shut the channel down.  Then read the whole
+        //:   blob from the client, verify its contents and that the
+        //:   connection is then closed normally, and verify that the buffers
+        //:   are released.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: zero-copy writes
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "\nTESTING ZERO-COPY WRITES"
+                 << "\n========================" << endl;
+
+        using namespace TEST_CASE_ZERO_COPY;
+
+        enum {
+            SERVER_ID          = 1068,
+            BUFFER_SIZE        = 64 * 1024,
+            NUM_BUFFERS        = 64,
+            LENGTH             = BUFFER_SIZE * NUM_BUFFERS,
+            SMALL_SIZE         = 100,
+            NUM_PENDING        = 16,
+            PENDING_LENGTH     = BUFFER_SIZE * NUM_PENDING
+        };
+
+        btlmt::ChannelPoolConfiguration config;
+        config.setMaxThreads(1);
+        config.setReadTimeout(0);
+        config.setWriteCacheWatermarks(0, 2 * LENGTH);
+        config.setZeroCopyThreshold(BUFFER_SIZE);
+
+        btlmt::ChannelPool::ChannelStateChangeCallback channelCb(
+                                                              &channelStateCb);
+        btlmt::ChannelPool::BlobBasedReadCallback      dataCb(
+                                                             &blobBasedReadCb);
+        btlmt::ChannelPool::PoolStateChangeCallback    poolCb(&poolStateCb);
+
+        bslma::TestAllocator ta("testAllocator", veryVeryVerbose);
+        bslma::TestAllocator ba("bufferAllocator", veryVeryVerbose);
+        {
+            btlmt::ChannelPool pool(channelCb, dataCb, poolCb, config, &ta);
+            ASSERT(0 == pool.start());
+
+            ASSERT(0 == pool.listen(getLocalAddress(), 1, SERVER_ID));
+
+            const btlso::IPv4Address ADDRESS =
+                                      getServerLocalAddress(&pool, SERVER_ID);
+
+            btlso::InetStreamSocketFactory<btlso::IPv4Address> factory(&ta);
+            btlso::StreamSocket<btlso::IPv4Address> *socket =
+                                                            factory.allocate();
+            ASSERT(0 == socket->connect(ADDRESS));
+            ASSERT(0 == socket->setBlockingMode(btlso::Flag::e_BLOCKING_MODE));
+
+            for (int i = 0; i < 1000 && -1 == channelId; ++i) {
+                bslmt::ThreadUtil::microSleep(10 * 1000);
+            }
+            ASSERT(-1 != channelId);
+
+            if (verbose) cout << "\tWriting a large blob." << endl;
+
+            bsl::vector<bsl::weak_ptr<char> > buffers(&ta);
+            {
+                btlb::Blob message(&ta);
+                loadMessage(&message, &buffers, BUFFER_SIZE, NUM_BUFFERS, &ba);
+                ASSERT(LENGTH == message.length());
+
+                ASSERT(0 == pool.write(channelId, message));
+            }
+
+            ASSERT(readMessage(socket, LENGTH));
+            ASSERT(areReleased(buffers));
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(MSG_ZEROCOPY)
+            LOOP_ASSERT(numZeroCopyCompletions, 0 < numZeroCopyCompletions);
+#endif
+            if (verbose) {
+                P(numZeroCopyCompletions);
+            }
+
+            if (verbose) cout << "\tWriting a small blob." << endl;
+
+            const int NUM_COMPLETIONS = numZeroCopyCompletions;
+
+            buffers.clear();
+            {
+                btlb::Blob message(&ta);
+                loadMessage(&message, &buffers, SMALL_SIZE, 1, &ba);
+
+                ASSERT(0 == pool.write(channelId, message));
+            }
+
+            ASSERT(readMessage(socket, SMALL_SIZE));
+            ASSERT(areReleased(buffers));
+
+            bslmt::ThreadUtil::microSleep(100 * 1000);
+            LOOP2_ASSERT(NUM_COMPLETIONS,
+                         numZeroCopyCompletions,
+                         NUM_COMPLETIONS == numZeroCopyCompletions);
+
+            if (verbose) cout << "\tShutting down a blocked channel." << endl;
+
+            channelId = -1;
+
+            btlso::StreamSocket<btlso::IPv4Address> *idleSocket =
+                                                            factory.allocate();
+            ASSERT(0 == idleSocket->connect(ADDRESS));
+            ASSERT(0 == idleSocket->setBlockingMode(
+                                               btlso::Flag::e_BLOCKING_MODE));
+
+            for (int i = 0; i < 1000 && -1 == channelId; ++i) {
+                bslmt::ThreadUtil::microSleep(10 * 1000);
+            }
+            ASSERT(-1 != channelId);
+
+            buffers.clear();
+            {
+                btlb::Blob message(&ta);
+                loadMessage(&message, &buffers, BUFFER_SIZE, NUM_PENDING, &ba);
+
+                ASSERT(0 == pool.write(channelId, message));
+            }
+
+            // Data still enqueued in the channel is discarded by 'shutdown':
+            // wait until all of it is handed to the kernel.
+
+            bsls::Types::Int64 numRead, numRequested, numWritten = 0;
+            for (int i = 0; i < 1000 && PENDING_LENGTH != numWritten; ++i) {
+                bslmt::ThreadUtil::microSleep(10 * 1000);
+                ASSERT(0 == pool.getChannelStatistics(&numRead,
+                                                      &numRequested,
+                                                      &numWritten,
+                                                      channelId));
+            }
+            LOOP_ASSERT(numWritten, PENDING_LENGTH == numWritten);
+
+            ASSERT(0 == pool.shutdown(channelId));
+
+            ASSERT(readMessage(idleSocket, PENDING_LENGTH));
+
+            char extra;
+            ASSERT(btlso::SocketHandle::e_ERROR_EOF ==
+                                               idleSocket->read(&extra, 1));
+
+            ASSERT(areReleased(buffers));
+
+            factory.deallocate(idleSocket);
+            factory.deallocate(socket);
+
+            ASSERT(0 == pool.stop());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+        ASSERT(0 == ba.numBytesInUse());
+}
+
+void TestDriver::testCase37()
+{
+        // --------------------------------------------------------------------
+        // TESTING 'SO_REUSEPORT' LISTENERS
+        //
+        // Concerns:
+        //: 1 When 'reusePortListeners' is configured, every listening socket
+        //:   opened for a server accepts connections, and the channels they
+        //:   create come up.
+        //:
+        //: 2 'close' closes all the listening sockets of the server.
+        //:
+        //: 3 An accept timeout is reported once per timeout period for the
+        //:   server, not once per listening socket.
+        //
+        // Plan:
+        //: 1 Create a channel pool with several threads and
+        //:   'reusePortListeners' set, listen on an ephemeral port, open many
+        //:   client connections and verify that a channel comes up for each
+        //:   of them, in the pool's dispatcher threads.  (C-1)
+        //:
+        //: 2 Close the server and verify that connecting to its port fails.
+        //:   (C-2)
+        //:
+        //: 3 Listen with a timeout and, without connecting, verify that the
+        //:   number of 'e_ACCEPT_TIMEOUT' pool events is consistent with a
+        //:   single timer.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: 'SO_REUSEPORT' listeners
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "\nTESTING 'SO_REUSEPORT' LISTENERS"
+                 << "\n================================" << endl;
+
+        using namespace TEST_CASE_REUSEPORT_LISTENERS;
+
+        enum {
+            NUM_THREADS     = 4,
+            NUM_CONNECTIONS = 64,
+            SERVER_ID       = 1066,
+            TIMED_SERVER_ID = 1067
+        };
+
+        btlmt::ChannelPoolConfiguration config;
+        config.setMaxThreads(NUM_THREADS);
+        config.setReadTimeout(0);
+        config.setReusePortListeners(true);
+
+        btlmt::ChannelPool::ChannelStateChangeCallback channelCb(
+                                                              &channelStateCb);
+        btlmt::ChannelPool::BlobBasedReadCallback      dataCb(
+                                                             &blobBasedReadCb);
+        btlmt::ChannelPool::PoolStateChangeCallback    poolCb(&poolStateCb);
+
+        bslma::TestAllocator ta("testAllocator", veryVeryVerbose);
+        {
+            btlmt::ChannelPool pool(channelCb, dataCb, poolCb, config, &ta);
+            ASSERT(0 == pool.start());
+
+            if (verbose) cout << "\tAccepting on every listener." << endl;
+
+            ASSERT(0 == pool.listen(getLocalAddress(), 64, SERVER_ID));
+
+            const btlso::IPv4Address ADDRESS =
+                                      getServerLocalAddress(&pool, SERVER_ID);
+            ASSERT(0 != ADDRESS.portNumber());
+
+            btlso::InetStreamSocketFactory<btlso::IPv4Address> factory(&ta);
+            bsl::vector<btlso::StreamSocket<btlso::IPv4Address> *> sockets(
+                                                                          &ta);
+
+            for (int i = 0; i < NUM_CONNECTIONS; ++i) {
+                btlso::StreamSocket<btlso::IPv4Address> *socket =
+                                                            factory.allocate();
+                ASSERT(socket);
+                LOOP_ASSERT(i, 0 == socket->connect(ADDRESS));
+                sockets.push_back(socket);
+            }
+
+            ASSERT(waitForChannels(NUM_CONNECTIONS));
+            LOOP_ASSERT(numChannelsUp, NUM_CONNECTIONS == numChannelsUp);
+
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&threadsMutex);
+                LOOP_ASSERT(threads.size(), 1 <= threads.size());
+                LOOP_ASSERT(threads.size(), NUM_THREADS >= threads.size());
+
+                if (verbose) {
+                    P(threads.size());
+                }
+            }
+
+            if (verbose) cout << "\tClosing every listener." << endl;
+
+            ASSERT(0 == pool.close(SERVER_ID));
+            ASSERT(0 != pool.close(SERVER_ID));
+
+            // The listening sockets are deallocated asynchronously, once
+            // their dispatcher threads have deregistered them.
+
+            bool isRefused = false;
+            for (int i = 0; i < 100 && !isRefused; ++i) {
+                btlso::StreamSocket<btlso::IPv4Address> *socket =
+                                                            factory.allocate();
+                isRefused = 0 != socket->connect(ADDRESS);
+                factory.deallocate(socket);
+                if (!isRefused) {
+                    bslmt::ThreadUtil::microSleep(10 * 1000);
+                }
+            }
+            ASSERT(isRefused);
+
+            for (int i = 0; i < NUM_CONNECTIONS; ++i) {
+                factory.deallocate(sockets[i]);
+            }
+
+            if (verbose) cout << "\tTesting the accept timeout." << endl;
+
+            ASSERT(0 == pool.listen(getLocalAddress(),
+                                    64,
+                                    TIMED_SERVER_ID,
+                                    bsls::TimeInterval(0.2)));
+
+            bslmt::ThreadUtil::microSleep(0, 1);
+
+            ASSERT(0 == pool.close(TIMED_SERVER_ID));
+
+            // About 5 timeouts are expected; one timer per listener would
+            // report about 20.
+
+            LOOP_ASSERT(numAcceptTimeouts, 1 <= numAcceptTimeouts);
+            LOOP_ASSERT(numAcceptTimeouts, 8 >= numAcceptTimeouts);
+
+            ASSERT(0 == pool.stop());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+}
+
 void TestDriver::testCase36()
 {
     // --------------------------------------------------------------------
@@ -15158,6 +16448,11 @@ int main(int argc, char **argv)
 
     switch (test) { case 0:  // Zero is always the leading case.
 #define CASE(NUMBER) case NUMBER: TestDriver::testCase##NUMBER(); break
+      CASE(42);
+      CASE(41);
+      CASE(40);
+      CASE(39);
+      CASE(38);
       CASE(37);
       CASE(36);
       CASE(35);
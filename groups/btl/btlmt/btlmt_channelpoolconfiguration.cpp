@@ -128,6 +128,41 @@ const bdlat_AttributeInfo
         sizeof("CollectTimeMetrics") - 1,      // name length
         "",// annotation
         bdlat_FormattingMode::e_DEFAULT
+    },
+    {
+        e_ATTRIBUTE_ID_REUSE_PORT_LISTENERS,
+        "ReusePortListeners",                  // name
+        sizeof("ReusePortListeners") - 1,      // name length
+        "",// annotation
+        bdlat_FormattingMode::e_DEFAULT
+    },
+    {
+        e_ATTRIBUTE_ID_ZERO_COPY_THRESHOLD,
+        "ZeroCopyThreshold",                   // name
+        sizeof("ZeroCopyThreshold") - 1,       // name length
+        "",// annotation
+        bdlat_FormattingMode::e_DEFAULT
+    },
+    {
+        e_ATTRIBUTE_ID_COALESCE_WRITES,
+        "CoalesceWrites",                      // name
+        sizeof("CoalesceWrites") - 1,          // name length
+        "",// annotation
+        bdlat_FormattingMode::e_DEFAULT
+    },
+    {
+        e_ATTRIBUTE_ID_COALESCING_INTERVAL,
+        "CoalescingInterval",                  // name
+        sizeof("CoalescingInterval") - 1,      // name length
+        "",// annotation
+        bdlat_FormattingMode::e_DEFAULT
+    },
+    {
+        e_ATTRIBUTE_ID_EVENT_MANAGER_TYPE,
+        "EventManagerType",                    // name
+        sizeof("EventManagerType") - 1,        // name length
+        "",// annotation
+        bdlat_FormattingMode::e_DEFAULT
     }
 };
 
@@ -188,6 +223,23 @@ const bdlat_AttributeInfo *ChannelPoolConfiguration::lookupAttributeInfo(
             return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_MAX_CONNECTIONS];
                                                                       // RETURN
         }
+        if (bsl::toupper(name[0])=='C'
+         && bsl::toupper(name[1])=='O'
+         && bsl::toupper(name[2])=='A'
+         && bsl::toupper(name[3])=='L'
+         && bsl::toupper(name[4])=='E'
+         && bsl::toupper(name[5])=='S'
+         && bsl::toupper(name[6])=='C'
+         && bsl::toupper(name[7])=='E'
+         && bsl::toupper(name[8])=='W'
+         && bsl::toupper(name[9])=='R'
+         && bsl::toupper(name[10])=='I'
+         && bsl::toupper(name[11])=='T'
+         && bsl::toupper(name[12])=='E'
+         && bsl::toupper(name[13])=='S') {
+            return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_COALESCE_WRITES];
+                                                                      // RETURN
+        }
       } break;
       case 15: {
         switch(bsl::toupper(name[0])) {
@@ -255,6 +307,27 @@ const bdlat_AttributeInfo *ChannelPoolConfiguration::lookupAttributeInfo(
       } break;
       case 16: {
         switch(bsl::toupper(name[0])) {
+          case 'E': {
+            if (bsl::toupper(name[1])=='V'
+             && bsl::toupper(name[2])=='E'
+             && bsl::toupper(name[3])=='N'
+             && bsl::toupper(name[4])=='T'
+             && bsl::toupper(name[5])=='M'
+             && bsl::toupper(name[6])=='A'
+             && bsl::toupper(name[7])=='N'
+             && bsl::toupper(name[8])=='A'
+             && bsl::toupper(name[9])=='G'
+             && bsl::toupper(name[10])=='E'
+             && bsl::toupper(name[11])=='R'
+             && bsl::toupper(name[12])=='T'
+             && bsl::toupper(name[13])=='Y'
+             && bsl::toupper(name[14])=='P'
+             && bsl::toupper(name[15])=='E') {
+                return
+                   &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_EVENT_MANAGER_TYPE];
+                                                                      // RETURN
+            }
+          } break;
           case 'M': {
             switch(bsl::toupper(name[1])) {
               case 'A': {
@@ -413,6 +486,28 @@ const bdlat_AttributeInfo *ChannelPoolConfiguration::lookupAttributeInfo(
                                                                       // RETURN
             }
           } break;
+          case 'Z': {
+            if (bsl::toupper(name[1])=='E'
+             && bsl::toupper(name[2])=='R'
+             && bsl::toupper(name[3])=='O'
+             && bsl::toupper(name[4])=='C'
+             && bsl::toupper(name[5])=='O'
+             && bsl::toupper(name[6])=='P'
+             && bsl::toupper(name[7])=='Y'
+             && bsl::toupper(name[8])=='T'
+             && bsl::toupper(name[9])=='H'
+             && bsl::toupper(name[10])=='R'
+             && bsl::toupper(name[11])=='E'
+             && bsl::toupper(name[12])=='S'
+             && bsl::toupper(name[13])=='H'
+             && bsl::toupper(name[14])=='O'
+             && bsl::toupper(name[15])=='L'
+             && bsl::toupper(name[16])=='D') {
+                return
+                  &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD];
+                                                                      // RETURN
+            }
+          } break;
         }
       } break;
       case 18: {
@@ -438,6 +533,50 @@ const bdlat_AttributeInfo *ChannelPoolConfiguration::lookupAttributeInfo(
                                        e_ATTRIBUTE_INDEX_COLLECT_TIME_METRICS];
                                                                       // RETURN
         }
+        if (bsl::toupper(name[0])=='R'
+         && bsl::toupper(name[1])=='E'
+         && bsl::toupper(name[2])=='U'
+         && bsl::toupper(name[3])=='S'
+         && bsl::toupper(name[4])=='E'
+         && bsl::toupper(name[5])=='P'
+         && bsl::toupper(name[6])=='O'
+         && bsl::toupper(name[7])=='R'
+         && bsl::toupper(name[8])=='T'
+         && bsl::toupper(name[9])=='L'
+         && bsl::toupper(name[10])=='I'
+         && bsl::toupper(name[11])=='S'
+         && bsl::toupper(name[12])=='T'
+         && bsl::toupper(name[13])=='E'
+         && bsl::toupper(name[14])=='N'
+         && bsl::toupper(name[15])=='E'
+         && bsl::toupper(name[16])=='R'
+         && bsl::toupper(name[17])=='S') {
+            return &ATTRIBUTE_INFO_ARRAY[
+                                       e_ATTRIBUTE_INDEX_REUSE_PORT_LISTENERS];
+                                                                      // RETURN
+        }
+        if (bsl::toupper(name[0])=='C'
+         && bsl::toupper(name[1])=='O'
+         && bsl::toupper(name[2])=='A'
+         && bsl::toupper(name[3])=='L'
+         && bsl::toupper(name[4])=='E'
+         && bsl::toupper(name[5])=='S'
+         && bsl::toupper(name[6])=='C'
+         && bsl::toupper(name[7])=='I'
+         && bsl::toupper(name[8])=='N'
+         && bsl::toupper(name[9])=='G'
+         && bsl::toupper(name[10])=='I'
+         && bsl::toupper(name[11])=='N'
+         && bsl::toupper(name[12])=='T'
+         && bsl::toupper(name[13])=='E'
+         && bsl::toupper(name[14])=='R'
+         && bsl::toupper(name[15])=='V'
+         && bsl::toupper(name[16])=='A'
+         && bsl::toupper(name[17])=='L') {
+            return &ATTRIBUTE_INFO_ARRAY[
+                                        e_ATTRIBUTE_INDEX_COALESCING_INTERVAL];
+                                                                      // RETURN
+        }
       } break;
     }
     return 0;
@@ -501,6 +640,26 @@ ChannelPoolConfiguration::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_COLLECT_TIME_METRICS];
                                                                       // RETURN
       }
+      case e_ATTRIBUTE_ID_REUSE_PORT_LISTENERS: {
+        return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_REUSE_PORT_LISTENERS];
+                                                                      // RETURN
+      }
+      case e_ATTRIBUTE_ID_ZERO_COPY_THRESHOLD: {
+        return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD];
+                                                                      // RETURN
+      }
+      case e_ATTRIBUTE_ID_COALESCE_WRITES: {
+        return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_COALESCE_WRITES];
+                                                                      // RETURN
+      }
+      case e_ATTRIBUTE_ID_COALESCING_INTERVAL: {
+        return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_COALESCING_INTERVAL];
+                                                                      // RETURN
+      }
+      case e_ATTRIBUTE_ID_EVENT_MANAGER_TYPE: {
+        return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_EVENT_MANAGER_TYPE];
+                                                                      // RETURN
+      }
 
       default:
         return 0;                                                     // RETURN
@@ -523,6 +682,11 @@ ChannelPoolConfiguration::ChannelPoolConfiguration()
 , d_maxMessageSizeIn(1024)
 , d_threadStackSize(k_DEFAULT_THREAD_STACK_SIZE)
 , d_collectTimeMetrics(true)
+, d_reusePortListeners(false)
+, d_zeroCopyThreshold(0)
+, d_coalesceWrites(false)
+, d_coalescingInterval(0)
+, d_eventManagerType(EventManagerType::e_DEFAULT)
 {
 }
 
@@ -542,6 +706,11 @@ ChannelPoolConfiguration::ChannelPoolConfiguration(
 , d_maxMessageSizeIn(original.d_maxMessageSizeIn)
 , d_threadStackSize(original.d_threadStackSize)
 , d_collectTimeMetrics(original.d_collectTimeMetrics)
+, d_reusePortListeners(original.d_reusePortListeners)
+, d_zeroCopyThreshold(original.d_zeroCopyThreshold)
+, d_coalesceWrites(original.d_coalesceWrites)
+, d_coalescingInterval(original.d_coalescingInterval)
+, d_eventManagerType(original.d_eventManagerType)
 {
 }
 
@@ -581,6 +750,11 @@ ChannelPoolConfiguration::operator=(const ChannelPoolConfiguration& rhs)
         d_maxMessageSizeIn   = rhs.d_maxMessageSizeIn;
         d_threadStackSize    = rhs.d_threadStackSize;
         d_collectTimeMetrics = rhs.d_collectTimeMetrics;
+        d_reusePortListeners = rhs.d_reusePortListeners;
+        d_zeroCopyThreshold  = rhs.d_zeroCopyThreshold;
+        d_coalesceWrites     = rhs.d_coalesceWrites;
+        d_coalescingInterval = rhs.d_coalescingInterval;
+        d_eventManagerType   = rhs.d_eventManagerType;
     }
     return *this;
 }
@@ -604,7 +778,12 @@ bool btlmt::operator==(const ChannelPoolConfiguration& lhs,
         && lhs.d_typMessageSizeIn   == rhs.d_typMessageSizeIn
         && lhs.d_maxMessageSizeIn   == rhs.d_maxMessageSizeIn
         && lhs.d_threadStackSize    == rhs.d_threadStackSize
-        && lhs.d_collectTimeMetrics == rhs.d_collectTimeMetrics;
+        && lhs.d_collectTimeMetrics == rhs.d_collectTimeMetrics
+        && lhs.d_reusePortListeners == rhs.d_reusePortListeners
+        && lhs.d_zeroCopyThreshold  == rhs.d_zeroCopyThreshold
+        && lhs.d_coalesceWrites     == rhs.d_coalesceWrites
+        && lhs.d_coalescingInterval == rhs.d_coalescingInterval
+        && lhs.d_eventManagerType   == rhs.d_eventManagerType;
 }
 
 bsl::ostream& btlmt::operator<<(bsl::ostream&                   output,
@@ -625,6 +804,15 @@ bsl::ostream& btlmt::operator<<(bsl::ostream&                   output,
            << "\tmaxIncomingMessageSize : " << config.d_maxMessageSizeIn <<"\n"
            << "\tthreadStackSize        : " << config.d_threadStackSize  <<"\n"
            << "\tcollectTimeMetrics     : " << config.d_collectTimeMetrics
+           << "\n"
+           << "\treusePortListeners     : " << config.d_reusePortListeners
+           << "\n"
+           << "\tzeroCopyThreshold      : " << config.d_zeroCopyThreshold
+           << "\n"
+           << "\tcoalesceWrites         : " << config.d_coalesceWrites  << "\n"
+           << "\tcoalescingInterval     : " << config.d_coalescingInterval
+           << "\n"
+           << "\teventManagerType       : " << config.eventManagerType()
            << "\n]\n";
 
     return output;
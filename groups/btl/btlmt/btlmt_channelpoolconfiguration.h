@@ -85,6 +85,49 @@ BSLS_IDENT("$Id: $")
 //                               processing data, and if this value
 //                               is 'false', those metrics will not
 //                               be collected.
+//
+//   bool    reusePortListeners  indicates whether the configured         false
+//                               channel pool opens one
+//                               'SO_REUSEPORT' listening socket per
+//                               managed thread for each server, and
+//                               keeps each accepted channel on the
+//                               thread that accepted it.  Ignored on
+//                               platforms that do not support
+//                               'SO_REUSEPORT'.
+//
+//   int     zeroCopyThreshold   minimum number of bytes in a single          0
+//                               send for the configured channel
+//                               pool to transmit blob data without
+//                               copying it into the kernel (using
+//                               'MSG_ZEROCOPY'); if this value is 0,
+//                               zero-copy sends are disabled.
+//                               Ignored on platforms that do not
+//                               support 'MSG_ZEROCOPY'.
+//
+//   bool    coalesceWrites      indicates whether the configured         false
+//                               channel pool gathers the messages
+//                               written to a channel within
+//                               'coalescingInterval' of one another
+//                               into as few 'writev' calls as
+//                               possible, instead of writing each
+//                               message from the calling thread.
+//
+//   double  coalescingInterval  maximum time (in seconds) that a             0
+//                               message written to a channel waits
+//                               for other messages to be gathered
+//                               with it when 'coalesceWrites' is
+//                               'true'; if this value is 0, the
+//                               messages written before the next
+//                               iteration of the channel's
+//                               dispatcher thread are gathered
+//
+//   int     eventManagerType    the 'btlmt::EventManagerType'      e_DEFAULT
+//                               of the socket event manager used
+//                               by each dispatcher thread of the
+//                               configured channel pool; a type
+//                               that is not supported on the
+//                               current platform is replaced by
+//                               'e_DEFAULT'
 //..
 // The constraints are as follows:
 //..
@@ -111,6 +154,13 @@ BSLS_IDENT("$Id: $")
 //   +--------------------+---------------------------------------------+
 //   | threadStackSize    | 0 <= threadStackSize                        |
 //   +--------------------+---------------------------------------------+
+//   | zeroCopyThreshold  | 0 <= zeroCopyThreshold                      |
+//   +--------------------+---------------------------------------------+
+//   | coalescingInterval | 0 <= coalescingInterval                     |
+//   +--------------------+---------------------------------------------+
+//   | eventManagerType   | 0 <= eventManagerType                       |
+//   |                    |   < btlmt::EventManagerType::e_LENGTH       |
+//   +--------------------+---------------------------------------------+
 //..
 //
 ///Thread Safety
@@ -199,6 +249,11 @@ BSLS_IDENT("$Id: $")
 //         maxIncomingMessageSize : 3
 //         threadStackSize        : 1024
 //         collectTimeMetrics     : 1
+//         reusePortListeners     : 0
+//         zeroCopyThreshold      : 0
+//         coalesceWrites         : 0
+//         coalescingInterval     : 0
+//         eventManagerType       : DEFAULT
 // ]
 //..
 
@@ -206,6 +261,10 @@ BSLS_IDENT("$Id: $")
 #include <btlscm_version.h>
 #endif
 
+#ifndef INCLUDED_BTLMT_EVENTMANAGERTYPE
+#include <btlmt_eventmanagertype.h>
+#endif
+
 #ifndef INCLUDED_BDLAT_ATTRIBUTEINFO
 #include <bdlat_attributeinfo.h>
 #endif
@@ -299,6 +358,22 @@ class ChannelPoolConfiguration {
 
     bool                  d_collectTimeMetrics;
 
+    bool                  d_reusePortListeners;  // one 'SO_REUSEPORT'
+                                                 // listener per thread
+
+    int                   d_zeroCopyThreshold;   // minimum size of a
+                                                 // zero-copy send (0 to
+                                                 // disable)
+
+    bool                  d_coalesceWrites;      // gather written messages
+
+    double                d_coalescingInterval;  // maximum time a message
+                                                 // waits to be gathered
+
+    int                   d_eventManagerType;    // socket event manager
+                                                 // type (an
+                                                 // 'EventManagerType::Value')
+
     friend bsl::ostream& operator<<(bsl::ostream&,
                                     const ChannelPoolConfiguration&);
 
@@ -308,7 +383,7 @@ class ChannelPoolConfiguration {
   public:
     // TYPES
     enum {
-        k_NUM_ATTRIBUTES = 14 // the number of attributes in this class
+        k_NUM_ATTRIBUTES = 19 // the number of attributes in this class
 
 
     };
@@ -353,9 +428,24 @@ class ChannelPoolConfiguration {
         e_ATTRIBUTE_INDEX_THREAD_STACK_SIZE    = 12,
             // index for 'ThreadStackSize' attribute
 
-        e_ATTRIBUTE_INDEX_COLLECT_TIME_METRICS = 13
+        e_ATTRIBUTE_INDEX_COLLECT_TIME_METRICS = 13,
             // index for 'CollectTimeMetrics' attribute
 
+        e_ATTRIBUTE_INDEX_REUSE_PORT_LISTENERS = 14,
+            // index for 'ReusePortListeners' attribute
+
+        e_ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD  = 15,
+            // index for 'ZeroCopyThreshold' attribute
+
+        e_ATTRIBUTE_INDEX_COALESCE_WRITES      = 16,
+            // index for 'CoalesceWrites' attribute
+
+        e_ATTRIBUTE_INDEX_COALESCING_INTERVAL  = 17,
+            // index for 'CoalescingInterval' attribute
+
+        e_ATTRIBUTE_INDEX_EVENT_MANAGER_TYPE   = 18
+            // index for 'EventManagerType' attribute
+
 
     };
 
@@ -399,9 +489,24 @@ class ChannelPoolConfiguration {
         e_ATTRIBUTE_ID_THREAD_STACK_SIZE       = 13,
             // id for 'ThreadStackSize' attribute
 
-        e_ATTRIBUTE_ID_COLLECT_TIME_METRICS    = 14
+        e_ATTRIBUTE_ID_COLLECT_TIME_METRICS    = 14,
             // id for 'CollectTimeMetrics' attribute
 
+        e_ATTRIBUTE_ID_REUSE_PORT_LISTENERS    = 15,
+            // id for 'ReusePortListeners' attribute
+
+        e_ATTRIBUTE_ID_ZERO_COPY_THRESHOLD     = 16,
+            // id for 'ZeroCopyThreshold' attribute
+
+        e_ATTRIBUTE_ID_COALESCE_WRITES         = 17,
+            // id for 'CoalesceWrites' attribute
+
+        e_ATTRIBUTE_ID_COALESCING_INTERVAL     = 18,
+            // id for 'CoalescingInterval' attribute
+
+        e_ATTRIBUTE_ID_EVENT_MANAGER_TYPE      = 19
+            // id for 'EventManagerType' attribute
+
 
     };
 
@@ -505,6 +610,61 @@ class ChannelPoolConfiguration {
         // estimate of work-load when it attempts to distribute work amongst
         // its managed threads.
 
+    int setReusePortListeners(bool reusePortListenersFlag);
+        // Set to the specified 'reusePortListenersFlag' whether the configured
+        // channel pool will open, for each server, one listening socket per
+        // managed thread, all bound to the same endpoint with 'SO_REUSEPORT'.
+        // Return 0.  If 'reusePortListenersFlag' is 'true', the operating
+        // system load-balances incoming connections across the listening
+        // sockets, and each accepted channel is managed by the thread whose
+        // listening socket accepted it; otherwise a single listening socket
+        // is opened and accepted channels are distributed across the managed
+        // threads.  Note that this value is ignored on platforms that do not
+        // support 'SO_REUSEPORT'.
+
+    int setZeroCopyThreshold(int numBytes);
+        // Set the zero-copy threshold attribute of this object to the
+        // specified 'numBytes' if '0 <= numBytes'.  Return 0 on success, and a
+        // non-zero value (with no effect on the state of this object)
+        // otherwise.  If 'numBytes' is positive, the configured channel pool
+        // sends blob data without copying it into the kernel whenever at
+        // least 'numBytes' are ready to be sent in a single system call, and
+        // keeps the blob buffers alive until the kernel reports that it no
+        // longer references them; a value of 0 disables zero-copy sends.  Note
+        // that this value is ignored on platforms that do not support
+        // 'MSG_ZEROCOPY'.
+
+    int setCoalesceWrites(bool coalesceWritesFlag);
+        // Set to the specified 'coalesceWritesFlag' whether the configured
+        // channel pool will gather the messages written to a channel within
+        // 'coalescingInterval' of one another into as few 'writev' calls as
+        // possible.  Return 0.  If 'coalesceWritesFlag' is 'true', a message
+        // written to a channel with no pending data is not written from the
+        // calling thread; instead, it and the messages written after it are
+        // written by the dispatcher thread of the channel once
+        // 'coalescingInterval' has elapsed, or as soon as they fill a single
+        // 'writev' call.  Note that this does not enable Nagle's algorithm on
+        // the underlying socket.
+
+    int setCoalescingInterval(double coalescingInterval);
+        // Set the coalescing interval attribute of this object to the
+        // specified 'coalescingInterval' (in seconds) if
+        // '0 <= coalescingInterval'.  Return 0 on success, and a non-zero
+        // value (with no effect on the state of this object) otherwise.  A
+        // value of 0 gathers the messages written before the next iteration
+        // of the dispatcher thread of the channel.  Note that this value is
+        // ignored unless 'coalesceWrites' is 'true'.
+
+    int setEventManagerType(EventManagerType::Value type);
+        // Set the event manager type attribute of this object to the
+        // specified 'type' if '0 <= type < EventManagerType::e_LENGTH'.
+        // Return 0 on success, and a non-zero value (with no effect on the
+        // state of this object) otherwise.  The dispatcher threads of the
+        // configured channel pool monitor their sockets with a socket event
+        // manager of this type, or with the default socket event manager if
+        // 'type' is not supported on the current platform (see
+        // 'btlmt_tcptimereventmanager').
+
     template<class MANIPULATOR>
     int manipulateAttributes(MANIPULATOR& manipulator);
         // Invoke the specified 'manipulator' sequentially on the address of
@@ -567,6 +727,30 @@ class ChannelPoolConfiguration {
         // pool cannot use that estimate of work-load when it attempts to
         // distribute work amongst its managed threads.
 
+    bool reusePortListeners() const;
+        // Return 'true' if the configured channel pool will open one
+        // 'SO_REUSEPORT' listening socket per managed thread for each server,
+        // and 'false' otherwise.
+
+    int zeroCopyThreshold() const;
+        // Return the minimum number of bytes sent in a single system call for
+        // the configured channel pool to send them without copying, or 0 if
+        // zero-copy sends are disabled.
+
+    bool coalesceWrites() const;
+        // Return 'true' if the configured channel pool will gather the
+        // messages written to a channel into as few 'writev' calls as
+        // possible, and 'false' otherwise.
+
+    const double& coalescingInterval() const;
+        // Return the maximum time (in seconds) that a message written to a
+        // channel waits for other messages to be gathered with it, if
+        // 'coalesceWrites' is 'true'.
+
+    EventManagerType::Value eventManagerType() const;
+        // Return the type of the socket event manager requested for the
+        // dispatcher threads of the configured channel pool.
+
     const double& metricsInterval() const;
         // Return the metrics interval attribute of this object.
 
@@ -743,6 +927,53 @@ int ChannelPoolConfiguration::setCollectTimeMetrics(
     return 0;
 }
 
+inline
+int ChannelPoolConfiguration::setReusePortListeners(
+                                                   bool reusePortListenersFlag)
+{
+    d_reusePortListeners = reusePortListenersFlag;
+    return 0;
+}
+
+inline
+int ChannelPoolConfiguration::setZeroCopyThreshold(int numBytes)
+{
+    if (0 <= numBytes) {
+        d_zeroCopyThreshold = numBytes;
+        return 0;                                                     // RETURN
+    }
+    return -1;
+}
+
+inline
+int ChannelPoolConfiguration::setCoalesceWrites(bool coalesceWritesFlag)
+{
+    d_coalesceWrites = coalesceWritesFlag;
+    return 0;
+}
+
+inline
+int ChannelPoolConfiguration::setCoalescingInterval(double coalescingInterval)
+{
+    if (0 <= coalescingInterval) {
+        d_coalescingInterval = coalescingInterval;
+        return 0;                                                     // RETURN
+    }
+    return -1;
+}
+
+inline
+int ChannelPoolConfiguration::setEventManagerType(
+                                                  EventManagerType::Value type)
+{
+    const int value = static_cast<int>(type);
+    if (0 <= value && value < EventManagerType::e_LENGTH) {
+        d_eventManagerType = type;
+        return 0;                                                     // RETURN
+    }
+    return -1;
+}
+
 template <class MANIPULATOR>
 int ChannelPoolConfiguration::manipulateAttributes(MANIPULATOR& manipulator)
 {
@@ -843,6 +1074,41 @@ int ChannelPoolConfiguration::manipulateAttributes(MANIPULATOR& manipulator)
         return ret;                                                   // RETURN
     }
 
+    ret = manipulator(
+                 &d_reusePortListeners,
+                 ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_REUSE_PORT_LISTENERS]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
+    ret = manipulator(
+                  &d_zeroCopyThreshold,
+                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
+    ret = manipulator(
+                      &d_coalesceWrites,
+                      ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_COALESCE_WRITES]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
+    ret = manipulator(
+                  &d_coalescingInterval,
+                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_COALESCING_INTERVAL]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
+    ret = manipulator(
+                   &d_eventManagerType,
+                   ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_EVENT_MANAGER_TYPE]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
     return ret;
 }
 
@@ -937,6 +1203,36 @@ int ChannelPoolConfiguration::manipulateAttribute(MANIPULATOR& manipulator,
                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_COLLECT_TIME_METRICS]);
                                                                       // RETURN
       } break;
+      case e_ATTRIBUTE_ID_REUSE_PORT_LISTENERS: {
+        return manipulator(
+                 &d_reusePortListeners,
+                 ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_REUSE_PORT_LISTENERS]);
+                                                                      // RETURN
+      } break;
+      case e_ATTRIBUTE_ID_ZERO_COPY_THRESHOLD: {
+        return manipulator(
+                  &d_zeroCopyThreshold,
+                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD]);
+                                                                      // RETURN
+      } break;
+      case e_ATTRIBUTE_ID_COALESCE_WRITES: {
+        return manipulator(
+                      &d_coalesceWrites,
+                      ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_COALESCE_WRITES]);
+                                                                      // RETURN
+      } break;
+      case e_ATTRIBUTE_ID_COALESCING_INTERVAL: {
+        return manipulator(
+                  &d_coalescingInterval,
+                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_COALESCING_INTERVAL]);
+                                                                      // RETURN
+      } break;
+      case e_ATTRIBUTE_ID_EVENT_MANAGER_TYPE: {
+        return manipulator(
+                   &d_eventManagerType,
+                   ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_EVENT_MANAGER_TYPE]);
+                                                                      // RETURN
+      } break;
 
       default:
         return k_NOT_FOUND;                                           // RETURN
@@ -1047,6 +1343,31 @@ bool ChannelPoolConfiguration::collectTimeMetrics() const {
     return d_collectTimeMetrics;
 }
 
+inline
+bool ChannelPoolConfiguration::reusePortListeners() const {
+    return d_reusePortListeners;
+}
+
+inline
+int ChannelPoolConfiguration::zeroCopyThreshold() const {
+    return d_zeroCopyThreshold;
+}
+
+inline
+bool ChannelPoolConfiguration::coalesceWrites() const {
+    return d_coalesceWrites;
+}
+
+inline
+const double& ChannelPoolConfiguration::coalescingInterval() const {
+    return d_coalescingInterval;
+}
+
+inline
+EventManagerType::Value ChannelPoolConfiguration::eventManagerType() const {
+    return static_cast<EventManagerType::Value>(d_eventManagerType);
+}
+
 template <class ACCESSOR>
 int ChannelPoolConfiguration::accessAttributes(ACCESSOR& accessor) const
 {
@@ -1144,6 +1465,41 @@ int ChannelPoolConfiguration::accessAttributes(ACCESSOR& accessor) const
         return ret;                                                   // RETURN
     }
 
+    ret = accessor(
+                 d_reusePortListeners,
+                 ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_REUSE_PORT_LISTENERS]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
+    ret = accessor(
+                  d_zeroCopyThreshold,
+                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
+    ret = accessor(
+                      d_coalesceWrites,
+                      ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_COALESCE_WRITES]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
+    ret = accessor(
+                  d_coalescingInterval,
+                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_COALESCING_INTERVAL]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
+    ret = accessor(
+                   d_eventManagerType,
+                   ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_EVENT_MANAGER_TYPE]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
     return ret;
 }
 
@@ -1236,6 +1592,36 @@ ChannelPoolConfiguration::accessAttribute(ACCESSOR& accessor, int id) const
                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_COLLECT_TIME_METRICS]);
                                                                       // RETURN
       } break;
+      case e_ATTRIBUTE_ID_REUSE_PORT_LISTENERS: {
+        return accessor(
+                 d_reusePortListeners,
+                 ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_REUSE_PORT_LISTENERS]);
+                                                                      // RETURN
+      } break;
+      case e_ATTRIBUTE_ID_ZERO_COPY_THRESHOLD: {
+        return accessor(
+                  d_zeroCopyThreshold,
+                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD]);
+                                                                      // RETURN
+      } break;
+      case e_ATTRIBUTE_ID_COALESCE_WRITES: {
+        return accessor(
+                      d_coalesceWrites,
+                      ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_COALESCE_WRITES]);
+                                                                      // RETURN
+      } break;
+      case e_ATTRIBUTE_ID_COALESCING_INTERVAL: {
+        return accessor(
+                  d_coalescingInterval,
+                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_COALESCING_INTERVAL]);
+                                                                      // RETURN
+      } break;
+      case e_ATTRIBUTE_ID_EVENT_MANAGER_TYPE: {
+        return accessor(
+                   d_eventManagerType,
+                   ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_EVENT_MANAGER_TYPE]);
+                                                                      // RETURN
+      } break;
 
       default:
         return k_NOT_FOUND;                                           // RETURN
@@ -41,6 +41,11 @@ using namespace bsl;  // automatically added by script
 // [ 2] int setMaxThreads(int maxThreads);
 // [ 2] int setMetricsInterval(double metricsInterval);
 // [ 2] int setReadTimeout(double readTimeout);
+// [ 1] int setReusePortListeners(bool reusePortListenersFlag);
+// [ 2] int setZeroCopyThreshold(int numBytes);
+// [ 1] int setCoalesceWrites(bool coalesceWritesFlag);
+// [ 2] int setCoalescingInterval(double coalescingInterval);
+// [ 2] int setEventManagerType(EventManagerType::Value type);
 // [ 1] int minIncomingMessageSize() const;
 // [ 1] int typicalIncomingMessageSize() const;
 // [ 1] int maxIncomingMessageSize() const;
@@ -51,6 +56,11 @@ using namespace bsl;  // automatically added by script
 // [ 1] int maxThreads() const;
 // [ 1] double metricsInterval() const;
 // [ 1] double readTimeout() const;
+// [ 1] bool reusePortListeners() const;
+// [ 1] int zeroCopyThreshold() const;
+// [ 1] bool coalesceWrites() const;
+// [ 1] double coalescingInterval() const;
+// [ 1] EventManagerType::Value eventManagerType() const;
 //
 // [ 1] bool operator==(const btlmt::ChannelPoolConfiguration& lhs, ...
 // [ 1] bool operator!=(const btlmt::ChannelPoolConfiguration& lhs, ...
@@ -142,6 +152,21 @@ const int THREADSTACKSIZE[NUM_VALUES]  = { 1048576, 512, 600, 700, 800, 900,
                                                                          999 };
 const bool COLLECTMETRICS[NUM_VALUES] =
                                      { true, false, true, false, true, false };
+const bool REUSEPORTLISTENERS[NUM_VALUES] =
+                                     { false, true, false, true, false, true };
+const int ZEROCOPYTHRESHOLD[NUM_VALUES] = { 0, 65536, 1, 2, 1048576, 3 };
+const bool COALESCEWRITES[NUM_VALUES] =
+                                     { false, true, false, true, false, true };
+const double COALESCINGINTERVAL[NUM_VALUES] =
+                                     { 0, 0.0001, 0.5, 1, 0.00005, 2.25 };
+const btlmt::EventManagerType::Value EVENTMANAGERTYPE[NUM_VALUES] = {
+    btlmt::EventManagerType::e_DEFAULT,
+    btlmt::EventManagerType::e_FLAT_EPOLL,
+    btlmt::EventManagerType::e_DEFAULT,
+    btlmt::EventManagerType::e_FLAT_EPOLL,
+    btlmt::EventManagerType::e_DEFAULT,
+    btlmt::EventManagerType::e_FLAT_EPOLL
+};
 
 //=============================================================================
 //                             HELPER CLASSES
@@ -348,6 +373,11 @@ int main(int argc, char *argv[])
                 "\tmaxIncomingMessageSize : 3" NL
                 "\tthreadStackSize        : 1024" NL
                 "\tcollectTimeMetrics     : 1" NL
+                "\treusePortListeners     : 0" NL
+                "\tzeroCopyThreshold      : 0" NL
+                "\tcoalesceWrites         : 0" NL
+                "\tcoalescingInterval     : 0" NL
+                "\teventManagerType       : DEFAULT" NL
                 "]" NL
                 ;
             ASSERT(os.str().c_str() == s);
@@ -380,7 +410,7 @@ int main(int argc, char *argv[])
                           << "\n==========================" << endl;
 
         enum {
-            NUM_ATTRIBUTES = 14
+            NUM_ATTRIBUTES = 19
         };
 
         ASSERT(NUM_ATTRIBUTES == Obj::k_NUM_ATTRIBUTES);
@@ -390,7 +420,8 @@ int main(int argc, char *argv[])
         "MinMessageSizeOut", "TypMessageSizeOut", "MaxMessageSizeOut",
         "MinMessageSizeIn", "TypMessageSizeIn", "MaxMessageSizeIn",
         "WriteCacheLowWat", "WriteCacheHiWat", "ThreadStackSize",
-        "CollectTimeMetrics"
+        "CollectTimeMetrics", "ReusePortListeners", "ZeroCopyThreshold",
+        "CoalesceWrites", "CoalescingInterval", "EventManagerType"
         };
 
         const int NUM_NAMES = sizeof NAMES / sizeof *NAMES;
@@ -564,13 +595,55 @@ int main(int argc, char *argv[])
                                                                     visitor,
                                                                     j + 1));
                   } break;
+                  case 14: {
+                    ASSERT(0 == mA.setReusePortListeners(
+                                                       REUSEPORTLISTENERS[i]));
+                    AssignValue<bool> visitor(REUSEPORTLISTENERS[i]);
+                    LOOP2_ASSERT(i, j, 0 ==
+                       bdlat_SequenceFunctions::manipulateAttribute(&mB,
+                                                                    visitor,
+                                                                    j + 1));
+                  } break;
+                  case 15: {
+                    ASSERT(0 == mA.setZeroCopyThreshold(ZEROCOPYTHRESHOLD[i]));
+                    AssignValue<int> visitor(ZEROCOPYTHRESHOLD[i]);
+                    LOOP2_ASSERT(i, j, 0 ==
+                       bdlat_SequenceFunctions::manipulateAttribute(&mB,
+                                                                    visitor,
+                                                                    j + 1));
+                  } break;
+                  case 16: {
+                    ASSERT(0 == mA.setCoalesceWrites(COALESCEWRITES[i]));
+                    AssignValue<bool> visitor(COALESCEWRITES[i]);
+                    LOOP2_ASSERT(i, j, 0 ==
+                       bdlat_SequenceFunctions::manipulateAttribute(&mB,
+                                                                    visitor,
+                                                                    j + 1));
+                  } break;
+                  case 17: {
+                    ASSERT(0 == mA.setCoalescingInterval(
+                                                       COALESCINGINTERVAL[i]));
+                    AssignValue<double> visitor(COALESCINGINTERVAL[i]);
+                    LOOP2_ASSERT(i, j, 0 ==
+                       bdlat_SequenceFunctions::manipulateAttribute(&mB,
+                                                                    visitor,
+                                                                    j + 1));
+                  } break;
+                  case 18: {
+                    ASSERT(0 == mA.setEventManagerType(EVENTMANAGERTYPE[i]));
+                    AssignValue<int> visitor(EVENTMANAGERTYPE[i]);
+                    LOOP2_ASSERT(i, j, 0 ==
+                       bdlat_SequenceFunctions::manipulateAttribute(&mB,
+                                                                    visitor,
+                                                                    j + 1));
+                  } break;
 
                   default:
                     ASSERT(0);
                 }
                 LOOP2_ASSERT(i, j, mA == mB);
 
-                if (j == 2 || j == 3) {
+                if (j == 2 || j == 3 || j == 17) {
                     double value;
                     GetValue<double> gvisitor(&value);
                     ASSERT(0 ==
@@ -582,7 +655,7 @@ int main(int argc, char *argv[])
                                                                   avisitor,
                                                                   j + 1));
                 }
-                else if (j == 13) {
+                else if (j == 13 || j == 14 || j == 16) {
                     bool value;
                     GetValue<bool> gvisitor(&value);
                     ASSERT(0 ==
@@ -641,6 +714,37 @@ int main(int argc, char *argv[])
             ASSERT(0 == mX1.setMaxThreads(1));
             ASSERT(1 == X1.maxThreads());
         }
+        if (verbose) cout << "\t Check zeroCopyThreshold contraint. " << endl;
+        {
+            ASSERT(0 != mX1.setZeroCopyThreshold(-1));
+            ASSERT(ZEROCOPYTHRESHOLD[0] == X1.zeroCopyThreshold());
+            ASSERT(0 == mX1.setZeroCopyThreshold(1));
+            ASSERT(1 == X1.zeroCopyThreshold());
+            ASSERT(0 == mX1.setZeroCopyThreshold(0));
+            ASSERT(0 == X1.zeroCopyThreshold());
+        }
+        if (verbose) cout << "\t Check coalescingInterval contraint. " << endl;
+        {
+            ASSERT(0 != mX1.setCoalescingInterval(-0.1));
+            ASSERT(COALESCINGINTERVAL[0] == X1.coalescingInterval());
+            ASSERT(0 == mX1.setCoalescingInterval(0.1));
+            ASSERT(0.1 == X1.coalescingInterval());
+            ASSERT(0 == mX1.setCoalescingInterval(0.0));
+            ASSERT(0.0 == X1.coalescingInterval());
+        }
+        if (verbose) cout << "\t Check eventManagerType contraint. " << endl;
+        {
+            typedef btlmt::EventManagerType EMT;
+
+            ASSERT(0 != mX1.setEventManagerType((EMT::Value)-1));
+            ASSERT(EVENTMANAGERTYPE[0] == X1.eventManagerType());
+            ASSERT(0 != mX1.setEventManagerType((EMT::Value)EMT::e_LENGTH));
+            ASSERT(EVENTMANAGERTYPE[0] == X1.eventManagerType());
+            ASSERT(0 == mX1.setEventManagerType(EMT::e_FLAT_EPOLL));
+            ASSERT(EMT::e_FLAT_EPOLL == X1.eventManagerType());
+            ASSERT(0 == mX1.setEventManagerType(EMT::e_DEFAULT));
+            ASSERT(EMT::e_DEFAULT == X1.eventManagerType());
+        }
         if (verbose) cout << "\t Check readTimeOut contraint. " << endl;
         {
             ASSERT(0 != mX1.setReadTimeout(-1.1));
@@ -1136,6 +1240,166 @@ int main(int argc, char *argv[])
 
         // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
+        if (verbose) cout << "\t Change attribute 8." << endl;
+
+        ASSERT(0 == mX1.setReusePortListeners(REUSEPORTLISTENERS[1]));
+        ASSERT(   COLLECTMETRICS[0] == X1.collectTimeMetrics());
+        ASSERT(REUSEPORTLISTENERS[1] == X1.reusePortListeners());
+
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(0 == (X1 == Z1));          ASSERT(1 == (X1 != Z1));
+        ASSERT(0 == (Z1 == X1));          ASSERT(1 == (Z1 != X1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+        {
+            Obj C(X1);
+            ASSERT(C == X1 == 1);          ASSERT(C != X1 == 0);
+        }
+
+        mY1 = X1;
+        ASSERT(1 == (Y1 == Y1));          ASSERT(0 == (Y1 != Y1));
+        ASSERT(1 == (Y1 == X1));          ASSERT(0 == (Y1 != X1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        ASSERT(0 == mX1.setReusePortListeners(REUSEPORTLISTENERS[0]));
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        mX1 = mY1 = Z1;
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+        if (verbose) cout << "\t Change attribute 9." << endl;
+
+        ASSERT(0 == mX1.setZeroCopyThreshold(ZEROCOPYTHRESHOLD[1]));
+        ASSERT(REUSEPORTLISTENERS[0] == X1.reusePortListeners());
+        ASSERT( ZEROCOPYTHRESHOLD[1] == X1.zeroCopyThreshold());
+
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(0 == (X1 == Z1));          ASSERT(1 == (X1 != Z1));
+        ASSERT(0 == (Z1 == X1));          ASSERT(1 == (Z1 != X1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+        {
+            Obj C(X1);
+            ASSERT(C == X1 == 1);          ASSERT(C != X1 == 0);
+        }
+
+        mY1 = X1;
+        ASSERT(1 == (Y1 == Y1));          ASSERT(0 == (Y1 != Y1));
+        ASSERT(1 == (Y1 == X1));          ASSERT(0 == (Y1 != X1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        ASSERT(0 == mX1.setZeroCopyThreshold(ZEROCOPYTHRESHOLD[0]));
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        mX1 = mY1 = Z1;
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+        if (verbose) cout << "\t Change attribute 10." << endl;
+
+        ASSERT(0 == mX1.setCoalesceWrites(COALESCEWRITES[1]));
+        ASSERT(ZEROCOPYTHRESHOLD[0] == X1.zeroCopyThreshold());
+        ASSERT(COALESCEWRITES[1] == X1.coalesceWrites());
+
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(0 == (X1 == Z1));          ASSERT(1 == (X1 != Z1));
+        ASSERT(0 == (Z1 == X1));          ASSERT(1 == (Z1 != X1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+        {
+            Obj C(X1);
+            ASSERT(C == X1 == 1);          ASSERT(C != X1 == 0);
+        }
+
+        mY1 = X1;
+        ASSERT(1 == (Y1 == Y1));          ASSERT(0 == (Y1 != Y1));
+        ASSERT(1 == (Y1 == X1));          ASSERT(0 == (Y1 != X1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        ASSERT(0 == mX1.setCoalesceWrites(COALESCEWRITES[0]));
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        mX1 = mY1 = Z1;
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+        if (verbose) cout << "\t Change attribute 11." << endl;
+
+        ASSERT(0 == mX1.setCoalescingInterval(COALESCINGINTERVAL[1]));
+        ASSERT(COALESCEWRITES[0] == X1.coalesceWrites());
+        ASSERT(COALESCINGINTERVAL[1] == X1.coalescingInterval());
+
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(0 == (X1 == Z1));          ASSERT(1 == (X1 != Z1));
+        ASSERT(0 == (Z1 == X1));          ASSERT(1 == (Z1 != X1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+        {
+            Obj C(X1);
+            ASSERT(C == X1 == 1);          ASSERT(C != X1 == 0);
+        }
+
+        mY1 = X1;
+        ASSERT(1 == (Y1 == Y1));          ASSERT(0 == (Y1 != Y1));
+        ASSERT(1 == (Y1 == X1));          ASSERT(0 == (Y1 != X1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        ASSERT(0 == mX1.setCoalescingInterval(COALESCINGINTERVAL[0]));
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        mX1 = mY1 = Z1;
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+        if (verbose) cout << "\t Change attribute 12." << endl;
+
+        ASSERT(0 == mX1.setEventManagerType(EVENTMANAGERTYPE[1]));
+        ASSERT(COALESCINGINTERVAL[0] == X1.coalescingInterval());
+        ASSERT(EVENTMANAGERTYPE[1] == X1.eventManagerType());
+
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(0 == (X1 == Z1));          ASSERT(1 == (X1 != Z1));
+        ASSERT(0 == (Z1 == X1));          ASSERT(1 == (Z1 != X1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+        {
+            Obj C(X1);
+            ASSERT(C == X1 == 1);          ASSERT(C != X1 == 0);
+        }
+
+        mY1 = X1;
+        ASSERT(1 == (Y1 == Y1));          ASSERT(0 == (Y1 != Y1));
+        ASSERT(1 == (Y1 == X1));          ASSERT(0 == (Y1 != X1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        ASSERT(0 == mX1.setEventManagerType(EVENTMANAGERTYPE[0]));
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        mX1 = mY1 = Z1;
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
         if (verbose) cout << "Testing output operator (<<)." << endl;
 
         ASSERT(0 == mY1.setIncomingMessageSizes(MINMESSAGESIZEIN[1],
@@ -1172,6 +1436,11 @@ int main(int argc, char *argv[])
                 "\tmaxIncomingMessageSize : 1024" NL
                 "\tthreadStackSize        : 1048576" NL
                 "\tcollectTimeMetrics     : 1" NL
+                "\treusePortListeners     : 0" NL
+                "\tzeroCopyThreshold      : 0" NL
+                "\tcoalesceWrites         : 0" NL
+                "\tcoalescingInterval     : 0" NL
+                "\teventManagerType       : DEFAULT" NL
                 "]" NL
                 ;
             ASSERT(buf == s);
@@ -1196,6 +1465,11 @@ int main(int argc, char *argv[])
                 "\tmaxIncomingMessageSize : 17" NL
                 "\tthreadStackSize        : 512" NL
                 "\tcollectTimeMetrics     : 1" NL
+                "\treusePortListeners     : 0" NL
+                "\tzeroCopyThreshold      : 0" NL
+                "\tcoalesceWrites         : 0" NL
+                "\tcoalescingInterval     : 0" NL
+                "\teventManagerType       : DEFAULT" NL
                 "]" NL
                 ;
             ASSERT(buf == s);
@@ -0,0 +1,55 @@
+// btlmt_eventmanagertype.cpp                                         -*-C++-*-
+#include <btlmt_eventmanagertype.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(btlmt_eventmanagertype_cpp,"$Id$ $CSID$")
+
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+
+namespace btlmt {
+
+                        // -----------------------
+                        // struct EventManagerType
+                        // -----------------------
+
+const char *EventManagerType::toAscii(Value type)
+{
+#define CASE(X) case(e_ ## X): return #X
+
+    switch (type) {
+      CASE(DEFAULT);
+      CASE(FLAT_EPOLL);
+      CASE(IO_URING);
+      default: return "(* UNKNOWN *)";
+    }
+
+#undef CASE
+}
+
+}  // close package namespace
+
+bsl::ostream& btlmt::operator<<(bsl::ostream&           output,
+                                EventManagerType::Value rhs)
+{
+    return output << EventManagerType::toAscii(rhs);
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
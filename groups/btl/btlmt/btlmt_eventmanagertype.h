@@ -0,0 +1,134 @@
+// btlmt_eventmanagertype.h                                           -*-C++-*-
+#ifndef INCLUDED_BTLMT_EVENTMANAGERTYPE
+#define INCLUDED_BTLMT_EVENTMANAGERTYPE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Enumerate the socket event managers a dispatcher can be built on.
+//
+//@CLASSES:
+//   btlmt::EventManagerType: namespace for enumerating event manager types
+//
+//@SEE_ALSO: btlmt_tcptimereventmanager, btlmt_channelpoolconfiguration
+//
+//@DESCRIPTION: This component provides a namespace, 'btlmt::EventManagerType',
+// for enumerating the implementations of the 'btlso::EventManager' protocol
+// that a 'btlmt::TcpTimerEventManager' (and hence a 'btlmt::ChannelPool') can
+// use to monitor its sockets, and provides a function that converts each of
+// these enumerators to their corresponding string representation.
+// Functionality is also provided to write the string form directly to a
+// standard 'ostream'.
+//
+///Enumerators
+///-----------
+//..
+//  Name          Description
+//  ------------  -------------------------------------------------------------
+//  e_DEFAULT     'btlso::DefaultEventManager<>' (or, on Linux, the 'POLL'
+//                specialization if 'epoll' is not supported)
+//
+//  e_FLAT_EPOLL  'btlso::DefaultEventManager<btlso::Platform::FLAT_EPOLL>';
+//                equivalent to 'e_DEFAULT' on platforms other than Linux
+//
+//  e_IO_URING    'btlso::DefaultEventManager<btlso::Platform::IO_URING>';
+//                equivalent to 'e_DEFAULT' on platforms other than Linux, and
+//                on Linux kernels that do not support 'io_uring'
+//..
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Basic Syntax
+///- - - - - - - - - - - -
+// First, create a variable 'type' of type 'btlmt::EventManagerType::Value'
+// and initialize it to the value 'btlmt::EventManagerType::e_FLAT_EPOLL':
+//..
+//  btlmt::EventManagerType::Value type =
+//                                       btlmt::EventManagerType::e_FLAT_EPOLL;
+//..
+// Next, store its representation in a variable 'rep' of type 'const char*'.
+//..
+//  const char *rep = btlmt::EventManagerType::toAscii(type);
+//  assert(0 == strcmp(rep, "FLAT_EPOLL"));
+//..
+// Finally, print the value of 'type' to 'stdout'.
+//..
+//  bsl::cout << type << bsl::endl;
+//..
+// This statement produces the following output on 'stdout':
+//..
+//  FLAT_EPOLL
+//..
+
+#ifndef INCLUDED_BTLSCM_VERSION
+#include <btlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSL_IOSFWD
+#include <bsl_iosfwd.h>
+#endif
+
+namespace BloombergLP {
+
+namespace btlmt {
+
+                        // =======================
+                        // struct EventManagerType
+                        // =======================
+
+struct EventManagerType {
+    // This class provides a namespace for enumerating the types of socket
+    // event manager.
+
+  public:
+    // TYPES
+    enum Value {
+        e_DEFAULT,
+        e_FLAT_EPOLL,
+        e_IO_URING
+    };
+
+    enum {
+        // Define 'LENGTH' to be the number of consecutively valued enumerators
+        // in the range '[ e_DEFAULT .. e_IO_URING ]'.
+
+        e_LENGTH = e_IO_URING + 1
+    };
+
+    // CLASS METHODS
+    static const char *toAscii(Value type);
+        // Return the string representation of the enumerator corresponding to
+        // the specified 'type'.  This representation corresponds exactly to
+        // the enumerator's name (e.g., "FLAT_EPOLL").
+};
+
+// FREE OPERATORS
+bsl::ostream& operator<<(bsl::ostream& stream, EventManagerType::Value rhs);
+    // Format to the specified output 'stream' the specified 'rhs' event
+    // manager type in a string representation matching the enumerator name
+    // (e.g., "FLAT_EPOLL"), and return a reference to the modifiable 'stream'.
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -143,6 +143,17 @@ static btlmt::ChannelPool::ConnectResolutionMode mapResolutionMode(
     return btlmt::ChannelPool::e_RESOLVE_ONCE;
 }
 
+static btlmt::ChannelPool::ConnectAddressFamily mapAddressFamily(
+                               btlmt::SessionPool::ConnectAddressFamily family)
+{
+    if (btlmt::SessionPool::e_CONNECT_DUAL_STACK == family) {
+        return btlmt::ChannelPool::e_CONNECT_DUAL_STACK;              // RETURN
+    }
+
+    BSLS_ASSERT(btlmt::SessionPool::e_CONNECT_IPV4 == family);
+    return btlmt::ChannelPool::e_CONNECT_IPV4;
+}
+
                           // -----------------
                           // class SessionPool
                           // -----------------
@@ -501,6 +512,25 @@ int SessionPool::makeConnectHandle(
     return (handle->d_handleId = d_handles.add(handle));
 }
 
+int SessionPool::makeListenHandle(
+                            const SessionPool::SessionStateCallback&  cb,
+                            void                                     *userData,
+                            SessionFactory                           *factory)
+{
+    HandlePtr handle(new (*d_allocator_p) SessionPool_Handle(),
+                     bdlf::MemFnUtil::memFn(&SessionPool::handleDeleter, this),
+                     d_allocator_p);
+
+    handle->d_type             = SessionPool_Handle::e_LISTENER;
+    handle->d_sessionStateCB   = cb;
+    handle->d_session_p        = 0;
+    handle->d_channel_p        = 0;
+    handle->d_userData_p       = userData;
+    handle->d_sessionFactory_p = factory;
+
+    return (handle->d_handleId = d_handles.add(handle));
+}
+
 void SessionPool::sessionAllocationCb(int      result,
                                       Session *session,
                                       int      handleId)
@@ -824,6 +854,52 @@ int SessionPool::connect(
     return 0;
 }
 
+int SessionPool::connect(
+                      int                                      *handleBuffer,
+                      const SessionPool::SessionStateCallback&  cb,
+                      const char                               *hostname,
+                      int                                       port,
+                      ConnectAddressFamily                      addressFamily,
+                      int                                       numAttempts,
+                      const bsls::TimeInterval&                 interval,
+                      SessionFactory                           *factory,
+                      void                                     *userData,
+                      ConnectResolutionMode                     resolutionMode,
+                      const btlso::SocketOptions               *socketOptions,
+                      const btlso::IPv6Address                 *localAddress)
+{
+    BSLS_ASSERT(d_channelPool_p);
+
+    if (0 == d_channelPool_p->numThreads()) {
+        // Going down.
+
+        return -1;                                                    // RETURN
+    }
+
+    int handleId = makeConnectHandle(cb, numAttempts, userData, factory);
+    *handleBuffer = handleId;
+
+    int ret = d_channelPool_p->connect(hostname,
+                                       port,
+                                       mapAddressFamily(addressFamily),
+                                       numAttempts,
+                                       interval,
+                                       handleId,
+                                       mapResolutionMode(resolutionMode),
+                                       false,
+                                       ChannelPool::e_CLOSE_BOTH,
+                                       socketOptions,
+                                       localAddress);
+    if (ret) {
+        HandlePtr handle;
+        int rc = d_handles.remove(handleId, &handle);
+        BSLS_ASSERT(0 == rc);
+        handle->d_handleId = 0; // Do not call back anybody
+        return ret;                                                   // RETURN
+    }
+    return 0;
+}
+
 int SessionPool::connect(
                        int                                      *handleBuffer,
                        const SessionPool::SessionStateCallback&  cb,
@@ -863,6 +939,45 @@ int SessionPool::connect(
     return 0;
 }
 
+int SessionPool::connect(
+                       int                                      *handleBuffer,
+                       const SessionPool::SessionStateCallback&  cb,
+                       const btlso::IPv6Address&                 endpoint,
+                       int                                       numAttempts,
+                       const bsls::TimeInterval&                 interval,
+                       SessionFactory                           *factory,
+                       void                                     *userData,
+                       const btlso::SocketOptions               *socketOptions,
+                       const btlso::IPv6Address                 *localAddress)
+{
+    BSLS_ASSERT(d_channelPool_p);
+
+    if (0 == d_channelPool_p->numThreads()) {
+        // Going down.
+
+        return -1;                                                    // RETURN
+    }
+
+    int handleId = makeConnectHandle(cb, numAttempts, userData, factory);
+    *handleBuffer = handleId;
+
+    int ret = d_channelPool_p->connect(endpoint,
+                                       numAttempts,
+                                       interval,
+                                       handleId,
+                                       false,
+                                       ChannelPool::e_CLOSE_BOTH,
+                                       socketOptions,
+                                       localAddress);
+    if (ret) {
+        HandlePtr handle;
+        d_handles.remove(handleId, &handle);
+        handle->d_handleId = 0; // Do not call back anybody
+        return ret;                                                   // RETURN
+    }
+    return 0;
+}
+
 int SessionPool::connect(
                     int                                      *handleBuffer,
                     const SessionPool::SessionStateCallback&  cb,
@@ -1052,28 +1167,66 @@ int SessionPool::listen(
 {
     BSLS_ASSERT(d_channelPool_p);
 
-    HandlePtr handle(new (*d_allocator_p) SessionPool_Handle(),
-                     bdlf::MemFnUtil::memFn(&SessionPool::handleDeleter, this),
-                     d_allocator_p);
+    int handleId  = makeListenHandle(cb, userData, factory);
+    *handleBuffer = handleId;
 
-    handle->d_type             = SessionPool_Handle::e_LISTENER;
-    handle->d_sessionStateCB   = cb;
-    handle->d_session_p        = 0;
-    handle->d_channel_p        = 0;
-    handle->d_userData_p       = userData;
-    handle->d_sessionFactory_p = factory;
-    handle->d_handleId         = d_handles.add(handle);
-    *handleBuffer              = handle->d_handleId;
+    int ret = d_channelPool_p->listen(endpoint,
+                                      backlog,
+                                      handleId,
+                                      reuseAddress,
+                                      false,
+                                      socketOptions);
+
+    if (ret) {
+        d_handles.remove(handleId);
+        return ret;                                                   // RETURN
+    }
+    return 0;
+}
+
+int SessionPool::listen(
+                       int                                      *handleBuffer,
+                       const SessionPool::SessionStateCallback&  cb,
+                       const btlso::IPv6Address&                 endpoint,
+                       int                                       backlog,
+                       SessionFactory                           *factory,
+                       void                                     *userData,
+                       const btlso::SocketOptions               *socketOptions)
+{
+    return listen(handleBuffer,
+                  cb,
+                  endpoint,
+                  backlog,
+                  1,
+                  factory,
+                  userData,
+                  socketOptions);
+}
+
+int SessionPool::listen(
+                       int                                      *handleBuffer,
+                       const SessionPool::SessionStateCallback&  cb,
+                       const btlso::IPv6Address&                 endpoint,
+                       int                                       backlog,
+                       int                                       reuseAddress,
+                       SessionFactory                           *factory,
+                       void                                     *userData,
+                       const btlso::SocketOptions               *socketOptions)
+{
+    BSLS_ASSERT(d_channelPool_p);
+
+    int handleId  = makeListenHandle(cb, userData, factory);
+    *handleBuffer = handleId;
 
     int ret = d_channelPool_p->listen(endpoint,
                                       backlog,
-                                      handle->d_handleId,
+                                      handleId,
                                       reuseAddress,
                                       false,
                                       socketOptions);
 
     if (ret) {
-        d_handles.remove(handle->d_handleId);
+        d_handles.remove(handleId);
         return ret;                                                   // RETURN
     }
     return 0;
@@ -1107,7 +1260,7 @@ int SessionPool::setWriteCacheWatermarks(int handleId,
 // ACCESSORS
 int SessionPool::portNumber(int handle) const
 {
-    btlso::IPv4Address address;
+    btlso::IPv6Address address;
     const int rc = d_channelPool_p->getServerAddress(&address, handle);
     if (!rc) {
         return address.portNumber();                                  // RETURN
@@ -24,12 +24,12 @@ BSLS_IDENT("$Id: $")
 //@SEE_ALSO: btlmt_session, btlmt_asyncchannel, btlmt_channelpool
 //
 //@DESCRIPTION: This component provides a thread-enabled asynchronous
-// 'btlmt::Session' manager of the IPV4-based byte stream communication
-// sessions.  The sessions are allocated automatically when the appropriate
-// events occur, and destroyed based on user requests.  A new session is
-// allocated automatically when an incoming connection is accepted, by the
-// 'btlmt::SessionFactory' specified during the call to 'listen', or when a
-// user explicitly requests a connection to a server, by a
+// 'btlmt::Session' manager of the IPv4- and IPv6-based byte stream
+// communication sessions.  The sessions are allocated automatically when the
+// appropriate events occur, and destroyed based on user requests.  A new
+// session is allocated automatically when an incoming connection is accepted,
+// by the 'btlmt::SessionFactory' specified during the call to 'listen', or
+// when a user explicitly requests a connection to a server, by a
 // 'btlmt::SessionFactory' specified during the call to 'connect'.  Session
 // pool has both client-side (aka connector) and server-side (aka acceptor)
 // facilities.  The session pool manages efficient delivery of messages to/from
@@ -57,6 +57,18 @@ BSLS_IDENT("$Id: $")
 // message buffer is assumed and either the message is copied into the local
 // buffer of the session or the address of the buffer is retained.
 //
+///IPv6 Support
+///------------
+// Both 'listen' and 'connect' have overloads taking a 'btlso::IPv6Address',
+// which establish the sessions over IPv6 sockets (see the "IPv6 Support"
+// section of 'btlmt_channelpool'), and the 'connect' overload taking a host
+// name and a 'ConnectAddressFamily' connects by name over IPv6 when passed
+// 'e_CONNECT_DUAL_STACK'.  Note that the 'btlmt::AsyncChannel'
+// protocol reports IPv4 addresses only: the 'localAddress' and 'peerAddress'
+// of the channel of such a session are the IPv4 form of the actual addresses
+// if these are IPv4-mapped, and default-constructed otherwise.  The
+// 'portNumber' of a listener is reported for both address families.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -485,6 +497,10 @@ BSLS_IDENT("$Id: $")
 #include <btlso_ipv4address.h>
 #endif
 
+#ifndef INCLUDED_BTLSO_IPV6ADDRESS
+#include <btlso_ipv6address.h>
+#endif
+
 #ifndef INCLUDED_BTLSO_STREAMSOCKET
 #include <btlso_streamsocket.h>
 #endif
@@ -668,6 +684,18 @@ class SessionPool {
 
     };
 
+    enum ConnectAddressFamily {
+        // Address family in which 'connect' resolves a host name and opens
+        // the connecting socket (see {IPv6 Support}).
+
+        e_CONNECT_IPV4            = 0,  // resolve to an IPv4 address, and
+                                        // connect from an IPv4 socket
+
+        e_CONNECT_DUAL_STACK      = 1   // resolve to an IPv6 or an
+                                        // (IPv4-mapped) IPv4 address, and
+                                        // connect from an IPv6 socket
+    };
+
     enum PoolState {
         // Result code passed to the pool callback.  Note that
         // 'e_CONNECT_ABORTED', 'e_CONNECT_ATTEMPT_FAILED', 'e_CONNECT_FAILED',
@@ -767,6 +795,14 @@ class SessionPool {
        // The factory will be allocated from the specified 'factory'.  Return
        // the identifier for the new handle.
 
+    int makeListenHandle(const SessionPool::SessionStateCallback&  cb,
+                         void                                     *userData,
+                         SessionFactory                           *factory);
+       // Add a handle for a listener with the specified 'userData' and 'cb'
+       // parameters to this session pool.  The sessions will be allocated
+       // from the specified 'factory'.  Return the identifier for the new
+       // handle.
+
     // FRIENDS
     friend class SessionPoolSessionIterator;
 
@@ -857,10 +893,27 @@ class SessionPool {
                SessionFactory                           *factory,
                void                                     *userData = 0,
                const btlso::SocketOptions               *socketOptions = 0);
+    int listen(int                                      *handleBuffer,
+               const SessionPool::SessionStateCallback&  callback,
+               const btlso::IPv6Address&                 endpoint,
+               int                                       backlog,
+               SessionFactory                           *factory,
+               void                                     *userData = 0,
+               const btlso::SocketOptions               *socketOptions = 0);
+    int listen(int                                      *handleBuffer,
+               const SessionPool::SessionStateCallback&  callback,
+               const btlso::IPv6Address&                 endpoint,
+               int                                       backlog,
+               int                                       reuseAddress,
+               SessionFactory                           *factory,
+               void                                     *userData = 0,
+               const btlso::SocketOptions               *socketOptions = 0);
         // Asynchronously listen for connection requests on the specified
         // 'portNumber' on all local interfaces or the specified 'endpoint',
         // depending on which overload of listen is used, with up to a maximum
-        // of 'backlog' concurrent connection requests.  Once a connection is
+        // of 'backlog' concurrent connection requests.  If 'endpoint' is a
+        // 'btlso::IPv6Address', listen on an IPv6 socket (see {IPv6
+        // Support}), and on an IPv4 socket otherwise.  Once a connection is
         // successfully accepted, this session pool will allocate and start a
         // session for the connection using the specified 'factory'.  Load a
         // handle for the listening connection into 'handleBuffer'.  Optionally
@@ -929,6 +982,36 @@ class SessionPool {
         // otherwise.  The behavior is undefined unless '0 < numAttempts', and
         // '0 < interval || 1 == numAttempts'.
 
+    int connect(int                                      *handleBuffer,
+                const SessionPool::SessionStateCallback&  callback,
+                const char                               *hostname,
+                int                                       port,
+                ConnectAddressFamily                      addressFamily,
+                int                                       numAttempts,
+                const bsls::TimeInterval&                 interval,
+                SessionFactory                           *factory,
+                void                                     *userData = 0,
+                ConnectResolutionMode                     resolutionMode
+                                                              = e_RESOLVE_ONCE,
+                const btlso::SocketOptions               *socketOptions = 0,
+                const btlso::IPv6Address                 *localAddress = 0);
+        // Asynchronously attempt to connect to the specified 'hostname' on the
+        // specified 'port', resolved in the specified 'addressFamily' (see
+        // {IPv6 Support}), up to the specified 'numAttempts' delaying for the
+        // specified 'interval' between each attempt; once a connection is
+        // successfully established, allocate and start a session using the
+        // specified 'factory' and load a handle for the initiated connection
+        // into 'handleBuffer'.  Whenever this session state changes (i.e., is
+        // established), the specified 'callback' will be invoked along with a
+        // pointer to newly created 'Session' and the optionally specified
+        // 'userData'.  Optionally specify 'resolutionMode', 'socketOptions',
+        // and 'localAddress' having the same meaning as for the 'connect'
+        // overload taking a host name and a 'btlso::IPv4Address' local
+        // address.  Return 0 on successful initiation, and a non-zero value
+        // otherwise.  The behavior is undefined unless '0 < numAttempts',
+        // '0 < interval || 1 == numAttempts', and, if 'addressFamily' is
+        // 'e_CONNECT_IPV4', 'localAddress' is 0 or IPv4-mapped.
+
     int connect(int                                      *handleBuffer,
                 const SessionPool::SessionStateCallback&  callback,
                 btlso::IPv4Address const&                 endpoint,
@@ -966,6 +1049,30 @@ class SessionPool {
         // undefined unless '0 < numAttempts', and '0 < interval' or
         // '1 == numAttempts'.
 
+    int connect(int                                      *handleBuffer,
+                const SessionPool::SessionStateCallback&  callback,
+                const btlso::IPv6Address&                 endpoint,
+                int                                       numAttempts,
+                const bsls::TimeInterval&                 interval,
+                SessionFactory                           *factory,
+                void                                     *userData = 0,
+                const btlso::SocketOptions               *socketOptions = 0,
+                const btlso::IPv6Address                 *localAddress = 0);
+        // Asynchronously attempt to connect from an IPv6 socket (see {IPv6
+        // Support}) to the specified 'endpoint' up to the specified
+        // 'numAttempts' delaying for the specified 'interval' between each
+        // attempt; once a connection is successfully established, allocate
+        // and start a session using the specified 'factory' and load a handle
+        // for the initiated connection into 'handleBuffer'.  Whenever this
+        // session state changes (i.e., is established), the specified
+        // 'callback' will be invoked along with a pointer to newly created
+        // 'Session' and the optionally specified 'userData'.  Optionally
+        // specify 'socketOptions' that will be used to specify what options
+        // should be set on the connecting socket and/or 'localAddress' to be
+        // used as the source address.  Return 0 on successful initiation, and
+        // a non-zero value otherwise.  The behavior is undefined unless
+        // '0 < numAttempts', and '0 < interval' or '1 == numAttempts'.
+
     int import(int                                            *handleBuffer,
                const SessionPool::SessionStateCallback&        callback,
                btlso::StreamSocket<btlso::IPv4Address>        *streamSocket,
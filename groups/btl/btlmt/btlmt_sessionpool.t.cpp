@@ -33,6 +33,7 @@
 #include <bslma_default.h>
 
 #include <btlso_ipv4address.h>
+#include <btlso_ipv6address.h>
 #include <btlso_inetstreamsocketfactory.h>
 #include <btlso_socketoptions.h>
 #include <btlso_streamsocket.h>
@@ -44,6 +45,7 @@
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_cstdlib.h>     // atoi()
+#include <bsl_cstring.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -1789,7 +1791,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator ta("ta", veryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // TEST USAGE EXAMPLE
         //   The usage example from the header has been incorporated into this
@@ -1811,6 +1813,158 @@ int main(int argc, char *argv[])
         ASSERT(0 == ta.numMismatches());
 
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING IPv6 'listen' AND 'connect'
+        //
+        // Concerns:
+        //: 1 A session pool listens on an IPv6 address, and reports the port
+        //:   number of the listener.
+        //:
+        //: 2 A session pool connects to an IPv6 address.
+        //:
+        //: 3 Sessions established over IPv6 transfer data.
+        //:
+        //: 4 A session pool connects by name, in the dual-stack address
+        //:   family, to a listener on the IPv6 loopback address only.
+        //
+        // Plan:
+        //: 1 Unless the IPv6 loopback address is unavailable, listen on
+        //:   "::1" with a pool of echoing sessions, and verify the port
+        //:   number of the listener.  (C-1)
+        //:
+        //: 2 Connect a second session pool to the listener, and verify that
+        //:   both pools establish a session.  (C-2)
+        //:
+        //: 3 Connect the second session pool to the listener by the host name
+        //:   "::1" in the dual-stack address family, and verify that both
+        //:   pools establish a session.  (C-4)
+        //:
+        //: 4 Connect an IPv6 socket to the listener, and verify that the data
+        //:   written on the socket is echoed back.  (C-3)
+        //
+        // Testing:
+        //   int listen(int *, cb, const IPv6Address&, int, Factory *, ...);
+        //   int connect(int *, cb, const IPv6Address&, int, ..., Factory *);
+        //   int connect(int *, cb, const char *, int, AddressFamily, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "TESTING IPv6 'listen' AND 'connect'"
+                               << bsl::endl
+                               << "==================================="
+                               << bsl::endl;
+
+        using namespace BTEMT_SESSION_POOL_GENERIC_TEST_NAMESPACE;
+
+        const btlso::IPv6Address LOOPBACK("::1", 0);
+
+        btlso::InetStreamSocketFactory<btlso::IPv6Address> socketFactory;
+        btlso::StreamSocket<btlso::IPv6Address> *socket =
+                                                      socketFactory.allocate();
+        ASSERT(socket);
+
+        if (0 != socket->bind(LOOPBACK)) {
+            if (verbose) bsl::cout << "IPv6 loopback unavailable: skipping"
+                                   << bsl::endl;
+            socketFactory.deallocate(socket);
+            break;
+        }
+        socketFactory.deallocate(socket);
+
+        btlmt::ChannelPoolConfiguration config;
+        config.setMaxThreads(2);
+
+        typedef btlmt::SessionPool::SessionPoolStateCallback PoolStateCb;
+        typedef btlmt::SessionPool::SessionStateCallback     SessionStateCb;
+
+        bsls::AtomicInt numUpConnections(0);
+
+        PoolStateCb    poolCb         = &poolStateCallback;
+        SessionStateCb sessionStateCb = bdlf::BindUtil::bind(
+                                              &sessionStateCallbackWithCounter,
+                                              _1,
+                                              _2,
+                                              _3,
+                                              _4,
+                                              &numUpConnections);
+
+        TestFactory factory;
+
+        bslma::TestAllocator sa("serverAllocator", veryVeryVerbose);
+        bslma::TestAllocator ca("clientAllocator", veryVeryVerbose);
+        {
+            Obj server(config, poolCb, &sa);
+            Obj client(config, poolCb, &ca);
+
+            ASSERT(0 == server.start());
+            ASSERT(0 == client.start());
+
+            int serverHandle;
+            ASSERT(0 == server.listen(&serverHandle,
+                                      sessionStateCb,
+                                      LOOPBACK,
+                                      5,
+                                      &factory));
+
+            const int PORTNUM = server.portNumber(serverHandle);
+            ASSERT(0 < PORTNUM);
+
+            const btlso::IPv6Address ADDRESS("::1", PORTNUM);
+
+            int clientHandle;
+            ASSERT(0 == client.connect(&clientHandle,
+                                       sessionStateCb,
+                                       ADDRESS,
+                                       1,
+                                       bsls::TimeInterval(1.0),
+                                       &factory));
+
+            for (int i = 0; i < 1000 && 2 > numUpConnections; ++i) {
+                bslmt::ThreadUtil::microSleep(10 * 1000);
+            }
+            LOOP_ASSERT(numUpConnections, 2 == numUpConnections);
+
+            ASSERT(0 == client.connect(&clientHandle,
+                                       sessionStateCb,
+                                       "::1",
+                                       PORTNUM,
+                                       Obj::e_CONNECT_DUAL_STACK,
+                                       1,
+                                       bsls::TimeInterval(1.0),
+                                       &factory));
+
+            for (int i = 0; i < 1000 && 4 > numUpConnections; ++i) {
+                bslmt::ThreadUtil::microSleep(10 * 1000);
+            }
+            LOOP_ASSERT(numUpConnections, 4 == numUpConnections);
+
+            socket = socketFactory.allocate();
+            ASSERT(0 == socket->connect(ADDRESS));
+
+            const char DATA[] = "IPv6 session";
+            const int  SIZE   = sizeof DATA;
+            ASSERT(SIZE == socket->write(DATA, SIZE));
+
+            char buffer[SIZE];
+            int  numRead = 0;
+            while (numRead < SIZE) {
+                const int rc = socket->read(buffer + numRead, SIZE - numRead);
+                if (0 >= rc) {
+                    break;
+                }
+                numRead += rc;
+            }
+            ASSERT(SIZE == numRead);
+            ASSERT(0    == bsl::memcmp(DATA, buffer, SIZE));
+
+            socketFactory.deallocate(socket);
+
+            ASSERT(0 == client.stop());
+            ASSERT(0 == server.stop());
+        }
+        ASSERT(0 == sa.numBytesInUse());
+        ASSERT(0 == ca.numBytesInUse());
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // Test Constructor taking BlobBufferFactory
@@ -15,6 +15,8 @@ BSLS_IDENT_RCSID(btlmt_tcptimereventmanager_cpp,"$Id$ $CSID$")
 #include <btlso_defaulteventmanager.h>
 #include <btlso_defaulteventmanager_devpoll.h>
 #include <btlso_defaulteventmanager_epoll.h>
+#include <btlso_defaulteventmanager_flatepoll.h>
+#include <btlso_defaulteventmanager_iouring.h>
 #include <btlso_defaulteventmanager_poll.h>
 #include <btlso_defaulteventmanager_select.h>
 #include <btlso_eventmanager.h>
@@ -789,15 +791,40 @@ int TcpTimerEventManager_ControlChannel::serverRead()
                          // --------------------------
 
 // PRIVATE METHODS
-void TcpTimerEventManager::initialize()
+void TcpTimerEventManager::initialize(
+                                      EventManagerType::Value eventManagerType)
 {
     BSLS_ASSERT(d_allocator_p);
 
     btlso::TimeMetrics *metrics = d_collectMetrics ? &d_metrics : 0;
 
     // Initialize the (managed) event manager.
+
+    d_eventManagerType = EventManagerType::e_DEFAULT;
+
 #ifdef BSLS_PLATFORM_OS_LINUX
-    if (btlso::DefaultEventManager<>::isSupported()) {
+    typedef btlso::DefaultEventManager<btlso::Platform::FLAT_EPOLL>
+                                                              FlatEpollManager;
+    typedef btlso::DefaultEventManager<btlso::Platform::IO_URING>
+                                                                IoUringManager;
+
+    // An event manager that is not supported by the running kernel is
+    // replaced by the default one (i.e., 'epoll', or 'poll' if 'epoll' is not
+    // supported either).
+
+    if (EventManagerType::e_FLAT_EPOLL == eventManagerType
+     && FlatEpollManager::isSupported()) {
+        d_manager_p = new (*d_allocator_p) FlatEpollManager(metrics,
+                                                            d_allocator_p);
+        d_eventManagerType = EventManagerType::e_FLAT_EPOLL;
+    }
+    else if (EventManagerType::e_IO_URING == eventManagerType
+          && IoUringManager::isSupported()) {
+        d_manager_p = new (*d_allocator_p) IoUringManager(metrics,
+                                                          d_allocator_p);
+        d_eventManagerType = EventManagerType::e_IO_URING;
+    }
+    else if (btlso::DefaultEventManager<>::isSupported()) {
         d_manager_p = new (*d_allocator_p)
                                    btlso::DefaultEventManager<>(metrics,
                                                                 d_allocator_p);
@@ -808,6 +835,8 @@ void TcpTimerEventManager::initialize()
                                                                 d_allocator_p);
     }
 #else
+    (void)eventManagerType;
+
     d_manager_p = new (*d_allocator_p)
                                    btlso::DefaultEventManager<>(metrics,
                                                                 d_allocator_p);
@@ -1118,7 +1147,7 @@ TcpTimerEventManager::TcpTimerEventManager(
 , d_numControlChannelReinitializations(0)
 , d_allocator_p(bslma::Default::allocator(threadSafeAllocator))
 {
-    initialize();
+    initialize(EventManagerType::e_DEFAULT);
 }
 
 TcpTimerEventManager::TcpTimerEventManager(
@@ -1138,7 +1167,7 @@ TcpTimerEventManager::TcpTimerEventManager(
 , d_numControlChannelReinitializations(0)
 , d_allocator_p(bslma::Default::allocator(threadSafeAllocator))
 {
-    initialize();
+    initialize(EventManagerType::e_DEFAULT);
 }
 
 TcpTimerEventManager::TcpTimerEventManager(
@@ -1159,7 +1188,29 @@ TcpTimerEventManager::TcpTimerEventManager(
 , d_numControlChannelReinitializations(0)
 , d_allocator_p(bslma::Default::allocator(threadSafeAllocator))
 {
-    initialize();
+    initialize(EventManagerType::e_DEFAULT);
+}
+
+TcpTimerEventManager::TcpTimerEventManager(
+                             EventManagerType::Value  eventManagerType,
+                             bool                     collectTimeMetrics,
+                             bool                     poolTimerMemory,
+                             bslma::Allocator        *threadSafeAllocator)
+: d_requestPool(sizeof(TcpTimerEventManager_Request), threadSafeAllocator)
+, d_requestQueue(threadSafeAllocator)
+, d_dispatcher(bslmt::ThreadUtil::invalidHandle())
+, d_state(e_DISABLED)
+, d_terminateThread(0)
+, d_timerQueue(poolTimerMemory, threadSafeAllocator)
+, d_metrics(btlso::TimeMetrics::e_MIN_NUM_CATEGORIES,
+            btlso::TimeMetrics::e_IO_BOUND,
+            threadSafeAllocator)
+, d_collectMetrics(collectTimeMetrics)
+, d_numTotalSocketEvents(0)
+, d_numControlChannelReinitializations(0)
+, d_allocator_p(bslma::Default::allocator(threadSafeAllocator))
+{
+    initialize(eventManagerType);
 }
 
 TcpTimerEventManager::TcpTimerEventManager(
@@ -1172,6 +1223,7 @@ TcpTimerEventManager::TcpTimerEventManager(
 , d_terminateThread(0)
 , d_manager_p(rawEventManager)
 , d_isManagedFlag(0)
+, d_eventManagerType(EventManagerType::e_DEFAULT)
 , d_timerQueue(threadSafeAllocator)
 , d_metrics(btlso::TimeMetrics::e_MIN_NUM_CATEGORIES,
             btlso::TimeMetrics::e_IO_BOUND,
@@ -51,6 +51,26 @@ BSLS_IDENT("$Id: $")
 // should be provided to this event manager at construction for optimal
 // performance.
 //
+///Choice of Socket Event Manager
+///------------------------------
+// Unless a 'btlso::EventManager' is supplied at construction, an event manager
+// creates and owns the socket event manager it uses to monitor sockets.  By
+// default this is 'btlso::DefaultEventManager<>' (or, on Linux systems that do
+// not support 'epoll', the 'POLL' specialization).  A different socket event
+// manager can be requested at construction with a 'btlmt::EventManagerType'
+// value; for example, 'btlmt::EventManagerType::e_FLAT_EPOLL' selects
+// 'btlso::DefaultEventManager<btlso::Platform::FLAT_EPOLL>', which indexes
+// registrations by socket handle and is intended for dispatchers monitoring
+// many sockets, and 'btlmt::EventManagerType::e_IO_URING' selects
+// 'btlso::DefaultEventManager<btlso::Platform::IO_URING>', which submits the
+// registration changes of a dispatch together with its wait.  Note that the
+// socket event manager only reports readiness: the callbacks registered with
+// this event manager read and write their sockets themselves.  If the
+// requested socket event manager is not supported on the current platform
+// (e.g., on a Linux kernel without 'io_uring'), the default one is used
+// instead; the 'eventManagerType' accessor reports the type that is actually
+// in use.
+//
 ///Thread Safety
 ///-------------
 // This event manager is *thread* *safe*, i.e., operations can be invoked
@@ -185,6 +205,10 @@ BSLS_IDENT("$Id: $")
 #include <btlscm_version.h>
 #endif
 
+#ifndef INCLUDED_BTLMT_EVENTMANAGERTYPE
+#include <btlmt_eventmanagertype.h>
+#endif
+
 #ifndef INCLUDED_BTLSO_SOCKETHANDLE
 #include <btlso_sockethandle.h>
 #endif
@@ -414,6 +438,10 @@ class TcpTimerEventManager : public btlso::TimerEventManager {
                                                       // manager is internal or
                                                       // external
 
+    EventManagerType::Value        d_eventManagerType;
+                                                      // type of 'd_manager_p'
+                                                      // if it is internal
+
     bsl::vector<bsl::function<void()> >
                                   *d_executeQueue_p;  // queue of executed
                                                       // timers (pointer, to
@@ -469,8 +497,10 @@ class TcpTimerEventManager : public btlso::TimerEventManager {
     TcpTimerEventManager& operator=(const TcpTimerEventManager&);
 
     // PRIVATE MANIPULATORS
-    void initialize();
-        // Initialize this event manager.
+    void initialize(EventManagerType::Value eventManagerType);
+        // Initialize this event manager, creating a socket event manager of
+        // the specified 'eventManagerType' if it is supported on the current
+        // platform, and of type 'EventManagerType::e_DEFAULT' otherwise.
 
     void dispatchThreadEntryPoint();
         // Entry point for the dispatch thread.
@@ -512,6 +542,23 @@ class TcpTimerEventManager : public btlso::TimerEventManager {
         // the dispatcher thread is NOT started by this method (i.e., it must
         // be started explicitly).
 
+    TcpTimerEventManager(EventManagerType::Value  eventManagerType,
+                         bool                     collectTimeMetrics,
+                         bool                     poolTimerMemory,
+                         bslma::Allocator        *basicAllocator = 0);
+        // Create an event manager that monitors sockets using a socket event
+        // manager of the specified 'eventManagerType', or of the default type
+        // if 'eventManagerType' is not supported on the current platform (see
+        // {Choice of Socket Event Manager}).  Specify 'collectTimeMetrics'
+        // indicating whether this event manager should collect timing
+        // metrics, and 'poolTimerMemory' indicating whether the memory used
+        // for internal timers should be pooled.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless 'basicAllocator' refers to a *thread* *safe*
+        // allocator.  Note that the dispatcher thread is NOT started by this
+        // method (i.e., it must be started explicitly).
+
     TcpTimerEventManager(btlso::EventManager *rawEventManager,
                          bslma::Allocator    *basicAllocator = 0);
         // Create an event manager with timer support that uses the specified
@@ -673,6 +720,11 @@ class TcpTimerEventManager : public btlso::TimerEventManager {
     int isEnabled() const;
         // Return 1 if the dispatch thread is created/running and 0 otherwise.
 
+    EventManagerType::Value eventManagerType() const;
+        // Return the type of the socket event manager created by this event
+        // manager, or 'EventManagerType::e_DEFAULT' if a 'rawEventManager'
+        // was provided at construction.
+
     bool hasTimeMetrics() const;
         // Return 'true' if the object returned by 'timeMetrics()' contains a
         // valid value, and 'false' otherwise.  This value will be 'false' if
@@ -750,6 +802,12 @@ bslmt::ThreadUtil::Handle TcpTimerEventManager::dispatcherThreadHandle() const
     return d_dispatcher;
 }
 
+inline
+EventManagerType::Value TcpTimerEventManager::eventManagerType() const
+{
+    return d_eventManagerType;
+}
+
 inline
 bool TcpTimerEventManager::hasTimeMetrics() const
 {
@@ -16,10 +16,13 @@
 #include <btlso_streamsocket.h>
 
 #include <btlso_defaulteventmanager.h>
+#include <btlso_defaulteventmanager_flatepoll.h>
+#include <btlso_defaulteventmanager_iouring.h>
 
 #include <bslma_testallocator.h>
 #include <bdlmt_threadpool.h>
 #include <bslmt_barrier.h>
+#include <bslmt_semaphore.h>
 #include <bslmt_threadattributes.h>
 #include <bsls_atomic.h>
 
@@ -62,6 +65,7 @@ using namespace BloombergLP;
 // [12] TcpTimerEventManager(bslma::Allocator *basicAllocator = 0);
 // [12] TcpTimerEventManager(collectTimeMetrics, *basicAllocator = 0);
 // [12] TcpTimerEventManager(collectTimeMetrics, poolTimer, *ba = 0);
+// [16] TcpTimerEventManager(type, collectTimeMetrics, poolTimer, *ba = 0);
 // [  ] TcpTimerEventManager(rawEventManager, *basicAllocator = 0);
 // [12] ~TcpTimerEventManager();
 //
@@ -90,6 +94,7 @@ using namespace BloombergLP;
 // [  ] int numTotalSocketEvents() const;
 // [  ] btlso::TimeMetrics *timeMetrics() const;
 // [  ] bslmt::ThreadUtil::Handle dispatcherThreadHandle() const;
+// [16] EventManagerType::Value eventManagerType() const;
 // [11] int isEnabled() const;
 // [12] bool hasTimeMetrics() const;
 //
@@ -97,7 +102,7 @@ using namespace BloombergLP;
 // [15] TEST closure of control channel sockets
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [16] USAGE EXAMPLE
+// [17] USAGE EXAMPLE
 //=============================================================================
 
 //=============================================================================
@@ -200,6 +205,30 @@ void testIsEnabled(btlmt::TcpTimerEventManager *manager,
 
 }  // close namespace TEST_CASE_ENABLE_TEST
 
+//=============================================================================
+//       ADDITIONAL 'eventManagerType' TEST:
+//-----------------------------------------------------------------------------
+
+namespace TEST_CASE_EVENT_MANAGER_TYPE {
+
+void readAndPost(btlso::SocketHandle::Handle  handle,
+                 bslmt::Semaphore            *semaphore)
+    // Read one byte from the specified 'handle' and post the specified
+    // 'semaphore'.
+{
+    char c;
+    ASSERT(1 == btlso::SocketImpUtil::read(&c, handle, 1));
+    semaphore->post();
+}
+
+void post(bslmt::Semaphore *semaphore)
+    // Post the specified 'semaphore'.
+{
+    semaphore->post();
+}
+
+}  // close namespace TEST_CASE_EVENT_MANAGER_TYPE
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -808,7 +837,7 @@ int main(int argc, char *argv[])
     }
 
     switch (test) { case 0:
-      case 16: {
+      case 17: {
         // ----------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -859,6 +888,94 @@ int main(int argc, char *argv[])
         }
       } break;
 
+      case 16: {
+        // ----------------------------------------------------------------
+        // TESTING: choice of socket event manager
+        //
+        // Concerns:
+        //: 1 An object constructed with 'e_DEFAULT' reports 'e_DEFAULT'.
+        //:
+        //: 2 On Linux, an object constructed with 'e_FLAT_EPOLL' or
+        //:   'e_IO_URING' reports that type if the kernel supports it, and
+        //:   falls back to (and reports) 'e_DEFAULT' otherwise; on other
+        //:   platforms it reports 'e_DEFAULT'.
+        //:
+        //: 3 The socket events and timers registered with an object built
+        //:   on either event manager are dispatched.
+        //
+        // Plan:
+        //: 1 For each event manager type, create an object, verify the
+        //:   value returned by 'eventManagerType', then register a read
+        //:   event on one end of a socket pair and a timer, enable the
+        //:   object, write to the other end, and verify that both
+        //:   callbacks are invoked.  (C-1..3)
+        //
+        // Testing:
+        //  TcpTimerEventManager(type, collectTimeMetrics, poolTimer, *ba);
+        //  EventManagerType::Value eventManagerType() const;
+        // ----------------------------------------------------------------
+
+        if (verbose) cout << "TESTING: choice of socket event manager\n"
+                          << "=======================================\n";
+
+        using namespace TEST_CASE_EVENT_MANAGER_TYPE;
+
+        typedef btlmt::EventManagerType EMT;
+
+        const EMT::Value TYPES[] = {
+            EMT::e_DEFAULT, EMT::e_FLAT_EPOLL, EMT::e_IO_URING
+        };
+        const int        NUM_TYPES = sizeof TYPES / sizeof *TYPES;
+
+        for (int i = 0; i < NUM_TYPES; ++i) {
+            const EMT::Value TYPE = TYPES[i];
+
+            if (veryVerbose) { P(TYPE); }
+
+            Obj mX(TYPE, true, false, &testAllocator);  const Obj& X = mX;
+
+            EMT::Value expType = EMT::e_DEFAULT;
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            if (EMT::e_FLAT_EPOLL == TYPE && btlso::DefaultEventManager<
+                               btlso::Platform::FLAT_EPOLL>::isSupported()) {
+                expType = EMT::e_FLAT_EPOLL;
+            }
+            if (EMT::e_IO_URING == TYPE && btlso::DefaultEventManager<
+                                 btlso::Platform::IO_URING>::isSupported()) {
+                expType = EMT::e_IO_URING;
+            }
+#endif
+            LOOP2_ASSERT(TYPE, X.eventManagerType(),
+                         expType == X.eventManagerType());
+            ASSERT(X.hasTimeMetrics());
+
+            btlso::SocketHandle::Handle handles[2];
+            ASSERT(0 == btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                             handles, btlso::SocketImpUtil::k_SOCKET_STREAM));
+
+            bslmt::Semaphore semaphore;
+
+            bsl::function<void()> readCb(bdlf::BindUtil::bind(&readAndPost,
+                                                              handles[1],
+                                                              &semaphore));
+            ASSERT(0 == mX.registerSocketEvent(handles[1],
+                                               btlso::EventType::e_READ,
+                                               readCb));
+            ASSERT(0 == mX.enable());
+
+            ASSERT(1 == btlso::SocketImpUtil::write(handles[0], "x", 1));
+            semaphore.wait();
+
+            bsl::function<void()> timerCb(bdlf::BindUtil::bind(&post,
+                                                               &semaphore));
+            ASSERT(0 != mX.registerTimer(bdlt::CurrentTime::now(), timerCb));
+            semaphore.wait();
+
+            ASSERT(0 == mX.disable());
+            btlso::SocketImpUtil::close(handles[0]);
+            btlso::SocketImpUtil::close(handles[1]);
+        }
+      } break;
       case 15: {
         // -----------------------------------------------------------------
         // TEST closure of control channel sockets
@@ -42,6 +42,12 @@ BSLS_IDENT("$Id: $")
 //  +------------------------------------------------------------------------+
 //  | <btlso::Platform::EPOLL>   |         epoll         |       Linux*      |
 //  +------------------------------------------------------------------------+
+//  | <btlso::Platform::         |  epoll (fd-indexed,   |       Linux       |
+//  |  FLAT_EPOLL>               |  optionally edge-     |                   |
+//  |                            |  triggered)           |                   |
+//  +------------------------------------------------------------------------+
+//  | <btlso::Platform::IO_URING>|  io_uring poll        |  Linux (5.11+)    |
+//  +------------------------------------------------------------------------+
 //  | <btlso::Platform::POLL>    |          poll         | Solaris, AIX*,    |
 //  |                            |                       | Linux             |
 //  +========================================================================+
@@ -91,6 +97,14 @@ BSLS_IDENT("$Id: $")
 #include <btlso_defaulteventmanager_epoll.h>
 #endif
 
+#ifndef INCLUDED_BTLSO_DEFAULTEVENTMANAGER_FLATEPOLL
+#include <btlso_defaulteventmanager_flatepoll.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_DEFAULTEVENTMANAGER_IOURING
+#include <btlso_defaulteventmanager_iouring.h>
+#endif
+
 #ifndef INCLUDED_BTLSO_DEFAULTEVENTMANAGER_POLL
 #include <btlso_defaulteventmanager_poll.h>
 #endif
@@ -37,51 +37,6 @@ namespace btlso {
 
 namespace {
 
-int sleep(int                       *resultErrno,
-          const bsls::TimeInterval&  timeout,
-          int                        flags,
-          btlso::TimeMetrics        *metrics)
-{
-    bsls::TimeInterval now(bdlt::CurrentTime::now());
-
-    while (timeout > now) {
-        bsls::TimeInterval currTimeout(timeout - now);
-        struct timespec    ts;
-
-        ts.tv_sec  = static_cast<time_t>(currTimeout.seconds());
-        ts.tv_nsec = static_cast<long>(currTimeout.nanoseconds());
-
-        // Sleep till it's time.
-
-        int savedErrno;
-        int rc;
-        if (metrics) {
-            metrics->switchTo(btlso::TimeMetrics::e_IO_BOUND);
-            rc = nanosleep(&ts, 0);
-            savedErrno = errno;
-            metrics->switchTo(btlso::TimeMetrics::e_CPU_BOUND);
-        }
-        else {
-            rc = nanosleep(&ts, 0);
-            savedErrno = errno;
-        }
-
-        errno = 0;
-        *resultErrno = savedErrno;
-        if (0 > rc) {
-            BSLS_ASSERT(savedErrno == EINTR);
-
-            if (flags & btlso::Flag::k_ASYNC_INTERRUPT) {
-                // We're allowing async interrupts.
-
-                return -1;                                            // RETURN
-            }
-        }
-        now = bdlt::CurrentTime::now();
-    }
-    return 0;
-}
-
 int translateEventToMask(btlso::EventType::Type event)
 {
     switch (event) {
@@ -231,7 +186,10 @@ int EventManagerName::dispatchImp(int                       flags,
                     numReady = 0;
                     break;
                 }
-                numReady = sleep(&savedErrno, *timeout, flags, d_timeMetric_p);
+                numReady = DefaultEventManagerImplUtil::sleep(&savedErrno,
+                                                              *timeout,
+                                                              flags,
+                                                              d_timeMetric_p);
             }
             else {
                 if (d_timeMetric_p) {
@@ -486,7 +444,10 @@ int EventManagerName::dispatch(const bsls::TimeInterval& timeout,
 {
     if (0 == numEvents()) {
         int dummy;
-        return sleep(&dummy, timeout, flags, d_timeMetric_p);         // RETURN
+        return DefaultEventManagerImplUtil::sleep(&dummy,
+                                                  timeout,
+                                                  flags,
+                                                  d_timeMetric_p);    // RETURN
     }
     return dispatchImp(flags, &timeout);
 }
@@ -0,0 +1,624 @@
+// btlso_defaulteventmanager_flatepoll.cpp                            -*-C++-*-
+#include <btlso_defaulteventmanager_flatepoll.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(btlso_defaulteventmanager_flatepoll_cpp,"$Id$ $CSID$")
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+#include <btlso_flag.h>
+#include <btlso_timemetrics.h>
+
+#include <bdlt_currenttime.h>
+
+#include <bsls_assert.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_c_errno.h>
+#include <bsl_climits.h>
+#include <bsl_cstdio.h>
+
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace BloombergLP {
+namespace btlso {
+
+namespace {
+
+inline
+int translateEventToMask(EventType::Type event)
+    // Return the 'epoll' event bit corresponding to the specified 'event'.
+{
+    switch (event) {
+      case EventType::e_ACCEPT:                                 // FALL THROUGH
+      case EventType::e_READ: {
+        return EPOLLIN;                                               // RETURN
+      } break;
+      case EventType::e_CONNECT:                                // FALL THROUGH
+      case EventType::e_WRITE: {
+        return EPOLLOUT;                                              // RETURN
+      } break;
+      default: {
+        BSLS_ASSERT("Invalid event (must be unreachable)" && 0);
+        return 0;                                                     // RETURN
+      } break;
+    }
+}
+
+inline
+bool isReadEvent(EventType::Type event)
+    // Return 'true' if the specified 'event' is registered in the read slot
+    // of a handle entry, and 'false' otherwise.
+{
+    return EventType::e_READ == event || EventType::e_ACCEPT == event;
+}
+
+inline
+unsigned int pollCurrentEvents(int handle, int mask)
+    // Return the subset of the specified 'mask' of 'epoll' events, along
+    // with 'EPOLLERR' and 'EPOLLHUP', for which the specified 'handle' is
+    // ready at the time of the call, without blocking.
+{
+    struct ::pollfd pollFd;
+    pollFd.fd      = handle;
+    pollFd.events  = 0;
+    pollFd.revents = 0;
+
+    if (mask & EPOLLIN) {
+        pollFd.events |= POLLIN;
+    }
+    if (mask & EPOLLOUT) {
+        pollFd.events |= POLLOUT;
+    }
+
+    if (1 != ::poll(&pollFd, 1, 0)) {
+        return 0;                                                     // RETURN
+    }
+
+    unsigned int result = 0;
+    if (pollFd.revents & POLLIN) {
+        result |= EPOLLIN;
+    }
+    if (pollFd.revents & POLLOUT) {
+        result |= EPOLLOUT;
+    }
+    if (pollFd.revents & POLLERR) {
+        result |= EPOLLERR;
+    }
+    if (pollFd.revents & POLLHUP) {
+        result |= EPOLLHUP;
+    }
+    return result;
+}
+
+}  // close unnamed namespace
+
+        // -----------------------------------------------
+        // class DefaultEventManager<Platform::FLAT_EPOLL>
+        // -----------------------------------------------
+
+typedef DefaultEventManager<Platform::FLAT_EPOLL> EventManagerName;
+    // Alias for brevity.
+
+// PRIVATE MANIPULATORS
+int EventManagerName::applyChanges()
+{
+    int numCalls = 0;
+
+    for (bsl::vector<int>::const_iterator it  = d_changedHandles.begin();
+                                          it != d_changedHandles.end();
+                                        ++it) {
+        HandleEntry& entry = d_handles[*it];
+
+        entry.d_isChangePending = false;
+
+        // Handles whose last event was deregistered have already been removed
+        // from 'epoll', and changes that cancelled each other need no call.
+
+        if (0 == entry.d_mask || entry.d_mask == entry.d_kernelMask) {
+            continue;
+        }
+
+        const int rc = controlEpoll(*it, EPOLL_CTL_MOD, entry.d_mask);
+
+        // 'epoll' removes closed file descriptors automatically.
+
+        BSLS_ASSERT(0 == rc || ENOENT == rc || EBADF == rc);
+        (void)rc;
+
+        entry.d_kernelMask = entry.d_mask;
+        ++numCalls;
+    }
+    d_changedHandles.clear();
+
+    return numCalls;
+}
+
+int EventManagerName::controlEpoll(int handle, int operation, int mask)
+{
+    // The handle occupies the low-order half of the event data, and the
+    // generation of its entry the high-order half.
+
+    const bsls::Types::Uint64 generation = d_handles[handle].d_generation;
+
+    struct ::epoll_event epollEvent = { 0, { 0 } };
+    epollEvent.events   = mask;
+    epollEvent.data.u64 = generation << 32
+                        | static_cast<unsigned int>(handle);
+    if (e_EDGE_TRIGGERED == d_triggerMode && 0 != mask) {
+        epollEvent.events |= EPOLLET;
+    }
+
+    return 0 == ::epoll_ctl(d_epollFd, operation, handle, &epollEvent)
+           ? 0
+           : errno;
+}
+
+int EventManagerName::dispatchImp(int                       flags,
+                                  const bsls::TimeInterval *timeout)
+{
+    bsls::TimeInterval now;
+    if (timeout) {
+        now = bdlt::CurrentTime::now();
+    }
+
+    int numCallbacks = 0;                    // number of callbacks dispatched
+
+    const bool allowAsyncInterrupts =
+                                      (0 != (Flag::k_ASYNC_INTERRUPT & flags));
+
+    do {
+        int numReady;                // number of returned sockets
+        int savedErrno = 0;          // saved errno value set by epoll_wait
+
+        while (1) {
+            int epollTimeout = -1;
+            if (timeout) {
+                if (*timeout < now) {
+                    epollTimeout = 0;
+                }
+                else {
+                    bsls::TimeInterval currTimeout(*timeout - now);
+                    bsls::Types::Int64 totalMs =
+                                               currTimeout.totalMilliseconds();
+                    BSLS_ASSERT(totalMs < INT_MAX);
+
+                    // 'totalMs' is rounded down.
+
+                    epollTimeout = static_cast<int>(totalMs + 1);
+                }
+            }
+
+            // Bring 'epoll' up to date with the changes made since the last
+            // wait (including those made by the callbacks just invoked).
+
+            applyChanges();
+
+            d_signaled.resize(d_numSockets);
+
+            if (d_signaled.empty()) {
+                // No fds to wait for.  We'll just sleep if there is a timeout.
+
+                if (!timeout || 0 == epollTimeout) {
+                    numReady = 0;
+                    break;
+                }
+                numReady = DefaultEventManagerImplUtil::sleep(&savedErrno,
+                                                              *timeout,
+                                                              flags,
+                                                              d_timeMetric_p);
+            }
+            else {
+                if (d_timeMetric_p) {
+                    d_timeMetric_p->switchTo(TimeMetrics::e_IO_BOUND);
+                }
+
+                numReady = ::epoll_wait(d_epollFd,
+                                        &d_signaled.front(),
+                                        static_cast<int>(d_signaled.size()),
+                                        epollTimeout);
+                BSLS_ASSERT(-1 != numReady || EINTR == errno);
+                savedErrno = errno;
+
+                if (d_timeMetric_p) {
+                    d_timeMetric_p->switchTo(TimeMetrics::e_CPU_BOUND);
+                }
+            }
+
+            errno = 0;
+            if (numReady > 0
+             || (numReady < 0
+              && EINTR == savedErrno
+              && allowAsyncInterrupts)) {
+                // Either a fd is ready or we've been interrupted and the user
+                // wants to know.
+
+                break;
+            }
+
+            if (timeout) {
+                now = bdlt::CurrentTime::now();
+                if (now >= *timeout) {
+                    break;
+                }
+            }
+        }
+
+        if (0 >= numReady) {
+            return numReady
+                   ? -1 == numReady && EINTR == savedErrno
+                     ? -1
+                     : -2
+                   : 0;                                               // RETURN
+        }
+
+        // Entries of 'd_handles' are never moved, so the reference below
+        // stays valid even if a callback registers a larger handle.  A
+        // callback may deregister events of any handle, so the generation and
+        // requested mask are consulted immediately before each invocation.
+        // An event whose generation differs was reported before its handle
+        // was removed from 'epoll', and the handle may since have been closed
+        // and reused for another socket: such an event is replaced by the
+        // events the socket now registered for the handle is ready for.
+
+        for (int i = 0; i < numReady; ++i) {
+            const struct ::epoll_event& signaled   = d_signaled[i];
+            const int                   handle     =
+                              static_cast<int>(signaled.data.u64 & 0xFFFFFFFF);
+            const unsigned int          generation =
+                            static_cast<unsigned int>(signaled.data.u64 >> 32);
+            HandleEntry&                entry      = d_handles[handle];
+
+            unsigned int events = signaled.events;
+            if (entry.d_generation != generation) {
+                events = entry.d_mask
+                         ? pollCurrentEvents(handle, entry.d_mask)
+                         : 0;
+            }
+
+            if (events & (EPOLLIN | EPOLLERR | EPOLLHUP)
+             && entry.d_mask & EPOLLIN) {
+                entry.d_readCallback();
+                ++numCallbacks;
+            }
+
+            if (events & (EPOLLOUT | EPOLLERR | EPOLLHUP)
+             && entry.d_mask & EPOLLOUT) {
+                entry.d_writeCallback();
+                ++numCallbacks;
+            }
+        }
+
+        if (timeout) {
+            now = bdlt::CurrentTime::now();
+        }
+    } while (0 == numCallbacks && (0 == timeout || now < *timeout));
+
+    return numCallbacks;
+}
+
+void EventManagerName::scheduleChange(int handle, HandleEntry *entry)
+{
+    BSLS_ASSERT(entry);
+
+    if (!entry->d_isChangePending) {
+        entry->d_isChangePending = true;
+        d_changedHandles.push_back(handle);
+    }
+}
+
+// PUBLIC CLASS METHODS
+bool EventManagerName::isSupported()
+{
+    int fd = ::epoll_create(128);
+    if (-1 == fd) {
+        return false;                                                 // RETURN
+    }
+    ::close(fd);
+    return true;
+}
+
+// CREATORS
+EventManagerName::DefaultEventManager(TimeMetrics      *timeMetric,
+                                      bslma::Allocator *basicAllocator)
+: d_epollFd(-1)
+, d_triggerMode(e_LEVEL_TRIGGERED)
+, d_signaled(basicAllocator)
+, d_timeMetric_p(timeMetric)
+, d_handles(basicAllocator)
+, d_changedHandles(basicAllocator)
+, d_numSockets(0)
+, d_numEvents(0)
+{
+    d_epollFd = ::epoll_create(128);
+    if (-1 == d_epollFd) {
+        bsl::perror("epoll_create returned ");
+        BSLS_ASSERT_OPT("epoll_create() failed" && 0);
+    }
+}
+
+EventManagerName::DefaultEventManager(TriggerMode       triggerMode,
+                                      TimeMetrics      *timeMetric,
+                                      bslma::Allocator *basicAllocator)
+: d_epollFd(-1)
+, d_triggerMode(triggerMode)
+, d_signaled(basicAllocator)
+, d_timeMetric_p(timeMetric)
+, d_handles(basicAllocator)
+, d_changedHandles(basicAllocator)
+, d_numSockets(0)
+, d_numEvents(0)
+{
+    d_epollFd = ::epoll_create(128);
+    if (-1 == d_epollFd) {
+        bsl::perror("epoll_create returned ");
+        BSLS_ASSERT_OPT("epoll_create() failed" && 0);
+    }
+}
+
+EventManagerName::~DefaultEventManager()
+{
+    int rc = ::close(d_epollFd);
+    BSLS_ASSERT(0 == rc);
+    (void)rc;
+}
+
+// MANIPULATORS
+int EventManagerName::dispatch(const bsls::TimeInterval& timeout, int flags)
+{
+    if (0 == numEvents()) {
+        int dummy;
+        return DefaultEventManagerImplUtil::sleep(&dummy,
+                                                  timeout,
+                                                  flags,
+                                                  d_timeMetric_p);    // RETURN
+    }
+    return dispatchImp(flags, &timeout);
+}
+
+int EventManagerName::dispatch(int flags)
+{
+    if (0 == numEvents()) {
+        return 0;                                                     // RETURN
+    }
+    return dispatchImp(flags, 0);
+}
+
+int EventManagerName::registerSocketEvent(
+                                        const SocketHandle::Handle&   handle,
+                                        const EventType::Type         event,
+                                        const EventManager::Callback& callback)
+{
+    BSLS_ASSERT(0 <= handle);
+
+    if (d_handles.size() <= static_cast<bsl::size_t>(handle)) {
+        d_handles.resize(handle + 1);
+    }
+
+    HandleEntry&            entry = d_handles[handle];
+    EventManager::Callback *modifiedCallback;
+
+    if (isReadEvent(event)) {
+        BSLS_ASSERT(0 == (entry.d_mask & EPOLLIN)
+                 || event == entry.d_readEventType);
+
+        entry.d_readCallback  = callback;
+        entry.d_readEventType = event;
+        modifiedCallback      = &entry.d_readCallback;
+    }
+    else {
+        BSLS_ASSERT(0 == (entry.d_mask & EPOLLOUT)
+                 || event == entry.d_writeEventType);
+
+        entry.d_writeCallback  = callback;
+        entry.d_writeEventType = event;
+        modifiedCallback       = &entry.d_writeCallback;
+    }
+
+    const int eventMask = translateEventToMask(event);
+    if (entry.d_mask & eventMask) {
+        // We just updated the callback.
+
+        return 0;                                                     // RETURN
+    }
+
+    const int newMask = entry.d_mask | eventMask;
+
+    // Assert that if two events are registered at the same time, they can
+    // only be READ and WRITE.
+
+    BSLS_ASSERT(0 == (newMask & (newMask - 1))
+             || (EventType::e_READ  == entry.d_readEventType
+              && EventType::e_WRITE == entry.d_writeEventType));
+
+    if (0 == entry.d_mask) {
+        // This handle is not known to 'epoll'.  Add it right away, so that an
+        // invalid handle is reported to the caller.
+
+        BSLS_ASSERT(0 == entry.d_kernelMask);
+
+        const int rc = controlEpoll(handle, EPOLL_CTL_ADD, newMask);
+        if (0 != rc) {
+            *modifiedCallback = EventManager::Callback();
+            return rc;                                                // RETURN
+        }
+
+        entry.d_kernelMask = newMask;
+        ++d_numSockets;
+    }
+    else {
+        scheduleChange(handle, &entry);
+    }
+
+    entry.d_mask = newMask;
+    ++d_numEvents;
+
+    return 0;
+}
+
+void EventManagerName::deregisterSocketEvent(
+                                            const SocketHandle::Handle& handle,
+                                            EventType::Type             event)
+{
+    if (0 > handle || d_handles.size() <= static_cast<bsl::size_t>(handle)) {
+        return;                                                       // RETURN
+    }
+
+    HandleEntry& entry     = d_handles[handle];
+    const int    eventMask = translateEventToMask(event);
+
+    if (0 == (entry.d_mask & eventMask)) {
+        return;                                                       // RETURN
+    }
+
+    if (isReadEvent(event)) {
+        if (event != entry.d_readEventType) {
+            return;                                                   // RETURN
+        }
+        entry.d_readCallback = EventManager::Callback();
+    }
+    else {
+        if (event != entry.d_writeEventType) {
+            return;                                                   // RETURN
+        }
+        entry.d_writeCallback = EventManager::Callback();
+    }
+
+    entry.d_mask &= ~eventMask;
+    --d_numEvents;
+
+    if (0 == entry.d_mask) {
+        // There is no more event to monitor for this handle.  Remove it from
+        // 'epoll' right away, as the handle is likely to be closed (and its
+        // value reused) before the next dispatch.
+
+        const int rc = controlEpoll(handle, EPOLL_CTL_DEL, 0);
+
+        // 'epoll' removes closed file descriptors automatically.
+
+        BSLS_ASSERT(0 == rc || ENOENT == rc || EBADF == rc);
+        (void)rc;
+
+        entry.d_kernelMask = 0;
+        ++entry.d_generation;
+        --d_numSockets;
+    }
+    else {
+        scheduleChange(handle, &entry);
+    }
+}
+
+int EventManagerName::deregisterSocket(const SocketHandle::Handle& handle)
+{
+    if (0 > handle || d_handles.size() <= static_cast<bsl::size_t>(handle)) {
+        return 0;                                                     // RETURN
+    }
+
+    HandleEntry& entry = d_handles[handle];
+    if (0 == entry.d_mask) {
+        return 0;                                                     // RETURN
+    }
+
+    const int numEvents = (entry.d_mask & EPOLLIN  ? 1 : 0)
+                        + (entry.d_mask & EPOLLOUT ? 1 : 0);
+
+    const int rc = controlEpoll(handle, EPOLL_CTL_DEL, 0);
+
+    // 'epoll' removes closed file descriptors automatically.
+
+    BSLS_ASSERT(0 == rc || ENOENT == rc || EBADF == rc);
+    (void)rc;
+
+    entry.d_readCallback  = EventManager::Callback();
+    entry.d_writeCallback = EventManager::Callback();
+    entry.d_mask          = 0;
+    entry.d_kernelMask    = 0;
+    ++entry.d_generation;
+
+    --d_numSockets;
+    d_numEvents -= numEvents;
+
+    return numEvents;
+}
+
+void EventManagerName::deregisterAll()
+{
+    const int numHandles = static_cast<int>(d_handles.size());
+    for (int handle = 0; handle < numHandles; ++handle) {
+        HandleEntry& entry = d_handles[handle];
+
+        entry.d_isChangePending = false;
+
+        if (0 == entry.d_mask) {
+            continue;
+        }
+
+        const int rc = controlEpoll(handle, EPOLL_CTL_DEL, 0);
+
+        // 'epoll' removes closed file descriptors automatically.
+
+        BSLS_ASSERT(0 == rc || ENOENT == rc || EBADF == rc);
+        (void)rc;
+
+        entry.d_readCallback  = EventManager::Callback();
+        entry.d_writeCallback = EventManager::Callback();
+        entry.d_mask          = 0;
+        entry.d_kernelMask    = 0;
+        ++entry.d_generation;
+    }
+
+    d_changedHandles.clear();
+    d_numSockets = 0;
+    d_numEvents  = 0;
+}
+
+// ACCESSORS
+int EventManagerName::isRegistered(const SocketHandle::Handle& handle,
+                                   const EventType::Type       event) const
+{
+    if (0 > handle || d_handles.size() <= static_cast<bsl::size_t>(handle)) {
+        return 0;                                                     // RETURN
+    }
+
+    const HandleEntry& entry = d_handles[handle];
+    if (0 == (entry.d_mask & translateEventToMask(event))) {
+        return 0;                                                     // RETURN
+    }
+
+    return isReadEvent(event) ? event == entry.d_readEventType
+                              : event == entry.d_writeEventType;
+}
+
+int EventManagerName::numSocketEvents(const SocketHandle::Handle& handle) const
+{
+    if (0 > handle || d_handles.size() <= static_cast<bsl::size_t>(handle)) {
+        return 0;                                                     // RETURN
+    }
+
+    const int mask = d_handles[handle].d_mask;
+    return (mask & EPOLLIN ? 1 : 0) + (mask & EPOLLOUT ? 1 : 0);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif // BSLS_PLATFORM_OS_LINUX
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,528 @@
+// btlso_defaulteventmanager_flatepoll.h                              -*-C++-*-
+#ifndef INCLUDED_BTLSO_DEFAULTEVENTMANAGER_FLATEPOLL
+#define INCLUDED_BTLSO_DEFAULTEVENTMANAGER_FLATEPOLL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an 'epoll' multiplexer with an fd-indexed handler table.
+//
+//@CLASSES:
+//  btlso::DefaultEventManager<btlso::Platform::FLAT_EPOLL>: flat multiplexer
+//
+//@SEE_ALSO: btlso_defaulteventmanager_epoll btlso_eventmanager
+//
+//@DESCRIPTION: This component provides an implementation of an event manager,
+// 'btlso::DefaultEventManager<btlso::Platform::FLAT_EPOLL>', that uses the
+// Linux 'epoll' system calls to monitor for socket events and adheres to the
+// 'btlso::EventManager' protocol.  It is an alternative to
+// 'btlso::DefaultEventManager<btlso::Platform::EPOLL>' intended for
+// dispatchers that monitor a large number (tens of thousands) of sockets, and
+// differs from it in three respects:
+//
+//: 1 Registrations are kept in a table indexed directly by the socket handle
+//:   rather than in a hash table, so locating the callbacks for a signaled
+//:   socket is a single indexing operation, and deregistering a socket from
+//:   within a callback does not require deferred cleanup.  Each entry counts
+//:   the number of times its handle was deregistered, and each event
+//:   reported by 'epoll' carries that count, so that an event reported for a
+//:   handle that a callback closed (and possibly reused for a new socket)
+//:   earlier in the same dispatch is not delivered to the new registration
+//:   unless the socket now registered for that handle is itself ready.
+//:
+//: 2 Changes to the set of events monitored for a socket that is already
+//:   known to 'epoll' (e.g., toggling interest in 'e_WRITE' as an output
+//:   queue fills and drains) are recorded and applied in a single pass
+//:   immediately before the next call to 'epoll_wait', so that any number of
+//:   such changes made between two dispatches costs at most one 'epoll_ctl'
+//:   call per socket, and changes that cancel each other cost none.  Adding a
+//:   socket to, or removing it from, 'epoll' is always performed immediately,
+//:   so 'registerSocketEvent' still reports invalid handles, and a handle
+//:   that is closed after being deregistered can be safely reused.
+//:
+//: 3 The event manager can optionally be created in edge-triggered mode (see
+//:   {Trigger Modes}).
+//
+///Trigger Modes
+///-------------
+// By default (i.e., in 'e_LEVEL_TRIGGERED' mode) this event manager has
+// exactly the semantics required by the 'btlso::EventManager' protocol: the
+// callback registered for a socket event is invoked on every call to
+// 'dispatch' for as long as the event condition holds.
+//
+// In 'e_EDGE_TRIGGERED' mode, sockets are registered with 'EPOLLET', and a
+// callback is invoked only when the corresponding event condition becomes
+// true (e.g., new data arrives).  This eliminates repeated notifications for
+// sockets whose callbacks deliberately consume only part of the available
+// data, but it is correct *only* for callers whose callbacks read (or write)
+// until the operation would block; otherwise, the remaining data is not
+// signaled again until more data arrives.  Note that 'EPOLLONESHOT' is not
+// used in either mode: each event manager is dispatched by a single thread,
+// and re-arming a one-shot registration would cost an additional system call
+// per signaled event.
+//
+///Availability
+///------------
+// The 'epoll' systems calls (and consequently this specialized component) is
+// currently supported only on Linux.  Direct use of this library component on
+// *any* platform may result in non-portable software.
+//
+///Thread Safety
+///-------------
+// This component depends on a 'bslma::Allocator' instance to supply memory.
+// If the allocator is not thread enabled then the instances of this component
+// that use the same allocator instance will consequently not be thread safe
+// Otherwise, this component provides the following guarantees.
+//
+// Accessing an instance of the event manager provided by this component from
+// different threads may result in undefined behavior.  Accessing distinct
+// instances from different threads is safe.  Distinct instances of the event
+// manager provided by this component are *thread* *enabled* meaning that
+// operations invoked on distinct instances from different threads can proceed
+// concurrently.  The event manager is not *async-safe*, meaning that one or
+// more functions cannot be invoked safely from a signal handler.
+//
+///Performance
+///-----------
+// Given that S is the number of socket events registered, and H is the
+// largest socket handle registered, this component provides the following
+// complexity guarantees:
+//..
+//  +=======================================================================+
+//  |        FUNCTION          | EXPECTED COMPLEXITY | WORST CASE COMPLEXITY|
+//  +-----------------------------------------------------------------------+
+//  | dispatch                 |        O(S)         |        O(S)          |
+//  +-----------------------------------------------------------------------+
+//  | registerSocketEvent      |        O(1)         |        O(H)          |
+//  +-----------------------------------------------------------------------+
+//  | deregisterSocketEvent    |        O(1)         |        O(1)          |
+//  +-----------------------------------------------------------------------+
+//  | deregisterSocket         |        O(1)         |        O(1)          |
+//  +-----------------------------------------------------------------------+
+//  | deregisterAll            |        O(H)         |        O(H)          |
+//  +-----------------------------------------------------------------------+
+//  | numSocketEvents          |        O(1)         |        O(1)          |
+//  +-----------------------------------------------------------------------+
+//  | numEvents                |        O(1)         |        O(1)          |
+//  +-----------------------------------------------------------------------+
+//  | isRegistered             |        O(1)         |        O(1)          |
+//  +=======================================================================+
+//..
+// Note that the worst case of 'registerSocketEvent' is incurred only when the
+// handle table must grow to accommodate a handle larger than any previously
+// registered.
+//
+///Metrics
+///-------
+// The event manager provided by this component can use external (i.e.,
+// user-installed) time metrics (see 'btlso_timemetrics' component) to record
+// times spend in IO-bound and CPU-bound operations using the category IDs
+// defined in 'btlso::TimeMetrics'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Draining a Socket in Edge-Triggered Mode
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// The following snippets of code illustrate how to use this event manager in
+// edge-triggered mode.  First, we define a callback that reads from a
+// non-blocking socket until the read would block, as required by that mode:
+//..
+//  static void drainCb(btlso::SocketHandle::Handle  socket,
+//                      int                         *numBytesRead)
+//  {
+//      char buffer[16];
+//      int  rc;
+//      while (0 < (rc = btlso::SocketImpUtil::read(buffer,
+//                                                  socket,
+//                                                  sizeof buffer,
+//                                                  0))) {
+//          *numBytesRead += rc;
+//      }
+//  }
+//..
+// Then, we create an edge-triggered event manager and a (locally-connected)
+// socket pair, and make the reading end non-blocking:
+//..
+//  typedef btlso::DefaultEventManager<btlso::Platform::FLAT_EPOLL> Obj;
+//
+//  Obj mX(Obj::e_EDGE_TRIGGERED);
+//  assert(Obj::e_EDGE_TRIGGERED == mX.triggerMode());
+//
+//  btlso::SocketHandle::Handle socket[2];
+//
+//  int rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+//                                      socket,
+//                                      btlso::SocketImpUtil::k_SOCKET_STREAM);
+//  assert(0 == rc);
+//
+//  rc = btlso::IoUtil::setBlockingMode(socket[0],
+//                                      btlso::IoUtil::e_NONBLOCKING);
+//  assert(0 == rc);
+//..
+// Next, we register a read event for 'socket[0]', write 100 bytes to
+// 'socket[1]', and dispatch.  The callback is invoked once and consumes all
+// of the data:
+//..
+//  int numBytesRead = 0;
+//  btlso::EventManager::Callback readCb(
+//                   bdlf::BindUtil::bind(&drainCb, socket[0], &numBytesRead));
+//
+//  rc = mX.registerSocketEvent(socket[0], btlso::EventType::e_READ, readCb);
+//  assert(0 == rc);
+//
+//  char data[100] = { 0 };
+//  rc = btlso::SocketImpUtil::write(socket[1], data, sizeof data, 0);
+//  assert(100 == rc);
+//
+//  rc = mX.dispatch(bsls::TimeInterval(1.0), 0);
+//  assert(1 == rc);
+//  assert(100 == numBytesRead);
+//..
+// Finally, we dispatch again with an absolute timeout in the past.  No new
+// data has arrived, so no callback is invoked:
+//..
+//  rc = mX.dispatch(bsls::TimeInterval(0.0), 0);
+//  assert(0 == rc);
+//
+//  mX.deregisterAll();
+//  btlso::SocketImpUtil::close(socket[0]);
+//  btlso::SocketImpUtil::close(socket[1]);
+//..
+
+#ifndef INCLUDED_BTLSCM_VERSION
+#include <btlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_DEFAULTEVENTMANAGERIMPL
+#include <btlso_defaulteventmanagerimpl.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_EVENTMANAGER
+#include <btlso_eventmanager.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_EVENTTYPE
+#include <btlso_eventtype.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_PLATFORM
+#include <btlso_platform.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_SOCKETHANDLE
+#include <btlso_sockethandle.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSL_DEQUE
+#include <bsl_deque.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+#ifndef INCLUDED_SYS_EPOLL
+#include <sys/epoll.h>
+#define INCLUDED_SYS_EPOLL
+#endif
+
+namespace BloombergLP {
+
+namespace bslma { class Allocator; }
+
+namespace bsls { class TimeInterval; }
+
+namespace btlso {
+
+class TimeMetrics;
+
+        // ===============================================
+        // class DefaultEventManager<Platform::FLAT_EPOLL>
+        // ===============================================
+
+template <>
+class DefaultEventManager<Platform::FLAT_EPOLL> : public EventManager {
+    // This class implements the 'btlso::EventManager' protocol using the
+    // Linux 'epoll' system calls, keeping registrations in a table indexed by
+    // socket handle and deferring modifications of existing 'epoll'
+    // registrations until the next dispatch.
+
+  public:
+    // TYPES
+    enum TriggerMode {
+        // Enumerate the ways in which socket events are reported.
+
+        e_LEVEL_TRIGGERED,  // report an event while its condition holds
+        e_EDGE_TRIGGERED    // report an event when its condition becomes true
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct HandleEntry {
+        // This 'struct' holds the registrations for a single socket handle.
+
+        EventManager::Callback d_readCallback;
+        EventManager::Callback d_writeCallback;
+        EventType::Type        d_readEventType;
+        EventType::Type        d_writeEventType;
+        int                    d_mask;        // requested 'epoll' events
+        int                    d_kernelMask;  // events known to 'epoll'
+        unsigned int           d_generation;  // number of times this
+                                              // handle was removed from
+                                              // 'epoll'
+        bool                   d_isChangePending;
+                                              // 'true' if this handle is in
+                                              // 'd_changedHandles'
+
+        HandleEntry()
+            // Create an entry having no registered events.
+        : d_readEventType(EventType::e_READ)
+        , d_writeEventType(EventType::e_WRITE)
+        , d_mask(0)
+        , d_kernelMask(0)
+        , d_generation(0)
+        , d_isChangePending(false)
+        {
+        }
+    };
+
+    // DATA
+    int                               d_epollFd;      // epoll fd
+
+    TriggerMode                       d_triggerMode;  // trigger mode
+
+    bsl::vector<struct ::epoll_event> d_signaled;     // array of signaled
+                                                      // events
+
+    TimeMetrics                      *d_timeMetric_p; // metrics to use for
+                                                      // reporting percent-busy
+                                                      // statistics
+
+    bsl::deque<HandleEntry>           d_handles;      // registrations indexed
+                                                      // by socket handle; a
+                                                      // deque, so growing it
+                                                      // from a callback does
+                                                      // not move entries
+
+    bsl::vector<int>                  d_changedHandles;
+                                                      // handles whose
+                                                      // requested events
+                                                      // differ from those
+                                                      // known to 'epoll'
+
+    int                               d_numSockets;   // number of handles
+                                                      // having a registered
+                                                      // event
+
+    int                               d_numEvents;    // number of registered
+                                                      // events
+
+    // PRIVATE MANIPULATORS
+    int applyChanges();
+        // Apply to 'epoll' the changes recorded in 'd_changedHandles'.
+        // Return the number of 'epoll_ctl' calls made.
+
+    int controlEpoll(int handle, int operation, int mask);
+        // Invoke 'epoll_ctl' with the specified 'operation' to monitor the
+        // specified 'mask' of events on the specified 'handle', tagging the
+        // events reported for 'handle' with the current generation of its
+        // entry.  Return 0 on success and the native error code otherwise.
+
+    int dispatchImp(int flags, const bsls::TimeInterval *timeout = 0);
+        // For each pending socket event, invoke the corresponding callback
+        // registered with this event manager.
+
+    void scheduleChange(int handle, HandleEntry *entry);
+        // Record that the events monitored for the specified 'handle', whose
+        // registrations are in the specified 'entry', must be updated in
+        // 'epoll' before the next wait.
+
+  private:
+    // NOT IMPLEMENTED
+    DefaultEventManager(const DefaultEventManager&);
+    DefaultEventManager& operator=(const DefaultEventManager&);
+
+  public:
+    // PUBLIC CLASS METHODS
+    static bool isSupported();
+        // Return true if the current kernel supports this event manager.
+
+    // CREATORS
+    explicit
+    DefaultEventManager(TimeMetrics      *timeMetric     = 0,
+                        bslma::Allocator *basicAllocator = 0);
+    explicit
+    DefaultEventManager(TriggerMode       triggerMode,
+                        TimeMetrics      *timeMetric     = 0,
+                        bslma::Allocator *basicAllocator = 0);
+        // Create a 'epoll'-based event manager.  Optionally specify a
+        // 'triggerMode' indicating how socket events are reported.  If
+        // 'triggerMode' is not specified, 'e_LEVEL_TRIGGERED' is used.
+        // Optionally specify a 'timeMetric' to report time spent in CPU-bound
+        // and IO-bound operations.  If 'timeMetric' is not specified or is 0,
+        // these metrics are not reported.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  Note that
+        // 'e_EDGE_TRIGGERED' is appropriate only if every registered callback
+        // consumes its event until the corresponding operation would block
+        // (see {Trigger Modes}).
+
+    ~DefaultEventManager();
+        // Destroy this object.  Note that the registered callbacks are NOT
+        // invoked.
+
+    // MANIPULATORS
+    int dispatch(const bsls::TimeInterval& timeout, int flags);
+        // For each pending socket event, invoke the corresponding callback
+        // registered with this event manager.  If no event is pending, wait
+        // until either (1) at least one event occurs (in which case the
+        // corresponding callback(s) is invoked), (2) the specified absolute
+        // 'timeout' is reached, or (3) provided that the specified 'flags'
+        // contains 'btlso::Flag::k_ASYNC_INTERRUPT', an underlying system call
+        // is interrupted by a signal.  Return the number of dispatched
+        // callbacks on success, 0 if 'timeout' is reached, and a negative
+        // value otherwise; -1 is reserved to indicate that an underlying
+        // system call was interrupted.  When such an interruption occurs this
+        // method will return (-1) if 'flags' contains
+        // 'btlso::Flag::k_ASYNC_INTERRUPT', and otherwise will automatically
+        // restart (i.e., reissue the identical system call).  Note that all
+        // callbacks are invoked in the same thread that invokes 'dispatch',
+        // and the order of invocation, relative to the order of registration,
+        // is unspecified.  Also note that -1 is never returned unless 'flags'
+        // contains 'btlso::Flag::k_ASYNC_INTERRUPT'.
+
+    int dispatch(int flags);
+        // For each pending socket event, invoke the corresponding callback
+        // registered with this event manager.  If no event is pending, wait
+        // until either (1) at least one event occurs (in which case the
+        // corresponding callback(s) is invoked) or (2) provided that the
+        // specified 'flags' contains 'btlso::Flag::k_ASYNC_INTERRUPT', an
+        // underlying system call is interrupted by a signal.  Return the
+        // number of dispatched callbacks on success, and a negative value
+        // otherwise; -1 is reserved to indicate that an underlying system call
+        // was interrupted.  When such an interruption occurs this method will
+        // return (-1) if 'flags' contains 'btlso::Flag::k_ASYNC_INTERRUPT' and
+        // otherwise will automatically restart (i.e., reissue the identical
+        // system call).  Note that all callbacks are invoked in the same
+        // thread that invokes 'dispatch', and the order of invocation,
+        // relative to the order of registration, is unspecified.  Also note
+        // that -1 is never returned unless 'flags' contains
+        // 'btlso::Flag::k_ASYNC_INTERRUPT'.
+
+    int registerSocketEvent(const SocketHandle::Handle&   handle,
+                            const EventType::Type         event,
+                            const EventManager::Callback& callback);
+        // Register with this event manager the specified 'callback' to be
+        // invoked when the specified 'event' occurs on the specified socket
+        // 'handle'.  Each socket event registration stays in effect until it
+        // is subsequently deregistered; the callback is invoked each time the
+        // corresponding event is detected (see {Trigger Modes}).
+        // 'EventType::e_READ' and 'EventType::e_WRITE' are the only events
+        // that can be registered simultaneously for a socket.  If a
+        // registration attempt is made for an event that is already
+        // registered, the callback associated with this event will be
+        // overwritten with the new one.  Simultaneous registration of
+        // incompatible events for the same socket 'handle' will result in
+        // undefined behavior.  Return 0 in success and a non-zero value, which
+        // is the same as native error code, on error.  The behavior is
+        // undefined unless '0 <= handle'.
+
+    void deregisterSocketEvent(const SocketHandle::Handle& handle,
+                               EventType::Type             event);
+        // Deregister from this event manager the callback associated with the
+        // specified 'event' on the specified 'handle' so that said callback
+        // will not be invoked should 'event' occur.
+
+    int deregisterSocket(const SocketHandle::Handle& handle);
+        // Deregister from this event manager all events associated with the
+        // specified socket 'handle'.  Return the number of deregistered
+        // callbacks.
+
+    void deregisterAll();
+        // Deregister from this event manager all events on every socket
+        // handle.
+
+    // ACCESSORS
+    bool hasLimitedSocketCapacity() const;
+        // Return 'true' if this event manager has a limited socket capacity,
+        // and 'false' otherwise.
+
+    int isRegistered(const SocketHandle::Handle& handle,
+                     const EventType::Type       event) const;
+        // Return 1 if the specified 'event' is registered with this event
+        // manager for the specified socket 'handle' and 0 otherwise.
+
+    int numEvents() const;
+        // Return the total number of all socket events currently registered
+        // with this event manager.
+
+    int numSocketEvents(const SocketHandle::Handle& handle) const;
+        // Return the number of socket events currently registered with this
+        // event manager for the specified 'handle'.
+
+    TriggerMode triggerMode() const;
+        // Return the trigger mode of this event manager.
+};
+
+//-----------------------------------------------------------------------------
+//                      INLINE FUNCTION DEFINITIONS
+//-----------------------------------------------------------------------------
+
+        // -----------------------------------------------
+        // class DefaultEventManager<Platform::FLAT_EPOLL>
+        // -----------------------------------------------
+
+// ACCESSORS
+inline
+bool
+DefaultEventManager<Platform::FLAT_EPOLL>::hasLimitedSocketCapacity() const
+{
+    return false;
+}
+
+inline
+int DefaultEventManager<Platform::FLAT_EPOLL>::numEvents() const
+{
+    return d_numEvents;
+}
+
+inline
+DefaultEventManager<Platform::FLAT_EPOLL>::TriggerMode
+DefaultEventManager<Platform::FLAT_EPOLL>::triggerMode() const
+{
+    return d_triggerMode;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif // BSLS_PLATFORM_OS_LINUX
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
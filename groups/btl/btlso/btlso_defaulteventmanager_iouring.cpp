@@ -0,0 +1,904 @@
+// btlso_defaulteventmanager_iouring.cpp                              -*-C++-*-
+#include <btlso_defaulteventmanager_iouring.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(btlso_defaulteventmanager_iouring_cpp,"$Id$ $CSID$")
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+#include <btlso_flag.h>
+#include <btlso_timemetrics.h>
+
+#include <bdlt_currenttime.h>
+
+#include <bsls_assert.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_c_errno.h>
+#include <bsl_climits.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// '<linux/io_uring.h>' is absent from older kernel headers, in which case
+// this event manager is reported as unsupported.
+
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+#endif
+
+#if defined(__NR_io_uring_setup) && defined(IORING_FEAT_EXT_ARG)
+#define BTLSO_DEFAULTEVENTMANAGER_IOURING_AVAILABLE 1
+#endif
+
+namespace BloombergLP {
+namespace btlso {
+
+namespace {
+
+enum {
+    k_NUM_ENTRIES = 1024  // capacity of the submission ring
+};
+
+const bsls::Types::Uint64 k_IGNORED_USER_DATA = ~0ULL;
+    // User data of requests whose completions are ignored (i.e., poll
+    // removals).
+
+inline
+int translateEventToMask(EventType::Type event)
+    // Return the poll event bit corresponding to the specified 'event'.
+{
+    switch (event) {
+      case EventType::e_ACCEPT:                                 // FALL THROUGH
+      case EventType::e_READ: {
+        return POLLIN;                                                // RETURN
+      } break;
+      case EventType::e_CONNECT:                                // FALL THROUGH
+      case EventType::e_WRITE: {
+        return POLLOUT;                                               // RETURN
+      } break;
+      default: {
+        BSLS_ASSERT("Invalid event (must be unreachable)" && 0);
+        return 0;                                                     // RETURN
+      } break;
+    }
+}
+
+inline
+bool isReadEvent(EventType::Type event)
+    // Return 'true' if the specified 'event' is registered in the read slot
+    // of a handle entry, and 'false' otherwise.
+{
+    return EventType::e_READ == event || EventType::e_ACCEPT == event;
+}
+
+inline
+bsls::Types::Uint64 makeUserData(int handle, unsigned int generation)
+    // Return the user data identifying the poll request having the specified
+    // 'generation' for the specified 'handle'.
+{
+    return static_cast<bsls::Types::Uint64>(generation) << 32
+         | static_cast<unsigned int>(handle);
+}
+
+inline
+unsigned int loadAcquire(const unsigned int *address)
+    // Return the value at the specified 'address' (shared with the kernel),
+    // with acquire semantics.
+{
+    return __atomic_load_n(address, __ATOMIC_ACQUIRE);
+}
+
+inline
+void storeRelease(unsigned int *address, unsigned int value)
+    // Store the specified 'value' at the specified 'address' (shared with the
+    // kernel), with release semantics.
+{
+    __atomic_store_n(address, value, __ATOMIC_RELEASE);
+}
+
+#ifdef BTLSO_DEFAULTEVENTMANAGER_IOURING_AVAILABLE
+
+inline
+int ioUringSetup(unsigned int numEntries, struct io_uring_params *params)
+    // Invoke the 'io_uring_setup' system call with the specified
+    // 'numEntries' and 'params'.
+{
+    return static_cast<int>(::syscall(__NR_io_uring_setup,
+                                      numEntries,
+                                      params));
+}
+
+inline
+int ioUringEnter(int          fd,
+                 unsigned int toSubmit,
+                 unsigned int minComplete,
+                 unsigned int flags,
+                 const void  *arg,
+                 bsl::size_t  argSize)
+    // Invoke the 'io_uring_enter' system call with the specified arguments.
+{
+    return static_cast<int>(::syscall(__NR_io_uring_enter,
+                                      fd,
+                                      toSubmit,
+                                      minComplete,
+                                      flags,
+                                      arg,
+                                      argSize));
+}
+
+#endif
+
+}  // close unnamed namespace
+
+         // ---------------------------------------------
+         // class DefaultEventManager<Platform::IO_URING>
+         // ---------------------------------------------
+
+typedef DefaultEventManager<Platform::IO_URING> EventManagerName;
+    // Alias for brevity.
+
+#ifdef BTLSO_DEFAULTEVENTMANAGER_IOURING_AVAILABLE
+
+// PRIVATE MANIPULATORS
+void EventManagerName::armPending()
+{
+    for (bsl::vector<int>::const_iterator it  = d_armQueue.begin();
+                                          it != d_armQueue.end();
+                                        ++it) {
+        HandleEntry& entry = d_handles[*it];
+
+        entry.d_isArmPending = false;
+
+        if (0 == entry.d_mask || 0 != entry.d_armedMask) {
+            continue;
+        }
+
+        struct io_uring_sqe *sqe = static_cast<struct io_uring_sqe *>(
+                                                             nextSubmission());
+        sqe->opcode      = IORING_OP_POLL_ADD;
+        sqe->fd          = *it;
+        sqe->poll_events = static_cast<unsigned short>(entry.d_mask);
+        sqe->user_data   = makeUserData(*it, entry.d_generation);
+        commitSubmission();
+
+        entry.d_armedMask = entry.d_mask;
+    }
+    d_armQueue.clear();
+}
+
+void EventManagerName::cancelPoll(int handle, HandleEntry *entry)
+{
+    BSLS_ASSERT(entry);
+
+    if (0 == entry->d_armedMask) {
+        return;                                                       // RETURN
+    }
+
+    struct io_uring_sqe *sqe = static_cast<struct io_uring_sqe *>(
+                                                             nextSubmission());
+    sqe->opcode    = IORING_OP_POLL_REMOVE;
+    sqe->fd        = -1;
+    sqe->addr      = makeUserData(handle, entry->d_generation);
+    sqe->user_data = k_IGNORED_USER_DATA;
+    commitSubmission();
+
+    // A completion of the cancelled request may already be in the
+    // completion ring; changing the generation causes it to be ignored.
+
+    if (0 == ++entry->d_generation) {
+        entry->d_generation = 1;
+    }
+    entry->d_armedMask = 0;
+}
+
+void EventManagerName::commitSubmission()
+{
+    // The entry is filled before the tail is published, and the release
+    // store orders the two: the kernel may consume the entry as soon as it
+    // observes the new tail (e.g., if a submission thread polls the ring).
+
+    storeRelease(d_ring.d_sqTail_p, *d_ring.d_sqTail_p + 1);
+    ++d_ring.d_numUnsubmitted;
+}
+
+int EventManagerName::dispatchImp(int                       flags,
+                                  const bsls::TimeInterval *timeout)
+{
+    bsls::TimeInterval now;
+    if (timeout) {
+        now = bdlt::CurrentTime::now();
+    }
+
+    int numCallbacks = 0;                    // number of callbacks dispatched
+
+    const bool allowAsyncInterrupts =
+                                      (0 != (Flag::k_ASYNC_INTERRUPT & flags));
+
+    do {
+        int numReady;                // number of relevant completions
+        int savedErrno = 0;          // saved error of 'io_uring_enter'
+
+        while (1) {
+            bsls::TimeInterval relativeTimeout;
+            if (timeout && *timeout > now) {
+                relativeTimeout = *timeout - now;
+            }
+
+            // Queue the poll requests of the sockets signaled by the previous
+            // dispatch, and of the sockets whose registrations changed since.
+
+            armPending();
+
+            numReady = reapCompletions();
+            if (0 < numReady) {
+                break;
+            }
+
+            if (0 == d_numSockets) {
+                // No fds to wait for.  We'll just sleep if there is a timeout.
+
+                if (0 != d_ring.d_numUnsubmitted) {
+                    savedErrno = enter(0, 0);
+                    BSLS_ASSERT(0 == savedErrno);
+                }
+                if (!timeout || *timeout <= now) {
+                    numReady = 0;
+                    break;
+                }
+                numReady = DefaultEventManagerImplUtil::sleep(&savedErrno,
+                                                              *timeout,
+                                                              flags,
+                                                              d_timeMetric_p);
+            }
+            else {
+                if (d_timeMetric_p) {
+                    d_timeMetric_p->switchTo(TimeMetrics::e_IO_BOUND);
+                }
+
+                // Submit the queued requests and wait, in a single system
+                // call.  'io_uring_enter' reports an interruption of the wait
+                // only if it submitted no request, though, so requests are
+                // submitted separately if interruptions must be reported.
+
+                if (allowAsyncInterrupts && 0 != d_ring.d_numUnsubmitted) {
+                    enter(0, 0);
+                }
+
+                savedErrno = enter(IORING_ENTER_GETEVENTS,
+                                   timeout ? &relativeTimeout : 0);
+                BSLS_ASSERT(0      == savedErrno
+                         || EINTR  == savedErrno
+                         || ETIME  == savedErrno
+                         || EBUSY  == savedErrno
+                         || EAGAIN == savedErrno);
+
+                if (d_timeMetric_p) {
+                    d_timeMetric_p->switchTo(TimeMetrics::e_CPU_BOUND);
+                }
+
+                numReady = EINTR == savedErrno ? -1 : reapCompletions();
+            }
+
+            if (numReady > 0
+             || (numReady < 0
+              && EINTR == savedErrno
+              && allowAsyncInterrupts)) {
+                // Either a fd is ready or we've been interrupted and the user
+                // wants to know.
+
+                break;
+            }
+
+            if (timeout) {
+                now = bdlt::CurrentTime::now();
+                if (now >= *timeout) {
+                    break;
+                }
+            }
+        }
+
+        if (0 >= numReady) {
+            return numReady
+                   ? -1 == numReady && EINTR == savedErrno
+                     ? -1
+                     : -2
+                   : 0;                                               // RETURN
+        }
+
+        // Entries of 'd_handles' are never moved, so the reference below
+        // stays valid even if a callback registers a larger handle.  A
+        // callback may deregister (or re-register) events of any handle,
+        // which changes its generation, so the generation and requested mask
+        // are consulted immediately before each invocation.
+
+        // Note that 'd_completions' may grow while callbacks are invoked,
+        // should they fill the submission ring, so its elements are copied.
+
+        for (bsl::size_t i = 0; i < d_completions.size(); ++i) {
+            const Completion   completion = d_completions[i];
+            const int          handle     = static_cast<int>(
+                                        completion.d_userData & 0xFFFFFFFFULL);
+            const unsigned int generation = static_cast<unsigned int>(
+                                                  completion.d_userData >> 32);
+
+            HandleEntry& entry = d_handles[handle];
+            if (generation != entry.d_generation) {
+                continue;
+            }
+
+            // A failed request is reported as an error on the socket, as
+            // 'epoll' would.
+
+            const int events = 0 > completion.d_result
+                               ? POLLERR
+                               : completion.d_result;
+
+            if (events & (POLLIN | POLLERR | POLLHUP)
+             && entry.d_mask & POLLIN
+             && generation == entry.d_generation) {
+                entry.d_readCallback();
+                ++numCallbacks;
+            }
+
+            if (events & (POLLOUT | POLLERR | POLLHUP)
+             && entry.d_mask & POLLOUT
+             && generation == entry.d_generation) {
+                entry.d_writeCallback();
+                ++numCallbacks;
+            }
+        }
+        d_completions.clear();
+
+        if (timeout) {
+            now = bdlt::CurrentTime::now();
+        }
+    } while (0 == numCallbacks && (0 == timeout || now < *timeout));
+
+    return numCallbacks;
+}
+
+int EventManagerName::enter(int                       waitFlags,
+                            const bsls::TimeInterval *relativeTimeout)
+{
+    struct __kernel_timespec      ts;
+    struct io_uring_getevents_arg arg;
+    bsl::memset(&arg, 0, sizeof arg);
+
+    unsigned int flags       = IORING_ENTER_EXT_ARG;
+    unsigned int minComplete = 0;
+
+    if (waitFlags) {
+        flags       |= waitFlags;
+        minComplete  = 1;
+
+        if (relativeTimeout) {
+            ts.tv_sec  = relativeTimeout->seconds();
+            ts.tv_nsec = relativeTimeout->nanoseconds();
+            arg.ts     = reinterpret_cast<bsls::Types::Uint64>(&ts);
+        }
+    }
+
+    const int rc = ioUringEnter(d_ring.d_fd,
+                                d_ring.d_numUnsubmitted,
+                                minComplete,
+                                flags,
+                                &arg,
+                                sizeof arg);
+    if (0 > rc) {
+        return errno;                                                 // RETURN
+    }
+
+    // Entries that were not consumed (e.g., because the completion ring
+    // overflowed) remain queued for the next call.
+
+    d_ring.d_numUnsubmitted -= bsl::min(static_cast<unsigned int>(rc),
+                                        d_ring.d_numUnsubmitted);
+    return 0;
+}
+
+void *EventManagerName::nextSubmission()
+{
+    unsigned int tail = *d_ring.d_sqTail_p;
+
+    if (tail - loadAcquire(d_ring.d_sqHead_p) == d_ring.d_sqEntries) {
+        // The submission ring is full: hand the queued entries to the kernel
+        // without waiting.
+
+        const int rc = enter(0, 0);
+        BSLS_ASSERT_OPT(0 == rc || EBUSY == rc || EAGAIN == rc);
+        (void)rc;
+
+        while (tail - loadAcquire(d_ring.d_sqHead_p) == d_ring.d_sqEntries) {
+            // The kernel could not consume any entry, as the completion ring
+            // overflowed; make room by draining it.
+
+            reapCompletions();
+            enter(0, 0);
+        }
+    }
+
+    // The entry is published by 'commitSubmission', once filled.
+
+    struct io_uring_sqe *sqe = static_cast<struct io_uring_sqe *>(
+                                                              d_ring.d_sqes_p)
+                             + (tail & d_ring.d_sqMask);
+    bsl::memset(sqe, 0, sizeof *sqe);
+
+    return sqe;
+}
+
+int EventManagerName::reapCompletions()
+{
+    unsigned int       head = *d_ring.d_cqHead_p;
+    const unsigned int tail = loadAcquire(d_ring.d_cqTail_p);
+
+    const struct io_uring_cqe *cqes = static_cast<const struct io_uring_cqe *>(
+                                                              d_ring.d_cqes_p);
+
+    for (; head != tail; ++head) {
+        const struct io_uring_cqe& cqe = cqes[head & d_ring.d_cqMask];
+        if (k_IGNORED_USER_DATA == cqe.user_data) {
+            continue;
+        }
+
+        // The poll request completed, and must be re-armed before the next
+        // wait.  This is recorded right away so that a callback dispatched
+        // before this completion does not cancel the completed request, and
+        // thereby discard this completion.
+
+        const int          handle     = static_cast<int>(
+                                               cqe.user_data & 0xFFFFFFFFULL);
+        const unsigned int generation = static_cast<unsigned int>(
+                                                         cqe.user_data >> 32);
+
+        HandleEntry& entry = d_handles[handle];
+        if (generation != entry.d_generation) {
+            continue;
+        }
+
+        entry.d_armedMask = 0;
+        scheduleArm(handle, &entry);
+
+        Completion completion;
+        completion.d_userData = cqe.user_data;
+        completion.d_result   = cqe.res;
+        d_completions.push_back(completion);
+    }
+    storeRelease(d_ring.d_cqHead_p, head);
+
+    return static_cast<int>(d_completions.size());
+}
+
+#else  // BTLSO_DEFAULTEVENTMANAGER_IOURING_AVAILABLE
+
+// PRIVATE MANIPULATORS
+void EventManagerName::armPending()
+{
+    d_armQueue.clear();
+}
+
+void EventManagerName::cancelPoll(int, HandleEntry *)
+{
+}
+
+void EventManagerName::commitSubmission()
+{
+}
+
+int EventManagerName::dispatchImp(int, const bsls::TimeInterval *)
+{
+    return -2;
+}
+
+int EventManagerName::enter(int, const bsls::TimeInterval *)
+{
+    return ENOSYS;
+}
+
+void *EventManagerName::nextSubmission()
+{
+    return 0;
+}
+
+int EventManagerName::reapCompletions()
+{
+    return 0;
+}
+
+#endif  // BTLSO_DEFAULTEVENTMANAGER_IOURING_AVAILABLE
+
+void EventManagerName::scheduleArm(int handle, HandleEntry *entry)
+{
+    BSLS_ASSERT(entry);
+
+    if (!entry->d_isArmPending) {
+        entry->d_isArmPending = true;
+        d_armQueue.push_back(handle);
+    }
+}
+
+// PUBLIC CLASS METHODS
+bool EventManagerName::isSupported()
+{
+#ifdef BTLSO_DEFAULTEVENTMANAGER_IOURING_AVAILABLE
+    struct io_uring_params params;
+    bsl::memset(&params, 0, sizeof params);
+
+    const int fd = ioUringSetup(8, &params);
+    if (0 > fd) {
+        return false;                                                 // RETURN
+    }
+    ::close(fd);
+
+    const unsigned int k_REQUIRED = IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG;
+    return k_REQUIRED == (params.features & k_REQUIRED);
+#else
+    return false;
+#endif
+}
+
+// CREATORS
+EventManagerName::DefaultEventManager(TimeMetrics      *timeMetric,
+                                      bslma::Allocator *basicAllocator)
+: d_timeMetric_p(timeMetric)
+, d_handles(basicAllocator)
+, d_armQueue(basicAllocator)
+, d_completions(basicAllocator)
+, d_numSockets(0)
+, d_numEvents(0)
+{
+    bsl::memset(&d_ring, 0, sizeof d_ring);
+    d_ring.d_fd = -1;
+
+#ifdef BTLSO_DEFAULTEVENTMANAGER_IOURING_AVAILABLE
+    struct io_uring_params params;
+    bsl::memset(&params, 0, sizeof params);
+
+    d_ring.d_fd = ioUringSetup(k_NUM_ENTRIES, &params);
+    if (0 > d_ring.d_fd) {
+        bsl::perror("io_uring_setup returned ");
+        BSLS_ASSERT_OPT("io_uring_setup() failed" && 0);
+    }
+
+    d_ring.d_sqRingSize = params.sq_off.array
+                        + params.sq_entries * sizeof(unsigned int);
+    d_ring.d_cqRingSize = params.cq_off.cqes
+                        + params.cq_entries * sizeof(struct io_uring_cqe);
+    d_ring.d_sqesSize   = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    const bool isSingleMapping = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (isSingleMapping) {
+        d_ring.d_sqRingSize = bsl::max(d_ring.d_sqRingSize,
+                                       d_ring.d_cqRingSize);
+        d_ring.d_cqRingSize = d_ring.d_sqRingSize;
+    }
+
+    d_ring.d_sqRing_p = ::mmap(0,
+                               d_ring.d_sqRingSize,
+                               PROT_READ | PROT_WRITE,
+                               MAP_SHARED | MAP_POPULATE,
+                               d_ring.d_fd,
+                               IORING_OFF_SQ_RING);
+    BSLS_ASSERT_OPT(MAP_FAILED != d_ring.d_sqRing_p);
+
+    d_ring.d_cqRing_p = isSingleMapping
+                        ? d_ring.d_sqRing_p
+                        : ::mmap(0,
+                                 d_ring.d_cqRingSize,
+                                 PROT_READ | PROT_WRITE,
+                                 MAP_SHARED | MAP_POPULATE,
+                                 d_ring.d_fd,
+                                 IORING_OFF_CQ_RING);
+    BSLS_ASSERT_OPT(MAP_FAILED != d_ring.d_cqRing_p);
+
+    d_ring.d_sqes_p = ::mmap(0,
+                             d_ring.d_sqesSize,
+                             PROT_READ | PROT_WRITE,
+                             MAP_SHARED | MAP_POPULATE,
+                             d_ring.d_fd,
+                             IORING_OFF_SQES);
+    BSLS_ASSERT_OPT(MAP_FAILED != d_ring.d_sqes_p);
+
+    char *sqRing = static_cast<char *>(d_ring.d_sqRing_p);
+    char *cqRing = static_cast<char *>(d_ring.d_cqRing_p);
+
+    d_ring.d_sqHead_p  = reinterpret_cast<unsigned int *>(
+                                                 sqRing + params.sq_off.head);
+    d_ring.d_sqTail_p  = reinterpret_cast<unsigned int *>(
+                                                 sqRing + params.sq_off.tail);
+    d_ring.d_sqMask    = *reinterpret_cast<unsigned int *>(
+                                            sqRing + params.sq_off.ring_mask);
+    d_ring.d_sqEntries = *reinterpret_cast<unsigned int *>(
+                                         sqRing + params.sq_off.ring_entries);
+    d_ring.d_cqHead_p  = reinterpret_cast<unsigned int *>(
+                                                 cqRing + params.cq_off.head);
+    d_ring.d_cqTail_p  = reinterpret_cast<unsigned int *>(
+                                                 cqRing + params.cq_off.tail);
+    d_ring.d_cqMask    = *reinterpret_cast<unsigned int *>(
+                                            cqRing + params.cq_off.ring_mask);
+    d_ring.d_cqes_p    = cqRing + params.cq_off.cqes;
+
+    // Submission queue entries are used in ring order, so the indirection
+    // array is the identity.
+
+    unsigned int *sqArray = reinterpret_cast<unsigned int *>(
+                                                sqRing + params.sq_off.array);
+    for (unsigned int i = 0; i < d_ring.d_sqEntries; ++i) {
+        sqArray[i] = i;
+    }
+#else
+    BSLS_ASSERT_OPT("io_uring is not available" && 0);
+#endif
+}
+
+EventManagerName::~DefaultEventManager()
+{
+    if (d_ring.d_sqes_p) {
+        ::munmap(d_ring.d_sqes_p, d_ring.d_sqesSize);
+    }
+    if (d_ring.d_cqRing_p && d_ring.d_cqRing_p != d_ring.d_sqRing_p) {
+        ::munmap(d_ring.d_cqRing_p, d_ring.d_cqRingSize);
+    }
+    if (d_ring.d_sqRing_p) {
+        ::munmap(d_ring.d_sqRing_p, d_ring.d_sqRingSize);
+    }
+
+    // Closing the ring cancels the outstanding poll requests.
+
+    if (0 <= d_ring.d_fd) {
+        const int rc = ::close(d_ring.d_fd);
+        BSLS_ASSERT(0 == rc);
+        (void)rc;
+    }
+}
+
+// MANIPULATORS
+int EventManagerName::dispatch(const bsls::TimeInterval& timeout, int flags)
+{
+    if (0 == numEvents()) {
+        int dummy;
+        return DefaultEventManagerImplUtil::sleep(&dummy,
+                                                  timeout,
+                                                  flags,
+                                                  d_timeMetric_p);    // RETURN
+    }
+    return dispatchImp(flags, &timeout);
+}
+
+int EventManagerName::dispatch(int flags)
+{
+    if (0 == numEvents()) {
+        return 0;                                                     // RETURN
+    }
+    return dispatchImp(flags, 0);
+}
+
+int EventManagerName::registerSocketEvent(
+                                        const SocketHandle::Handle&   handle,
+                                        const EventType::Type         event,
+                                        const EventManager::Callback& callback)
+{
+    BSLS_ASSERT(0 <= handle);
+
+    if (d_handles.size() <= static_cast<bsl::size_t>(handle)) {
+        d_handles.resize(handle + 1);
+    }
+
+    HandleEntry& entry = d_handles[handle];
+
+    if (0 == entry.d_mask && -1 == ::fcntl(handle, F_GETFD)) {
+        // Poll requests on an invalid handle fail asynchronously; report the
+        // error to the caller instead, as the other event managers do.
+
+        return errno;                                                 // RETURN
+    }
+
+    if (isReadEvent(event)) {
+        BSLS_ASSERT(0 == (entry.d_mask & POLLIN)
+                 || event == entry.d_readEventType);
+
+        entry.d_readCallback  = callback;
+        entry.d_readEventType = event;
+    }
+    else {
+        BSLS_ASSERT(0 == (entry.d_mask & POLLOUT)
+                 || event == entry.d_writeEventType);
+
+        entry.d_writeCallback  = callback;
+        entry.d_writeEventType = event;
+    }
+
+    const int eventMask = translateEventToMask(event);
+    if (entry.d_mask & eventMask) {
+        // We just updated the callback.
+
+        return 0;                                                     // RETURN
+    }
+
+    const int newMask = entry.d_mask | eventMask;
+
+    // Assert that if two events are registered at the same time, they can
+    // only be READ and WRITE.
+
+    BSLS_ASSERT(0 == (newMask & (newMask - 1))
+             || (EventType::e_READ  == entry.d_readEventType
+              && EventType::e_WRITE == entry.d_writeEventType));
+
+    if (0 == entry.d_mask) {
+        ++d_numSockets;
+    }
+
+    cancelPoll(handle, &entry);
+    scheduleArm(handle, &entry);
+
+    entry.d_mask = newMask;
+    ++d_numEvents;
+
+    return 0;
+}
+
+void EventManagerName::deregisterSocketEvent(
+                                            const SocketHandle::Handle& handle,
+                                            EventType::Type             event)
+{
+    if (0 > handle || d_handles.size() <= static_cast<bsl::size_t>(handle)) {
+        return;                                                       // RETURN
+    }
+
+    HandleEntry& entry     = d_handles[handle];
+    const int    eventMask = translateEventToMask(event);
+
+    if (0 == (entry.d_mask & eventMask)) {
+        return;                                                       // RETURN
+    }
+
+    if (isReadEvent(event)) {
+        if (event != entry.d_readEventType) {
+            return;                                                   // RETURN
+        }
+        entry.d_readCallback = EventManager::Callback();
+    }
+    else {
+        if (event != entry.d_writeEventType) {
+            return;                                                   // RETURN
+        }
+        entry.d_writeCallback = EventManager::Callback();
+    }
+
+    entry.d_mask &= ~eventMask;
+    --d_numEvents;
+
+    const bool wasArmed = 0 != entry.d_armedMask;
+
+    cancelPoll(handle, &entry);
+
+    if (0 != entry.d_mask) {
+        scheduleArm(handle, &entry);
+        return;                                                       // RETURN
+    }
+
+    --d_numSockets;
+
+    if (wasArmed) {
+        // The outstanding poll request holds a reference to the socket, and
+        // the handle is likely to be closed before the next dispatch: submit
+        // the cancellation right away.
+
+        enter(0, 0);
+    }
+}
+
+int EventManagerName::deregisterSocket(const SocketHandle::Handle& handle)
+{
+    if (0 > handle || d_handles.size() <= static_cast<bsl::size_t>(handle)) {
+        return 0;                                                     // RETURN
+    }
+
+    HandleEntry& entry = d_handles[handle];
+    if (0 == entry.d_mask) {
+        return 0;                                                     // RETURN
+    }
+
+    const int numEvents = (entry.d_mask & POLLIN  ? 1 : 0)
+                        + (entry.d_mask & POLLOUT ? 1 : 0);
+
+    if (0 != entry.d_armedMask) {
+        cancelPoll(handle, &entry);
+        enter(0, 0);
+    }
+
+    entry.d_readCallback  = EventManager::Callback();
+    entry.d_writeCallback = EventManager::Callback();
+    entry.d_mask          = 0;
+
+    --d_numSockets;
+    d_numEvents -= numEvents;
+
+    return numEvents;
+}
+
+void EventManagerName::deregisterAll()
+{
+    const int numHandles = static_cast<int>(d_handles.size());
+    for (int handle = 0; handle < numHandles; ++handle) {
+        HandleEntry& entry = d_handles[handle];
+
+        entry.d_isArmPending = false;
+
+        if (0 == entry.d_mask) {
+            continue;
+        }
+
+        cancelPoll(handle, &entry);
+
+        entry.d_readCallback  = EventManager::Callback();
+        entry.d_writeCallback = EventManager::Callback();
+        entry.d_mask          = 0;
+    }
+
+    if (0 != d_ring.d_numUnsubmitted) {
+        enter(0, 0);
+    }
+
+    d_armQueue.clear();
+    d_numSockets = 0;
+    d_numEvents  = 0;
+}
+
+// ACCESSORS
+int EventManagerName::isRegistered(const SocketHandle::Handle& handle,
+                                   const EventType::Type       event) const
+{
+    if (0 > handle || d_handles.size() <= static_cast<bsl::size_t>(handle)) {
+        return 0;                                                     // RETURN
+    }
+
+    const HandleEntry& entry = d_handles[handle];
+    if (0 == (entry.d_mask & translateEventToMask(event))) {
+        return 0;                                                     // RETURN
+    }
+
+    return isReadEvent(event) ? event == entry.d_readEventType
+                              : event == entry.d_writeEventType;
+}
+
+int EventManagerName::numSocketEvents(const SocketHandle::Handle& handle) const
+{
+    if (0 > handle || d_handles.size() <= static_cast<bsl::size_t>(handle)) {
+        return 0;                                                     // RETURN
+    }
+
+    const int mask = d_handles[handle].d_mask;
+    return (mask & POLLIN ? 1 : 0) + (mask & POLLOUT ? 1 : 0);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif // BSLS_PLATFORM_OS_LINUX
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
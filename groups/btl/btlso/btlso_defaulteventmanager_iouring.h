@@ -0,0 +1,509 @@
+// btlso_defaulteventmanager_iouring.h                                -*-C++-*-
+#ifndef INCLUDED_BTLSO_DEFAULTEVENTMANAGER_IOURING
+#define INCLUDED_BTLSO_DEFAULTEVENTMANAGER_IOURING
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide socket multiplexer implementation using Linux 'io_uring'.
+//
+//@CLASSES:
+//  btlso::DefaultEventManager<btlso::Platform::IO_URING>: 'io_uring' mux
+//
+//@SEE_ALSO: btlso_defaulteventmanager_epoll btlso_eventmanager
+//
+//@DESCRIPTION: This component provides an implementation of an event manager,
+// 'btlso::DefaultEventManager<btlso::Platform::IO_URING>', that uses the
+// Linux 'io_uring' interface to monitor for socket events and adheres to the
+// 'btlso::EventManager' protocol.
+//
+// Each registered socket has (at most) one outstanding 'io_uring' poll
+// request for the events registered on it.  A poll request completes once,
+// after which it is re-armed by the next call to 'dispatch' if events are
+// still registered for the socket.  Re-armed requests, and the requests
+// reflecting registration changes made since the previous dispatch, are
+// queued in the submission ring and handed to the kernel by the *same*
+// 'io_uring_enter' system call that waits for completions, so that a dispatch
+// costs a single system call however many sockets were signaled or modified.
+// By contrast, 'btlso::DefaultEventManager<btlso::Platform::EPOLL>' needs one
+// 'epoll_ctl' call per modification in addition to 'epoll_wait'.
+//
+// Registration semantics are identical to those of the other event managers:
+// socket events are level-triggered, and a callback is invoked on each
+// dispatch for as long as its event condition holds.  A socket's outstanding
+// poll request is cancelled as soon as its last event is deregistered, so
+// that the kernel drops its reference to the socket before the caller closes
+// it.
+//
+///Availability
+///------------
+// This event manager requires a Linux kernel providing 'io_uring' with the
+// 'IORING_FEAT_NODROP' and 'IORING_FEAT_EXT_ARG' features (i.e., version
+// 5.11 or later), and a build environment providing '<linux/io_uring.h>'.
+// 'io_uring' may also be disabled by system policy (e.g., by a 'seccomp'
+// filter, or by the 'kernel.io_uring_disabled' 'sysctl').  Callers must
+// therefore test 'isSupported' before creating an instance, and fall back to
+// another event manager (typically,
+// 'btlso::DefaultEventManager<btlso::Platform::EPOLL>') if it returns
+// 'false' (see {Example 1}).  The behavior of creating an instance is
+// undefined unless 'isSupported' returns 'true'.
+//
+///Thread Safety
+///-------------
+// This component depends on a 'bslma::Allocator' instance to supply memory.
+// If the allocator is not thread enabled then the instances of this component
+// that use the same allocator instance will consequently not be thread safe
+// Otherwise, this component provides the following guarantees.
+//
+// Accessing an instance of the event manager provided by this component from
+// different threads may result in undefined behavior.  Accessing distinct
+// instances from different threads is safe.  Distinct instances of the event
+// manager provided by this component are *thread* *enabled* meaning that
+// operations invoked on distinct instances from different threads can proceed
+// concurrently.  The event manager is not *async-safe*, meaning that one or
+// more functions cannot be invoked safely from a signal handler.
+//
+///Performance
+///-----------
+// Given that S is the number of socket events registered, and H is the
+// largest socket handle registered, this component provides the following
+// complexity guarantees:
+//..
+//  +=======================================================================+
+//  |        FUNCTION          | EXPECTED COMPLEXITY | WORST CASE COMPLEXITY|
+//  +-----------------------------------------------------------------------+
+//  | dispatch                 |        O(S)         |        O(S)          |
+//  +-----------------------------------------------------------------------+
+//  | registerSocketEvent      |        O(1)         |        O(H)          |
+//  +-----------------------------------------------------------------------+
+//  | deregisterSocketEvent    |        O(1)         |        O(1)          |
+//  +-----------------------------------------------------------------------+
+//  | deregisterSocket         |        O(1)         |        O(1)          |
+//  +-----------------------------------------------------------------------+
+//  | deregisterAll            |        O(H)         |        O(H)          |
+//  +-----------------------------------------------------------------------+
+//  | numSocketEvents          |        O(1)         |        O(1)          |
+//  +-----------------------------------------------------------------------+
+//  | numEvents                |        O(1)         |        O(1)          |
+//  +-----------------------------------------------------------------------+
+//  | isRegistered             |        O(1)         |        O(1)          |
+//  +=======================================================================+
+//..
+//
+///Metrics
+///-------
+// The event manager provided by this component can use external (i.e.,
+// user-installed) time metrics (see 'btlso_timemetrics' component) to record
+// times spend in IO-bound and CPU-bound operations using the category IDs
+// defined in 'btlso::TimeMetrics'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Falling Back to 'epoll'
+///- - - - - - - - - - - - - - - - -
+// The following snippets of code illustrate how to create an 'io_uring'-based
+// event manager when the running kernel supports it, and an 'epoll'-based one
+// otherwise.  First, we select and create the event manager:
+//..
+//  typedef btlso::DefaultEventManager<btlso::Platform::IO_URING> IoUringObj;
+//  typedef btlso::DefaultEventManager<btlso::Platform::EPOLL>    EpollObj;
+//
+//  bslma::Allocator    *allocator = bslma::Default::defaultAllocator();
+//  btlso::EventManager *manager;
+//
+//  if (IoUringObj::isSupported()) {
+//      manager = new (*allocator) IoUringObj(0, allocator);
+//  }
+//  else {
+//      manager = new (*allocator) EpollObj(0, allocator);
+//  }
+//..
+// Then, we create a (locally-connected) socket pair, and register a read
+// event for one end:
+//..
+//  btlso::SocketHandle::Handle socket[2];
+//
+//  int rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+//                                      socket,
+//                                      btlso::SocketImpUtil::k_SOCKET_STREAM);
+//  assert(0 == rc);
+//
+//  int numCalls = 0;
+//  btlso::EventManager::Callback readCb(
+//                              bdlf::BindUtil::bind(&countingCb, &numCalls));
+//
+//  rc = manager->registerSocketEvent(socket[0],
+//                                    btlso::EventType::e_READ,
+//                                    readCb);
+//  assert(0 == rc);
+//  assert(1 == manager->numEvents());
+//..
+// where 'countingCb' increments the 'int' addressed by its argument.  Next,
+// we write a byte to the other end, and dispatch:
+//..
+//  char data = 'a';
+//  rc = btlso::SocketImpUtil::write(socket[1], &data, 1, 0);
+//  assert(1 == rc);
+//
+//  rc = manager->dispatch(bsls::TimeInterval(1.0), 0);
+//  assert(1 == rc);
+//  assert(1 == numCalls);
+//..
+// Finally, we clean up:
+//..
+//  manager->deregisterAll();
+//  btlso::SocketImpUtil::close(socket[0]);
+//  btlso::SocketImpUtil::close(socket[1]);
+//
+//  allocator->deleteObject(manager);
+//..
+
+#ifndef INCLUDED_BTLSCM_VERSION
+#include <btlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_DEFAULTEVENTMANAGERIMPL
+#include <btlso_defaulteventmanagerimpl.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_EVENTMANAGER
+#include <btlso_eventmanager.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_EVENTTYPE
+#include <btlso_eventtype.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_PLATFORM
+#include <btlso_platform.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_SOCKETHANDLE
+#include <btlso_sockethandle.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_DEQUE
+#include <bsl_deque.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+namespace BloombergLP {
+
+namespace bslma { class Allocator; }
+
+namespace bsls { class TimeInterval; }
+
+namespace btlso {
+
+class TimeMetrics;
+
+         // =============================================
+         // class DefaultEventManager<Platform::IO_URING>
+         // =============================================
+
+template <>
+class DefaultEventManager<Platform::IO_URING> : public EventManager {
+    // This class implements the 'btlso::EventManager' protocol using
+    // 'io_uring' poll requests, keeping registrations in a table indexed by
+    // socket handle.
+
+    // PRIVATE TYPES
+    struct HandleEntry {
+        // This 'struct' holds the registrations for a single socket handle.
+
+        EventManager::Callback d_readCallback;
+        EventManager::Callback d_writeCallback;
+        EventType::Type        d_readEventType;
+        EventType::Type        d_writeEventType;
+        int                    d_mask;          // requested poll events
+        int                    d_armedMask;     // events of the outstanding
+                                                // poll request, or 0 if none
+        unsigned int           d_generation;    // identifies the current poll
+                                                // request in completions
+        bool                   d_isArmPending;  // 'true' if this handle is in
+                                                // 'd_armQueue'
+
+        HandleEntry()
+            // Create an entry having no registered events.
+        : d_readEventType(EventType::e_READ)
+        , d_writeEventType(EventType::e_WRITE)
+        , d_mask(0)
+        , d_armedMask(0)
+        , d_generation(1)
+        , d_isArmPending(false)
+        {
+        }
+    };
+
+    struct Completion {
+        // This 'struct' holds a completion copied out of the completion ring.
+
+        bsls::Types::Uint64 d_userData;  // identifies the request
+        int                 d_result;    // poll events, or negated 'errno'
+    };
+
+    struct Ring {
+        // This 'struct' describes the memory shared with the kernel.
+
+        int           d_fd;             // 'io_uring' file descriptor
+        void         *d_sqRing_p;       // submission ring mapping
+        bsl::size_t   d_sqRingSize;     // size of 'd_sqRing_p' mapping
+        void         *d_cqRing_p;       // completion ring mapping (may equal
+                                        // 'd_sqRing_p')
+        bsl::size_t   d_cqRingSize;     // size of 'd_cqRing_p' mapping
+        void         *d_sqes_p;         // submission queue entries
+        bsl::size_t   d_sqesSize;       // size of 'd_sqes_p' mapping
+        unsigned int *d_sqHead_p;       // consumed by the kernel
+        unsigned int *d_sqTail_p;       // produced by this object
+        unsigned int  d_sqMask;         // submission ring index mask
+        unsigned int  d_sqEntries;      // submission ring capacity
+        unsigned int *d_cqHead_p;       // consumed by this object
+        unsigned int *d_cqTail_p;       // produced by the kernel
+        unsigned int  d_cqMask;         // completion ring index mask
+        void         *d_cqes_p;         // completion queue entries
+        unsigned int  d_numUnsubmitted; // entries not yet submitted
+    };
+
+    // DATA
+    Ring                     d_ring;          // kernel-shared rings
+
+    TimeMetrics             *d_timeMetric_p;  // metrics to use for reporting
+                                              // percent-busy statistics
+
+    bsl::deque<HandleEntry>  d_handles;       // registrations indexed by
+                                              // socket handle; a deque, so
+                                              // growing it from a callback
+                                              // does not move entries
+
+    bsl::vector<int>         d_armQueue;      // handles needing a new poll
+                                              // request
+
+    bsl::vector<Completion>  d_completions;   // completions being dispatched
+
+    int                      d_numSockets;    // number of handles having a
+                                              // registered event
+
+    int                      d_numEvents;     // number of registered events
+
+    // PRIVATE MANIPULATORS
+    void armPending();
+        // Queue a poll request for each handle in 'd_armQueue' that has
+        // registered events but no outstanding poll request.
+
+    void cancelPoll(int handle, HandleEntry *entry);
+        // Queue the cancellation of the outstanding poll request, if any, of
+        // the specified 'handle', whose registrations are in the specified
+        // 'entry', so that any completion of that request is ignored.
+
+    void commitSubmission();
+        // Publish to the kernel the submission queue entry most recently
+        // returned by 'nextSubmission', so that it is submitted by the next
+        // call to 'enter'.  The behavior is undefined unless that entry has
+        // been filled since, and no other entry was requested in between.
+
+    int dispatchImp(int flags, const bsls::TimeInterval *timeout = 0);
+        // For each pending socket event, invoke the corresponding callback
+        // registered with this event manager.
+
+    int enter(int waitFlags, const bsls::TimeInterval *relativeTimeout);
+        // Submit the queued submission queue entries.  If the specified
+        // 'waitFlags' is non-zero, also wait for at least one completion, or
+        // until the optionally specified 'relativeTimeout' elapses.  Return 0
+        // on success and the native error code otherwise.
+
+    void *nextSubmission();
+        // Return the address of the zero-initialized submission queue entry
+        // following the queued ones, submitting the queued entries first if
+        // the submission ring is full.  The entry is not visible to the
+        // kernel until it is published by 'commitSubmission'.
+
+    int reapCompletions();
+        // Append the available completions of current poll requests to
+        // 'd_completions', schedule the re-arming of the completed requests,
+        // and return the number of completions 'd_completions' holds.
+
+    void scheduleArm(int handle, HandleEntry *entry);
+        // Record that a poll request must be queued for the specified
+        // 'handle', whose registrations are in the specified 'entry', before
+        // the next wait.
+
+  private:
+    // NOT IMPLEMENTED
+    DefaultEventManager(const DefaultEventManager&);
+    DefaultEventManager& operator=(const DefaultEventManager&);
+
+  public:
+    // PUBLIC CLASS METHODS
+    static bool isSupported();
+        // Return true if the current kernel supports this event manager.
+
+    // CREATORS
+    explicit
+    DefaultEventManager(TimeMetrics      *timeMetric     = 0,
+                        bslma::Allocator *basicAllocator = 0);
+        // Create a 'io_uring'-based event manager.  Optionally specify a
+        // 'timeMetric' to report time spent in CPU-bound and IO-bound
+        // operations.  If 'timeMetric' is not specified or is 0, these metrics
+        // are not reported.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // 'isSupported()' returns 'true'.
+
+    ~DefaultEventManager();
+        // Destroy this object.  Note that the registered callbacks are NOT
+        // invoked.
+
+    // MANIPULATORS
+    int dispatch(const bsls::TimeInterval& timeout, int flags);
+        // For each pending socket event, invoke the corresponding callback
+        // registered with this event manager.  If no event is pending, wait
+        // until either (1) at least one event occurs (in which case the
+        // corresponding callback(s) is invoked), (2) the specified absolute
+        // 'timeout' is reached, or (3) provided that the specified 'flags'
+        // contains 'btlso::Flag::k_ASYNC_INTERRUPT', an underlying system call
+        // is interrupted by a signal.  Return the number of dispatched
+        // callbacks on success, 0 if 'timeout' is reached, and a negative
+        // value otherwise; -1 is reserved to indicate that an underlying
+        // system call was interrupted.  When such an interruption occurs this
+        // method will return (-1) if 'flags' contains
+        // 'btlso::Flag::k_ASYNC_INTERRUPT', and otherwise will automatically
+        // restart (i.e., reissue the identical system call).  Note that all
+        // callbacks are invoked in the same thread that invokes 'dispatch',
+        // and the order of invocation, relative to the order of registration,
+        // is unspecified.  Also note that -1 is never returned unless 'flags'
+        // contains 'btlso::Flag::k_ASYNC_INTERRUPT'.
+
+    int dispatch(int flags);
+        // For each pending socket event, invoke the corresponding callback
+        // registered with this event manager.  If no event is pending, wait
+        // until either (1) at least one event occurs (in which case the
+        // corresponding callback(s) is invoked) or (2) provided that the
+        // specified 'flags' contains 'btlso::Flag::k_ASYNC_INTERRUPT', an
+        // underlying system call is interrupted by a signal.  Return the
+        // number of dispatched callbacks on success, and a negative value
+        // otherwise; -1 is reserved to indicate that an underlying system call
+        // was interrupted.  When such an interruption occurs this method will
+        // return (-1) if 'flags' contains 'btlso::Flag::k_ASYNC_INTERRUPT' and
+        // otherwise will automatically restart (i.e., reissue the identical
+        // system call).  Note that all callbacks are invoked in the same
+        // thread that invokes 'dispatch', and the order of invocation,
+        // relative to the order of registration, is unspecified.  Also note
+        // that -1 is never returned unless 'flags' contains
+        // 'btlso::Flag::k_ASYNC_INTERRUPT'.
+
+    int registerSocketEvent(const SocketHandle::Handle&   handle,
+                            const EventType::Type         event,
+                            const EventManager::Callback& callback);
+        // Register with this event manager the specified 'callback' to be
+        // invoked when the specified 'event' occurs on the specified socket
+        // 'handle'.  Each socket event registration stays in effect until it
+        // is subsequently deregistered; the callback is invoked each time the
+        // corresponding event is detected.  'EventType::e_READ' and
+        // 'EventType::e_WRITE' are the only events that can be registered
+        // simultaneously for a socket.  If a registration attempt is made for
+        // an event that is already registered, the callback associated with
+        // this event will be overwritten with the new one.  Simultaneous
+        // registration of incompatible events for the same socket 'handle'
+        // will result in undefined behavior.  Return 0 in success and a
+        // non-zero value, which is the same as native error code, on error.
+        // The behavior is undefined unless '0 <= handle'.
+
+    void deregisterSocketEvent(const SocketHandle::Handle& handle,
+                               EventType::Type             event);
+        // Deregister from this event manager the callback associated with the
+        // specified 'event' on the specified 'handle' so that said callback
+        // will not be invoked should 'event' occur.
+
+    int deregisterSocket(const SocketHandle::Handle& handle);
+        // Deregister from this event manager all events associated with the
+        // specified socket 'handle'.  Return the number of deregistered
+        // callbacks.
+
+    void deregisterAll();
+        // Deregister from this event manager all events on every socket
+        // handle.
+
+    // ACCESSORS
+    bool hasLimitedSocketCapacity() const;
+        // Return 'true' if this event manager has a limited socket capacity,
+        // and 'false' otherwise.
+
+    int isRegistered(const SocketHandle::Handle& handle,
+                     const EventType::Type       event) const;
+        // Return 1 if the specified 'event' is registered with this event
+        // manager for the specified socket 'handle' and 0 otherwise.
+
+    int numEvents() const;
+        // Return the total number of all socket events currently registered
+        // with this event manager.
+
+    int numSocketEvents(const SocketHandle::Handle& handle) const;
+        // Return the number of socket events currently registered with this
+        // event manager for the specified 'handle'.
+};
+
+//-----------------------------------------------------------------------------
+//                      INLINE FUNCTION DEFINITIONS
+//-----------------------------------------------------------------------------
+
+         // ---------------------------------------------
+         // class DefaultEventManager<Platform::IO_URING>
+         // ---------------------------------------------
+
+// ACCESSORS
+inline
+bool DefaultEventManager<Platform::IO_URING>::hasLimitedSocketCapacity() const
+{
+    return false;
+}
+
+inline
+int DefaultEventManager<Platform::IO_URING>::numEvents() const
+{
+    return d_numEvents;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif // BSLS_PLATFORM_OS_LINUX
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -12,6 +12,78 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(btlso_defaulteventmanagerimpl_cpp,"$Id$ $CSID$")
 
+#include <btlso_flag.h>
+#include <btlso_timemetrics.h>
+
+#include <bdlt_currenttime.h>
+
+#include <bsls_assert.h>
+
+#if !defined(BSLS_PLATFORM_OS_WINDOWS)
+#include <bsl_c_errno.h>
+#include <time.h>
+#endif
+
+namespace BloombergLP {
+namespace btlso {
+
+                     // ----------------------------------
+                     // struct DefaultEventManagerImplUtil
+                     // ----------------------------------
+
+#if !defined(BSLS_PLATFORM_OS_WINDOWS)
+// CLASS METHODS
+int DefaultEventManagerImplUtil::sleep(int                       *resultErrno,
+                                       const bsls::TimeInterval&  timeout,
+                                       int                        flags,
+                                       TimeMetrics               *metrics)
+{
+    BSLS_ASSERT(resultErrno);
+
+    bsls::TimeInterval now(bdlt::CurrentTime::now());
+
+    while (timeout > now) {
+        bsls::TimeInterval currTimeout(timeout - now);
+        struct timespec    ts;
+
+        ts.tv_sec  = static_cast<time_t>(currTimeout.seconds());
+        ts.tv_nsec = static_cast<long>(currTimeout.nanoseconds());
+
+        // Sleep till it's time.
+
+        int savedErrno;
+        int rc;
+        if (metrics) {
+            metrics->switchTo(TimeMetrics::e_IO_BOUND);
+            rc = nanosleep(&ts, 0);
+            savedErrno = errno;
+            metrics->switchTo(TimeMetrics::e_CPU_BOUND);
+        }
+        else {
+            rc = nanosleep(&ts, 0);
+            savedErrno = errno;
+        }
+
+        errno = 0;
+        *resultErrno = savedErrno;
+        if (0 > rc) {
+            BSLS_ASSERT(savedErrno == EINTR);
+
+            if (flags & Flag::k_ASYNC_INTERRUPT) {
+                // We're allowing async interrupts.
+
+                return -1;                                            // RETURN
+            }
+        }
+        now = bdlt::CurrentTime::now();
+    }
+    return 0;
+}
+#endif
+
+}  // close package namespace
+}  // close enterprise namespace
+
 // ----------------------------------------------------------------------------
 // Copyright 2015 Bloomberg Finance L.P.
 //
@@ -19,21 +19,23 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  btlso::DefaultEventManager<POLLING_MECHANISM>: default multiplexer
+//  btlso::DefaultEventManagerImplUtil: utilities shared by implementations
 //
 //@SEE_ALSO: btlso_defaulteventmanager
 //
 //@DESCRIPTION: This component provides a forward declaration for
-// 'btlso::DefaultEventManager' class along with certain type constants shared
-// by various implementations.  This component is used to implement
+// 'btlso::DefaultEventManager' class along with certain type constants and
+// utility functions ('btlso::DefaultEventManagerImplUtil') shared by various
+// implementations.  This component is used to implement
 // btlso_defaulteventmanager component as shown on the following diagram:
 //..
-//     |                btlso_defaulteventmanager            |
-//     |               /   /     |      \        \           |
-//     |        /-----/   /      |       \        \          |
-//     |    _select    _poll  _devpoll  _pollset   _epoll    |
-//     |        \-----    \      |       /        /          |
-//     |              \    \     |      /        /           |
-//     |              btlso_defaulteventmanagerimpl          |
+//     |                btlso_defaulteventmanager                            |
+//     |            /   /     |      \        \        \           \         |
+//     |     /-----/   /      |       \        \        \           \        |
+//     | _select    _poll  _devpoll  _pollset   _epoll  _flatepoll  _iouring |
+//     |     \-----    \      |       /        /        /           /        |
+//     |            \   \     |      /        /        /           /         |
+//     |              btlso_defaulteventmanagerimpl                          |
 //..
 //
 ///Usage
@@ -79,6 +81,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_platform.h>
 #endif
 
+#ifndef INCLUDED_BSLS_TIMEINTERVAL
+#include <bsls_timeinterval.h>
+#endif
+
 #if !defined(BSLS_PLATFORM_OS_WINDOWS)
     #ifndef INCLUDED_SYS_POLL
     #include <sys/poll.h>
@@ -97,6 +103,33 @@ namespace btlso {
 template <class POLLING_MECHANISM = Platform::DEFAULT_POLLING_MECHANISM>
 class DefaultEventManager;
 
+class TimeMetrics;
+
+                     // ==================================
+                     // struct DefaultEventManagerImplUtil
+                     // ==================================
+
+struct DefaultEventManagerImplUtil {
+    // This 'struct' provides a namespace for utility functions shared by the
+    // implementations of 'DefaultEventManager'.
+
+#if !defined(BSLS_PLATFORM_OS_WINDOWS)
+    // CLASS METHODS
+    static int sleep(int                       *resultErrno,
+                     const bsls::TimeInterval&  timeout,
+                     int                        flags,
+                     TimeMetrics               *metrics);
+        // Suspend the calling thread until the specified absolute 'timeout',
+        // or, if the specified 'flags' contains 'Flag::k_ASYNC_INTERRUPT',
+        // until a signal is caught.  Load into the specified 'resultErrno'
+        // the 'errno' value of the last call to 'nanosleep'.  Report the time
+        // spent sleeping as IO-bound to the specified 'metrics', if not 0.
+        // Return 0 if the timeout was reached, and -1 if the sleep was
+        // interrupted.  This function is used by 'dispatch' when there are
+        // no sockets to monitor.
+#endif
+};
+
 }  // close package namespace
 
 }  // close enterprise namespace
@@ -14,6 +14,9 @@
 #include <btlso_platform.h>
 #include <btlso_timemetrics.h>
 
+#include <bdlt_currenttime.h>
+#include <bsls_timeinterval.h>
+
 #include <bslma_testallocator.h>                // for testing only
 #include <bslmf_issame.h>                       // for testing only
 
@@ -33,9 +36,13 @@ using namespace BloombergLP;
 // class that specifies the default event manager on a certain platform.
 // However, this component itself does not provide any functionality by itself.
 // So we just verify that the typedefs are properly hooked up and an instance
-// of default event manager can be created.
+// of default event manager can be created, and test the utility functions
+// shared by the implementations.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int DefaultEventManagerImplUtil::sleep(int *, TimeInterval, int, TM *);
 //-----------------------------------------------------------------------------
-// [ 2] USAGE EXAMPLE
+// [ 3] USAGE EXAMPLE
 // [ 1] BREATHING TEST
 
 //=============================================================================
@@ -182,7 +189,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 2: {
+      case 3: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -226,6 +233,65 @@ int main(int argc, char *argv[])
 //..
 // Note that the time metrics is optional.
 //..
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'DefaultEventManagerImplUtil::sleep'
+        //
+        // Concerns:
+        //: 1 'sleep' returns 0 immediately if the timeout is not in the
+        //:   future.
+        //:
+        //: 2 'sleep' returns 0 no earlier than the timeout otherwise.
+        //:
+        //: 3 If metrics are supplied, the time spent sleeping is reported as
+        //:   IO-bound, and the metrics are left in the CPU-bound category.
+        //
+        // Plan:
+        //: 1 Call 'sleep' with a timeout in the past, and with a timeout 50
+        //:   milliseconds in the future, with and without metrics, and
+        //:   verify the return value, the elapsed time, and the current
+        //:   category of the metrics.  (C-1..3)
+        //
+        // Testing:
+        //   int DefaultEventManagerImplUtil::sleep(int *, TimeInterval, int,
+        //                                          TM *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'DefaultEventManagerImplUtil::sleep'"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+#if !defined(BSLS_PLATFORM_OS_WINDOWS)
+        typedef btlso::DefaultEventManagerImplUtil Util;
+
+        btlso::TimeMetrics metrics(btlso::TimeMetrics::e_MIN_NUM_CATEGORIES,
+                                   btlso::TimeMetrics::e_CPU_BOUND);
+
+        for (int withMetrics = 0; withMetrics < 2; ++withMetrics) {
+            btlso::TimeMetrics *metrics_p = withMetrics ? &metrics : 0;
+
+            int resultErrno = -1;
+
+            const bsls::TimeInterval past = bdlt::CurrentTime::now() -
+                                                   bsls::TimeInterval(1, 0);
+            ASSERT(0  == Util::sleep(&resultErrno, past, 0, metrics_p));
+            ASSERT(-1 == resultErrno);
+
+            const bsls::TimeInterval start   = bdlt::CurrentTime::now();
+            const bsls::TimeInterval timeout = start +
+                                           bsls::TimeInterval(0, 50000000);
+
+            ASSERT(0 == Util::sleep(&resultErrno, timeout, 0, metrics_p));
+            ASSERT(0 == resultErrno);
+            ASSERT(timeout <= bdlt::CurrentTime::now());
+        }
+
+        ASSERT(btlso::TimeMetrics::e_CPU_BOUND == metrics.currentCategory());
+        ASSERT(0 < metrics.percentage(btlso::TimeMetrics::e_IO_BOUND));
+#endif
       } break;
       case 1: {
         // -----------------------------------------------------------------
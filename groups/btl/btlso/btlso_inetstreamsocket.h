@@ -18,9 +18,11 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component implements TCP-based stream sockets of type
 // 'btlso::InetStreamSocket<ADDRESS>' conforming to the
 // 'btlso::StreamSocket<ADDRESS>' protocol.  The classes are templatized to
-// provide type-safe address class specialization.  The only address type
-// currently supported is IPv4 (as provided by 'btlso_ipv4address' component).
-// Therefore, the template parameter will always be 'btlso::IPv4Address'.
+// provide type-safe address class specialization.  The address types
+// currently supported are IPv4 and IPv6 (as provided by the
+// 'btlso_ipv4address' and 'btlso_ipv6address' components).  Therefore, the
+// template parameter will be either 'btlso::IPv4Address' or
+// 'btlso::IPv6Address'.
 //
 ///Thread Safety
 ///-------------
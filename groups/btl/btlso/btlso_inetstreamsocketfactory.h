@@ -25,19 +25,20 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component implements a factory to allocate and deallocate
 // them.  The stream sockets are of type 'btlso::InetStreamSocket<ADDRESS>'
 // conforming to the 'btlso::StreamSocket<ADDRESS>' protocol.  The classes are
-// templatized to provide type-safe address class specialization.  The only
-// address type currently supported is IPv4 (as provided by 'btlso_ipv4address'
-// component).  Therefore, the template parameter will always be
-// 'btlso::IPv4Address'.  The factory,
-// 'btlso::InetStreamSocketFactory<ADDRESS>', creates and destroys instances of
-// the 'btlso::InetStreamSocket<ADDRESS>'.  Two interfaces are available for
-// creation of stream sockets.  One does not take a socket handle creates a new
-// socket in the default initial state when a new stream socket is allocated.
-// The second takes the handle to an existing TCP-based stream socket and loads
-// it into newly-allocated stream socket object.  In this case, no assumption
-// is made about the state of the existing socket.  Every instance of
-// 'btlso::InetStreamSocket<ADDRESS>' must be destroyed using the deallocate
-// operation of 'btlso::InetStreamSocketFactory<ADDRESS>'.
+// templatized to provide type-safe address class specialization.  The address
+// types currently supported are IPv4 and IPv6 (as provided by the
+// 'btlso_ipv4address' and 'btlso_ipv6address' components).  Therefore, the
+// template parameter will be either 'btlso::IPv4Address' or
+// 'btlso::IPv6Address' (see {'btlso_ipv6address'|Dual-Stack Addresses}).  The
+// factory, 'btlso::InetStreamSocketFactory<ADDRESS>', creates and destroys
+// instances of the 'btlso::InetStreamSocket<ADDRESS>'.  Two interfaces are
+// available for creation of stream sockets.  One does not take a socket handle
+// creates a new socket in the default initial state when a new stream socket
+// is allocated.  The second takes the handle to an existing TCP-based stream
+// socket and loads it into newly-allocated stream socket object.  In this
+// case, no assumption is made about the state of the existing socket.  Every
+// instance of 'btlso::InetStreamSocket<ADDRESS>' must be destroyed using the
+// deallocate operation of 'btlso::InetStreamSocketFactory<ADDRESS>'.
 //
 // The creation of the socket factory provided by this component will enable
 // socket operations (by calling 'btlso::SocketImpUtil::startup') method; the
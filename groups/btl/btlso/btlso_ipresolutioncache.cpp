@@ -12,7 +12,12 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID("btlso_ipresolutioncache.cpp","$Id$ $CSID$")
 
+#include <bdlmt_threadpool.h>
+
+#include <bdlf_bind.h>
+
 #include <bslmt_lockguard.h>
+#include <bslmt_threadattributes.h>
 
 #include <bsls_assert.h>
 
@@ -24,6 +29,19 @@ BSLS_IDENT_RCSID("btlso_ipresolutioncache.cpp","$Id$ $CSID$")
 
 namespace BloombergLP {
 
+namespace {
+
+enum {
+    k_MAX_NUM_RESOLVER_THREADS = 4,      // maximum number of threads
+                                         // resolving hostnames in the
+                                         // background
+
+    k_RESOLVER_MAX_IDLE_TIME   = 60000   // time (in milliseconds) after which
+                                         // an idle resolver thread exits
+};
+
+}  // close unnamed namespace
+
 static
 int createCacheData(
            btlso::IpResolutionCache_Entry::DataPtr         *result,
@@ -134,9 +152,13 @@ const bdlt::Datetime& IpResolutionCache_Data::creationTime() const
 IpResolutionCache::IpResolutionCache(bslma::Allocator *basicAllocator)
 : d_cache(basicAllocator)
 , d_timeToLive(0, 1)
+, d_refreshAheadInterval()
 , d_rwLock()
 , d_resolverCallback(ResolveUtil::defaultResolveByNameCallback())
+, d_requests(basicAllocator)
+, d_requestsLock()
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_resolverPool_mp()
 {
 }
 
@@ -144,13 +166,139 @@ IpResolutionCache::IpResolutionCache(ResolveByNameCallback  resolverCallback,
                                      bslma::Allocator      *basicAllocator)
 : d_cache(basicAllocator)
 , d_timeToLive(0, 1)
+, d_refreshAheadInterval()
 , d_rwLock()
 , d_resolverCallback(resolverCallback)
+, d_requests(basicAllocator)
+, d_requestsLock()
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_resolverPool_mp()
 {
     BSLS_ASSERT(resolverCallback);
 }
 
+IpResolutionCache::~IpResolutionCache()
+{
+    // Complete the resolutions in progress, as well as those still queued,
+    // while the other members are still valid.  Note that the destructor of
+    // the thread pool would discard the queued resolutions, along with the
+    // requests waiting for them.
+
+    if (d_resolverPool_mp) {
+        d_resolverPool_mp->stop();
+    }
+
+    BSLS_ASSERT(d_requests.empty());
+
+    d_resolverPool_mp.reset();
+}
+
+// PRIVATE MANIPULATORS
+void IpResolutionCache::resolveInBackground(const bsl::string& hostname)
+{
+    IpResolutionCache_Entry::DataPtr dataPtr;
+    int                              errorCode = 0;
+
+    int rc = createCacheData(&dataPtr,
+                             hostname.c_str(),
+                             &errorCode,
+                             bdlt::CurrentTime::utc(),
+                             d_resolverCallback,
+                             d_allocator_p);
+
+    if (0 == rc) {
+        bslmt::WriteLockGuard<bslmt::RWMutex> writeLockGuard(&d_rwLock);
+
+        d_cache[hostname].setData(dataPtr);
+    }
+
+    // Requests for 'hostname' made from now on find the refreshed entry (or
+    // start another resolution if this one failed).
+
+    bsl::vector<Request> requests(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_requestsLock);
+
+        RequestMap::iterator it = d_requests.find(hostname);
+        BSLS_ASSERT(d_requests.end() != it);
+
+        requests.swap(it->second);
+        d_requests.erase(it);
+    }
+
+    bsl::vector<IPv4Address> addresses(d_allocator_p);
+    for (bsl::size_t i = 0; i < requests.size(); ++i) {
+        if (0 != rc) {
+            requests[i].first(rc, addresses, errorCode);
+            continue;
+        }
+
+        const int size = bsl::min(
+                               requests[i].second,
+                               static_cast<int>(dataPtr->addresses().size()));
+
+        addresses.assign(dataPtr->addresses().begin(),
+                         dataPtr->addresses().begin() + size);
+        requests[i].first(0, addresses, 0);
+    }
+}
+
+int IpResolutionCache::scheduleResolution(const char    *hostname,
+                                          const Request *request)
+{
+    BSLS_ASSERT(hostname);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_requestsLock);
+
+    RequestMap::iterator it = d_requests.find(hostname);
+    if (d_requests.end() != it) {
+        // 'hostname' is already being resolved.
+
+        if (request) {
+            it->second.push_back(*request);
+        }
+        return 0;                                                     // RETURN
+    }
+
+    if (!d_resolverPool_mp) {
+        d_resolverPool_mp.load(
+                   new (*d_allocator_p) bdlmt::ThreadPool(
+                                                 bslmt::ThreadAttributes(),
+                                                 0,
+                                                 k_MAX_NUM_RESOLVER_THREADS,
+                                                 k_RESOLVER_MAX_IDLE_TIME,
+                                                 d_allocator_p),
+                   d_allocator_p);
+
+        if (0 != d_resolverPool_mp->start()) {
+            d_resolverPool_mp.reset();
+            return -1;                                                // RETURN
+        }
+    }
+
+    it = d_requests.insert(bsl::make_pair(bsl::string(hostname,
+                                                      d_allocator_p),
+                                          bsl::vector<Request>(
+                                                      d_allocator_p))).first;
+    if (request) {
+        it->second.push_back(*request);
+    }
+
+    bdlmt::ThreadPool::Job job(bsl::allocator_arg_t(),
+                               d_allocator_p,
+                               bdlf::BindUtil::bindS(
+                                       d_allocator_p,
+                                       &IpResolutionCache::resolveInBackground,
+                                       this,
+                                       it->first));
+
+    if (0 != d_resolverPool_mp->enqueueJob(job)) {
+        d_requests.erase(it);
+        return -1;                                                    // RETURN
+    }
+    return 0;
+}
+
 // MANIPULATORS
 int IpResolutionCache::getCacheData(
                                    IpResolutionCache_Entry::DataPtr *result,
@@ -198,7 +346,12 @@ int IpResolutionCache::getCacheData(
              || now < dataPtr->creationTime() + d_timeToLive
              || 0 != entry->updatingLock().tryLock()) {
                 // Data is not expired or another thread is already refreshing
-                // the data.  Return existing data.
+                // the data.  Return existing data, and refresh it in the
+                // background if it is about to expire.
+
+                if (isDueForRefresh(dataPtr, now)) {
+                    scheduleResolution(hostname, 0);
+                }
 
                 *result = dataPtr;
                 return 0;                                             // RETURN
@@ -287,6 +440,58 @@ int IpResolutionCache::resolveAddress(
     return 0;
 }
 
+int IpResolutionCache::resolveAddressAsync(
+                                const char                    *hostname,
+                                int                            maxNumAddresses,
+                                const ResolveAddressCallback&  callback)
+{
+    BSLS_ASSERT(hostname);
+    BSLS_ASSERT(1 <= maxNumAddresses);
+    BSLS_ASSERT(callback);
+
+    const bdlt::Datetime now = bdlt::CurrentTime::utc();
+
+    IpResolutionCache_Entry::DataPtr dataPtr;
+    bool                             refreshFlag = false;
+    {
+        bslmt::ReadLockGuard<bslmt::RWMutex> readLockGuard(&d_rwLock);
+
+        AddressMap::const_iterator it = d_cache.find(hostname);
+        if (d_cache.end() != it) {
+            dataPtr = it->second.data();
+        }
+
+        if (dataPtr.get()
+         && 0 != d_timeToLive.totalSeconds()
+         && now >= dataPtr->creationTime() + d_timeToLive) {
+            // Stale data is resolved again, as if it was never cached.
+
+            dataPtr.reset();
+        }
+
+        refreshFlag = dataPtr.get() && isDueForRefresh(dataPtr, now);
+    }
+
+    if (0 == dataPtr.get()) {
+        const Request request(callback, maxNumAddresses);
+
+        return scheduleResolution(hostname, &request);                // RETURN
+    }
+
+    if (refreshFlag) {
+        scheduleResolution(hostname, 0);
+    }
+
+    const int size = bsl::min(maxNumAddresses,
+                              static_cast<int>(dataPtr->addresses().size()));
+
+    bsl::vector<IPv4Address> addresses(dataPtr->addresses().begin(),
+                                       dataPtr->addresses().begin() + size,
+                                       d_allocator_p);
+    callback(0, addresses, 0);
+    return 0;
+}
+
 void IpResolutionCache::removeAll()
 {
     bslmt::WriteLockGuard<bslmt::RWMutex> writeLockGuard(&d_rwLock);
@@ -298,6 +503,23 @@ void IpResolutionCache::removeAll()
     }
 }
 
+// PRIVATE ACCESSORS
+bool IpResolutionCache::isDueForRefresh(
+                            const IpResolutionCache_Entry::DataPtr& data,
+                            const bdlt::Datetime&                   now) const
+{
+    BSLS_ASSERT(data.get());
+
+    if (0 == d_timeToLive.totalSeconds()
+     || bdlt::DatetimeInterval() == d_refreshAheadInterval) {
+        return false;                                                 // RETURN
+    }
+
+    const bdlt::Datetime expiration = data->creationTime() + d_timeToLive;
+
+    return now < expiration && expiration - d_refreshAheadInterval <= now;
+}
+
 // ACCESSORS
 int IpResolutionCache::lookupAddressRaw(
                                bsl::vector<IPv4Address> *result,
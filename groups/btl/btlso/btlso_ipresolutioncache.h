@@ -39,6 +39,32 @@ BSLS_IDENT("$Id: $")
 // hostname will refresh that set of IP addresses by again invoking the
 // 'ResolveByNameCallback' object supplied at construction.
 //
+///Asynchronous Resolution
+///-----------------------
+// 'resolveAddress' blocks the calling thread while the
+// 'ResolveByNameCallback' is invoked, which may take an arbitrary long time
+// for a 'getaddrinfo'-based resolver.  'resolveAddressAsync' instead returns
+// immediately, and supplies the addresses to a callback: either from the
+// calling thread if they are already cached (and not stale), or from one of a
+// small pool of resolver threads otherwise.  Concurrent asynchronous requests
+// for the same hostname are collapsed into a single invocation of the
+// 'ResolveByNameCallback', whose result is supplied to all of them.  The
+// resolver threads are created the first time they are needed, and exit once
+// idle for a minute.
+//
+///Refresh-Ahead
+///-------------
+// By default, the addresses of a hostname are refreshed when they are
+// requested after having become stale, so that the request waits for the
+// refresh.  Setting a non-zero refresh-ahead interval (see
+// 'setRefreshAheadInterval') instead refreshes the addresses in the
+// background, on a resolver thread, when they are requested during the last
+// 'refreshAheadInterval()' of their time-to-live.  Such a request is supplied
+// the current addresses without waiting, so that the addresses of a hostname
+// that is requested regularly (e.g., by a 'btlmt::ChannelPool' resolving its
+// server address on each connection attempt through 'btlso::ResolveUtil', see
+// Example 2) are never refreshed in the requesting thread.
+//
 ///Thread Safety
 ///-------------
 // 'btlso::IpResolutionCache' is fully *thread-safe*, meaning that all
@@ -193,6 +219,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_writelockguard.h>
 #endif
 
+#ifndef INCLUDED_BDLT_DATETIME
+#include <bdlt_datetime.h>
+#endif
+
 #ifndef INCLUDED_BDLT_DATETIMEINTERVAL
 #include <bdlt_datetimeinterval.h>
 #endif
@@ -209,6 +239,14 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_nestedtraitdeclaration.h>
 #endif
 
+#ifndef INCLUDED_BSLMA_MANAGEDPTR
+#include <bslma_managedptr.h>
+#endif
+
+#ifndef INCLUDED_BSL_FUNCTIONAL
+#include <bsl_functional.h>
+#endif
+
 #ifndef INCLUDED_BSL_MAP
 #include <bsl_map.h>
 #endif
@@ -217,12 +255,22 @@ BSLS_IDENT("$Id: $")
 #include <bsl_memory.h>
 #endif
 
+#ifndef INCLUDED_BSL_STRING
+#include <bsl_string.h>
+#endif
+
+#ifndef INCLUDED_BSL_UTILITY
+#include <bsl_utility.h>
+#endif
+
 #ifndef INCLUDED_BSL_VECTOR
 #include <bsl_vector.h>
 #endif
 
 namespace BloombergLP {
 
+namespace bdlmt { class ThreadPool; }
+
 namespace btlso {
 
 class IpResolutionCache;
@@ -328,15 +376,37 @@ class IpResolutionCache {
     typedef ResolveUtil::ResolveByNameCallback ResolveByNameCallback;
         // Alias to the function type of the resolver of 'ResolveUtil'.
 
+    typedef bsl::function<void(int                             status,
+                               const bsl::vector<IPv4Address>& addresses,
+                               int                             errorCode)>
+                                                       ResolveAddressCallback;
+        // Alias for the callback supplied with the 'status' of an asynchronous
+        // resolution (0 on success, and a non-zero value otherwise), the
+        // resolved 'addresses' on success, and the 'errorCode' of the resolver
+        // callback on failure.
+
   private:
-    // DATA
+    // PRIVATE TYPES
     typedef bsl::map<bsl::string, IpResolutionCache_Entry> AddressMap;
 
+    typedef bsl::pair<ResolveAddressCallback, int>         Request;
+        // callback of an asynchronous request, and maximum number of
+        // addresses it is to be supplied
+
+    typedef bsl::map<bsl::string, bsl::vector<Request> >   RequestMap;
+
+    // DATA
     AddressMap              d_cache;            // map to store the data
 
     bdlt::DatetimeInterval  d_timeToLive;       // configured interval for old
                                                 // to become stale
 
+    bdlt::DatetimeInterval  d_refreshAheadInterval;
+                                                // interval before becoming
+                                                // stale during which the data
+                                                // is refreshed in the
+                                                // background
+
     mutable bslmt::RWMutex  d_rwLock;           // access synchronization for
                                                 // reading/writing to 'd_cache'
                                                 // *and* the shared 'data' in
@@ -344,9 +414,38 @@ class IpResolutionCache {
 
     ResolveByNameCallback   d_resolverCallback; // callback to get data
 
+    RequestMap              d_requests;         // asynchronous requests
+                                                // waiting for the resolution
+                                                // of each hostname being
+                                                // resolved in the background
+
+    bslmt::Mutex            d_requestsLock;     // access synchronization for
+                                                // 'd_requests' and
+                                                // 'd_resolverPool_mp'
+
     bslma::Allocator       *d_allocator_p;      // allocator (held, not owned)
 
+    bslma::ManagedPtr<bdlmt::ThreadPool>
+                            d_resolverPool_mp;  // resolver threads, created on
+                                                // first use (declared last, so
+                                                // that its jobs are completed
+                                                // before other members are
+                                                // destroyed)
+
   private:
+    // PRIVATE MANIPULATORS
+    void resolveInBackground(const bsl::string& hostname);
+        // Invoke the resolver callback supplied at construction to refresh
+        // the entry for the specified 'hostname', and supply the result to
+        // the asynchronous requests waiting for it.  Note that this method is
+        // executed by a resolver thread.
+
+    int scheduleResolution(const char *hostname, const Request *request);
+        // Ensure that the addresses of the specified 'hostname' are being
+        // resolved in the background and, if the specified 'request' is not
+        // 0, that '*request' is supplied the result.  Return 0 on success, and
+        // a non-zero value if the resolution could not be scheduled.
+
     int getCacheData(IpResolutionCache_Entry::DataPtr *result,
                      const char                       *hostname,
                      int                              *errorCode);
@@ -358,7 +457,17 @@ class IpResolutionCache {
         // is loaded into 'result', otherwise the callback supplied at
         // construction is invoked to populate a new entry in the cache, and
         // that entry is then loaded into 'result'.  Return 0 on success, and a
-        // non-zero value otherwise.
+        // non-zero value otherwise.  If the entry loaded into 'result' is due
+        // to be refreshed ahead of becoming stale, schedule its refresh in
+        // the background.
+
+    // PRIVATE ACCESSORS
+    bool isDueForRefresh(const IpResolutionCache_Entry::DataPtr& data,
+                         const bdlt::Datetime&                   now) const;
+        // Return 'true' if the specified 'data' is not stale at the specified
+        // 'now', but is within the refresh-ahead interval of becoming stale,
+        // and 'false' otherwise.  The behavior is undefined unless the calling
+        // thread has a lock on 'd_rwLock'.
 
   private:
     // NOT IMPLEMENTED
@@ -381,6 +490,11 @@ class IpResolutionCache {
         // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
         // the currently installed default allocator is used.
 
+    ~IpResolutionCache();
+        // Destroy this object.  Block until the asynchronous resolutions in
+        // progress or scheduled, if any, complete, and their results are
+        // supplied to the requests waiting for them.
+
     // MANIPULATORS
     void removeAll();
         // Remove all cached data.
@@ -402,6 +516,31 @@ class IpResolutionCache {
         // 'errorCode', and a non-zero value with no effect on 'result'
         // otherwise.  The behavior is undefined unless '1 <= maxNumAddresses'.
 
+    int resolveAddressAsync(const char                    *hostname,
+                            int                            maxNumAddresses,
+                            const ResolveAddressCallback&  callback);
+        // Supply to the specified 'callback' the resolved IPv4 addresses of
+        // the host with the specified 'hostname', up to the specified
+        // 'maxNumAddresses'.  If the cache already contains an entry for
+        // 'hostname' younger than the configured time-to-live, 'callback' is
+        // invoked with that entry from the calling thread before this method
+        // returns; otherwise, the resolver callback supplied at construction
+        // is invoked from a resolver thread to populate a new entry in the
+        // cache, and 'callback' is then invoked from that thread.  Requests
+        // for a 'hostname' already being resolved in the background wait for
+        // that resolution instead of starting another one.  Return 0 on
+        // success, and a non-zero value, without invoking 'callback', if a
+        // resolver thread could not be started.  The behavior is undefined
+        // unless '1 <= maxNumAddresses'.
+
+    void setRefreshAheadInterval(const bdlt::DatetimeInterval& value);
+        // Set the interval, before the cached IP addresses for a particular
+        // hostname become stale, during which a request for these addresses
+        // refreshes them in the background, to the specified 'value'.  A
+        // 'value' of 0 seconds (the default) disables refreshing addresses
+        // ahead of time.  The behavior is undefined unless
+        // '0 <= value.totalSeconds()'.
+
     void setTimeToLive(const bdlt::DatetimeInterval& value);
         // Set the time the cached IP addresses for a particular hostname may
         // exist before they are considered stale.  A 'value' of 0 seconds
@@ -413,6 +552,12 @@ class IpResolutionCache {
     bslma::Allocator *allocator() const;
         // Return the allocator used by this object to supply memory.
 
+    bdlt::DatetimeInterval refreshAheadInterval() const;
+        // Return the interval, before the cached IP addresses for a particular
+        // hostname become stale, during which a request for these addresses
+        // refreshes them in the background.  Note that
+        // '0 <= refreshAheadInterval().totalSeconds()'.
+
     int lookupAddressRaw(bsl::vector<IPv4Address> *result,
                          const char               *hostname,
                          int                       maxNumAddresses) const;
@@ -491,6 +636,15 @@ IpResolutionCache_Entry::DataPtr IpResolutionCache_Entry::data() const
                         // -----------------------
 
 // MANIPULATORS
+inline
+void IpResolutionCache::setRefreshAheadInterval(
+                                           const bdlt::DatetimeInterval& value)
+{
+    BSLS_ASSERT_SAFE(0 <= value.totalSeconds());
+
+    bslmt::WriteLockGuard<bslmt::RWMutex> writeLockGuard(&d_rwLock);
+    d_refreshAheadInterval = value;
+}
 
 inline
 void IpResolutionCache::setTimeToLive(const bdlt::DatetimeInterval& value)
@@ -508,6 +662,13 @@ bslma::Allocator *IpResolutionCache::allocator() const
     return d_allocator_p;
 }
 
+inline
+bdlt::DatetimeInterval IpResolutionCache::refreshAheadInterval() const
+{
+    bslmt::ReadLockGuard<bslmt::RWMutex> readLockGuard(&d_rwLock);
+    return d_refreshAheadInterval;
+}
+
 inline
 IpResolutionCache::ResolveByNameCallback
 IpResolutionCache::resolverCallback() const
@@ -13,6 +13,7 @@
 #include <bsls_stopwatch.h>
 
 #include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
 
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>
@@ -64,10 +65,13 @@ using namespace bsl;
 // MANIPULATORS
 // [10] void removeAll();
 // [ 8] int resolveAddress(vector *r, const char *h, int n, int *e);
+// [11] int resolveAddressAsync(const char *h, int n, const Callback& cb);
+// [11] void setRefreshAheadInterval(const bdlt::DatetimeInterval& value);
 // [ 6] void setTimeToLive(const bdlt::DatetimeInterval& value);
 //
 // ACCESSORS
 // [ 7] bslma::Allocator *allocator() const;
+// [11] bdlt::DatetimeInterval refreshAheadInterval() const;
 // [ 8] int lookupAddressRaw(vector *res, const char *host, int num);
 // [ 7] ResolveByNameCallback resolverCallback();
 // [ 7] const bdlt::DatetimeInterval& timeToLive();
@@ -88,7 +92,7 @@ using namespace bsl;
 // [ 5] bslmt::Mutex& updatingLock();
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [11] USAGE EXAMPLE
+// [12] USAGE EXAMPLE
 // [ 2] CONCERN: Test apparatus is working as expected.
 // [ 9] CONCERN: btlso::IpResolutionCache works with multiple threads
 // ============================================================================
@@ -624,6 +628,120 @@ extern "C" void *workerThread(void *arg)
 
 }  // close namespace BTESO_IPRESOLUTIONCACHE_CONCURRENCY
 
+namespace BTLSO_IPRESOLUTIONCACHE_ASYNC {
+
+bsls::AtomicInt numResolutions(0);
+
+int slowCallback(bsl::vector<btlso::IPv4Address> *hostAddresses,
+                 const char                      *hostName,
+                 int                              maxNumAddresses,
+                 int                             *errorCode)
+    // Wait for 100 milliseconds, then load, into the specified
+    // 'hostAddresses', up to the specified 'maxNumAddresses' addresses (three
+    // at most) of the host having the specified 'hostName', whose value is
+    // the number of times this function has been invoked.  Return 0 on
+    // success, and, if 'hostName' is "FAIL", load 42 into the specified
+    // 'errorCode' and return a non-zero value.
+{
+    BSLS_ASSERT(hostAddresses);
+    BSLS_ASSERT(hostName);
+    BSLS_ASSERT(1 <= maxNumAddresses);
+
+    bslmt::ThreadUtil::microSleep(100 * 1000);
+
+    const int count = ++numResolutions;
+
+    if (0 == strcmp("FAIL", hostName)) {
+        if (errorCode) {
+            *errorCode = 42;
+        }
+        return -1;                                                    // RETURN
+    }
+
+    hostAddresses->clear();
+    for (int i = 0; i < bsl::min(3, maxNumAddresses); ++i) {
+        hostAddresses->push_back(
+                           btlso::IPv4Address(BSLS_BYTEORDER_HTONL(count), i));
+    }
+    return 0;
+}
+
+class Recorder {
+    // This class records the results supplied to the callbacks of
+    // asynchronous resolutions.
+
+    // DATA
+    mutable bslmt::Mutex d_lock;
+    int                  d_numCalls;
+    int                  d_numFailures;
+    int                  d_lastErrorCode;
+    Vec                  d_lastAddresses;
+
+  public:
+    // CREATORS
+    Recorder()
+    : d_numCalls(0)
+    , d_numFailures(0)
+    , d_lastErrorCode(0)
+    {
+    }
+
+    // MANIPULATORS
+    void record(int status, const Vec& addresses, int errorCode)
+        // Record the specified 'status', 'addresses', and 'errorCode'.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+        ++d_numCalls;
+        if (0 != status) {
+            ++d_numFailures;
+        }
+        d_lastErrorCode = errorCode;
+        d_lastAddresses = addresses;
+    }
+
+    // ACCESSORS
+    bool waitForCalls(int numCalls) const
+        // Wait for up to 5 seconds for at least the specified 'numCalls'
+        // results to be recorded.  Return 'true' if they are, and 'false'
+        // otherwise.
+    {
+        for (int i = 0; i < 500; ++i) {
+            if (this->numCalls() >= numCalls) {
+                return true;                                          // RETURN
+            }
+            bslmt::ThreadUtil::microSleep(10 * 1000);
+        }
+        return false;
+    }
+
+    int numCalls() const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+        return d_numCalls;
+    }
+
+    int numFailures() const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+        return d_numFailures;
+    }
+
+    int lastErrorCode() const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+        return d_lastErrorCode;
+    }
+
+    Vec lastAddresses() const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+        return d_lastAddresses;
+    }
+};
+
+}  // close namespace BTLSO_IPRESOLUTIONCACHE_ASYNC
+
 // ============================================================================
 //                            MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -643,7 +761,7 @@ int main(int argc, char *argv[])
     btlso::IpResolutionCache IpResolutionCache(&scratch);
 
     switch (test) { case 0:
-      case 11: {
+      case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -739,6 +857,220 @@ int main(int argc, char *argv[])
 //..
 }
       } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // ASYNCHRONOUS RESOLUTION AND REFRESH-AHEAD
+        //
+        // Concerns:
+        //: 1 'resolveAddressAsync' supplies the cached addresses of a host
+        //:   from the calling thread.
+        //:
+        //: 2 'resolveAddressAsync' resolves the addresses of a host that is
+        //:   not cached in the background, and caches them.
+        //:
+        //: 3 Concurrent asynchronous requests for the same host are served by
+        //:   a single resolution.
+        //:
+        //: 4 The failure of a resolution is supplied to the callbacks.
+        //:
+        //: 5 When a refresh-ahead interval is set, addresses requested within
+        //:   that interval of becoming stale are refreshed in the background,
+        //:   while the request is served the current addresses.
+        //:
+        //: 6 All memory is released on destruction.
+        //:
+        //: 7 Destruction completes the resolutions in progress and those not
+        //:   yet started, and supplies their results to the callbacks.
+        //
+        // Plan:
+        //: 1 Using a resolver callback taking 100 milliseconds, request the
+        //:   addresses of an uncached host several times, and verify that the
+        //:   callbacks are invoked after a single resolution, and that the
+        //:   addresses are then cached.  (C-2..3)
+        //:
+        //: 2 Request the addresses of the now cached host, and verify that
+        //:   the callback is invoked before 'resolveAddressAsync' returns,
+        //:   without resolution.  (C-1)
+        //:
+        //: 3 Request the addresses of a host whose resolution fails, and
+        //:   verify the status and error code supplied to the callbacks.
+        //:   (C-4)
+        //:
+        //: 4 Set a time-to-live of 2 seconds and a refresh-ahead interval of
+        //:   1.5 seconds.  Verify that addresses requested right after being
+        //:   resolved are not refreshed, and that addresses requested after
+        //:   0.7 seconds are returned immediately, then refreshed in the
+        //:   background.  (C-5)
+        //:
+        //: 5 Use test allocators for the object and as the default
+        //:   allocator, and verify that all memory is released on
+        //:   destruction.  (C-6)
+        //:
+        //: 6 Request the addresses of more uncached hosts than there are
+        //:   resolver threads, destroy the object right away, and verify that
+        //:   every callback was invoked with the resolved addresses.  (C-7)
+        //
+        // Testing:
+        //   int resolveAddressAsync(const char *h, int n, const Callback& cb);
+        //   void setRefreshAheadInterval(const bdlt::DatetimeInterval& value);
+        //   bdlt::DatetimeInterval refreshAheadInterval() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                        << endl
+                        << "ASYNCHRONOUS RESOLUTION AND REFRESH-AHEAD" << endl
+                        << "=========================================" << endl;
+
+        using namespace BTLSO_IPRESOLUTIONCACHE_ASYNC;
+        using bdlf::PlaceHolders::_1;
+        using bdlf::PlaceHolders::_2;
+        using bdlf::PlaceHolders::_3;
+
+        // A 'bslma::TestAllocator' is required for thread safe allocations.
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+        {
+            Obj mX(&slowCallback, &oa);  const Obj& X = mX;
+
+            ASSERT(bdlt::DatetimeInterval() == X.refreshAheadInterval());
+
+            if (verbose) cout << "\nCollapsing of concurrent requests."
+                              << endl;
+            {
+                enum { NUM_REQUESTS = 5 };
+
+                Recorder recorder;
+                Obj::ResolveAddressCallback callback(
+                             bsl::allocator_arg_t(),
+                             &oa,
+                             bdlf::BindUtil::bind(&Recorder::record,
+                                                  &recorder,
+                                                  _1,
+                                                  _2,
+                                                  _3));
+
+                numResolutions = 0;
+
+                for (int i = 0; i < NUM_REQUESTS; ++i) {
+                    ASSERT(0 == mX.resolveAddressAsync("A", 2, callback));
+                }
+
+                ASSERT(recorder.waitForCalls(NUM_REQUESTS));
+                LOOP_ASSERT(recorder.numCalls(),
+                            NUM_REQUESTS == recorder.numCalls());
+                LOOP_ASSERT(numResolutions, 1 == numResolutions);
+                ASSERT(0 == recorder.numFailures());
+
+                const Vec addresses = recorder.lastAddresses();
+                ASSERT(2 == addresses.size());
+                ASSERT(IPv4(BSLS_BYTEORDER_HTONL(1), 0) == addresses[0]);
+                ASSERT(IPv4(BSLS_BYTEORDER_HTONL(1), 1) == addresses[1]);
+
+                Vec mV(&oa);
+                ASSERT(0 == X.lookupAddressRaw(&mV, "A", 3));
+                ASSERT(3 == mV.size());
+
+                if (verbose) cout << "\nCached addresses." << endl;
+
+                ASSERT(0 == mX.resolveAddressAsync("A", 1, callback));
+
+                LOOP_ASSERT(recorder.numCalls(),
+                            NUM_REQUESTS + 1 == recorder.numCalls());
+                LOOP_ASSERT(numResolutions, 1 == numResolutions);
+                ASSERT(1 == recorder.lastAddresses().size());
+
+                if (verbose) cout << "\nFailed resolution." << endl;
+
+                ASSERT(0 == mX.resolveAddressAsync("FAIL", 1, callback));
+                ASSERT(0 == mX.resolveAddressAsync("FAIL", 1, callback));
+
+                ASSERT(recorder.waitForCalls(NUM_REQUESTS + 3));
+                LOOP_ASSERT(recorder.numFailures(),
+                            2 == recorder.numFailures());
+                ASSERT(42 == recorder.lastErrorCode());
+                ASSERT(recorder.lastAddresses().empty());
+                ASSERT(0  != X.lookupAddressRaw(&mV, "FAIL", 1));
+            }
+
+            if (verbose) cout << "\nRefresh-ahead." << endl;
+            {
+                const bdlt::DatetimeInterval TTL(0, 0, 0, 2);
+                const bdlt::DatetimeInterval REFRESH_AHEAD(0, 0, 0, 1, 500);
+
+                mX.setTimeToLive(TTL);
+                mX.setRefreshAheadInterval(REFRESH_AHEAD);
+                ASSERT(REFRESH_AHEAD == X.refreshAheadInterval());
+
+                numResolutions = 0;
+
+                Vec mV(&oa);
+                ASSERT(0 == mX.resolveAddress(&mV, "B", 1));
+                ASSERT(1 == numResolutions);
+                ASSERT(IPv4(BSLS_BYTEORDER_HTONL(1), 0) == mV[0]);
+
+                ASSERT(0 == mX.resolveAddress(&mV, "B", 1));
+                ASSERT(IPv4(BSLS_BYTEORDER_HTONL(1), 0) == mV[0]);
+
+                bslmt::ThreadUtil::microSleep(700 * 1000);
+                ASSERT(1 == numResolutions);
+
+                ASSERT(0 == mX.resolveAddress(&mV, "B", 1));
+                ASSERT(IPv4(BSLS_BYTEORDER_HTONL(1), 0) == mV[0]);
+
+                for (int i = 0; i < 500 && 2 != numResolutions; ++i) {
+                    bslmt::ThreadUtil::microSleep(10 * 1000);
+                }
+                LOOP_ASSERT(numResolutions, 2 == numResolutions);
+
+                // Wait for the refreshed entry to be stored.
+
+                for (int i = 0; i < 500; ++i) {
+                    ASSERT(0 == X.lookupAddressRaw(&mV, "B", 1));
+                    if (IPv4(BSLS_BYTEORDER_HTONL(2), 0) == mV[0]) {
+                        break;
+                    }
+                    bslmt::ThreadUtil::microSleep(10 * 1000);
+                }
+                ASSERT(IPv4(BSLS_BYTEORDER_HTONL(2), 0) == mV[0]);
+
+                ASSERT(0 == mX.resolveAddress(&mV, "B", 1));
+                ASSERT(IPv4(BSLS_BYTEORDER_HTONL(2), 0) == mV[0]);
+                LOOP_ASSERT(numResolutions, 2 == numResolutions);
+            }
+        }
+
+        if (verbose) cout << "\nDestruction with pending requests." << endl;
+        {
+            enum { NUM_HOSTS = 10 };
+
+            Recorder recorder;
+            {
+                Obj mX(&slowCallback, &oa);
+
+                Obj::ResolveAddressCallback callback(
+                             bsl::allocator_arg_t(),
+                             &oa,
+                             bdlf::BindUtil::bind(&Recorder::record,
+                                                  &recorder,
+                                                  _1,
+                                                  _2,
+                                                  _3));
+
+                for (int i = 0; i < NUM_HOSTS; ++i) {
+                    const char hostname[] = { static_cast<char>('C' + i), 0 };
+                    ASSERT(0 == mX.resolveAddressAsync(hostname, 1, callback));
+                }
+            }
+            LOOP_ASSERT(recorder.numCalls(), NUM_HOSTS == recorder.numCalls());
+            ASSERT(0 == recorder.numFailures());
+            ASSERT(1 == recorder.lastAddresses().size());
+        }
+        LOOP_ASSERT(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        LOOP_ASSERT(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
       case 10: {
         // --------------------------------------------------------------------
         // MANIPULATORS 'removeAll'
@@ -0,0 +1,247 @@
+// btlso_ipv6address.cpp                                              -*-C++-*-
+#include <btlso_ipv6address.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(btlso_ipv6address_cpp,"$Id$ $CSID$")
+
+#include <btlso_ipv4address.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+#include <bsl_ostream.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#endif
+
+namespace BloombergLP {
+namespace btlso {
+
+namespace {
+
+const unsigned char k_IPV4_MAPPED_PREFIX[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff
+};
+    // The first 12 bytes of an IPv4-mapped IPv6 address.
+
+enum {
+    k_IPV4_MAPPED_PREFIX_LENGTH = sizeof k_IPV4_MAPPED_PREFIX
+};
+
+}  // close unnamed namespace
+
+                       // -----------------
+                       // class IPv6Address
+                       // -----------------
+
+// PRIVATE CLASS METHODS
+int IPv6Address::parse(unsigned char *address,
+                       unsigned int  *scopeId,
+                       const char    *text)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(scopeId);
+    BSLS_ASSERT(text);
+
+    const char *percent = bsl::strchr(text, '%');
+
+    if (!percent) {
+        unsigned char result[k_ADDRESS_LENGTH];
+
+        if (1 == inet_pton(AF_INET6, text, result)) {
+            bsl::memcpy(address, result, k_ADDRESS_LENGTH);
+            *scopeId = 0;
+            return 0;                                                 // RETURN
+        }
+
+        // Accept an IPv4 address, in any of the formats supported by
+        // 'IPv4Address', as its IPv4-mapped equivalent.
+
+        IPv4Address ipv4Address;
+        if (0 != ipv4Address.setIpAddress(text)) {
+            return -1;                                                // RETURN
+        }
+
+        const int ipv4 = ipv4Address.ipAddress();
+        bsl::memcpy(address,
+                    k_IPV4_MAPPED_PREFIX,
+                    k_IPV4_MAPPED_PREFIX_LENGTH);
+        bsl::memcpy(address + k_IPV4_MAPPED_PREFIX_LENGTH,
+                    &ipv4,
+                    sizeof ipv4);
+        *scopeId = 0;
+        return 0;                                                     // RETURN
+    }
+
+    // The scope id must be a non-empty decimal number that fits in 32 bits.
+
+    const char *scope       = percent + 1;
+    const int   scopeLength = static_cast<int>(bsl::strlen(scope));
+
+    if (0 == scopeLength || 10 < scopeLength) {
+        return -1;                                                    // RETURN
+    }
+
+    bsls::Types::Uint64 scopeValue = 0;
+    for (const char *digit = scope; *digit; ++digit) {
+        if (*digit < '0' || '9' < *digit) {
+            return -1;                                                // RETURN
+        }
+        scopeValue = scopeValue * 10 + (*digit - '0');
+    }
+    if (scopeValue > 0xFFFFFFFFull) {
+        return -1;                                                    // RETURN
+    }
+
+    char buffer[k_MAX_ADDRESS_LENGTH];
+
+    const bsl::size_t addressLength = percent - text;
+    if (addressLength >= sizeof buffer) {
+        return -1;                                                    // RETURN
+    }
+    bsl::memcpy(buffer, text, addressLength);
+    buffer[addressLength] = 0;
+
+    unsigned char result[k_ADDRESS_LENGTH];
+    if (1 != inet_pton(AF_INET6, buffer, result)) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::memcpy(address, result, k_ADDRESS_LENGTH);
+    *scopeId = static_cast<unsigned int>(scopeValue);
+    return 0;
+}
+
+// CREATORS
+IPv6Address::IPv6Address(const char *address, int portNumber)
+: d_portNumber(static_cast<unsigned short>(portNumber))
+, d_scopeId(0)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT_SAFE(isValidAddress(address));
+    BSLS_ASSERT(0 <= portNumber && portNumber <= 65535);
+
+    bsl::memset(d_address, 0, sizeof d_address);
+    parse(d_address, &d_scopeId, address);
+}
+
+IPv6Address::IPv6Address(const IPv4Address& address)
+: d_portNumber(static_cast<unsigned short>(address.portNumber()))
+, d_scopeId(0)
+{
+    const int ipv4 = address.ipAddress();
+
+    bsl::memcpy(d_address, k_IPV4_MAPPED_PREFIX, k_IPV4_MAPPED_PREFIX_LENGTH);
+    bsl::memcpy(d_address + k_IPV4_MAPPED_PREFIX_LENGTH, &ipv4, sizeof ipv4);
+}
+
+// MANIPULATORS
+int IPv6Address::setIpAddress(const char *address)
+{
+    BSLS_ASSERT(address);
+
+    return parse(d_address, &d_scopeId, address);
+}
+
+// ACCESSORS
+bool IPv6Address::isAnyAddress() const
+{
+    for (int i = 0; i < k_ADDRESS_LENGTH; ++i) {
+        if (d_address[i]) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+bool IPv6Address::isIPv4Mapped() const
+{
+    return 0 == bsl::memcmp(d_address,
+                            k_IPV4_MAPPED_PREFIX,
+                            k_IPV4_MAPPED_PREFIX_LENGTH);
+}
+
+int IPv6Address::loadIPv4Address(IPv4Address *result) const
+{
+    BSLS_ASSERT(result);
+
+    if (!isIPv4Mapped()) {
+        return -1;                                                    // RETURN
+    }
+
+    int ipv4;
+    bsl::memcpy(&ipv4, d_address + k_IPV4_MAPPED_PREFIX_LENGTH, sizeof ipv4);
+
+    result->setIpAddress(ipv4);
+    result->setPortNumber(d_portNumber);
+    return 0;
+}
+
+int IPv6Address::loadIpAddress(char *result) const
+{
+    BSLS_ASSERT(result);
+
+    // 'inet_ntop' takes a non-'const' source address on some platforms.
+
+    unsigned char address[k_ADDRESS_LENGTH];
+    bsl::memcpy(address, d_address, sizeof address);
+
+    if (!inet_ntop(AF_INET6, address, result, k_MAX_ADDRESS_LENGTH)) {
+        *result = 0;
+        return 1;                                                     // RETURN
+    }
+
+    int length = static_cast<int>(bsl::strlen(result));
+    if (d_scopeId) {
+        length += bsl::sprintf(result + length, "%%%u", d_scopeId);
+    }
+    return length + 1;  // +1 for null terminated char.
+}
+
+int IPv6Address::formatIpAddress(char *result) const
+{
+    BSLS_ASSERT(result);
+
+    *result = '[';
+    int length = loadIpAddress(result + 1);  // includes null terminator
+    return length + bsl::sprintf(result + length, "]:%d", d_portNumber) + 1;
+}
+
+bsl::ostream& IPv6Address::streamOut(bsl::ostream& stream) const
+{
+    char buffer[k_MAX_FORMATTED_LENGTH];
+
+    formatIpAddress(buffer);
+
+    stream << buffer;
+
+    return stream;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,481 @@
+// btlso_ipv6address.h                                                -*-C++-*-
+#ifndef INCLUDED_BTLSO_IPV6ADDRESS
+#define INCLUDED_BTLSO_IPV6ADDRESS
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a representation of an IPv6 address.
+//
+//@CLASSES:
+// btlso::IPv6Address: IPv6 (Internet Protocol version 6) address
+//
+//@SEE_ALSO: btlso_ipv4address, btlso_socketimputil, btlso_resolveutil
+//
+//@DESCRIPTION: This component provides a value-semantic class,
+// 'btlso::IPv6Address', that represents an IPv6 transport address: a 128-bit
+// logical IP address, a port number in the range [0, 65535], and a scope
+// identifier that selects the network interface for link-local addresses
+// (e.g., "fe80::1").  The logical IP address is held as 16 bytes *in*
+// *network* *byte* *order*, and is exposed as such by the 'ipAddress'
+// accessor.
+//
+// 'btlso::IPv6Address' is the address type to use with the templatized
+// functions of 'btlso_socketimputil', 'btlso_inetstreamsocketfactory' and
+// 'btlso_inetstreamsocket' to create and operate on 'AF_INET6' sockets.
+//
+///Dual-Stack Addresses
+///--------------------
+// An IPv4 address can be represented as an *IPv4-mapped* IPv6 address (i.e.,
+// "::ffff:a.b.c.d", see RFC 4291).  A 'btlso::IPv6Address' can be created
+// from a 'btlso::IPv4Address', and an IPv4-mapped 'btlso::IPv6Address' can be
+// converted back using 'loadIPv4Address'.  On dual-stack hosts, an 'AF_INET6'
+// socket that does not have the 'IPV6_V6ONLY' option set (see
+// 'btlso::SocketOptUtil::k_IPV6ONLY') can both connect to and accept
+// connections from IPv4 peers using their IPv4-mapped addresses.  A single
+// socket and address type can therefore reach any peer, whichever protocol
+// it has been resolved to (see 'btlso::ResolveUtil::getAddresses').
+//
+///Valid String Representations of IPv6 Addresses
+///----------------------------------------------
+// Strings representing IP addresses are considered valid by this component if
+// they are in any of the textual formats defined by RFC 4291 (e.g., "::1",
+// "2001:db8::8:800:200c:417a" or "::ffff:10.0.0.1"), optionally followed by a
+// '%' and a decimal scope identifier (e.g., "fe80::1%2").  For convenience, an
+// IPv4 address in any of the formats accepted by 'btlso::IPv4Address' is also
+// valid, and denotes the corresponding IPv4-mapped IPv6 address.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Basic Syntax
+///- - - - - - - - - - - -
+// First, we create an address for the loopback interface and port 8142:
+//..
+//  btlso::IPv6Address ip1("::1", 8142);
+//  assert(8142 == ip1.portNumber());
+//  assert(!ip1.isIPv4Mapped());
+//
+//  char buffer[btlso::IPv6Address::k_MAX_FORMATTED_LENGTH];
+//  ip1.formatIpAddress(buffer);
+//  assert(0 == bsl::strcmp("[::1]:8142", buffer));
+//..
+// Then, we create an IPv6 address from an IPv4 address, and observe that it
+// is IPv4-mapped:
+//..
+//  btlso::IPv6Address ip2(btlso::IPv4Address("10.0.0.1", 80));
+//  assert(ip2.isIPv4Mapped());
+//
+//  ip2.loadIpAddress(buffer);
+//  assert(0 == bsl::strcmp("::ffff:10.0.0.1", buffer));
+//..
+// Finally, we convert 'ip2' back to an IPv4 address:
+//..
+//  btlso::IPv4Address ip3;
+//  int rc = ip2.loadIPv4Address(&ip3);
+//  assert(0 == rc);
+//  assert(btlso::IPv4Address("10.0.0.1", 80) == ip3);
+//..
+
+#ifndef INCLUDED_BTLSCM_VERSION
+#include <btlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSL_IOSFWD
+#include <bsl_iosfwd.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYCOPYABLE
+#include <bslmf_istriviallycopyable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTRING
+#include <bsl_cstring.h>
+#endif
+
+namespace BloombergLP {
+namespace btlso {
+
+class IPv4Address;
+
+                         // =================
+                         // class IPv6Address
+                         // =================
+
+class IPv6Address {
+    // Each instance of this class represents an IPv6 transport address.  A
+    // static method 'isValidAddress' is provided to verify that the textual
+    // representation of an IP address is valid before it is used to create or
+    // modify an IPv6 address object.  More generally, this class supports a
+    // complete set of *value* *semantic* operations, including copy
+    // construction, assignment, equality comparison, 'ostream' printing, and
+    // BDEX serialization.  (A precise operational definition of when two
+    // instances have the same value can be found in the description of
+    // 'operator==' for the class.)  This class is *exception* *neutral* with
+    // no guarantee of rollback: if an exception is thrown during the
+    // invocation of a method on a pre-existing instance, the object is left in
+    // a valid state, but its value is undefined.  In no event is memory
+    // leaked.  Finally, *aliasing* (e.g., using all or part of an object as
+    // both source and destination) is supported in all cases.
+
+  public:
+    // TYPES
+    enum {
+        k_ANY_PORT             = 0,   // Indicate that it is up to the service
+                                      // provider to assign a port.
+
+        k_ADDRESS_LENGTH       = 16,  // number of bytes in an IPv6 address
+
+        k_MAX_ADDRESS_LENGTH   = 57,  // minimum size of the buffer supplied
+                                      // to 'loadIpAddress' (address, '%' and
+                                      // scope id, and the null terminator)
+
+        k_MAX_FORMATTED_LENGTH = 65   // minimum size of the buffer supplied
+                                      // to 'formatIpAddress' (address in
+                                      // brackets, ':' and port number, and
+                                      // the null terminator)
+    };
+
+  private:
+    // DATA
+    unsigned char  d_address[k_ADDRESS_LENGTH];
+                                    // logical IP address in network byte
+                                    // order
+
+    unsigned short d_portNumber;    // port number (see 'btlso_ipv4address'
+                                    // for why it is an 'unsigned short')
+
+    unsigned int   d_scopeId;       // interface index of a scoped address,
+                                    // or 0 if unspecified
+
+    // PRIVATE CLASS METHODS
+    static int parse(unsigned char *address,
+                     unsigned int  *scopeId,
+                     const char    *text);
+        // Convert the specified textual IP address 'text' into binary form (in
+        // network byte order), and load the result into the specified
+        // 'address' and 'scopeId'.  Return 0 on success, and a non-zero value
+        // (with no effect on 'address' and 'scopeId') if 'text' is not a
+        // valid IP address.  See {Valid String Representations of IPv6
+        // Addresses} for details.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(IPv6Address, bsl::is_trivially_copyable)
+
+    // CLASS METHODS
+    static bool isValidAddress(const char *address);
+        // Return 'true' if the specified IP 'address' is valid, and 'false'
+        // otherwise.  See {Valid String Representations of IPv6 Addresses}
+        // for details.
+
+    static int maxSupportedBdexVersion(int versionSelector);
+        // Return the maximum valid BDEX format version, as indicated by the
+        // specified 'versionSelector', to be passed to the 'bdexStreamOut'
+        // method.  Note that the 'versionSelector' is expected to be formatted
+        // as 'yyyymmdd', a date representation.  See the 'bslx' package-level
+        // documentation for more information on BDEX streaming of
+        // value-semantic types and containers.
+
+    // CREATORS
+    IPv6Address();
+        // Create a 'IPv6Address' object having the unspecified IP address
+        // ("::"), a port number of 'k_ANY_PORT' value, and a scope id of 0.
+
+    IPv6Address(const char *address, int portNumber);
+        // Create a 'IPv6Address' object having the value given by the
+        // specified IP 'address' and 'portNumber'.  The behavior is undefined
+        // unless 'portNumber' is in the range [0, 65535] and the IP 'address'
+        // is valid.  See {Valid String Representations of IPv6 Addresses} for
+        // details.
+
+    explicit IPv6Address(const IPv4Address& address);
+        // Create a 'IPv6Address' object having the IPv4-mapped IP address and
+        // the port number of the specified 'address', and a scope id of 0.
+
+    //! IPv6Address(const IPv6Address& original) = default;
+    //! ~IPv6Address() = default;
+
+    // MANIPULATORS
+    //! IPv6Address& operator=(const IPv6Address& rhs) = default;
+
+    int setIpAddress(const char *address);
+        // Set this object to have the specified IP 'address', and the scope id
+        // specified in 'address' (or 0 if it does not specify one).  Return 0
+        // if 'address' is valid, and a non-zero value (with no effect on this
+        // object) otherwise.  See {Valid String Representations of IPv6
+        // Addresses} for details.
+
+    void setIpAddress(const unsigned char *address);
+        // Set this object to have the IP address held in the
+        // 'k_ADDRESS_LENGTH' bytes at the specified 'address' in network byte
+        // order.
+
+    void setPortNumber(int portNumber);
+        // Set this object to have the specified 'portNumber'.  The behavior is
+        // undefined unless 'portNumber' is in the range [0, 65535].
+
+    void setScopeId(unsigned int scopeId);
+        // Set this object to have the specified 'scopeId'.
+
+    template <class STREAM>
+    STREAM& bdexStreamIn(STREAM& stream, int version);
+        // Assign to this object the value read from the specified input
+        // 'stream' using the specified 'version' format, and return a
+        // reference to 'stream'.  If 'stream' is initially invalid, this
+        // operation has no effect.  If 'version' is not supported, this object
+        // is unaltered and 'stream' is invalidated but otherwise unmodified.
+        // If 'version' is supported but 'stream' becomes invalid during this
+        // operation, this object has an undefined, but valid, state.  Note
+        // that no version is read from 'stream'.  See the 'bslx' package-level
+        // documentation for more information on BDEX streaming of
+        // value-semantic types and containers.
+
+    // ACCESSORS
+    const unsigned char *ipAddress() const;
+        // Return the address of the 'k_ADDRESS_LENGTH' bytes holding the IP
+        // address of this object in network byte order.
+
+    bool isAnyAddress() const;
+        // Return 'true' if the IP address of this object is the unspecified
+        // address ("::"), and 'false' otherwise.
+
+    bool isIPv4Mapped() const;
+        // Return 'true' if the IP address of this object is an IPv4-mapped
+        // address (i.e., "::ffff:a.b.c.d"), and 'false' otherwise.
+
+    int loadIPv4Address(IPv4Address *result) const;
+        // Load into the specified 'result' the IPv4 address and the port
+        // number of this object if its IP address is IPv4-mapped.  Return 0
+        // on success, and a non-zero value (with no effect on 'result') if
+        // this object does not hold an IPv4-mapped address.
+
+    int loadIpAddress(char *result) const;
+        // Load into the specified 'result' the IP address of this object in
+        // the canonical textual form of RFC 5952 (followed by '%' and the
+        // scope id if it is not 0) as a null-terminated string, and return the
+        // number of bytes used to store the result (including the null
+        // character).  The behavior is undefined unless 'result' refers to an
+        // array of at least 'k_MAX_ADDRESS_LENGTH' characters.
+
+    int formatIpAddress(char *result) const;
+        // Load into the specified 'result' the IP address of this object, as
+        // formatted by 'loadIpAddress' and enclosed in brackets, followed by a
+        // colon and the port number (e.g., "[::1]:8142") as a null-terminated
+        // string, and return the number of bytes used to store the result
+        // (including the null character).  The behavior is undefined unless
+        // 'result' refers to an array of at least 'k_MAX_FORMATTED_LENGTH'
+        // characters.
+
+    int portNumber() const;
+        // Return the port number of this object.
+
+    unsigned int scopeId() const;
+        // Return the scope id of this object.
+
+    bsl::ostream& streamOut(bsl::ostream& stream) const;
+        // Write the value of this object to the specified 'stream' in the
+        // format produced by 'formatIpAddress' (e.g., "[::1]:8142").
+
+    template <class STREAM>
+    STREAM& bdexStreamOut(STREAM& stream, int version) const;
+        // Write the value of this object, using the specified 'version'
+        // format, to the specified output 'stream', and return a reference to
+        // 'stream'.  If 'stream' is initially invalid, this operation has no
+        // effect.  If 'version' is not supported, 'stream' is invalidated but
+        // otherwise unmodified.  Note that 'version' is not written to
+        // 'stream'.  See the 'bslx' package-level documentation for more
+        // information on BDEX streaming of value-semantic types and
+        // containers.
+};
+
+// FREE OPERATORS
+inline
+bool operator==(const IPv6Address& lhs, const IPv6Address& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'IPv6Address' objects have the same
+    // value if and only if their respective IP addresses, port numbers and
+    // scope ids each have the same value.
+
+inline
+bool operator!=(const IPv6Address& lhs, const IPv6Address& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'IPv6Address' objects do not
+    // have the same value if their respective IP addresses, port numbers or
+    // scope ids differ in values.
+
+inline
+bsl::ostream& operator<<(bsl::ostream& output, const IPv6Address& address);
+    // Write the specified IPv6 'address' value to the specified 'output'
+    // stream in the format "[address]:portNumber", e.g., "[::1]:5".
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // -----------------
+                            // class IPv6Address
+                            // -----------------
+
+// CLASS METHODS
+inline
+bool IPv6Address::isValidAddress(const char *address)
+{
+    BSLS_ASSERT_SAFE(address);
+
+    unsigned char addr[k_ADDRESS_LENGTH];
+    unsigned int  scopeId;
+    return 0 == parse(addr, &scopeId, address);
+}
+
+inline
+int IPv6Address::maxSupportedBdexVersion(int /* versionSelector */)
+{
+    return 1;
+}
+
+// CREATORS
+inline
+IPv6Address::IPv6Address()
+: d_portNumber(k_ANY_PORT)
+, d_scopeId(0)
+{
+    bsl::memset(d_address, 0, sizeof d_address);
+}
+
+// MANIPULATORS
+inline
+void IPv6Address::setIpAddress(const unsigned char *address)
+{
+    BSLS_ASSERT_SAFE(address);
+
+    bsl::memcpy(d_address, address, sizeof d_address);
+}
+
+inline
+void IPv6Address::setPortNumber(int portNumber)
+{
+    BSLS_ASSERT_SAFE(0 <= portNumber && portNumber <= 65535);
+
+    d_portNumber = static_cast<unsigned short>(portNumber);
+}
+
+inline
+void IPv6Address::setScopeId(unsigned int scopeId)
+{
+    d_scopeId = scopeId;
+}
+
+template <class STREAM>
+STREAM& IPv6Address::bdexStreamIn(STREAM& stream, int version)
+{
+    if (stream) {
+        switch (version) { // switch on the version
+          case 1: {
+            for (int i = 0; i < k_ADDRESS_LENGTH; ++i) {
+                stream.getUint8(d_address[i]);
+            }
+            stream.getUint16(d_portNumber);
+            stream.getUint32(d_scopeId);
+          } break;
+          default: {
+            stream.invalidate();
+          }
+        }
+    }
+    return stream;
+}
+
+// ACCESSORS
+inline
+const unsigned char *IPv6Address::ipAddress() const
+{
+    return d_address;
+}
+
+inline
+int IPv6Address::portNumber() const
+{
+    return d_portNumber;
+}
+
+inline
+unsigned int IPv6Address::scopeId() const
+{
+    return d_scopeId;
+}
+
+template <class STREAM>
+STREAM& IPv6Address::bdexStreamOut(STREAM& stream, int version) const
+{
+    switch (version) {
+      case 1: {
+        for (int i = 0; i < k_ADDRESS_LENGTH; ++i) {
+            stream.putUint8(d_address[i]);
+        }
+        stream.putUint16(d_portNumber);
+        stream.putUint32(d_scopeId);
+      } break;
+      default: {
+        stream.invalidate();
+      }
+    }
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool btlso::operator==(const IPv6Address& lhs, const IPv6Address& rhs)
+{
+    return lhs.portNumber() == rhs.portNumber()
+        && lhs.scopeId()    == rhs.scopeId()
+        && 0 == bsl::memcmp(lhs.ipAddress(),
+                            rhs.ipAddress(),
+                            IPv6Address::k_ADDRESS_LENGTH);
+}
+
+inline
+bool btlso::operator!=(const IPv6Address& lhs, const IPv6Address& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bsl::ostream& btlso::operator<<(bsl::ostream&      output,
+                                const IPv6Address& address)
+{
+    return address.streamOut(output);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
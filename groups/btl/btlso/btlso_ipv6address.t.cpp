@@ -0,0 +1,625 @@
+// btlso_ipv6address.t.cpp                                            -*-C++-*-
+#include <btlso_ipv6address.h>
+
+#include <btlso_ipv4address.h>
+
+#include <bslx_testinstream.h>
+#include <bslx_testoutstream.h>
+
+#include <bsls_platform.h>
+
+#include <bsl_cstdlib.h>     // atoi()
+#include <bsl_cstring.h>     // strcmp()
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                   TEST PLAN
+// ----------------------------------------------------------------------------
+//                                   Overview
+// 'btlso::IPv6Address' is a value-semantic type.  The textual conversions are
+// delegated to 'inet_pton' and 'inet_ntop', so the tests concentrate on the
+// extensions layered on top of them (scope ids, IPv4 addresses and
+// IPv4-mapped addresses) and on the value-semantic operations.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static bool isValidAddress(const char *address);
+// [ 5] static int maxSupportedBdexVersion(int);
+//
+// CREATORS
+// [ 2] IPv6Address();
+// [ 2] IPv6Address(const char *address, int portNumber);
+// [ 3] explicit IPv6Address(const IPv4Address& address);
+//
+// MANIPULATORS
+// [ 2] int setIpAddress(const char *address);
+// [ 2] void setIpAddress(const unsigned char *address);
+// [ 2] void setPortNumber(int portNumber);
+// [ 2] void setScopeId(unsigned int scopeId);
+// [ 5] STREAM& bdexStreamIn(STREAM& stream, int version);
+//
+// ACCESSORS
+// [ 2] const unsigned char *ipAddress() const;
+// [ 2] bool isAnyAddress() const;
+// [ 3] bool isIPv4Mapped() const;
+// [ 3] int loadIPv4Address(IPv4Address *result) const;
+// [ 4] int loadIpAddress(char *result) const;
+// [ 4] int formatIpAddress(char *result) const;
+// [ 2] int portNumber() const;
+// [ 2] unsigned int scopeId() const;
+// [ 4] bsl::ostream& streamOut(bsl::ostream& stream) const;
+// [ 5] STREAM& bdexStreamOut(STREAM& stream, int version) const;
+//
+// FREE OPERATORS
+// [ 1] bool operator==(const IPv6Address& lhs, const IPv6Address& rhs);
+// [ 1] bool operator!=(const IPv6Address& lhs, const IPv6Address& rhs);
+// [ 4] ostream& operator<<(ostream& output, const IPv6Address& address);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACROS
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+#define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT(I,X) { \
+   if (!(X)) { cout << #I << ": " << I << "\n"; aSsErT(1, #X, __LINE__); }}
+
+#define LOOP2_ASSERT(I,J,X) { \
+   if (!(X)) { cout << #I << ": " << I << "\t" << #J << ": " \
+              << J << "\n"; aSsErT(1, #X, __LINE__); } }
+
+//=============================================================================
+//                  SEMI-STANDARD TEST OUTPUT MACROS
+//-----------------------------------------------------------------------------
+#define P(X) cout << #X " = " << (X) << endl; // Print identifier and value.
+#define Q(X) cout << "<| " #X " |>" << endl;  // Quote identifier literally.
+#define P_(X) cout << #X " = " << (X) << ", "<< flush; // P(X) without '\n'
+#define L_ __LINE__                           // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef btlso::IPv6Address  Obj;
+typedef bslx::TestInStream  In;
+typedef bslx::TestOutStream Out;
+
+#define VERSION_SELECTOR 20170601
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove leading
+        //   comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Usage Example"
+                          << "\n=====================" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Basic Syntax
+///- - - - - - - - - - - -
+// First, we create an address for the loopback interface and port 8142:
+//..
+    btlso::IPv6Address ip1("::1", 8142);
+    ASSERT(8142 == ip1.portNumber());
+    ASSERT(!ip1.isIPv4Mapped());
+
+    char buffer[btlso::IPv6Address::k_MAX_FORMATTED_LENGTH];
+    ip1.formatIpAddress(buffer);
+    ASSERT(0 == bsl::strcmp("[::1]:8142", buffer));
+//..
+// Then, we create an IPv6 address from an IPv4 address, and observe that it
+// is IPv4-mapped:
+//..
+    btlso::IPv6Address ip2(btlso::IPv4Address("10.0.0.1", 80));
+    ASSERT(ip2.isIPv4Mapped());
+
+    ip2.loadIpAddress(buffer);
+    ASSERT(0 == bsl::strcmp("::ffff:10.0.0.1", buffer));
+//..
+// Finally, we convert 'ip2' back to an IPv4 address:
+//..
+    btlso::IPv4Address ip3;
+    int rc = ip2.loadIPv4Address(&ip3);
+    ASSERT(0 == rc);
+    ASSERT(btlso::IPv4Address("10.0.0.1", 80) == ip3);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING BDEX STREAMING
+        //
+        // Concerns:
+        //: 1 A value streamed out and back in with version 1 is unchanged,
+        //:   including its scope id.
+        //:
+        //: 2 An unsupported version invalidates the stream and leaves the
+        //:   object unchanged.
+        //
+        // Plan:
+        //: 1 Stream a table of values out to a 'bslx::TestOutStream' and back
+        //:   in from a 'bslx::TestInStream'.  (C-1)
+        //:
+        //: 2 Stream in with version 0 and 2, and verify the stream is invalid
+        //:   and the object unchanged.  (C-2)
+        //
+        // Testing:
+        //   static int maxSupportedBdexVersion(int);
+        //   STREAM& bdexStreamIn(STREAM& stream, int version);
+        //   STREAM& bdexStreamOut(STREAM& stream, int version) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING BDEX STREAMING"
+                          << "\n======================" << endl;
+
+        ASSERT(1 == Obj::maxSupportedBdexVersion(VERSION_SELECTOR));
+
+        static const struct {
+            int          d_line;
+            const char  *d_address;
+            int          d_port;
+            unsigned int d_scopeId;
+        } DATA[] = {
+            { L_, "::",                         0,     0 },
+            { L_, "::1",                        1,     0 },
+            { L_, "2001:db8::8:800:200c:417a",  65535, 0 },
+            { L_, "fe80::1",                    8142,  7 },
+            { L_, "10.0.0.1",                   80,    0 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const int LINE = DATA[i].d_line;
+
+            Obj mX(DATA[i].d_address, DATA[i].d_port);
+            mX.setScopeId(DATA[i].d_scopeId);
+            const Obj& X = mX;
+
+            Out out(VERSION_SELECTOR);
+            X.bdexStreamOut(out, 1);
+
+            In in(out.data(), out.length());
+            ASSERT(in);
+
+            Obj mY;  const Obj& Y = mY;
+            mY.bdexStreamIn(in, 1);
+            LOOP_ASSERT(LINE, in);
+            LOOP_ASSERT(LINE, in.isEmpty());
+            LOOP_ASSERT(LINE, X == Y);
+        }
+
+        if (verbose) cout << "\tUnsupported versions." << endl;
+        {
+            const Obj X("::1", 5);
+
+            Out out(VERSION_SELECTOR);
+            X.bdexStreamOut(out, 1);
+
+            for (int version = 0; version <= 2; version += 2) {
+                In in(out.data(), out.length());
+
+                Obj mY("fe80::2", 6);  const Obj& Y = mY;
+                mY.bdexStreamIn(in, version);
+                LOOP_ASSERT(version, !in);
+                LOOP_ASSERT(version, Obj("fe80::2", 6) == Y);
+            }
+
+            Out out2(VERSION_SELECTOR);
+            X.bdexStreamOut(out2, 2);
+            ASSERT(!out2);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING TEXTUAL OUTPUT
+        //
+        // Concerns:
+        //: 1 'loadIpAddress' produces the canonical text of the address,
+        //:   followed by the scope id when it is not 0, and returns the number
+        //:   of bytes written including the null terminator.
+        //:
+        //: 2 'formatIpAddress', 'streamOut' and 'operator<<' enclose the
+        //:   address in brackets and append the port number.
+        //:
+        //: 3 The longest possible values fit in the documented buffer sizes.
+        //
+        // Plan:
+        //: 1 Use a table of addresses, and verify the output of each method.
+        //:   (C-1..2)
+        //:
+        //: 2 Format the longest address with the largest scope id and port
+        //:   number, and verify the returned lengths.  (C-3)
+        //
+        // Testing:
+        //   int loadIpAddress(char *result) const;
+        //   int formatIpAddress(char *result) const;
+        //   bsl::ostream& streamOut(bsl::ostream& stream) const;
+        //   ostream& operator<<(ostream& output, const IPv6Address& address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING TEXTUAL OUTPUT"
+                          << "\n======================" << endl;
+
+        static const struct {
+            int          d_line;
+            const char  *d_input;
+            int          d_port;
+            const char  *d_address;
+            const char  *d_formatted;
+        } DATA[] = {
+            { L_, "::",             0,     "::",           "[::]:0"         },
+            { L_, "0::0:1",         80,    "::1",          "[::1]:80"       },
+            { L_, "2001:DB8:0:0:0:0:0:1",
+                                    443,   "2001:db8::1",  "[2001:db8::1]:443"
+                                                                            },
+            { L_, "fe80::1%3",      22,    "fe80::1%3",    "[fe80::1%3]:22" },
+            { L_, "127.0.0.1",      8142,  "::ffff:127.0.0.1",
+                                                     "[::ffff:127.0.0.1]:8142"
+                                                                            },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const int   LINE      = DATA[i].d_line;
+            const char *ADDRESS   = DATA[i].d_address;
+            const char *FORMATTED = DATA[i].d_formatted;
+
+            const Obj X(DATA[i].d_input, DATA[i].d_port);
+
+            if (veryVerbose) { P_(LINE) P(X) }
+
+            char buffer[Obj::k_MAX_FORMATTED_LENGTH];
+
+            int length = X.loadIpAddress(buffer);
+            LOOP2_ASSERT(LINE, buffer, 0 == bsl::strcmp(ADDRESS, buffer));
+            LOOP_ASSERT(LINE, (int) bsl::strlen(ADDRESS) + 1 == length);
+
+            length = X.formatIpAddress(buffer);
+            LOOP2_ASSERT(LINE, buffer, 0 == bsl::strcmp(FORMATTED, buffer));
+            LOOP_ASSERT(LINE, (int) bsl::strlen(FORMATTED) + 1 == length);
+
+            bsl::ostringstream os1, os2;
+            X.streamOut(os1);
+            os2 << X;
+            LOOP_ASSERT(LINE, FORMATTED == os1.str());
+            LOOP_ASSERT(LINE, FORMATTED == os2.str());
+        }
+
+        if (verbose) cout << "\tLongest values." << endl;
+        {
+            Obj mX("ffff:ffff:ffff:ffff:ffff:ffff:255.255.255.255", 65535);
+            mX.setScopeId(4294967295u);
+            const Obj& X = mX;
+
+            char buffer[Obj::k_MAX_FORMATTED_LENGTH];
+
+            int length = X.loadIpAddress(buffer);
+            ASSERT(length <= Obj::k_MAX_ADDRESS_LENGTH);
+
+            length = X.formatIpAddress(buffer);
+            ASSERT(length <= Obj::k_MAX_FORMATTED_LENGTH);
+            ASSERT((int) bsl::strlen(buffer) + 1 == length);
+
+            if (veryVerbose) { P(buffer) }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING IPV4-MAPPED ADDRESSES
+        //
+        // Concerns:
+        //: 1 An object created from an 'IPv4Address' holds the IPv4-mapped
+        //:   address and the port number of the IPv4 address.
+        //:
+        //: 2 'loadIPv4Address' recovers the original IPv4 address, and fails
+        //:   with no effect for an address that is not IPv4-mapped.
+        //:
+        //: 3 A textual IPv4 address parses to the same IPv4-mapped address.
+        //
+        // Plan:
+        //: 1 Convert a table of IPv4 addresses back and forth, and compare
+        //:   with the result of parsing the textual address.  (C-1..3)
+        //:
+        //: 2 Call 'loadIPv4Address' on native IPv6 addresses.  (C-2)
+        //
+        // Testing:
+        //   explicit IPv6Address(const IPv4Address& address);
+        //   bool isIPv4Mapped() const;
+        //   int loadIPv4Address(IPv4Address *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING IPV4-MAPPED ADDRESSES"
+                          << "\n=============================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_address;
+            int         d_port;
+        } DATA[] = {
+            { L_, "0.0.0.0",          0     },
+            { L_, "127.0.0.1",        8142  },
+            { L_, "10.1.2.3",         80    },
+            { L_, "255.255.255.255",  65535 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const int   LINE    = DATA[i].d_line;
+            const char *ADDRESS = DATA[i].d_address;
+            const int   PORT    = DATA[i].d_port;
+
+            const btlso::IPv4Address V4(ADDRESS, PORT);
+
+            const Obj X(V4);
+            LOOP_ASSERT(LINE, X.isIPv4Mapped());
+            LOOP_ASSERT(LINE, !X.isAnyAddress());
+            LOOP_ASSERT(LINE, PORT == X.portNumber());
+            LOOP_ASSERT(LINE, 0    == X.scopeId());
+            LOOP_ASSERT(LINE, Obj(ADDRESS, PORT) == X);
+
+            btlso::IPv4Address result;
+            LOOP_ASSERT(LINE, 0  == X.loadIPv4Address(&result));
+            LOOP_ASSERT(LINE, V4 == result);
+        }
+
+        const char *NATIVE[] = { "::", "::1", "fe80::1", "0:0:0:0:1:ffff:0:1" };
+        const int NUM_NATIVE = sizeof NATIVE / sizeof *NATIVE;
+
+        for (int i = 0; i < NUM_NATIVE; ++i) {
+            const Obj X(NATIVE[i], 1);
+            LOOP_ASSERT(i, !X.isIPv4Mapped());
+
+            const btlso::IPv4Address V4("1.2.3.4", 5);
+
+            btlso::IPv4Address result(V4);
+            LOOP_ASSERT(i, 0  != X.loadIPv4Address(&result));
+            LOOP_ASSERT(i, V4 == result);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PARSING AND PRIMARY MANIPULATORS
+        //
+        // Concerns:
+        //: 1 A default object holds "::", port 0 and scope id 0.
+        //:
+        //: 2 Every valid textual address is accepted and yields the expected
+        //:   bytes and scope id, and every invalid one is rejected by both
+        //:   'isValidAddress' and 'setIpAddress', with no effect on the
+        //:   object.
+        //:
+        //: 3 The binary 'setIpAddress', 'setPortNumber' and 'setScopeId' set
+        //:   only their respective attribute.
+        //
+        // Plan:
+        //: 1 Verify the value of a default-constructed object.  (C-1)
+        //:
+        //: 2 Use a table of valid and invalid textual addresses, and verify
+        //:   the outcome of 'isValidAddress' and 'setIpAddress'.  (C-2)
+        //:
+        //: 3 Set each attribute in turn and verify the others.  (C-3)
+        //
+        // Testing:
+        //   IPv6Address();
+        //   IPv6Address(const char *address, int portNumber);
+        //   static bool isValidAddress(const char *address);
+        //   int setIpAddress(const char *address);
+        //   void setIpAddress(const unsigned char *address);
+        //   void setPortNumber(int portNumber);
+        //   void setScopeId(unsigned int scopeId);
+        //   const unsigned char *ipAddress() const;
+        //   bool isAnyAddress() const;
+        //   int portNumber() const;
+        //   unsigned int scopeId() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING PARSING AND PRIMARY MANIPULATORS"
+                          << "\n========================================"
+                          << endl;
+
+        const unsigned char ZERO[Obj::k_ADDRESS_LENGTH] = { 0 };
+
+        {
+            const Obj X;
+            ASSERT(0 == bsl::memcmp(ZERO, X.ipAddress(), sizeof ZERO));
+            ASSERT(X.isAnyAddress());
+            ASSERT(0 == X.portNumber());
+            ASSERT(0 == X.scopeId());
+        }
+
+        static const struct {
+            int           d_line;
+            const char   *d_text;
+            bool          d_isValid;
+            unsigned char d_first;     // first byte of the address
+            unsigned char d_last;      // last byte of the address
+            unsigned int  d_scopeId;
+        } DATA[] = {
+            { L_, "::",                       true,  0x00, 0x00, 0          },
+            { L_, "::1",                      true,  0x00, 0x01, 0          },
+            { L_, "2001:db8::ff",             true,  0x20, 0xff, 0          },
+            { L_, "FE80::1%0",                true,  0xfe, 0x01, 0          },
+            { L_, "fe80::1%12",               true,  0xfe, 0x01, 12         },
+            { L_, "fe80::2%4294967295",       true,  0xfe, 0x02, 4294967295u},
+            { L_, "::ffff:1.2.3.4",           true,  0x00, 0x04, 0          },
+            { L_, "1.2.3.4",                  true,  0x00, 0x04, 0          },
+            { L_, "",                         false, 0,    0,    0          },
+            { L_, ":",                        false, 0,    0,    0          },
+            { L_, "1::2::3",                  false, 0,    0,    0          },
+            { L_, "12345::",                  false, 0,    0,    0          },
+            { L_, "fe80::1%",                 false, 0,    0,    0          },
+            { L_, "fe80::1%eth0",             false, 0,    0,    0          },
+            { L_, "fe80::1%-1",               false, 0,    0,    0          },
+            { L_, "fe80::1%4294967296",       false, 0,    0,    0          },
+            { L_, "%1",                       false, 0,    0,    0          },
+            { L_, "1.2.3.4%1",                false, 0,    0,    0          },
+            { L_, "[::1]",                    false, 0,    0,    0          },
+            { L_, "::1 ",                     false, 0,    0,    0          },
+            { L_, "host.example.com",         false, 0,    0,    0          },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const int     LINE     = DATA[i].d_line;
+            const char   *TEXT     = DATA[i].d_text;
+            const bool    IS_VALID = DATA[i].d_isValid;
+
+            if (veryVerbose) { P_(LINE) P(TEXT) }
+
+            LOOP_ASSERT(LINE, IS_VALID == Obj::isValidAddress(TEXT));
+
+            Obj mX("fe80::abcd%9", 5);  const Obj& X = mX;
+            const Obj ORIGINAL(X);
+
+            int rc = mX.setIpAddress(TEXT);
+            LOOP_ASSERT(LINE, IS_VALID == (0 == rc));
+            LOOP_ASSERT(LINE, 5 == X.portNumber());
+
+            if (!IS_VALID) {
+                LOOP_ASSERT(LINE, ORIGINAL == X);
+                continue;
+            }
+
+            LOOP_ASSERT(LINE, DATA[i].d_first   == X.ipAddress()[0]);
+            LOOP_ASSERT(LINE, DATA[i].d_last    == X.ipAddress()[15]);
+            LOOP_ASSERT(LINE, DATA[i].d_scopeId == X.scopeId());
+
+            const Obj Y(TEXT, 5);
+            LOOP_ASSERT(LINE, X == Y);
+        }
+
+        if (verbose) cout << "\tBinary manipulators." << endl;
+        {
+            unsigned char bytes[Obj::k_ADDRESS_LENGTH];
+            for (int i = 0; i < Obj::k_ADDRESS_LENGTH; ++i) {
+                bytes[i] = static_cast<unsigned char>(i + 1);
+            }
+
+            Obj mX;  const Obj& X = mX;
+
+            mX.setIpAddress(bytes);
+            ASSERT(0 == bsl::memcmp(bytes, X.ipAddress(), sizeof bytes));
+            ASSERT(!X.isAnyAddress());
+            ASSERT(0 == X.portNumber());
+            ASSERT(0 == X.scopeId());
+
+            mX.setPortNumber(65535);
+            ASSERT(0 == bsl::memcmp(bytes, X.ipAddress(), sizeof bytes));
+            ASSERT(65535 == X.portNumber());
+            ASSERT(0 == X.scopeId());
+
+            mX.setScopeId(3);
+            ASSERT(0 == bsl::memcmp(bytes, X.ipAddress(), sizeof bytes));
+            ASSERT(65535 == X.portNumber());
+            ASSERT(3 == X.scopeId());
+
+            ASSERT(Obj("102:304:506:708:90a:b0c:d0e:f10%3", 65535) == X);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Plan:
+        //   Create, copy, assign and compare a few objects.
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   bool operator==(const IPv6Address& lhs, const IPv6Address& rhs);
+        //   bool operator!=(const IPv6Address& lhs, const IPv6Address& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        Obj mX1;  const Obj& X1 = mX1;
+        Obj mX2("::1", 8142);  const Obj& X2 = mX2;
+
+        ASSERT(X1 == X1);    ASSERT(!(X1 != X1));
+        ASSERT(X1 != X2);    ASSERT(!(X1 == X2));
+
+        Obj mX3(X2);  const Obj& X3 = mX3;
+        ASSERT(X2 == X3);
+
+        mX3.setPortNumber(8143);
+        ASSERT(X2 != X3);
+
+        mX3.setPortNumber(8142);
+        mX3.setScopeId(1);
+        ASSERT(X2 != X3);
+
+        mX1 = X2;
+        ASSERT(X1 == X2);
+
+        mX1.setIpAddress("::2");
+        ASSERT(X1 != X2);
+
+        if (verbose) { P(X1) P(X2) P(X3) }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -111,6 +111,8 @@ struct Platform {
 
         #ifdef BSLS_PLATFORM_OS_LINUX
             struct EPOLL {};
+            struct FLAT_EPOLL {}; // 'epoll' with an fd-indexed handler table
+            struct IO_URING {};   // 'io_uring' poll requests
             typedef EPOLL   DEFAULT_POLLING_MECHANISM;
         #endif
 
@@ -13,6 +13,7 @@
 BSLS_IDENT_RCSID(btlso_resolveutil_cpp,"$Id$ $CSID$")
 
 #include <btlso_ipv4address.h>
+#include <btlso_ipv6address.h>
 
 #include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
@@ -24,6 +25,7 @@ BSLS_IDENT_RCSID(btlso_resolveutil_cpp,"$Id$ $CSID$")
 #include <bsls_platform.h>
 
 #include <bsl_algorithm.h>
+#include <bsl_cstring.h>
 #include <bsl_unordered_set.h>
 
 #ifdef BSLS_PLATFORM_OS_UNIX
@@ -39,7 +41,6 @@ BSLS_IDENT_RCSID(btlso_resolveutil_cpp,"$Id$ $CSID$")
 
 #else                         // windows
 
-#include <bsl_cstring.h>      // memcpy
 #include <bsl_cstdlib.h>      // atoi()
 #include <winsock2.h>         // getservbyname()
 #include <ws2tcpip.h>         // getaddrinfo() getnameinfo()
@@ -215,6 +216,94 @@ int defaultResolveByNameImp(bsl::vector<btlso::IPv4Address> *hostAddresses,
     return 0;
 }
 
+static
+int defaultResolveByNameIPv6Imp(
+                              bsl::vector<btlso::IPv6Address> *hostAddresses,
+                              const char                      *hostName,
+                              int                              numAddresses,
+                              int                             *errorCode)
+    // Populate the specified vector 'hostAddresses' with the set of IPv6
+    // addresses and IPv4-mapped IPv4 addresses that refer to the specified
+    // host 'hostName', in the order of preference returned by the system
+    // resolver, but only take the first 'numAddresses' addresses found.
+    // Return 0 on success and a non-zero value otherwise, and set
+    // '*errorCode' to the platform-dependent error code encountered if the
+    // hostname could not be resolved.  On success, '*errorCode' is not
+    // modified.
+{
+    BSLS_ASSERT(hostAddresses);
+    BSLS_ASSERT(hostName);
+    BSLS_ASSERT(0 < numAddresses);
+
+    hostAddresses->clear();
+
+    // Only request stream sockets so that each address is reported once, and
+    // only request the address families for which the local host has a
+    // configured address.
+
+    struct addrinfo hints;
+    bsl::memset(&hints, 0, sizeof hints);
+    hints.ai_family   = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags    = AI_ADDRCONFIG;
+
+    struct addrinfo *head, *it;
+
+    int rc = getaddrinfo(hostName, 0, &hints, &head);
+    if (0 != rc) {
+        if (errorCode) {
+
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+            *errorCode = WSAGetLastError();
+#else
+            *errorCode = rc;
+#endif
+        }
+
+        return -1;                                                    // RETURN
+    }
+
+    // The system resolver sorts the addresses by preference (see RFC 6724),
+    // so duplicates are skipped with a linear search rather than a hash table
+    // to preserve this order.
+
+    for (it = head;
+         it && static_cast<int>(hostAddresses->size()) < numAddresses;
+         it = it->ai_next) {
+        btlso::IPv6Address address;
+
+        if (AF_INET6 == it->ai_family) {
+            const struct sockaddr_in6 *sockAddrIn6 =
+                          reinterpret_cast<struct sockaddr_in6 *>(it->ai_addr);
+            const void *ipAddr = &sockAddrIn6->sin6_addr;
+
+            address.setIpAddress(static_cast<const unsigned char *>(ipAddr));
+            address.setScopeId(sockAddrIn6->sin6_scope_id);
+        }
+        else if (AF_INET == it->ai_family) {
+            const struct sockaddr_in *sockAddrIn =
+                           reinterpret_cast<struct sockaddr_in *>(it->ai_addr);
+
+            const btlso::IPv4Address ipv4Address(sockAddrIn->sin_addr.s_addr,
+                                                 0);
+            address = btlso::IPv6Address(ipv4Address);
+        }
+        else {
+            continue;
+        }
+
+        if (hostAddresses->end() == bsl::find(hostAddresses->begin(),
+                                              hostAddresses->end(),
+                                              address)) {
+            hostAddresses->push_back(address);
+        }
+    }
+
+    freeaddrinfo(head);
+
+    return 0;
+}
+
 namespace btlso {
                           // ------------------
                           // struct ResolveUtil
@@ -282,6 +371,43 @@ int ResolveUtil::getAddresses(bsl::vector<IPv4Address> *result,
     return s_callback_p(result, hostName, INT_MAX, errorCode);
 }
 
+int ResolveUtil::getAddress(IPv6Address *result,
+                            const char  *hostName,
+                            int         *errorCode)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(hostName);
+
+    // Avoid dynamic memory allocation.
+
+    IPv6Address                        stackBuffer;
+    bdlma::BufferedSequentialAllocator allocator(
+                                        reinterpret_cast<char *>(&stackBuffer),
+                                        sizeof stackBuffer);
+    bsl::vector<IPv6Address>           buffer(&allocator);
+
+    if (defaultResolveByNameIPv6Imp(&buffer,
+                                    hostName,
+                                    1,
+                                    errorCode) || buffer.size() < 1) {
+        return -1;                                                    // RETURN
+    }
+
+    result->setIpAddress(buffer.front().ipAddress());
+    result->setScopeId(buffer.front().scopeId());
+    return 0;
+}
+
+int ResolveUtil::getAddresses(bsl::vector<IPv6Address> *result,
+                              const char               *hostName,
+                              int                      *errorCode)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(hostName);
+
+    return defaultResolveByNameIPv6Imp(result, hostName, INT_MAX, errorCode);
+}
+
 int ResolveUtil::getServicePort(IPv4Address *result,
                                 const char  *serviceName,
                                 const char  *protocol,
@@ -15,7 +15,7 @@
 #endif
 BSLS_IDENT("$Id: $")
 
-//@PURPOSE: Provide operations to resolve an IPv4 address given a name.
+//@PURPOSE: Provide operations to resolve an IP address given a name.
 //
 //@CLASSES:
 //  btlso::ResolveUtil: namespace for platform-independent resolution utilities
@@ -23,17 +23,28 @@ BSLS_IDENT("$Id: $")
 //@SEE_ALSO: btlso_socketoptutil btlso_socketimputil
 //
 //@DESCRIPTION: This component provides a set of thread-safe resolution
-// functions (based on DNS and local databases) to map a name to an IPv4
-// address and a service name to the port number.  This component operates
-// using a dynamically replaceable resolution mechanism.  For applications that
-// choose to define their own mechanism for resolving addresses by name, this
-// component provides the ability to install a custom resolution callback.
-// Note that if an application provides its own mechanism to resolve by name,
-// this mechanism will be used by all calls to 'getAddress' or 'getAddresses'.
+// functions (based on DNS and local databases) to map a name to an IPv4 or
+// IPv6 address and a service name to the port number.  This component
+// operates using a dynamically replaceable resolution mechanism.  For
+// applications that choose to define their own mechanism for resolving
+// addresses by name, this component provides the ability to install a custom
+// resolution callback.  Note that if an application provides its own
+// mechanism to resolve by name, this mechanism will be used by all calls to
+// 'getAddress' or 'getAddresses' loading 'btlso::IPv4Address' objects.
 // Otherwise, the default implementation will be used.  An application can
 // always use the default implementation by calling the 'getAddressDefault' and
 // 'getAddressDefault' methods explicitly.
 //
+///Dual-Stack Resolution
+///---------------------
+// The 'getAddress' and 'getAddresses' overloads loading 'btlso::IPv6Address'
+// objects return both the IPv6 and the IPv4 addresses of a host, the latter
+// as IPv4-mapped IPv6 addresses, in the order of preference determined by the
+// platform resolver (see RFC 6724).  On a dual-stack host, connecting an IPv6
+// socket to these addresses in order reaches the peer over the preferred
+// route, whichever protocol it uses, without the application having to
+// handle two address types.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -126,6 +137,7 @@ namespace BloombergLP {
 namespace btlso {
 
 class IPv4Address;
+class IPv6Address;
 
                         // ==================
                         // struct ResolveUtil
@@ -201,6 +213,35 @@ struct ResolveUtil {
         //                                    errorCode);
         //..
 
+    static int getAddress(IPv6Address *result,
+                          const char  *hostName,
+                          int         *errorCode = 0);
+        // Load into the specified 'result' the most preferred IPv6 address of
+        // the specified 'hostName', where an IPv4 address is represented as
+        // an IPv4-mapped IPv6 address (see 'btlso_ipv6address').  Return 0,
+        // with no effect on 'errorCode', on success, and return a negative
+        // value otherwise.  If an error occurs, the optionally specified
+        // 'errorCode' is set to the native error code of the operation and
+        // 'result' is unchanged.  Note that the port number of 'result' is
+        // not modified.  Also note that this function always uses the
+        // default resolution mechanism, as a 'ResolveByNameCallback' can only
+        // provide IPv4 addresses.
+
+    static int getAddresses(bsl::vector<IPv6Address> *result,
+                            const char               *hostName,
+                            int                      *errorCode = 0);
+        // Load into the specified array 'result' all IPv6 addresses of the
+        // specified 'hostName', where IPv4 addresses are represented as
+        // IPv4-mapped IPv6 addresses (see 'btlso_ipv6address'), in the order
+        // of preference determined by the platform resolver (see RFC 6724).
+        // Only the address families for which the local host has a configured
+        // address are returned.  Return 0, with no effect on 'errorCode', on
+        // success, and return a negative value otherwise.  If an error occurs,
+        // the optionally specified 'errorCode' is set to the native error code
+        // of the operation.  Note that this function always uses the default
+        // resolution mechanism, as a 'ResolveByNameCallback' can only provide
+        // IPv4 addresses.
+
     static int getHostnameByAddress(bsl::string        *canonicalHostname,
                                     const IPv4Address&  address,
                                     int                *errorCode = 0);
@@ -12,6 +12,7 @@
 #include <btlso_sockethandle.h>
 #include <btlso_socketimputil.h>
 #include <btlso_ipv4address.h>
+#include <btlso_ipv6address.h>
 
 #include <bslma_testallocator.h>                // for testing only
 #include <bslma_testallocatorexception.h>       // for testing only
@@ -70,8 +71,10 @@ using namespace bsl;  // automatically added by script
 // [ 6] ResolveByNameCallback setResolveByNameCallback(callback);
 // [ 6] ResolveByNameCallback currentResolveByNameCallback();
 // [ 6] ResolveByNameCallback defaultResolveByNameCallback();
+// [ 7] int getAddress(btlso::IPv6Address *result, hostname, errorCode = 0);
+// [ 7] int getAddresses(vector<btlso::IPv6Address> *, hostname, errorCode);
 // ----------------------------------------------------------------------------
-// [ 7] USAGE example
+// [ 8] USAGE example
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
 // ----------------------------------------------------------------------------
@@ -210,7 +213,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator testAllocator(veryVeryVerbose);
 
     switch (test) { case 0:  // always the leading case.
-        case 7: {
+        case 8: {
             // ----------------------------------------------------------------
             // TESTING USAGE EXAMPLE
             //   The usage example provided in the component header file must
@@ -315,6 +318,116 @@ int main(int argc, char *argv[])
 //..
 
         } break;
+        case 7: {
+            // ----------------------------------------------------------------
+            // TESTING IPV6 RESOLUTION
+            //   Concerns:
+            //   1.  Numeric IPv6 and IPv4 host names resolve to themselves,
+            //   the latter as IPv4-mapped addresses.
+            //   2.  The addresses of a name are returned without duplicates,
+            //   and 'getAddress' returns the first of them.
+            //   3.  The user-installed callback is not consulted.
+            //   4.  An unresolvable name fails, sets 'errorCode', and leaves
+            //   'result' unchanged.
+            //
+            // Plan:
+            //   Resolve numeric names, "localhost" and an invalid name, with
+            //   a callback installed that always fails.
+            //
+            // Testing
+            //   int getAddress(btlso::IPv6Address *result, host, code);
+            //   int getAddresses(vector<btlso::IPv6Address> *, host, code);
+            // ----------------------------------------------------------------
+
+            if (verbose) cout << "\nTesting IPv6 resolution"
+                              << "\n=======================" << endl;
+
+            typedef btlso::IPv6Address A6;
+
+            // 'myCallbackMap' is empty, so the callback fails for any name.
+
+            btlso::ResolveUtil::ResolveByNameCallback previous =
+                        btlso::ResolveUtil::setResolveByNameCallback(
+                                                    &myResolveByNameCallback);
+
+            const A6 UNUSED_ADDRESS("2001:db8::1", 1000);
+            int      errorCode = 0;
+
+            if (verbose) cout << "\tNumeric host names." << endl;
+            {
+                bsl::vector<A6> result;
+
+                // Numeric addresses of a family not configured on the host
+                // are filtered out, so check which families are available.
+
+                A6 mX(UNUSED_ADDRESS);  const A6& X = mX;
+                if (0 == btlso::ResolveUtil::getAddress(&mX, "::1")) {
+                    ASSERT(A6("::1", 1000) == X);
+
+                    ASSERT(0 == btlso::ResolveUtil::getAddresses(&result,
+                                                                 "::1"));
+                    ASSERT(1 == result.size());
+                    ASSERT(A6("::1", 0) == result[0]);
+                }
+                else if (verbose) {
+                    cout << "\tIPv6 is not configured." << endl;
+                }
+
+                mX = UNUSED_ADDRESS;
+                ASSERT(0 == btlso::ResolveUtil::getAddress(&mX, "127.0.0.1"));
+                ASSERT(X.isIPv4Mapped());
+                ASSERT(A6("127.0.0.1", 1000) == X);
+            }
+
+            if (verbose) cout << "\tLocal host." << endl;
+            {
+                bsl::vector<A6> result;
+                ASSERT(0 == btlso::ResolveUtil::getAddresses(&result,
+                                                             "localhost",
+                                                             &errorCode));
+                ASSERT(0 == errorCode);
+                ASSERT(1 <= result.size());
+
+                for (int i = 0; i < (int) result.size(); ++i) {
+                    if (veryVerbose) { P_(i) P(result[i]) }
+
+                    LOOP_ASSERT(i, 0 == result[i].portNumber());
+                    for (int j = 0; j < i; ++j) {
+                        LOOP2_ASSERT(i, j, result[i] != result[j]);
+                    }
+                }
+
+                A6 mX(UNUSED_ADDRESS);  const A6& X = mX;
+                ASSERT(0 == btlso::ResolveUtil::getAddress(&mX, "localhost"));
+                ASSERT(1000 == X.portNumber());
+                ASSERT(0 == bsl::memcmp(result[0].ipAddress(),
+                                        X.ipAddress(),
+                                        A6::k_ADDRESS_LENGTH));
+            }
+
+            if (verbose) cout << "\tInvalid host name." << endl;
+            {
+                A6 mX(UNUSED_ADDRESS);  const A6& X = mX;
+
+                errorCode = 0;
+                ASSERT(0 != btlso::ResolveUtil::getAddress(
+                                                      &mX,
+                                                      "no.such.host.invalid",
+                                                      &errorCode));
+                ASSERT(0 != errorCode);
+                ASSERT(UNUSED_ADDRESS == X);
+
+                bsl::vector<A6> result;
+                errorCode = 0;
+                ASSERT(0 != btlso::ResolveUtil::getAddresses(
+                                                      &result,
+                                                      "no.such.host.invalid",
+                                                      &errorCode));
+                ASSERT(0 != errorCode);
+            }
+
+            btlso::ResolveUtil::setResolveByNameCallback(previous);
+        } break;
         case 6: {
             // ----------------------------------------------------------------
             // TESTING USER-INSTALLED CALLBACKS
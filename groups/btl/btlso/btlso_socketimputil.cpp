@@ -814,12 +814,13 @@ int btlso::SocketImpUtil::shutDown(
                         // ------------------------
                         // struct SocketImpUtil_Imp
                         // ------------------------
-template <>
-int btlso::SocketImpUtil_Imp<btlso::IPv4Address>::socketPair(
-                                       btlso::SocketHandle::Handle *newSockets,
-                                       btlso::SocketImpUtil::Type   type,
-                                       int                          protocol,
-                                       int                         *errorCode)
+template <class ADDRESS>
+int btlso::SocketImpUtil_Imp<ADDRESS>::loopbackSocketPair(
+                                  btlso::SocketHandle::Handle *newSockets,
+                                  btlso::SocketImpUtil::Type   type,
+                                  int                          protocol,
+                                  const ADDRESS&               loopbackAddress,
+                                  int                         *errorCode)
 {
     BSLS_ASSERT(newSockets);
 
@@ -846,11 +847,8 @@ int btlso::SocketImpUtil_Imp<btlso::IPv4Address>::socketPair(
 
         // Bind to localhost and anon port.
 
-        btlso::IPv4Address localAnonAddress("127.0.0.1",
-                                            btlso::IPv4Address::k_ANY_PORT);
-
         classification = btlso::SocketImpUtil::bind(listenSocket,
-                                                    localAnonAddress,
+                                                    loopbackAddress,
                                                     errorCode);
         // Test for errors
 
@@ -861,7 +859,7 @@ int btlso::SocketImpUtil_Imp<btlso::IPv4Address>::socketPair(
 
         // Get the address for the client to connect to
 
-        btlso::IPv4Address localAddress;
+        ADDRESS localAddress;
         classification = btlso::SocketImpUtil::getLocalAddress(&localAddress,
                                                                listenSocket,
                                                                errorCode);
@@ -929,7 +927,7 @@ int btlso::SocketImpUtil_Imp<btlso::IPv4Address>::socketPair(
 
         // Validate that both sockets are connected to each other.
 
-        btlso::IPv4Address clientAddress, peerAddress;
+        ADDRESS clientAddress, peerAddress;
         classification = btlso::SocketImpUtil::getLocalAddress(&clientAddress,
                                                                clientSocket,
                                                                errorCode);
@@ -970,11 +968,8 @@ int btlso::SocketImpUtil_Imp<btlso::IPv4Address>::socketPair(
 
         // Bind to localhost and anon port.
 
-        btlso::IPv4Address localAnonAddress("127.0.0.1",
-                                            btlso::IPv4Address::k_ANY_PORT);
-
         classification = btlso::SocketImpUtil::bind(clientSocket,
-                                                    localAnonAddress,
+                                                    loopbackAddress,
                                                     errorCode);
 
         // Test for errors
@@ -986,7 +981,7 @@ int btlso::SocketImpUtil_Imp<btlso::IPv4Address>::socketPair(
 
         // Get the address for the peer to connect to
 
-        btlso::IPv4Address clientAddress;
+        ADDRESS clientAddress;
         classification = btlso::SocketImpUtil::getLocalAddress(&clientAddress,
                                                                clientSocket,
                                                                errorCode);
@@ -1012,7 +1007,7 @@ int btlso::SocketImpUtil_Imp<btlso::IPv4Address>::socketPair(
 
         // Bind to localhost and anon port.
 
-        classification = bind(serverSocket, localAnonAddress, errorCode);
+        classification = bind(serverSocket, loopbackAddress, errorCode);
 
         // Test for errors
 
@@ -1024,7 +1019,7 @@ int btlso::SocketImpUtil_Imp<btlso::IPv4Address>::socketPair(
 
         // Get the address for the peer to connect to
 
-        btlso::IPv4Address serverAddress;
+        ADDRESS serverAddress;
         classification = btlso::SocketImpUtil::getLocalAddress(&serverAddress,
                                                                serverSocket,
                                                                errorCode);
@@ -1069,6 +1064,40 @@ int btlso::SocketImpUtil_Imp<btlso::IPv4Address>::socketPair(
     return 0;
 }
 
+template <>
+int btlso::SocketImpUtil_Imp<btlso::IPv4Address>::socketPair(
+                                       btlso::SocketHandle::Handle *newSockets,
+                                       btlso::SocketImpUtil::Type   type,
+                                       int                          protocol,
+                                       int                         *errorCode)
+{
+    const btlso::IPv4Address loopbackAddress("127.0.0.1",
+                                             btlso::IPv4Address::k_ANY_PORT);
+
+    return loopbackSocketPair(newSockets,
+                              type,
+                              protocol,
+                              loopbackAddress,
+                              errorCode);
+}
+
+template <>
+int btlso::SocketImpUtil_Imp<btlso::IPv6Address>::socketPair(
+                                       btlso::SocketHandle::Handle *newSockets,
+                                       btlso::SocketImpUtil::Type   type,
+                                       int                          protocol,
+                                       int                         *errorCode)
+{
+    const btlso::IPv6Address loopbackAddress("::1",
+                                             btlso::IPv6Address::k_ANY_PORT);
+
+    return loopbackSocketPair(newSockets,
+                              type,
+                              protocol,
+                              loopbackAddress,
+                              errorCode);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
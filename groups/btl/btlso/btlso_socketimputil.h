@@ -124,9 +124,13 @@ BSLS_IDENT("$Id: $")
 // Some functions are templatized by 'ADDRESS', where 'ADDRESS' is a network
 // address type.  The address type implicitly specifies the native socket
 // domain (e.g., AF_INET for IPv4 addresses).  The address type for IPv4
-// addresses is 'btlso::IPv4Address'.  After a socket has been created with a
+// addresses is 'btlso::IPv4Address', and the address type for IPv6 addresses
+// (AF_INET6) is 'btlso::IPv6Address'.  After a socket has been created with a
 // particular address type, all further functions on this socket taking the
-// 'ADDRESS' parameter must use the same address type.
+// 'ADDRESS' parameter must use the same address type.  Note that, on
+// dual-stack hosts, an IPv6 socket can also communicate with IPv4 peers using
+// their IPv4-mapped addresses unless its 'IPV6_V6ONLY' option is set (see
+// 'btlso_ipv6address' and 'btlso::SocketOptUtil::k_IPV6ONLY').
 //
 ///Errors
 ///------
@@ -367,12 +371,21 @@ BSLS_IDENT("$Id: $")
     #define INCLUDED_WINSOCK2
     #endif
 
+    #ifndef INCLUDED_WS2TCPIP
+    #include <ws2tcpip.h>                    // for sockaddr_in6
+    #define INCLUDED_WS2TCPIP
+    #endif
+
 #endif
 
 #ifndef INCLUDED_BTLSO_IPV4ADDRESS
 #include <btlso_ipv4address.h>
 #endif
 
+#ifndef INCLUDED_BTLSO_IPV6ADDRESS
+#include <btlso_ipv6address.h>
+#endif
+
 #ifndef INCLUDED_BTLSO_SOCKETHANDLE
 #include <btlso_sockethandle.h>
 #endif
@@ -968,6 +981,52 @@ struct SocketImpUtil_Address<class IPv4Address> {
     }
 };
 
+template <>
+struct SocketImpUtil_Address<class IPv6Address> {
+    // Encapsulate the 'sockaddr_in6' structure and provide a mapping to the
+    // equivalent 'IPv6Address'.
+
+    sockaddr_in6 d_address;
+
+    enum {
+        SocketDomain = AF_INET6
+    };
+
+    // CREATORS
+    SocketImpUtil_Address() { }
+
+    SocketImpUtil_Address(const IPv6Address& addr)
+    {
+        BSLMF_ASSERT(IPv6Address::k_ADDRESS_LENGTH == sizeof(in6_addr));
+
+        // Zero the structure first, as it contains platform-specific fields
+        // (e.g., 'sin6_flowinfo' and 'sin6_len').
+
+        memset(&d_address, 0, sizeof d_address);
+
+        // The address is already in network byte order; the port number must
+        // be stored in network byte order.
+
+        memcpy(&d_address.sin6_addr,
+               addr.ipAddress(),
+               IPv6Address::k_ADDRESS_LENGTH);
+
+        d_address.sin6_port     = htons((unsigned short)addr.portNumber());
+        d_address.sin6_family   = SocketDomain;
+        d_address.sin6_scope_id = addr.scopeId();
+    }
+
+    // ACCESSORS
+    void fromSocketAddress(IPv6Address *addr) const
+    {
+        const void *ipAddr = &d_address.sin6_addr;
+
+        addr->setIpAddress(static_cast<const unsigned char *>(ipAddr));
+        addr->setPortNumber(ntohs(d_address.sin6_port));
+        addr->setScopeId(d_address.sin6_scope_id);
+    }
+};
+
                           // ========================
                           // struct SocketImpUtil_Imp
                           // ========================
@@ -1031,6 +1090,17 @@ class SocketImpUtil_Imp {
                           int                   protocol,
                           int                  *errorCode);
 
+    static int loopbackSocketPair(SocketHandle::Handle *newSockets,
+                                  SocketImpUtil::Type   type,
+                                  int                   protocol,
+                                  const ADDRESS&        loopbackAddress,
+                                  int                  *errorCode);
+        // Create a pair of sockets of the specified 'type' and 'protocol'
+        // connected to each other through anonymous ports on the specified
+        // 'loopbackAddress', and load their handles into the specified
+        // 'newSockets'.  This function implements 'socketPair' on platforms
+        // (and for address families) that do not support 'socketpair'.
+
     static int writeTo(const SocketHandle::Handle&  socket,
                        const ADDRESS&               toAddress,
                        const void                  *buffer,
@@ -1051,6 +1121,13 @@ int SocketImpUtil_Imp<btlso::IPv4Address>::socketPair(
                                       int                          protocol,
                                       int                         *errorCode);
 
+template <>
+int SocketImpUtil_Imp<btlso::IPv6Address>::socketPair(
+                                      btlso::SocketHandle::Handle *newSockets,
+                                      btlso::SocketImpUtil::Type   type,
+                                      int                          protocol,
+                                      int                         *errorCode);
+
 // ============================================================================
 //                      INLINE FUNCTION DEFINITIONS
 // ============================================================================
@@ -11,6 +11,8 @@
 #include <btlso_socketimputil.h>
 
 #include <btlso_ipv4address.h>
+#include <btlso_ipv6address.h>
+#include <btlso_socketoptutil.h>
 
 #include <bslmt_threadutil.h>
 #include <bslmt_barrier.h>
@@ -51,6 +53,8 @@ static void aSsErT(int c, const char *s, int i) {
     }
 }
 #define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+#define LOOP_ASSERT(I,X) { \
+   if (!(X)) { cout << #I << ": " << I << "\n"; aSsErT(1, #X, __LINE__); }}
 
 //=============================================================================
 //                  SEMI-STANDARD TEST OUTPUT MACROS
@@ -223,7 +227,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 2: {
+      case 3: {
         // --------------------------------------------------------------------
         // USAGE TEST
         //
@@ -335,6 +339,166 @@ int main(int argc, char *argv[])
      ASSERT(0 == bslmt::ThreadUtil::join(stid));
      ASSERT(0 == bslmt::ThreadUtil::join(ctid));
       } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING IPV6 SOCKETS
+        //
+        // Concerns:
+        //: 1 'btlso::IPv6Address' can be used to open, bind, connect and
+        //:   accept 'AF_INET6' stream sockets, and the local and peer
+        //:   addresses reported for both ends are consistent.
+        //:
+        //: 2 'socketPair' creates connected pairs of IPv6 stream and datagram
+        //:   sockets.
+        //:
+        //: 3 With 'k_IPV6ONLY' disabled, an IPv6 socket can connect to an IPv4
+        //:   listener through its IPv4-mapped address.
+        //
+        // Plan:
+        //: 1 Connect a client to a listener bound to an anonymous port on
+        //:   "::1", exchange data, and compare the addresses.  (C-1)
+        //:
+        //: 2 Create IPv6 socket pairs and exchange data.  (C-2)
+        //:
+        //: 3 Connect an IPv6 client, with 'k_IPV6ONLY' disabled, to an IPv4
+        //:   listener on "127.0.0.1", and verify the addresses.  (C-3)
+        //
+        // Testing:
+        //   IPv6 SOCKETS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING IPV6 SOCKETS" << endl
+                          << "====================" << endl;
+
+        typedef btlso::IPv6Address A6;
+
+        int errorCode = 0;
+        ASSERT(0 == T::startup(&errorCode));
+
+        SockType listener, client, server;
+
+        int rc = T::open<A6>(&listener, T::k_SOCKET_STREAM, &errorCode);
+        if (0 != rc) {
+            // IPv6 is not available on this host.
+
+            if (verbose) cout << "IPv6 is not supported: " << errorCode
+                              << endl;
+            break;
+        }
+
+        if (verbose) cout << "\tConnecting over \"::1\"." << endl;
+        {
+            ASSERT(0 == T::bind(listener, A6("::1", 0), &errorCode));
+            ASSERT(0 == T::listen(listener, 1, &errorCode));
+
+            A6 listenerAddress;
+            ASSERT(0 == T::getLocalAddress(&listenerAddress,
+                                           listener,
+                                           &errorCode));
+            ASSERT(A6("::1", 0) != listenerAddress);
+            ASSERT(0 != listenerAddress.portNumber());
+
+            ASSERT(0 == T::open<A6>(&client, T::k_SOCKET_STREAM, &errorCode));
+            ASSERT(0 == T::connect(client, listenerAddress, &errorCode));
+
+            A6 peerAddress;
+            ASSERT(0 == T::accept(&server, &peerAddress, listener));
+
+            A6 clientAddress, serverPeerAddress;
+            ASSERT(0 == T::getLocalAddress(&clientAddress, client));
+            ASSERT(0 == T::getPeerAddress(&serverPeerAddress, client));
+            ASSERT(clientAddress   == peerAddress);
+            ASSERT(listenerAddress == serverPeerAddress);
+
+            if (veryVerbose) { P(listenerAddress) P(clientAddress) }
+
+            const char buffer[] = { 1, 2, 3, 4 };
+            char       readBuffer[sizeof buffer];
+
+            ASSERT(sizeof buffer == T::write(client, buffer, sizeof buffer));
+            ASSERT(sizeof buffer == T::read(readBuffer,
+                                            server,
+                                            sizeof readBuffer));
+            ASSERT(0 == bsl::memcmp(buffer, readBuffer, sizeof buffer));
+
+            T::close(server);
+            T::close(client);
+            T::close(listener);
+        }
+
+        if (verbose) cout << "\tSocket pairs." << endl;
+        {
+            const T::Type TYPES[] = { T::k_SOCKET_STREAM,
+                                      T::k_SOCKET_DATAGRAM };
+
+            for (int i = 0; i < 2; ++i) {
+                SockType s[2];
+                ASSERT(0 == T::socketPair<A6>(s, TYPES[i], &errorCode));
+
+                const char buffer[] = { 10, 9, 1, 2, 3, 4, 5 };
+                char       readBuffer[sizeof buffer + 1];
+
+                LOOP_ASSERT(i, sizeof buffer == T::write(s[0],
+                                                         buffer,
+                                                         sizeof buffer));
+                LOOP_ASSERT(i, sizeof buffer == T::read(readBuffer,
+                                                        s[1],
+                                                        sizeof readBuffer));
+                LOOP_ASSERT(i, sizeof buffer == T::write(s[1],
+                                                         buffer,
+                                                         sizeof buffer));
+                LOOP_ASSERT(i, sizeof buffer == T::read(readBuffer,
+                                                        s[0],
+                                                        sizeof readBuffer));
+
+                A6 address;
+                LOOP_ASSERT(i, 0 == T::getLocalAddress(&address, s[0]));
+                LOOP_ASSERT(i, 0 == bsl::memcmp(A6("::1", 0).ipAddress(),
+                                                address.ipAddress(),
+                                                A6::k_ADDRESS_LENGTH));
+
+                T::close(s[0]);
+                T::close(s[1]);
+            }
+        }
+
+        if (verbose) cout << "\tConnecting to an IPv4 listener." << endl;
+        {
+            ASSERT(0 == T::open<A>(&listener, T::k_SOCKET_STREAM));
+            ASSERT(0 == T::bind(listener, A("127.0.0.1", 0)));
+            ASSERT(0 == T::listen(listener, 1));
+
+            A listenerAddress;
+            ASSERT(0 == T::getLocalAddress(&listenerAddress, listener));
+
+            ASSERT(0 == T::open<A6>(&client, T::k_SOCKET_STREAM));
+            ASSERT(0 == btlso::SocketOptUtil::setOption(
+                                           client,
+                                           btlso::SocketOptUtil::k_IPV6LEVEL,
+                                           btlso::SocketOptUtil::k_IPV6ONLY,
+                                           0));
+            ASSERT(0 == T::connect(client, A6(listenerAddress)));
+
+            A peerAddress;
+            ASSERT(0 == T::accept(&server, &peerAddress, listener));
+
+            A6 clientAddress, clientPeerAddress;
+            ASSERT(0 == T::getLocalAddress(&clientAddress, client));
+            ASSERT(0 == T::getPeerAddress(&clientPeerAddress, client));
+            ASSERT(clientAddress.isIPv4Mapped());
+            ASSERT(A6(listenerAddress) == clientPeerAddress);
+
+            A clientIPv4Address;
+            ASSERT(0 == clientAddress.loadIPv4Address(&clientIPv4Address));
+            ASSERT(peerAddress == clientIPv4Address);
+
+            T::close(server);
+            T::close(client);
+            T::close(listener);
+        }
+
+        ASSERT(0 == T::cleanup(&errorCode));
+      } break;
       case 1: {
         // --------------------------------------------------------------------
         // BREATHING TEST
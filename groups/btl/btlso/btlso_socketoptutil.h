@@ -26,10 +26,10 @@ BSLS_IDENT("$Id: $")
 // procedures to manipulate options on sockets.  These options are enumerated
 // for non-platform-specific option classifications.  These options can exist
 // at multiple levels such as 'SOL_SOCKET', 'IPPROTO_TCP' and 'IPPROTO_IP'.
-// The supported levels include 'SOL_SOCKET' and 'IPPROTO_TCP'.  This component
-// acts as a pass-through between the system and the application.
-// Particularly, the option name and option level are passed directly (i.e.,
-// without any modification) into system calls.
+// The supported levels include 'SOL_SOCKET', 'IPPROTO_TCP' and 'IPPROTO_IPV6'.
+// This component acts as a pass-through between the system and the
+// application.  Particularly, the option name and option level are passed
+// directly (i.e., without any modification) into system calls.
 //
 ///Usage
 ///-----
@@ -191,6 +191,11 @@ BSLS_IDENT("$Id: $")
     #include <winsock2.h>
     #define INCLUDED_WINSOCK2
     #endif
+
+    #ifndef INCLUDED_WS2TCPIP
+    #include <ws2tcpip.h>                    // for IPV6_V6ONLY
+    #define INCLUDED_WS2TCPIP
+    #endif
 #endif
 
 namespace BloombergLP {
@@ -250,7 +255,8 @@ struct SocketOptUtil {
         // and the name of the option must be specified.
 
         k_SOCKETLEVEL     = SOL_SOCKET,     // System socket level
-        k_TCPLEVEL        = IPPROTO_TCP     // Protocol level (TCP)
+        k_TCPLEVEL        = IPPROTO_TCP,    // Protocol level (TCP)
+        k_IPV6LEVEL       = IPPROTO_IPV6    // Protocol level (IPv6)
 
 
     };
@@ -264,6 +270,14 @@ struct SocketOptUtil {
 
         k_REUSEADDRESS   = SO_REUSEADDR,  // enable/disable local address reuse
 
+#ifdef SO_REUSEPORT
+        k_REUSEPORT      = SO_REUSEPORT,  // enable/disable binding several
+                                          // sockets to the same address and
+                                          // port, with incoming connections
+                                          // load-balanced across them (not
+                                          // available on all platforms)
+#endif
+
         k_KEEPALIVE      = SO_KEEPALIVE,  // enable/disable keep connections
                                           // alive
 
@@ -310,6 +324,18 @@ struct SocketOptUtil {
 
     };
 
+    // For level = k_IPV6LEVEL
+    enum {
+        k_IPV6ONLY = IPV6_V6ONLY    // Specifies whether an IPv6 socket is
+                                    // restricted to IPv6 communication.  By
+                                    // default on most platforms (but not on
+                                    // Windows), an IPv6 socket can also
+                                    // communicate with IPv4 peers using their
+                                    // IPv4-mapped addresses.  Note that this
+                                    // option must be set before the socket is
+                                    // bound.
+    };
+
     template <class T>
     static int setOption(SocketHandle::Handle handle,
                          int                  level,
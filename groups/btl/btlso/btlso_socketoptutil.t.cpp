@@ -1252,6 +1252,9 @@ int main(int argc, char *argv[])
                   { L_,  btlso::SocketOptUtil::k_DEBUGINFO,     1,  0 },
                   #endif
                   { L_,  btlso::SocketOptUtil::k_REUSEADDRESS,  1,  0 },
+                  #ifdef SO_REUSEPORT
+                  { L_,  btlso::SocketOptUtil::k_REUSEPORT,     1,  0 },
+                  #endif
                   { L_,  btlso::SocketOptUtil::k_DONTROUTE,     1,  0 },
                   { L_,  btlso::SocketOptUtil::k_SENDBUFFER,   64,  32 },
                   { L_,  btlso::SocketOptUtil::k_RECEIVEBUFFER,64,  32 }
@@ -1333,7 +1336,10 @@ int main(int argc, char *argv[])
                         LOOP2_ASSERT(i, j, 0 == errorcode);
                         LOOP2_ASSERT(i, j, 0 != optResult);
                         // SNDBUF and RCVBUF don't go through the follow block.
-                        if(j != 3 && j != 4) {
+                        if (SOCK_OPTS[j].opt !=
+                                      btlso::SocketOptUtil::k_SENDBUFFER
+                         && SOCK_OPTS[j].opt !=
+                                     btlso::SocketOptUtil::k_RECEIVEBUFFER) {
                             result = btlso::SocketOptUtil::setOption(
                                         serverSocket[i],
                                         btlso::SocketOptUtil::k_SOCKETLEVEL,
@@ -0,0 +1,148 @@
+// binarylogformatter.m.cpp                                           -*-C++-*-
+
+// Render log files written by 'ball::BinaryFileObserver' as text.
+//
+// Usage:
+//..
+//  binarylogformatter [-f <format>] [-l] <file> [<file> ...]
+//..
+// Each record read from the specified files, in order, is written to 'stdout'
+// using a 'ball::RecordStringFormatter' configured with the '<format>'
+// specification (see 'ball_recordstringformatter' for the supported '%'
+// escape sequences).  If '-f' is not specified, the default format of
+// 'ball::RecordStringFormatter' is used.  If '-l' is specified, timestamps
+// are rendered in local time rather than UTC.  A file name of "-" reads from
+// 'stdin'.  The exit status is 0 if every file was read in its entirety, and
+// non-zero otherwise.
+
+#include <ball_record.h>
+#include <ball_recordbinaryutil.h>
+#include <ball_recordstringformatter.h>
+
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_streambuf.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+void printUsage(const char *programName)
+    // Print a usage message for the program having the specified
+    // 'programName' to 'stderr'.
+{
+    bsl::cerr << "usage: " << programName
+              << " [-f <format>] [-l] <file> [<file> ...]\n";
+}
+
+int renderFile(bsl::ostream&                      output,
+               bsl::streambuf                    *input,
+               const char                        *inputName,
+               const ball::RecordStringFormatter&  formatter)
+    // Write to the specified 'output' each record read from the specified
+    // 'input', named 'inputName' in error messages, using the specified
+    // 'formatter'.  Return 0 if 'input' was read in its entirety, and a
+    // non-zero value otherwise.
+{
+    ball::Record      record;
+    bsl::vector<char> buffer;
+    int               numRecords = 0;
+    int               rc;
+
+    while (0 == (rc = ball::RecordBinaryUtil::readRecord(&record,
+                                                         input,
+                                                         &buffer))) {
+        formatter(output, record);
+        ++numRecords;
+    }
+
+    if (1 != rc) {
+        bsl::cerr << inputName << ": malformed record after " << numRecords
+                  << " records (status " << rc << ")\n";
+        return rc;                                                    // RETURN
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
+
+int main(int argc, char *argv[])
+{
+    const char *format             = 0;
+    bool        publishInLocalTime = false;
+
+    int argIndex = 1;
+    for (; argIndex < argc && '-' == argv[argIndex][0]
+                           && '\0' != argv[argIndex][1]; ++argIndex) {
+        if (0 == bsl::strcmp(argv[argIndex], "-f") && argIndex + 1 < argc) {
+            format = argv[++argIndex];
+        }
+        else if (0 == bsl::strcmp(argv[argIndex], "-l")) {
+            publishInLocalTime = true;
+        }
+        else {
+            printUsage(argv[0]);
+            return 1;                                                 // RETURN
+        }
+    }
+
+    if (argIndex == argc) {
+        printUsage(argv[0]);
+        return 1;                                                     // RETURN
+    }
+
+    ball::RecordStringFormatter formatter(publishInLocalTime);
+    if (format) {
+        formatter.setFormat(format);
+    }
+
+    int status = 0;
+
+    for (; argIndex < argc; ++argIndex) {
+        const char *fileName = argv[argIndex];
+
+        if (0 == bsl::strcmp(fileName, "-")) {
+            if (0 != renderFile(bsl::cout,
+                                bsl::cin.rdbuf(),
+                                "<stdin>",
+                                formatter)) {
+                status = 2;
+            }
+            continue;
+        }
+
+        bsl::ifstream file(fileName,
+                           bsl::ios_base::in | bsl::ios_base::binary);
+        if (!file.is_open()) {
+            bsl::cerr << fileName << ": cannot open file\n";
+            status = 2;
+            continue;
+        }
+
+        if (0 != renderFile(bsl::cout, file.rdbuf(), fileName, formatter)) {
+            status = 2;
+        }
+    }
+
+    bsl::cout.flush();
+    return status;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2017 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------